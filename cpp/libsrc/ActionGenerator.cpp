@@ -50,6 +50,15 @@ void (*ActionGenerator::statement_handler[])(ActionGenerator& actg,
     handle_statement_error,             // Conflicts
     handle_statement_error,             // KeepWhitespace
     handle_statement_error,             // CaseSensitive
+    handle_statement_error,             // LookaheadMethod
+    handle_statement_error,             // TableScheme
+    handle_statement_error,             // KeywordTable
+    handle_statement_error,             // LinearScan
+    handle_statement_error,             // LazyScanner
+    handle_statement_error,             // PipelineScanner
+    handle_statement_error,             // InternLexemes
+    handle_statement_error,             // LazyAst
+    handle_statement_error,             // MinimizeMethod
     handle_statement_error,             // TokenDeclaration
     handle_statement_error,             // TokenOptionList
     handle_statement_error,             // TokenTemplate
@@ -61,6 +70,7 @@ void (*ActionGenerator::statement_handler[])(ActionGenerator& actg,
     handle_statement_error,             // TokenLexeme
     handle_statement_error,             // TokenIgnore
     handle_statement_error,             // TokenError
+    handle_statement_error,             // TokenSync
     handle_statement_error,             // Rule
     handle_statement_error,             // RuleRhsList
     handle_statement_error,             // RuleRhs
@@ -181,6 +191,15 @@ const char* ActionGenerator::statement_handler_name[]
     "handle_statement_error",           // Conflicts
     "handle_statement_error",           // KeepWhitespace
     "handle_statement_error",           // CaseSensitive
+    "handle_statement_error",           // LookaheadMethod
+    "handle_statement_error",           // TableScheme
+    "handle_statement_error",           // KeywordTable
+    "handle_statement_error",           // LinearScan
+    "handle_statement_error",           // LazyScanner
+    "handle_statement_error",           // PipelineScanner
+    "handle_statement_error",           // InternLexemes
+    "handle_statement_error",           // LazyAst
+    "handle_statement_error",           // MinimizeMethod
     "handle_statement_error",           // TokenDeclaration
     "handle_statement_error",           // TokenOptionList
     "handle_statement_error",           // TokenTemplate
@@ -192,6 +211,7 @@ const char* ActionGenerator::statement_handler_name[]
     "handle_statement_error",           // TokenLexeme
     "handle_statement_error",           // TokenIgnore
     "handle_statement_error",           // TokenError
+    "handle_statement_error",           // TokenSync
     "handle_statement_error",           // Rule
     "handle_statement_error",           // RuleRhsList
     "handle_statement_error",           // RuleRhs
@@ -321,6 +341,15 @@ void (*ActionGenerator::expression_handler[])(ActionGenerator& actg,
     handle_expression_error,          // Conflicts
     handle_expression_error,          // KeepWhitespace
     handle_expression_error,          // CaseSensitive
+    handle_expression_error,          // LookaheadMethod
+    handle_expression_error,          // TableScheme
+    handle_expression_error,          // KeywordTable
+    handle_expression_error,          // LinearScan
+    handle_expression_error,          // LazyScanner
+    handle_expression_error,          // PipelineScanner
+    handle_expression_error,          // InternLexemes
+    handle_expression_error,          // LazyAst
+    handle_expression_error,          // MinimizeMethod
     handle_expression_error,          // TokenDeclaration
     handle_expression_error,          // TokenOptionList
     handle_expression_error,          // TokenTemplate
@@ -332,6 +361,7 @@ void (*ActionGenerator::expression_handler[])(ActionGenerator& actg,
     handle_expression_error,          // TokenLexeme
     handle_expression_error,          // TokenIgnore
     handle_expression_error,          // TokenError
+    handle_expression_error,          // TokenSync
     handle_expression_error,          // Rule
     handle_expression_error,          // RuleRhsList
     handle_expression_error,          // RuleRhs
@@ -452,6 +482,15 @@ const char* ActionGenerator::expression_handler_name[]
     "handle_expression_error",        // Conflicts
     "handle_expression_error",        // KeepWhitespace
     "handle_expression_error",        // CaseSensitive
+    "handle_expression_error",        // LookaheadMethod
+    "handle_expression_error",        // TableScheme
+    "handle_expression_error",        // KeywordTable
+    "handle_expression_error",        // LinearScan
+    "handle_expression_error",        // LazyScanner
+    "handle_expression_error",        // PipelineScanner
+    "handle_expression_error",        // InternLexemes
+    "handle_expression_error",        // LazyAst
+    "handle_expression_error",        // MinimizeMethod
     "handle_expression_error",        // TokenDeclaration
     "handle_expression_error",        // TokenOptionList
     "handle_expression_error",        // TokenTemplate
@@ -463,6 +502,7 @@ const char* ActionGenerator::expression_handler_name[]
     "handle_expression_error",        // TokenLexeme
     "handle_expression_error",        // TokenIgnore
     "handle_expression_error",        // TokenError
+    "handle_expression_error",        // TokenSync
     "handle_expression_error",        // Rule
     "handle_expression_error",        // RuleRhsList
     "handle_expression_error",        // RuleRhs
@@ -592,6 +632,15 @@ void (*ActionGenerator::condition_handler[])(ActionGenerator& actg,
     handle_condition_error,            // Conflicts
     handle_condition_error,            // KeepWhitespace
     handle_condition_error,            // CaseSensitive
+    handle_condition_error,            // LookaheadMethod
+    handle_condition_error,            // TableScheme
+    handle_condition_error,            // KeywordTable
+    handle_condition_error,            // LinearScan
+    handle_condition_error,            // LazyScanner
+    handle_condition_error,            // PipelineScanner
+    handle_condition_error,            // InternLexemes
+    handle_condition_error,            // LazyAst
+    handle_condition_error,            // MinimizeMethod
     handle_condition_error,            // TokenDeclaration
     handle_condition_error,            // TokenOptionList
     handle_condition_error,            // TokenTemplate
@@ -603,6 +652,7 @@ void (*ActionGenerator::condition_handler[])(ActionGenerator& actg,
     handle_condition_error,            // TokenLexeme
     handle_condition_error,            // TokenIgnore
     handle_condition_error,            // TokenError
+    handle_condition_error,            // TokenSync
     handle_condition_error,            // Rule
     handle_condition_error,            // RuleRhsList
     handle_condition_error,            // RuleRhs
@@ -723,6 +773,15 @@ const char* ActionGenerator::condition_handler_name[]
     "handle_condition_error",          // Conflicts
     "handle_condition_error",          // KeepWhitespace
     "handle_condition_error",          // CaseSensitive
+    "handle_condition_error",          // LookaheadMethod
+    "handle_condition_error",          // TableScheme
+    "handle_condition_error",          // KeywordTable
+    "handle_condition_error",          // LinearScan
+    "handle_condition_error",          // LazyScanner
+    "handle_condition_error",          // PipelineScanner
+    "handle_condition_error",          // InternLexemes
+    "handle_condition_error",          // LazyAst
+    "handle_condition_error",          // MinimizeMethod
     "handle_condition_error",          // TokenDeclaration
     "handle_condition_error",          // TokenOptionList
     "handle_condition_error",          // TokenTemplate
@@ -734,6 +793,7 @@ const char* ActionGenerator::condition_handler_name[]
     "handle_condition_error",          // TokenLexeme
     "handle_condition_error",          // TokenIgnore
     "handle_condition_error",          // TokenError
+    "handle_condition_error",          // TokenSync
     "handle_condition_error",          // Rule
     "handle_condition_error",          // RuleRhsList
     "handle_condition_error",          // RuleRhs
@@ -885,6 +945,68 @@ void ActionGenerator::generate_condition(Ast* root,
 
 }
 
+//
+//  find_registers                                                        
+//  --------------                                                        
+//                                                                        
+//  Find the registers an action or guard reads and writes, without       
+//  generating any code. The scanner generator uses this to decide        
+//  whether token actions and reduce actions can run on separate threads. 
+//
+
+void ActionGenerator::find_registers(Ast* root,
+                                     set<string>& read_set,
+                                     set<string>& write_set,
+                                     bool& dumps_stack)
+{
+
+    if (root == nullptr)
+    {
+        return;
+    }
+
+    switch (root->get_kind())
+    {
+
+        case AstType::AstActionAssign:
+        {
+            write_set.insert(root->get_child(0)->get_lexeme());
+            find_registers(root->get_child(1), read_set, write_set, dumps_stack);
+            return;
+        }
+
+        case AstType::AstIdentifier:
+        {
+            read_set.insert(root->get_lexeme());
+            return;
+        }
+
+        case AstType::AstActionTokenCount:
+        {
+            read_set.insert("token_count");
+            return;
+        }
+
+        case AstType::AstActionDumpStack:
+        {
+            dumps_stack = true;
+            return;
+        }
+
+        default:
+        {
+            break;
+        }
+
+    }
+
+    for (int i = 0; i < root->get_num_children(); i++)
+    {
+        find_registers(root->get_child(i), read_set, write_set, dumps_stack);
+    }
+
+}
+
 //
 //  handle_statement                                                         
 //  ----------------                                                         
@@ -15,6 +15,8 @@
 #include <cstring>
 #include <functional>
 #include <string>
+#include <vector>
+#include <utility>
 #include <map>
 #include <iostream>
 #include <fstream>
@@ -42,6 +44,15 @@ using namespace std;
 Ast::Ast(int num_children) : num_children(num_children)
 {
 
+    //
+    //  Most nodes are leaves, so we don't allocate an empty child array. 
+    //
+
+    if (num_children == 0)
+    {
+        return;
+    }
+
     children = new Ast*[num_children];
 
     for (int i = 0; i < num_children; i++)
@@ -54,13 +65,41 @@ Ast::Ast(int num_children) : num_children(num_children)
 Ast::~Ast()
 {
 
-    for (int i = 0; i < num_children; i++)
+    LexemeTable::detach(lexeme_text);
+
+    if (num_children == 0)
     {
-        delete children[i];
+        delete [] children;
+        return;
     }
 
+    //
+    //  Deleting children recursively can overflow the stack on a deep 
+    //  tree, so we collect the descendants on an explicit stack and    
+    //  empty each one before deleting it.                              
+    //
+
+    vector<Ast*> stack(children, children + num_children);
     delete [] children;
 
+    while (stack.size() > 0)
+    {
+
+        Ast* ast = stack.back();
+        stack.pop_back();
+
+        if (ast == nullptr)
+        {
+            continue;
+        }
+
+        stack.insert(stack.end(), ast->children, ast->children + ast->num_children);
+        ast->num_children = 0;
+
+        delete ast;
+
+    }
+
 }
 
 //
@@ -90,12 +129,60 @@ void Ast::set_location(int64_t location)
 
 std::string Ast::get_lexeme() const
 {
-    return lexeme;
+
+    if (lexeme_text == nullptr)
+    {
+        return string();
+    }
+
+    return lexeme_text->lexeme;
+
 }
 
 void Ast::set_lexeme(const std::string& lexeme)
 {
-    this->lexeme = lexeme;
+
+    LexemeTable::detach(lexeme_text);
+
+    lexeme_text = lexeme.empty() ? nullptr : LexemeTable::new_text(lexeme);
+    lexeme_id = -1;
+
+}
+
+int Ast::get_lexeme_id() const
+{
+    return lexeme_id;
+}
+
+//
+//  set_lexeme & share_lexeme                                               
+//  -------------------------                                               
+//                                                                          
+//  The engine uses these to point a node at an interned lexeme or at the  
+//  lexeme of another node without copying the text.                      
+//
+
+void Ast::set_lexeme(const LexemeTable& table, int id)
+{
+
+    LexemeTable::Text* text = table.text_list[id];
+    LexemeTable::attach(text);
+    LexemeTable::detach(lexeme_text);
+
+    lexeme_text = text;
+    lexeme_id = id;
+
+}
+
+void Ast::share_lexeme(const Ast* from)
+{
+
+    LexemeTable::attach(from->lexeme_text);
+    LexemeTable::detach(lexeme_text);
+
+    lexeme_text = from->lexeme_text;
+    lexeme_id = from->lexeme_id;
+
 }
 
 Ast* Ast::get_parent() const
@@ -135,29 +222,70 @@ void Ast::set_child(int index, Ast* ast)
 Ast* Ast::clone() const
 {
 
-    Ast* ast = new Ast(num_children);
+    //
+    //  copy_node                                            
+    //  ---------                                            
+    //                                                       
+    //  Copy one node without its children.                  
+    //
+
+    function<Ast*(const Ast*)> copy_node = [&](const Ast* from) -> Ast*
+    {
 
-    ast->kind = kind;
-    ast->location = location;
-    ast->lexeme = lexeme;
-    ast->parent = nullptr;
+        Ast* ast = new Ast(from->num_children);
 
-    for (int i = 0; i < num_children; i++)
+        ast->kind = from->kind;
+        ast->location = from->location;
+        ast->parent = nullptr;
+        ast->share_lexeme(from);
+
+        return ast;
+
+    };
+
+    //
+    //  clone                          
+    //  -----                          
+    //                                 
+    //  The function body begins here. We copy the tree with an explicit 
+    //  stack of pairs of matching nodes so a deep tree can't overflow   
+    //  the call stack.                                                  
+    //
+
+    Ast* root = copy_node(this);
+
+    vector<pair<const Ast*, Ast*>> stack;
+    stack.push_back(make_pair(this, root));
+
+    while (stack.size() > 0)
     {
 
-        if (children[i] == nullptr)
-        {
-            ast->children[i] = nullptr;
-        }
-        else
+        const Ast* from = stack.back().first;
+        Ast* to = stack.back().second;
+        stack.pop_back();
+
+        for (int i = 0; i < from->num_children; i++)
         {
-            ast->children[i] = children[i]->clone();
-            ast->children[i]->parent = ast;
+
+            if (from->children[i] == nullptr)
+            {
+                continue;
+            }
+
+            Ast* ast = copy_node(from->children[i]);
+            to->children[i] = ast;
+            ast->parent = to;
+
+            if (ast->num_children > 0)
+            {
+                stack.push_back(make_pair(from->children[i], ast));
+            }
+
         }
 
     }
 
-    return ast;
+    return root;
 
 }
 
@@ -180,13 +308,13 @@ void Ast::encode_cpp(const Ast* root,
     ofstream os(file_name.c_str());
 
     //
-    //  encode_ast                                          
-    //  ----------                                          
+    //  encode_node                                          
+    //  -----------                                          
     //                                                  
-    //  Encode one node and recurively encode children. 
+    //  Encode one node. The caller walks the children.
     //
 
-    std::function<void(const Ast*, int)> encode_ast = 
+    std::function<void(const Ast*, int)> encode_node = 
         [&](const Ast* ast, int indent) -> void
     {
 
@@ -205,7 +333,7 @@ void Ast::encode_cpp(const Ast* root,
 
         os << "\"";
 
-        for (auto c: ast->lexeme)
+        for (auto c: ast->get_lexeme())
         {
 
             switch (c)
@@ -251,12 +379,6 @@ void Ast::encode_cpp(const Ast* root,
 
         os << std::endl;
 
-        for (int i = 0; i < ast->num_children; i++)
-        {
-            Ast* child = ast->children[i];
-            encode_ast(child, indent + 4);
-        }
-
     };
 
     //
@@ -327,7 +449,34 @@ void Ast::encode_cpp(const Ast* root,
        << "    //" << endl
        << endl;
 
-    encode_ast(root, 4);
+    //
+    //  Walk the tree in preorder with an explicit stack, so deep trees
+    //  don't overflow the call stack.
+    //
+
+    vector<pair<const Ast*, int>> stack;
+    stack.push_back(make_pair(root, 4));
+
+    while (stack.size() > 0)
+    {
+
+        const Ast* ast = stack.back().first;
+        int indent = stack.back().second;
+        stack.pop_back();
+
+        encode_node(ast, indent);
+
+        if (ast == nullptr)
+        {
+            continue;
+        }
+
+        for (int i = ast->num_children - 1; i >= 0; i--)
+        {
+            stack.push_back(make_pair(ast->children[i], indent + 4));
+        }
+
+    }
 
     os << "    nullptr" << endl 
        << "};" << endl;
@@ -352,17 +501,18 @@ void Ast::decode_cpp(Ast*& root,
 {
 
     //
-    //  decode_ast                                          
-    //  ----------                                          
+    //  decode_node                                          
+    //  -----------                                          
     //                                                  
-    //  Decode one node and recurively decode children. 
+    //  Decode one node. The caller fills in the children.
     //
 
-    std::function<Ast*(int&)> decode_ast = [&](int& index) -> Ast*
+    std::function<Ast*(int&)> decode_node = [&](int& index) -> Ast*
     {
         
         if (item[index] == nullptr)
         {
+            index++;
             return nullptr;
         }
 
@@ -376,11 +526,6 @@ void Ast::decode_cpp(Ast*& root,
         ast->set_location(location);
         ast->set_lexeme(lexeme);
         
-        for (int i = 0; i < num_children; i++)
-        {
-            ast->set_child(i, decode_ast(index));
-        }
-            
         return ast;
 
     };
@@ -389,13 +534,38 @@ void Ast::decode_cpp(Ast*& root,
     //  decode_cpp                     
     //  ----------                     
     //                                 
-    //  The function body begins here. 
+    //  The function body begins here. The nodes are in preorder so each 
+    //  one is the next child of the innermost node still missing some.  
     //
 
     int index = 0;
 
     src = new Source(item[index++]);
-    root = decode_ast(index);
+    root = decode_node(index);
+
+    vector<pair<Ast*, int>> stack;
+    if (root != nullptr && root->num_children > 0)
+    {
+        stack.push_back(make_pair(root, 0));
+    }
+
+    while (stack.size() > 0)
+    {
+
+        Ast* ast = decode_node(index);
+        stack.back().first->set_child(stack.back().second++, ast);
+
+        if (ast != nullptr && ast->num_children > 0)
+        {
+            stack.push_back(make_pair(ast, 0));
+        }
+
+        while (stack.size() > 0 && stack.back().second == stack.back().first->num_children)
+        {
+            stack.pop_back();
+        }
+
+    }
 
 }
 
@@ -82,7 +82,14 @@ CodeGenerator::OpcodeInfo CodeGenerator::opcode_table[] = {
     {  "BranchLessThan",      true,   false,  OpcodeType::OpcodeBranchGreaterEqual  },
     {  "BranchLessEqual",     true,   false,  OpcodeType::OpcodeBranchGreaterThan   },
     {  "BranchGreaterThan",   true,   false,  OpcodeType::OpcodeBranchLessEqual     },
-    {  "BranchGreaterEqual",  true,   false,  OpcodeType::OpcodeBranchLessThan      }
+    {  "BranchGreaterEqual",  true,   false,  OpcodeType::OpcodeBranchLessThan      },
+    {  "ScanClass",           false,  true,   OpcodeType::OpcodeNull                },
+    {  "ScanKeyword",         false,  false,  OpcodeType::OpcodeNull                },
+    {  "ScanClassMemo",       false,  true,   OpcodeType::OpcodeNull                },
+    {  "ScanLazy",            false,  true,   OpcodeType::OpcodeNull                },
+    {  "AstLoadChild",        false,  false,  OpcodeType::OpcodeNull                },
+    {  "AstFormKind",         false,  false,  OpcodeType::OpcodeNull                },
+    {  "AstFinishReturn",     false,  true,   OpcodeType::OpcodeNull                }
 };
 
 //
@@ -317,6 +324,7 @@ ICodeRegister* CodeGenerator::get_temporary()
         ost << "Temp$" << temporary_set.size();
         ICodeRegister* register_ptr = get_register(ost.str());
         temporary_set.insert(register_ptr);
+        temporary_list.push_back(register_ptr);
 
         return register_ptr;
 
@@ -347,13 +355,93 @@ void CodeGenerator::free_all_temporaries()
         temporary_queue.pop();
     }
 
-    for (ICodeRegister* register_ptr: temporary_set)
+    for (ICodeRegister* register_ptr: temporary_list)
     {
         temporary_queue.push(register_ptr);
     }
 
 }
 
+//
+//  get_code_signature                                                   
+//  ------------------                                                   
+//                                                                       
+//  Return a string that is the same for two runs of code exactly when   
+//  they behave the same. Labels defined in the run are numbered in      
+//  order, so two runs with their own copies of a branch still match.    
+//  Locations only matter where an instruction can report an error.     
+//
+
+string CodeGenerator::get_code_signature(int64_t position) const
+{
+
+    map<ICodeLabel*, int64_t> local_label_map;
+
+    for (int64_t i = position; i < icode_list.size(); i++)
+    {
+
+        if (icode_list[i].opcode == OpcodeType::OpcodeLabel)
+        {
+            int64_t label_num = local_label_map.size();
+            local_label_map[icode_list[i].operand_list[0].label_ptr] = label_num;
+        }
+
+    }
+
+    ostringstream ost;
+
+    for (int64_t i = position; i < icode_list.size(); i++)
+    {
+
+        const ICodeInstruction& instruction = icode_list[i];
+
+        ost << instruction.opcode << " ";
+
+        if (instruction.opcode == OpcodeType::OpcodeAstIndex ||
+            instruction.opcode == OpcodeType::OpcodeAstChildSlice)
+        {
+            ost << "@" << instruction.location << " ";
+        }
+
+        for (int j = 0; j < instruction.operand_count; j++)
+        {
+
+            if (j == 0 &&
+                (instruction.opcode == OpcodeType::OpcodeLabel ||
+                 instruction.opcode == OpcodeType::OpcodeCall ||
+                 opcode_table[instruction.opcode].is_branch) &&
+                local_label_map.find(instruction.operand_list[j].label_ptr) != local_label_map.end())
+            {
+                ost << "L" << local_label_map[instruction.operand_list[j].label_ptr] << " ";
+            }
+            else
+            {
+                ost << instruction.operand_list[j].integer << " ";
+            }
+
+        }
+
+        ost << ";";
+
+    }
+
+    return ost.str();
+
+}
+
+//
+//  discard_code                                                       
+//  ------------                                                       
+//                                                                     
+//  Throw away the code emitted since a position, when we find we      
+//  already have a copy of it.                                         
+//
+
+void CodeGenerator::discard_code(int64_t position)
+{
+    icode_list.erase(icode_list.begin() + position, icode_list.end());
+}
+
 //
 //  emit                                                                
 //  ----                                                                
@@ -541,6 +629,23 @@ void CodeGenerator::generate()
         prsd.operand_list[next_operand++].branch_target = operand.label_ptr->pc;
     };
 
+    //
+    //  encode_optional_label_operand. A missing label becomes -1.
+    //
+
+    function<void(ICodeOperand)> encode_optional_label_operand = [&](ICodeOperand operand) -> void
+    {
+
+        if (operand.label_ptr == nullptr)
+        {
+            prsd.operand_list[next_operand++].branch_target = -1;
+            return;
+        }
+
+        prsd.operand_list[next_operand++].branch_target = operand.label_ptr->pc;
+
+    };
+
     //
     //  generate
     //  --------
@@ -558,7 +663,17 @@ void CodeGenerator::generate()
         dump_icode();
     }
 
+    int64_t original_count = icode_list.size();
+
     optimize();
+    optimize_actions();
+
+    if ((debug_flags & DebugType::DebugProgress) != 0)
+    {
+        cout << "Optimized code from " << original_count << " to "
+             << icode_list.size() << " instructions: "
+             << prsi.elapsed_time_string() << endl;
+    }
 
     if ((debug_flags & DebugType::DebugICode) != 0)
     {
@@ -694,6 +809,98 @@ void CodeGenerator::generate()
             
             }
             
+            case OpcodeScanClass:
+            case OpcodeScanClassMemo:
+            {
+            
+                int operand = 0;
+            
+                encode_integer_operand(instruction.operand_list[operand++]);
+                encode_integer_operand(instruction.operand_list[operand]);
+                for (int i = 0; i < instruction.operand_list[operand].integer; i++)
+                {
+                    encode_optional_label_operand(instruction.operand_list[operand + i + 1]);
+                }
+            
+                operand += instruction.operand_list[operand].integer + 1;
+                break;
+            
+            }
+            
+            case OpcodeScanKeyword:
+            {
+            
+                int operand = 0;
+            
+                encode_integer_operand(instruction.operand_list[operand++]);
+                int64_t bucket_count = instruction.operand_list[operand].integer;
+                encode_integer_operand(instruction.operand_list[operand++]);
+                for (int i = 0; i < bucket_count; i++)
+                {
+                    encode_integer_operand(instruction.operand_list[operand++]);
+                }
+            
+                int64_t slot_count = instruction.operand_list[operand].integer;
+                encode_integer_operand(instruction.operand_list[operand++]);
+                for (int i = 0; i < slot_count; i++)
+                {
+                    encode_integer_operand(instruction.operand_list[operand++]);
+                    encode_string_operand(instruction.operand_list[operand++]);
+                }
+            
+                break;
+            
+            }
+            
+            case OpcodeScanLazy:
+            {
+            
+                int operand = 0;
+            
+                encode_integer_operand(instruction.operand_list[operand++]);
+                encode_integer_operand(instruction.operand_list[operand]);
+                int64_t accept_count = instruction.operand_list[operand++].integer;
+                for (int i = 0; i < accept_count; i++)
+                {
+                    encode_integer_operand(instruction.operand_list[operand++]);
+                    encode_label_operand(instruction.operand_list[operand++]);
+                    encode_optional_label_operand(instruction.operand_list[operand++]);
+                }
+            
+                encode_integer_operand(instruction.operand_list[operand]);
+                int64_t state_count = instruction.operand_list[operand++].integer;
+                for (int i = 0; i < state_count; i++)
+                {
+            
+                    encode_integer_operand(instruction.operand_list[operand]);
+                    int64_t e_move_count = instruction.operand_list[operand++].integer;
+                    for (int j = 0; j < e_move_count; j++)
+                    {
+                        encode_integer_operand(instruction.operand_list[operand++]);
+                    }
+            
+                    encode_integer_operand(instruction.operand_list[operand]);
+                    int64_t transition_count = instruction.operand_list[operand++].integer;
+                    for (int j = 0; j < transition_count; j++)
+                    {
+                        encode_character_operand(instruction.operand_list[operand++]);
+                        encode_character_operand(instruction.operand_list[operand++]);
+                        encode_integer_operand(instruction.operand_list[operand++]);
+                    }
+            
+                    encode_integer_operand(instruction.operand_list[operand]);
+                    int64_t accept_num_count = instruction.operand_list[operand++].integer;
+                    for (int j = 0; j < accept_num_count; j++)
+                    {
+                        encode_integer_operand(instruction.operand_list[operand++]);
+                    }
+            
+                }
+            
+                break;
+            
+            }
+            
             case OpcodeScanAccept:
             {
             
@@ -725,6 +932,7 @@ void CodeGenerator::generate()
             }
             
             case OpcodeAstFinish:
+            case OpcodeAstFinishReturn:
             case OpcodeAstLocationNum:
             {
             
@@ -745,7 +953,20 @@ void CodeGenerator::generate()
             
             }
             
+            case OpcodeAstFormKind:
+            {
+            
+                int operand = 0;
+                encode_register_operand(instruction.operand_list[operand++]);
+                encode_register_operand(instruction.operand_list[operand++]);
+                encode_integer_operand(instruction.operand_list[operand++]);
+                encode_kind_operand(instruction.operand_list[operand++]);
+                break;
+            
+            }
+            
             case OpcodeAstLoad:
+            case OpcodeAstLoadChild:
             {
             
                 int operand = 0;
@@ -1012,12 +1233,43 @@ void CodeGenerator::optimize()
                     break;
                 }
                 
+                case OpcodeScanClass:
+                case OpcodeScanClassMemo:
+                {
+                    for (int64_t j = 0; j < instruction.operand_list[1].integer; j++)
+                    {
+                        if (instruction.operand_list[j + 2].label_ptr != nullptr)
+                        {
+                            short_circuit(i, j + 2);
+                        }
+                    }
+                    break;
+                }
+                
                 case OpcodeScanAccept:
                 {
                     short_circuit(i, 1);
                     break;
                 }
                 
+                case OpcodeScanLazy:
+                {
+
+                    for (int64_t j = 0; j < instruction.operand_list[1].integer; j++)
+                    {
+
+                        short_circuit(i, 3 * j + 3);
+                        if (instruction.operand_list[3 * j + 4].label_ptr != nullptr)
+                        {
+                            short_circuit(i, 3 * j + 4);
+                        }
+
+                    }
+
+                    break;
+
+                }
+                
                 case OpcodeBranchEqual:
                 case OpcodeBranchNotEqual:
                 case OpcodeBranchLessThan:
@@ -1169,6 +1421,344 @@ void CodeGenerator::optimize()
 
 }
 
+//
+//  optimize_actions                                                      
+//  ----------------                                                      
+//                                                                        
+//  The actions ReduceGenerator creates are mostly straight runs of Ast   
+//  instructions, which optimize() leaves alone. Here we tidy those up:   
+//                                                                        
+//  1. An AstNew right after an AstStart saves the same stack size, so we 
+//     use the AstStart register in its place (copy propagation).         
+//  2. Stores into temporaries nobody reads before the action returns     
+//     are removed (dead store elimination).                              
+//  3. Common pairs are fused into superinstructions, saving a trip       
+//     through the dispatch loop per pair.                                
+//                                                                        
+//  Temporaries never live across a Return. Anything we don't understand  
+//  stops the analysis, so control flow and labels are always safe.      
+//
+
+void CodeGenerator::optimize_actions()
+{
+
+    ICodeInstruction null_instruction;
+    null_instruction.opcode = OpcodeType::OpcodeNull;
+    null_instruction.location = -1;
+    null_instruction.operand_count = 0;
+    null_instruction.operand_list = nullptr;
+
+    //
+    //  register_operands                                                  
+    //  -----------------                                                  
+    //                                                                     
+    //  Find which operands of a straight-line instruction are registers   
+    //  it reads and writes. Return false for anything else, which ends    
+    //  the search.                                                        
+    //
+
+    function<bool(const ICodeInstruction&, vector<int>&, vector<int>&)> register_operands =
+        [&](const ICodeInstruction& instruction, vector<int>& reads, vector<int>& writes) -> bool
+    {
+
+        reads.clear();
+        writes.clear();
+
+        switch (instruction.opcode)
+        {
+
+            case OpcodeAstStart:
+            case OpcodeAstNew:
+            {
+                writes.push_back(0);
+                return true;
+            }
+
+            case OpcodeAstForm:
+            case OpcodeAstFormKind:
+            {
+                reads.push_back(0);
+                reads.push_back(1);
+                return true;
+            }
+
+            case OpcodeAstLoad:
+            case OpcodeAstLoadChild:
+            {
+                reads.push_back(1);
+                return true;
+            }
+
+            case OpcodeAssign:
+            case OpcodeUnaryMinus:
+            {
+                writes.push_back(0);
+                reads.push_back(1);
+                return true;
+            }
+
+            case OpcodeAdd:
+            case OpcodeSubtract:
+            case OpcodeMultiply:
+            case OpcodeDivide:
+            {
+                writes.push_back(0);
+                reads.push_back(1);
+                reads.push_back(2);
+                return true;
+            }
+
+            case OpcodeNull:
+            case OpcodeAstFinish:
+            case OpcodeAstIndex:
+            case OpcodeAstChild:
+            case OpcodeAstChildSlice:
+            case OpcodeAstKind:
+            case OpcodeAstKindNum:
+            case OpcodeAstLocation:
+            case OpcodeAstLocationNum:
+            case OpcodeAstLexeme:
+            case OpcodeAstLexemeString:
+            case OpcodeDumpStack:
+            {
+                return true;
+            }
+
+            default:
+            {
+                return false;
+            }
+
+        }
+
+    };
+
+    //
+    //  is_dead                                                            
+    //  -------                                                            
+    //                                                                     
+    //  Check whether a temporary is overwritten or the action returns      
+    //  before anything reads it.                                           
+    //
+
+    function<bool(int64_t, ICodeRegister*)> is_dead = [&](int64_t start, ICodeRegister* register_ptr) -> bool
+    {
+
+        vector<int> reads;
+        vector<int> writes;
+
+        for (int64_t i = start; i < icode_list.size(); i++)
+        {
+
+            if (icode_list[i].opcode == OpcodeType::OpcodeReturn ||
+                icode_list[i].opcode == OpcodeType::OpcodeAstFinishReturn)
+            {
+                return true;
+            }
+
+            if (!register_operands(icode_list[i], reads, writes))
+            {
+                return false;
+            }
+
+            for (int operand: reads)
+            {
+                if (icode_list[i].operand_list[operand].register_ptr == register_ptr)
+                {
+                    return false;
+                }
+            }
+
+            for (int operand: writes)
+            {
+                if (icode_list[i].operand_list[operand].register_ptr == register_ptr)
+                {
+                    return true;
+                }
+            }
+
+        }
+
+        return false;
+
+    };
+
+    //
+    //  fuse                                                               
+    //  ----                                                               
+    //                                                                     
+    //  Replace an instruction and the one after it with a superinstruction. 
+    //
+
+    function<void(int64_t, OpcodeType, const vector<ICodeOperand>&)> fuse =
+        [&](int64_t i, OpcodeType opcode, const vector<ICodeOperand>& operand_list) -> void
+    {
+
+        ICodeInstruction instruction;
+        instruction.opcode = opcode;
+        instruction.location = icode_list[i].location;
+        instruction.operand_count = operand_list.size();
+        instruction.operand_list = new ICodeOperand[instruction.operand_count];
+
+        memcpy(static_cast<void*>(instruction.operand_list),
+               static_cast<void*>(const_cast<ICodeOperand*>(operand_list.data())),
+               static_cast<size_t>(operand_list.size() * sizeof(ICodeOperand)));
+
+        icode_list[i] = move(instruction);
+        icode_list[i + 1] = null_instruction;
+
+    };
+
+    //
+    //  optimize_actions
+    //  ----------------
+    //                                 
+    //  The function body begins here. 
+    //
+
+    vector<int> reads;
+    vector<int> writes;
+
+    //
+    //  Copy propagation. 
+    //
+
+    for (int64_t i = 0; i + 1 < icode_list.size(); i++)
+    {
+
+        if (icode_list[i].opcode != OpcodeType::OpcodeAstStart ||
+            icode_list[i + 1].opcode != OpcodeType::OpcodeAstNew)
+        {
+            continue;
+        }
+
+        ICodeRegister* source_ptr = icode_list[i].operand_list[0].register_ptr;
+        ICodeRegister* copy_ptr = icode_list[i + 1].operand_list[0].register_ptr;
+
+        for (int64_t j = i + 2;
+             j < icode_list.size() && register_operands(icode_list[j], reads, writes);
+             j++)
+        {
+
+            for (int operand: reads)
+            {
+                if (icode_list[j].operand_list[operand].register_ptr == copy_ptr)
+                {
+                    icode_list[j].operand_list[operand].register_ptr = source_ptr;
+                }
+            }
+
+            if (writes.size() > 0 &&
+                (icode_list[j].operand_list[writes[0]].register_ptr == source_ptr ||
+                 icode_list[j].operand_list[writes[0]].register_ptr == copy_ptr))
+            {
+                break;
+            }
+
+        }
+
+    }
+
+    //
+    //  Dead store elimination. Only instructions whose sole effect is the 
+    //  store can go.                                                      
+    //
+
+    for (int64_t i = 0; i < icode_list.size(); i++)
+    {
+
+        switch (icode_list[i].opcode)
+        {
+
+            case OpcodeAstNew:
+            case OpcodeAssign:
+            case OpcodeUnaryMinus:
+            case OpcodeAdd:
+            case OpcodeSubtract:
+            case OpcodeMultiply:
+            {
+
+                ICodeRegister* register_ptr = icode_list[i].operand_list[0].register_ptr;
+
+                if (is_temporary(register_ptr) && is_dead(i + 1, register_ptr))
+                {
+                    icode_list[i] = null_instruction;
+                }
+
+                break;
+
+            }
+
+            default:
+            {
+                break;
+            }
+
+        }
+
+    }
+
+    //
+    //  Superinstructions. Null instructions hold no labels, so we can   
+    //  squeeze them out first and fuse neighbors.                       
+    //
+
+    vector<ICodeInstruction> new_icode_list;
+    for (ICodeInstruction& instruction : icode_list)
+    {
+
+        if (instruction.opcode != OpcodeType::OpcodeNull)
+        {
+            new_icode_list.push_back(move(instruction));
+        }
+
+    }
+
+    icode_list.swap(new_icode_list);
+
+    for (int64_t i = 0; i + 1 < icode_list.size(); i++)
+    {
+
+        ICodeInstruction& first = icode_list[i];
+        ICodeInstruction& second = icode_list[i + 1];
+
+        if (first.opcode == OpcodeType::OpcodeAstLoad &&
+            second.opcode == OpcodeType::OpcodeAstChild &&
+            first.operand_list[0].ast_ptr == second.operand_list[0].ast_ptr)
+        {
+            fuse(i, OpcodeType::OpcodeAstLoadChild,
+                 { first.operand_list[0], first.operand_list[1], first.operand_list[2] });
+        }
+        else if (first.opcode == OpcodeType::OpcodeAstForm &&
+                 second.opcode == OpcodeType::OpcodeAstKindNum)
+        {
+            fuse(i, OpcodeType::OpcodeAstFormKind,
+                 { first.operand_list[0], first.operand_list[1], first.operand_list[2],
+                   second.operand_list[0] });
+        }
+        else if (first.opcode == OpcodeType::OpcodeAstFinish &&
+                 second.opcode == OpcodeType::OpcodeReturn)
+        {
+            fuse(i, OpcodeType::OpcodeAstFinishReturn, { first.operand_list[0] });
+        }
+
+    }
+
+    new_icode_list.clear();
+    for (ICodeInstruction& instruction : icode_list)
+    {
+
+        if (instruction.opcode != OpcodeType::OpcodeNull)
+        {
+            new_icode_list.push_back(move(instruction));
+        }
+
+    }
+
+    icode_list.swap(new_icode_list);
+
+}
+
 //
 //  dump_icode                                                          
 //  ----------                                                          
@@ -1460,6 +2050,118 @@ void CodeGenerator::dump_icode(std::ostream& os, int indent) const
             
             }
             
+            case OpcodeScanClass:
+            case OpcodeScanClassMemo:
+            {
+            
+                int operand = 0;
+            
+                dump_operand(integer_string(instruction.operand_list[operand++]));
+                dump_operand(integer_string(instruction.operand_list[operand]));
+                for (int i = 0; i < instruction.operand_list[operand].integer; i++)
+                {
+            
+                    if (instruction.operand_list[operand + i + 1].label_ptr == nullptr)
+                    {
+                        dump_operand("-");
+                    }
+                    else
+                    {
+                        dump_operand(label_string(instruction.operand_list[operand + i + 1]));
+                    }
+            
+                }
+            
+                operand += instruction.operand_list[operand].integer + 1;
+                break;
+            
+            }
+            
+            case OpcodeScanKeyword:
+            {
+            
+                int operand = 0;
+            
+                dump_operand(integer_string(instruction.operand_list[operand++]));
+                int64_t bucket_count = instruction.operand_list[operand].integer;
+                dump_operand(integer_string(instruction.operand_list[operand++]));
+                for (int i = 0; i < bucket_count; i++)
+                {
+                    dump_operand(integer_string(instruction.operand_list[operand++]));
+                }
+            
+                int64_t slot_count = instruction.operand_list[operand].integer;
+                dump_operand(integer_string(instruction.operand_list[operand++]));
+                for (int i = 0; i < slot_count; i++)
+                {
+                    dump_operand(integer_string(instruction.operand_list[operand++]));
+                    dump_operand(string_string(instruction.operand_list[operand++]));
+                }
+            
+                break;
+            
+            }
+            
+            case OpcodeScanLazy:
+            {
+            
+                int operand = 0;
+            
+                dump_operand(integer_string(instruction.operand_list[operand++]));
+                dump_operand(integer_string(instruction.operand_list[operand]));
+                int64_t accept_count = instruction.operand_list[operand++].integer;
+                for (int i = 0; i < accept_count; i++)
+                {
+                    dump_operand(integer_string(instruction.operand_list[operand++]));
+                    dump_operand(label_string(instruction.operand_list[operand++]));
+                    
+                    if (instruction.operand_list[operand].label_ptr == nullptr)
+                    {
+                        dump_operand("-");
+                    }
+                    else
+                    {
+                        dump_operand(label_string(instruction.operand_list[operand]));
+                    }
+                    
+                    operand++;
+                    
+                }
+            
+                dump_operand(integer_string(instruction.operand_list[operand]));
+                int64_t state_count = instruction.operand_list[operand++].integer;
+                for (int i = 0; i < state_count; i++)
+                {
+            
+                    dump_operand(integer_string(instruction.operand_list[operand]));
+                    int64_t e_move_count = instruction.operand_list[operand++].integer;
+                    for (int j = 0; j < e_move_count; j++)
+                    {
+                        dump_operand(integer_string(instruction.operand_list[operand++]));
+                    }
+            
+                    dump_operand(integer_string(instruction.operand_list[operand]));
+                    int64_t transition_count = instruction.operand_list[operand++].integer;
+                    for (int j = 0; j < transition_count; j++)
+                    {
+                        dump_operand(character_string(instruction.operand_list[operand++]));
+                        dump_operand(character_string(instruction.operand_list[operand++]));
+                        dump_operand(integer_string(instruction.operand_list[operand++]));
+                    }
+            
+                    dump_operand(integer_string(instruction.operand_list[operand]));
+                    int64_t accept_num_count = instruction.operand_list[operand++].integer;
+                    for (int j = 0; j < accept_num_count; j++)
+                    {
+                        dump_operand(integer_string(instruction.operand_list[operand++]));
+                    }
+            
+                }
+            
+                break;
+            
+            }
+            
             case OpcodeScanAccept:
             {
             
@@ -1491,6 +2193,7 @@ void CodeGenerator::dump_icode(std::ostream& os, int indent) const
             }
             
             case OpcodeAstFinish:
+            case OpcodeAstFinishReturn:
             case OpcodeAstLocationNum:
             {
             
@@ -1511,7 +2214,20 @@ void CodeGenerator::dump_icode(std::ostream& os, int indent) const
             
             }
             
+            case OpcodeAstFormKind:
+            {
+            
+                int operand = 0;
+                dump_operand(register_string(instruction.operand_list[operand++]));
+                dump_operand(register_string(instruction.operand_list[operand++]));
+                dump_operand(integer_string(instruction.operand_list[operand++]));
+                dump_operand(kind_string(instruction.operand_list[operand++]));
+                break;
+            
+            }
+            
             case OpcodeAstLoad:
+            case OpcodeAstLoadChild:
             {
             
                 int operand = 0;
@@ -93,6 +93,19 @@ void csc_Services_register_string_creator(StringCreator creator)
     string_creator = creator;
 }
 
+//
+//  Binary.
+//
+
+typedef void (*BinaryCreator)(LPVOID, const char*, INT64);
+static BinaryCreator binary_creator = nullptr;
+
+extern "C" _declspec(dllexport) 
+void csc_Services_register_binary_creator(BinaryCreator creator)
+{
+    binary_creator = creator;
+}
+
 //
 //  Primitive String Encoders and Decoders                            
 //  --------------------------------------                            
@@ -277,6 +290,33 @@ static void string_result_in(LPVOID result_handle, void* result_vptr)
 
 }
 
+//
+//  binary_result_in                                                    
+//  ----------------                                                    
+//                                                                      
+//  Hand a binary result to C# as it is. The callback must finish with  
+//  the bytes before it returns, since we delete them after.            
+//
+
+static void binary_result_in(LPVOID result_handle, void* result_vptr)
+{
+
+    if (result_vptr == nullptr)
+    {
+        return;
+    }
+    
+    StringResultStruct* result_ptr = 
+        reinterpret_cast<StringResultStruct*>(result_vptr);
+
+    (*binary_creator)(result_handle,
+                      result_ptr->result_string.data(),
+                      result_ptr->result_string.size());
+
+    delete result_ptr;
+
+}
+
 //
 //  check_exceptions                                                     
 //  ----------------                                                     
@@ -582,6 +622,38 @@ void csc_Parser_parse(ptrdiff_t this_handle,
     
 }
 
+//
+//  csc_Parser_parse_binary_batch
+//  -----------------------------
+//  
+//  Parse a batch of sources packed into one byte array. The packed results
+//  go to C# through the binary callback like csc_Parser_get_binary_ast.
+//
+
+extern "C" _declspec(dllexport)
+void csc_Parser_parse_binary_batch(ptrdiff_t this_handle, 
+                                   LPVOID exception_handle, 
+                                   const char* packed_sources, 
+                                   int64_t packed_size, 
+                                   int64_t num_threads, 
+                                   LPVOID result_handle)
+{
+    
+    void* exception_ptr = nullptr;
+    void* result_ptr = nullptr;
+    
+    ParserStatic::parser_parse_binary_batch(this_handle, 
+                                            exception_handler_out(&exception_ptr), 
+                                            string(packed_sources, packed_size), 
+                                            num_threads, 
+                                            string_result_out(&result_ptr));
+    
+    check_exceptions(exception_handle, exception_ptr);
+    
+    binary_result_in(result_handle, result_ptr);
+    
+}
+
 //
 //  csc_Parser_get_encoded_ast
 //  --------------------------
@@ -609,6 +681,159 @@ void csc_Parser_get_encoded_ast(ptrdiff_t this_handle,
     
 }
 
+//
+//  csc_Parser_get_binary_ast
+//  -------------------------
+//  
+//  Return the Ast in binary form. C# decodes it in place in a callback.
+//
+
+extern "C" _declspec(dllexport)
+void csc_Parser_get_binary_ast(ptrdiff_t this_handle, 
+                               LPVOID exception_handle, 
+                               LPVOID result_handle)
+{
+    
+    void* exception_ptr = nullptr;
+    void* result_ptr = nullptr;
+    
+    ParserStatic::parser_get_binary_ast(this_handle, 
+                                        exception_handler_out(&exception_ptr), 
+                                        string_result_out(&result_ptr));
+    
+    check_exceptions(exception_handle, exception_ptr);
+    
+    binary_result_in(result_handle, result_ptr);
+    
+}
+
+//
+//  csc_Parser_get_ast_handle
+//  -------------------------
+//  
+//  Return a handle on the root of the result Ast, or 0 if it's null.
+//
+
+extern "C" _declspec(dllexport)
+int64_t csc_Parser_get_ast_handle(ptrdiff_t this_handle, 
+                                  LPVOID exception_handle)
+{
+    
+    void* exception_ptr = nullptr;
+    
+    ptrdiff_t result = ParserStatic::parser_get_ast_handle(this_handle, 
+                                                           exception_handler_out(&exception_ptr));
+    
+    check_exceptions(exception_handle, exception_ptr);
+    
+    return result;
+    
+}
+
+//
+//  csc_AstHandle_get_kind, get_location & get_num_children
+//  -------------------------------------------------------
+//  
+//  Simple accessors on one node of the native tree.
+//
+
+extern "C" _declspec(dllexport)
+int csc_AstHandle_get_kind(ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_kind(ast_handle);
+}
+
+extern "C" _declspec(dllexport)
+int64_t csc_AstHandle_get_location(ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_location(ast_handle);
+}
+
+extern "C" _declspec(dllexport)
+int csc_AstHandle_get_num_children(ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_num_children(ast_handle);
+}
+
+//
+//  csc_AstHandle_get_lexeme
+//  ------------------------
+//  
+//  Return the lexeme of one node.
+//
+
+extern "C" _declspec(dllexport)
+void csc_AstHandle_get_lexeme(ptrdiff_t ast_handle, 
+                              LPVOID result_handle)
+{
+
+    void* result_ptr = nullptr;
+    
+    ParserStatic::ast_get_lexeme(ast_handle, string_result_out(&result_ptr));
+    
+    string_result_in(result_handle, result_ptr);
+    
+}
+
+//
+//  csc_AstHandle_get_child
+//  -----------------------
+//  
+//  Return a handle on one child, or 0 if it's null or out of range.
+//
+
+extern "C" _declspec(dllexport)
+int64_t csc_AstHandle_get_child(ptrdiff_t ast_handle, int child)
+{
+    return ParserStatic::ast_get_child(ast_handle, child);
+}
+
+//
+//  csc_AstHandle_get_children
+//  --------------------------
+//  
+//  Fill a C# long array with handles on a slice of the children.
+//
+
+extern "C" _declspec(dllexport)
+int csc_AstHandle_get_children(ptrdiff_t ast_handle, 
+                               int first, 
+                               int count, 
+                               int64_t* handle_list)
+{
+    return ParserStatic::ast_get_children(ast_handle, 
+                                          first, 
+                                          count, 
+                                          reinterpret_cast<ptrdiff_t*>(handle_list));
+}
+
+//
+//  csc_AstHandle_get_subtree
+//  -------------------------
+//  
+//  Return a whole subtree in binary form, decoded by C# in a callback like 
+//  csc_Parser_get_binary_ast.
+//
+
+extern "C" _declspec(dllexport)
+void csc_AstHandle_get_subtree(ptrdiff_t ast_handle, 
+                               LPVOID exception_handle, 
+                               LPVOID result_handle)
+{
+    
+    void* exception_ptr = nullptr;
+    void* result_ptr = nullptr;
+    
+    ParserStatic::ast_get_subtree(ast_handle, 
+                                  exception_handler_out(&exception_ptr), 
+                                  string_result_out(&result_ptr));
+    
+    check_exceptions(exception_handle, exception_ptr);
+    
+    binary_result_in(result_handle, result_ptr);
+    
+}
+
 //
 //  csc_Parser_get_encoded_kind_map
 //  -------------------------------
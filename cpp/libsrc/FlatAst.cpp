@@ -0,0 +1,519 @@
+//
+//  FlatAst
+//  -------
+//
+//  A compact, read-only copy of an Ast with the nodes laid out in preorder
+//  in parallel arrays. Here we have the conversions to and from the
+//  pointer tree. Both are iterative so a deep tree can't overflow the
+//  stack.
+//
+
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <functional>
+#include <string>
+#include <vector>
+#include <map>
+#include "Parser.H"
+#include "Binary.H"
+
+//
+//  Namespace hoshi: Not indenting...
+//
+
+namespace hoshi
+{
+
+using namespace std;
+
+//
+//  Constructor
+//  -----------
+//
+//  Flatten a pointer tree. We keep a stack of the open nodes and the next
+//  child of each, and fill in the subtree size of a node when we pop it.
+//  The arrays are trimmed at the end since the tree won't change.
+//
+
+FlatAst::FlatAst(const Ast* root)
+{
+
+    if (root == nullptr)
+    {
+        return;
+    }
+
+    struct Frame
+    {
+        const Ast* ast;
+        int64_t index;
+        int next_child;
+    };
+
+    vector<Frame> stack;
+
+    //
+    //  append
+    //  ------
+    //
+    //  Add one node to the end of each array.
+    //
+
+    function<int64_t(const Ast*)> append = [&](const Ast* ast) -> int64_t
+    {
+
+        int64_t index = kind_list.size();
+
+        if (ast == nullptr)
+        {
+            kind_list.push_back(-1);
+            num_children_list.push_back(0);
+            location_list.push_back(-1);
+        }
+        else
+        {
+
+            kind_list.push_back(ast->kind);
+            num_children_list.push_back(ast->num_children);
+            location_list.push_back(ast->location);
+
+            if (ast->lexeme_text != nullptr)
+            {
+                lexeme_pool.append(ast->lexeme_text->lexeme);
+            }
+
+        }
+
+        span_list.push_back(1);
+        lexeme_start_list.push_back(lexeme_pool.size());
+
+        return index;
+
+    };
+
+    //
+    //  The function body begins here.
+    //
+
+    lexeme_start_list.push_back(0);
+
+    stack.push_back(Frame{root, append(root), 0});
+
+    while (stack.size() > 0)
+    {
+
+        Frame& top = stack.back();
+
+        if (top.next_child == top.ast->num_children)
+        {
+            span_list[top.index] = kind_list.size() - top.index;
+            stack.pop_back();
+            continue;
+        }
+
+        const Ast* child = top.ast->children[top.next_child++];
+        int64_t index = append(child);
+
+        if (child != nullptr && child->num_children > 0)
+        {
+            stack.push_back(Frame{child, index, 0});
+        }
+
+    }
+
+    kind_list.shrink_to_fit();
+    num_children_list.shrink_to_fit();
+    span_list.shrink_to_fit();
+    location_list.shrink_to_fit();
+    lexeme_start_list.shrink_to_fit();
+    lexeme_pool.shrink_to_fit();
+
+}
+
+//
+//  to_ast
+//  ------
+//
+//  Build a pointer tree from the flat one. Since the nodes are in preorder
+//  each one is the next child of the innermost node still missing some.
+//
+
+Ast* FlatAst::to_ast() const
+{
+
+    Ast* root = nullptr;
+    vector<pair<Ast*, int>> stack;
+
+    for (int64_t i = 0; i < size(); i++)
+    {
+
+        Ast* ast = nullptr;
+
+        if (kind_list[i] >= 0)
+        {
+
+            ast = new Ast(num_children_list[i]);
+            ast->kind = kind_list[i];
+            ast->location = location_list[i];
+            ast->set_lexeme(lexeme_pool.substr(lexeme_start_list[i],
+                                               lexeme_start_list[i + 1] - lexeme_start_list[i]));
+
+        }
+
+        if (stack.size() == 0)
+        {
+            root = ast;
+        }
+        else
+        {
+            stack.back().first->set_child(stack.back().second++, ast);
+        }
+
+        if (ast != nullptr && ast->num_children > 0)
+        {
+            stack.push_back(make_pair(ast, 0));
+        }
+
+        while (stack.size() > 0 && stack.back().second == stack.back().first->num_children)
+        {
+            stack.pop_back();
+        }
+
+    }
+
+    return root;
+
+}
+
+//
+//  get_child
+//  ---------
+//
+//  Random access to a child. We have to skip over the earlier siblings so
+//  use the iterators to visit all the children.
+//
+
+FlatAst::Node FlatAst::Node::get_child(int child) const
+{
+
+    int64_t child_index = index + 1;
+    for (int i = 0; i < child; i++)
+    {
+        child_index += flat->span_list[child_index];
+    }
+
+    return Node(flat, child_index);
+
+}
+
+//
+//  Binary Form                                                           
+//  -----------                                                           
+//                                                                        
+//  The other language wrappers used to get trees as delimited decimal    
+//  text and decode them a character at a time, which for a large tree    
+//  cost more than the parse. Instead we hand them the flat arrays as a   
+//  little-endian byte string they can read in place. Each node array is  
+//  stored in the narrowest of one, two, four or eight bytes that holds   
+//  all its values, given in the header, and every array starts on an     
+//  eight byte boundary, so a reader can view each array directly:        
+//                                                                        
+//      char[4]   "HAST"                                                  
+//      int32     version                                                 
+//      int64     number of kind map entries                              
+//      int64     bytes in the kind map section                           
+//      kind map  int32 kind, int32 length and the name for each entry,   
+//                zero padded to a multiple of eight bytes                
+//      int64     number of nodes, n                                      
+//      int64     bytes in the lexeme pool, p                             
+//      int8[8]   widths of the four node arrays, then four zero bytes    
+//      intw      kind[n]                                                 
+//      intw      num_children[n]                                         
+//      intw      location[n]                                             
+//      intw      lexeme_length[n]                                        
+//      byte      lexeme_pool[p]                                          
+//                                                                        
+//  Each node array is zero padded to a multiple of eight bytes. Kinds    
+//  and child counts are small, and lexeme lengths usually are, so a      
+//  typical tree takes about eight bytes a node besides its lexemes,      
+//  which is well under the text. A reader finds a lexeme by adding up    
+//  the lengths before it.                                                
+//                                                                        
+//  The kind map is optional, but it saves the wrappers a separate call.  
+//  We leave out the subtree sizes since a reader building a tree doesn't 
+//  need them and they are easy to recompute.                             
+//
+
+static const char binary_magic[] = "HAST";
+static const int32_t binary_version = 2;
+
+//
+//  encode                                                                
+//  ------                                                                
+//                                                                        
+//  Create the binary form of the tree, with a kind map if we have one.   
+//
+
+string FlatAst::encode(const map<string, int>& kind_map) const
+{
+
+    string buffer;
+
+    //
+    //  The header and kind map. We need the size of the kind map section 
+    //  up front so we compute it before writing anything.               
+    //
+
+    int64_t kind_map_size = 0;
+    for (auto mp: kind_map)
+    {
+        kind_map_size += 2 * sizeof(int32_t) + mp.first.size();
+    }
+
+    kind_map_size = (kind_map_size + 7) & ~static_cast<int64_t>(7);
+
+    int64_t node_count = size();
+    int64_t pool_size = lexeme_pool.size();
+
+    vector<int64_t> lexeme_length_list(node_count);
+    for (int64_t i = 0; i < node_count; i++)
+    {
+        lexeme_length_list[i] = lexeme_start_list[i + 1] - lexeme_start_list[i];
+    }
+
+    int8_t width_list[8] =
+    {
+        static_cast<int8_t>(binary_width(kind_list.data(), node_count)),
+        static_cast<int8_t>(binary_width(num_children_list.data(), node_count)),
+        static_cast<int8_t>(binary_width(location_list.data(), node_count)),
+        static_cast<int8_t>(binary_width(lexeme_length_list.data(), node_count)),
+        0, 0, 0, 0
+    };
+
+    int64_t array_size = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        array_size += (node_count * width_list[i] + 7) & ~static_cast<int64_t>(7);
+    }
+
+    buffer.reserve(3 * sizeof(int64_t) + kind_map_size + 3 * sizeof(int64_t) +
+                   array_size + pool_size);
+
+    buffer.append(binary_magic, 4);
+    put_binary(buffer, &binary_version, 1);
+
+    int64_t kind_map_count = kind_map.size();
+    put_binary(buffer, &kind_map_count, 1);
+    put_binary(buffer, &kind_map_size, 1);
+
+    size_t kind_map_start = buffer.size();
+
+    for (auto mp: kind_map)
+    {
+
+        int32_t kind = mp.second;
+        int32_t length = mp.first.size();
+
+        put_binary(buffer, &kind, 1);
+        put_binary(buffer, &length, 1);
+        buffer.append(mp.first);
+
+    }
+
+    buffer.append(kind_map_start + kind_map_size - buffer.size(), '\0');
+
+    //
+    //  The node arrays.
+    //
+
+    put_binary(buffer, &node_count, 1);
+    put_binary(buffer, &pool_size, 1);
+    put_binary(buffer, width_list, 8);
+
+    put_narrow(buffer, kind_list.data(), node_count, width_list[0]);
+    put_narrow(buffer, num_children_list.data(), node_count, width_list[1]);
+    put_narrow(buffer, location_list.data(), node_count, width_list[2]);
+    put_narrow(buffer, lexeme_length_list.data(), node_count, width_list[3]);
+
+    buffer.append(lexeme_pool);
+
+    return buffer;
+
+}
+
+//
+//  decode                                                                
+//  ------                                                                
+//                                                                        
+//  Replace the tree with one in binary form, and optionally return the   
+//  kind map that came with it.                                           
+//
+
+void FlatAst::decode(const string& str, map<string, int>* kind_map)
+{
+
+    size_t offset = 0;
+
+    if (str.compare(0, 4, binary_magic) != 0)
+    {
+        throw out_of_range("Not a binary Ast");
+    }
+
+    offset += 4;
+
+    int32_t version = 0;
+    get_binary(str, offset, &version, 1);
+
+    if (version != binary_version)
+    {
+        throw out_of_range("Version mismatch in binary Ast");
+    }
+
+    //
+    //  The kind map.
+    //
+
+    int64_t kind_map_count = 0;
+    int64_t kind_map_size = 0;
+
+    get_binary(str, offset, &kind_map_count, 1);
+    get_binary(str, offset, &kind_map_size, 1);
+
+    if (kind_map_size < 0 || static_cast<uint64_t>(kind_map_size) > str.size() - offset)
+    {
+        throw out_of_range("Truncated binary Ast");
+    }
+
+    size_t kind_map_end = offset + kind_map_size;
+
+    if (kind_map != nullptr)
+    {
+
+        kind_map->clear();
+
+        for (int64_t i = 0; i < kind_map_count; i++)
+        {
+
+            int32_t kind = 0;
+            int32_t length = 0;
+
+            get_binary(str, offset, &kind, 1);
+            get_binary(str, offset, &length, 1);
+
+            if (length < 0 || offset + length > kind_map_end)
+            {
+                throw out_of_range("Truncated binary Ast");
+            }
+
+            (*kind_map)[str.substr(offset, length)] = kind;
+            offset += length;
+
+        }
+
+    }
+
+    offset = kind_map_end;
+
+    //
+    //  The node arrays.
+    //
+
+    int64_t node_count = 0;
+    int64_t pool_size = 0;
+    int8_t width_list[8];
+
+    get_binary(str, offset, &node_count, 1);
+    get_binary(str, offset, &pool_size, 1);
+    get_binary(str, offset, width_list, 8);
+
+    if (node_count < 0 || pool_size < 0 ||
+        static_cast<uint64_t>(node_count) > str.size())
+    {
+        throw out_of_range("Truncated binary Ast");
+    }
+
+    vector<int64_t> lexeme_length_list(node_count);
+
+    kind_list.resize(node_count);
+    num_children_list.resize(node_count);
+    span_list.resize(node_count);
+    location_list.resize(node_count);
+    lexeme_start_list.resize(node_count + 1);
+
+    get_narrow(str, offset, kind_list.data(), node_count, width_list[0]);
+    get_narrow(str, offset, num_children_list.data(), node_count, width_list[1]);
+    get_narrow(str, offset, location_list.data(), node_count, width_list[2]);
+    get_narrow(str, offset, lexeme_length_list.data(), node_count, width_list[3]);
+
+    if (offset > str.size() || static_cast<uint64_t>(pool_size) != str.size() - offset)
+    {
+        throw out_of_range("Truncated binary Ast");
+    }
+
+    lexeme_pool = str.substr(offset);
+
+    lexeme_start_list[0] = 0;
+    for (int64_t i = 0; i < node_count; i++)
+    {
+
+        if (lexeme_length_list[i] < 0 || lexeme_length_list[i] > pool_size - lexeme_start_list[i])
+        {
+            throw out_of_range("Malformed binary Ast");
+        }
+
+        lexeme_start_list[i + 1] = lexeme_start_list[i] + lexeme_length_list[i];
+
+    }
+
+    if (node_count == 0)
+    {
+        lexeme_start_list.clear();
+    }
+
+    //
+    //  Recompute the subtree sizes. Working backwards, the children of a 
+    //  node are the subtrees that follow it, which we've already sized. 
+    //
+
+    for (int64_t i = node_count - 1; i >= 0; i--)
+    {
+
+        span_list[i] = 1;
+
+        for (int j = 0; j < num_children_list[i]; j++)
+        {
+
+            if (i + span_list[i] >= node_count)
+            {
+                throw out_of_range("Malformed binary Ast");
+            }
+
+            span_list[i] += span_list[i + span_list[i]];
+
+        }
+
+    }
+
+}
+
+//
+//  get_memory_size
+//  ---------------
+//
+//  The number of bytes held by the arrays, for comparisons.
+//
+
+int64_t FlatAst::get_memory_size() const
+{
+
+    return kind_list.capacity() * sizeof(int) +
+           num_children_list.capacity() * sizeof(int) +
+           span_list.capacity() * sizeof(int64_t) +
+           location_list.capacity() * sizeof(int64_t) +
+           lexeme_start_list.capacity() * sizeof(int64_t) +
+           lexeme_pool.capacity();
+
+}
+
+} // namespace hoshi
@@ -59,6 +59,15 @@ void (*Grammar::extract_handler[])(Grammar& gram, Ast* root, Context& ctx)
     handle_conflicts,                // Conflicts
     handle_keep_whitespace,          // KeepWhitespace
     handle_case_sensitive,           // CaseSensitive
+    handle_lookahead_method,         // LookaheadMethod
+    handle_table_scheme,             // TableScheme
+    handle_keyword_table,            // KeywordTable
+    handle_linear_scan,              // LinearScan
+    handle_lazy_scanner,             // LazyScanner
+    handle_pipeline_scanner,         // PipelineScanner
+    handle_intern_lexemes,           // InternLexemes
+    handle_lazy_ast,                 // LazyAst
+    handle_minimize_method,          // MinimizeMethod
     handle_token_declaration,        // TokenDeclaration
     handle_token_option_list,        // TokenOptionList
     handle_token_template,           // TokenTemplate
@@ -70,6 +79,7 @@ void (*Grammar::extract_handler[])(Grammar& gram, Ast* root, Context& ctx)
     handle_token_lexeme,             // TokenLexeme
     handle_token_ignore,             // TokenIgnore
     handle_token_error,              // TokenError
+    handle_token_sync,               // TokenSync
     handle_rule,                     // Rule
     handle_list,                     // RuleRhsList
     handle_rule_rhs,                 // RuleRhs
@@ -190,6 +200,15 @@ const char* Grammar::extract_handler_name[]
     "handle_conflicts",              // Conflicts
     "handle_keep_whitespace",        // KeepWhitespace
     "handle_case_sensitive",         // CaseSensitive
+    "handle_lookahead_method",       // LookaheadMethod
+    "handle_table_scheme",           // TableScheme
+    "handle_keyword_table",          // KeywordTable
+    "handle_linear_scan",            // LinearScan
+    "handle_lazy_scanner",           // LazyScanner
+    "handle_pipeline_scanner",       // PipelineScanner
+    "handle_intern_lexemes",         // InternLexemes
+    "handle_lazy_ast",               // LazyAst
+    "handle_minimize_method",        // MinimizeMethod
     "handle_token_declaration",      // TokenDeclaration
     "handle_token_option_list",      // TokenOptionList
     "handle_token_template",         // TokenTemplate
@@ -201,6 +220,7 @@ const char* Grammar::extract_handler_name[]
     "handle_token_lexeme",           // TokenLexeme
     "handle_token_ignore",           // TokenIgnore
     "handle_token_error",            // TokenError
+    "handle_token_sync",             // TokenSync
     "handle_rule",                   // Rule
     "handle_list",                   // RuleRhsList
     "handle_rule_rhs",               // RuleRhs
@@ -592,21 +612,31 @@ void Grammar::extract()
         regex_ast->set_location(token->location);
         token_regex_ast->set_child(1, regex_ast);
 
-        Ast* list_ast = new Ast(symbol.length()); 
+        //
+        //  Split the literal into code points, not bytes, so each regex  
+        //  character is one whole UTF-8 sequence. Only ASCII letters are 
+        //  folded when the grammar is not case sensitive.                
+        //
+
+        Source symbol_source(symbol);
+
+        Ast* list_ast = new Ast(symbol_source.length()); 
         list_ast->set_kind(AstType::AstRegexList);
         list_ast->set_location(token->location);
         regex_ast->set_child(0, list_ast);
 
-        for (int i = 0; i < symbol.length(); i++)
+        for (int i = 0; i < symbol_source.length(); i++)
         {
 
-            if (case_sensitive || tolower(symbol[i]) == toupper(symbol[i]))
+            char32_t c = symbol_source.get_char(i);
+
+            if (case_sensitive || c >= 128 || tolower(c) == toupper(c))
             {
 
                 Ast* char_ast = new Ast(0);
                 char_ast->set_kind(AstType::AstRegexChar);
                 char_ast->set_location(token->location);
-                char_ast->set_lexeme(symbol.substr(i, 1));
+                char_ast->set_lexeme(symbol_source.get_string(i, i + 1));
                 list_ast->set_child(i, char_ast);
 
             }
@@ -626,7 +656,7 @@ void Grammar::extract()
                 Ast* char_ast = new Ast(0);
                 char_ast->set_kind(AstType::AstCharsetChar);
                 char_ast->set_location(token->location);
-                char_ast->set_lexeme(string(1, tolower(symbol[i])));
+                char_ast->set_lexeme(string(1, static_cast<char>(tolower(c))));
                 charset_range_ast->set_child(0, char_ast);
 
                 charset_range_ast = new Ast(1);
@@ -637,7 +667,7 @@ void Grammar::extract()
                 char_ast = new Ast(0);
                 char_ast->set_kind(AstType::AstCharsetChar);
                 char_ast->set_location(token->location);
-                char_ast->set_lexeme(string(1, toupper(symbol[i])));
+                char_ast->set_lexeme(string(1, static_cast<char>(toupper(c))));
                 charset_range_ast->set_child(0, char_ast);
 
             }
@@ -949,6 +979,279 @@ void Grammar::handle_case_sensitive(Grammar& gram, Ast* root, Context& ctx)
 
 }
 
+//
+//  handle_lookahead_method                                              
+//  -----------------------                                              
+//                                                                       
+//  Select the algorithm used to find LALR(1) lookaheads. The default    
+//  `propagate' method is the original engine. It is not full LALR(1)    
+//  and can find lookahead supersets. The `digraph' method finds exact   
+//  LALR(1) sets. The two can give different parse tables, so a grammar  
+//  can have fewer conflicts with `digraph' and the expected tokens in   
+//  syntax error messages, and their order, can differ. The `compare'    
+//  method runs both and reports where they differ.                      
+//
+
+void Grammar::handle_lookahead_method(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstLookaheadMethod) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate lookahead_method option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstLookaheadMethod);
+    handle_extract(gram, root->get_child(0), ctx);
+
+    if (ctx.string_value != "propagate" &&
+        ctx.string_value != "digraph" &&
+        ctx.string_value != "compare")
+    {
+        gram.errh.add_error(ErrorType::ErrorError,
+                            root->get_location(),
+                            "Invalid lookahead_method option: " + ctx.string_value);
+        return;
+    }
+
+    gram.lookahead_method = ctx.string_value;
+
+}
+
+//
+//  handle_table_scheme                                                  
+//  -------------------                                                  
+//                                                                       
+//  Select the layout of the parse tables. Like the lookahead method     
+//  this doesn't change what the parser accepts, only the size and speed 
+//  of the tables. With `auto' we build them all and choose.             
+//
+
+void Grammar::handle_table_scheme(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstTableScheme) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate table_scheme option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstTableScheme);
+    handle_extract(gram, root->get_child(0), ctx);
+
+    if (ctx.string_value != "auto" &&
+        ctx.string_value != "displacement" &&
+        ctx.string_value != "defaults" &&
+        ctx.string_value != "comb" &&
+        ctx.string_value != "full")
+    {
+        gram.errh.add_error(ErrorType::ErrorError,
+                            root->get_location(),
+                            "Invalid table_scheme option: " + ctx.string_value);
+        return;
+    }
+
+    gram.table_scheme = ctx.string_value;
+
+}
+
+//
+//  handle_keyword_table                                                 
+//  --------------------                                                 
+//                                                                       
+//  Keyword table moves literals that look like identifiers out of the   
+//  scanner automaton. The scanner matches them as identifiers and then  
+//  looks the lexeme up in a table, which keeps the automaton small.     
+//
+
+void Grammar::handle_keyword_table(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstKeywordTable) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate keyword_table option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstKeywordTable);
+    handle_extract(gram, root->get_child(0), ctx);
+    gram.keyword_table = ctx.bool_value;
+
+}
+
+//
+//  handle_linear_scan                                                   
+//  ------------------                                                   
+//                                                                       
+//  The scanner backs up to the last accepting state when it gets stuck, 
+//  so some inputs make it rescan the same text over and over. In linear 
+//  scan mode it remembers where it got stuck so it never does that.     
+//
+
+void Grammar::handle_linear_scan(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstLinearScan) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate linear_scan option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstLinearScan);
+    handle_extract(gram, root->get_child(0), ctx);
+    gram.linear_scan = ctx.bool_value;
+
+}
+
+//
+//  handle_lazy_scanner                                                  
+//  -------------------                                                  
+//                                                                       
+//  Leave the scanner as an NFA and build the DFA states as the parser   
+//  needs them. This is for token sets whose full DFA is too big to      
+//  build up front.                                                      
+//
+
+void Grammar::handle_lazy_scanner(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstLazyScanner) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate lazy_scanner option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstLazyScanner);
+    handle_extract(gram, root->get_child(0), ctx);
+    gram.lazy_scanner = ctx.bool_value;
+
+}
+
+//
+//  handle_pipeline_scanner                                              
+//  -----------------------                                              
+//                                                                       
+//  Scan on a separate thread, ahead of the parser. The generator turns  
+//  this off again if the scanner shares registers with the parser.      
+//
+
+void Grammar::handle_pipeline_scanner(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstPipelineScanner) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate pipeline_scanner option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstPipelineScanner);
+    handle_extract(gram, root->get_child(0), ctx);
+    gram.pipeline_scanner = ctx.bool_value;
+
+}
+
+//
+//  handle_intern_lexemes                                                 
+//  ---------------------                                                 
+//                                                                        
+//  Keep one copy of each distinct lexeme in a parse and give the nodes   
+//  holding it the same id.                                               
+//
+
+void Grammar::handle_intern_lexemes(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstInternLexemes) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate intern_lexemes option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstInternLexemes);
+    handle_extract(gram, root->get_child(0), ctx);
+    gram.intern_lexemes = ctx.bool_value;
+
+}
+
+//
+//  handle_lazy_ast                                                       
+//  ---------------                                                       
+//                                                                        
+//  Log the shifts and reduces of a parse and build the Ast from the log  
+//  the first time it's asked for.                                        
+//
+
+void Grammar::handle_lazy_ast(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstLazyAst) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate lazy_ast option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstLazyAst);
+    handle_extract(gram, root->get_child(0), ctx);
+    gram.lazy_ast = ctx.bool_value;
+
+}
+
+//
+//  handle_minimize_method                                               
+//  ----------------------                                               
+//                                                                       
+//  Select the algorithm used to minimize the scanner DFA. The default   
+//  `hopcroft' method refines a partition of the states. The `pairwise'  
+//  method is the original one, which merges indistinguishable pairs     
+//  until nothing changes. Both find the minimal automaton, so this only 
+//  changes the time taken. The `compare' method runs both and reports   
+//  an error if the automata they build differ.                          
+//
+
+void Grammar::handle_minimize_method(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstMinimizeMethod) != ctx.processed_set.end())
+    {
+        gram.errh.add_error(ErrorType::ErrorDupGrammarOption,
+                            root->get_location(),
+                            "Duplicate minimize_method option");
+        return;
+    }
+
+    ctx.processed_set.insert(AstType::AstMinimizeMethod);
+    handle_extract(gram, root->get_child(0), ctx);
+
+    if (ctx.string_value != "hopcroft" &&
+        ctx.string_value != "pairwise" &&
+        ctx.string_value != "compare")
+    {
+        gram.errh.add_error(ErrorType::ErrorError,
+                            root->get_location(),
+                            "Invalid minimize_method option: " + ctx.string_value);
+        return;
+    }
+
+    gram.minimize_method = ctx.string_value;
+
+}
+
 //
 //  handle_token_declaration                                       
 //  ------------------------
@@ -1366,6 +1669,38 @@ void Grammar::handle_token_error(Grammar& gram, Ast* root, Context& ctx)
 
 }
 
+//
+//  handle_token_sync
+//  -----------------
+//                                              
+//  Store whether the token can only begin a top-level unit, so a long
+//  source may be split before it and the pieces parsed in parallel.
+//
+
+void Grammar::handle_token_sync(Grammar& gram, Ast* root, Context& ctx)
+{
+
+    if (ctx.processed_set.find(AstType::AstTokenSync) != ctx.processed_set.end())
+    {
+
+        ostringstream ost;
+        ost << "Duplicate sync declaration for token "
+            << ctx.symbol->symbol_name;
+
+        gram.errh.add_error(ErrorType::ErrorDupTokenOption,
+                            root->get_location(),
+                            ost.str());
+
+        return;
+
+    }
+
+    ctx.processed_set.insert(AstType::AstTokenSync);
+    handle_extract(gram, root->get_child(0), ctx);
+    ctx.symbol->is_sync = ctx.bool_value;
+
+}
+
 //
 //  handle_rule                                         
 //  -----------                                         
@@ -2222,6 +2557,8 @@ void Grammar::save_parser_data()
 
     prsd.lookaheads = max_lookaheads;
     prsd.error_recovery = error_recovery;
+    prsd.intern_lexemes = intern_lexemes;
+    prsd.lazy_ast = lazy_ast;
     prsd.error_symbol_num = error_symbol->symbol_num;
     prsd.eof_symbol_num = eof_symbol->symbol_num;
 
@@ -2244,9 +2581,10 @@ void Grammar::save_parser_data()
 
     prsd.token_count = max_symbol_num + 1;
     prsd.token_name_list = new string[prsd.token_count];
-    prsd.token_is_terminal = new bool[prsd.token_count];
-    prsd.token_kind = new int[prsd.token_count];
-    prsd.token_lexeme_needed = new bool[prsd.token_count];
+    prsd.token_is_terminal = new bool[prsd.token_count]();
+    prsd.token_kind = new int[prsd.token_count]();
+    prsd.token_lexeme_needed = new bool[prsd.token_count]();
+    prsd.token_is_sync = new bool[prsd.token_count]();
 
     for (auto mp: symbol_map)
     {
@@ -2261,6 +2599,7 @@ void Grammar::save_parser_data()
         prsd.token_is_terminal[token->symbol_num] = token->is_terminal;
         prsd.token_kind[token->symbol_num] = prsd.get_kind_force(token->symbol_name);
         prsd.token_lexeme_needed[token->symbol_num] = token->lexeme_needed;
+        prsd.token_is_sync[token->symbol_num] = token->is_sync;
 
     }
     
@@ -2377,6 +2716,42 @@ void Grammar::dump_grammar(std::ostream& os, int indent) const
        << setw(5) << right << ((case_sensitive) ? "true" : "false")
        << setw(0) << right << endl;
 
+    os << setw(20) << left << "  LookaheadMethod:"
+       << setw(5) << right << lookahead_method
+       << setw(0) << right << endl;
+
+    os << setw(20) << left << "  TableScheme:"
+       << setw(5) << right << table_scheme
+       << setw(0) << right << endl;
+
+    os << setw(20) << left << "  KeywordTable:"
+       << setw(5) << right << ((keyword_table) ? "true" : "false")
+       << setw(0) << right << endl;
+
+    os << setw(20) << left << "  LinearScan:"
+       << setw(5) << right << ((linear_scan) ? "true" : "false")
+       << setw(0) << right << endl;
+
+    os << setw(20) << left << "  LazyScanner:"
+       << setw(5) << right << ((lazy_scanner) ? "true" : "false")
+       << setw(0) << right << endl;
+
+    os << setw(20) << left << "  PipelineScanner:"
+       << setw(5) << right << ((pipeline_scanner) ? "true" : "false")
+       << setw(0) << right << endl;
+
+    os << setw(20) << left << "  InternLexemes:"
+       << setw(5) << right << ((intern_lexemes) ? "true" : "false")
+       << setw(0) << right << endl;
+
+    os << setw(20) << left << "  LazyAst:"
+       << setw(5) << right << ((lazy_ast) ? "true" : "false")
+       << setw(0) << right << endl;
+
+    os << setw(20) << left << "  MinimizeMethod:"
+       << setw(5) << right << minimize_method
+       << setw(0) << right << endl;
+
     os << endl;
 
     //
@@ -2437,6 +2812,11 @@ void Grammar::dump_tokens(std::ostream& os, int indent) const
             os << " error=\"" << symbol->error_message << "\"";
         }
 
+        if (symbol->is_sync)
+        {
+            os << " sync";
+        }
+
         if (symbol->precedence != 100)
         {
             os << " precedence=" << symbol->precedence;
@@ -15,6 +15,7 @@
 #include <codecvt>
 #endif
 #include <string>
+#include <vector>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -620,6 +621,44 @@ Java_hoshi_Parser_parse(JNIEnv* env,
     
 }
 
+//
+//  Java_hoshi_Parser_parse_1binary_1batch
+//  --------------------------------------
+//  
+//  Parse a batch of sources packed into one byte array. Like get_binary_ast
+//  we return a handle on the packed results for get_binary_buffer and
+//  delete_binary.
+//
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_hoshi_Parser_parse_1binary_1batch(JNIEnv* env, 
+                                       jclass clazz, 
+                                       ptrdiff_t this_handle, 
+                                       jbyteArray packed_sources, 
+                                       int64_t num_threads)
+{
+    
+    void* exception_ptr = nullptr;
+    void* result_ptr = nullptr;
+
+    string packed(env->GetArrayLength(packed_sources), '\0');
+    env->GetByteArrayRegion(packed_sources, 
+                            0, 
+                            packed.size(), 
+                            reinterpret_cast<jbyte*>(&packed[0]));
+    
+    ParserStatic::parser_parse_binary_batch(this_handle, 
+                                            exception_handler_out(&exception_ptr), 
+                                            packed, 
+                                            num_threads, 
+                                            string_result_out(&result_ptr));
+    
+    check_exceptions(env, exception_ptr);
+    
+    return reinterpret_cast<jlong>(result_ptr);
+    
+}
+
 //
 //  Java_hoshi_Parser_get_1encoded_1ast
 //  -----------------------------------
@@ -647,6 +686,227 @@ Java_hoshi_Parser_get_1encoded_1ast(JNIEnv* env,
     
 }
 
+//
+//  Java_hoshi_Parser_get_1binary_1ast
+//  ----------------------------------
+//  
+//  Return the Ast in binary form. We return a handle on the result and Java
+//  views it through get_binary_buffer, so nothing is copied or converted,
+//  then releases it with delete_binary.
+//
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_hoshi_Parser_get_1binary_1ast(JNIEnv* env, 
+                                   jclass clazz, 
+                                   ptrdiff_t this_handle)
+{
+    
+    void* exception_ptr = nullptr;
+    void* result_ptr = nullptr;
+    
+    ParserStatic::parser_get_binary_ast(this_handle, 
+                                        exception_handler_out(&exception_ptr), 
+                                        string_result_out(&result_ptr));
+    
+    check_exceptions(env, exception_ptr);
+    
+    return reinterpret_cast<jlong>(result_ptr);
+    
+}
+
+//
+//  Java_hoshi_Parser_get_1binary_1buffer
+//  -------------------------------------
+//  
+//  Wrap a binary result in a direct ByteBuffer. The buffer is only valid
+//  until the result is deleted.
+//
+
+extern "C" JNIEXPORT jobject JNICALL
+Java_hoshi_Parser_get_1binary_1buffer(JNIEnv* env, 
+                                      jclass clazz, 
+                                      jlong result_handle)
+{
+
+    StringResultStruct* result_ptr = 
+        reinterpret_cast<StringResultStruct*>(result_handle);
+
+    if (result_ptr == nullptr)
+    {
+        return env->NewDirectByteBuffer(nullptr, 0);
+    }
+
+    return env->NewDirectByteBuffer(const_cast<char*>(result_ptr->result_string.data()),
+                                    result_ptr->result_string.size());
+
+}
+
+//
+//  Java_hoshi_Parser_delete_1binary
+//  --------------------------------
+//  
+//  Release a binary result.
+//
+
+extern "C" JNIEXPORT void JNICALL
+Java_hoshi_Parser_delete_1binary(JNIEnv* env, 
+                                 jclass clazz, 
+                                 jlong result_handle)
+{
+    delete reinterpret_cast<StringResultStruct*>(result_handle);
+}
+
+//
+//  Java_hoshi_Parser_get_1ast_1handle
+//  ----------------------------------
+//  
+//  Return a handle on the root of the result Ast, or 0 if it's null.
+//
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_hoshi_Parser_get_1ast_1handle(JNIEnv* env, 
+                                   jclass clazz, 
+                                   ptrdiff_t this_handle)
+{
+    
+    void* exception_ptr = nullptr;
+    
+    ptrdiff_t result = ParserStatic::parser_get_ast_handle(this_handle, 
+                                                           exception_handler_out(&exception_ptr));
+    
+    check_exceptions(env, exception_ptr);
+    
+    return result;
+    
+}
+
+//
+//  Java_hoshi_AstHandle_get_1kind, get_1location & get_1num_1children
+//  ------------------------------------------------------------------
+//  
+//  Simple accessors on one node of the native tree.
+//
+
+extern "C" JNIEXPORT jint JNICALL
+Java_hoshi_AstHandle_get_1kind(JNIEnv* env, 
+                               jclass clazz, 
+                               ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_kind(ast_handle);
+}
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_hoshi_AstHandle_get_1location(JNIEnv* env, 
+                                   jclass clazz, 
+                                   ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_location(ast_handle);
+}
+
+extern "C" JNIEXPORT jint JNICALL
+Java_hoshi_AstHandle_get_1num_1children(JNIEnv* env, 
+                                        jclass clazz, 
+                                        ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_num_children(ast_handle);
+}
+
+//
+//  Java_hoshi_AstHandle_get_1lexeme
+//  --------------------------------
+//  
+//  Return the lexeme of one node.
+//
+
+extern "C" JNIEXPORT jstring JNICALL
+Java_hoshi_AstHandle_get_1lexeme(JNIEnv* env, 
+                                 jclass clazz, 
+                                 ptrdiff_t ast_handle)
+{
+
+    void* result_ptr = nullptr;
+    
+    ParserStatic::ast_get_lexeme(ast_handle, string_result_out(&result_ptr));
+    
+    return string_result_in(env, result_ptr);
+    
+}
+
+//
+//  Java_hoshi_AstHandle_get_1child
+//  -------------------------------
+//  
+//  Return a handle on one child, or 0 if it's null or out of range.
+//
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_hoshi_AstHandle_get_1child(JNIEnv* env, 
+                                jclass clazz, 
+                                ptrdiff_t ast_handle,
+                                jint child)
+{
+    return ParserStatic::ast_get_child(ast_handle, child);
+}
+
+//
+//  Java_hoshi_AstHandle_get_1children
+//  ----------------------------------
+//  
+//  Fill a Java long array with handles on a slice of the children. We
+//  gather them in a native buffer and copy them over in one call.
+//
+
+extern "C" JNIEXPORT jint JNICALL
+Java_hoshi_AstHandle_get_1children(JNIEnv* env, 
+                                   jclass clazz, 
+                                   ptrdiff_t ast_handle,
+                                   jint first,
+                                   jint count,
+                                   jlongArray handle_list)
+{
+
+    if (count <= 0)
+    {
+        return 0;
+    }
+
+    vector<ptrdiff_t> handles(count);
+    int filled = ParserStatic::ast_get_children(ast_handle, first, count, handles.data());
+
+    vector<jlong> java_handles(handles.begin(), handles.begin() + filled);
+    env->SetLongArrayRegion(handle_list, 0, filled, java_handles.data());
+
+    return filled;
+
+}
+
+//
+//  Java_hoshi_AstHandle_get_1subtree
+//  ---------------------------------
+//  
+//  Return a whole subtree in binary form. Like get_binary_ast we return a
+//  handle on the result for Parser.get_binary_buffer and delete_binary.
+//
+
+extern "C" JNIEXPORT jlong JNICALL
+Java_hoshi_AstHandle_get_1subtree(JNIEnv* env, 
+                                  jclass clazz, 
+                                  ptrdiff_t ast_handle)
+{
+    
+    void* exception_ptr = nullptr;
+    void* result_ptr = nullptr;
+    
+    ParserStatic::ast_get_subtree(ast_handle, 
+                                  exception_handler_out(&exception_ptr), 
+                                  string_result_out(&result_ptr));
+    
+    check_exceptions(env, exception_ptr);
+    
+    return reinterpret_cast<jlong>(result_ptr);
+    
+}
+
 //
 //  Java_hoshi_Parser_get_1encoded_1kind_1map
 //  -----------------------------------------
@@ -336,6 +336,54 @@ void jl_get_string_string(void** result_ptr, char* string_ptr)
     
 }
 
+//
+//  jl_get_string_data
+//  ------------------
+//  
+//  Fetch the address and size of the result string for Julia given a handle
+//  to the string. This lets Julia read a binary result in place. The string
+//  stays alive until jl_delete_string.
+//
+
+extern "C" EXTERN
+const char* jl_get_string_data(void** result_ptr, int64_t* size_ptr)
+{
+
+    if (result_ptr == nullptr || *result_ptr == nullptr)
+    {
+        *size_ptr = 0;
+        return nullptr;    
+    }
+
+    StringResultStruct* struct_ptr = *reinterpret_cast<StringResultStruct**>(result_ptr);
+
+    *size_ptr = struct_ptr->result_string.size();
+
+    return struct_ptr->result_string.data();
+
+}
+
+//
+//  jl_delete_string
+//  ----------------
+//  
+//  Delete a result string we accessed in place.
+//
+
+extern "C" EXTERN
+void jl_delete_string(void** result_ptr)
+{
+
+    if (result_ptr == nullptr || *result_ptr == nullptr)
+    {
+        return;    
+    }
+
+    delete *reinterpret_cast<StringResultStruct**>(result_ptr);
+    *reinterpret_cast<StringResultStruct**>(result_ptr) = nullptr;
+    
+}
+
 //
 //  jl_parser_new_parser
 //  --------------------
@@ -485,6 +533,31 @@ void jl_parser_parse(ptrdiff_t this_handle,
     
 }
 
+//
+//  jl_parser_parse_binary_batch
+//  ----------------------------
+//  
+//  Parse a batch of sources packed into one buffer. The results come back 
+//  packed into one buffer too, to read like jl_parser_get_binary_ast.
+//
+
+extern "C" EXTERN
+void jl_parser_parse_binary_batch(ptrdiff_t this_handle, 
+                                  void** exception_ptr, 
+                                  const char* packed_sources, 
+                                  int64_t packed_size, 
+                                  int64_t num_threads, 
+                                  void** result_ptr)
+{
+    
+    ParserStatic::parser_parse_binary_batch(this_handle, 
+                                            exception_handler_out(exception_ptr), 
+                                            string(packed_sources, packed_size), 
+                                            num_threads, 
+                                            string_result_out(result_ptr));
+    
+}
+
 //
 //  jl_parser_get_encoded_ast
 //  -------------------------
@@ -503,6 +576,122 @@ void jl_parser_get_encoded_ast(ptrdiff_t this_handle,
                                          string_result_out(result_ptr));
 }
 
+//
+//  jl_parser_get_binary_ast
+//  ------------------------
+//  
+//  Return the Ast in binary form. Julia reads this in place with
+//  jl_get_string_data rather than decoding it a character at a time.
+//
+
+extern "C" EXTERN
+void jl_parser_get_binary_ast(ptrdiff_t this_handle, 
+                              void** exception_ptr, 
+                              void** result_ptr)
+{
+    ParserStatic::parser_get_binary_ast(this_handle, 
+                                        exception_handler_out(exception_ptr), 
+                                        string_result_out(result_ptr));
+}
+
+//
+//  jl_parser_get_ast_handle
+//  ------------------------
+//  
+//  Return a handle on the root of the result Ast, or 0 if it's null.
+//
+
+extern "C" EXTERN
+int64_t jl_parser_get_ast_handle(ptrdiff_t this_handle, void** exception_ptr)
+{
+    return ParserStatic::parser_get_ast_handle(this_handle, 
+                                               exception_handler_out(exception_ptr));
+}
+
+//
+//  jl_ast_get_kind, jl_ast_get_location & jl_ast_get_num_children
+//  --------------------------------------------------------------
+//  
+//  Simple accessors on one node of the native tree.
+//
+
+extern "C" EXTERN
+int jl_ast_get_kind(ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_kind(ast_handle);
+}
+
+extern "C" EXTERN
+int64_t jl_ast_get_location(ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_location(ast_handle);
+}
+
+extern "C" EXTERN
+int jl_ast_get_num_children(ptrdiff_t ast_handle)
+{
+    return ParserStatic::ast_get_num_children(ast_handle);
+}
+
+//
+//  jl_ast_get_lexeme
+//  -----------------
+//  
+//  Return the lexeme of one node.
+//
+
+extern "C" EXTERN
+void jl_ast_get_lexeme(ptrdiff_t ast_handle, void** result_ptr)
+{
+    ParserStatic::ast_get_lexeme(ast_handle, string_result_out(result_ptr));
+}
+
+//
+//  jl_ast_get_child
+//  ----------------
+//  
+//  Return a handle on one child, or 0 if it's null or out of range.
+//
+
+extern "C" EXTERN
+int64_t jl_ast_get_child(ptrdiff_t ast_handle, int child)
+{
+    return ParserStatic::ast_get_child(ast_handle, child);
+}
+
+//
+//  jl_ast_get_children
+//  -------------------
+//  
+//  Fill a Julia array with handles on a slice of the children.
+//
+
+extern "C" EXTERN
+int jl_ast_get_children(ptrdiff_t ast_handle, int first, int count, int64_t* handle_list)
+{
+    return ParserStatic::ast_get_children(ast_handle, 
+                                          first, 
+                                          count, 
+                                          reinterpret_cast<ptrdiff_t*>(handle_list));
+}
+
+//
+//  jl_ast_get_subtree
+//  ------------------
+//  
+//  Return a whole subtree in binary form, to read like jl_parser_get_binary_ast.
+//
+
+extern "C" EXTERN
+void jl_ast_get_subtree(ptrdiff_t ast_handle, 
+                        void** exception_ptr, 
+                        void** result_ptr)
+{
+    ParserStatic::ast_get_subtree(ast_handle, 
+                                  exception_handler_out(exception_ptr), 
+                                  string_result_out(result_ptr));
+}
+
 //
 //  jl_parser_get_encoded_kind_map
 //  ------------------------------
@@ -36,6 +36,7 @@
 #include <set>
 #include <map>
 #include <algorithm>
+#include <limits>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -102,9 +103,11 @@ void LalrGenerator::generate()
     }
 
     //
-    //  Compute first sets for each non-terminal. 
+    //  Number the symbols densely so we can keep sets of them in bit 
+    //  vectors, then compute first sets for each non-terminal.       
     //
 
+    number_symbols();
     find_first_sets();
 
     if ((debug_flags & DebugType::DebugProgress) != 0)
@@ -144,10 +147,22 @@ void LalrGenerator::generate()
     //  Now for a moment we pretend we're building an LALR(1) parser and  
     //  compute the lookahead sets. In most cases a single lookahead will 
     //  be adequate so we'll start with that and extend as necessary      
-    //  later.                                                            
+    //  later. There are two ways to do this, selected by a grammar       
+    //  option.                                                           
     //
 
-    find_lalr1_lookaheads();
+    if (gram.lookahead_method == "digraph")
+    {
+        find_digraph_lookaheads();
+    }
+    else if (gram.lookahead_method == "compare")
+    {
+        compare_lookahead_methods();
+    }
+    else
+    {
+        find_lalr1_lookaheads();
+    }
 
     if ((debug_flags & DebugType::DebugProgress) != 0)
     {
@@ -229,6 +244,32 @@ void LalrGenerator::generate()
 
 }
 
+//
+//  number_symbols                                                      
+//  --------------                                                      
+//                                                                      
+//  Assign each symbol a small dense index. The first, follow and       
+//  lookahead sets are all bit vectors over these indices. We number in 
+//  name order so that everything derived from them is reproducible.    
+//
+
+void LalrGenerator::number_symbols()
+{
+
+    index_symbol.clear();
+    symbol_index.clear();
+
+    for (auto mp: gram.symbol_map)
+    {
+        symbol_index[mp.second] = index_symbol.size();
+        index_symbol.push_back(mp.second);
+    }
+
+    epsilon_index = symbol_index[gram.epsilon_symbol];
+    first_set.assign(index_symbol.size(), BitSet());
+
+}
+
 //
 //  find_first_sets                                                       
 //  ---------------                                                       
@@ -384,7 +425,7 @@ void LalrGenerator::find_first_sets()
 
         if (symbol->is_terminal)
         {
-            first_set[symbol].insert(symbol);
+            first_set[symbol_index[symbol]].insert(symbol_index[symbol]);
             workpile.insert(symbol);
         }
 
@@ -396,18 +437,14 @@ void LalrGenerator::find_first_sets()
         Symbol* source_symbol = *workpile.begin();
         workpile.erase(source_symbol);
 
+        BitSet& source_set = first_set[symbol_index[source_symbol]];
+
         for (Symbol* target_symbol: propagate_map[source_symbol])
         {
 
-            for (Symbol* symbol: first_set[source_symbol])
+            if (first_set[symbol_index[target_symbol]].insert_all(source_set))
             {
-
-                if (first_set[target_symbol].find(symbol) == first_set[target_symbol].end())
-                {
-                    first_set[target_symbol].insert(symbol);
-                    workpile.insert(target_symbol);
-                }
-
+                workpile.insert(target_symbol);
             }
 
         }
@@ -416,7 +453,7 @@ void LalrGenerator::find_first_sets()
 
     for (Symbol* symbol: nullable_symbols)
     {
-        first_set[symbol].insert(gram.epsilon_symbol);
+        first_set[symbol_index[symbol]].insert(epsilon_index);
     }
 
 }
@@ -470,22 +507,16 @@ void LalrGenerator::build_items()
         //  Now go back and compute first sets for each rule. 
         //
 
-        last->first_set.insert(gram.epsilon_symbol);
+        last->first_set.insert(epsilon_index);
 
         for (Item* item = last->prev; item != nullptr; item = item->prev)
         {
 
-            item->first_set = first_set[rule->rhs[item->dot]];
-            if (item->first_set.find(gram.epsilon_symbol) != item->first_set.end())
+            item->first_set = first_set[symbol_index[rule->rhs[item->dot]]];
+            if (item->first_set.contains(epsilon_index))
             {
-
-                item->first_set.erase(gram.epsilon_symbol);
-
-                for (Symbol* symbol: item->next->first_set)
-                {
-                    item->first_set.insert(symbol);
-                }
-
+                item->first_set.erase(epsilon_index);
+                item->first_set.insert_all(item->next->first_set);
             }
 
         }
@@ -635,18 +666,19 @@ void LalrGenerator::build_lr0_automaton()
     {
 
         //
-        //  Build the goto kernels. 
+        //  Build the goto kernels. We key these on the symbol index so   
+        //  that new states are numbered the same way on every run.       
         //
 
         State* state = state_list[i];
-        map<Symbol*, ItemSet> goto_kernels;
+        map<int64_t, ItemSet> goto_kernels;
 
         for (Item* item: state->item_set.get())
         {
  
             if (item->next != nullptr)
             {
-                goto_kernels[item->rule->rhs[item->dot]].get().insert(item->next);
+                goto_kernels[symbol_index[item->rule->rhs[item->dot]]].get().insert(item->next);
             }
 
         }
@@ -658,6 +690,7 @@ void LalrGenerator::build_lr0_automaton()
         for (auto mp: goto_kernels)
         {
 
+            Symbol* symbol = index_symbol[mp.first];
             ItemSet item_set = ItemSet(mp.second.get());
             build_lr0_closure(item_set);
 
@@ -674,7 +707,7 @@ void LalrGenerator::build_lr0_automaton()
                 state_map[goto_state->item_set] = goto_state;
             }
                 
-            state->lr0_goto[mp.first] = goto_state;
+            state->lr0_goto[symbol] = goto_state;
             goto_state->lookback_one.insert(state);
 
         }
@@ -823,7 +856,7 @@ void LalrGenerator::compute_lhs_follow(State* state, Symbol* lhs)
 
         if (ss.symbol == gram.accept_symbol)
         {
-            ss.state->lhs_follow[ss.symbol].insert(gram.eof_symbol);
+            ss.state->lhs_follow[ss.symbol].insert(symbol_index[gram.eof_symbol]);
             continue;
         }
 
@@ -835,14 +868,13 @@ void LalrGenerator::compute_lhs_follow(State* state, Symbol* lhs)
                 continue;
             }
 
-            for (Symbol* symbol: item->first_set)
+            BitSet& follow = ss.state->lhs_follow[ss.symbol];
+            follow.insert_all(item->first_set);
+
+            if (item->first_set.contains(epsilon_index))
             {
 
-                if (symbol != gram.epsilon_symbol)
-                {
-                    ss.state->lhs_follow[ss.symbol].insert(symbol);
-                    continue;
-                }
+                follow.erase(epsilon_index);
 
                 compute_lookback(ss.state, item->dot - 1);
                 for (State* s: ss.state->lookback[item->dot - 1])
@@ -887,16 +919,10 @@ void LalrGenerator::compute_lhs_follow(State* state, Symbol* lhs)
         for (StateSymbol target: propagate_map[source])
         {
 
-            for (Symbol* symbol: source.state->lhs_follow[source.symbol])
+            if (target.state->lhs_follow[target.symbol].insert_all(
+                    source.state->lhs_follow[source.symbol]))
             {
-
-                if (target.state->lhs_follow[target.symbol].find(symbol) ==
-                    target.state->lhs_follow[target.symbol].end())
-                {
-                    target.state->lhs_follow[target.symbol].insert(symbol);
-                    workpile.insert(target);
-                }
-
+                workpile.insert(target);
             }
 
         }
@@ -939,7 +965,7 @@ void LalrGenerator::find_lalr1_lookaheads()
         target_item = target_item->next;
     }
 
-    target_state->lookaheads[target_item].insert(gram.eof_symbol);
+    target_state->lookaheads[target_item].insert(symbol_index[gram.eof_symbol]);
     workpile.insert(StateItem(target_state, target_item));
 
     for (State* source_base_state: state_list)
@@ -986,23 +1012,23 @@ void LalrGenerator::find_lalr1_lookaheads()
                         target_item = target_item->next;
                     }
 
-                    for (Symbol* symbol: source_base_item->first_set)
+                    if (source_base_item->first_set.empty())
                     {
-                        
-                        if (symbol == gram.epsilon_symbol)
-                        {
-                            propagate_map[StateItem(source_state, source_item)].insert(
-                                StateItem(target_state, target_item));
-                        }
-                        else
-                        {
-                            target_state->lookaheads[target_item].insert(symbol);
-                        }
+                        continue;
+                    }
 
-                        workpile.insert(StateItem(target_state, target_item));
+                    BitSet& lookaheads = target_state->lookaheads[target_item];
+                    lookaheads.insert_all(source_base_item->first_set);
 
+                    if (source_base_item->first_set.contains(epsilon_index))
+                    {
+                        lookaheads.erase(epsilon_index);
+                        propagate_map[StateItem(source_state, source_item)].insert(
+                            StateItem(target_state, target_item));
                     }
 
+                    workpile.insert(StateItem(target_state, target_item));
+
                 }
 
             }
@@ -1024,16 +1050,10 @@ void LalrGenerator::find_lalr1_lookaheads()
         for (StateItem target: propagate_map[source])
         {
 
-            for (Symbol* symbol: source.state->lookaheads[source.item])
+            if (target.state->lookaheads[target.item].insert_all(
+                    source.state->lookaheads[source.item]))
             {
-
-                if (target.state->lookaheads[target.item].find(symbol) ==
-                    target.state->lookaheads[target.item].end())
-                {
-                    target.state->lookaheads[target.item].insert(symbol);
-                    workpile.insert(target);
-                }
-
+                workpile.insert(target);
             }
 
         }
@@ -1043,1618 +1063,2882 @@ void LalrGenerator::find_lalr1_lookaheads()
 }
 
 //
-//  encode_actions                                                        
-//  --------------                                                        
-//                                                                        
-//  This procedure uses the LR(0) automaton and the lookaheads we've      
-//  computed and builds a preliminary version of the action table. We say 
-//  preliminary, because at this point conflicts are permitted (we'll     
-//  extend lookahead strings to disambiguate later). Reduce actions are   
-//  encoded with follow states, which are sets of states that can be      
-//  entered after performing the reduction and reading the next token.    
+//  find_digraph_lookaheads                                                
+//  -----------------------                                                
+//                                                                         
+//  An alternative to find_lalr1_lookaheads using the method of DeRemer    
+//  and Pennello (Efficient Computation of LALR(1) Look-Ahead Sets, TOPLAS 
+//  1982). The nodes are the nonterminal transitions of the LR(0)          
+//  automaton. We solve two set equations over these with a Tarjan-style  
+//  strongly connected component traversal:                               
+//                                                                         
+//   - Read(p, A) is the set of terminals that can be shifted right after 
+//     the transition, seen through nullable nonterminals (the READS      
+//     relation).                                                          
+//                                                                         
+//   - Follow(p, A) adds what can follow an enclosing nonterminal when A  
+//     ends its right hand side (the INCLUDES relation).                   
+//                                                                         
+//  The lookaheads of a completed item are the union of Follow over the   
+//  transitions it looks back to. Each relation is traversed once, so     
+//  this is close to linear in the size of the automaton. As a bonus a    
+//  non-trivial component in READS is exactly a cycle in the READS        
+//  relation, so we report those here.                                    
+//                                                                         
+//  Follow(p, A) is exactly what compute_lhs_follow finds lazily, so we   
+//  save it there and extend_lookaheads gets it for free.                 
 //
 
-void LalrGenerator::encode_actions()
+void LalrGenerator::find_digraph_lookaheads()
 {
 
-    for (State* state: state_list)
+    vector<StateSymbol> node_list;
+    map<StateSymbol, int64_t> node_map;
+
+    //
+    //  digraph                                                             
+    //  -------                                                             
+    //                                                                      
+    //  Compute F(x) = F'(x) U { F(y) | x R y } for all x. On entry sets    
+    //  holds F' and on exit F. Each strongly connected component shares a  
+    //  single result. If cycles is non-null we save the non-trivial        
+    //  components there.                                                  
+    //
+
+    function<void(const vector<vector<int64_t>>&,
+                  vector<BitSet>&,
+                  vector<vector<int64_t>>*)> digraph =
+        [&](const vector<vector<int64_t>>& relation,
+            vector<BitSet>& sets,
+            vector<vector<int64_t>>* cycles) -> void
     {
 
+        const int64_t infinity = numeric_limits<int64_t>::max();
+        vector<int64_t> depth(node_list.size(), 0);
+        vector<int64_t> stack;
+
         //
-        //  LR(0) transitions become shift actions for terminals and goto 
-        //  actions for nonterminals.                                     
+        //  traverse                                                        
+        //  --------                                                        
+        //                                                                  
+        //  Visit every node reachable from a root. Relation chains can be  
+        //  long in large grammars, so we keep our own stack of frames       
+        //  rather than recursing. Each frame is a node, its depth when     
+        //  visited and the next edge to follow.                            
         //
 
-        for (auto mp: state->lr0_goto)
+        struct Frame
         {
+            int64_t x;
+            int64_t d;
+            size_t next_edge;
+            bool self_loop;
+        };
 
-            auto symbol = mp.first;
-            if (symbol->is_terminal)
-            {
-                ParseAction action;
-                action.action_type = ActionShift;
-                action.goto_state = mp.second->num;
-                state->action_multimap[symbol].insert(action);
-            }
-            else if (symbol->is_nonterminal)
-            {
-                ParseAction action;
-                action.action_type = ActionGoto;
-                action.goto_state = mp.second->num;
-                state->action_multimap[symbol].insert(action);
-            }
+        vector<Frame> frame_stack;
 
-        }
+        function<void(int64_t)> traverse = [&](int64_t root) -> void
+        {
 
-        //
-        //  Complete items become accept actions if the left hand symbol 
-        //  is accept or a reduce action otherwise.                      
-        //
+            stack.push_back(root);
+            depth[root] = stack.size();
+            frame_stack.push_back(Frame{root, depth[root], 0, false});
 
-        for (auto mp: state->lookaheads)
-        {
-            
-            if (mp.first->rule->lhs == gram.accept_symbol)
+            while (frame_stack.size() > 0)
             {
 
-                for (Symbol* symbol: mp.second)
-                {
-                    ParseAction action;
-                    action.action_type = ActionAccept;
-                    state->action_multimap[symbol].insert(action);
-                }
+                Frame& frame = frame_stack.back();
+                int64_t x = frame.x;
 
-            }
-            else
-            {
+                //
+                //  Follow the next edge. An unvisited node gets a frame of 
+                //  its own and we come back to this edge when it's done.   
+                //
 
-                for (Symbol* symbol: mp.second)
+                if (frame.next_edge < relation[x].size())
                 {
-                    ParseAction action;
-                    action.action_type = ActionReduce;
-                    action.rule_num = mp.first->rule->rule_num;
-                    state->action_multimap[symbol].insert(action);
-                }
 
-            }
+                    int64_t y = relation[x][frame.next_edge];
 
-        }
+                    if (y == x)
+                    {
+                        frame.self_loop = true;
+                    }
 
-    }
+                    if (depth[y] == 0)
+                    {
+                        stack.push_back(y);
+                        depth[y] = stack.size();
+                        frame_stack.push_back(Frame{y, depth[y], 0, false});
+                        continue;
+                    }
 
-}
+                    depth[x] = min(depth[x], depth[y]);
+                    sets[x].insert_all(sets[y]);
+                    frame.next_edge++;
 
-//
-//  infinite_loop_check                                                   
-//  -------------------                                                   
-//                                                                        
-//  When this procedure is called we should have found the LALR(1)        
-//  lookahead sets and we're about to extend them to LALR(k). However,    
-//  the method for doing that extension assumes that a few error          
-//  conditions are not present in the grammar. In fact, if the error      
-//  conditions are present, not only is the grammar not LALR(k) for any k 
-//  things are so bad that the following procedures will loop infinitely. 
-//                                                                        
-//  The conditions are:                                                   
-//                                                                        
-//   - There is a loop in the READS relation.  That is, there is a        
-//     loop on GOTO's in the LR(0) automaton in which every symbol used   
-//     in the GOTO is nullable.                                           
-//                                                                        
-//   - There is a nonterminal which can right-most produce itself.        
-//                                                                        
-//  Either of these conditions will cause an infinite loop when trying to 
-//  extend lookaheads.                                                    
-//
+                    continue;
 
-void LalrGenerator::infinite_loop_check()
-{
+                }
 
-    //
-    //  check_reads_cycle                                       
-    //  -----------------                                       
-    //                                                          
-    //  Check for a cycle in the READS relation. 
-    //
+                //
+                //  All edges are done. If x is the root of a component pop 
+                //  the component off the stack.                           
+                //
 
-    function<void(void)> check_reads_cycle = [&](void) -> void
-    {
+                int64_t d = frame.d;
+                bool self_loop = frame.self_loop;
+                frame_stack.pop_back();
 
-        set<vector<State*>> cycles;
+                if (depth[x] == d)
+                {
 
-        queue<vector<State*>> workpile;
-        for (State* state: state_list)
-        {
-            vector<State*> path;
-            path.push_back(state);
-            workpile.push(path);
-        }
+                    vector<int64_t> component;
+                    for (;;)
+                    {
 
-        while (workpile.size() > 0)
-        {
+                        int64_t top = stack.back();
+                        stack.pop_back();
 
-            vector<State*> path = workpile.front();
-            workpile.pop();
+                        depth[top] = infinity;
+                        component.push_back(top);
 
-            for (auto mp: path.back()->lr0_goto)
-            {
+                        if (top == x)
+                        {
+                            break;
+                        }
 
-                if (first_set[mp.first].find(gram.epsilon_symbol) == first_set[mp.first].end())
-                {
-                    continue;
-                }
+                        sets[top] = sets[x];
+
+                    }
+
+                    if (cycles != nullptr && (component.size() > 1 || self_loop))
+                    {
+                        cycles->push_back(component);
+                    }
 
-                if (mp.second == path.front())
-                {
-                    cycles.insert(path);
                 }
-                else
+
+                //
+                //  Finish the parent's edge to x. 
+                //
+
+                if (frame_stack.size() > 0)
                 {
-                    vector<State*> new_path = path;
-                    new_path.push_back(mp.second);
-                    workpile.push(new_path);
-                }
 
-            }
+                    Frame& parent = frame_stack.back();
 
-        }
+                    depth[parent.x] = min(depth[parent.x], depth[x]);
+                    sets[parent.x].insert_all(sets[x]);
+                    parent.next_edge++;
 
-        //
-        //  Format a nice message for the error handler. 
-        //
+                }
 
-        if (cycles.size() == 0)
-        {
-            return;
-        }
+            }
 
-        map<StateSet, vector<State*>> cycle_map;
+        };
 
-        for (vector<State*> path: cycles)
+        for (int64_t x = 0; x < node_list.size(); x++)
         {
-        
-            StateSet state_set;
-            for (State* p: path)
+            if (depth[x] == 0)
             {
-                state_set.get().insert(p);
+                traverse(x);
             }
-           
-            cycle_map[state_set] = path;
-
         }
 
-        ostringstream short_ost;
-        ostringstream long_ost;
+    };
 
-        short_ost << "Cycle"
-                  << ((cycle_map.size() > 1) ? "s" : "")
-                  << " in the READS relation" << endl << endl;
-                  
-        long_ost << "Cycle"
-                 << ((cycle_map.size() > 1) ? "s" : "")
-                 << " in the READS relation" << endl << endl;
-                  
-        set<State*> state_set;
-        for (auto mp: cycle_map)
-        {
+    //
+    //  find_digraph_lookaheads
+    //  -----------------------
+    //                                 
+    //  The function body begins here. 
+    //
+    //  Number the nonterminal transitions. The accept symbol has no real 
+    //  transition but we add one out of the start state which can only   
+    //  be followed by end of file.                                       
+    //
+
+    node_map[StateSymbol(start_state, gram.accept_symbol)] = node_list.size();
+    node_list.push_back(StateSymbol(start_state, gram.accept_symbol));
+
+    for (State* state: state_list)
+    {
 
-            short_ost << "    ";
-            long_ost << "    ";
+        for (auto mp: state->lr0_goto)
+        {
 
-            for (size_t i = 0; i < mp.second.size(); i++)
+            if (mp.first->is_nonterminal)
             {
+                node_map[StateSymbol(state, mp.first)] = node_list.size();
+                node_list.push_back(StateSymbol(state, mp.first));
+            }
 
-                state_set.insert(mp.second[i]);
+        }
 
-                short_ost << mp.second[i]->state_name;
-                long_ost << mp.second[i]->state_name;
+    }
 
-                if (i < mp.second.size() - 1)
-                {
-                    short_ost << " -> ";
-                    long_ost << " -> ";
-                }
+    //
+    //  The direct reads of a transition are the terminals shifted from  
+    //  its target state and the READS relation links it to the nullable 
+    //  nonterminal transitions out of that state.                       
+    //
 
-            }
+    vector<BitSet> follow(node_list.size());
+    vector<vector<int64_t>> reads(node_list.size());
 
-            short_ost << endl;
-            long_ost << endl;
+    follow[0].insert(symbol_index[gram.eof_symbol]);
 
-        }
-        
-        short_ost << endl;
-        long_ost << endl;
+    for (int64_t x = 1; x < node_list.size(); x++)
+    {
 
-        for (State* state: state_list)
+        State* target = node_list[x].state->lr0_goto[node_list[x].symbol];
+
+        for (auto mp: target->lr0_goto)
         {
-            if (state_set.find(state) != state_set.end())
+
+            if (mp.first->is_terminal)
             {
-                dump_state(state, long_ost, 4);
+                follow[x].insert(symbol_index[mp.first]);
+            }
+            else if (mp.first->is_nonterminal &&
+                     first_set[symbol_index[mp.first]].contains(epsilon_index))
+            {
+                reads[x].push_back(node_map[StateSymbol(target, mp.first)]);
             }
-        }
 
-        errh.add_error(ErrorType::ErrorReadsCycle,
-                       -1,
-                       short_ost.str(),
-                       long_ost.str());
+        }
 
-    };
+    }
 
     //
-    //  check_rm_produce                                     
-    //  ----------------                                     
-    //                                                       
-    //  Check whether a symbol can rightmost-produce itself. 
+    //  Walk each rule from every state it can start in. Along the way we 
+    //  find the INCLUDES relation: a nonterminal followed by a nullable  
+    //  suffix includes the left hand side. Where the walk ends we find   
+    //  the LOOKBACK relation from the completed item.                    
     //
 
-    function<void(void)> check_rm_produce = [&](void) -> void
-    {
+    vector<vector<int64_t>> includes(node_list.size());
+    vector<pair<StateItem, int64_t>> lookback;
 
-        //
-        //  We're going to use a fixpoint algorithm again. First we make a 
-        //  mapping from B to A where there is a rule A ::= Bd and d can   
-        //  produce epsilon. Then we know that anything B can produce, A   
-        //  can also produce.                                              
-        //
+    for (State* state: state_list)
+    {
 
-        map<Symbol*, set<Symbol*>> propagate_map;
-        for (Rule* rule: gram.rule_list)
+        for (Item* start_item: state->item_set.get())
         {
 
-            if (rule->rhs.size() == 0)
+            if (start_item->dot != 0)
             {
                 continue;
             }
 
-            if (rule_item_map[rule]->next->first_set.find(gram.epsilon_symbol) !=
-                rule_item_map[rule]->next->first_set.end())
+            int64_t x = node_map[StateSymbol(state, start_item->rule->lhs)];
+
+            State* q = state;
+            Item* item = start_item;
+
+            while (item->next != nullptr)
             {
-                propagate_map[rule->rhs[0]].insert(rule->lhs);
-            }
 
-        }
+                Symbol* symbol = item->rule->rhs[item->dot];
 
-        //
-        //  We initialize all the produce lists. Anything in the range of 
-        //  the propagate map can produce whatever is mapped to it.       
-        //
+                if (symbol->is_nonterminal &&
+                    item->next->first_set.contains(epsilon_index))
+                {
+                    includes[node_map[StateSymbol(q, symbol)]].push_back(x);
+                }
+
+                q = q->lr0_goto[symbol];
+                item = item->next;
 
-        map<Symbol*, set<Symbol*>> produce;
-        for (auto mp: propagate_map)
-        {
-            Symbol* left = mp.first;
-            for (Symbol* right: mp.second)
-            {
-                produce[right].insert(left);
             }
-        }
 
-        //
-        //  Propagate these sets until things stablilize. 
-        //
+            lookback.push_back(make_pair(StateItem(q, item), x));
 
-        queue<Symbol*> workpile;
-        for (auto mp: propagate_map)
-        {
-            workpile.push(mp.first);
         }
 
+    }
+
+    //
+    //  Solve for Read then Follow. 
+    //
+
+    vector<vector<int64_t>> reads_cycles;
+    digraph(reads, follow, &reads_cycles);
+    digraph(includes, follow, nullptr);
+
+    for (int64_t x = 0; x < node_list.size(); x++)
+    {
+        node_list[x].state->lhs_follow[node_list[x].symbol] = follow[x];
+    }
+
+    for (auto& lb: lookback)
+    {
+        lb.first.state->lookaheads[lb.first.item].insert_all(follow[lb.second]);
+    }
+
+    //
+    //  Convert each component of the READS relation with a cycle into a 
+    //  path of states for the error message.                            
+    //
+
+    reads_cycle_checked = true;
+
+    if (reads_cycles.size() == 0)
+    {
+        return;
+    }
+
+    set<vector<State*>> cycles;
+
+    for (auto& component: reads_cycles)
+    {
+
+        set<int64_t> members(component.begin(), component.end());
+        int64_t root = component.back();
+
+        map<int64_t, int64_t> parent;
+        queue<int64_t> workpile;
+        workpile.push(root);
+
         while (workpile.size() > 0)
         {
 
-            Symbol* left = workpile.front();
+            int64_t x = workpile.front();
             workpile.pop();
 
-            for (Symbol* right: propagate_map[left])
+            if (find(reads[x].begin(), reads[x].end(), root) != reads[x].end())
             {
 
-                for (Symbol* symbol: produce[left])
+                vector<State*> path;
+                for (int64_t y = x; y != root; y = parent[y])
                 {
-                    if (produce[right].find(symbol) == produce[right].end())
-                    {
-                        produce[right].insert(symbol);
-                        workpile.push(right);
-                    }
+                    path.push_back(node_list[y].state);
                 }
 
-            }
-                
-        }
+                path.push_back(node_list[root].state);
+                reverse(path.begin(), path.end());
+                cycles.insert(path);
 
-        //
-        //  If nothing can produce itself, we're home free. Otherwise we 
-        //  report an error.
-        //
+                break;
 
-        vector<Symbol*> bad_symbols;
-        for (auto mp: produce)
-        {
-            if (mp.second.find(mp.first) != mp.second.end())
-            {
-                bad_symbols.push_back(mp.first);
             }
-        }
-
-        if (bad_symbols.size() == 0)
-        {
-            return;
-        }
-
-        vector<string> name_list;
-        for (Symbol* s: bad_symbols)
-        {
-            name_list.push_back(s->symbol_name);
-        }
 
-        sort(name_list.begin(), name_list.end());
+            for (int64_t y: reads[x])
+            {
 
-        ostringstream ost;
-        ost << "The following "
-            << ((name_list.size() > 1) ? "symbols" : "symbol")
-            << " can produce "
-            << ((name_list.size() > 1) ? "themselves" : "itself")
-            << endl << endl;
-                  
-        ost << "    ";
-        int width = 4;
-        
-        for (int i = 0; i < name_list.size(); i++)
-        {
+                if (members.find(y) != members.end() &&
+                    parent.find(y) == parent.end() &&
+                    y != root)
+                {
+                    parent[y] = x;
+                    workpile.push(y);
+                }
 
-            if (width + gram.symbol_width > gram.line_width)
-            {
-                ost << endl << "    ";
-                width = 4;
             }
 
-            ost << setw(gram.symbol_width) << left << name_list[i]
-                << setw(0);
-            width += gram.symbol_width;
-
         }
 
-        errh.add_error(ErrorType::ErrorSymbolSelfProduce,
-                       -1,
-                       ost.str());
-
-    };
-
-    //
-    //  infinite_loop_check            
-    //  -------------------            
-    //                                 
-    //  The function body begins here. 
-    //
-
-    if (gram.max_lookaheads < 2)
-    {
-        return;
     }
 
-    check_reads_cycle();
-    check_rm_produce();
+    report_reads_cycles(cycles);
 
 }
 
 //
-//  extend_lookaheads                                                       
-//  -----------------                                                       
+//  compare_lookahead_methods                                              
+//  -------------------------                                              
 //                                                                         
-//  Fix up the parse actions adding lookahead states to resolve conflicts. 
-//  At the end of this process we should have no unexpected conflicts. If  
-//  we do we create an error message and if we don't we choose actions for 
-//  all the expected conflicts.                                            
+//  Run both lookahead methods and complain if they disagree. This is a    
+//  check on the generator, not the grammar. We keep the digraph results.  
+//                                                                         
+//  They won't always agree exactly. The propagation method pushes         
+//  lookaheads back from completed items in LR(0) states, and where such   
+//  a state is shared by several contexts it can carry lookaheads from one 
+//  context into another. So its lookahead sets may be a little larger     
+//  (DeRemer and Pennello call this NQLALR). We report those differences   
+//  as warnings. Anything else, including any difference in the follow    
+//  sets, is an error.                                                     
 //
 
-void LalrGenerator::extend_lookaheads()
+void LalrGenerator::compare_lookahead_methods()
 {
 
-    set<State*> conflict_states;
-    set<StateSymbol> visited;
+    find_lalr1_lookaheads();
 
     //
-    //  next_la                                                               
-    //  -------                                                               
-    //                                                                        
-    //  We are given a state which can read a symbol and we return the set of 
-    //  symbols that can come next.                                           
+    //  Save the lookaheads and follow sets from the propagation method, 
+    //  forcing the latter for every nonterminal transition.             
     //
 
-    function<set<Symbol*>(StateStack&, Symbol*)> next_la =
-        [&](StateStack& stack, Symbol* symbol) -> set<Symbol*>
-    {
+    map<StateItem, BitSet> saved_lookaheads;
+    map<StateSymbol, BitSet> saved_follow;
 
-        State* state = stack.get().back();
-        set<Symbol*> la;
+    compute_lhs_follow(start_state, gram.accept_symbol);
 
-        State* goto_state = state->lr0_goto[symbol];
-        for (Item* item: goto_state->item_set.get())
+    for (State* state: state_list)
+    {
+
+        for (auto mp: state->lr0_goto)
         {
-            for (Symbol* s: item->first_set)
+            if (mp.first->is_nonterminal)
             {
-                la.insert(s);
+                compute_lhs_follow(state, mp.first);
             }
         }
 
-        for (Item* item: state->item_set.get())
+        for (auto mp: state->lookaheads)
         {
-
-            if (item->dot >= item->rule->rhs.size())
+            if (!mp.second.empty())
             {
-                continue;
+                saved_lookaheads[StateItem(state, mp.first)] = mp.second;
             }
+        }
 
-            if (item->rule->rhs[item->dot] != symbol)
-            {
-                continue;
-            }
+        for (auto mp: state->lhs_follow)
+        {
+            saved_follow[StateSymbol(state, mp.first)] = mp.second;
+        }
 
-            if (item->next->first_set.find(gram.epsilon_symbol) == item->next->first_set.end())
-            {
-                continue;
-            }
-       
-            if (item->rule->lhs == gram.accept_symbol)
-            {
-                continue;
-            }
+        state->lookaheads.clear();
+        state->lhs_follow.clear();
 
-            if (item->dot < stack.get().size())
-            {
+    }
 
-                StateStack next_stack = stack;
-                if (item->dot > 0)
-                {
-                    next_stack.get().erase(next_stack.get().end() - item->dot,
-                                           next_stack.get().end());
-                }
+    find_digraph_lookaheads();
 
-                for (Symbol* s: next_la(next_stack, item->rule->lhs))
-                {
-                    la.insert(s);
-                }
+    //
+    //  Compare the results, listing symbols found by only one method. 
+    //
+
+    ostringstream error_ost;
+    ostringstream warning_ost;
+    int64_t errors = 0;
+    int64_t warnings = 0;
+
+    auto compare_sets = [&](const string& title,
+                            const BitSet& digraph_set,
+                            const BitSet& propagate_set,
+                            bool propagate_superset) -> void
+    {
 
+        string digraph_only;
+        for (int64_t index: digraph_set)
+        {
+            if (!propagate_set.contains(index))
+            {
+                digraph_only += " " + index_symbol[index]->symbol_name;
             }
-            else
+        }
+
+        string propagate_only;
+        for (int64_t index: propagate_set)
+        {
+            if (!digraph_set.contains(index))
             {
+                propagate_only += " " + index_symbol[index]->symbol_name;
+            }
+        }
 
-                size_t distance = item->dot + 1 - stack.get().size();
-                compute_lookback(stack.get()[0], distance);
+        if (digraph_only.size() == 0 && propagate_only.size() == 0)
+        {
+            return;
+        }
 
-                for (State* q: stack.get()[0]->lookback[distance])
-                {   
-                    compute_lhs_follow(q, item->rule->lhs);
-                    for (Symbol* s: q->lhs_follow[item->rule->lhs])
-                    {
-                        la.insert(s);
-                    }
-                }
+        if (digraph_only.size() == 0 && propagate_superset)
+        {
+            warning_ost << "    " << title << endl
+                        << "        propagate only:" << propagate_only << endl;
+            warnings++;
+            return;
+        }
 
-            }
+        error_ost << "    " << title << endl;
 
+        if (digraph_only.size() > 0)
+        {
+            error_ost << "        digraph only:" << digraph_only << endl;
         }
 
-        if (la.find(gram.epsilon_symbol) != la.end())
+        if (propagate_only.size() > 0)
         {
-            la.erase(gram.epsilon_symbol);
+            error_ost << "        propagate only:" << propagate_only << endl;
         }
 
-        return la;
+        errors++;
 
     };
 
-    //
-    //  follow_sources                                                     
-    //  --------------                                                     
-    //                                                                     
-    //  Follow sources returns a set of configurations which can follow a  
-    //  given configuration after a transition on a symbol, some number of 
-    //  reductions, and finally shift a given terminal. It recursively     
-    //  looks back through the LR(0) automaton.                            
-    //
-
-    function<set<StateStack>(StateStack&, Symbol*, Symbol*)> follow_sources =
-        [&](StateStack& stack, Symbol* symbol, Symbol* terminal) -> set<StateStack>
+    for (State* state: state_list)
     {
 
-        State* state = stack.get().back();
-
-        //
-        //  If we've already visited this state then return. 
-        //
+        set<Item*> item_set;
 
-        if (stack.get().size() == 1)
+        for (auto mp: state->lookaheads)
         {
+            item_set.insert(mp.first);
+        }
 
-            if (visited.find(StateSymbol(state, symbol)) !=
-                visited.end())
+        for (auto mp: saved_lookaheads)
+        {
+            if (mp.first.state == state)
             {
-                return set<StateStack>(); 
+                item_set.insert(mp.first.item);
             }
-            else
-            {
-                visited.insert(StateSymbol(state, symbol));
-            }
-
         }
 
-        set<StateStack> stack_set;
-
-        //
-        //  If the terminal is in the direct read set then include it in 
-        //  the successor state.                                         
-        //
-
-        State* goto_state = state->lr0_goto[symbol];
+        for (Item* item: item_set)
+        {
+            compare_sets("Lookaheads in state " + state->state_name +
+                         " for rule " + to_string(item->rule->rule_num),
+                         state->lookaheads[item],
+                         saved_lookaheads[StateItem(state, item)],
+                         true);
+        }
 
-        if (goto_state->lr0_goto.find(terminal) != goto_state->lr0_goto.end())
+        for (auto mp: state->lhs_follow)
         {
-            StateStack next_stack = stack;
-            next_stack.get().push_back(goto_state);
-            stack_set.insert(next_stack);
+            compare_sets("Follow set in state " + state->state_name +
+                         " for " + mp.first->symbol_name,
+                         mp.second,
+                         saved_follow[StateSymbol(state, mp.first)],
+                         false);
         }
 
-        //
-        //  Look for states and symbols in the reads relation and follow 
-        //  their sources.                                               
-        //
+    }
 
-        for (auto mp: goto_state->lr0_goto)
-        {
+    if ((debug_flags & DebugType::DebugProgress) != 0)
+    {
+        cout << "Lookahead methods compared: " 
+             << errors << " errors, "
+             << warnings << " warnings, "
+             << prsi.elapsed_time_string()
+             << endl;
+    }
 
-            if (first_set[mp.first].find(gram.epsilon_symbol) != first_set[mp.first].end())
-            {
+    if (warnings > 0)
+    {
+        errh.add_error(ErrorType::ErrorWarning,
+                       -1,
+                       "Propagated lookaheads larger than LALR(1)\n\n" +
+                       warning_ost.str());
+    }
 
-                StateStack next_stack = stack;
-                next_stack.get().push_back(goto_state);
+    if (errors > 0)
+    {
+        errh.add_error(ErrorType::ErrorError,
+                       -1,
+                       "Lookahead methods disagree\n\n" + error_ost.str());
+    }
 
-                for (auto s: follow_sources(next_stack, mp.first, terminal))
-                {
-                    stack_set.insert(s);
-                }
+}
 
-            }
+//
+//  encode_actions                                                        
+//  --------------                                                        
+//                                                                        
+//  This procedure uses the LR(0) automaton and the lookaheads we've      
+//  computed and builds a preliminary version of the action table. We say 
+//  preliminary, because at this point conflicts are permitted (we'll     
+//  extend lookahead strings to disambiguate later). Reduce actions are   
+//  encoded with follow states, which are sets of states that can be      
+//  entered after performing the reduction and reading the next token.    
+//
 
-        }
+void LalrGenerator::encode_actions()
+{
+
+    for (State* state: state_list)
+    {
 
         //
-        //  Look for situations where we're looking at the last symbol in 
-        //  a rule. When we find them we have to backtrack.               
+        //  LR(0) transitions become shift actions for terminals and goto 
+        //  actions for nonterminals.                                     
         //
 
-        for (Item* item: state->item_set.get())
+        for (auto mp: state->lr0_goto)
         {
 
-            if (item->dot != item->rule->rhs.size() - 1)
+            auto symbol = mp.first;
+            if (symbol->is_terminal)
             {
-                continue;
+                ParseAction action;
+                action.action_type = ActionShift;
+                action.goto_state = mp.second->num;
+                state->action_multimap[symbol].insert(action);
             }
-
-            if (item->rule->rhs[item->dot] != symbol)
+            else if (symbol->is_nonterminal)
             {
-                continue;
+                ParseAction action;
+                action.action_type = ActionGoto;
+                action.goto_state = mp.second->num;
+                state->action_multimap[symbol].insert(action);
             }
 
-            if (item->rule->lhs == gram.accept_symbol)
-            {
-                continue;
-            }
+        }
 
-            if (item->dot < stack.get().size())
-            {
+        //
+        //  Complete items become accept actions if the left hand symbol 
+        //  is accept or a reduce action otherwise.                      
+        //
 
-                StateStack next_stack = stack;
-                if (item->dot > 0)
-                {
-                    next_stack.get().erase(next_stack.get().end() - item->dot,
-                                           next_stack.get().end());
-                }
+        for (auto mp: state->lookaheads)
+        {
+            
+            if (mp.first->rule->lhs == gram.accept_symbol)
+            {
 
-                for (auto s: follow_sources(next_stack, item->rule->lhs, terminal))
+                for (int64_t index: mp.second)
                 {
-                    stack_set.insert(s);
+                    ParseAction action;
+                    action.action_type = ActionAccept;
+                    state->action_multimap[index_symbol[index]].insert(action);
                 }
 
             }
             else
             {
 
-                size_t distance = item->dot + 1 - stack.get().size();
-                compute_lookback(stack.get()[0], distance);
-
-                for (State* q: stack.get()[0]->lookback[distance])
+                for (int64_t index: mp.second)
                 {
-
-                    StateStack temp_stack(q);
-
-                    for (auto s: follow_sources(temp_stack, item->rule->lhs, terminal))
-                    {
-                        stack_set.insert(s);
-                    }
-
+                    ParseAction action;
+                    action.action_type = ActionReduce;
+                    action.rule_num = mp.first->rule->rule_num;
+                    state->action_multimap[index_symbol[index]].insert(action);
                 }
 
             }
 
         }
 
-        return stack_set;
+    }
 
-    };
+}
+
+//
+//  infinite_loop_check                                                   
+//  -------------------                                                   
+//                                                                        
+//  When this procedure is called we should have found the LALR(1)        
+//  lookahead sets and we're about to extend them to LALR(k). However,    
+//  the method for doing that extension assumes that a few error          
+//  conditions are not present in the grammar. In fact, if the error      
+//  conditions are present, not only is the grammar not LALR(k) for any k 
+//  things are so bad that the following procedures will loop infinitely. 
+//                                                                        
+//  The conditions are:                                                   
+//                                                                        
+//   - There is a loop in the READS relation.  That is, there is a        
+//     loop on GOTO's in the LR(0) automaton in which every symbol used   
+//     in the GOTO is nullable.                                           
+//                                                                        
+//   - There is a nonterminal which can right-most produce itself.        
+//                                                                        
+//  Either of these conditions will cause an infinite loop when trying to 
+//  extend lookaheads.                                                    
+//
+
+void LalrGenerator::infinite_loop_check()
+{
 
     //
-    //  resolve_conflicts                                                      
-    //  -----------------                                                      
-    //                                                                         
-    //  Add a lookahead state then check whether we have to keep extending the 
-    //  lookahead string.                                                      
+    //  check_reads_cycle                                       
+    //  -----------------                                       
+    //                                                          
+    //  Check for a cycle in the READS relation. 
     //
 
-    function<void(State*, Symbol*, map<ParseAction, set<StateStack>>, int)> resolve_conflicts =
-        [&](State* state,
-            Symbol* terminal,
-            map<ParseAction, set<StateStack>> sources,
-            int lookahead) -> void
+    function<void(void)> check_reads_cycle = [&](void) -> void
     {
 
-        //
-        //  If we've exceeded the max lookahead we have an unresolvable 
-        //  conflict.                                                   
-        //
+        set<vector<State*>> cycles;
 
-        if (lookahead > gram.max_lookaheads)
+        queue<vector<State*>> workpile;
+        for (State* state: state_list)
         {
-            conflict_states.insert(state->lr0_state);
-            return;
+            vector<State*> path;
+            path.push_back(state);
+            workpile.push(path);
         }
 
-        //
-        //  Create a lookahead state. 
-        //
-
-        State* la_state = get_state();
-        la_state->lookback_one.insert(state);
-        la_state->lr0_state = state->lr0_state;
-        state->la_goto_map[terminal] = la_state;
-        la_state->la_symbol = terminal;
+        while (workpile.size() > 0)
+        {
 
-        //
-        //  Find symbols which can be read in the lookahead state. 
-        //
+            vector<State*> path = workpile.front();
+            workpile.pop();
 
-        for (auto mp: sources)
-        {
-            for (auto stack: mp.second)
+            for (auto mp: path.back()->lr0_goto)
             {
-                for (Symbol* symbol: next_la(stack, terminal))
+
+                if (!first_set[symbol_index[mp.first]].contains(epsilon_index))
+                {
+                    continue;
+                }
+
+                if (mp.second == path.front())
                 {
-                    la_state->action_multimap[symbol].insert(mp.first);
+                    cycles.insert(path);
+                }
+                else
+                {
+                    vector<State*> new_path = path;
+                    new_path.push_back(mp.second);
+                    workpile.push(new_path);
                 }
+
             }
+
         }
 
+        report_reads_cycles(cycles);
+
+    };
+
+    //
+    //  check_rm_produce                                     
+    //  ----------------                                     
+    //                                                       
+    //  Check whether a symbol can rightmost-produce itself. 
+    //
+
+    function<void(void)> check_rm_produce = [&](void) -> void
+    {
+
         //
-        //  If we've still got conflicts we extend the automaton again. 
+        //  We're going to use a fixpoint algorithm again. First we make a 
+        //  mapping from B to A where there is a rule A ::= Bd and d can   
+        //  produce epsilon. Then we know that anything B can produce, A   
+        //  can also produce.                                              
         //
 
-        for (auto mp: la_state->action_multimap)
+        map<Symbol*, set<Symbol*>> propagate_map;
+        for (Rule* rule: gram.rule_list)
         {
 
-            if (mp.second.size() < 2)
+            if (rule->rhs.size() == 0)
             {
                 continue;
             }
 
-            map<ParseAction, set<StateStack>> new_sources;
-            for (auto a: mp.second)
+            if (rule_item_map[rule]->next->first_set.contains(epsilon_index))
             {
-
-                for (auto stack: sources[a])
-                {
-
-                    visited.clear();
-                    for (auto s: follow_sources(stack, terminal, mp.first))
-                    {
-                        new_sources[a].insert(s);
-                    }
-
-                }
-
+                propagate_map[rule->rhs[0]].insert(rule->lhs);
             }
 
-            resolve_conflicts(la_state, mp.first, new_sources, lookahead + 1);
-
         }
 
-    };
-    
-    //
-    //  extend_lookaheads                                                
-    //  -----------------                                                
-    //                                                                   
-    //  The function body begins here. Start by finding conflicts in the 
-    //  LALR(1) automaton.                                               
-    //
+        //
+        //  We initialize all the produce lists. Anything in the range of 
+        //  the propagate map can produce whatever is mapped to it.       
+        //
 
-    for (size_t i = 0; i < state_list.size(); i++)
-    {
+        map<Symbol*, set<Symbol*>> produce;
+        for (auto mp: propagate_map)
+        {
+            Symbol* left = mp.first;
+            for (Symbol* right: mp.second)
+            {
+                produce[right].insert(left);
+            }
+        }
 
-        State* state = state_list[i];
+        //
+        //  Propagate these sets until things stablilize. 
+        //
 
-        if (state->lr0_state != state)
+        queue<Symbol*> workpile;
+        for (auto mp: propagate_map)
         {
-            continue;
+            workpile.push(mp.first);
         }
 
-        for (auto mp: state->action_multimap)
+        while (workpile.size() > 0)
         {
 
-            if (mp.second.size() < 2)
-            {
-                continue;
-            }
-
-            map<ParseAction, set<StateStack>> sources;
+            Symbol* left = workpile.front();
+            workpile.pop();
 
-            for (ParseAction action: mp.second)
+            for (Symbol* right: propagate_map[left])
             {
 
-                if (action.action_type == ParseActionType::ActionShift)
-                {
-                    sources[action].insert(StateStack(state));
-                }    
-                else if (action.action_type == ParseActionType::ActionReduce)
+                for (Symbol* symbol: produce[left])
                 {
-
-                    size_t distance = gram.rule_list[action.rule_num]->rhs.size();
-                    Symbol* lhs = gram.rule_list[action.rule_num]->lhs;
-
-                    compute_lookback(state, distance);
-                    for (State* p: state->lookback[distance])
+                    if (produce[right].find(symbol) == produce[right].end())
                     {
-
-                        visited.clear();
-                        StateStack temp_stack(p);
-
-                        for (auto s: follow_sources(temp_stack, lhs, mp.first))
-                        {
-                            sources[action].insert(s);
-                        }
-
+                        produce[right].insert(symbol);
+                        workpile.push(right);
                     }
-
                 }
 
             }
+                
+        }
 
-            resolve_conflicts(state, mp.first, sources, 2);
+        //
+        //  If nothing can produce itself, we're home free. Otherwise we 
+        //  report an error.
+        //
 
+        vector<Symbol*> bad_symbols;
+        for (auto mp: produce)
+        {
+            if (mp.second.find(mp.first) != mp.second.end())
+            {
+                bad_symbols.push_back(mp.first);
+            }
         }
 
-    }
-
-    //
-    //  If we still have conflicts and haven't predicted them in advance 
-    //  then format an error message.                                    
-    //
+        if (bad_symbols.size() == 0)
+        {
+            return;
+        }
 
-    if (conflict_states.size() > gram.expected_conflicts)
-    {
+        vector<string> name_list;
+        for (Symbol* s: bad_symbols)
+        {
+            name_list.push_back(s->symbol_name);
+        }
 
-        ostringstream short_ost;
-        ostringstream long_ost;
+        sort(name_list.begin(), name_list.end());
 
-        short_ost << "The following state"
-                  << ((conflict_states.size() > 1) ? "s" : "")
-                  << " had conflicts: ";
-                  
-        long_ost << "The following state"
-                 << ((conflict_states.size() > 1) ? "s" : "")
-                 << " had conflicts" << endl << endl;
+        ostringstream ost;
+        ost << "The following "
+            << ((name_list.size() > 1) ? "symbols" : "symbol")
+            << " can produce "
+            << ((name_list.size() > 1) ? "themselves" : "itself")
+            << endl << endl;
                   
-        short_ost << "    ";
-
-        int count = conflict_states.size();
-        for (State* s: conflict_states)
+        ost << "    ";
+        int width = 4;
+        
+        for (int i = 0; i < name_list.size(); i++)
         {
 
-            short_ost << s->state_name;
-            count--;
-
-            if (count > 1)
+            if (width + gram.symbol_width > gram.line_width)
             {
-                short_ost << ", ";
+                ost << endl << "    ";
+                width = 4;
             }
 
-        }
-
-        short_ost << endl;
+            ost << setw(gram.symbol_width) << left << name_list[i]
+                << setw(0);
+            width += gram.symbol_width;
 
-        for (State* state: state_list)
-        {
-            if (conflict_states.find(state) != conflict_states.end())
-            {
-                dump_state(state, long_ost, 2);
-            }
         }
 
-        errh.add_error(ErrorType::ErrorLalrConflict,
+        errh.add_error(ErrorType::ErrorSymbolSelfProduce,
                        -1,
-                       short_ost.str(),
-                       long_ost.str());
-
-        return;
+                       ost.str());
 
-    }
+    };
 
     //
-    //  Up to this point we kept LaShift actions in a parallel map in case 
-    //  our algorithms needed to access a conflict state. Now we replace   
-    //  the conflicts we were able to resolve with the LaShift actions.    
+    //  infinite_loop_check            
+    //  -------------------            
+    //                                 
+    //  The function body begins here. 
     //
 
-    for (State* state: state_list)
+    if (gram.max_lookaheads < 2)
     {
+        return;
+    }
 
-        for (auto mp: state->la_goto_map)
-        {
+    if (!reads_cycle_checked)
+    {
+        check_reads_cycle();
+    }
 
-            ParseAction action;
-            action.action_type = ParseActionType::ActionLaShift;
-            action.goto_state = mp.second->num;
+    check_rm_produce();
 
-            state->action_multimap.erase(mp.first);
-            state->action_multimap[mp.first].insert(action);
+}
 
-        }
+//
+//  report_reads_cycles                                                
+//  -------------------                                                
+//                                                                     
+//  Format a nice message for the error handler from a set of cycles  
+//  in the READS relation, each a path of states.                      
+//
+
+void LalrGenerator::report_reads_cycles(const set<vector<State*>>& cycles)
+{
 
+    if (cycles.size() == 0)
+    {
+        return;
     }
 
-    //
-    //  Break conflicts in the sequence shift, accept, reduce with lowest rule 
-    //  number. This is kind of arbitrary. I hope it isn't used.               
-    //
+    map<StateSet, vector<State*>> cycle_map;
 
-    for (State* state: conflict_states)
+    for (vector<State*> path: cycles)
     {
-
-        for (auto mp: gram.symbol_map)
+    
+        StateSet state_set;
+        for (State* p: path)
         {
+            state_set.get().insert(p);
+        }
+       
+        cycle_map[state_set] = path;
 
-            if (state->action_multimap[mp.second].size() < 2)
-            {
-                continue;
-            }
+    }
 
-            ParseAction action;
+    ostringstream short_ost;
+    ostringstream long_ost;
+
+    short_ost << "Cycle"
+              << ((cycle_map.size() > 1) ? "s" : "")
+              << " in the READS relation" << endl << endl;
+              
+    long_ost << "Cycle"
+             << ((cycle_map.size() > 1) ? "s" : "")
+             << " in the READS relation" << endl << endl;
+              
+    set<State*> state_set;
+    for (auto mp: cycle_map)
+    {
 
-            int64_t rule_num = gram.rule_list.size() + 1;
-            for (ParseAction a: state->action_multimap[mp.second])
-            {
+        short_ost << "    ";
+        long_ost << "    ";
 
-                if (a.action_type == ParseActionType::ActionReduce &&    
-                    a.rule_num < rule_num)
-                {
-                    action = a;
-                    rule_num = a.rule_num;
-                }
+        for (size_t i = 0; i < mp.second.size(); i++)
+        {
 
+            state_set.insert(mp.second[i]);
 
-            }
+            short_ost << mp.second[i]->state_name;
+            long_ost << mp.second[i]->state_name;
 
-            for (ParseAction a: state->action_multimap[mp.second])
+            if (i < mp.second.size() - 1)
             {
+                short_ost << " -> ";
+                long_ost << " -> ";
+            }
 
-                if (a.action_type == ParseActionType::ActionAccept)
-                {
-                    action = a;
-                }
+        }
 
-            }
+        short_ost << endl;
+        long_ost << endl;
 
-            for (ParseAction a: state->action_multimap[mp.second])
-            {
+    }
+    
+    short_ost << endl;
+    long_ost << endl;
 
-                if (a.action_type == ParseActionType::ActionShift)
-                {
-                    action = a;
-                }
+    for (State* state: state_list)
+    {
+        if (state_set.find(state) != state_set.end())
+        {
+            dump_state(state, long_ost, 4);
+        }
+    }
 
-            }
+    errh.add_error(ErrorType::ErrorReadsCycle,
+                   -1,
+                   short_ost.str(),
+                   long_ost.str());
 
-            state->action_multimap.erase(mp.second);
-            state->action_multimap[mp.second].insert(action);
+}
 
-        }
+//
+//  extend_lookaheads                                                       
+//  -----------------                                                       
+//                                                                         
+//  Fix up the parse actions adding lookahead states to resolve conflicts. 
+//  At the end of this process we should have no unexpected conflicts. If  
+//  we do we create an error message and if we don't we choose actions for 
+//  all the expected conflicts.                                            
+//
 
-    }
+void LalrGenerator::extend_lookaheads()
+{
+
+    set<State*> conflict_states;
+    set<StateSymbol> visited;
 
     //
-    //  We're down to a unique action per symbol so copy the action to a 
-    //  single-valued map.                                               
+    //  conflict_symbols                                                   
+    //  ----------------                                                   
+    //                                                                     
+    //  The symbols with more than one action in a state. Each one we      
+    //  resolve may add states, so we take them in symbol index order      
+    //  rather than pointer order to number the new states consistently.  
     //
 
-    for (State* state: state_list)
+    function<vector<Symbol*>(State*)> conflict_symbols =
+        [&](State* state) -> vector<Symbol*>
     {
 
+        vector<int64_t> index_list;
         for (auto mp: state->action_multimap)
         {
-            state->action_map[mp.first] = *mp.second.begin();
+            if (mp.second.size() >= 2)
+            {
+                index_list.push_back(symbol_index[mp.first]);
+            }
         }
 
-        state->action_multimap.clear();
+        sort(index_list.begin(), index_list.end());
 
-    }
+        vector<Symbol*> symbol_list;
+        for (int64_t index: index_list)
+        {
+            symbol_list.push_back(index_symbol[index]);
+        }
+
+        return symbol_list;
+
+    };
+
+    //
+    //  next_la                                                               
+    //  -------                                                               
+    //                                                                        
+    //  We are given a state which can read a symbol and we return the set of 
+    //  symbols that can come next.                                           
+    //
+
+    function<BitSet(StateStack&, Symbol*)> next_la =
+        [&](StateStack& stack, Symbol* symbol) -> BitSet
+    {
+
+        State* state = stack.get().back();
+        BitSet la;
+
+        State* goto_state = state->lr0_goto[symbol];
+        for (Item* item: goto_state->item_set.get())
+        {
+            la.insert_all(item->first_set);
+        }
+
+        for (Item* item: state->item_set.get())
+        {
+
+            if (item->dot >= item->rule->rhs.size())
+            {
+                continue;
+            }
+
+            if (item->rule->rhs[item->dot] != symbol)
+            {
+                continue;
+            }
+
+            if (!item->next->first_set.contains(epsilon_index))
+            {
+                continue;
+            }
+       
+            if (item->rule->lhs == gram.accept_symbol)
+            {
+                continue;
+            }
+
+            if (item->dot < stack.get().size())
+            {
+
+                StateStack next_stack = stack;
+                if (item->dot > 0)
+                {
+                    next_stack.get().erase(next_stack.get().end() - item->dot,
+                                           next_stack.get().end());
+                }
+
+                la.insert_all(next_la(next_stack, item->rule->lhs));
+
+            }
+            else
+            {
+
+                size_t distance = item->dot + 1 - stack.get().size();
+                compute_lookback(stack.get()[0], distance);
+
+                for (State* q: stack.get()[0]->lookback[distance])
+                {   
+                    compute_lhs_follow(q, item->rule->lhs);
+                    la.insert_all(q->lhs_follow[item->rule->lhs]);
+                }
+
+            }
+
+        }
+
+        la.erase(epsilon_index);
+
+        return la;
+
+    };
+
+    //
+    //  follow_sources                                                     
+    //  --------------                                                     
+    //                                                                     
+    //  Follow sources returns a set of configurations which can follow a  
+    //  given configuration after a transition on a symbol, some number of 
+    //  reductions, and finally shift a given terminal. It recursively     
+    //  looks back through the LR(0) automaton.                            
+    //
+
+    function<set<StateStack>(StateStack&, Symbol*, Symbol*)> follow_sources =
+        [&](StateStack& stack, Symbol* symbol, Symbol* terminal) -> set<StateStack>
+    {
+
+        State* state = stack.get().back();
+
+        //
+        //  If we've already visited this state then return. 
+        //
+
+        if (stack.get().size() == 1)
+        {
+
+            if (visited.find(StateSymbol(state, symbol)) !=
+                visited.end())
+            {
+                return set<StateStack>(); 
+            }
+            else
+            {
+                visited.insert(StateSymbol(state, symbol));
+            }
+
+        }
+
+        set<StateStack> stack_set;
+
+        //
+        //  If the terminal is in the direct read set then include it in 
+        //  the successor state.                                         
+        //
+
+        State* goto_state = state->lr0_goto[symbol];
+
+        if (goto_state->lr0_goto.find(terminal) != goto_state->lr0_goto.end())
+        {
+            StateStack next_stack = stack;
+            next_stack.get().push_back(goto_state);
+            stack_set.insert(next_stack);
+        }
+
+        //
+        //  Look for states and symbols in the reads relation and follow 
+        //  their sources.                                               
+        //
+
+        for (auto mp: goto_state->lr0_goto)
+        {
+
+            if (first_set[symbol_index[mp.first]].contains(epsilon_index))
+            {
+
+                StateStack next_stack = stack;
+                next_stack.get().push_back(goto_state);
+
+                for (auto s: follow_sources(next_stack, mp.first, terminal))
+                {
+                    stack_set.insert(s);
+                }
+
+            }
+
+        }
+
+        //
+        //  Look for situations where we're looking at the last symbol in 
+        //  a rule. When we find them we have to backtrack.               
+        //
+
+        for (Item* item: state->item_set.get())
+        {
+
+            if (item->dot != item->rule->rhs.size() - 1)
+            {
+                continue;
+            }
+
+            if (item->rule->rhs[item->dot] != symbol)
+            {
+                continue;
+            }
+
+            if (item->rule->lhs == gram.accept_symbol)
+            {
+                continue;
+            }
+
+            if (item->dot < stack.get().size())
+            {
+
+                StateStack next_stack = stack;
+                if (item->dot > 0)
+                {
+                    next_stack.get().erase(next_stack.get().end() - item->dot,
+                                           next_stack.get().end());
+                }
+
+                for (auto s: follow_sources(next_stack, item->rule->lhs, terminal))
+                {
+                    stack_set.insert(s);
+                }
+
+            }
+            else
+            {
+
+                size_t distance = item->dot + 1 - stack.get().size();
+                compute_lookback(stack.get()[0], distance);
+
+                for (State* q: stack.get()[0]->lookback[distance])
+                {
+
+                    StateStack temp_stack(q);
+
+                    for (auto s: follow_sources(temp_stack, item->rule->lhs, terminal))
+                    {
+                        stack_set.insert(s);
+                    }
+
+                }
+
+            }
+
+        }
+
+        return stack_set;
+
+    };
+
+    //
+    //  resolve_conflicts                                                      
+    //  -----------------                                                      
+    //                                                                         
+    //  Add a lookahead state then check whether we have to keep extending the 
+    //  lookahead string.                                                      
+    //
+
+    function<void(State*, Symbol*, map<ParseAction, set<StateStack>>, int)> resolve_conflicts =
+        [&](State* state,
+            Symbol* terminal,
+            map<ParseAction, set<StateStack>> sources,
+            int lookahead) -> void
+    {
+
+        //
+        //  If we've exceeded the max lookahead we have an unresolvable 
+        //  conflict.                                                   
+        //
+
+        if (lookahead > gram.max_lookaheads)
+        {
+            conflict_states.insert(state->lr0_state);
+            return;
+        }
+
+        //
+        //  Create a lookahead state. 
+        //
+
+        State* la_state = get_state();
+        la_state->lookback_one.insert(state);
+        la_state->lr0_state = state->lr0_state;
+        state->la_goto_map[terminal] = la_state;
+        la_state->la_symbol = terminal;
+
+        //
+        //  Find symbols which can be read in the lookahead state. 
+        //
+
+        for (auto mp: sources)
+        {
+            for (auto stack: mp.second)
+            {
+                for (int64_t index: next_la(stack, terminal))
+                {
+                    la_state->action_multimap[index_symbol[index]].insert(mp.first);
+                }
+            }
+        }
+
+        //
+        //  If we've still got conflicts we extend the automaton again. 
+        //
+
+        for (Symbol* symbol: conflict_symbols(la_state))
+        {
+
+            map<ParseAction, set<StateStack>> new_sources;
+            for (auto a: la_state->action_multimap[symbol])
+            {
+
+                for (auto stack: sources[a])
+                {
+
+                    visited.clear();
+                    for (auto s: follow_sources(stack, terminal, symbol))
+                    {
+                        new_sources[a].insert(s);
+                    }
+
+                }
+
+            }
+
+            resolve_conflicts(la_state, symbol, new_sources, lookahead + 1);
+
+        }
+
+    };
+    
+    //
+    //  extend_lookaheads                                                
+    //  -----------------                                                
+    //                                                                   
+    //  The function body begins here. Start by finding conflicts in the 
+    //  LALR(1) automaton.                                               
+    //
+
+    for (size_t i = 0; i < state_list.size(); i++)
+    {
+
+        State* state = state_list[i];
+
+        if (state->lr0_state != state)
+        {
+            continue;
+        }
+
+        for (Symbol* symbol: conflict_symbols(state))
+        {
+
+            map<ParseAction, set<StateStack>> sources;
+
+            for (ParseAction action: state->action_multimap[symbol])
+            {
+
+                if (action.action_type == ParseActionType::ActionShift)
+                {
+                    sources[action].insert(StateStack(state));
+                }    
+                else if (action.action_type == ParseActionType::ActionReduce)
+                {
+
+                    size_t distance = gram.rule_list[action.rule_num]->rhs.size();
+                    Symbol* lhs = gram.rule_list[action.rule_num]->lhs;
+
+                    compute_lookback(state, distance);
+                    for (State* p: state->lookback[distance])
+                    {
+
+                        visited.clear();
+                        StateStack temp_stack(p);
+
+                        for (auto s: follow_sources(temp_stack, lhs, symbol))
+                        {
+                            sources[action].insert(s);
+                        }
+
+                    }
+
+                }
+
+            }
+
+            resolve_conflicts(state, symbol, sources, 2);
+
+        }
+
+    }
+
+    //
+    //  If we still have conflicts and haven't predicted them in advance 
+    //  then format an error message.                                    
+    //
+
+    if (conflict_states.size() > gram.expected_conflicts)
+    {
+
+        ostringstream short_ost;
+        ostringstream long_ost;
+
+        short_ost << "The following state"
+                  << ((conflict_states.size() > 1) ? "s" : "")
+                  << " had conflicts: ";
+                  
+        long_ost << "The following state"
+                 << ((conflict_states.size() > 1) ? "s" : "")
+                 << " had conflicts" << endl << endl;
+                  
+        short_ost << "    ";
+
+        int count = conflict_states.size();
+        for (State* s: state_list)
+        {
+
+            if (conflict_states.find(s) == conflict_states.end())
+            {
+                continue;
+            }
+
+            short_ost << s->state_name;
+            count--;
+
+            if (count > 1)
+            {
+                short_ost << ", ";
+            }
+
+        }
+
+        short_ost << endl;
+
+        for (State* state: state_list)
+        {
+            if (conflict_states.find(state) != conflict_states.end())
+            {
+                dump_state(state, long_ost, 2);
+            }
+        }
+
+        errh.add_error(ErrorType::ErrorLalrConflict,
+                       -1,
+                       short_ost.str(),
+                       long_ost.str());
+
+        return;
+
+    }
+
+    //
+    //  Up to this point we kept LaShift actions in a parallel map in case 
+    //  our algorithms needed to access a conflict state. Now we replace   
+    //  the conflicts we were able to resolve with the LaShift actions.    
+    //
+
+    for (State* state: state_list)
+    {
+
+        for (auto mp: state->la_goto_map)
+        {
+
+            ParseAction action;
+            action.action_type = ParseActionType::ActionLaShift;
+            action.goto_state = mp.second->num;
+
+            state->action_multimap.erase(mp.first);
+            state->action_multimap[mp.first].insert(action);
+
+        }
+
+    }
+
+    //
+    //  Break conflicts in the sequence shift, accept, reduce with lowest rule 
+    //  number. This is kind of arbitrary. I hope it isn't used.               
+    //
+
+    for (State* state: conflict_states)
+    {
+
+        for (auto mp: gram.symbol_map)
+        {
+
+            if (state->action_multimap[mp.second].size() < 2)
+            {
+                continue;
+            }
+
+            ParseAction action;
+
+            int64_t rule_num = gram.rule_list.size() + 1;
+            for (ParseAction a: state->action_multimap[mp.second])
+            {
+
+                if (a.action_type == ParseActionType::ActionReduce &&    
+                    a.rule_num < rule_num)
+                {
+                    action = a;
+                    rule_num = a.rule_num;
+                }
+
+
+            }
+
+            for (ParseAction a: state->action_multimap[mp.second])
+            {
+
+                if (a.action_type == ParseActionType::ActionAccept)
+                {
+                    action = a;
+                }
+
+            }
+
+            for (ParseAction a: state->action_multimap[mp.second])
+            {
+
+                if (a.action_type == ParseActionType::ActionShift)
+                {
+                    action = a;
+                }
+
+            }
+
+            state->action_multimap.erase(mp.second);
+            state->action_multimap[mp.second].insert(action);
+
+        }
+
+    }
+
+    //
+    //  We're down to a unique action per symbol so copy the action to a 
+    //  single-valued map.                                               
+    //
+
+    for (State* state: state_list)
+    {
+
+        for (auto mp: state->action_multimap)
+        {
+            state->action_map[mp.first] = *mp.second.begin();
+        }
+
+        state->action_multimap.clear();
+
+    }
+
+}
+
+//
+//  add_error_recovery                                                     
+//  ------------------                                                     
+//                                                                         
+//  During error recovery we want to parse with a powerset automaton where 
+//  each state represents a set of LR(0) states. When an error is          
+//  discovered we enter the set of all LR(0) states. Then we parse by      
+//  considering the union of all the actions in the underlying states. If  
+//  they agree we perform the action. If they disagree we fall back to the 
+//  set of states which could be entered after parsing the next token.     
+//                                                                         
+//  All that is computed statically, here. We create recovery states that  
+//  represent sets of LR(0) states and augment reduce actions with those   
+//  states.                                                                
+//
+
+void LalrGenerator::add_error_recovery()
+{
+
+    //
+    //  find_after_shift                                                
+    //  ----------------                                                
+    //                                                                  
+    //  In recovery mode reduce actions might fail due to insufficient  
+    //  stack elements. In that case we want to restart in some set of  
+    //  states that *might* have been correct. Here we compute a set of 
+    //  states which we might go into after shifting the current token. 
+    //
+
+    function<void(void)> find_after_shift = [&](void) -> void
+    {
+
+        //
+        //  We're going to use a fixpoint algorithm. In the first phase we 
+        //  compute a `propagate_map' that describes how lookaheads flow   
+        //  around the automaton.                                          
+        //
+
+        map<StateSymbol, set<StateSymbol>> propagate_map;
+
+        for (State* state: state_list)
+        {
+
+            for (auto mp: state->action_map)
+            {
+        
+                Symbol* symbol = mp.first;
+                ParseAction action = mp.second;
+
+                switch (action.action_type)
+                {
+
+                    case ParseActionType::ActionLaShift:
+                    {
+
+                        if (state->lr0_state != state)
+                        {
+                            propagate_map[StateSymbol(state, symbol)].insert(
+                                StateSymbol(*state->lookback_one.begin(), state->la_symbol));
+                        }
+
+                        break;
+
+                    }
+
+                    case ParseActionType::ActionShift:
+                    {
+
+                        State* goto_state = state_list[action.goto_state];
+                        state->after_shift[symbol].insert(goto_state);
+
+                        if (state->lr0_state != state)
+                        {
+                            propagate_map[StateSymbol(state, symbol)].insert(
+                                StateSymbol(*state->lookback_one.begin(), state->la_symbol));
+                        }
+
+                        break;
+
+                    }
+
+                    case ParseActionType::ActionReduce:
+                    {
+
+                        Rule* rule = gram.rule_list[action.rule_num];
+
+                        Symbol* la_symbol = symbol;
+                        for (State* s = state;
+                             s != s->lr0_state;
+                             s = *s->lookback_one.begin())
+                        {
+                            la_symbol = s->la_symbol;
+                        }
+
+                        compute_lookback(state->lr0_state, rule->rhs.size());
+                        for (State* s: state->lr0_state->lookback[rule->rhs.size()])
+                        {
+
+                            ParseAction action = s->action_map[rule->lhs];
+                            State* goto_state = state_list[action.goto_state];
+
+                            propagate_map[StateSymbol(goto_state, la_symbol)].insert(
+                                StateSymbol(state, symbol));
+
+                            if (state->lr0_state != state)
+                            {
+                                propagate_map[StateSymbol(state, symbol)].insert(
+                                    StateSymbol(*state->lookback_one.begin(), state->la_symbol));
+                            }
+
+                        }
+
+                        break;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        //
+        //  Now we propagate states until the sets stabilize. 
+        //
+
+        set<StateSymbol> workpile;
+
+        for (auto mp: propagate_map)
+        {
+            workpile.insert(mp.first);
+        }
+
+        while (workpile.size() > 0)
+        {
+
+            StateSymbol source = *workpile.begin();
+            workpile.erase(source);
+
+            for (StateSymbol target: propagate_map[source])
+            {
+
+                for (State* state: source.state->after_shift[source.symbol])
+                {
+
+                    if (target.state->after_shift[target.symbol].find(state) ==
+                        target.state->after_shift[target.symbol].end())
+                    {
+                        target.state->after_shift[target.symbol].insert(state);
+                        workpile.insert(target);
+                    }
+
+                }
+
+            }
+
+        }
+                    
+    };
+
+    //
+    //  add_fallback_states                                              
+    //  -------------------                                              
+    //                                                                   
+    //  Add a powerset state for restarting and powerset states for each 
+    //  of the reduce actions.                                           
+    //
+
+    function<void(void)> add_fallback_states = [&](void) -> void
+    {
+
+        //
+        //  If a powerset state resolves to a single base state we can 
+        //  move back to the normal automaton.                         
+        //
+
+        for (State* state: state_list)
+        {
+            state->base_states.insert(state);
+            StateSet state_set(state->base_states);
+            state_set_map[state_set] = state;
+        }
+
+        //
+        //  Create a restart state which is the set of all LR(0) states. 
+        //
+
+        restart_state = get_state();
+
+        for (State* state: state_list)
+        {
+            if (state->lr0_state == state)
+            {
+                restart_state->base_states.insert(state);
+            }
+        }
+
+        StateSet state_set(restart_state->base_states);
+        state_set_map[state_set] = restart_state;
+
+        //
+        //  For each reduce action make a fallback state of the set of 
+        //  states which could be entered after shifting the symbol.   
+        //
+
+        for (State* state: state_list)
+        {
+            
+            vector<Symbol*> domain;
+            for (auto mp: state->action_map)
+            {
+                domain.push_back(mp.first);
+            }
+
+            sort(domain.begin(), domain.end(),
+                 [&](Symbol* left, Symbol* right) -> bool
+                 {
+                     return symbol_index[left] < symbol_index[right];
+                 });
+
+            for (Symbol* symbol: domain)
+            {
+          
+                ParseAction action = state->action_map[symbol];
+
+                if (action.action_type != ParseActionType::ActionReduce)
+                {
+                    continue;
+                }
+
+                StateSet state_set(state->after_shift[symbol]);
+                State* fallback_state = nullptr;
+
+                if (symbol == gram.eof_symbol)
+                {
+                    fallback_state = restart_state;
+                }
+                else if (state_set_map.find(state_set) != state_set_map.end())
+                {
+                    fallback_state = state_set_map[state_set];
+                }
+                else
+                {
+                    fallback_state = get_state();
+                    fallback_state->base_states = state_set.get();
+                    state_set_map[state_set] = fallback_state;
+                }
+
+                action.fallback_state = fallback_state->num;
+                state->action_map[symbol] = action;
+
+            }
+
+        }
+
+    };
+
+    //
+    //  expand_powerset_states                                           
+    //  ----------------------                                           
+    //                                                                   
+    //  For each powerset set create an action map. We have to merge the 
+    //  actions for each symbol and synthesize a new action.             
+    //
+
+    function<void(void)> expand_powerset_states = [&](void) -> void
+    {
+
+        //
+        //  ActionGroup                                                   
+        //  -----------                                                   
+        //                                                                
+        //  The actions of the base states of a powerset state on a single 
+        //  symbol, separated by type.                                     
+        //
+
+        struct ActionGroup
+        {
+            Symbol* symbol = nullptr;
+            set<State*> fallback_set;
+            set<ParseAction> shift_set;
+            set<ParseAction> reduce_set;
+            bool accept_found = false;
+        };
+
+        //
+        //  gather_actions                                                 
+        //  --------------                                                 
+        //                                                                 
+        //  Separate the actions of the base states by type. The base      
+        //  states are never powerset states themselves, so this only      
+        //  reads tables that are already complete and we can do it for    
+        //  many states at once.                                           
+        //
+
+        function<void(State*, vector<ActionGroup>&)> gather_actions =
+            [&](State* state, vector<ActionGroup>& group_list) -> void
+        {
+
+            for (auto mp: gram.symbol_map)
+            {
+
+                Symbol* symbol = mp.second;
+
+                ActionGroup group;
+                group.symbol = symbol;
+
+                for (State* base_state: state->base_states)
+                {
+                
+                    auto action_iter = base_state->action_map.find(symbol);
+                    if (action_iter == base_state->action_map.end())
+                    {
+                        continue;
+                    }
+
+                    ParseAction action = action_iter->second;
+                    auto shift_iter = base_state->after_shift.find(symbol);
+                    
+                    switch (action.action_type)
+                    {
+
+                        case ParseActionType::ActionLaShift:
+                        {
+                            
+                            if (shift_iter != base_state->after_shift.end())
+                            {
+                                for (State* s: shift_iter->second)
+                                {
+                                    group.fallback_set.insert(s);
+                                }
+                            }
+
+                            break;
+
+                        }
+
+                        case ParseActionType::ActionShift:
+                        {
+                             
+                            if (base_state->lr0_state == base_state)
+                            {
+                                group.shift_set.insert(action);
+                            }
+                            else
+                            {
+                                group.fallback_set.insert(state_list[action.goto_state]);
+                            }
+
+                            break;
+
+                        }
+
+                        case ParseActionType::ActionReduce:
+                        {
+
+                            if (base_state->lr0_state == base_state)
+                            {
+                                group.reduce_set.insert(action);
+                            }
+                            else
+                            {
+                                if (shift_iter != base_state->after_shift.end())
+                                {
+                                    for (State* s: shift_iter->second)
+                                    {
+                                        group.fallback_set.insert(s);
+                                    }
+                                }
+                            }
+
+                            break;
+
+                        }
+
+                        case ParseActionType::ActionGoto:
+                        {
+                            group.shift_set.insert(action);
+                            break;
+                        }
+
+                        case ParseActionType::ActionAccept:
+                        {           
+                            group.accept_found = true;
+                            break;
+                        }
+
+                    }
+
+                }
+
+                if (group.accept_found ||
+                    group.fallback_set.size() > 0 ||
+                    group.shift_set.size() > 0 ||
+                    group.reduce_set.size() > 0)
+                {
+                    group_list.push_back(group);
+                }
+
+            }
+
+        };
+
+        //
+        //  Expand the powerset states by merging action tables, possibly 
+        //  adding new states. At some point we will have processed all   
+        //  the states. We work in batches: gather the actions for all the 
+        //  states we have in parallel, then resolve them in order, which  
+        //  may create the next batch.                                     
+        //
+
+        int64_t first_num = restart_state->num;
+
+        while (first_num < state_list.size())
+        {
+
+            int64_t last_num = state_list.size();
+            vector<vector<ActionGroup>> group_lists(last_num - first_num);
+
+            pool.parallel_for(last_num - first_num, [&](int64_t i) -> void
+            {
+                gather_actions(state_list[first_num + i], group_lists[i]);
+            });
+
+            for (int64_t state_num = first_num; state_num < last_num; state_num++)
+            {
+
+                State* state = state_list[state_num];
+
+                for (ActionGroup& group: group_lists[state_num - first_num])
+                {
+
+                    Symbol* symbol = group.symbol;
+                    set<State*>& fallback_set = group.fallback_set;
+                    set<ParseAction>& shift_set = group.shift_set;
+                    set<ParseAction>& reduce_set = group.reduce_set;
+                    bool accept_found = group.accept_found;
+
+                    //
+                    //  Now we have to resolve the sets of actions into a single 
+                    //  action.                                                  
+                    //
+
+                    if (accept_found)
+                    {
+                        ParseAction action;
+                        action.action_type = ParseActionType::ActionAccept;
+                        state->action_map[symbol] = action;
+                        continue;
+                    }
+
+                    if (state == restart_state)
+                    {
+                        reduce_set.clear();
+                    }
+
+                    int total_size = shift_set.size() + reduce_set.size() + fallback_set.size();
+                
+                    if (total_size == 0)
+                    {
+                        continue;
+                    }
+
+                    //
+                    //  If all the actions are shift we can merge into a shift. 
+                    //
+
+                    if (shift_set.size() == total_size)
+                    {
+
+                        StateSet state_set;
+                        for (ParseAction action: shift_set)
+                        {
+                            state_set.get().insert(state_list[action.goto_state]);
+                        }
+
+                        State* goto_state = nullptr;
+                        if (state_set_map.find(state_set) == state_set_map.end())
+                        {
+                            goto_state = get_state();
+                            goto_state->base_states = state_set.get();
+                            state_set_map[state_set] = goto_state;
+                        }
+                        else
+                        {
+                            goto_state = state_set_map[state_set];
+                        }
+
+                        ParseAction action;
+       
+                        if (symbol->is_terminal)
+                        {
+                            action.action_type = ParseActionType::ActionShift;
+                        }
+                        else
+                        {
+                            action.action_type = ParseActionType::ActionGoto;
+                        }
+
+                        action.goto_state = goto_state->num;
+                        state->action_map[symbol] = action;
+
+                        continue;
+               
+                    }
+
+                    //
+                    //  If all the actions are reduce and by the same rule we can 
+                    //  merge them.                                               
+                    //
+
+                    if (reduce_set.size() == total_size)
+                    {
+
+                        set<int64_t> rule_num_set;
+                        StateSet state_set;
+
+                        for (ParseAction action: reduce_set)
+                        {
+                            rule_num_set.insert(action.rule_num);
+                            for (State* s: state_list[action.fallback_state]->base_states)
+                            {
+                                state_set.get().insert(s);
+                            }
+                        }
+
+                        if (rule_num_set.size() == 1)
+                        {
+
+                            State* fallback_state = nullptr;
+
+                            if (state_set_map.find(state_set) != state_set_map.end())
+                            {
+                                fallback_state = state_set_map[state_set];
+                            }
+                            else
+                            {
+                                fallback_state = get_state();
+                                fallback_state->base_states = state_set.get();
+                                state_set_map[state_set] = fallback_state;
+                            }
+                    
+                            ParseAction action;
+                            action.action_type = ParseActionType::ActionReduce;
+                            action.rule_num = *rule_num_set.begin();
+                            action.fallback_state = fallback_state->num;
+                            state->action_map[symbol] = action;
+
+                            continue;
+
+                        }
+
+                    }
+
+                    //
+                    //  We have an incompatible mixture. Merge them into a 
+                    //  restart.                                           
+                    //
+
+                    for (ParseAction action: shift_set)
+                    {
+                        fallback_set.insert(state_list[action.goto_state]);
+                    }
+
+                    for (ParseAction action: reduce_set)
+                    {
+                        for (State* s: state_list[action.fallback_state]->base_states)
+                        {
+                            fallback_set.insert(s);
+                        }
+                    }
+            
+                    StateSet state_set(fallback_set);
+
+                    if (state_set_map.find(state_set) == state_set_map.end())
+                    {
+                        State* state = get_state();
+                        state->base_states = state_set.get();
+                        state_set_map[state_set] = state;
+                    }
+
+                    ParseAction action;
+                    action.action_type = ParseActionType::ActionRestart;
+                    action.goto_state = state_set_map[state_set]->num;
+                    state->action_map[symbol] = action;
+
+                }
+
+            }
+
+            first_num = last_num;
+
+        }
+
+    };
+
+    //
+    //  add_error_recovery             
+    //  ------------------             
+    //                                 
+    //  The main function starts here. 
+    //
+
+    find_after_shift();
+    add_fallback_states();
+    expand_powerset_states();
 
 }
 
 //
-//  add_error_recovery                                                     
-//  ------------------                                                     
-//                                                                         
-//  During error recovery we want to parse with a powerset automaton where 
-//  each state represents a set of LR(0) states. When an error is          
-//  discovered we enter the set of all LR(0) states. Then we parse by      
-//  considering the union of all the actions in the underlying states. If  
-//  they agree we perform the action. If they disagree we fall back to the 
-//  set of states which could be entered after parsing the next token.     
+//  save_parser_data                                                       
+//  ----------------                                                       
 //                                                                         
-//  All that is computed statically, here. We create recovery states that  
-//  represent sets of LR(0) states and augment reduce actions with those   
-//  states.                                                                
+//  Take the graph form of parsing tables and flatten them into arrays.    
+//  The primary technique used here is attributed to Zeigler but described 
+//  pretty well by Tarjan and Yao. There are several layouts to choose     
+//  from (see TableSchemeType), selected by the table_scheme option.       
 //
 
-void LalrGenerator::add_error_recovery()
+void LalrGenerator::save_parser_data()
 {
 
     //
-    //  find_after_shift                                                
-    //  ----------------                                                
-    //                                                                  
-    //  In recovery mode reduce actions might fail due to insufficient  
-    //  stack elements. In that case we want to restart in some set of  
-    //  states that *might* have been correct. Here we compute a set of 
-    //  states which we might go into after shifting the current token. 
+    //  renumber_symbols                                                   
+    //  ----------------                                                   
+    //                                                                     
+    //  Assign each symbol a number to be used in the action table. We get 
+    //  better compression if the most-used symbols get lower symbol       
+    //  numbers.                                                           
     //
 
-    function<void(void)> find_after_shift = [&](void) -> void
+    function<void(void)> renumber_symbols = [&](void) -> void
     {
 
-        //
-        //  We're going to use a fixpoint algorithm. In the first phase we 
-        //  compute a `propagate_map' that describes how lookaheads flow   
-        //  around the automaton.                                          
-        //
-
-        map<StateSymbol, set<StateSymbol>> propagate_map;
-
+        map<Symbol*, int> action_count;
         for (State* state: state_list)
         {
 
             for (auto mp: state->action_map)
             {
-        
-                Symbol* symbol = mp.first;
-                ParseAction action = mp.second;
 
-                switch (action.action_type)
+                if (action_count.find(mp.first) == action_count.end())
                 {
+                    action_count[mp.first] = 0;
+                }
 
-                    case ParseActionType::ActionLaShift:
-                    {
+                action_count[mp.first] += 1;
 
-                        if (state->lr0_state != state)
-                        {
-                            propagate_map[StateSymbol(state, symbol)].insert(
-                                StateSymbol(*state->lookback_one.begin(), state->la_symbol));
-                        }
+            }
 
-                        break;
+        }
+       
+        vector<Symbol*> symbol_list;
+        for (auto mp: gram.symbol_map)
+        {
+            symbol_list.push_back(mp.second);
+        }
 
-                    }
+        sort(symbol_list.begin(), symbol_list.end(),
+             [&](Symbol* left, Symbol* right) -> bool
+             {
 
-                    case ParseActionType::ActionShift:
-                    {
+                 if (action_count.find(left) != action_count.end() &&
+                     action_count.find(right) == action_count.end())
+                 {
+                     return true;
+                 }
 
-                        State* goto_state = state_list[action.goto_state];
-                        state->after_shift[symbol].insert(goto_state);
+                 if (action_count.find(left) == action_count.end() &&
+                     action_count.find(right) != action_count.end())
+                 {
+                     return false;
+                 }
 
-                        if (state->lr0_state != state)
-                        {
-                            propagate_map[StateSymbol(state, symbol)].insert(
-                                StateSymbol(*state->lookback_one.begin(), state->la_symbol));
-                        }
+                 if (action_count.find(left) == action_count.end() ||
+                     action_count.find(right) == action_count.end())
+                 {
+                     return left->symbol_name < right->symbol_name;
+                 }
 
-                        break;
+                 if (left->is_terminal && !right->is_terminal)
+                 {
+                     return true;
+                 }
 
-                    }
+                 if (!left->is_terminal && right->is_terminal)
+                 {
+                     return false;
+                 }
 
-                    case ParseActionType::ActionReduce:
-                    {
+                 if (left->is_nonterminal && !right->is_nonterminal)
+                 {
+                     return true;
+                 }
 
-                        Rule* rule = gram.rule_list[action.rule_num];
+                 if (!left->is_nonterminal && right->is_nonterminal)
+                 {
+                     return false;
+                 }
 
-                        Symbol* la_symbol = symbol;
-                        for (State* s = state;
-                             s != s->lr0_state;
-                             s = *s->lookback_one.begin())
-                        {
-                            la_symbol = s->la_symbol;
-                        }
+                 if (!left->is_terminal && !left->is_nonterminal)
+                 {
+                     return left->symbol_name < right->symbol_name;
+                 }
 
-                        compute_lookback(state->lr0_state, rule->rhs.size());
-                        for (State* s: state->lr0_state->lookback[rule->rhs.size()])
-                        {
+                 return action_count[left] > action_count[right];
 
-                            ParseAction action = s->action_map[rule->lhs];
-                            State* goto_state = state_list[action.goto_state];
+             });
 
-                            propagate_map[StateSymbol(goto_state, la_symbol)].insert(
-                                StateSymbol(state, symbol));
+        for (int i = 0; i < symbol_list.size(); i++)
+        {
+            symbol_list[i]->symbol_num = i;
+        }
 
-                            if (state->lr0_state != state)
-                            {
-                                propagate_map[StateSymbol(state, symbol)].insert(
-                                    StateSymbol(*state->lookback_one.begin(), state->la_symbol));
-                            }
+    };
 
-                        }
+    //
+    //  allocate_bits                                                    
+    //  -------------                                                    
+    //                                                                   
+    //  Allocate a field into a set of data words. Return false if there 
+    //  isn't room.                                                      
+    //
+
+    auto allocate_bits =
+        [&](int* bits_used, int max_words, int bits_per_word,
+            int bits, int& offset, int64_t& mask, int& shift) -> bool
+    {
+
+        for (offset = 0;
+             offset < max_words && bits_used[offset] + bits > bits_per_word;
+             offset++);
+
+        if (offset >= max_words)
+        {
+            offset = 0;
+            mask = 0;
+            shift = 0;
+            return false;
+        }
+
+        mask = (static_cast<int64_t>(1) << bits) - 1;
+        shift = bits_used[offset];
+        bits_used[offset] += bits;
+
+        return true;
+
+    };
+
+    //
+    //  TableCandidate                                                     
+    //  --------------                                                     
+    //                                                                     
+    //  The parse table laid out in one of the table schemes, along with   
+    //  what it costs. We may build several of these and keep one.         
+    //
+
+    struct TableCandidate
+    {
+
+        TableSchemeType table_scheme = TableSchemeType::TableDisplacement;
+        string scheme_name;
+
+        int word_width = 64;
+        int num_offsets = 0;
+
+        int symbol_num_offset = 0;
+        int symbol_num_shift = 0;
+        int64_t symbol_num_mask = 0;
+
+        int action_type_offset = 0;
+        int action_type_shift = 0;
+        int64_t action_type_mask = 0;
+
+        int rule_num_offset = 0;
+        int rule_num_shift = 0;
+        int64_t rule_num_mask = 0;
+
+        int state_num_offset = 0;
+        int state_num_shift = 0;
+        int64_t state_num_mask = 0;
 
-                        break;
+        int fallback_num_offset = 0;
+        int fallback_num_shift = 0;
+        int64_t fallback_num_mask = 0;
 
-                    }
+        vector<int64_t> checked_index;
+        vector<int64_t> checked_data;
+        vector<int64_t> default_data;
 
-                }
+        int action_bitmap_width = 0;
+        vector<uint32_t> action_bitmap;
 
-            }
+        int64_t table_bytes = 0;
+        double lookup_cost = 0.0;
 
-        }
+    };
 
-        //
-        //  Now we propagate states until the sets stabilize. 
-        //
+    //
+    //  encode_entry                                                       
+    //  ------------                                                       
+    //                                                                     
+    //  Pack a single action into the words of an entry. The symbol number 
+    //  is only stored in schemes that check it.                           
+    //
 
-        set<StateSymbol> workpile;
+    function<void(TableCandidate&, int64_t*, Symbol*, const ParseAction&)> encode_entry =
+        [&](TableCandidate& cand, int64_t* entry, Symbol* symbol, const ParseAction& action) -> void
+    {
 
-        for (auto mp: propagate_map)
+        for (int i = 0; i < cand.num_offsets; i++)
         {
-            workpile.insert(mp.first);
+            entry[i] = 0;
         }
 
-        while (workpile.size() > 0)
+        if (cand.table_scheme == TableSchemeType::TableDisplacement ||
+            cand.table_scheme == TableSchemeType::TableDefaults)
         {
+            entry[cand.symbol_num_offset] |=
+                static_cast<int64_t>(symbol->symbol_num) << cand.symbol_num_shift;
+        }
 
-            StateSymbol source = *workpile.begin();
-            workpile.erase(source);
-
-            for (StateSymbol target: propagate_map[source])
-            {
-
-                for (State* state: source.state->after_shift[source.symbol])
-                {
+        entry[cand.action_type_offset] |=
+            static_cast<int64_t>(action.action_type) << cand.action_type_shift;
 
-                    if (target.state->after_shift[target.symbol].find(state) ==
-                        target.state->after_shift[target.symbol].end())
-                    {
-                        target.state->after_shift[target.symbol].insert(state);
-                        workpile.insert(target);
-                    }
+        if (action.rule_num >= 0)
+        {
+            entry[cand.rule_num_offset] |= action.rule_num << cand.rule_num_shift;
+        }
 
-                }
+        //
+        //  Reduce actions have a fallback state and everything else has a 
+        //  goto state, so these two can share bits.                       
+        //
 
-            }
+        if (action.goto_state >= 0)
+        {
+            entry[cand.state_num_offset] |= action.goto_state << cand.state_num_shift;
+        }
 
+        if (action.fallback_state >= 0)
+        {
+            entry[cand.fallback_num_offset] |= action.fallback_state << cand.fallback_num_shift;
         }
-                    
+
     };
 
     //
-    //  add_fallback_states                                              
-    //  -------------------                                              
-    //                                                                   
-    //  Add a powerset state for restarting and powerset states for each 
-    //  of the reduce actions.                                           
+    //  allocate_fields                                                    
+    //  ---------------                                                    
+    //                                                                     
+    //  Decide where each field of an action goes in a candidate's entries 
+    //  and how wide the words should be. We keep the sign bit of every    
+    //  word clear so -1 can mark an empty entry, and take the narrowest   
+    //  entry that holds everything, preferring fewer words on a tie.      
     //
 
-    function<void(void)> add_fallback_states = [&](void) -> void
+    function<void(TableCandidate&)> allocate_fields = [&](TableCandidate& cand) -> void
     {
 
+        bool use_check = cand.table_scheme == TableSchemeType::TableDisplacement ||
+                         cand.table_scheme == TableSchemeType::TableDefaults;
+
         //
-        //  If a powerset state resolves to a single base state we can 
-        //  move back to the normal automaton.                         
+        //  See how many bits we need for each field. 
         //
 
-        for (State* state: state_list)
-        {
-            state->base_states.insert(state);
-            StateSet state_set(state->base_states);
-            state_set_map[state_set] = state;
-        }
+        int64_t symbol_num_bits;
+        for (symbol_num_bits = 1;
+             1 << symbol_num_bits <= gram.symbol_map.size();
+             symbol_num_bits++);
+
+        int64_t action_type_bits;
+        for (action_type_bits = 1;
+             1 << action_type_bits <= ParseActionType::ActionError;
+             action_type_bits++);
+
+        int64_t state_num_bits;
+        for (state_num_bits = 1;
+             1 << state_num_bits <= state_list.size();
+             state_num_bits++);
+
+        int64_t rule_num_bits;
+        for (rule_num_bits = 1;
+             1 << rule_num_bits <= gram.rule_list.size();
+             rule_num_bits++);
 
         //
-        //  Create a restart state which is the set of all LR(0) states. 
+        //  Allocate the values we need into bit fields for each word 
+        //  width.                                                     
         //
 
-        restart_state = get_state();
+        static const int word_width_list[] = { 64, 32, 16 };
 
-        for (State* state: state_list)
+        TableCandidate best;
+        bool best_found = false;
+
+        for (int word_width: word_width_list)
         {
-            if (state->lr0_state == state)
-            {
-                restart_state->base_states.insert(state);
-            }
-        }
 
-        StateSet state_set(restart_state->base_states);
-        state_set_map[state_set] = restart_state;
+            TableCandidate trial = cand;
+            trial.word_width = word_width;
 
-        //
-        //  For each reduce action make a fallback state of the set of 
-        //  states which could be entered after shifting the symbol.   
-        //
+            int bits_used[8];
 
-        for (State* state: state_list)
-        {
-            
-            vector<Symbol*> domain;
-            for (auto mp: state->action_map)
+            for (int i = 0; i < LENGTH(bits_used); i++)
             {
-                domain.push_back(mp.first);
+                bits_used[i] = 0;
             }
+    
+            bool fits = true;
 
-            for (Symbol* symbol: domain)
+            if (use_check)
             {
-          
-                ParseAction action = state->action_map[symbol];
-
-                if (action.action_type != ParseActionType::ActionReduce)
-                {
-                    continue;
-                }
 
-                StateSet state_set(state->after_shift[symbol]);
-                State* fallback_state = nullptr;
+                fits = allocate_bits(bits_used,
+                                     LENGTH(bits_used),
+                                     word_width - 1,
+                                     symbol_num_bits,
+                                     trial.symbol_num_offset,
+                                     trial.symbol_num_mask,
+                                     trial.symbol_num_shift) && fits;
 
-                if (symbol == gram.eof_symbol)
-                {
-                    fallback_state = restart_state;
-                }
-                else if (state_set_map.find(state_set) != state_set_map.end())
-                {
-                    fallback_state = state_set_map[state_set];
-                }
-                else
-                {
-                    fallback_state = get_state();
-                    fallback_state->base_states = state_set.get();
-                    state_set_map[state_set] = fallback_state;
-                }
+            }
 
-                action.fallback_state = fallback_state->num;
-                state->action_map[symbol] = action;
+            fits = allocate_bits(bits_used,
+                                 LENGTH(bits_used),
+                                 word_width - 1,
+                                 action_type_bits,
+                                 trial.action_type_offset,
+                                 trial.action_type_mask,
+                                 trial.action_type_shift) && fits;
+
+            fits = allocate_bits(bits_used,
+                                 LENGTH(bits_used),
+                                 word_width - 1,
+                                 rule_num_bits,
+                                 trial.rule_num_offset,
+                                 trial.rule_num_mask,
+                                 trial.rule_num_shift) && fits;
+
+            fits = allocate_bits(bits_used,
+                                 LENGTH(bits_used),
+                                 word_width - 1,
+                                 state_num_bits,
+                                 trial.state_num_offset,
+                                 trial.state_num_mask,
+                                 trial.state_num_shift) && fits;
+
+            trial.fallback_num_offset = trial.state_num_offset;
+            trial.fallback_num_mask = trial.state_num_mask;
+            trial.fallback_num_shift = trial.state_num_shift;
+
+            for (trial.num_offsets = 0;
+                 trial.num_offsets < LENGTH(bits_used) && bits_used[trial.num_offsets] > 0;
+                 trial.num_offsets++);               
+
+            //
+            //  If even the widest words can't hold it we complain and keep 
+            //  going with what we have.                                    
+            //
+
+            if (!fits && word_width == 64)
+            {
+                errh.add_error(ErrorType::ErrorWordOverflow,
+                               -1,
+                               "Grammar too complex to encode.");
+            }
 
+            if (!best_found ||
+                (fits && trial.num_offsets * trial.word_width <
+                         best.num_offsets * best.word_width))
+            {
+                best = trial;
+                best_found = true;
             }
 
         }
 
+        cand = best;
+
     };
 
     //
-    //  expand_powerset_states                                           
-    //  ----------------------                                           
-    //                                                                   
-    //  For each powerset set create an action map. We have to merge the 
-    //  actions for each symbol and synthesize a new action.             
+    //  build_table                                                        
+    //  -----------                                                        
+    //                                                                     
+    //  Lay out the parse table in a candidate's scheme. Except for full   
+    //  tables we overlay the rows using the technique attributed to       
+    //  Zeigler, placing the states with the most actions first. This only 
+    //  reads the automaton so we can build several at once.               
     //
 
-    function<void(void)> expand_powerset_states = [&](void) -> void
+    int64_t symbol_count = gram.symbol_map.size();
+
+    function<void(TableCandidate&)> build_table = [&](TableCandidate& cand) -> void
     {
 
+        bool use_check = cand.table_scheme == TableSchemeType::TableDisplacement ||
+                         cand.table_scheme == TableSchemeType::TableDefaults;
+
+        bool use_bitmap = cand.table_scheme == TableSchemeType::TableDefaults ||
+                          cand.table_scheme == TableSchemeType::TableComb;
+
         //
-        //  Expand the powerset states by merging action tables, possibly 
-        //  adding new states. At some point we will have processed all   
-        //  the states.                                                   
+        //  The bitmap has a bit for each symbol that has an action in a 
+        //  state.                                                        
         //
 
-        for (int state_num = restart_state->num;
-             state_num < state_list.size();
-             state_num++)
+        if (use_bitmap)
         {
 
-            State* state = state_list[state_num];
+            cand.action_bitmap_width = (symbol_count + 31) / 32;
+            cand.action_bitmap.assign(state_list.size() * cand.action_bitmap_width, 0);
 
-            for (auto mp: gram.symbol_map)
+            for (State* state: state_list)
             {
 
-                Symbol* symbol = mp.second;
+                for (auto mp: state->action_map)
+                {
+                    cand.action_bitmap[state->num * cand.action_bitmap_width +
+                                       mp.first->symbol_num / 32] |=
+                        1u << (mp.first->symbol_num % 32);
+                }
 
-                //
-                //  Separate the actions by type. 
-                //
+            }
 
-                set<State*> fallback_set;
-                set<ParseAction> shift_set;
-                set<ParseAction> reduce_set;
-                bool accept_found = false;
+        }
 
-                for (State* base_state: state->base_states)
+        //
+        //  Find the symbols we have to place for each state. With default 
+        //  actions we take the most common action out of the row, as long 
+        //  as that saves something.                                       
+        //
+
+        vector<vector<Symbol*>> row_list(state_list.size());
+
+        if (cand.table_scheme == TableSchemeType::TableDefaults)
+        {
+            cand.default_data.assign(state_list.size() * cand.num_offsets, -1);
+        }
+
+        for (State* state: state_list)
+        {
+
+            vector<Symbol*>& row = row_list[state->num];
+
+            ParseAction default_action;
+            bool default_found = false;
+
+            if (cand.table_scheme == TableSchemeType::TableDefaults)
+            {
+
+                map<ParseAction, int> action_count;
+                for (auto mp: state->action_map)
                 {
-                
-                    if (base_state->action_map.find(symbol) == base_state->action_map.end())
+                    action_count[mp.second]++;
+                }
+
+                int max_count = 1;
+                for (auto mp: action_count)
+                {
+
+                    if (mp.second > max_count)
                     {
-                        continue;
+                        default_action = mp.first;
+                        default_found = true;
+                        max_count = mp.second;
                     }
 
-                    ParseAction action = base_state->action_map[symbol];
-                    
-                    switch (action.action_type)
-                    {
+                }
 
-                        case ParseActionType::ActionLaShift:
-                        {
-                            
-                            for (State* s: base_state->after_shift[symbol])
-                            {
-                                fallback_set.insert(s);
-                            }
+            }
 
-                            break;
+            for (auto mp: state->action_map)
+            {
 
-                        }
+                if (default_found && mp.second == default_action)
+                {
 
-                        case ParseActionType::ActionShift:
-                        {
-                             
-                            if (base_state->lr0_state == base_state)
-                            {
-                                shift_set.insert(action);
-                            }
-                            else
-                            {
-                                fallback_set.insert(state_list[action.goto_state]);
-                            }
+                    encode_entry(cand,
+                                 cand.default_data.data() + state->num * cand.num_offsets,
+                                 mp.first,
+                                 mp.second);
 
-                            break;
+                    continue;
 
-                        }
+                }
 
-                        case ParseActionType::ActionReduce:
-                        {
+                row.push_back(mp.first);
 
-                            if (base_state->lr0_state == base_state)
-                            {
-                                reduce_set.insert(action);
-                            }
-                            else
-                            {
-                                for (State* s: base_state->after_shift[symbol])
-                                {
-                                    fallback_set.insert(s);
-                                }
-                            }
+            }
 
-                            break;
+            sort(row.begin(), row.end(),
+                 [](Symbol* left, Symbol* right) -> bool
+                 {
+                     return left->symbol_num < right->symbol_num;
+                 });  
 
-                        }
+        }
 
-                        case ParseActionType::ActionGoto:
-                        {
-                            shift_set.insert(action);
-                            break;
-                        }
+        //
+        //  A full table just needs one row after another. 
+        //
 
-                        case ParseActionType::ActionAccept:
-                        {           
-                            accept_found = true;
-                            break;
-                        }
+        cand.checked_index.assign(state_list.size(), -1);
 
-                    }
+        if (cand.table_scheme == TableSchemeType::TableFull)
+        {
 
-                }
+            cand.checked_data.assign(state_list.size() * symbol_count * cand.num_offsets, -1);
 
-                //
-                //  Now we have to resolve the sets of actions into a single 
-                //  action.                                                  
-                //
+            for (State* state: state_list)
+            {
 
-                if (accept_found)
-                {
-                    ParseAction action;
-                    action.action_type = ParseActionType::ActionAccept;
-                    state->action_map[symbol] = action;
-                    continue;
-                }
+                cand.checked_index[state->num] = state->num * symbol_count * cand.num_offsets;
 
-                if (state == restart_state)
+                for (Symbol* symbol: row_list[state->num])
                 {
-                    reduce_set.clear();
-                }
 
-                int total_size = shift_set.size() + reduce_set.size() + fallback_set.size();
-                
-                if (total_size == 0)
-                {
-                    continue;
+                    encode_entry(cand,
+                                 cand.checked_data.data() + cand.checked_index[state->num] +
+                                     symbol->symbol_num * cand.num_offsets,
+                                 symbol,
+                                 state->action_map.find(symbol)->second);
+
                 }
 
-                //
-                //  If all the actions are shift we can merge into a shift. 
-                //
+            }
 
-                if (shift_set.size() == total_size)
-                {
+        }
 
-                    StateSet state_set;
-                    for (ParseAction action: shift_set)
-                    {
-                        state_set.get().insert(state_list[action.goto_state]);
-                    }
+        //
+        //  Otherwise we would like to place states in descending order by 
+        //  the number of actions.                                         
+        //
 
-                    State* goto_state = nullptr;
-                    if (state_set_map.find(state_set) == state_set_map.end())
-                    {
-                        goto_state = get_state();
-                        goto_state->base_states = state_set.get();
-                        state_set_map[state_set] = goto_state;
-                    }
-                    else
-                    {
-                        goto_state = state_set_map[state_set];
-                    }
+        else
+        {
 
-                    ParseAction action;
-       
-                    if (symbol->is_terminal)
-                    {
-                        action.action_type = ParseActionType::ActionShift;
-                    }
-                    else
-                    {
-                        action.action_type = ParseActionType::ActionGoto;
-                    }
+            vector<State*> desc_state_list;
+            for (State* state: state_list)
+            {
+                desc_state_list.push_back(state);
+            }
+
+            sort(desc_state_list.begin(), desc_state_list.end(),
+                 [&](State* left, State* right) -> bool
+                 {
+                     return row_list[left->num].size() > row_list[right->num].size();
+                 });
+
+            //
+            //  We track free entries with a union-find structure so the   
+            //  search can skip over runs of entries that are taken. Entry 
+            //  e is free if next_free[e] == e, and everything past the end 
+            //  is free.                                                   
+            //
+
+            vector<int64_t> next_free;
+            vector<bool> used_start;
+            int64_t first_unused = 0;
+
+            function<int64_t(int64_t)> find_free = [&](int64_t e) -> int64_t
+            {
 
-                    action.goto_state = goto_state->num;
-                    state->action_map[symbol] = action;
+                int64_t root = e;
+                while (root < next_free.size() && next_free[root] != root)
+                {
+                    root = next_free[root];
+                }
 
-                    continue;
-               
+                while (e < next_free.size() && next_free[e] != e)
+                {
+                    int64_t next = next_free[e];
+                    next_free[e] = root;
+                    e = next;
                 }
 
+                return root;
+
+            };
+
+            for (State* state: desc_state_list)
+            {
+
+                vector<Symbol*>& row = row_list[state->num];
+
                 //
-                //  If all the actions are reduce and by the same rule we can 
-                //  merge them.                                               
+                //  Find the first offset where the row fits. Checked rows 
+                //  must start at distinct offsets or two states could     
+                //  claim the same entry.                                   
                 //
 
-                if (reduce_set.size() == total_size)
+                int64_t base = (use_check) ? first_unused : 0;
+
+                while (row.size() > 0)
                 {
 
-                    set<int64_t> rule_num_set;
-                    StateSet state_set;
+                    base = find_free(base + row[0]->symbol_num) - row[0]->symbol_num;
 
-                    for (ParseAction action: reduce_set)
+                    if (use_check && base < used_start.size() && used_start[base])
                     {
-                        rule_num_set.insert(action.rule_num);
-                        for (State* s: state_list[action.fallback_state]->base_states)
-                        {
-                            state_set.get().insert(s);
-                        }
+                        base++;
+                        continue;
                     }
 
-                    if (rule_num_set.size() == 1)
-                    {
+                    bool found = true;
 
-                        State* fallback_state = nullptr;
+                    for (Symbol* symbol: row)
+                    {
 
-                        if (state_set_map.find(state_set) != state_set_map.end())
+                        if (base + symbol->symbol_num >= next_free.size())
                         {
-                            fallback_state = state_set_map[state_set];
+                            break;
                         }
-                        else
+
+                        if (next_free[base + symbol->symbol_num] != base + symbol->symbol_num)
                         {
-                            fallback_state = get_state();
-                            fallback_state->base_states = state_set.get();
-                            state_set_map[state_set] = fallback_state;
+                            found = false;
+                            break;
                         }
-                    
-                        ParseAction action;
-                        action.action_type = ParseActionType::ActionReduce;
-                        action.rule_num = *rule_num_set.begin();
-                        action.fallback_state = fallback_state->num;
-                        state->action_map[symbol] = action;
 
-                        continue;
+                    }
 
+                    if (found)
+                    {
+                        break;
                     }
 
+                    base++;
+
                 }
 
-                //
-                //  We have an incompatible mixture. Merge them into a 
-                //  restart.                                           
-                //
+                cand.checked_index[state->num] = base * cand.num_offsets;
 
-                for (ParseAction action: shift_set)
+                if (use_check)
                 {
-                    fallback_set.insert(state_list[action.goto_state]);
-                }
 
-                for (ParseAction action: reduce_set)
-                {
-                    for (State* s: state_list[action.fallback_state]->base_states)
+                    if (used_start.size() <= base)
                     {
-                        fallback_set.insert(s);
+                        used_start.resize(base + 1, false);
                     }
-                }
-            
-                StateSet state_set(fallback_set);
-
-                if (state_set_map.find(state_set) == state_set_map.end())
-                {
-                    State* state = get_state();
-                    state->base_states = state_set.get();
-                    state_set_map[state_set] = state;
-                }
-
-                ParseAction action;
-                action.action_type = ParseActionType::ActionRestart;
-                action.goto_state = state_set_map[state_set]->num;
-                state->action_map[symbol] = action;
-
-            }
-                
-        }
-
-    };
-
-    //
-    //  add_error_recovery             
-    //  ------------------             
-    //                                 
-    //  The main function starts here. 
-    //
-
-    find_after_shift();
-    add_fallback_states();
-    expand_powerset_states();
-
-}
-
-//
-//  save_parser_data                                                       
-//  ----------------                                                       
-//                                                                         
-//  Take the graph form of parsing tables and flatten them into arrays.    
-//  The primary technique used here is attributed to Zeigler but described 
-//  pretty well by Tarjan and Yao.                                         
-//
 
-void LalrGenerator::save_parser_data()
-{
+                    used_start[base] = true;
 
-    //
-    //  renumber_symbols                                                   
-    //  ----------------                                                   
-    //                                                                     
-    //  Assign each symbol a number to be used in the action table. We get 
-    //  better compression if the most-used symbols get lower symbol       
-    //  numbers.                                                           
-    //
+                    while (first_unused < used_start.size() && used_start[first_unused])
+                    {
+                        first_unused++;
+                    }
 
-    function<void(void)> renumber_symbols = [&](void) -> void
-    {
+                }
 
-        map<Symbol*, int> action_count;
-        for (State* state: state_list)
-        {
+                //
+                //  Extend the checked information to handle this row. If we 
+                //  check entries any symbol might be looked up, otherwise   
+                //  the bitmap keeps us inside the row.                      
+                //
 
-            for (auto mp: state->action_map)
-            {
+                int64_t row_end = cand.checked_index[state->num];
 
-                if (action_count.find(mp.first) == action_count.end())
+                if (use_check)
                 {
-                    action_count[mp.first] = 0;
+                    row_end += symbol_count * cand.num_offsets + 1;
+                }
+                else if (row.size() > 0)
+                {
+                    row_end += (row.back()->symbol_num + 1) * cand.num_offsets;
                 }
 
-                action_count[mp.first] += 1;
+                if (cand.checked_data.size() < row_end)
+                {
 
-            }
+                    cand.checked_data.resize(row_end, -1);
 
-        }
-       
-        vector<Symbol*> symbol_list;
-        for (auto mp: gram.symbol_map)
-        {
-            symbol_list.push_back(mp.second);
-        }
+                    while (next_free.size() < (row_end + cand.num_offsets - 1) / cand.num_offsets)
+                    {
+                        next_free.push_back(next_free.size());
+                    }
 
-        sort(symbol_list.begin(), symbol_list.end(),
-             [&](Symbol* left, Symbol* right) -> bool
-             {
+                }
 
-                 if (action_count.find(left) != action_count.end() &&
-                     action_count.find(right) == action_count.end())
-                 {
-                     return true;
-                 }
+                //
+                //  Encode each action into checked information. 
+                //
 
-                 if (action_count.find(left) == action_count.end() &&
-                     action_count.find(right) != action_count.end())
-                 {
-                     return false;
-                 }
+                for (Symbol* symbol: row)
+                {
 
-                 if (action_count.find(left) == action_count.end() ||
-                     action_count.find(right) == action_count.end())
-                 {
-                     return left < right;
-                 }
+                    encode_entry(cand,
+                                 cand.checked_data.data() + cand.checked_index[state->num] +
+                                     symbol->symbol_num * cand.num_offsets,
+                                 symbol,
+                                 state->action_map.find(symbol)->second);
 
-                 if (left->is_terminal && !right->is_terminal)
-                 {
-                     return true;
-                 }
+                    next_free[base + symbol->symbol_num] = base + symbol->symbol_num + 1;
 
-                 if (!left->is_terminal && right->is_terminal)
-                 {
-                     return false;
-                 }
+                }
 
-                 if (left->is_nonterminal && !right->is_nonterminal)
-                 {
-                     return true;
-                 }
+            }
 
-                 if (!left->is_nonterminal && right->is_nonterminal)
-                 {
-                     return false;
-                 }
+        }
 
-                 if (!left->is_terminal && !left->is_nonterminal)
-                 {
-                     return left < right;
-                 }
+        //
+        //  Figure out what this costs. The lookup cost is the number of  
+        //  dependent reads to find an action, averaged over the actions. 
+        //
 
-                 return action_count[left] > action_count[right];
+        cand.table_bytes = cand.checked_index.size() * sizeof(int64_t) +
+                           (cand.checked_data.size() + cand.default_data.size()) *
+                               cand.word_width / CHAR_BIT +
+                           cand.action_bitmap.size() * sizeof(uint32_t);
 
-             });
+        int64_t action_count = 0;
+        int64_t default_count = 0;
 
-        for (int i = 0; i < symbol_list.size(); i++)
+        for (State* state: state_list)
         {
-            symbol_list[i]->symbol_num = i;
+            action_count += state->action_map.size();
+            default_count += state->action_map.size() - row_list[state->num].size();
         }
 
-    };
-
-    //
-    //  allocate_bits                              
-    //  -------------                              
-    //                                             
-    //  Allocate a field into a set of data words. 
-    //
-
-    auto allocate_bits =
-        [&](int* bits_used, int max_words, int bits, int& offset, int64_t& mask, int& shift) -> void
-    {
-
-        const int bits_per_word = sizeof(int64_t) * CHAR_BIT;
-
-        for (offset = 0;
-             offset < max_words && bits_used[offset] + bits > bits_per_word;
-             offset++);
+        cand.lookup_cost = (use_bitmap) ? 3.0 : 2.0;
 
-        if (offset >= max_words)
+        if (action_count > 0)
         {
-            errh.add_error(ErrorType::ErrorWordOverflow,
-                           -1,
-                           "Grammar too complex to encode.");
-            offset = 0;
+            cand.lookup_cost += static_cast<double>(default_count) / action_count;
         }
 
-        mask = (1 << bits) - 1;
-        shift = bits_used[offset];
-        bits_used[offset] += bits;
-
     };
 
     //
@@ -2667,232 +3951,156 @@ void LalrGenerator::save_parser_data()
 
     renumber_symbols();
 
+    prsd.start_state = start_state->num;
+    prsd.restart_state = restart_state->num;
+
     //
-    //  See how many bits we need for each field. 
+    //  Build the table in each scheme we're considering. 
     //
 
-    int64_t symbol_num_bits;
-    for (symbol_num_bits = 1;
-         1 << symbol_num_bits <= gram.symbol_map.size();
-         symbol_num_bits++);
+    vector<TableCandidate> candidate_list;
 
-    int64_t action_type_bits;
-    for (action_type_bits = 1;
-         1 << action_type_bits <= ParseActionType::ActionError;
-         action_type_bits++);
+    auto add_candidate = [&](TableSchemeType table_scheme, const string& scheme_name) -> void
+    {
 
-    int64_t state_num_bits;
-    for (state_num_bits = 1;
-         1 << state_num_bits <= state_list.size();
-         state_num_bits++);
+        if (gram.table_scheme != "auto" && gram.table_scheme != scheme_name)
+        {
+            return;
+        }
 
-    int64_t rule_num_bits;
-    for (rule_num_bits = 1;
-         1 << rule_num_bits <= gram.rule_list.size();
-         rule_num_bits++);
+        candidate_list.push_back(TableCandidate());
+        candidate_list.back().table_scheme = table_scheme;
+        candidate_list.back().scheme_name = scheme_name;
 
-    //
-    //  Allocate the values we need into bit fields. 
-    //
+    };
 
-    prsd.start_state = start_state->num;
-    prsd.restart_state = restart_state->num;
-    prsd.num_offsets = 0;
-    int bits_used[8];
+    add_candidate(TableSchemeType::TableDisplacement, "displacement");
+    add_candidate(TableSchemeType::TableDefaults, "defaults");
+    add_candidate(TableSchemeType::TableComb, "comb");
+    add_candidate(TableSchemeType::TableFull, "full");
 
-    for (int i = 0; i < LENGTH(bits_used); i++)
+    for (TableCandidate& cand: candidate_list)
     {
-        bits_used[i] = 0;
+        allocate_fields(cand);
     }
-    
-    allocate_bits(bits_used,
-                  LENGTH(bits_used),
-                  symbol_num_bits,
-                  prsd.symbol_num_offset,
-                  prsd.symbol_num_mask,
-                  prsd.symbol_num_shift);
-
-    allocate_bits(bits_used,
-                  LENGTH(bits_used),
-                  action_type_bits,
-                  prsd.action_type_offset,
-                  prsd.action_type_mask,
-                  prsd.action_type_shift);
-
-    allocate_bits(bits_used,
-                  LENGTH(bits_used),
-                  rule_num_bits,
-                  prsd.rule_num_offset,
-                  prsd.rule_num_mask,
-                  prsd.rule_num_shift);
-
-    allocate_bits(bits_used,
-                  LENGTH(bits_used),
-                  state_num_bits,
-                  prsd.state_num_offset,
-                  prsd.state_num_mask,
-                  prsd.state_num_shift);
-
-    allocate_bits(bits_used,
-                  LENGTH(bits_used),
-                  state_num_bits,
-                  prsd.fallback_num_offset,
-                  prsd.fallback_num_mask,
-                  prsd.fallback_num_shift);
-
-    for (prsd.num_offsets = 0;
-         prsd.num_offsets < LENGTH(bits_used) && bits_used[prsd.num_offsets] > 0;
-         prsd.num_offsets++);               
-
-    //
-    //  We would like to place states in descending order by the number of 
-    //  actions.                                                           
-    //
-
-    vector<State*> desc_state_list;
-    for (State* state: state_list)
+
+    pool.parallel_for(candidate_list.size(), [&](int64_t i) -> void
     {
-        desc_state_list.push_back(state);
-    }
+        build_table(candidate_list[i]);
+    });
+
+    //
+    //  Choose one. A full table is cheapest to use so we take it if it's  
+    //  small. Otherwise we want the smallest table, unless one that isn't 
+    //  much bigger is cheaper to use.                                     
+    //
 
-    sort(desc_state_list.begin(), desc_state_list.end(),
-         [](State* left, State* right) -> bool
-         {
-             return left->action_map.size() > right->action_map.size();
-         });
+    static const int64_t small_table_bytes = 32768;
 
-    set<int64_t> used_indices;
-    vector<int64_t> checked_data;
-    vector<int64_t> checked_index(desc_state_list.size(), -1);
+    TableCandidate* chosen = nullptr;
 
-    for (State* state: desc_state_list)
+    for (TableCandidate& cand: candidate_list)
     {
 
-        vector<Symbol*> symbol_list;
-        for (auto mp: state->action_map)
+        if (cand.table_scheme == TableSchemeType::TableFull &&
+            cand.table_bytes <= small_table_bytes)
         {
-            symbol_list.push_back(mp.first);
+            chosen = &cand;
+            break;
         }
 
-        sort(symbol_list.begin(), symbol_list.end(),
-             [](Symbol* left, Symbol* right) -> bool
-             {
-                 return left->symbol_num < right->symbol_num;
-             });  
+        if (chosen == nullptr || cand.table_bytes < chosen->table_bytes)
+        {
+            chosen = &cand;
+        }
 
-        //
-        //  Find an unused offset into checked information. 
-        //
+    }
 
-        for (int64_t i = 0; ; i+= prsd.num_offsets)
+    for (TableCandidate& cand: candidate_list)
+    {
+
+        if (cand.lookup_cost < chosen->lookup_cost &&
+            cand.table_bytes * 4 <= chosen->table_bytes * 5)
         {
+            chosen = &cand;
+        }
 
-            if (used_indices.find(i) != used_indices.end())
-            {
-                continue;
-            }
+    }
 
-            bool found = true;
+    if ((debug_flags & DebugType::DebugProgress) != 0)
+    {
 
-            for (Symbol* symbol: symbol_list)
-            {
+        for (TableCandidate& cand: candidate_list)
+        {
+            cout << "Parse table scheme " << cand.scheme_name << ": "
+                 << cand.table_bytes << " bytes in "
+                 << cand.word_width << " bit words, "
+                 << fixed << setprecision(2) << cand.lookup_cost
+                 << setprecision(6) << defaultfloat
+                 << " reads per lookup"
+                 << ((&cand == chosen) ? " (chosen)" : "")
+                 << endl;
+        }
 
-                if (i + symbol->symbol_num * prsd.num_offsets >= checked_data.size())
-                {
-                    break;
-                }
+    }
 
-                if (checked_data[i + symbol->symbol_num * prsd.num_offsets] >= 0)
-                {
-                    found = false;
-                    break;
-                }
+    //
+    //  Save the one we chose. 
+    //
 
-            }
+    prsd.table_scheme = chosen->table_scheme;
+    prsd.num_offsets = chosen->num_offsets;
 
-            if (found)
-            {
-                checked_index[state->num] = i;
-                used_indices.insert(i);
-                break;
-            }
+    prsd.symbol_num_offset = chosen->symbol_num_offset;
+    prsd.symbol_num_shift = chosen->symbol_num_shift;
+    prsd.symbol_num_mask = chosen->symbol_num_mask;
 
-        }
+    prsd.action_type_offset = chosen->action_type_offset;
+    prsd.action_type_shift = chosen->action_type_shift;
+    prsd.action_type_mask = chosen->action_type_mask;
 
-        //
-        //  Extend the checked information to handle this row. 
-        //
+    prsd.rule_num_offset = chosen->rule_num_offset;
+    prsd.rule_num_shift = chosen->rule_num_shift;
+    prsd.rule_num_mask = chosen->rule_num_mask;
 
-        while (checked_data.size() <= checked_index[state->num] +
-                                      gram.symbol_map.size() * prsd.num_offsets)
-        {
-            checked_data.push_back(-1);
-        }
+    prsd.state_num_offset = chosen->state_num_offset;
+    prsd.state_num_shift = chosen->state_num_shift;
+    prsd.state_num_mask = chosen->state_num_mask;
 
-        //
-        //  Encode each action into checked information. 
-        //
+    prsd.fallback_num_offset = chosen->fallback_num_offset;
+    prsd.fallback_num_shift = chosen->fallback_num_shift;
+    prsd.fallback_num_mask = chosen->fallback_num_mask;
 
-        for (Symbol* symbol: symbol_list)
-        {
+    prsd.word_width = chosen->word_width;
 
-            ParseAction action = state->action_map[symbol];
-          
-            for (int i = 0; i < prsd.num_offsets; i++)
-            {
-                checked_data[checked_index[state->num] +
-                             symbol->symbol_num * prsd.num_offsets + i] = 0;
-            }
+    prsd.checked_data_count = chosen->checked_data.size();
+    prsd.checked_data = ParserData::new_table_words(prsd.word_width, prsd.checked_data_count);
 
-            checked_data[checked_index[state->num] +
-                         symbol->symbol_num * prsd.num_offsets +
-                         prsd.symbol_num_offset] |=
-                             symbol->symbol_num << prsd.symbol_num_shift;
-                            
-            checked_data[checked_index[state->num] +
-                         symbol->symbol_num * prsd.num_offsets +
-                         prsd.action_type_offset] |=
-                             action.action_type << prsd.action_type_shift;
-                            
-            if (action.rule_num >= 0)
-            {
-                checked_data[checked_index[state->num] +
-                             symbol->symbol_num * prsd.num_offsets +
-                             prsd.rule_num_offset] |=
-                                 action.rule_num << prsd.rule_num_shift;
-            }
-                            
-            if (action.goto_state >= 0)
-            {
-                checked_data[checked_index[state->num] +
-                             symbol->symbol_num * prsd.num_offsets +
-                             prsd.state_num_offset] |=
-                                 action.goto_state << prsd.state_num_shift;
-            }
+    for (int i = 0; i < prsd.checked_data_count; i++)
+    {
+        ParserData::set_table_word(prsd.word_width, prsd.checked_data, i, chosen->checked_data[i]);
+    }
 
-            if (action.fallback_state >= 0)
-            {
-                checked_data[checked_index[state->num] +
-                             symbol->symbol_num * prsd.num_offsets +
-                             prsd.fallback_num_offset] |=
-                                 action.fallback_state << prsd.fallback_num_shift;
-            }
+    prsd.checked_index_count = chosen->checked_index.size();
+    prsd.checked_index = new int64_t[chosen->checked_index.size()];
+    memcpy(static_cast<void *>(prsd.checked_index),
+           static_cast<void *>(chosen->checked_index.data()),
+           chosen->checked_index.size() * sizeof(int64_t));
 
-        }
+    prsd.default_data_count = chosen->default_data.size();
+    prsd.default_data = ParserData::new_table_words(prsd.word_width, prsd.default_data_count);
 
+    for (int i = 0; i < prsd.default_data_count; i++)
+    {
+        ParserData::set_table_word(prsd.word_width, prsd.default_data, i, chosen->default_data[i]);
     }
 
-    prsd.checked_data_count = checked_data.size();
-    prsd.checked_data = new int64_t[checked_data.size()];
-    memcpy(static_cast<void *>(prsd.checked_data),
-           static_cast<void *>(checked_data.data()),
-           checked_data.size() * sizeof(int64_t));
-
-    prsd.checked_index_count = checked_index.size();
-    prsd.checked_index = new int64_t[checked_index.size()];
-    memcpy(static_cast<void *>(prsd.checked_index),
-           static_cast<void *>(checked_index.data()),
-           checked_index.size() * sizeof(int64_t));
+    prsd.action_bitmap_width = chosen->action_bitmap_width;
+    prsd.action_bitmap_count = chosen->action_bitmap.size();
+    prsd.action_bitmap = new uint32_t[chosen->action_bitmap.size()];
+    memcpy(static_cast<void *>(prsd.action_bitmap),
+           static_cast<void *>(chosen->action_bitmap.data()),
+           chosen->action_bitmap.size() * sizeof(uint32_t));
 
 }
 
@@ -2930,9 +4138,9 @@ void LalrGenerator::dump_first_sets(ostream& os, int indent)
         }
 
         vector<string> name_list;
-        for (Symbol* s: first_set[symbol])
+        for (int64_t index: first_set[symbol_index[symbol]])
         {
-            name_list.push_back(s->symbol_name);
+            name_list.push_back(index_symbol[index]->symbol_name);
         }
 
         sort(name_list.begin(), name_list.end());
@@ -3057,11 +4265,11 @@ void LalrGenerator::dump_state(State* state, ostream& os, int indent) const
     //  Dump the lookaheads associated with the item. 
     //
 
-    function<void(set<Symbol*>)> dump_lookaheads = 
-        [&](set<Symbol*> lookaheads) -> void
+    function<void(const BitSet&)> dump_lookaheads = 
+        [&](const BitSet& lookaheads) -> void
     {
 
-        if (lookaheads.size() == 0)
+        if (lookaheads.empty())
         {
             return;
         }
@@ -3073,9 +4281,9 @@ void LalrGenerator::dump_state(State* state, ostream& os, int indent) const
         int width = indent + gram.symbol_width + 6;
 
         vector<string> name_list;
-        for (Symbol* symbol: lookaheads)
+        for (int64_t index: lookaheads)
         {
-            name_list.push_back(symbol->symbol_name);
+            name_list.push_back(index_symbol[index]->symbol_name);
         }
 
         sort(name_list.begin(), name_list.end());
@@ -0,0 +1,343 @@
+//
+//  LazyDfa
+//  -------
+//
+//  The scanner DFA built on demand. See the header for the overview.
+//
+//  The NFA is a slice of the ScanLazy operands laid out as follows:
+//
+//    class count
+//    accept count, then for each accept its symbol number, action label
+//      and guard label (or -1)
+//    state count, then for each state
+//      e-move count and the targets
+//      transition count and a first character, last character and target
+//        for each
+//      accept count and the accept numbers
+//
+//  State 0 is the start state and accepts are numbered in the order the
+//  scanner should try them.
+//
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <unordered_map>
+#include "LazyDfa.H"
+
+//
+//  Namespace hoshi: Not indenting...
+//
+
+namespace hoshi
+{
+
+using namespace std;
+
+//
+//  Constructor
+//  -----------
+//
+//  Find where each accept and each NFA state begins in the operands and
+//  decide how many DFA states fit in the cache.
+//
+
+LazyDfa::LazyDfa(const VCodeOperand* operands)
+{
+
+    int64_t operand = 0;
+
+    class_count = operands[operand++].integer;
+
+    int64_t accept_count = operands[operand++].integer;
+    for (int64_t i = 0; i < accept_count; i++)
+    {
+        accept_list.push_back(operands + operand);
+        operand += 3;
+    }
+
+    int64_t state_count = operands[operand++].integer;
+    for (int64_t i = 0; i < state_count; i++)
+    {
+        nfa_state_list.push_back(operands + operand);
+        operand += operands[operand].integer + 1;
+        operand += operands[operand].integer * 3 + 1;
+        operand += operands[operand].integer + 1;
+    }
+
+    closure_mark.assign(state_count, false);
+
+    cache_limit = static_cast<int32_t>(max(int64_t(16),
+                                           cache_bytes / (class_count * 4 + 64)));
+
+    current_cache = new_cache();
+
+}
+
+//
+//  StateSetHash
+//  ------------
+//
+//  Hash a sorted list of NFA state numbers.
+//
+
+size_t LazyDfa::StateSetHash::operator()(const vector<int32_t>& nfa_set) const
+{
+
+    uint64_t result = 0xcbf29ce484222325ull;
+    for (int32_t state_num: nfa_set)
+    {
+        result = (result ^ static_cast<uint32_t>(state_num)) * 0x100000001b3ull;
+    }
+
+    return static_cast<size_t>(result ^ (result >> 29));
+
+}
+
+//
+//  get_cache
+//  ---------
+//
+//  The cache new scans should start in.
+//
+
+shared_ptr<LazyDfa::Cache> LazyDfa::get_cache() const
+{
+    return atomic_load(&current_cache);
+}
+
+//
+//  new_cache
+//  ---------
+//
+//  Create an empty cache holding only the start state. The caller must
+//  hold the cache mutex, except in the constructor.
+//
+
+shared_ptr<LazyDfa::Cache> LazyDfa::new_cache()
+{
+
+    shared_ptr<Cache> cache = make_shared<Cache>();
+    cache->state_list.reset(new unique_ptr<State>[cache_limit]);
+
+    vector<int32_t> nfa_set;
+    nfa_set.push_back(0);
+    add_state(*cache, nfa_set);
+
+    cache_count++;
+
+    return cache;
+
+}
+
+//
+//  add_state
+//  ---------
+//
+//  Close a set of NFA states under e-moves and add the DFA state for it
+//  to the cache, unless it's already there. Return the state number, or
+//  unknown_state if the cache is full.
+//
+
+int32_t LazyDfa::add_state(Cache& cache, vector<int32_t>& nfa_set)
+{
+
+    //
+    //  Find the e-closure.
+    //
+
+    for (int32_t state_num: nfa_set)
+    {
+        closure_mark[state_num] = true;
+    }
+
+    for (int64_t i = 0; i < nfa_set.size(); i++)
+    {
+
+        const VCodeOperand* nfa_state = nfa_state_list[nfa_set[i]];
+
+        for (int64_t j = 1; j <= nfa_state[0].integer; j++)
+        {
+
+            int32_t target = static_cast<int32_t>(nfa_state[j].integer);
+            if (!closure_mark[target])
+            {
+                closure_mark[target] = true;
+                nfa_set.push_back(target);
+            }
+
+        }
+
+    }
+
+    for (int32_t state_num: nfa_set)
+    {
+        closure_mark[state_num] = false;
+    }
+
+    sort(nfa_set.begin(), nfa_set.end());
+
+    auto it = cache.state_map.find(nfa_set);
+    if (it != cache.state_map.end())
+    {
+        return it->second;
+    }
+
+    if (cache.state_count >= cache_limit)
+    {
+        return unknown_state;
+    }
+
+    //
+    //  Build the state. The accepts are the union of the NFA state
+    //  accepts, and nothing after an unguarded one can ever win.
+    //
+
+    unique_ptr<State> state(new State());
+    state->nfa_set = nfa_set;
+
+    for (int32_t state_num: nfa_set)
+    {
+
+        const VCodeOperand* operand = nfa_state_list[state_num];
+        operand += operand[0].integer + 1;
+        operand += operand[0].integer * 3 + 1;
+
+        for (int64_t j = 1; j <= operand[0].integer; j++)
+        {
+            state->accept_list.push_back(static_cast<int32_t>(operand[j].integer));
+        }
+
+    }
+
+    sort(state->accept_list.begin(), state->accept_list.end());
+    state->accept_list.erase(unique(state->accept_list.begin(), state->accept_list.end()),
+                             state->accept_list.end());
+
+    for (int64_t i = 0; i < state->accept_list.size(); i++)
+    {
+
+        if (get_accept_guard_pc(state->accept_list[i]) < 0)
+        {
+            state->accept_list.resize(i + 1);
+            break;
+        }
+
+    }
+
+    state->next_state.reset(new atomic<int32_t>[class_count]);
+    for (int64_t i = 0; i < class_count; i++)
+    {
+        state->next_state[i].store(unknown_state, memory_order_relaxed);
+    }
+
+    int32_t state_num = cache.state_count++;
+    cache.state_list[state_num] = move(state);
+    cache.state_map.insert(make_pair(nfa_set, state_num));
+
+    return state_num;
+
+}
+
+//
+//  find_next_state
+//  ---------------
+//
+//  Compute a transition the scanner hasn't needed before. Every character
+//  in a class behaves the same way, so we can work from the character in
+//  hand and save the answer for the whole class.
+//
+//  If the cache is full we move the caller to a fresh one and return the
+//  state number there. Someone else may have beaten us to it, in which
+//  case we join the cache they started.
+//
+
+int32_t LazyDfa::find_next_state(shared_ptr<Cache>& cache,
+                                 int32_t state_num,
+                                 int64_t char_class,
+                                 char32_t c)
+{
+
+    lock_guard<mutex> cache_guard(cache_mutex);
+
+    State& state = *cache->state_list[state_num];
+
+    int32_t next_state_num = state.next_state[char_class].load(memory_order_acquire);
+    if (next_state_num != unknown_state)
+    {
+        return next_state_num;
+    }
+
+    //
+    //  Collect the targets of every NFA state with a transition on this
+    //  character.
+    //
+
+    vector<int32_t> nfa_set;
+
+    for (int32_t nfa_state_num: state.nfa_set)
+    {
+
+        const VCodeOperand* operand = nfa_state_list[nfa_state_num];
+        operand += operand[0].integer + 1;
+
+        for (int64_t j = 0; j < operand[0].integer; j++)
+        {
+
+            if (operand[3 * j + 1].character <= c && c <= operand[3 * j + 2].character &&
+                !closure_mark[operand[3 * j + 3].integer])
+            {
+                closure_mark[operand[3 * j + 3].integer] = true;
+                nfa_set.push_back(static_cast<int32_t>(operand[3 * j + 3].integer));
+            }
+
+        }
+
+    }
+
+    for (int32_t nfa_state_num: nfa_set)
+    {
+        closure_mark[nfa_state_num] = false;
+    }
+
+    if (nfa_set.size() == 0)
+    {
+        state.next_state[char_class].store(dead_state, memory_order_release);
+        return dead_state;
+    }
+
+    next_state_num = add_state(*cache, nfa_set);
+    if (next_state_num != unknown_state)
+    {
+        state.next_state[char_class].store(next_state_num, memory_order_release);
+        return next_state_num;
+    }
+
+    //
+    //  The cache is full.
+    //
+
+    for (;;)
+    {
+
+        if (atomic_load(&current_cache) == cache)
+        {
+            atomic_store(&current_cache, new_cache());
+        }
+
+        cache = atomic_load(&current_cache);
+
+        next_state_num = add_state(*cache, nfa_set);
+        if (next_state_num != unknown_state)
+        {
+            return next_state_num;
+        }
+
+    }
+
+}
+
+} // namespace hoshi
@@ -0,0 +1,341 @@
+//
+//  LexemeTable
+//  -----------
+//
+//  The interned lexemes of one parse. Each distinct lexeme has one shared
+//  text and an id, its index in the table. We find them with an open
+//  addressed hash table of ids, kept at most half full.
+//
+//  The texts are reference counted since Ast nodes hold them too, and a
+//  tree can be cloned and kept after the table is cleared for the next
+//  parse.
+//
+
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "Parser.H"
+
+//
+//  Namespace hoshi: Not indenting...
+//
+
+namespace hoshi
+{
+
+using namespace std;
+
+//
+//  Copy Control
+//  ------------
+//
+//  A copy shares the texts with the original.
+//
+
+LexemeTable::~LexemeTable()
+{
+    clear();
+}
+
+LexemeTable::LexemeTable(const LexemeTable& rhs)
+    : text_list(rhs.text_list), hash_list(rhs.hash_list), slot_list(rhs.slot_list)
+{
+
+    for (Text* text: text_list)
+    {
+        attach(text);
+    }
+
+}
+
+LexemeTable::LexemeTable(LexemeTable&& rhs) noexcept
+{
+    swap(text_list, rhs.text_list);
+    swap(hash_list, rhs.hash_list);
+    swap(slot_list, rhs.slot_list);
+}
+
+LexemeTable& LexemeTable::operator=(const LexemeTable& rhs)
+{
+
+    if (&rhs != this)
+    {
+        LexemeTable temp(rhs);
+        swap(text_list, temp.text_list);
+        swap(hash_list, temp.hash_list);
+        swap(slot_list, temp.slot_list);
+    }
+
+    return *this;
+
+}
+
+LexemeTable& LexemeTable::operator=(LexemeTable&& rhs) noexcept
+{
+    swap(text_list, rhs.text_list);
+    swap(hash_list, rhs.hash_list);
+    swap(slot_list, rhs.slot_list);
+    return *this;
+}
+
+//
+//  Simple Accessors
+//  ----------------
+//
+
+int LexemeTable::size() const
+{
+    return text_list.size();
+}
+
+const string& LexemeTable::get_lexeme(int id) const
+{
+    return text_list[id]->lexeme;
+}
+
+//
+//  clear
+//  -----
+//
+//  Drop every lexeme. Nodes still holding a text keep it alive.
+//
+
+void LexemeTable::clear()
+{
+
+    for (Text* text: text_list)
+    {
+        detach(text);
+    }
+
+    text_list.clear();
+    hash_list.clear();
+    slot_list.clear();
+
+}
+
+//
+//  find
+//  ----
+//
+//  Look up the id of a lexeme, or -1 if it isn't in the table.
+//
+
+int LexemeTable::find(const string& lexeme) const
+{
+
+    if (slot_list.size() == 0)
+    {
+        return -1;
+    }
+
+    return slot_list[find_slot(lexeme, std::hash<string>()(lexeme))];
+
+}
+
+//
+//  intern
+//  ------
+//
+//  Look up the id of a lexeme, adding it if necessary.
+//
+
+int LexemeTable::intern(const string& lexeme)
+{
+
+    size_t hash = std::hash<string>()(lexeme);
+
+    if (slot_list.size() > 0)
+    {
+
+        int id = slot_list[find_slot(lexeme, hash)];
+        if (id >= 0)
+        {
+            return id;
+        }
+
+    }
+
+    return insert_text(new_text(lexeme), hash);
+
+}
+
+//
+//  find_slot
+//  ---------
+//
+//  Find the slot holding a lexeme or the empty slot where it belongs.
+//
+
+int LexemeTable::find_slot(const string& lexeme, size_t hash) const
+{
+
+    size_t mask = slot_list.size() - 1;
+
+    for (size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+    {
+
+        int id = slot_list[slot];
+
+        if (id < 0 || (hash_list[id] == hash && text_list[id]->lexeme == lexeme))
+        {
+            return slot;
+        }
+
+    }
+
+}
+
+//
+//  insert_text
+//  -----------
+//
+//  Add a text we know isn't in the table, taking over the caller's
+//  reference. When the table passes half full we double the slots and
+//  place the ids again.
+//
+
+int LexemeTable::insert_text(Text* text, size_t hash)
+{
+
+    int id = text_list.size();
+
+    text_list.push_back(text);
+    hash_list.push_back(hash);
+
+    if (slot_list.size() < text_list.size() * 2)
+    {
+
+        slot_list.assign(max(static_cast<size_t>(64), slot_list.size() * 2), -1);
+
+        size_t mask = slot_list.size() - 1;
+
+        for (int i = 0; i < static_cast<int>(text_list.size()); i++)
+        {
+
+            size_t slot = hash_list[i] & mask;
+            while (slot_list[slot] >= 0)
+            {
+                slot = (slot + 1) & mask;
+            }
+
+            slot_list[slot] = i;
+
+        }
+
+        return id;
+
+    }
+
+    slot_list[find_slot(text->lexeme, hash)] = id;
+
+    return id;
+
+}
+
+//
+//  absorb
+//  ------
+//
+//  Add the lexemes of another table and renumber a tree that used it, so
+//  the tree uses this table instead. Taking the other table's lexemes in
+//  order gives the ids we would have had if this table had been used
+//  throughout.
+//
+
+void LexemeTable::absorb(const LexemeTable& other, Ast* root)
+{
+
+    vector<int> id_map(other.text_list.size());
+
+    for (int i = 0; i < static_cast<int>(other.text_list.size()); i++)
+    {
+
+        Text* text = other.text_list[i];
+        size_t hash = other.hash_list[i];
+
+        if (slot_list.size() > 0)
+        {
+
+            int id = slot_list[find_slot(text->lexeme, hash)];
+            if (id >= 0)
+            {
+                id_map[i] = id;
+                continue;
+            }
+
+        }
+
+        attach(text);
+        id_map[i] = insert_text(text, hash);
+
+    }
+
+    vector<Ast*> stack;
+    stack.push_back(root);
+
+    while (stack.size() > 0)
+    {
+
+        Ast* ast = stack.back();
+        stack.pop_back();
+
+        if (ast == nullptr)
+        {
+            continue;
+        }
+
+        if (ast->lexeme_id >= 0)
+        {
+            ast->set_lexeme(*this, id_map[ast->lexeme_id]);
+        }
+
+        stack.insert(stack.end(), ast->children, ast->children + ast->num_children);
+
+    }
+
+}
+
+//
+//  Text Reference Counting
+//  -----------------------
+//
+//  Nodes and tables in different threads can share a text, so the count
+//  is atomic. Whoever drops the last reference must see everything the
+//  other holders did before it deletes.
+//
+
+LexemeTable::Text* LexemeTable::new_text(const string& lexeme)
+{
+
+    Text* text = new Text;
+    text->lexeme = lexeme;
+
+    return text;
+
+}
+
+void LexemeTable::attach(Text* text)
+{
+
+    if (text != nullptr)
+    {
+        text->reference_count.fetch_add(1, memory_order_relaxed);
+    }
+
+}
+
+void LexemeTable::detach(Text* text)
+{
+
+    if (text != nullptr && text->reference_count.fetch_sub(1, memory_order_acq_rel) == 1)
+    {
+        delete text;
+    }
+
+}
+
+} // namespace hoshi
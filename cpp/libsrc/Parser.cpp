@@ -204,6 +204,56 @@ void Parser::parse(const Source& src, const int64_t debug_flags)
     impl->parse(src, debug_flags);
 }
 
+//
+//  parse_parallel                                                     
+//  --------------                                                     
+//                                                                     
+//  Parse a large source on several threads, splitting it before sync  
+//  tokens. The result is the same as parse would give.                
+//
+
+void Parser::parse_parallel(const Source& src,
+                            const int64_t num_threads,
+                            const int64_t debug_flags)
+{
+    impl->parse_parallel(src, num_threads, debug_flags);
+}
+
+//
+//  parse_batch                                                           
+//  -----------                                                           
+//                                                                        
+//  Parse many sources at once. We return a parser for each source, in   
+//  the same order, holding its Ast or its errors just as if we'd copied  
+//  this parser and called parse on the copy.                             
+//
+
+vector<Parser> Parser::parse_batch(const vector<Source>& src_list,
+                                   const int64_t num_threads)
+{
+
+    vector<Parser> parser_list(src_list.size());
+    impl->parse_batch(src_list, parser_list, num_threads);
+
+    return parser_list;
+
+}
+
+//
+//  parse_binary_batch                                                     
+//  ------------------                                                     
+//                                                                         
+//  Parse many sources packed in one string and return all the results   
+//  packed in another. This is for the language wrappers; the format is   
+//  described in ParserImpl.cpp.                                          
+//
+
+string Parser::parse_binary_batch(const string& packed_sources,
+                                  const int64_t num_threads)
+{
+    return impl->parse_binary_batch(packed_sources, num_threads);
+}
+
 //
 //  get_kind_map                                                     
 //  ------------                                                     
@@ -241,6 +291,31 @@ Ast* Parser::get_ast() const
     return impl->get_ast();
 }
 
+//
+//  get_flat_ast                                                   
+//  ------------                                                   
+//                                                                 
+//  Return a flat copy of the result Ast from a successful parse.  
+//
+
+FlatAst Parser::get_flat_ast() const
+{
+    return FlatAst(impl->get_ast());
+}
+
+//
+//  get_lexeme_table                                              
+//  ----------------                                              
+//                                                                
+//  Return the interned lexemes from a successful parse. This is  
+//  empty unless the grammar has the intern_lexemes option.       
+//
+
+const LexemeTable& Parser::get_lexeme_table() const
+{
+    return impl->get_lexeme_table();
+}
+
 //
 //  get_encoded_ast                                        
 //  ---------------                                        
@@ -253,6 +328,19 @@ string Parser::get_encoded_ast()
     return impl->get_encoded_ast();
 }
 
+//
+//  get_binary_ast                                                 
+//  --------------                                                 
+//                                                                 
+//  Return the result Ast from a successful parse in binary form,  
+//  with the kind map.                                             
+//
+
+string Parser::get_binary_ast()
+{
+    return impl->get_binary_ast();
+}
+
 //
 //  dump_ast                                              
 //  --------                                              
@@ -17,11 +17,14 @@
 //
 
 #include <cstdint>
+#include <atomic>
 #include <exception>
 #include <functional>
 #include <mutex>
 #include <string>
+#include <vector>
 #include <map>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -30,6 +33,7 @@
 #include "Parser.H"
 #include "ParserImpl.H"
 #include "ParserData.H"
+#include "LazyDfa.H"
 
 //
 //  Namespace hoshi: Not indenting...
@@ -104,7 +108,26 @@ ParserData::EncodeHandler ParserData::encode_handler[] =
     handle_encode_ast_count,              // AstCount
     handle_encode_string_count,           // StringCount
     handle_encode_string_list,            // StringList
-    handle_encode_eof                     // Eof
+    handle_encode_eof,                    // Eof
+    handle_encode_table_scheme,           // TableScheme
+    handle_encode_default_data_count,     // DefaultDataCount
+    handle_encode_default_data,           // DefaultData
+    handle_encode_action_bitmap_width,    // ActionBitmapWidth
+    handle_encode_action_bitmap_count,    // ActionBitmapCount
+    handle_encode_action_bitmap,          // ActionBitmap
+    handle_encode_word_width,             // WordWidth
+    handle_encode_char_page_count,        // CharPageCount
+    handle_encode_char_page_index,        // CharPageIndex
+    handle_encode_char_page_data_count,   // CharPageDataCount
+    handle_encode_char_page_data,         // CharPageData
+    handle_encode_char_high_count,        // CharHighCount
+    handle_encode_char_high_start,        // CharHighStart
+    handle_encode_char_high_class,        // CharHighClass
+    handle_encode_rule_kind,              // RuleKind
+    handle_encode_pipeline_scanner,       // PipelineScanner
+    handle_encode_token_is_sync,          // TokenIsSync
+    handle_encode_intern_lexemes,         // InternLexemes
+    handle_encode_lazy_ast                // LazyAst
 };
 
 ParserData::DecodeHandler ParserData::decode_handler[] =
@@ -158,7 +181,26 @@ ParserData::DecodeHandler ParserData::decode_handler[] =
     handle_decode_ast_count,              // AstCount
     handle_decode_string_count,           // StringCount
     handle_decode_string_list,            // StringList
-    handle_decode_eof                     // Eof
+    handle_decode_eof,                    // Eof
+    handle_decode_table_scheme,           // TableScheme
+    handle_decode_default_data_count,     // DefaultDataCount
+    handle_decode_default_data,           // DefaultData
+    handle_decode_action_bitmap_width,    // ActionBitmapWidth
+    handle_decode_action_bitmap_count,    // ActionBitmapCount
+    handle_decode_action_bitmap,          // ActionBitmap
+    handle_decode_word_width,             // WordWidth
+    handle_decode_char_page_count,        // CharPageCount
+    handle_decode_char_page_index,        // CharPageIndex
+    handle_decode_char_page_data_count,   // CharPageDataCount
+    handle_decode_char_page_data,         // CharPageData
+    handle_decode_char_high_count,        // CharHighCount
+    handle_decode_char_high_start,        // CharHighStart
+    handle_decode_char_high_class,        // CharHighClass
+    handle_decode_rule_kind,              // RuleKind
+    handle_decode_pipeline_scanner,       // PipelineScanner
+    handle_decode_token_is_sync,          // TokenIsSync
+    handle_decode_intern_lexemes,         // InternLexemes
+    handle_decode_lazy_ast                // LazyAst
 };
 
 //
@@ -216,7 +258,26 @@ string ParserData::block_name[] =
     "AstCount",
     "StringCount",
     "StringList",
-    "Eof" 
+    "Eof",
+    "TableScheme",
+    "DefaultDataCount",
+    "DefaultData",
+    "ActionBitmapWidth",
+    "ActionBitmapCount",
+    "ActionBitmap",
+    "WordWidth",
+    "CharPageCount",
+    "CharPageIndex",
+    "CharPageDataCount",
+    "CharPageData",
+    "CharHighCount",
+    "CharHighStart",
+    "CharHighClass",
+    "RuleKind",
+    "PipelineScanner",
+    "TokenIsSync",
+    "InternLexemes",
+    "LazyAst"
 };
 
 //
@@ -241,6 +302,9 @@ ParserData::~ParserData()
     delete [] token_lexeme_needed;
     token_lexeme_needed = nullptr;
 
+    delete [] token_is_sync;
+    token_is_sync = nullptr;
+
     delete [] rule_size;
     rule_size = nullptr;
 
@@ -253,11 +317,32 @@ ParserData::~ParserData()
     delete [] rule_pc;
     rule_pc = nullptr;
 
+    delete [] rule_kind;
+    rule_kind = nullptr;
+
+    delete [] char_page_index;
+    char_page_index = nullptr;
+
+    delete [] char_page_data;
+    char_page_data = nullptr;
+
+    delete [] char_high_start;
+    char_high_start = nullptr;
+
+    delete [] char_high_class;
+    char_high_class = nullptr;
+
+    delete lazy_dfa;
+    lazy_dfa = nullptr;
+
     delete [] checked_index;
     checked_index = nullptr;
 
-    delete [] checked_data;
-    checked_data = nullptr;
+    delete_table_words(word_width, checked_data);
+    delete_table_words(word_width, default_data);
+
+    delete [] action_bitmap;
+    action_bitmap = nullptr;
 
     delete [] instruction_list;
     instruction_list = nullptr;
@@ -277,7 +362,10 @@ ParserData::~ParserData()
 //  attach                                             
 //  ------                                             
 //                                                     
-//  Attach a parser implementation to the parser data. 
+//  Attach a parser implementation to the parser data. Either the     
+//  data is new and not yet shared or the caller is copying a parser  
+//  that holds a reference, so the count can't hit zero meanwhile and 
+//  we need no ordering.                                              
 //
 
 void ParserData::attach(ParserData*& prsd)
@@ -285,8 +373,7 @@ void ParserData::attach(ParserData*& prsd)
 
     if (prsd != nullptr)
     {
-        lock_guard<mutex> reference_guard(prsd->reference_mutex);
-        ++prsd->reference_count;
+        prsd->reference_count.fetch_add(1, memory_order_relaxed);
     }
 
 }
@@ -296,7 +383,9 @@ void ParserData::attach(ParserData*& prsd)
 //  ------                                                            
 //                                                                    
 //  A parser is finished with ParserData. We decrement the use count, 
-//  delete if necessary and clear the pointer.                        
+//  delete if necessary and clear the pointer. Whoever drops the last 
+//  reference must see everything the other holders did before it     
+//  deletes.                                                          
 //
 
 void ParserData::detach(ParserData*& prsd)
@@ -305,13 +394,7 @@ void ParserData::detach(ParserData*& prsd)
     if (prsd != nullptr)
     {
 
-        bool should_delete = false;
-        {
-            lock_guard<mutex> reference_guard(prsd->reference_mutex);
-            should_delete = --prsd->reference_count == 0;
-        }
-
-        if (should_delete)
+        if (prsd->reference_count.fetch_sub(1, memory_order_acq_rel) == 1)
         {
             delete prsd;
         }
@@ -385,6 +468,24 @@ map<string, int> ParserData::get_kind_map() const
 int ParserData::get_kind(const string& kind_str) const
 {
 
+    if (kind_map_frozen)
+    {
+
+        uint64_t hash = hash_kind_string(kind_str);
+        int64_t bucket = (hash >> 32) & (kind_bucket_seed.size() - 1);
+        int64_t slot = ParserEngine::hash_keyword_slot(hash, kind_bucket_seed[bucket]) &
+                       (kind_slot_list.size() - 1);
+
+        int32_t index = kind_slot_list[slot];
+        if (index < 0 || kind_name_list[index] != kind_str)
+        {
+            return -1;
+        }
+
+        return kind_value_list[index];
+
+    }
+
     if (kind_map.find(kind_str) == kind_map.end())
     {
         return -1;
@@ -405,6 +506,11 @@ int ParserData::get_kind(const string& kind_str) const
 int ParserData::get_kind_force(const string& kind_str)
 {
 
+    if (kind_map_frozen)
+    {
+        throw logic_error("Kind map is frozen: " + kind_str);
+    }
+
     if (kind_map.find(kind_str) != kind_map.end())
     {
         return kind_map[kind_str];
@@ -438,12 +544,210 @@ int ParserData::get_kind_force(const string& kind_str)
 string ParserData::get_kind_string(int kind) const
 {
 
-    if (kind_imap.find(kind) == kind_imap.end())
+    string kind_str;
+    if (!find_kind_string(kind, kind_str))
     {
         return "Unknown";
     }
 
-    return (*kind_imap.find(kind)).second;
+    return kind_str;
+
+}
+
+//
+//  find_kind_string                                                
+//  ----------------                                                
+//                                                                  
+//  Get the text name for a numeric code if we have one. The frozen 
+//  list is sorted by kind so we can search it.                     
+//
+
+bool ParserData::find_kind_string(int kind, string& kind_str) const
+{
+
+    if (kind_map_frozen)
+    {
+
+        auto it = lower_bound(kind_value_list.begin(), kind_value_list.end(), kind);
+        if (it == kind_value_list.end() || *it != kind)
+        {
+            return false;
+        }
+
+        kind_str = kind_name_list[it - kind_value_list.begin()];
+        return true;
+
+    }
+
+    if (kind_imap.find(kind) == kind_imap.end())
+    {
+        return false;
+    }
+
+    kind_str = (*kind_imap.find(kind)).second;
+    return true;
+
+}
+
+//
+//  hash_kind_string                                                   
+//  ----------------                                                   
+//                                                                     
+//  Hash a kind name. We borrow the keyword table hash from the engine. 
+//
+
+uint64_t ParserData::hash_kind_string(const string& kind_str)
+{
+
+    uint64_t hash = ParserEngine::keyword_hash_basis;
+    for (char c: kind_str)
+    {
+        hash = ParserEngine::hash_keyword_char(hash, static_cast<unsigned char>(c));
+    }
+
+    return hash;
+
+}
+
+//
+//  freeze_kind_map                                                        
+//  ---------------                                                        
+//                                                                         
+//  Called once generation or decoding is finished, before the ParserData 
+//  can be shared. We build a perfect hash of the kind names the same way 
+//  the scanner builds its keyword table: the name hash picks a bucket,   
+//  and each bucket gets a seed that sends all its names to free slots.   
+//  The slots hold indices into lists with one entry per kind, so the     
+//  only space we waste is a 32 bit index in each empty slot.             
+//
+
+void ParserData::freeze_kind_map()
+{
+
+    if (kind_map_frozen)
+    {
+        return;
+    }
+
+    kind_name_list.clear();
+    kind_value_list.clear();
+    kind_max = 0;
+
+    for (auto mp: kind_imap)
+    {
+        kind_value_list.push_back(mp.first);
+        kind_name_list.push_back(mp.second);
+        kind_max = max(kind_max, mp.first);
+    }
+
+    int64_t kind_count = kind_name_list.size();
+
+    int64_t bucket_count = 1;
+    while (bucket_count * 4 < kind_count)
+    {
+        bucket_count *= 2;
+    }
+
+    int64_t slot_count = 1;
+    while (slot_count < kind_count * 2)
+    {
+        slot_count *= 2;
+    }
+
+    vector<uint64_t> hash_list;
+    vector<vector<int32_t>> bucket_list(bucket_count);
+
+    for (int32_t i = 0; i < kind_count; i++)
+    {
+        hash_list.push_back(hash_kind_string(kind_name_list[i]));
+        bucket_list[(hash_list[i] >> 32) & (bucket_count - 1)].push_back(i);
+    }
+
+    vector<int64_t> bucket_order;
+    for (int64_t i = 0; i < bucket_count; i++)
+    {
+        bucket_order.push_back(i);
+    }
+
+    stable_sort(bucket_order.begin(), bucket_order.end(),
+                [&](int64_t lhs, int64_t rhs) -> bool
+                { return bucket_list[lhs].size() > bucket_list[rhs].size(); });
+
+    //
+    //  Find a seed for each bucket, doubling the table if some bucket 
+    //  can't be placed.                                               
+    //
+
+    for (;;)
+    {
+
+        kind_bucket_seed.assign(bucket_count, 0);
+        kind_slot_list.assign(slot_count, -1);
+        bool placed = true;
+
+        for (int64_t bucket: bucket_order)
+        {
+
+            if (!placed || bucket_list[bucket].size() == 0)
+            {
+                break;
+            }
+
+            placed = false;
+
+            for (int64_t seed = 0; seed < 4096 && !placed; seed++)
+            {
+
+                vector<int64_t> slot_list;
+                placed = true;
+
+                for (int32_t index: bucket_list[bucket])
+                {
+
+                    int64_t slot = ParserEngine::hash_keyword_slot(hash_list[index], seed) &
+                                   (slot_count - 1);
+
+                    if (kind_slot_list[slot] >= 0 ||
+                        find(slot_list.begin(), slot_list.end(), slot) != slot_list.end())
+                    {
+                        placed = false;
+                        break;
+                    }
+
+                    slot_list.push_back(slot);
+
+                }
+
+                if (placed)
+                {
+
+                    kind_bucket_seed[bucket] = seed;
+                    for (int64_t i = 0; i < slot_list.size(); i++)
+                    {
+                        kind_slot_list[slot_list[i]] = bucket_list[bucket][i];
+                    }
+
+                }
+
+            }
+
+        }
+
+        if (placed)
+        {
+            break;
+        }
+
+        if (slot_count > kind_count * 64)
+        {
+            throw logic_error("Unable to build kind hash table");
+        }
+
+        slot_count *= 2;
+
+    }
+
+    kind_map_frozen = true;
 
 }
 
@@ -460,17 +764,31 @@ string ParserData::encode() const
 
     ostringstream ost;
 
+    //
+    //  Blocks added after the eof marker are numbered above it, so we 
+    //  hold the marker back until everything else is written.         
+    //
+
     for (int block = BlockType::BlockMinimum;
          block <= BlockType::BlockMaximum;
          block++)
     {
 
+        if (block == BlockType::BlockEof)
+        {
+            continue;
+        }
+
         encode_int(block, ost);
         (*encode_handler[block])(*this, static_cast<BlockType>(block), ost);
         ost << block_separator;
 
     }
 
+    encode_int(BlockType::BlockEof, ost);
+    (*encode_handler[BlockType::BlockEof])(*this, BlockType::BlockEof, ost);
+    ost << block_separator;
+
     return ost.str();
 
 }
@@ -500,12 +818,21 @@ void ParserData::decode(const string& str,
             break;
         }
 
-        (*decode_handler[block])(*this, temp, static_cast<BlockType>(block), next);
+        if (block < BlockType::BlockMinimum || block > BlockType::BlockMaximum)
+        {
+            handle_decode_error(*this, temp, block, next);
+        }
+        else
+        {
+            (*decode_handler[block])(*this, temp, block, next);
+        }
 
         next++;
 
     }
 
+    freeze_kind_map();
+
 }
 
 //
@@ -1100,6 +1427,17 @@ void ParserData::handle_decode_rule_pc(ParserData& prsd,
         prsd.rule_pc[i] = decode_int(next);
     }
 
+    //
+    //  Older encodings have no rule kinds, so until we see them every 
+    //  rule runs its code.                                            
+    //
+
+    if (prsd.rule_kind == nullptr)
+    {
+        prsd.rule_kind = new int[prsd.rule_count];
+        fill(prsd.rule_kind, prsd.rule_kind + prsd.rule_count, -1);
+    }
+
 }
 
 //
@@ -1260,7 +1598,7 @@ void ParserData::handle_encode_checked_data(const ParserData& prsd,
     
     for (int i = 0; i < prsd.checked_data_count; i++)
     {
-        encode_int(prsd.checked_data[i], os);
+        encode_int(get_table_word(prsd.word_width, prsd.checked_data, i), os);
     }
 
 }
@@ -1271,11 +1609,11 @@ void ParserData::handle_decode_checked_data(ParserData& prsd,
                                             const char*& next)
 {
 
-    prsd.checked_data = new int64_t[prsd.checked_data_count];
+    prsd.checked_data = new_table_words(prsd.word_width, prsd.checked_data_count);
 
     for (int i = 0; i < prsd.checked_data_count; i++)
     {
-        prsd.checked_data[i] = decode_int(next);
+        set_table_word(prsd.word_width, prsd.checked_data, i, decode_int(next));
     }
 
 }
@@ -1847,6 +2185,98 @@ void ParserData::handle_encode_instruction_list(const ParserData& prsd,
             
             }
             
+            case OpcodeScanClass:
+            case OpcodeScanClassMemo:
+            {
+            
+                int operand = 0;
+            
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                for (int i = 0; i < prsd.operand_list[instruction.operand_offset + operand].integer; i++)
+                {
+                    encode_label_operand(prsd.operand_list[instruction.operand_offset + operand + i + 1]);
+                }
+            
+                operand += prsd.operand_list[instruction.operand_offset + operand].integer + 1;
+                break;
+            
+            }
+            
+            case OpcodeScanKeyword:
+            {
+            
+                int operand = 0;
+            
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                int64_t bucket_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int i = 0; i < bucket_count; i++)
+                {
+                    encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                }
+            
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                int64_t slot_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int i = 0; i < slot_count; i++)
+                {
+                    encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    encode_string_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                }
+            
+                break;
+            
+            }
+            
+            case OpcodeScanLazy:
+            {
+            
+                int operand = 0;
+            
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                int64_t accept_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int i = 0; i < accept_count; i++)
+                {
+                    encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    encode_label_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    encode_label_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                }
+            
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                int64_t state_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int i = 0; i < state_count; i++)
+                {
+            
+                    encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                    int64_t e_move_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                    for (int j = 0; j < e_move_count; j++)
+                    {
+                        encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    }
+            
+                    encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                    int64_t transition_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                    for (int j = 0; j < transition_count; j++)
+                    {
+                        encode_character_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                        encode_character_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                        encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    }
+            
+                    encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                    int64_t accept_num_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                    for (int j = 0; j < accept_num_count; j++)
+                    {
+                        encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    }
+            
+                }
+            
+                break;
+            
+            }
+            
             case OpcodeScanAccept:
             {
             
@@ -1878,6 +2308,7 @@ void ParserData::handle_encode_instruction_list(const ParserData& prsd,
             }
             
             case OpcodeAstFinish:
+            case OpcodeAstFinishReturn:
             case OpcodeAstLocationNum:
             {
             
@@ -1898,7 +2329,20 @@ void ParserData::handle_encode_instruction_list(const ParserData& prsd,
             
             }
             
+            case OpcodeAstFormKind:
+            {
+            
+                int operand = 0;
+                encode_register_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                encode_register_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                encode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                encode_kind_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                break;
+            
+            }
+            
             case OpcodeAstLoad:
+            case OpcodeAstLoadChild:
             {
             
                 int operand = 0;
@@ -2119,6 +2563,98 @@ void ParserData::handle_decode_instruction_list(ParserData& prsd,
             
             }
             
+            case OpcodeScanClass:
+            case OpcodeScanClassMemo:
+            {
+            
+                int operand = 0;
+            
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                for (int i = 0; i < prsd.operand_list[instruction.operand_offset + operand].integer; i++)
+                {
+                    decode_label_operand(prsd.operand_list[instruction.operand_offset + operand + i + 1]);
+                }
+            
+                operand += prsd.operand_list[instruction.operand_offset + operand].integer + 1;
+                break;
+            
+            }
+            
+            case OpcodeScanKeyword:
+            {
+            
+                int operand = 0;
+            
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                int64_t bucket_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int i = 0; i < bucket_count; i++)
+                {
+                    decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                }
+            
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                int64_t slot_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int i = 0; i < slot_count; i++)
+                {
+                    decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    decode_string_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                }
+            
+                break;
+            
+            }
+            
+            case OpcodeScanLazy:
+            {
+            
+                int operand = 0;
+            
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                int64_t accept_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int i = 0; i < accept_count; i++)
+                {
+                    decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    decode_label_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    decode_label_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                }
+            
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                int64_t state_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int i = 0; i < state_count; i++)
+                {
+            
+                    decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                    int64_t e_move_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                    for (int j = 0; j < e_move_count; j++)
+                    {
+                        decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    }
+            
+                    decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                    int64_t transition_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                    for (int j = 0; j < transition_count; j++)
+                    {
+                        decode_character_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                        decode_character_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                        decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    }
+            
+                    decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand]);
+                    int64_t accept_num_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                    for (int j = 0; j < accept_num_count; j++)
+                    {
+                        decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                    }
+            
+                }
+            
+                break;
+            
+            }
+            
             case OpcodeScanAccept:
             {
             
@@ -2150,6 +2686,7 @@ void ParserData::handle_decode_instruction_list(ParserData& prsd,
             }
             
             case OpcodeAstFinish:
+            case OpcodeAstFinishReturn:
             case OpcodeAstLocationNum:
             {
             
@@ -2170,30 +2707,43 @@ void ParserData::handle_decode_instruction_list(ParserData& prsd,
             
             }
             
-            case OpcodeAstLoad:
+            case OpcodeAstFormKind:
             {
             
                 int operand = 0;
-                decode_ast_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                decode_register_operand(prsd.operand_list[instruction.operand_offset + operand++]);
                 decode_register_operand(prsd.operand_list[instruction.operand_offset + operand++]);
                 decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                decode_kind_operand(prsd.operand_list[instruction.operand_offset + operand++]);
                 break;
             
             }
             
-            case OpcodeAstIndex:
+            case OpcodeAstLoad:
+            case OpcodeAstLoadChild:
             {
             
                 int operand = 0;
                 decode_ast_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                decode_register_operand(prsd.operand_list[instruction.operand_offset + operand++]);
                 decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
                 break;
             
             }
             
-            case OpcodeAstChild:
-            case OpcodeAstKind:
-            case OpcodeAstLocation:
+            case OpcodeAstIndex:
+            {
+            
+                int operand = 0;
+                decode_ast_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                decode_integer_operand(prsd.operand_list[instruction.operand_offset + operand++]);
+                break;
+            
+            }
+            
+            case OpcodeAstChild:
+            case OpcodeAstKind:
+            case OpcodeAstLocation:
             case OpcodeAstLexeme:
             {
             
@@ -2407,173 +2957,956 @@ void ParserData::handle_decode_string_list(ParserData& prsd,
 }
 
 //
-//  encode_int                                                             
-//  ----------                                                             
-//                                                                         
-//  Encode an integer into a compact ASCII form. We use a long sequence of 
-//  ASCII characters as digits so the encoded numbers are quite short. The 
-//  number always ends with a field separator.                             
+//  handle_*_table_scheme
+//  ---------------------
+//
+//  Parse table field: table_scheme. Older strings don't have this block, 
+//  and they were all encoded with TableDisplacement.                     
 //
 
-void ParserData::encode_int(int64_t i, ostream& os)
+void ParserData::handle_encode_table_scheme(const ParserData& prsd,
+                                            const BlockType block,
+                                            ostream& os)
 {
+    encode_int(prsd.table_scheme, os);
+}
 
-    bool negative = false;
+void ParserData::handle_decode_table_scheme(ParserData& prsd,
+                                            ParserTemp& temp,
+                                            const BlockType block,
+                                            const char*& next)
+{
 
-    if (i < 0)
-    {
-        negative = true;
-        i *= -1;
-    }
+    prsd.table_scheme = decode_int(next);
 
-    while (i > 0)
+    if (prsd.table_scheme < TableSchemeType::TableDisplacement ||
+        prsd.table_scheme > TableSchemeType::TableFull)
     {
-        os << static_cast<char>(first_data + (i & 0x3f));
-        i >>= 6;
+        throw out_of_range("Unknown parse table scheme in Hoshi library");
     }
 
-    if (negative)
+}
+
+//
+//  handle_*_default_data_count
+//  ---------------------------
+//
+//  Parse table field: default_data_count.
+//
+
+void ParserData::handle_encode_default_data_count(const ParserData& prsd,
+                                                  const BlockType block,
+                                                  ostream& os)
+{
+    encode_int(prsd.default_data_count, os);
+}
+
+void ParserData::handle_decode_default_data_count(ParserData& prsd,
+                                                  ParserTemp& temp,
+                                                  const BlockType block,
+                                                  const char*& next)
+{
+    prsd.default_data_count = decode_int(next);
+}
+
+//
+//  handle_*_default_data
+//  ---------------------
+//
+//  Parse table field: default_data.
+//
+
+void ParserData::handle_encode_default_data(const ParserData& prsd,
+                                            const BlockType block,
+                                            ostream& os)
+{
+    
+    for (int i = 0; i < prsd.default_data_count; i++)
     {
-        os << field_separator_negative;
+        encode_int(get_table_word(prsd.word_width, prsd.default_data, i), os);
     }
-    else
+
+}
+
+void ParserData::handle_decode_default_data(ParserData& prsd,
+                                            ParserTemp& temp,
+                                            const BlockType block,
+                                            const char*& next)
+{
+
+    prsd.default_data = new_table_words(prsd.word_width, prsd.default_data_count);
+
+    for (int i = 0; i < prsd.default_data_count; i++)
     {
-        os << field_separator;
+        set_table_word(prsd.word_width, prsd.default_data, i, decode_int(next));
     }
 
 }
 
 //
-//  decode_int                               
-//  ----------                               
-//                                           
-//  Decode the ASCII encoding of an integer. 
+//  handle_*_action_bitmap_width
+//  ----------------------------
+//
+//  Parse table field: action_bitmap_width.
 //
 
-int64_t ParserData::decode_int(const char*& next)
+void ParserData::handle_encode_action_bitmap_width(const ParserData& prsd,
+                                                   const BlockType block,
+                                                   ostream& os)
 {
+    encode_int(prsd.action_bitmap_width, os);
+}
 
-    int64_t result = 0;
-    int64_t shift = 0;
+void ParserData::handle_decode_action_bitmap_width(ParserData& prsd,
+                                                   ParserTemp& temp,
+                                                   const BlockType block,
+                                                   const char*& next)
+{
+    prsd.action_bitmap_width = decode_int(next);
+}
 
-    while (*next >= first_data && *next <= first_data + 0x3f)
-    {
-        result |= static_cast<int64_t>(*next - first_data) << shift;
-        shift += 6;
-        next++;
-    }
+//
+//  handle_*_action_bitmap_count
+//  ----------------------------
+//
+//  Parse table field: action_bitmap_count.
+//
 
-    if (*next == field_separator_negative)
-    {
-        result *= -1;
-        next++;
-    }
-    else if (*next == field_separator)
+void ParserData::handle_encode_action_bitmap_count(const ParserData& prsd,
+                                                   const BlockType block,
+                                                   ostream& os)
+{
+    encode_int(prsd.action_bitmap_count, os);
+}
+
+void ParserData::handle_decode_action_bitmap_count(ParserData& prsd,
+                                                   ParserTemp& temp,
+                                                   const BlockType block,
+                                                   const char*& next)
+{
+    prsd.action_bitmap_count = decode_int(next);
+}
+
+//
+//  handle_*_action_bitmap
+//  ----------------------
+//
+//  Parse table field: action_bitmap.
+//
+
+void ParserData::handle_encode_action_bitmap(const ParserData& prsd,
+                                             const BlockType block,
+                                             ostream& os)
+{
+    
+    for (int i = 0; i < prsd.action_bitmap_count; i++)
     {
-        next++;
+        encode_int(prsd.action_bitmap[i], os);
     }
-    else
+
+}
+
+void ParserData::handle_decode_action_bitmap(ParserData& prsd,
+                                             ParserTemp& temp,
+                                             const BlockType block,
+                                             const char*& next)
+{
+
+    prsd.action_bitmap = new uint32_t[prsd.action_bitmap_count];
+
+    for (int i = 0; i < prsd.action_bitmap_count; i++)
     {
-        throw out_of_range("Invalid encoded integer");
+        prsd.action_bitmap[i] = decode_int(next);
     }
 
-    return result;
-
 }
-        
+
 //
-//  encode_string                                                        
-//  -------------                                                        
-//                                                                       
-//  Encode a UTF-8 string into ASCII. This isn't terribly compact but we 
-//  don't expect to have many non-ASCII characters.                      
+//  handle_*_word_width
+//  -------------------
+//
+//  Parse table field: word_width. Older strings don't have this block,  
+//  and they were all encoded with 64 bit words. The tables come before  
+//  this block so they were decoded as 64 bit words and we narrow them   
+//  here.                                                                
 //
 
-void ParserData::encode_string(string s, ostream& os)
+void ParserData::handle_encode_word_width(const ParserData& prsd,
+                                          const BlockType block,
+                                          ostream& os)
 {
+    encode_int(prsd.word_width, os);
+}
 
-    for (auto c: s)
+void ParserData::handle_decode_word_width(ParserData& prsd,
+                                          ParserTemp& temp,
+                                          const BlockType block,
+                                          const char*& next)
+{
+
+    int word_width = decode_int(next);
+
+    if (word_width != 16 && word_width != 32 && word_width != 64)
     {
+        throw out_of_range("Unknown parse table word width in Hoshi library");
+    }
 
-        unsigned char ch = *reinterpret_cast<unsigned char *>(&c);
-        if (ch >= first_data && c <= last_data)
+    function<void(void*&, int)> narrow = [&](void*& data, int count) -> void
+    {
+
+        void* narrow_data = new_table_words(word_width, count);
+
+        for (int i = 0; i < count; i++)
         {
-            os << ch;
-            continue;
+            set_table_word(word_width,
+                           narrow_data,
+                           i,
+                           get_table_word(prsd.word_width, data, i));
         }
 
-        os << escape;
-        os << static_cast<char>(first_data + (ch >> 4));
-        os << static_cast<char>(first_data + (ch & 0x0f));
+        delete_table_words(prsd.word_width, data);
+        data = narrow_data;
 
-    }
+    };
 
-    os << field_separator;
+    narrow(prsd.checked_data, prsd.checked_data_count);
+    narrow(prsd.default_data, prsd.default_data_count);
+
+    prsd.word_width = word_width;
 
 }
 
 //
-//  decode_string                               
-//  -------------                               
-//                                           
-//  Decode the ASCII encoding of an string. 
+//  handle_*_char_page_count
+//  ------------------------
+//
+//  Scanner field: char_page_count.
 //
 
-string ParserData::decode_string(const char*& next)
+void ParserData::handle_encode_char_page_count(const ParserData& prsd,
+                                               const BlockType block,
+                                               ostream& os)
 {
+    encode_int(prsd.char_page_count, os);
+}
 
-    string result;
+void ParserData::handle_decode_char_page_count(ParserData& prsd,
+                                               ParserTemp& temp,
+                                               const BlockType block,
+                                               const char*& next)
+{
+    prsd.char_page_count = decode_int(next);
+}
 
-    for (;;) 
+//
+//  handle_*_char_page_index
+//  ------------------------
+//
+//  Scanner field: char_page_index.
+//
+
+void ParserData::handle_encode_char_page_index(const ParserData& prsd,
+                                               const BlockType block,
+                                               ostream& os)
+{
+    
+    for (int i = 0; i < prsd.char_page_count; i++)
     {
+        encode_int(prsd.char_page_index[i], os);
+    }
 
-        if (*next == field_separator)
-        {
-            next++;
-            break;
-        }
-        else if (*next == escape)
-        {
-            unsigned char ch = *(next + 1) << 4 | *(next + 2);
-            result.push_back(*reinterpret_cast<char*>(&ch));
-            next += 3;
-        }
-        else if (*next >= first_data && *next <= last_data)
-        {
-            result.push_back(*next);
-            next++;
-        }
-        else
-        {
-            throw out_of_range("Invalid encoded string");
-        }
+}
 
-    }
+void ParserData::handle_decode_char_page_index(ParserData& prsd,
+                                               ParserTemp& temp,
+                                               const BlockType block,
+                                               const char*& next)
+{
 
-    return result;
+    prsd.char_page_index = new int32_t[prsd.char_page_count];
+
+    for (int i = 0; i < prsd.char_page_count; i++)
+    {
+        prsd.char_page_index[i] = decode_int(next);
+    }
 
 }
 
 //
-//  export_cpp                                                         
-//  ----------                                                         
-//                                                                     
-//  Export the object as a C++ string. Mostly useful for bootstrapping 
-//  where we have to create a parser without having the library yet.   
+//  handle_*_char_page_data_count
+//  -----------------------------
+//
+//  Scanner field: char_page_data_count.
 //
 
-void ParserData::export_cpp(string file_name, string identifier) const
+void ParserData::handle_encode_char_page_data_count(const ParserData& prsd,
+                                                    const BlockType block,
+                                                    ostream& os)
 {
+    encode_int(prsd.char_page_data_count, os);
+}
 
-    static const int max_width = 75;
-
-    ofstream os(file_name.c_str());
+void ParserData::handle_decode_char_page_data_count(ParserData& prsd,
+                                                    ParserTemp& temp,
+                                                    const BlockType block,
+                                                    const char*& next)
+{
+    prsd.char_page_data_count = decode_int(next);
+}
 
-    os << "static const char* " << identifier << " =" << endl
-       << "{" << endl;
+//
+//  handle_*_char_page_data
+//  -----------------------
+//
+//  Scanner field: char_page_data.
+//
 
-    os << "    \"";
-    int width = 5;
+void ParserData::handle_encode_char_page_data(const ParserData& prsd,
+                                              const BlockType block,
+                                              ostream& os)
+{
+    
+    for (int i = 0; i < prsd.char_page_data_count; i++)
+    {
+        encode_int(prsd.char_page_data[i], os);
+    }
+
+}
+
+void ParserData::handle_decode_char_page_data(ParserData& prsd,
+                                              ParserTemp& temp,
+                                              const BlockType block,
+                                              const char*& next)
+{
+
+    prsd.char_page_data = new int32_t[prsd.char_page_data_count];
+
+    for (int i = 0; i < prsd.char_page_data_count; i++)
+    {
+        prsd.char_page_data[i] = decode_int(next);
+    }
+
+}
+
+//
+//  handle_*_char_high_count
+//  ------------------------
+//
+//  Scanner field: char_high_count.
+//
+
+void ParserData::handle_encode_char_high_count(const ParserData& prsd,
+                                               const BlockType block,
+                                               ostream& os)
+{
+    encode_int(prsd.char_high_count, os);
+}
+
+void ParserData::handle_decode_char_high_count(ParserData& prsd,
+                                               ParserTemp& temp,
+                                               const BlockType block,
+                                               const char*& next)
+{
+    prsd.char_high_count = decode_int(next);
+}
+
+//
+//  handle_*_char_high_start
+//  ------------------------
+//
+//  Scanner field: char_high_start.
+//
+
+void ParserData::handle_encode_char_high_start(const ParserData& prsd,
+                                               const BlockType block,
+                                               ostream& os)
+{
+    
+    for (int i = 0; i < prsd.char_high_count; i++)
+    {
+        encode_int(prsd.char_high_start[i], os);
+    }
+
+}
+
+void ParserData::handle_decode_char_high_start(ParserData& prsd,
+                                               ParserTemp& temp,
+                                               const BlockType block,
+                                               const char*& next)
+{
+
+    prsd.char_high_start = new int64_t[prsd.char_high_count];
+
+    for (int i = 0; i < prsd.char_high_count; i++)
+    {
+        prsd.char_high_start[i] = decode_int(next);
+    }
+
+}
+
+//
+//  handle_*_char_high_class
+//  ------------------------
+//
+//  Scanner field: char_high_class.
+//
+
+void ParserData::handle_encode_char_high_class(const ParserData& prsd,
+                                               const BlockType block,
+                                               ostream& os)
+{
+    
+    for (int i = 0; i < prsd.char_high_count; i++)
+    {
+        encode_int(prsd.char_high_class[i], os);
+    }
+
+}
+
+void ParserData::handle_decode_char_high_class(ParserData& prsd,
+                                               ParserTemp& temp,
+                                               const BlockType block,
+                                               const char*& next)
+{
+
+    prsd.char_high_class = new int32_t[prsd.char_high_count];
+
+    for (int i = 0; i < prsd.char_high_count; i++)
+    {
+        prsd.char_high_class[i] = decode_int(next);
+    }
+
+}
+
+//
+//  handle_*_rule_kind
+//  ------------------
+//
+//  Grammar field: rule_kind.
+//
+
+void ParserData::handle_encode_rule_kind(const ParserData& prsd,
+                                         const BlockType block,
+                                         ostream& os)
+{
+
+    for (int i = 0; i < prsd.rule_count; i++)
+    {
+        encode_int(prsd.rule_kind[i], os);
+    }
+
+}
+
+void ParserData::handle_decode_rule_kind(ParserData& prsd,
+                                         ParserTemp& temp,
+                                         const BlockType block,
+                                         const char*& next)
+{
+
+    if (prsd.rule_kind == nullptr)
+    {
+        prsd.rule_kind = new int[prsd.rule_count];
+    }
+    
+    //
+    //  These are Ast kinds, so they must be translated through the kind 
+    //  map like the kind operands of instructions.                     
+    //
+
+    for (int i = 0; i < prsd.rule_count; i++)
+    {
+
+        int kind = decode_int(next);
+        if (kind < 0)
+        {
+            prsd.rule_kind[i] = -1;
+            continue;
+        }
+
+        if (temp.kind_map.find(kind) == temp.kind_map.end())
+        {
+            throw out_of_range("Version mismatch in Hoshi library");
+        }
+
+        prsd.rule_kind[i] = temp.kind_map[kind];
+
+    }
+
+}
+
+//
+//  handle_*_pipeline_scanner
+//  -------------------------
+//
+//  Grammar field: pipeline_scanner.
+//
+
+void ParserData::handle_encode_pipeline_scanner(const ParserData& prsd,
+                                                const BlockType block,
+                                                ostream& os)
+{
+    encode_int(prsd.pipeline_scanner, os);
+}
+
+void ParserData::handle_decode_pipeline_scanner(ParserData& prsd,
+                                                ParserTemp& temp,
+                                                const BlockType block,
+                                                const char*& next)
+{
+    prsd.pipeline_scanner = decode_int(next);
+}
+
+//
+//  handle_*_token_is_sync
+//  ----------------------
+//
+//  Grammar field: token_is_sync.
+//
+
+void ParserData::handle_encode_token_is_sync(const ParserData& prsd,
+                                             const BlockType block,
+                                             ostream& os)
+{
+
+    for (int i = 0; i < prsd.token_count; i++)
+    {
+        encode_int(prsd.token_is_sync[i], os);
+    }
+
+}
+
+void ParserData::handle_decode_token_is_sync(ParserData& prsd,
+                                             ParserTemp& temp,
+                                             const BlockType block,
+                                             const char*& next)
+{
+
+    prsd.token_is_sync = new bool[prsd.token_count];
+    
+    for (int i = 0; i < prsd.token_count; i++)
+    {
+        prsd.token_is_sync[i] = decode_int(next);
+    }
+
+}
+
+//
+//  handle_*_intern_lexemes
+//  -----------------------
+//
+//  Grammar field: intern_lexemes.
+//
+
+void ParserData::handle_encode_intern_lexemes(const ParserData& prsd,
+                                              const BlockType block,
+                                              ostream& os)
+{
+    encode_int(prsd.intern_lexemes, os);
+}
+
+void ParserData::handle_decode_intern_lexemes(ParserData& prsd,
+                                              ParserTemp& temp,
+                                              const BlockType block,
+                                              const char*& next)
+{
+    prsd.intern_lexemes = decode_int(next);
+}
+
+//
+//  handle_*_lazy_ast
+//  -----------------
+//
+//  Grammar field: lazy_ast.
+//
+
+void ParserData::handle_encode_lazy_ast(const ParserData& prsd,
+                                        const BlockType block,
+                                        ostream& os)
+{
+    encode_int(prsd.lazy_ast, os);
+}
+
+void ParserData::handle_decode_lazy_ast(ParserData& prsd,
+                                        ParserTemp& temp,
+                                        const BlockType block,
+                                        const char*& next)
+{
+    prsd.lazy_ast = decode_int(next);
+}
+
+//
+//  get_high_char_class                                                   
+//  -------------------                                                   
+//                                                                        
+//  Find the class of a character past the two-level table. There are    
+//  rarely more than one or two of these intervals.                       
+//
+
+int64_t ParserData::get_high_char_class(char32_t c) const
+{
+
+    int min = 0;
+    int max = char_high_count - 1;
+    int64_t char_class = 0;
+
+    while (min <= max)
+    {
+
+        int mid = min + (max - min) / 2;
+
+        if (char_high_start[mid] <= c)
+        {
+            char_class = char_high_class[mid];
+            min = mid + 1;
+        }
+        else
+        {
+            max = mid - 1;
+        }
+
+    }
+
+    return char_class;
+
+}
+
+//
+//  get_lazy_dfa                                                          
+//  ------------                                                          
+//                                                                        
+//  Find the lazy DFA, creating it on first use. Parsers on several       
+//  threads may get here at once, hence the once flag.                    
+//
+
+LazyDfa& ParserData::get_lazy_dfa(const VCodeOperand* operands)
+{
+
+    call_once(lazy_dfa_flag, [&]() -> void
+    {
+        lazy_dfa = new LazyDfa(operands);
+    });
+
+    return *lazy_dfa;
+
+}
+
+//
+//  get_rule_may_fail                                                     
+//  -----------------                                                     
+//                                                                        
+//  Find the rules whose Ast former can report an error. Only AstIndex    
+//  and AstChildSlice can, and a slice from a child counted from the      
+//  front to one counted from the back always fits. We walk each rule's   
+//  code up to its return and take any branch or call as a possible      
+//  failure rather than follow it.                                        
+//
+
+const vector<bool>& ParserData::get_rule_may_fail()
+{
+
+    call_once(rule_may_fail_flag, [&]() -> void
+    {
+
+        rule_may_fail.assign(rule_count, false);
+
+        for (int i = 0; i < rule_count; i++)
+        {
+
+            if (rule_kind[i] >= 0 || rule_pc[i] < 0)
+            {
+                continue;
+            }
+
+            for (int64_t pc = rule_pc[i]; pc < instruction_count; pc++)
+            {
+
+                const VCodeInstruction& instruction = instruction_list[pc];
+                const VCodeOperand* operands = operand_list + instruction.operand_offset;
+                int opcode = ParserEngine::get_vcode_opcode(instruction.handler);
+
+                if (opcode == OpcodeType::OpcodeReturn ||
+                    opcode == OpcodeType::OpcodeAstFinishReturn ||
+                    opcode == OpcodeType::OpcodeHalt)
+                {
+                    break;
+                }
+
+                if (opcode == OpcodeType::OpcodeAstIndex ||
+                    opcode == OpcodeType::OpcodeCall ||
+                    (opcode >= OpcodeType::OpcodeBranch &&
+                     opcode <= OpcodeType::OpcodeBranchGreaterEqual) ||
+                    (opcode == OpcodeType::OpcodeAstChildSlice &&
+                     (operands[1].integer < 0 || operands[2].integer >= 0)))
+                {
+                    rule_may_fail[i] = true;
+                    break;
+                }
+
+            }
+
+        }
+
+    });
+
+    return rule_may_fail;
+
+}
+
+//
+//  new_table_words                                                        
+//  ---------------                                                        
+//                                                                         
+//  Allocate parse table words of the given width, all marked empty.      
+//
+
+void* ParserData::new_table_words(int word_width, int count)
+{
+
+    void* data = nullptr;
+
+    switch (word_width)
+    {
+        case 16: data = new int16_t[count]; break;
+        case 32: data = new int32_t[count]; break;
+        default: data = new int64_t[count]; break;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        set_table_word(word_width, data, i, -1);
+    }
+
+    return data;
+
+}
+
+//
+//  delete_table_words                                         
+//  ------------------                                         
+//                                                             
+//  Free parse table words. We need the width to get the type. 
+//
+
+void ParserData::delete_table_words(int word_width, void*& data)
+{
+
+    switch (word_width)
+    {
+        case 16: delete [] static_cast<int16_t*>(data); break;
+        case 32: delete [] static_cast<int32_t*>(data); break;
+        default: delete [] static_cast<int64_t*>(data); break;
+    }
+
+    data = nullptr;
+
+}
+
+//
+//  get_table_word                                           
+//  --------------                                           
+//                                                           
+//  Read one parse table word, widened to 64 bits.           
+//
+
+int64_t ParserData::get_table_word(int word_width, const void* data, int index)
+{
+
+    switch (word_width)
+    {
+        case 16: return table_words<int16_t>(data)[index];
+        case 32: return table_words<int32_t>(data)[index];
+        default: return table_words<int64_t>(data)[index];
+    }
+
+}
+
+//
+//  set_table_word                                                         
+//  --------------                                                         
+//                                                                         
+//  Store one parse table word. The generator makes sure the value fits. 
+//
+
+void ParserData::set_table_word(int word_width, void* data, int index, int64_t value)
+{
+
+    switch (word_width)
+    {
+        case 16: static_cast<int16_t*>(data)[index] = static_cast<int16_t>(value); break;
+        case 32: static_cast<int32_t*>(data)[index] = static_cast<int32_t>(value); break;
+        default: static_cast<int64_t*>(data)[index] = value; break;
+    }
+
+}
+
+//
+//  encode_int                                                             
+//  ----------                                                             
+//                                                                         
+//  Encode an integer into a compact ASCII form. We use a long sequence of 
+//  ASCII characters as digits so the encoded numbers are quite short. The 
+//  number always ends with a field separator.                             
+//
+
+void ParserData::encode_int(int64_t i, ostream& os)
+{
+
+    bool negative = false;
+
+    if (i < 0)
+    {
+        negative = true;
+        i *= -1;
+    }
+
+    while (i > 0)
+    {
+        os << static_cast<char>(first_data + (i & 0x3f));
+        i >>= 6;
+    }
+
+    if (negative)
+    {
+        os << field_separator_negative;
+    }
+    else
+    {
+        os << field_separator;
+    }
+
+}
+
+//
+//  decode_int                               
+//  ----------                               
+//                                           
+//  Decode the ASCII encoding of an integer. 
+//
+
+int64_t ParserData::decode_int(const char*& next)
+{
+
+    int64_t result = 0;
+    int64_t shift = 0;
+
+    while (*next >= first_data && *next <= first_data + 0x3f)
+    {
+        result |= static_cast<int64_t>(*next - first_data) << shift;
+        shift += 6;
+        next++;
+    }
+
+    if (*next == field_separator_negative)
+    {
+        result *= -1;
+        next++;
+    }
+    else if (*next == field_separator)
+    {
+        next++;
+    }
+    else
+    {
+        throw out_of_range("Invalid encoded integer");
+    }
+
+    return result;
+
+}
+        
+//
+//  encode_string                                                        
+//  -------------                                                        
+//                                                                       
+//  Encode a UTF-8 string into ASCII. This isn't terribly compact but we 
+//  don't expect to have many non-ASCII characters.                      
+//
+
+void ParserData::encode_string(string s, ostream& os)
+{
+
+    for (auto c: s)
+    {
+
+        unsigned char ch = *reinterpret_cast<unsigned char *>(&c);
+        if (ch >= first_data && ch <= last_data)
+        {
+            os << ch;
+            continue;
+        }
+
+        os << escape;
+        os << static_cast<char>(first_data + (ch >> 4));
+        os << static_cast<char>(first_data + (ch & 0x0f));
+
+    }
+
+    os << field_separator;
+
+}
+
+//
+//  decode_string                               
+//  -------------                               
+//                                           
+//  Decode the ASCII encoding of an string. 
+//
+
+string ParserData::decode_string(const char*& next)
+{
+
+    string result;
+
+    for (;;) 
+    {
+
+        if (*next == field_separator)
+        {
+            next++;
+            break;
+        }
+        else if (*next == escape)
+        {
+            unsigned char ch = (*(next + 1) - first_data) << 4 | (*(next + 2) - first_data);
+            result.push_back(*reinterpret_cast<char*>(&ch));
+            next += 3;
+        }
+        else if (*next >= first_data && *next <= last_data)
+        {
+            result.push_back(*next);
+            next++;
+        }
+        else
+        {
+            throw out_of_range("Invalid encoded string");
+        }
+
+    }
+
+    return result;
+
+}
+
+//
+//  export_cpp                                                         
+//  ----------                                                         
+//                                                                     
+//  Export the object as a C++ string. Mostly useful for bootstrapping 
+//  where we have to create a parser without having the library yet.   
+//
+
+void ParserData::export_cpp(string file_name, string identifier) const
+{
+
+    static const int max_width = 75;
+
+    ofstream os(file_name.c_str());
+
+    os << "static const char* " << identifier << " =" << endl
+       << "{" << endl;
+
+    os << "    \"";
+    int width = 5;
 
     for (auto c: encode())
     {
@@ -2584,7 +3917,12 @@ void ParserData::export_cpp(string file_name, string identifier) const
             width = 5; 
         }
 
-        if (c == '"' || c == '\\')
+        //
+        //  Escaping question marks keeps a compiler with trigraphs turned 
+        //  on from reading things like ??! in the encoding.               
+        //
+
+        if (c == '"' || c == '\\' || c == '?')
         {
             os << '\\';
             width++;
@@ -8,8 +8,12 @@
 //
 
 #include <cstdint>
+#include <algorithm>
 #include <exception>
 #include <functional>
+#include <memory>
+#include <atomic>
+#include <thread>
 #include <string>
 #include <map>
 #include <iostream>
@@ -21,6 +25,7 @@
 #include "ParserImpl.H"
 #include "ParserData.H"
 #include "ParserEngine.H"
+#include "LazyDfa.H"
 
 //
 //  Namespace hoshi: Not indenting...
@@ -83,7 +88,14 @@ VCodeHandler ParserEngine::vcode_handler[] =
     handle_branch_less_than,        // BranchLessThan
     handle_branch_less_equal,       // BranchLessEqual
     handle_branch_greater_than,     // BranchGreaterThan
-    handle_branch_greater_equal     // BranchGreaterEqual
+    handle_branch_greater_equal,    // BranchGreaterEqual
+    handle_scan_class,              // ScanClass
+    handle_scan_keyword,            // ScanKeyword
+    handle_scan_class_memo,         // ScanClassMemo
+    handle_scan_lazy,               // ScanLazy
+    handle_ast_load_child,          // AstLoadChild
+    handle_ast_form_kind,           // AstFormKind
+    handle_ast_finish_return        // AstFinishReturn
 };
 
 struct ParserEngine::VCodeHandlerInfo ParserEngine::vcode_handler_info[] = 
@@ -163,7 +175,21 @@ struct ParserEngine::VCodeHandlerInfo ParserEngine::vcode_handler_info[] =
     {  handle_branch_greater_than,     OpcodeType::OpcodeBranchGreaterThan, 
        "handle_branch_greater_than",   "BranchGreaterThan"                       },
     {  handle_branch_greater_equal,    OpcodeType::OpcodeBranchGreaterEqual, 
-       "handle_branch_greater_equal",  "BranchGreaterEqual"                      }
+       "handle_branch_greater_equal",  "BranchGreaterEqual"                      },
+    {  handle_scan_class,              OpcodeType::OpcodeScanClass,         
+       "handle_scan_class",            "ScanClass"                               },
+    {  handle_scan_keyword,            OpcodeType::OpcodeScanKeyword,       
+       "handle_scan_keyword",          "ScanKeyword"                             },
+    {  handle_scan_class_memo,         OpcodeType::OpcodeScanClassMemo,     
+       "handle_scan_class_memo",       "ScanClassMemo"                           },
+    {  handle_scan_lazy,               OpcodeType::OpcodeScanLazy,          
+       "handle_scan_lazy",             "ScanLazy"                                },
+    {  handle_ast_load_child,          OpcodeType::OpcodeAstLoadChild,      
+       "handle_ast_load_child",        "AstLoadChild"                            },
+    {  handle_ast_form_kind,           OpcodeType::OpcodeAstFormKind,       
+       "handle_ast_form_kind",         "AstFormKind"                             },
+    {  handle_ast_finish_return,       OpcodeType::OpcodeAstFinishReturn,   
+       "handle_ast_finish_return",     "AstFinishReturn"                         }
 };
 
 //
@@ -316,10 +342,100 @@ ParserEngine::~ParserEngine()
 //  -----                                                                  
 //                                                                         
 //  Parse the provided source into an Ast. This is what all the other work 
-//  was leading up to.                                                     
+//  was leading up to. A parallel parse hands each engine one range of the 
+//  source, which must start and end on token boundaries.                  
 //
 
 void ParserEngine::parse()
+{
+    parse(0, src->length());
+}
+
+void ParserEngine::parse(int64_t start_loc, int64_t end_loc)
+{
+
+    //
+    //  run_parser
+    //  ----------
+    //
+    //  Run the parser with the table word width fixed, so we don't have 
+    //  to check it on each lookup.                                       
+    //
+
+    function<void()> run_parser = [&]() -> void
+    {
+
+        switch (prsd.word_width)
+        {
+            case 16: parse_actions<int16_t>(); break;
+            case 32: parse_actions<int32_t>(); break;
+            default: parse_actions<int64_t>(); break;
+        }
+
+    };
+
+    //
+    //  parse                          
+    //  -----                          
+    //                                 
+    //  The function body begins here. 
+    //
+
+    reset_vm(start_loc, end_loc);
+
+    //
+    //  With pipeline_scanner a second engine scans on its own thread. A  
+    //  VM trace from two threads would be unreadable, so when tracing we  
+    //  scan inline.                                                       
+    //
+
+    if (prsd.pipeline_scanner && (debug_flags & DebugType::DebugVCodeExec) == 0)
+    {
+
+        ErrorHandler scan_errh(*src);
+        Ast* scan_ast = nullptr;
+        ParserEngine scanner(prsi, scan_errh, prsd, *src, scan_ast, 0);
+        scanner.reset_vm(start_loc, end_loc);
+
+        unique_ptr<TokenRing> ring(new TokenRing());
+        thread scan_thread([&scanner, &ring]() -> void { scanner.scan_ahead(*ring); });
+        token_ring = ring.get();
+
+        try
+        {
+            run_parser();
+        }
+        catch (...)
+        {
+            ring->stopped.store(true, memory_order_relaxed);
+            scan_thread.join();
+            token_ring = nullptr;
+            throw;
+        }
+
+        ring->stopped.store(true, memory_order_relaxed);
+        scan_thread.join();
+        token_ring = nullptr;
+
+        vcode_count += scanner.vcode_count;
+
+    }
+    else
+    {
+        run_parser();
+    }
+
+}
+
+//
+//  reset_vm                                                             
+//  --------                                                             
+//                                                                       
+//  Set up the virtual machine and the scanner for a fresh parse. The    
+//  pipelined scanner's engine needs this too, though it never parses.   
+//
+
+void ParserEngine::reset_vm(int64_t start_loc, int64_t end_loc)
 {
 
     //
@@ -346,6 +462,20 @@ void ParserEngine::parse()
         ast_list[i] = nullptr;
     }
 
+    //
+    //  A batch reuses the engine, and a source that threw something other
+    //  than a SourceError can leave part of its parse on the stacks.
+    //
+
+    for (Ast* item: ast_stack)
+    {
+        delete item;
+    }
+
+    ast_stack.clear();
+    call_stack.clear();
+
+    vcode_count = 0;
     call_vm(0);
 
     //
@@ -361,7 +491,24 @@ void ParserEngine::parse()
     token_rear = 0;
     token_current = 0;
 
-    scan_next_loc = 0;
+    scan_next_loc = start_loc;
+    scan_end_loc = end_loc;
+    scan_trail.clear();
+    scan_failed_set.clear();
+    scan_failed_limit = -1;
+
+}
+
+//
+//  parse_actions                                                         
+//  -------------                                                         
+//                                                                        
+//  The parser proper, for parse tables with a particular word width.    
+//
+
+template <typename Word>
+void ParserEngine::parse_actions()
+{
 
     //
     //  Initialize the parse stacks. 
@@ -382,17 +529,23 @@ void ParserEngine::parse()
     int64_t rule_num;
     int64_t fallback_state;
 
-    decode_action(state,
-                  token_buffer[token_current].symbol_num,
-                  action_type,
-                  goto_state,
-                  rule_num,
-                  fallback_state);
+    decode_action<Word>(state,
+                        token_buffer[token_current].symbol_num,
+                        action_type,
+                        goto_state,
+                        rule_num,
+                        fallback_state);
 
     //
     //  Process parse actions until we see an eof. 
     //
 
+    const vector<bool>* rule_may_fail = nullptr;
+    if (reduce_log != nullptr)
+    {
+        rule_may_fail = &prsd.get_rule_may_fail();
+    }
+
     bool any_errors = false;
     for (;;)
     {
@@ -425,12 +578,12 @@ void ParserEngine::parse()
                 token_current = (token_current + 1) % (prsd.lookaheads + 1);
                 get_token();
                 
-                decode_action(state,
-                              token_buffer[token_current].symbol_num,
-                              action_type,
-                              goto_state,
-                              rule_num,
-                              fallback_state);
+                decode_action<Word>(state,
+                                    token_buffer[token_current].symbol_num,
+                                    action_type,
+                                    goto_state,
+                                    rule_num,
+                                    fallback_state);
 
                 continue;
 
@@ -452,16 +605,23 @@ void ParserEngine::parse()
                     cout << "Shift: " << goto_state << endl;
                 }
 
-                if (!any_errors)
+                if (!any_errors && reduce_log != nullptr)
                 {
 
-                    Ast* ast = new Ast(0);
-                    ast->set_kind(prsd.token_kind[token_buffer[token_rear].symbol_num]);
-                    ast->set_location(token_buffer[token_rear].location);
-                    ast->set_lexeme(token_buffer[token_rear].lexeme);
-                    ast_stack.push_back(ast);
+                    const Token& token = token_buffer[token_rear];
+
+                    reduce_log->action_list.push_back(token.symbol_num * 2);
+                    reduce_log->action_list.push_back(token.location);
+                    reduce_log->action_list.push_back(token.lexeme.size());
+                    reduce_log->lexeme_text.append(token.lexeme);
 
                 }
+                else if (!any_errors)
+                {
+                    ast_stack.push_back(new_token_ast(token_buffer[token_rear].symbol_num,
+                                                      token_buffer[token_rear].location,
+                                                      token_buffer[token_rear].lexeme));
+                }
 
                 state = goto_state;
                 state_stack.push_back(state);
@@ -470,12 +630,12 @@ void ParserEngine::parse()
                 token_current = token_rear;
                 get_token();
                 
-                decode_action(state,
-                              token_buffer[token_current].symbol_num,
-                              action_type,
-                              goto_state,
-                              rule_num,
-                              fallback_state);
+                decode_action<Word>(state,
+                                    token_buffer[token_current].symbol_num,
+                                    action_type,
+                                    goto_state,
+                                    rule_num,
+                                    fallback_state);
 
                 continue;
 
@@ -499,7 +659,21 @@ void ParserEngine::parse()
                     cout << "Reduce: " << prsd.rule_text[rule_num] << endl;
                 }
 
-                if (!any_errors)
+                if (!any_errors && reduce_log != nullptr)
+                {
+
+                    if (prsd.rule_kind[rule_num] >= 0 || prsd.rule_pc[rule_num] >= 0)
+                    {
+                        reduce_log->action_list.push_back(rule_num * 2 + 1);
+                        reduce_log->may_fail = reduce_log->may_fail || (*rule_may_fail)[rule_num];
+                    }
+
+                }
+                else if (!any_errors && prsd.rule_kind[rule_num] >= 0)
+                {
+                    reduce_inline(rule_num);
+                }
+                else if (!any_errors && prsd.rule_pc[rule_num] >= 0)
                 {
                     call_vm(prsd.rule_pc[rule_num]);
                 }
@@ -520,12 +694,12 @@ void ParserEngine::parse()
                     token_current = token_rear;
                     get_token();
                 
-                    decode_action(state,
-                                  token_buffer[token_current].symbol_num,
-                                  action_type,
-                                  goto_state,
-                                  rule_num,
-                                  fallback_state);
+                    decode_action<Word>(state,
+                                        token_buffer[token_current].symbol_num,
+                                        action_type,
+                                        goto_state,
+                                        rule_num,
+                                        fallback_state);
 
                 }
                 else
@@ -540,12 +714,12 @@ void ParserEngine::parse()
                     state = state_stack.back();
                     token_current = token_rear;
 
-                    decode_action(state,
-                                  prsd.rule_lhs[rule_num],
-                                  action_type,
-                                  goto_state,
-                                  rule_num,
-                                  fallback_state);
+                    decode_action<Word>(state,
+                                        prsd.rule_lhs[rule_num],
+                                        action_type,
+                                        goto_state,
+                                        rule_num,
+                                        fallback_state);
 
                 }
 
@@ -566,12 +740,12 @@ void ParserEngine::parse()
                 state = goto_state;
                 state_stack.push_back(state);
 
-                decode_action(state,
-                              token_buffer[token_current].symbol_num,
-                              action_type,
-                              goto_state,
-                              rule_num,
-                              fallback_state);
+                decode_action<Word>(state,
+                                    token_buffer[token_current].symbol_num,
+                                    action_type,
+                                    goto_state,
+                                    rule_num,
+                                    fallback_state);
 
                 continue;
 
@@ -601,12 +775,12 @@ void ParserEngine::parse()
                 token_current = token_rear;
                 get_token();
                 
-                decode_action(state,
-                              token_buffer[token_current].symbol_num,
-                              action_type,
-                              goto_state,
-                              rule_num,
-                              fallback_state);
+                decode_action<Word>(state,
+                                    token_buffer[token_current].symbol_num,
+                                    action_type,
+                                    goto_state,
+                                    rule_num,
+                                    fallback_state);
 
                 continue;
 
@@ -631,7 +805,7 @@ void ParserEngine::parse()
                 if (any_errors)
                 {
 
-                    ast = nullptr;
+                    *ast = nullptr;
 
                     for (Ast* ast: ast_stack)
                     {
@@ -640,11 +814,27 @@ void ParserEngine::parse()
 
                     ast_stack.clear();
 
+                    if (reduce_log != nullptr)
+                    {
+                        reduce_log->clear();
+                    }
+
                     throw SourceError("Source errors");
 
                 }
 
-                ast = ast_stack.back();
+                //
+                //  With lazy_ast there's nothing on the stack. The tree is 
+                //  built from the log when it's wanted.                    
+                //
+
+                if (reduce_log != nullptr)
+                {
+                    *ast = nullptr;
+                    break;
+                }
+
+                *ast = ast_stack.back();
                 ast_stack.pop_back();
 
                 for (Ast* ast: ast_stack)
@@ -694,7 +884,7 @@ void ParserEngine::parse()
                             continue;
                         }
 
-                        if (valid_symbol(state_stack, i))
+                        if (valid_symbol<Word>(state_stack, i))
                         {
                             valid_symbol_list.push_back(i);
                         }
@@ -753,7 +943,7 @@ void ParserEngine::parse()
   
                     }
 
-                    errh.add_error(ErrorType::ErrorSyntax,
+                    errh->add_error(ErrorType::ErrorSyntax,
                                    token_buffer[token_current].location,
                                    ost.str());
 
@@ -763,7 +953,7 @@ void ParserEngine::parse()
                 //  Clear the ast stack. 
                 //
 
-                ast = nullptr;
+                *ast = nullptr;
 
                 for (Ast* ast: ast_stack)
                 {
@@ -772,6 +962,11 @@ void ParserEngine::parse()
 
                 ast_stack.clear();
 
+                if (reduce_log != nullptr)
+                {
+                    reduce_log->clear();
+                }
+
                 //
                 //  If error recovery is turned off we are finished. 
                 //
@@ -793,12 +988,12 @@ void ParserEngine::parse()
                 token_current = token_rear;
                 get_token();
                 
-                decode_action(state,
-                              token_buffer[token_current].symbol_num,
-                              action_type,
-                              goto_state,
-                              rule_num,
-                              fallback_state);
+                decode_action<Word>(state,
+                                    token_buffer[token_current].symbol_num,
+                                    action_type,
+                                    goto_state,
+                                    rule_num,
+                                    fallback_state);
 
                 continue;
 
@@ -821,6 +1016,7 @@ void ParserEngine::parse()
 //  symbol to see if it is valid.                                        
 //
 
+template <typename Word>
 bool ParserEngine::valid_symbol(vector<int64_t>& base_state_stack, int symbol_num)
 {
 
@@ -832,12 +1028,12 @@ bool ParserEngine::valid_symbol(vector<int64_t>& base_state_stack, int symbol_nu
     int64_t rule_num;
     int64_t fallback_state;
 
-    decode_action(state,
-                  symbol_num,
-                  action_type,
-                  goto_state,
-                  rule_num,
-                  fallback_state);
+    decode_action<Word>(state,
+                        symbol_num,
+                        action_type,
+                        goto_state,
+                        rule_num,
+                        fallback_state);
 
     //
     //  Process parse actions until see a shift or error.
@@ -877,12 +1073,12 @@ bool ParserEngine::valid_symbol(vector<int64_t>& base_state_stack, int symbol_nu
 
                 state = state_stack.back();
 
-                decode_action(state,
-                              prsd.rule_lhs[rule_num],
-                              action_type,
-                              goto_state,
-                              rule_num,
-                              fallback_state);
+                decode_action<Word>(state,
+                                    prsd.rule_lhs[rule_num],
+                                    action_type,
+                                    goto_state,
+                                    rule_num,
+                                    fallback_state);
 
                 continue;
 
@@ -894,12 +1090,12 @@ bool ParserEngine::valid_symbol(vector<int64_t>& base_state_stack, int symbol_nu
                 state = goto_state;
                 state_stack.push_back(state);
 
-                decode_action(state,
-                              symbol_num,
-                              action_type,
-                              goto_state,
-                              rule_num,
-                              fallback_state);
+                decode_action<Word>(state,
+                                    symbol_num,
+                                    action_type,
+                                    goto_state,
+                                    rule_num,
+                                    fallback_state);
 
                 continue;
 
@@ -935,8 +1131,11 @@ bool ParserEngine::valid_symbol(vector<int64_t>& base_state_stack, int symbol_nu
 //  -------------                                                   
 //                                                                  
 //  For a given state and symbol number find the next parse action. 
+//  First we find the words holding the action, which depends on the 
+//  table scheme, then we pull the fields out of them.               
 //
 
+template <typename Word>
 void ParserEngine::decode_action(const int64_t state,
                                  const int symbol_num,
                                  ParseActionType& action_type,
@@ -945,24 +1144,80 @@ void ParserEngine::decode_action(const int64_t state,
                                  int64_t& fallback_state)
 {
 
+    const Word* checked_data = ParserData::table_words<Word>(prsd.checked_data);
+    const Word* data = nullptr;
     int64_t index = prsd.checked_index[state] + symbol_num * prsd.num_offsets;
 
-    if (prsd.checked_data[index] < 0)
+    switch (prsd.table_scheme)
     {
 
-        action_type = ParseActionType::ActionError;
-        goto_state = 0;
-        rule_num = 0;
-        fallback_state = 0;
+        case TableSchemeType::TableDisplacement:
+        {
 
-        return;
+            if (checked_data[index] >= 0 &&
+                ((checked_data[index + prsd.symbol_num_offset] >> prsd.symbol_num_shift) &
+                 prsd.symbol_num_mask) == symbol_num)
+            {
+                data = checked_data + index;
+            }
 
-    }
+            break;
+
+        }
+
+        case TableSchemeType::TableDefaults:
+        {
+
+            if ((prsd.action_bitmap[state * prsd.action_bitmap_width + symbol_num / 32] &
+                 (1u << (symbol_num % 32))) == 0)
+            {
+                break;
+            }
+
+            if (checked_data[index] >= 0 &&
+                ((checked_data[index + prsd.symbol_num_offset] >> prsd.symbol_num_shift) &
+                 prsd.symbol_num_mask) == symbol_num)
+            {
+                data = checked_data + index;
+            }
+            else
+            {
+                data = ParserData::table_words<Word>(prsd.default_data) +
+                       state * prsd.num_offsets;
+            }
+
+            break;
+
+        }
+
+        case TableSchemeType::TableComb:
+        {
+
+            if ((prsd.action_bitmap[state * prsd.action_bitmap_width + symbol_num / 32] &
+                 (1u << (symbol_num % 32))) != 0)
+            {
+                data = checked_data + index;
+            }
+
+            break;
+
+        }
+
+        case TableSchemeType::TableFull:
+        {
+
+            if (checked_data[index] >= 0)
+            {
+                data = checked_data + index;
+            }
 
-    int check_symbol_num = (prsd.checked_data[index + prsd.symbol_num_offset] >> prsd.symbol_num_shift) &
-                               prsd.symbol_num_mask;
+            break;
+
+        }
+
+    }
 
-    if (check_symbol_num != symbol_num)
+    if (data == nullptr)
     {
 
         action_type = ParseActionType::ActionError;
@@ -975,16 +1230,16 @@ void ParserEngine::decode_action(const int64_t state,
     }
 
     action_type = static_cast<ParseActionType>(
-                      (prsd.checked_data[index + prsd.action_type_offset] >> prsd.action_type_shift) &
+                      (data[prsd.action_type_offset] >> prsd.action_type_shift) &
                       prsd.action_type_mask);
     
-    rule_num = (prsd.checked_data[index + prsd.rule_num_offset] >> prsd.rule_num_shift) &
+    rule_num = (data[prsd.rule_num_offset] >> prsd.rule_num_shift) &
                prsd.rule_num_mask;
 
-    goto_state = (prsd.checked_data[index + prsd.state_num_offset] >> prsd.state_num_shift) &
+    goto_state = (data[prsd.state_num_offset] >> prsd.state_num_shift) &
                  prsd.state_num_mask;
     
-    fallback_state = (prsd.checked_data[index + prsd.fallback_num_offset] >> prsd.fallback_num_shift) &
+    fallback_state = (data[prsd.fallback_num_offset] >> prsd.fallback_num_shift) &
                      prsd.fallback_num_mask;
     
 }
@@ -994,7 +1249,9 @@ void ParserEngine::decode_action(const int64_t state,
 //  ---------                                                            
 //                                                                       
 //  Main scanner facility. Get one token from the input stream and place 
-//  it in our token buffer.                                              
+//  it in our token buffer. The scanner leaves lexical errors with the   
+//  token and we report them here, so they come out in the same order    
+//  whether we scanned the token ourselves or took it from the ring.     
 //
 
 void ParserEngine::get_token()
@@ -1005,7 +1262,47 @@ void ParserEngine::get_token()
         return;
     }
 
-    call_vm(prsd.scanner_pc);
+    if (token_ring == nullptr)
+    {
+        call_vm(prsd.scanner_pc);
+    }
+    else if (token_ring->at_eof)
+    {
+        token_buffer[token_front].symbol_num = prsd.eof_symbol_num;
+        token_buffer[token_front].lexeme.clear();
+        token_buffer[token_front].location = -1;
+        token_buffer[token_front].error_message.clear();
+        token_front = (token_front + 1) % (prsd.lookaheads + 1);
+    }
+    else
+    {
+
+        int64_t tail = token_ring->tail.load(memory_order_relaxed);
+        while (token_ring->seen_head == tail)
+        {
+
+            token_ring->seen_head = token_ring->head.load(memory_order_acquire);
+            if (token_ring->seen_head == tail)
+            {
+                this_thread::yield();
+            }
+
+        }
+
+        swap(token_buffer[token_front], token_ring->token_list[tail % token_ring_size]);
+        token_ring->tail.store(tail + 1, memory_order_release);
+
+        token_ring->at_eof = token_buffer[token_front].symbol_num == prsd.eof_symbol_num;
+        token_front = (token_front + 1) % (prsd.lookaheads + 1);
+
+    }
+
+    if (token_buffer[token_current].error_message.size() > 0)
+    {
+        errh->add_error(ErrorType::ErrorLexical,
+                       token_buffer[token_current].error_location,
+                       token_buffer[token_current].error_message);
+    }
 
     if ((debug_flags & DebugType::DebugScanToken) != 0)
     {
@@ -1024,15 +1321,286 @@ void ParserEngine::get_token()
 
 }
 
+//
+//  scan_ahead                                                            
+//  ----------                                                            
+//                                                                        
+//  The producer side of the pipelined scanner. We run in the scanner's   
+//  own engine, scanning one token at a time into the front of our token  
+//  buffer and moving it to the ring. We stop at the end of the source or 
+//  when the parser tells us it's done.                                   
+//
+
+void ParserEngine::scan_ahead(TokenRing& ring)
+{
+
+    while (!ring.stopped.load(memory_order_relaxed))
+    {
+
+        token_front = 0;
+        token_rear = 0;
+        call_vm(prsd.scanner_pc);
+
+        bool at_eof = token_buffer[0].symbol_num == prsd.eof_symbol_num;
+
+        int64_t head = ring.head.load(memory_order_relaxed);
+        while (head - ring.seen_tail >= token_ring_size)
+        {
+
+            ring.seen_tail = ring.tail.load(memory_order_acquire);
+            if (head - ring.seen_tail < token_ring_size)
+            {
+                break;
+            }
+
+            if (ring.stopped.load(memory_order_relaxed))
+            {
+                return;
+            }
+
+            this_thread::yield();
+
+        }
+
+        swap(ring.token_list[head % token_ring_size], token_buffer[0]);
+        ring.head.store(head + 1, memory_order_release);
+
+        if (at_eof)
+        {
+            return;
+        }
+
+    }
+
+}
+
+//
+//  scan_sync_points                                                      
+//  ----------------                                                      
+//                                                                        
+//  The prescan for a parallel parse. We scan the whole source without    
+//  parsing and pass the location of a sync token to the caller whenever  
+//  we're at least chunk_length past the last one we passed on. Lexical   
+//  errors are left for the chunk parsers to report.                      
+//
+
+void ParserEngine::scan_sync_points(int64_t chunk_length,
+                                    const function<void(int64_t)>& cut)
+{
+
+    reset_vm(0, src->length());
+
+    int64_t last_cut = 0;
+
+    for (;;)
+    {
+
+        token_front = 0;
+        token_rear = 0;
+        call_vm(prsd.scanner_pc);
+
+        const Token& token = token_buffer[0];
+        if (token.symbol_num == prsd.eof_symbol_num)
+        {
+            return;
+        }
+
+        if (prsd.token_is_sync[token.symbol_num] &&
+            token.location - last_cut >= chunk_length)
+        {
+            cut(token.location);
+            last_cut = token.location;
+        }
+
+    }
+
+}
+
+//
+//  new_token_ast                                                         
+//  -------------                                                         
+//                                                                        
+//  Create the Ast a shift pushes on the stack.                           
+//
+
+Ast* ParserEngine::new_token_ast(int symbol_num, int64_t location, const string& lexeme)
+{
+
+    Ast* ast = new Ast(0);
+    ast->set_kind(prsd.token_kind[symbol_num]);
+    ast->set_location(location);
+
+    if (prsd.intern_lexemes && lexeme_table != nullptr && !lexeme.empty())
+    {
+        ast->set_lexeme(*lexeme_table, lexeme_table->intern(lexeme));
+    }
+    else
+    {
+        ast->set_lexeme(lexeme);
+    }
+
+    return ast;
+
+}
+
+//
+//  replay                                                                
+//  ------                                                                
+//                                                                        
+//  Build the Ast of a lazy_ast parse from its log. We run each logged    
+//  shift and reduce through the same code the parser would have, so the  
+//  tree is the one an ordinary parse gives. Errors from the Ast formers  
+//  are reported here rather than during the parse.                       
+//
+
+void ParserEngine::replay(const ReduceLog& log,
+                          ErrorHandler& errh,
+                          Ast*& ast,
+                          LexemeTable* lexeme_table)
+{
+
+    this->errh = &errh;
+    this->ast = &ast;
+    this->lexeme_table = lexeme_table;
+    this->reduce_log = nullptr;
+
+    reset_vm(0, 0);
+
+    size_t lexeme_offset = 0;
+    string lexeme;
+
+    for (size_t i = 0; i < log.action_list.size(); i++)
+    {
+
+        int64_t entry = log.action_list[i];
+
+        if ((entry & 1) == 0)
+        {
+
+            int64_t location = log.action_list[++i];
+            size_t lexeme_length = log.action_list[++i];
+
+            lexeme.assign(log.lexeme_text, lexeme_offset, lexeme_length);
+            lexeme_offset += lexeme_length;
+
+            ast_stack.push_back(new_token_ast(entry / 2, location, lexeme));
+
+            continue;
+
+        }
+
+        int64_t rule_num = entry / 2;
+
+        if (prsd.rule_kind[rule_num] >= 0)
+        {
+            reduce_inline(rule_num);
+        }
+        else
+        {
+            call_vm(prsd.rule_pc[rule_num]);
+        }
+
+    }
+
+    ast = nullptr;
+
+    if (!ast_stack.empty())
+    {
+        ast = ast_stack.back();
+        ast_stack.pop_back();
+    }
+
+    for (Ast* item: ast_stack)
+    {
+        delete item;
+    }
+
+    ast_stack.clear();
+
+}
+
+//
+//  reduce_inline                                                         
+//  -------------                                                         
+//                                                                        
+//  Do the work of a rule whose action is the default Ast former without  
+//  calling the virtual machine. The rhs items become the children of a   
+//  new Ast and the new Ast replaces them on the stack. This is what the  
+//  AstStart, AstLoadChild, AstFormKind and AstFinishReturn code would    
+//  do, since each rhs item is used just once.                            
+//
+
+void ParserEngine::reduce_inline(int64_t rule_num)
+{
+
+    int num_children = prsd.rule_size[rule_num];
+    Ast* ast = new Ast(num_children);
+
+    auto first = ast_stack.end() - num_children;
+
+    int64_t ast_location = -1;
+    for (auto it = first; it < ast_stack.end() && ast_location < 0; it++)
+    {
+        ast_location = (*it)->get_location();
+    }
+
+    ast->set_location(ast_location);
+    ast->set_kind(prsd.rule_kind[rule_num]);
+
+    for (int i = 0; i < num_children; i++)
+    {
+        ast->set_child(i, *(first + i));
+    }
+
+    ast_stack.erase(first, ast_stack.end());
+    ast_stack.push_back(ast);
+
+}
+
 //
 //  call_vm                                                               
 //  -------                                                               
 //                                                                        
 //  Run the virtual machine starting at a specified program counter until 
-//  we see a halt or return.                                              
+//  we see a halt or return. This loop runs for every token and every     
+//  reduction, so the tracing lives elsewhere.                            
 //
 
 void ParserEngine::call_vm(int64_t pc)
+{
+
+    bool trace = (debug_flags & DebugType::DebugVCodeExec) != 0;
+
+    call_stack.push_back(-1);
+    while (pc >= 0)
+    {
+
+        if (trace)
+        {
+            dump_vcode_instruction(pc);
+        }
+
+        vcode_count++;
+
+        int64_t last_pc = pc++;
+        (prsd.instruction_list[last_pc].handler)(
+            *this,
+            prsd.operand_list + prsd.instruction_list[last_pc].operand_offset, 
+            pc,
+            prsd.instruction_list[last_pc].location);
+
+    }
+    
+}
+
+//
+//  dump_vcode_instruction                                            
+//  ----------------------                                            
+//                                                                    
+//  Trace the instruction at a program counter as call_vm executes it. 
+//
+
+void ParserEngine::dump_vcode_instruction(int64_t pc)
 {
 
     const int max_line_width = 95;
@@ -1233,226 +1801,329 @@ void ParserEngine::call_vm(int64_t pc)
     };
 
     //
-    //  call_vm
-    //  -------
+    //  dump_vcode_instruction
+    //  ----------------------
     //                                 
     //  The function body begins here. 
     //
 
-    call_stack.push_back(-1);
-    while (pc >= 0)
-    {
-
-        if ((debug_flags & DebugType::DebugVCodeExec) != 0)
-        {
+    VCodeInstruction instruction = prsd.instruction_list[pc];
 
-            VCodeInstruction instruction = prsd.instruction_list[pc];
+    ost.str("");
+    dump_line_num(pc);
+    dump_opcode(get_vcode_name(instruction.handler));
 
-            ost.str("");
-            dump_line_num(pc);
-            dump_opcode(get_vcode_name(instruction.handler));
+    //
+    //  Dump all the operands. 
+    //
 
-            //
-            //  Dump all the operands. 
-            //
+    switch (get_vcode_opcode(instruction.handler))
+    {
 
-            switch (get_vcode_opcode(instruction.handler))
+        case OpcodeCall:
+        case OpcodeBranch:
+        {
+        
+            int operand = 0;
+            dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeScanChar:
+        {
+        
+            int operand = 0;
+        
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand]));
+            for (int i = 0; i < prsd.operand_list[instruction.operand_offset + operand].integer; i++)    {
+        
+                dump_operand(character_string(prsd.operand_list[instruction.operand_offset + operand + 3 * i + 1]));
+                dump_operand(character_string(prsd.operand_list[instruction.operand_offset + operand + 3 * i + 2]));
+                dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand + 3 * i + 3]));
+        
+            }
+        
+            operand += prsd.operand_list[instruction.operand_offset + operand].integer * 3 + 1;
+            break;
+        
+        }
+        
+        case OpcodeScanClass:
+        case OpcodeScanClassMemo:
+        {
+        
+            int operand = 0;
+        
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand]));
+            for (int i = 0; i < prsd.operand_list[instruction.operand_offset + operand].integer; i++)
             {
-
-                case OpcodeCall:
-                case OpcodeBranch:
-                {
-                
-                    int operand = 0;
-                    dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
-                }
-                
-                case OpcodeScanChar:
-                {
-                
-                    int operand = 0;
-                
-                    dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand]));
-                    for (int i = 0; i < prsd.operand_list[instruction.operand_offset + operand].integer; i++)    {
-                
-                        dump_operand(character_string(prsd.operand_list[instruction.operand_offset + operand + 3 * i + 1]));
-                        dump_operand(character_string(prsd.operand_list[instruction.operand_offset + operand + 3 * i + 2]));
-                        dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand + 3 * i + 3]));
-                
-                    }
-                
-                    operand += prsd.operand_list[instruction.operand_offset + operand].integer * 3 + 1;
-                    break;
-                
-                }
-                
-                case OpcodeScanAccept:
+        
+                if (prsd.operand_list[instruction.operand_offset + operand + i + 1].branch_target < 0)
                 {
-                
-                    int operand = 0;
-                    dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
+                    dump_operand("-");
                 }
-                
-                case OpcodeScanError:
-                case OpcodeAstLexemeString:
+                else
                 {
-                
-                    int operand = 0;
-                    dump_operand(string_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
+                    dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand + i + 1]));
                 }
+        
+            }
+        
+            operand += prsd.operand_list[instruction.operand_offset + operand].integer + 1;
+            break;
+        
+        }
+        
+        case OpcodeScanKeyword:
+        {
+        
+            int operand = 0;
+        
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            int64_t bucket_count = prsd.operand_list[instruction.operand_offset + operand].integer;
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            for (int i = 0; i < bucket_count; i++)
+            {
+                dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            }
+        
+            int64_t slot_count = prsd.operand_list[instruction.operand_offset + operand].integer;
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            for (int i = 0; i < slot_count; i++)
+            {
+                dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+                dump_operand(string_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            }
+        
+            break;
+        
+        }
+        
+        case OpcodeScanLazy:
+        {
+        
+            int operand = 0;
+        
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand]));
+            int64_t accept_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+            for (int i = 0; i < accept_count; i++)
+            {
+                dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+                dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand++]));
                 
-                case OpcodeAstStart:
-                case OpcodeAstNew:
+                if (prsd.operand_list[instruction.operand_offset + operand].branch_target < 0)
                 {
-                
-                    int operand = 0;
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
+                    dump_operand("-");
                 }
-                
-                case OpcodeAstFinish:
-                case OpcodeAstLocationNum:
+                else
                 {
-                
-                    int operand = 0;
-                    dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
+                    dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand]));
                 }
                 
-                case OpcodeAstForm:
-                {
+                operand++;
                 
-                    int operand = 0;
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
-                }
-                
-                case OpcodeAstLoad:
+            }
+        
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand]));
+            int64_t state_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+            for (int i = 0; i < state_count; i++)
+            {
+        
+                dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand]));
+                int64_t e_move_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int j = 0; j < e_move_count; j++)
                 {
-                
-                    int operand = 0;
-                    dump_operand(ast_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
                     dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
                 }
-                
-                case OpcodeAstIndex:
+        
+                dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand]));
+                int64_t transition_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int j = 0; j < transition_count; j++)
                 {
-                
-                    int operand = 0;
-                    dump_operand(ast_string(prsd.operand_list[instruction.operand_offset + operand++]));
+                    dump_operand(character_string(prsd.operand_list[instruction.operand_offset + operand++]));
+                    dump_operand(character_string(prsd.operand_list[instruction.operand_offset + operand++]));
                     dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
-                }
-                
-                case OpcodeAstChild:
-                case OpcodeAstKind:
-                case OpcodeAstLocation:
-                case OpcodeAstLexeme:
-                {
-                
-                    int operand = 0;
-                    dump_operand(ast_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
                 }
-                
-                case OpcodeAstChildSlice:
+        
+                dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand]));
+                int64_t accept_num_count = prsd.operand_list[instruction.operand_offset + operand++].integer;
+                for (int j = 0; j < accept_num_count; j++)
                 {
-                
-                    int operand = 0;
-                    dump_operand(ast_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
                     dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
-                }
-                
-                case OpcodeAstKindNum:
-                {
-                
-                    int operand = 0;
-                    dump_operand(kind_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
                 }
-                
-                case OpcodeAssign:
-                case OpcodeUnaryMinus:
-                {
-                
-                    int operand = 0;
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
-                }
-                
-                case OpcodeAdd:
-                case OpcodeSubtract:
-                case OpcodeMultiply:
-                case OpcodeDivide:
-                {
-                
-                    int operand = 0;
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
-                }
-                
-                case OpcodeBranchEqual:
-                case OpcodeBranchNotEqual:
-                case OpcodeBranchLessThan:
-                case OpcodeBranchLessEqual:
-                case OpcodeBranchGreaterThan:
-                case OpcodeBranchGreaterEqual:
-                {
-                
-                    int operand = 0;
-                    dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
-                    break;
-                
-                }
-                
+        
             }
-
-            cout << ost.str() << endl;
-
+        
+            break;
+        
+        }
+        
+        case OpcodeScanAccept:
+        {
+        
+            int operand = 0;
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeScanError:
+        case OpcodeAstLexemeString:
+        {
+        
+            int operand = 0;
+            dump_operand(string_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAstStart:
+        case OpcodeAstNew:
+        {
+        
+            int operand = 0;
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAstFinish:
+        case OpcodeAstFinishReturn:
+        case OpcodeAstLocationNum:
+        {
+        
+            int operand = 0;
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
         }
+        
+        case OpcodeAstForm:
+        {
+        
+            int operand = 0;
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAstFormKind:
+        {
+        
+            int operand = 0;
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(kind_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAstLoad:
+        case OpcodeAstLoadChild:
+        {
+        
+            int operand = 0;
+            dump_operand(ast_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAstIndex:
+        {
+        
+            int operand = 0;
+            dump_operand(ast_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAstChild:
+        case OpcodeAstKind:
+        case OpcodeAstLocation:
+        case OpcodeAstLexeme:
+        {
+        
+            int operand = 0;
+            dump_operand(ast_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAstChildSlice:
+        {
+        
+            int operand = 0;
+            dump_operand(ast_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(integer_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAstKindNum:
+        {
+        
+            int operand = 0;
+            dump_operand(kind_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAssign:
+        case OpcodeUnaryMinus:
+        {
+        
+            int operand = 0;
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeAdd:
+        case OpcodeSubtract:
+        case OpcodeMultiply:
+        case OpcodeDivide:
+        {
+        
+            int operand = 0;
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+        case OpcodeBranchEqual:
+        case OpcodeBranchNotEqual:
+        case OpcodeBranchLessThan:
+        case OpcodeBranchLessEqual:
+        case OpcodeBranchGreaterThan:
+        case OpcodeBranchGreaterEqual:
+        {
+        
+            int operand = 0;
+            dump_operand(label_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            dump_operand(register_string(prsd.operand_list[instruction.operand_offset + operand++]));
+            break;
+        
+        }
+        
+    }
 
-        //
-        //  All that debugging code kind of obscures the point of this 
-        //  function. Here we are ready to interpret the VMCode.       
-        //
-
-        int64_t last_pc = pc++;
-        (prsd.instruction_list[last_pc].handler)(
-            *this,
-            prsd.operand_list + prsd.instruction_list[last_pc].operand_offset, 
-            pc,
-            prsd.instruction_list[last_pc].location);
+    cout << ost.str() << endl;
 
-    }
-    
 }
 
 //
@@ -1697,7 +2368,7 @@ void ParserEngine::handle_scan_start(ParserEngine& prse,
     //  return. This is an early exit from the scanning code.              
     //
 
-    if (prse.scan_next_loc >= prse.src.length())
+    if (prse.scan_next_loc >= prse.scan_end_loc)
     {
 
         if ((prse.token_front + 1) % (prse.prsd.lookaheads + 1) == prse.token_rear)
@@ -1709,6 +2380,7 @@ void ParserEngine::handle_scan_start(ParserEngine& prse,
         prse.token_buffer[prse.token_front].symbol_num = prse.prsd.eof_symbol_num;
         prse.token_buffer[prse.token_front].lexeme.clear();
         prse.token_buffer[prse.token_front].location = -1;
+        prse.token_buffer[prse.token_front].error_message.clear();
 
         prse.token_front = (prse.token_front + 1) % (prse.prsd.lookaheads + 1);
 
@@ -1728,6 +2400,19 @@ void ParserEngine::handle_scan_start(ParserEngine& prse,
     prse.scan_accept_pc = -1;
     prse.scan_accept_symbol_num = -1;
 
+    //
+    //  Failures we remember all lie ahead of the start of some earlier 
+    //  token. Once we are past all of them the set is dead weight, and  
+    //  swapping with an empty set is cheaper than clearing the buckets. 
+    //
+
+    prse.scan_trail.clear();
+
+    if (prse.scan_start_loc > prse.scan_failed_limit && !prse.scan_failed_set.empty())
+    {
+        unordered_set<uint64_t>().swap(prse.scan_failed_set);
+    }
+
 }
 
 //
@@ -1747,6 +2432,7 @@ void ParserEngine::handle_scan_accept(ParserEngine& prse,
     prse.scan_accept_loc = prse.scan_next_loc;
     prse.scan_accept_symbol_num = operands[0].integer;
     prse.scan_accept_pc = operands[1].branch_target;
+    prse.scan_trail.clear();
 }
 
 //
@@ -1781,7 +2467,7 @@ void ParserEngine::handle_scan_token(ParserEngine& prse,
     if (prse.prsd.token_lexeme_needed[prse.scan_accept_symbol_num])
     {
         prse.token_buffer[prse.token_front].lexeme =
-            prse.src.get_string(prse.scan_start_loc, prse.scan_accept_loc);
+            prse.src->get_string(prse.scan_start_loc, prse.scan_accept_loc);
     }
     else
     {
@@ -1789,6 +2475,7 @@ void ParserEngine::handle_scan_token(ParserEngine& prse,
     }
 
     prse.token_buffer[prse.token_front].location = prse.scan_start_loc;
+    prse.token_buffer[prse.token_front].error_message.clear();
     prse.token_front = (prse.token_front + 1) % (prse.prsd.lookaheads + 1);
 
 }
@@ -1797,7 +2484,8 @@ void ParserEngine::handle_scan_token(ParserEngine& prse,
 //  handle_scan_error                       
 //  -----------------                       
 //                                               
-//  Generate an error for a token.
+//  Generate an error token. The message goes with the token and get_token
+//  reports it.
 //
 
 void ParserEngine::handle_scan_error(ParserEngine& prse,
@@ -1806,14 +2494,6 @@ void ParserEngine::handle_scan_error(ParserEngine& prse,
                                      int64_t location)
 {
 
-    //
-    //  Create an error message. 
-    //
-
-    prse.errh.add_error(ErrorType::ErrorLexical,
-                        prse.scan_start_loc,
-                        prse.prsd.string_list[operands[0].string_num]);
-
     //
     //  A buffer full situation is a program error. 
     //
@@ -1830,8 +2510,11 @@ void ParserEngine::handle_scan_error(ParserEngine& prse,
 
     prse.token_buffer[prse.token_front].symbol_num = prse.prsd.error_symbol_num;
     prse.token_buffer[prse.token_front].lexeme =
-        prse.src.get_string(prse.scan_start_loc, prse.scan_accept_loc);
+        prse.src->get_string(prse.scan_start_loc, prse.scan_accept_loc);
     prse.token_buffer[prse.token_front].location = prse.scan_start_loc;
+    prse.token_buffer[prse.token_front].error_message =
+        prse.prsd.string_list[operands[0].string_num];
+    prse.token_buffer[prse.token_front].error_location = prse.scan_start_loc;
 
     prse.token_front = (prse.token_front + 1) % (prse.prsd.lookaheads + 1);
 
@@ -1843,9 +2526,9 @@ void ParserEngine::handle_scan_error(ParserEngine& prse,
 //                                                                        
 //  Handle the state transitions in the DFA. The state is represented by  
 //  our position in the VM instructions, here we look for a branch target 
-//  for the incoming character. If we find it we make that transition. If 
-//  not and we passed an accepting state we go back to it. Otherwise we   
-//  have a scanning error.                                                
+//  for the incoming character. If we find it we make that transition.    
+//  The scanner generator emits this rather than ScanClass for states     
+//  with a few ranges spanning many classes, where it's shorter.          
 //
 
 void ParserEngine::handle_scan_char(ParserEngine& prse,
@@ -1858,9 +2541,10 @@ void ParserEngine::handle_scan_char(ParserEngine& prse,
     //  Try to consume the next character and advance to the next state. 
     //
 
-    if (prse.scan_next_loc < prse.src.length())
+    if (prse.scan_next_loc < prse.scan_end_loc)
     {
 
+        char32_t c = prse.src->get_char(prse.scan_next_loc);
         int64_t min = 0;
         int64_t max = operands[0].integer - 1;
 
@@ -1868,11 +2552,11 @@ void ParserEngine::handle_scan_char(ParserEngine& prse,
         {
 
             int64_t mid = min + (max - min) / 2;
-            if (prse.src.get_char(prse.scan_next_loc) < operands[mid * 3 + 1].character)
+            if (c < operands[mid * 3 + 1].character)
             {
                 max = mid - 1;
             }
-            else if (prse.src.get_char(prse.scan_next_loc) > operands[mid * 3 + 2].character)
+            else if (c > operands[mid * 3 + 2].character)
             {
                 min = mid + 1;
             }
@@ -1887,9 +2571,260 @@ void ParserEngine::handle_scan_char(ParserEngine& prse,
 
     }
 
+    scan_no_transition(prse, pc);
+
+}
+
+//
+//  handle_scan_class                                                     
+//  -----------------                                                     
+//                                                                        
+//  Like handle_scan_char, but the character is first mapped to its       
+//  equivalence class through the two-level table in ParserData, and the  
+//  state keeps a dense slice of branch targets indexed by class. The     
+//  operands are the first class, the number of classes and then one      
+//  target per class, -1 where there is no transition.                    
+//
+
+void ParserEngine::handle_scan_class(ParserEngine& prse,
+                                     const VCodeOperand* operands,
+                                     int64_t& pc,
+                                     int64_t location)
+{
+
+    if (prse.scan_next_loc < prse.scan_end_loc)
+    {
+
+        int64_t char_class = prse.prsd.get_char_class(prse.src->get_char(prse.scan_next_loc)) -
+                             operands[0].integer;
+
+        if (char_class >= 0 && char_class < operands[1].integer &&
+            operands[char_class + 2].branch_target >= 0)
+        {
+            pc = operands[char_class + 2].branch_target;
+            prse.scan_next_loc++;
+            return;
+        }
+
+    }
+
+    scan_no_transition(prse, pc);
+
+}
+
+//
+//  handle_scan_keyword                                                   
+//  -------------------                                                   
+//                                                                        
+//  The token just accepted may be a keyword that was left out of the    
+//  DFA. Look the lexeme up in the perfect hash table in the operands and 
+//  switch to the keyword's symbol if we find it. The operands are the    
+//  case sensitivity flag, the bucket count, a seed for each bucket, the  
+//  slot count, and then a symbol number and string for each slot, with   
+//  -1 in empty slots. The scanner generator only puts ASCII literals in  
+//  the table, so each byte of a keyword is one code point.              
+//
+
+void ParserEngine::handle_scan_keyword(ParserEngine& prse,
+                                       const VCodeOperand* operands,
+                                       int64_t& pc,
+                                       int64_t location)
+{
+
+    bool case_sensitive = operands[0].integer != 0;
+    int64_t bucket_count = operands[1].integer;
+    int64_t slot_count = operands[bucket_count + 2].integer;
+    const VCodeOperand* slot_list = operands + bucket_count + 3;
+
+    uint64_t hash = keyword_hash_basis;
+    for (int64_t loc = prse.scan_start_loc; loc < prse.scan_accept_loc; loc++)
+    {
+        hash = hash_keyword_char(hash, fold_keyword_char(prse.src->get_char(loc), case_sensitive));
+    }
+
+    int64_t seed = operands[((hash >> 32) & (bucket_count - 1)) + 2].integer;
+    const VCodeOperand* slot = slot_list + 2 * (hash_keyword_slot(hash, seed) & (slot_count - 1));
+
+    if (slot[0].integer < 0)
+    {
+        return;
+    }
+
+    const string& keyword = prse.prsd.string_list[slot[1].string_num];
+    if (keyword.length() != prse.scan_accept_loc - prse.scan_start_loc)
+    {
+        return;
+    }
+
+    for (int64_t i = 0; i < keyword.length(); i++)
+    {
+
+        if (fold_keyword_char(static_cast<char32_t>(static_cast<unsigned char>(keyword[i])), case_sensitive) !=
+            fold_keyword_char(prse.src->get_char(prse.scan_start_loc + i), case_sensitive))
+        {
+            return;
+        }
+
+    }
+
+    prse.scan_accept_symbol_num = slot[0].integer;
+
+}
+
+//
+//  handle_scan_class_memo                                                
+//  ----------------------                                                
+//                                                                        
+//  A ScanClass for linear scan mode. If we have been in this state at    
+//  this location before and found no accepting state ahead of it, we'll  
+//  find none this time either, so we stop right away. Otherwise we note  
+//  that we were here and make the transition as usual. The scanner       
+//  generator only emits this in states from which no guarded accept can 
+//  be reached, since a guard can give a different answer next time.      
+//
+
+void ParserEngine::handle_scan_class_memo(ParserEngine& prse,
+                                          const VCodeOperand* operands,
+                                          int64_t& pc,
+                                          int64_t location)
+{
+
+    if (prse.scan_next_loc <= prse.scan_failed_limit &&
+        prse.scan_failed_set.find(prse.scan_next_loc * prse.prsd.instruction_count + pc) !=
+            prse.scan_failed_set.end())
+    {
+        scan_no_transition(prse, pc);
+        return;
+    }
+
+    prse.scan_trail.push_back(make_pair(pc, prse.scan_next_loc));
+    handle_scan_class(prse, operands, pc, location);
+
+}
+
+//
+//  handle_scan_lazy                                                      
+//  ----------------                                                      
+//                                                                        
+//  The whole scanner for the lazy_scanner option. We walk the DFA in the 
+//  shared cache, asking LazyDfa to build any state or transition we need 
+//  that isn't there yet. Accepts with guards run the guard code, which   
+//  ends in a ScanAccept if it succeeds.                                  
+//
+
+void ParserEngine::handle_scan_lazy(ParserEngine& prse,
+                                    const VCodeOperand* operands,
+                                    int64_t& pc,
+                                    int64_t location)
+{
+
+    LazyDfa& lazy_dfa = prse.prsd.get_lazy_dfa(operands);
+    shared_ptr<LazyDfa::Cache> cache = lazy_dfa.get_cache();
+    int32_t state_num = 0;
+
+    for (;;)
+    {
+
+        const LazyDfa::State& state = *cache->state_list[state_num];
+
+        //
+        //  Try the accepts in order until one sticks. 
+        //
+
+        for (int32_t accept_num: state.accept_list)
+        {
+
+            int64_t guard_pc = lazy_dfa.get_accept_guard_pc(accept_num);
+
+            if (guard_pc < 0)
+            {
+                prse.scan_accept_loc = prse.scan_next_loc;
+                prse.scan_accept_symbol_num = lazy_dfa.get_accept_symbol_num(accept_num);
+                prse.scan_accept_pc = lazy_dfa.get_accept_pc(accept_num);
+                break;
+            }
+
+            int64_t save_accept_loc = prse.scan_accept_loc;
+            int save_accept_symbol_num = prse.scan_accept_symbol_num;
+            int64_t save_accept_pc = prse.scan_accept_pc;
+
+            prse.scan_accept_pc = -1;
+            prse.call_vm(guard_pc);
+
+            if (prse.scan_accept_pc >= 0)
+            {
+                break;
+            }
+
+            prse.scan_accept_loc = save_accept_loc;
+            prse.scan_accept_symbol_num = save_accept_symbol_num;
+            prse.scan_accept_pc = save_accept_pc;
+
+        }
+
+        //
+        //  Move on to the next state. 
+        //
+
+        if (prse.scan_next_loc >= prse.scan_end_loc)
+        {
+            break;
+        }
+
+        char32_t c = prse.src->get_char(prse.scan_next_loc);
+        int64_t char_class = prse.prsd.get_char_class(c);
+
+        int32_t next_state_num = state.next_state[char_class].load(memory_order_acquire);
+        if (next_state_num == LazyDfa::unknown_state)
+        {
+            next_state_num = lazy_dfa.find_next_state(cache, state_num, char_class, c);
+        }
+
+        if (next_state_num == LazyDfa::dead_state)
+        {
+            break;
+        }
+
+        state_num = next_state_num;
+        prse.scan_next_loc++;
+
+    }
+
+    scan_no_transition(prse, pc);
+
+}
+
+//
+//  scan_no_transition                                                    
+//  ------------------                                                    
+//                                                                        
+//  The DFA has no transition on the next character. If we passed an      
+//  accepting state we go back to it. Otherwise we have a scanning error. 
+//
+
+void ParserEngine::scan_no_transition(ParserEngine& prse, int64_t& pc)
+{
+
+    //
+    //  Every memo state we passed through after the last accept led     
+    //  nowhere. Remember them so we don't walk the same path again.     
+    //
+
+    for (auto& trail: prse.scan_trail)
+    {
+
+        if (trail.second > prse.scan_accept_loc)
+        {
+            prse.scan_failed_set.insert(trail.second * prse.prsd.instruction_count + trail.first);
+            prse.scan_failed_limit = max(prse.scan_failed_limit, trail.second);
+        }
+
+    }
+
+    prse.scan_trail.clear();
+
     //
-    //  We failed to advance. If we've already accepted a token then 
-    //  return it.                                                   
+    //  If we've already accepted a token then return it. 
     //
 
     if (prse.scan_accept_pc >= 0)
@@ -1907,7 +2842,7 @@ void ParserEngine::handle_scan_char(ParserEngine& prse,
 
     ost << "Invalid token at ";
 
-    switch (prse.src.get_char(prse.scan_start_loc))
+    switch (prse.src->get_char(prse.scan_start_loc))
     {
 
         case '\\': 
@@ -1929,14 +2864,14 @@ void ParserEngine::handle_scan_char(ParserEngine& prse,
         default:
         {
 
-            if (prse.src.get_char(prse.scan_start_loc) >= ' ' &&
-                prse.src.get_char(prse.scan_start_loc) < 128)
+            if (prse.src->get_char(prse.scan_start_loc) >= ' ' &&
+                prse.src->get_char(prse.scan_start_loc) < 128)
             {
-                ost << "'" << static_cast<char>(prse.src.get_char(prse.scan_start_loc)) << "'";    
+                ost << "'" << static_cast<char>(prse.src->get_char(prse.scan_start_loc)) << "'";    
             }
             else
             {
-                ost << setfill('0') << setw(8) << hex << prse.src.get_char(prse.scan_start_loc);
+                ost << setfill('0') << setw(8) << hex << prse.src->get_char(prse.scan_start_loc);
             }
 
         }
@@ -1944,12 +2879,9 @@ void ParserEngine::handle_scan_char(ParserEngine& prse,
     }   
 
     ost << ".";
-    prse.errh.add_error(ErrorType::ErrorLexical,
-                        prse.scan_start_loc,
-                        ost.str());
 
     //
-    //  Construct an error token and return. 
+    //  Construct an error token carrying the message and return. 
     //
 
     if ((prse.token_front + 1) % (prse.prsd.lookaheads + 1) == prse.token_rear)
@@ -1959,8 +2891,10 @@ void ParserEngine::handle_scan_char(ParserEngine& prse,
     }
 
     prse.token_buffer[prse.token_front].symbol_num = prse.prsd.error_symbol_num;
-    prse.token_buffer[prse.token_front].lexeme = prse.src.get_string(prse.scan_start_loc, prse.scan_start_loc + 1);
+    prse.token_buffer[prse.token_front].lexeme = prse.src->get_string(prse.scan_start_loc, prse.scan_start_loc + 1);
     prse.token_buffer[prse.token_front].location = -1;
+    prse.token_buffer[prse.token_front].error_message = ost.str();
+    prse.token_buffer[prse.token_front].error_location = prse.scan_start_loc;
 
     prse.token_front = (prse.token_front + 1) % (prse.prsd.lookaheads + 1);
 
@@ -2143,7 +3077,7 @@ void ParserEngine::handle_ast_index(ParserEngine& prse,
 
     if (index < 0 || index >= ast->get_num_children())
     {
-        prse.errh.add_error(ErrorType::ErrorAstIndex,
+        prse.errh->add_error(ErrorType::ErrorAstIndex,
                             location,
                             "Invalid Ast Index");
         pc = -1;
@@ -2256,7 +3190,7 @@ void ParserEngine::handle_ast_child_slice(ParserEngine& prse,
 
         if (i < 0 || i >= ast->get_num_children())
         {
-            prse.errh.add_error(ErrorType::ErrorAstIndex,
+            prse.errh->add_error(ErrorType::ErrorAstIndex,
                                 location,
                                 "Invalid Ast Index");
             pc = -1;
@@ -2277,6 +3211,42 @@ void ParserEngine::handle_ast_child_slice(ParserEngine& prse,
 
 }
 
+//
+//  handle_[superinstructions]                                           
+//  --------------------------                                           
+//                                                                       
+//  The code optimizer fuses a few common pairs of instructions into one 
+//  so reduce actions spend less time in the dispatch loop. Each is just  
+//  the two handlers run back to back.                                    
+//
+
+void ParserEngine::handle_ast_load_child(ParserEngine& prse,
+                                         const VCodeOperand* operands,
+                                         int64_t& pc,
+                                         int64_t location)
+{
+    handle_ast_load(prse, operands, pc, location);
+    handle_ast_child(prse, operands, pc, location);
+}
+
+void ParserEngine::handle_ast_form_kind(ParserEngine& prse,
+                                        const VCodeOperand* operands,
+                                        int64_t& pc,
+                                        int64_t location)
+{
+    handle_ast_form(prse, operands, pc, location);
+    prse.ast_stack.back()->set_kind(operands[3].integer);
+}
+
+void ParserEngine::handle_ast_finish_return(ParserEngine& prse,
+                                            const VCodeOperand* operands,
+                                            int64_t& pc,
+                                            int64_t location)
+{
+    handle_ast_finish(prse, operands, pc, location);
+    handle_return(prse, operands, pc, location);
+}
+
 //
 //  handle_[simple data transfer]                
 //  -----------------------------                
@@ -2321,7 +3291,7 @@ void ParserEngine::handle_ast_lexeme(ParserEngine& prse,
                                      int64_t& pc,
                                      int64_t location)
 {
-    prse.ast_stack.back()->set_lexeme(prse.ast_list[operands[0].ast_num]->get_lexeme());
+    prse.ast_stack.back()->share_lexeme(prse.ast_list[operands[0].ast_num]);
 }
 
 void ParserEngine::handle_ast_lexeme_string(ParserEngine& prse,
@@ -2329,7 +3299,18 @@ void ParserEngine::handle_ast_lexeme_string(ParserEngine& prse,
                                             int64_t& pc,
                                             int64_t location)
 {
-    prse.ast_stack.back()->set_lexeme(prse.prsd.string_list[operands[0].string_num]);
+
+    const string& lexeme = prse.prsd.string_list[operands[0].string_num];
+
+    if (prse.prsd.intern_lexemes && prse.lexeme_table != nullptr && !lexeme.empty())
+    {
+        prse.ast_stack.back()->set_lexeme(*prse.lexeme_table, prse.lexeme_table->intern(lexeme));
+    }
+    else
+    {
+        prse.ast_stack.back()->set_lexeme(lexeme);
+    }
+
 }
 
 //
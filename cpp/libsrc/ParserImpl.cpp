@@ -18,13 +18,17 @@
 
 #include <cstdint>
 #include <memory>
+#include <atomic>
 #include <exception>
 #include <functional>
 #include <string>
 #include <vector>
 #include <set>
 #include <map>
+#include <algorithm>
 #include <chrono>
+#include <future>
+#include <mutex>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -41,6 +45,8 @@
 #include "ReduceGenerator.H"
 #include "ActionGenerator.H"
 #include "ScannerGenerator.H"
+#include "ThreadPool.H"
+#include "Binary.H"
 
 //
 //  Namespace hoshi: Not indenting...
@@ -74,1539 +80,1597 @@ string ParserImpl::string_missing{""};
 
 static const char* grammar_str =
 {
-    "|!|}!|'!'|#\"|'$'|$\"|'%'|%\"|'&'|&\"|'('|'\"|')'|(\"|'*'|)\"|'+'|*\"|'"
-    ",'|+\"|'-'|,\"|'.'|-\"|'/'|.\"|'/='|/\"|':'|0\"|'::='|1\"|'::^'|2\"|':="
-    "'|3\"|';'|4\"|'<'|5\"|'<<'|6\"|'<='|7\"|'='|8\"|'=>'|9\"|'>'|:\"|'>='|;"
-    "\"|'>>'|<\"|'?'|=\"|'@'|>\"|'['|?\"|']'|@\"|'_'|A\"|'action'|B\"|'case_"
-    "sensitive'|C\"|'conflicts'|D\"|'description'|E\"|'dump_stack'|F\"|'empt"
-    "y'|G\"|'error'|H\"|'false'|I\"|'ignore'|J\"|'keep_whitespace'|K\"|'lexe"
-    "me'|L\"|'lookaheads'|M\"|'options'|N\"|'precedence'|O\"|'regex'|P\"|'ru"
-    "les'|Q\"|'template'|R\"|'token_count'|S\"|'tokens'|T\"|'true'|U\"|'{','"
-    "|V\"|*eof*|W\"|*epsilon*|X\"|*error*|Y\"|<bracketstring>|Z\"|<comment>|"
-    "[\"|<identifier>|\\\"|<integer>|]\"|<string>|^\"|<stringerror>|_\"|<tri"
-    "plestring>| #|<triplestringerror>|!#|<whitespace>|\"#|AstActionAdd|U!|A"
-    "stActionAnd|Z!|AstActionAssign|N!|AstActionDivide|X!|AstActionDumpStack"
-    "|]!|AstActionEqual|O!|AstActionGreaterEqual|T!|AstActionGreaterThan|S!|"
-    "AstActionLessEqual|R!|AstActionLessThan|Q!|AstActionMultiply|W!|AstActi"
-    "onNot|\\!|AstActionNotEqual|P!|AstActionOr|[!|AstActionStatementList|M!"
-    "|AstActionSubtract|V!|AstActionTokenCount|^!|AstActionUnaryMinus|Y!|Ast"
-    "AstChild|I|AstAstDot|P|AstAstFormer|G|AstAstItemList|H|AstAstKind|J|Ast"
-    "AstLexeme|M|AstAstLexemeString|N|AstAstLocation|K|AstAstLocationString|"
-    "L|AstAstLocator|O|AstAstSlice|Q|AstCaseSensitive|*|AstCharset|<!|AstCha"
-    "rsetAltNewline|E!|AstCharsetCaret|H!|AstCharsetChar|?!|AstCharsetCr|G!|"
-    "AstCharsetDash|I!|AstCharsetDigits|B!|AstCharsetDollar|J!|AstCharsetEsc"
-    "ape|D!|AstCharsetInvert|=!|AstCharsetLeftBracket|K!|AstCharsetNewline|F"
-    "!|AstCharsetNotDigits|C!|AstCharsetNotWhitespace|A!|AstCharsetRange|>!|"
-    "AstCharsetRightBracket|L!|AstCharsetString|V|AstCharsetWhitespace|@!|As"
-    "tConflicts|(|AstEmpty|F|AstErrorRecovery|'|AstFalse|^|AstFormer:2|\"\"|"
-    "AstGrammar|\"|AstGroup|<|AstIdentifier|X|AstInteger|Y|AstKeepWhitespace"
-    "|)|AstLookaheads|&|AstMacroString|W|AstNegativeInteger|Z|AstNonterminal"
-    "Reference|E|AstNull|!|AstOneClosure|;|AstOptionList|#|AstOptional|9|Ast"
-    "Options|S|AstReduceActions|T|AstRegex|_|AstRegexAltNewline|,!|AstRegexC"
-    "har|%!|AstRegexCr|.!|AstRegexDigits|)!|AstRegexDollar|4!|AstRegexEscape"
-    "|+!|AstRegexLeftBrace|:!|AstRegexLeftBracket|8!|AstRegexLeftParen|6!|As"
-    "tRegexList|!!|AstRegexNewline|-!|AstRegexNotDigits|*!|AstRegexNotWhites"
-    "pace|(!|AstRegexOneClosure|$!|AstRegexOptional|\"!|AstRegexOr| !|AstReg"
-    "exPeriod|3!|AstRegexPlus|1!|AstRegexQuestion|2!|AstRegexRightBrace|;!|A"
-    "stRegexRightBracket|9!|AstRegexRightParen|7!|AstRegexSpace|5!|AstRegexS"
-    "tar|0!|AstRegexString|U|AstRegexVBar|/!|AstRegexWhitespace|'!|AstRegexW"
-    "ildcard|&!|AstRegexZeroClosure|#!|AstRule|6|AstRuleLeftAssoc|@|AstRuleL"
-    "ist|%|AstRuleOperatorList|B|AstRuleOperatorSpec|C|AstRulePrecedence|=|A"
-    "stRulePrecedenceList|>|AstRulePrecedenceSpec|?|AstRuleRhs|8|AstRuleRhsL"
-    "ist|7|AstRuleRightAssoc|A|AstString|[|AstTerminalReference|D|AstToken|R"
-    "|AstTokenAction|2|AstTokenDeclaration|+|AstTokenDescription|.|AstTokenE"
-    "rror|5|AstTokenIgnore|4|AstTokenLexeme|3|AstTokenList|$|AstTokenOptionL"
-    "ist|,|AstTokenPrecedence|1|AstTokenRegex|0|AstTokenRegexList|/|AstToken"
-    "Template|-|AstTripleString|\\|AstTrue|]|AstUnknown||AstZeroClosure|:|Nu"
-    "ll| \"|ReduceActions|!\"|Unknown|_!|}\"|//{ -{ *//  Main Grammar{ -{ */"
-    "/  ------------{ -{ *//{ -{ *//  Grammar file for the main part of the "
-    "grammar.{ -{ *//{ -{ *{ -{ *options{ -{ *{ -{ *    lookaheads = 4{ -{ *"
-    "    conflicts = 0{ -{ *    case_sensitive = true{ -{ *{ -{ *tokens{ -{ "
-    "*{ -{ *    <comment>            : regex = ''' {'+cpp_comment{'- '''{ -{"
-    " *                           ignore = true{ -{ *{ -{ *    <whitespace> "
-    "        : regex = ''' {'+whitespace{'- '''{ -{ *                       "
-    "    ignore = true{ -{ *{ -{ *    <integer>            : regex = ''' [0-"
-    "9]+ '''{ -{ *{ -{ *    <identifier>         : regex = ''' [A-Za-z][a-zA"
-    "-Z0-9_]* '''{ -{ *                           precedence = 50{ -{ *{ -{ "
-    "*    <bracketstring>      : regex = [ !in_guard ] => ''' <[a-zA-Z][a-zA"
-    "-Z0-9_]*> '''{ -{ *{ -{ *    <string>             : regex = ''' ' ( \\\\"
-    " [^\\n] {', [^'\\\\\\n] )* ' {',{ -{ *                                 "
-    "      \" ( \\\\ [^\\n] {', [^\"\\\\\\n] )* \" '''{ -{ *{ -{ *    <strin"
-    "gerror>        : regex = ''' ' ( \\\\ [^\\n] {', [^'\\\\\\n] )* \\n {',"
-    "{ -{ *                                       \" ( \\\\ [^\\n] {', [^\"\\"
-    "\\\\n] )* \\n '''{ -{ *                           error = \"Missing clo"
-    "sing quote on string literal\"{ -{ *{ -{ *    <triplestring>       : re"
-    "gex = \"''' ( [^'] {', '[^'] {', ''[^'] )* '''\"{ -{ *{ -{ *    <triple"
-    "stringerror>  : regex = \"''' ( [^'] {', '[^'] {', ''[^'] )*\"{ -{ *   "
-    "                        error = \"Missing closing quote on triple quote"
-    "d string literal\"{ -{ *{ -{ *    '['                  : action = [ in_"
-    "guard := 1; ]{ -{ *{ -{ *    ']'                  : action = [ in_guard"
-    " := 0; ]{ -{ *{ -{ *    '<'                  : regex = [ in_guard ] => "
-    "'<'{ -{ *{ -{ *rules{ -{ *{ -{ *    //{ -{ *    //  Overall Structure{ "
-    "-{ *    //  -----------------{ -{ *    //{ -{ *{ -{ *    Grammar       "
-    "       ::= OptionSection?{ -{ *                             TokenSectio"
-    "n?{ -{ *                             RuleSection{ -{ *                 "
-    "        :   (AstGrammar, @3,{ -{ *                                 (Ast"
-    "OptionList, @1, $1._),{ -{ *                                 (AstTokenL"
-    "ist, @2, $2._),{ -{ *                                 (AstRuleList, @3,"
-    " $3._){ -{ *                             ){ -{ *{ -{ *    //{ -{ *    /"
-    "/  Option Sublanguage{ -{ *    //  ------------------{ -{ *    //{ -{ *"
-    "{ -{ *    OptionSection        ::= 'options' OptionSpec*{ -{ *         "
-    "                :   (AstOptionList, $2._){ -{ *{ -{ *    OptionSpec    "
-    "       ::= 'lookaheads' '=' IntegerValue{ -{ *                         "
-    ":   (AstLookaheads, $3){ -{ *{ -{ *    OptionSpec           ::= 'confli"
-    "cts' '=' IntegerValue{ -{ *                         :   (AstConflicts, "
-    "$3){ -{ *{ -{ *    OptionSpec           ::= 'keep_whitespace' '=' Boole"
-    "anValue{ -{ *                         :   (AstKeepWhitespace, $3){ -{ *"
-    "{ -{ *    OptionSpec           ::= 'case_sensitive' '=' BooleanValue{ -"
-    "{ *                         :   (AstCaseSensitive, $3){ -{ *{ -{ *    /"
-    "/{ -{ *    //  Token Sublanguage{ -{ *    //  -----------------{ -{ *  "
-    "  //{ -{ *{ -{ *    TokenSection         ::= 'tokens' TokenSpec*{ -{ * "
-    "                        :   (AstTokenList, $2._){ -{ *{ -{ *    TokenSp"
-    "ec            ::= TerminalSymbol{ -{ *                         :   (Ast"
-    "TokenDeclaration, $1, (AstTokenOptionList)){ -{ *{ -{ *    TokenSpec   "
-    "         ::= TerminalSymbol ':' TokenOption*{ -{ *                     "
-    "    :   (AstTokenDeclaration, $1, (AstTokenOptionList, @3, $3._)){ -{ *"
-    "{ -{ *    TokenOption          ::= 'template' '=' TerminalSymbol{ -{ * "
-    "                        :   (AstTokenTemplate, $3){ -{ *{ -{ *    Token"
-    "Option          ::= 'description' '=' StringValue{ -{ *                "
-    "         :   (AstTokenDescription, $3){ -{ *{ -{ *    TokenOption      "
-    "    ::= 'regex' '=' RegexString{ -{ *                         :   (AstT"
-    "okenRegexList, (AstTokenRegex, (AstNull, @\"-1\"), $3)){ -{ *{ -{ *    "
-    "TokenOption          ::= 'regex' '=' TokenRegex+{ -{ *                 "
-    "        :   (AstTokenRegexList, $3._){ -{ *{ -{ *    TokenRegex        "
-    "   ::= '[' ActionExpression ']' '=>' RegexString{ -{ *                 "
-    "        :   (AstTokenRegex, $2, $5){ -{ *{ -{ *    RegexString         "
-    " ::= StringValue{ -{ *                         :   (AstRegexString, $1)"
-    "{ -{ *{ -{ *    TokenOption          ::= 'precedence' '=' IntegerValue{"
-    " -{ *                         :   (AstTokenPrecedence, $3){ -{ *{ -{ * "
-    "   TokenOption          ::= 'action' '=' '[' ActionStatementList ']'{ -"
-    "{ *                         :   (AstTokenAction, $4){ -{ *{ -{ *    Tok"
-    "enOption          ::= 'lexeme' '=' BooleanValue{ -{ *                  "
-    "       :   (AstTokenLexeme, $3){ -{ *{ -{ *    TokenOption          ::="
-    " 'ignore' '=' BooleanValue{ -{ *                         :   (AstTokenI"
-    "gnore, $3){ -{ *{ -{ *    TokenOption          ::= 'error' '=' StringVa"
-    "lue{ -{ *                         :   (AstTokenError, $3){ -{ *{ -{ *  "
-    "  //{ -{ *    //  Rule Sublanguage{ -{ *    //  ----------------{ -{ * "
-    "   //{ -{ *{ -{ *    RuleSection          ::= 'rules'? Rule+{ -{ *     "
-    "                    :   (AstRuleList, $2._){ -{ *{ -{ *    Rule        "
-    "         ::= NonterminalReference '::=' RuleRhsList ReduceActions{ -{ *"
-    "                         :   (AstRule, @2, $1, $3, $4.1, $4.2){ -{ *{ -"
-    "{ *    ReduceActions        ::= ':' ReduceAstAction ':' ReduceGuardActi"
-    "on{ -{ *                         :   ($2, $4){ -{ *{ -{ *    ReduceActi"
-    "ons        ::= ':' ReduceAstAction{ -{ *                         :   ($"
-    "2, (AstNull, @\"-1\")){ -{ *{ -{ *    ReduceActions        ::= empty{ -"
-    "{ *                         :   ((AstNull, @\"-1\"), (AstNull, @\"-1\")"
-    "){ -{ *{ -{ *    RuleRhsList          ::= RuleRhs ( '{',' RuleRhs : $2 "
-    ")*{ -{ *                         :   (AstRuleRhsList, $1, $2._){ -{ *{ "
-    "-{ *    RuleRhs              ::= RuleSequenceTerm+{ -{ *               "
-    "          :   (AstRuleRhs, $1._){ -{ *{ -{ *    RuleSequenceTerm     ::"
-    "= RuleUnopTerm '*'{ -{ *                         :   (AstZeroClosure, @"
-    "2, $1){ -{ *{ -{ *    RuleSequenceTerm     ::= RuleUnopTerm '+'{ -{ *  "
-    "                       :   (AstOneClosure, @2, $1){ -{ *{ -{ *    RuleS"
-    "equenceTerm     ::= RuleUnopTerm '?'{ -{ *                         :   "
-    "(AstOptional, @2, $1){ -{ *{ -{ *    RuleSequenceTerm     ::= RuleUnopT"
-    "erm{ -{ *{ -{ *    RuleUnopTerm         ::= SymbolReference{ -{ *{ -{ *"
-    "    RuleUnopTerm         ::= 'empty'{ -{ *                         :   "
-    "(AstEmpty){ -{ *{ -{ *    RuleUnopTerm         ::= '(' RuleRhsList Redu"
-    "ceActions ')'{ -{ *                         :   (AstGroup, $2, $3.1, $3"
-    ".2){ -{ *{ -{ *    Rule                 ::= NonterminalReference '::^' "
-    "SymbolReference PrecedenceSpec+{ -{ *                         :   (AstR"
-    "ulePrecedence, @2, $1, $3, (AstRulePrecedenceList, @4, $4._)){ -{ *{ -{"
-    " *    PrecedenceSpec       ::= Assoc Operator+{ -{ *                   "
-    "      :   (AstRulePrecedenceSpec, $1, (AstRuleOperatorList, @2, $2._)){"
-    " -{ *{ -{ *    Assoc                ::= '<<'{ -{ *                     "
-    "    :   (AstRuleLeftAssoc){ -{ *{ -{ *    Assoc                ::= '>>'"
-    "{ -{ *                         :   (AstRuleRightAssoc){ -{ *{ -{ *    O"
-    "perator             ::= SymbolReference ReduceActions{ -{ *            "
-    "             :   (AstRuleOperatorSpec, $1, $2.1, $2.2){ -{ *{ -{ *    S"
-    "ymbolReference      ::= TerminalReference{ -{ *{ -{ *    SymbolReferenc"
-    "e      ::= NonterminalReference{ -{ *{ -{ *    TerminalReference    ::="
-    " TerminalSymbol{ -{ *                         :   (AstTerminalReference"
-    ", $1){ -{ *{ -{ *    NonterminalReference ::= NonterminalSymbol{ -{ *  "
-    "                       :   (AstNonterminalReference, $1){ -{ *{ -{ *   "
-    " //{ -{ *    //  Ast Former Sublanguage{ -{ *    //  ------------------"
-    "----{ -{ *    //{ -{ *{ -{ *    ReduceAstAction      ::= AstFormer{ -{ "
-    "*{ -{ *    ReduceAstAction      ::= AstChild{ -{ *{ -{ *    ReduceAstAc"
-    "tion      ::= empty{ -{ *                         :   (AstNull){ -{ *{ "
-    "-{ *    AstFormer            ::= '(' ( AstItem ( ','? AstItem : $2 )* :"
-    " ($1, $2._) )? ')'{ -{ *                         :   (AstAstFormer, $2."
-    "_){ -{ *{ -{ *    AstItem              ::= AstChild{ -{ *{ -{ *    AstC"
-    "hild             ::= '$' AstChildSpec '.' AstSliceSpec{ -{ *           "
-    "              :   (AstAstChild, $2, $4){ -{ *{ -{ *    AstChild        "
-    "     ::= '$' AstChildSpec{ -{ *                         :   (AstAstChil"
-    "d, $2, (AstNull, @\"-1\")){ -{ *{ -{ *    AstChild             ::= '$' "
-    "AstSliceSpec{ -{ *                         :   (AstAstChild, (AstNull, "
-    "@\"-1\"), $2){ -{ *{ -{ *    AstItem              ::= Identifier{ -{ * "
-    "                        :   (AstIdentifier, &1){ -{ *{ -{ *    AstItem "
-    "             ::= '%' AstChildSpec{ -{ *                         :   (As"
-    "tAstKind, $2){ -{ *{ -{ *    AstItem              ::= '@' AstChildSpec{"
-    " -{ *                         :   (AstAstLocation, $2){ -{ *{ -{ *    A"
-    "stItem              ::= '@' StringValue{ -{ *                         :"
-    "   (AstAstLocationString, $2){ -{ *{ -{ *    AstItem              ::= '"
-    "&' AstChildSpec{ -{ *                         :   (AstAstLexeme, $2){ -"
-    "{ *{ -{ *    AstItem              ::= '&' StringValue{ -{ *            "
-    "             :   (AstAstLexemeString, $2){ -{ *{ -{ *    AstItem       "
-    "       ::= AstFormer{ -{ *{ -{ *    AstChildSpec         ::= AstChildNu"
-    "mber ( '.' AstChildNumber : $2 )*{ -{ *                         :   (As"
-    "tAstDot, $1, $2._){ -{ *{ -{ *    AstSliceSpec         ::= AstFirstChil"
-    "dNumber '_' AstLastChildNumber{ -{ *                         :   (AstAs"
-    "tSlice, $1, $3){ -{ *{ -{ *    AstFirstChildNumber  ::= AstChildNumber{"
-    " -{ *{ -{ *    AstFirstChildNumber  ::= empty{ -{ *                    "
-    "     :   (AstInteger, &\"1\"){ -{ *{ -{ *    AstLastChildNumber   ::= A"
-    "stChildNumber{ -{ *{ -{ *    AstLastChildNumber   ::= empty{ -{ *      "
-    "                   :   (AstNegativeInteger, &\"1\"){ -{ *{ -{ *    AstC"
-    "hildNumber       ::= '-' <integer>{ -{ *                         :   (A"
-    "stNegativeInteger, &2){ -{ *{ -{ *    AstChildNumber       ::= <integer"
-    ">{ -{ *                         :   (AstInteger, &1){ -{ *{ -{ *    Red"
-    "uceGuardAction    ::= '[' ActionStatementList ']'{ -{ *                "
-    "         :   $2{ -{ *{ -{ *    //{ -{ *    //  Action Sublanguage{ -{ *"
-    "    //  ------------------{ -{ *    //{ -{ *{ -{ *    ActionStatementLi"
-    "st  ::= ActionStatement*{ -{ *                         :   (AstActionSt"
-    "atementList, $1._){ -{ *{ -{ *    ActionStatement      ::= Identifier '"
-    ":=' ActionExpression ';'{ -{ *                         :   (AstActionAs"
-    "sign, @2, $1, $3){ -{ *{ -{ *    ActionStatement      ::= 'dump_stack' "
-    "';'{ -{ *                         :   (AstActionDumpStack){ -{ *{ -{ * "
-    "   ActionExpression     ::^ ActionUnopExpression << '{','  : (AstAction"
-    "Or, $1, $2){ -{ *                                                  << '"
-    "&'  : (AstActionAnd, $1, $2){ -{ *                                     "
-    "             << '='  : (AstActionEqual, $1, $2){ -{ *                  "
-    "                                   '/=' : (AstActionNotEqual, $1, $2){ "
-    "-{ *                                                     '<'  : (AstAct"
-    "ionLessThan, $1, $2){ -{ *                                             "
-    "        '<=' : (AstActionLessEqual, $1, $2){ -{ *                      "
-    "                               '>'  : (AstActionGreaterThan, $1, $2){ -"
-    "{ *                                                     '>=' : (AstActi"
-    "onGreaterEqual, $1, $2){ -{ *                                          "
-    "        << '+'  : (AstActionAdd, $1, $2){ -{ *                         "
-    "                            '-'  : (AstActionSubtract, $1, $2){ -{ *   "
-    "                                               << '*'  : (AstActionMult"
-    "iply, $1, $2){ -{ *                                                    "
-    " '/'  : (AstActionDivide, $1, $2){ -{ *{ -{ *    ActionUnopExpression :"
-    ":= '-' ActionUnopTerm{ -{ *                         :   (AstActionUnary"
-    "Minus, $2){ -{ *{ -{ *    ActionUnopExpression ::= '!' ActionUnopTerm{ "
-    "-{ *                         :   (AstActionNot, $2){ -{ *{ -{ *    Acti"
-    "onUnopExpression ::= ActionUnopTerm{ -{ *{ -{ *    ActionUnopTerm      "
-    " ::= '(' ActionExpression ')'{ -{ *                         :   $2{ -{ "
-    "*{ -{ *    ActionUnopTerm       ::= IntegerValue{ -{ *{ -{ *    ActionU"
-    "nopTerm       ::= Identifier{ -{ *{ -{ *    ActionUnopTerm       ::= 't"
-    "oken_count'{ -{ *                         :   (AstActionTokenCount){ -{"
-    " *{ -{ *    //{ -{ *    //  Literal Wrappers{ -{ *    //  -------------"
-    "---{ -{ *    //{ -{ *{ -{ *    TerminalSymbol       ::= <string>{ -{ * "
-    "                        :   (AstString, &1){ -{ *{ -{ *    TerminalSymb"
-    "ol       ::= <bracketstring>{ -{ *                         :   (AstStri"
-    "ng, &1){ -{ *{ -{ *    NonterminalSymbol    ::= <identifier>{ -{ *     "
-    "                    :   (AstIdentifier, &1){ -{ *{ -{ *    IntegerValue"
-    "         ::= <integer>{ -{ *                         :   (AstInteger, &"
-    "1){ -{ *{ -{ *    BooleanValue         ::= 'true'{ -{ *                "
-    "         :   (AstTrue){ -{ *{ -{ *    BooleanValue         ::= 'false'{"
-    " -{ *                         :   (AstFalse){ -{ *{ -{ *    StringValue"
-    "          ::= <string>{ -{ *                         :   (AstString, &1"
-    "){ -{ *{ -{ *    StringValue          ::= <triplestring>{ -{ *         "
-    "                :   (AstTripleString, &1){ -{ *{ -{ *    Identifier    "
-    "       ::= <identifier>{ -{ *                         :   (AstIdentifie"
-    "r, &1){ -{ *|}#|$|}$|!|}%|]!|}&|%|}'|$\"|}(|<identifier>|')'|<string>|<"
-    "bracketstring>|'('|*eof*|'&'|'{','|':'|'-'|'>>'|'<<'|'$'|']'|'%'|'rules"
-    "'|'@'|'+'|'='|','|'*'|';'|<integer>|'>'|'>='|'/='|'<'|'<='|'ignore'|'ac"
-    "tion'|'description'|'lexeme'|'precedence'|'regex'|'template'|'error'|'e"
-    "mpty'|'/'|'token_count'|'!'|'?'|'['|'tokens'|'_'|'.'|'conflicts'|'keep_"
-    "whitespace'|'case_sensitive'|'lookaheads'|'dump_stack'|<triplestring>|'"
-    "::^'|'::='|'true'|'false'|':='|'=>'|'options'||||||||||||||||||||||||||"
-    "||||||||||||||||||||||||||||||||||||||||||*error*||<comment>|<whitespac"
-    "e>|<stringerror>|<triplestringerror>|*epsilon*|})|!|!|!|!|!|!|!|!|!|!|!"
+    "|#|}!|'!'|-\"|'$'|.\"|'%'|/\"|'&'|0\"|'('|1\"|')'|2\"|'*'|3\"|'+'|4\"|'"
+    ",'|5\"|'-'|6\"|'.'|7\"|'/'|8\"|'/='|9\"|':'|:\"|'::='|;\"|'::^'|<\"|':="
+    "'|=\"|';'|>\"|'<'|\?\"|'<<'|@\"|'<='|A\"|'='|B\"|'=>'|C\"|'>'|D\"|'>='|"
+    "E\"|'>>'|F\"|'\?'|G\"|'@'|H\"|'['|I\"|']'|J\"|'_'|K\"|'action'|L\"|'cas"
+    "e_sensitive'|M\"|'conflicts'|N\"|'description'|O\"|'dump_stack'|P\"|'em"
+    "pty'|Q\"|'error'|R\"|'false'|S\"|'ignore'|T\"|'intern_lexemes'|U\"|'kee"
+    "p_whitespace'|V\"|'keyword_table'|W\"|'lazy_ast'|X\"|'lazy_scanner'|Y\""
+    "|'lexeme'|Z\"|'linear_scan'|[\"|'lookahead_method'|\\\"|'lookaheads'|]\""
+    "|'minimize_method'|^\"|'options'|_\"|'pipeline_scanner'| #|'precedence'"
+    "|!#|'regex'|\"#|'rules'|##|'sync'|$#|'table_scheme'|%#|'template'|&#|'t"
+    "oken_count'|'#|'tokens'|(#|'true'|)#|'{','|*#|*eof*|+#|*epsilon*|,#|*er"
+    "ror*|-#|<bracketstring>|.#|<comment>|/#|<identifier>|0#|<integer>|1#|<s"
+    "tring>|2#|<stringerror>|3#|<triplestring>|4#|<triplestringerror>|5#|<wh"
+    "itespace>|6#|AstActionAdd|_!|AstActionAnd|$\"|AstActionAssign|X!|AstAct"
+    "ionDivide|\"\"|AstActionDumpStack|'\"|AstActionEqual|Y!|AstActionGreate"
+    "rEqual|^!|AstActionGreaterThan|]!|AstActionLessEqual|\\!|AstActionLessT"
+    "han|[!|AstActionMultiply|!\"|AstActionNot|&\"|AstActionNotEqual|Z!|AstA"
+    "ctionOr|%\"|AstActionStatementList|W!|AstActionSubtract| \"|AstActionTo"
+    "kenCount|(\"|AstActionUnaryMinus|#\"|AstAstChild|S|AstAstDot|Z|AstAstFo"
+    "rmer|Q|AstAstItemList|R|AstAstKind|T|AstAstLexeme|W|AstAstLexemeString|"
+    "X|AstAstLocation|U|AstAstLocationString|V|AstAstLocator|Y|AstAstSlice|["
+    "|AstCaseSensitive|*|AstCharset|F!|AstCharsetAltNewline|O!|AstCharsetCar"
+    "et|R!|AstCharsetChar|I!|AstCharsetCr|Q!|AstCharsetDash|S!|AstCharsetDig"
+    "its|L!|AstCharsetDollar|T!|AstCharsetEscape|N!|AstCharsetInvert|G!|AstC"
+    "harsetLeftBracket|U!|AstCharsetNewline|P!|AstCharsetNotDigits|M!|AstCha"
+    "rsetNotWhitespace|K!|AstCharsetRange|H!|AstCharsetRightBracket|V!|AstCh"
+    "arsetString| !|AstCharsetWhitespace|J!|AstConflicts|(|AstEmpty|P|AstErr"
+    "orRecovery|'|AstFalse|(!|AstFormer:2|,\"|AstGrammar|\"|AstGroup|F|AstId"
+    "entifier|\"!|AstInteger|#!|AstInternLexemes|1|AstKeepWhitespace|)|AstKe"
+    "ywordTable|-|AstLazyAst|2|AstLazyScanner|/|AstLinearScan|.|AstLookahead"
+    "Method|+|AstLookaheads|&|AstMacroString|!!|AstMinimizeMethod|3|AstNegat"
+    "iveInteger|$!|AstNonterminalReference|O|AstNull|!|AstOneClosure|E|AstOp"
+    "tionList|#|AstOptional|C|AstOptions|]|AstPipelineScanner|0|AstReduceAct"
+    "ions|^|AstRegex|)!|AstRegexAltNewline|6!|AstRegexChar|/!|AstRegexCr|8!|"
+    "AstRegexDigits|3!|AstRegexDollar|>!|AstRegexEscape|5!|AstRegexLeftBrace"
+    "|D!|AstRegexLeftBracket|B!|AstRegexLeftParen|@!|AstRegexList|+!|AstRege"
+    "xNewline|7!|AstRegexNotDigits|4!|AstRegexNotWhitespace|2!|AstRegexOneCl"
+    "osure|.!|AstRegexOptional|,!|AstRegexOr|*!|AstRegexPeriod|=!|AstRegexPl"
+    "us|;!|AstRegexQuestion|<!|AstRegexRightBrace|E!|AstRegexRightBracket|C!"
+    "|AstRegexRightParen|A!|AstRegexSpace|\?!|AstRegexStar|:!|AstRegexString"
+    "|_|AstRegexVBar|9!|AstRegexWhitespace|1!|AstRegexWildcard|0!|AstRegexZe"
+    "roClosure|-!|AstRule|@|AstRuleLeftAssoc|J|AstRuleList|%|AstRuleOperator"
+    "List|L|AstRuleOperatorSpec|M|AstRulePrecedence|G|AstRulePrecedenceList|"
+    "H|AstRulePrecedenceSpec|I|AstRuleRhs|B|AstRuleRhsList|A|AstRuleRightAss"
+    "oc|K|AstString|%!|AstTableScheme|,|AstTerminalReference|N|AstToken|\\|A"
+    "stTokenAction|;|AstTokenDeclaration|4|AstTokenDescription|7|AstTokenErr"
+    "or|>|AstTokenIgnore|=|AstTokenLexeme|<|AstTokenList|$|AstTokenOptionLis"
+    "t|5|AstTokenPrecedence|:|AstTokenRegex|9|AstTokenRegexList|8|AstTokenSy"
+    "nc|\?|AstTokenTemplate|6|AstTripleString|&!|AstTrue|'!|AstUnknown||AstZ"
+    "eroClosure|D|Null|*\"|ReduceActions|+\"|Unknown|)\"|}\"|//{ *//  Main G"
+    "rammar{ *//  ------------{ *//{ *//  Grammar file for the main part of "
+    "the grammar.{ *//{ *{ *options{ *{ *    lookaheads = 4{ *    conflicts "
+    "= 0{ *    case_sensitive = true{ *{ *tokens{ *{ *    <comment>         "
+    "   : regex = ''' {'+cpp_comment{'- '''{ *                           ign"
+    "ore = true{ *{ *    <whitespace>         : regex = ''' {'+whitespace{'-"
+    " '''{ *                           ignore = true{ *{ *    <integer>     "
+    "       : regex = ''' [0-9]+ '''{ *{ *    <identifier>         : regex ="
+    " ''' [A-Za-z][a-zA-Z0-9_]* '''{ *                           precedence "
+    "= 50{ *{ *    <bracketstring>      : regex = [ !in_guard ] => ''' <[a-z"
+    "A-Z][a-zA-Z0-9_]*> '''{ *{ *    <string>             : regex = ''' ' ( "
+    "\\\\ [^\\n] {', [^'\\\\\\n] )* ' {',{ *                                "
+    "       \" ( \\\\ [^\\n] {', [^\"\\\\\\n] )* \" '''{ *{ *    <stringerro"
+    "r>        : regex = ''' ' ( \\\\ [^\\n] {', [^'\\\\\\n] )* \\n {',{ *  "
+    "                                     \" ( \\\\ [^\\n] {', [^\"\\\\\\n] "
+    ")* \\n '''{ *                           error = \"Missing closing quote"
+    " on string literal\"{ *{ *    <triplestring>       : regex = \"''' ( [^"
+    "'] {', '[^'] {', ''[^'] )* '''\"{ *{ *    <triplestringerror>  : regex "
+    "= \"''' ( [^'] {', '[^'] {', ''[^'] )*\"{ *                           e"
+    "rror = \"Missing closing quote on triple quoted string literal\"{ *{ * "
+    "   '['                  : action = [ in_guard := 1; ]{ *{ *    ']'     "
+    "             : action = [ in_guard := 0; ]{ *{ *    '<'                "
+    "  : regex = [ in_guard ] => '<'{ *{ *rules{ *{ *    //{ *    //  Overal"
+    "l Structure{ *    //  -----------------{ *    //{ *{ *    Grammar      "
+    "        ::= OptionSection\?{ *                             TokenSection"
+    "\?{ *                             RuleSection{ *                       "
+    "  :   (AstGrammar, @3,{ *                                 (AstOptionLis"
+    "t, @1, $1._),{ *                                 (AstTokenList, @2, $2."
+    "_),{ *                                 (AstRuleList, @3, $3._){ *      "
+    "                       ){ *{ *    //{ *    //  Option Sublanguage{ *   "
+    " //  ------------------{ *    //{ *{ *    OptionSection        ::= 'opt"
+    "ions' OptionSpec*{ *                         :   (AstOptionList, $2._){"
+    " *{ *    OptionSpec           ::= 'lookaheads' '=' IntegerValue{ *     "
+    "                    :   (AstLookaheads, $3){ *{ *    OptionSpec        "
+    "   ::= 'conflicts' '=' IntegerValue{ *                         :   (Ast"
+    "Conflicts, $3){ *{ *    OptionSpec           ::= 'keep_whitespace' '=' "
+    "BooleanValue{ *                         :   (AstKeepWhitespace, $3){ *{"
+    " *    OptionSpec           ::= 'case_sensitive' '=' BooleanValue{ *    "
+    "                     :   (AstCaseSensitive, $3){ *{ *    OptionSpec    "
+    "       ::= 'lookahead_method' '=' StringValue{ *                       "
+    "  :   (AstLookaheadMethod, $3){ *{ *    OptionSpec           ::= 'table"
+    "_scheme' '=' StringValue{ *                         :   (AstTableScheme"
+    ", $3){ *{ *    OptionSpec           ::= 'keyword_table' '=' BooleanValu"
+    "e{ *                         :   (AstKeywordTable, $3){ *{ *    OptionS"
+    "pec           ::= 'linear_scan' '=' BooleanValue{ *                    "
+    "     :   (AstLinearScan, $3){ *{ *    OptionSpec           ::= 'lazy_sc"
+    "anner' '=' BooleanValue{ *                         :   (AstLazyScanner,"
+    " $3){ *{ *    OptionSpec           ::= 'pipeline_scanner' '=' BooleanVa"
+    "lue{ *                         :   (AstPipelineScanner, $3){ *{ *    Op"
+    "tionSpec           ::= 'intern_lexemes' '=' BooleanValue{ *            "
+    "             :   (AstInternLexemes, $3){ *{ *    OptionSpec           :"
+    ":= 'lazy_ast' '=' BooleanValue{ *                         :   (AstLazyA"
+    "st, $3){ *{ *    OptionSpec           ::= 'minimize_method' '=' StringV"
+    "alue{ *                         :   (AstMinimizeMethod, $3){ *{ *    //"
+    "{ *    //  Token Sublanguage{ *    //  -----------------{ *    //{ *{ *"
+    "    TokenSection         ::= 'tokens' TokenSpec*{ *                    "
+    "     :   (AstTokenList, $2._){ *{ *    TokenSpec            ::= Termina"
+    "lSymbol{ *                         :   (AstTokenDeclaration, $1, (AstTo"
+    "kenOptionList)){ *{ *    TokenSpec            ::= TerminalSymbol ':' To"
+    "kenOption*{ *                         :   (AstTokenDeclaration, $1, (As"
+    "tTokenOptionList, @3, $3._)){ *{ *    TokenOption          ::= 'templat"
+    "e' '=' TerminalSymbol{ *                         :   (AstTokenTemplate,"
+    " $3){ *{ *    TokenOption          ::= 'description' '=' StringValue{ *"
+    "                         :   (AstTokenDescription, $3){ *{ *    TokenOp"
+    "tion          ::= 'regex' '=' RegexString{ *                         : "
+    "  (AstTokenRegexList, (AstTokenRegex, (AstNull, @\"-1\"), $3)){ *{ *   "
+    " TokenOption          ::= 'regex' '=' TokenRegex+{ *                   "
+    "      :   (AstTokenRegexList, $3._){ *{ *    TokenRegex           ::= '"
+    "[' ActionExpression ']' '=>' RegexString{ *                         :  "
+    " (AstTokenRegex, $2, $5){ *{ *    RegexString          ::= StringValue{"
+    " *                         :   (AstRegexString, $1){ *{ *    TokenOptio"
+    "n          ::= 'precedence' '=' IntegerValue{ *                        "
+    " :   (AstTokenPrecedence, $3){ *{ *    TokenOption          ::= 'action"
+    "' '=' '[' ActionStatementList ']'{ *                         :   (AstTo"
+    "kenAction, $4){ *{ *    TokenOption          ::= 'lexeme' '=' BooleanVa"
+    "lue{ *                         :   (AstTokenLexeme, $3){ *{ *    TokenO"
+    "ption          ::= 'ignore' '=' BooleanValue{ *                        "
+    " :   (AstTokenIgnore, $3){ *{ *    TokenOption          ::= 'error' '='"
+    " StringValue{ *                         :   (AstTokenError, $3){ *{ *  "
+    "  TokenOption          ::= 'sync' '=' BooleanValue{ *                  "
+    "       :   (AstTokenSync, $3){ *{ *    //{ *    //  Rule Sublanguage{ *"
+    "    //  ----------------{ *    //{ *{ *    RuleSection          ::= 'ru"
+    "les'\? Rule+{ *                         :   (AstRuleList, $2._){ *{ *  "
+    "  Rule                 ::= NonterminalReference '::=' RuleRhsList Reduc"
+    "eActions{ *                         :   (AstRule, @2, $1, $3, $4.1, $4."
+    "2){ *{ *    ReduceActions        ::= ':' ReduceAstAction ':' ReduceGuar"
+    "dAction{ *                         :   ($2, $4){ *{ *    ReduceActions "
+    "       ::= ':' ReduceAstAction{ *                         :   ($2, (Ast"
+    "Null, @\"-1\")){ *{ *    ReduceActions        ::= empty{ *             "
+    "            :   ((AstNull, @\"-1\"), (AstNull, @\"-1\")){ *{ *    RuleR"
+    "hsList          ::= RuleRhs ( '{',' RuleRhs : $2 )*{ *                 "
+    "        :   (AstRuleRhsList, $1, $2._){ *{ *    RuleRhs              ::"
+    "= RuleSequenceTerm+{ *                         :   (AstRuleRhs, $1._){ "
+    "*{ *    RuleSequenceTerm     ::= RuleUnopTerm '*'{ *                   "
+    "      :   (AstZeroClosure, @2, $1){ *{ *    RuleSequenceTerm     ::= Ru"
+    "leUnopTerm '+'{ *                         :   (AstOneClosure, @2, $1){ "
+    "*{ *    RuleSequenceTerm     ::= RuleUnopTerm '\?'{ *                  "
+    "       :   (AstOptional, @2, $1){ *{ *    RuleSequenceTerm     ::= Rule"
+    "UnopTerm{ *{ *    RuleUnopTerm         ::= SymbolReference{ *{ *    Rul"
+    "eUnopTerm         ::= 'empty'{ *                         :   (AstEmpty)"
+    "{ *{ *    RuleUnopTerm         ::= '(' RuleRhsList ReduceActions ')'{ *"
+    "                         :   (AstGroup, $2, $3.1, $3.2){ *{ *    Rule  "
+    "               ::= NonterminalReference '::^' SymbolReference Precedenc"
+    "eSpec+{ *                         :   (AstRulePrecedence, @2, $1, $3, ("
+    "AstRulePrecedenceList, @4, $4._)){ *{ *    PrecedenceSpec       ::= Ass"
+    "oc Operator+{ *                         :   (AstRulePrecedenceSpec, $1,"
+    " (AstRuleOperatorList, @2, $2._)){ *{ *    Assoc                ::= '<<"
+    "'{ *                         :   (AstRuleLeftAssoc){ *{ *    Assoc     "
+    "           ::= '>>'{ *                         :   (AstRuleRightAssoc){"
+    " *{ *    Operator             ::= SymbolReference ReduceActions{ *     "
+    "                    :   (AstRuleOperatorSpec, $1, $2.1, $2.2){ *{ *    "
+    "SymbolReference      ::= TerminalReference{ *{ *    SymbolReference    "
+    "  ::= NonterminalReference{ *{ *    TerminalReference    ::= TerminalSy"
+    "mbol{ *                         :   (AstTerminalReference, $1){ *{ *   "
+    " NonterminalReference ::= NonterminalSymbol{ *                         "
+    ":   (AstNonterminalReference, $1){ *{ *    //{ *    //  Ast Former Subl"
+    "anguage{ *    //  ----------------------{ *    //{ *{ *    ReduceAstAct"
+    "ion      ::= AstFormer{ *{ *    ReduceAstAction      ::= AstChild{ *{ *"
+    "    ReduceAstAction      ::= empty{ *                         :   (AstN"
+    "ull){ *{ *    AstFormer            ::= '(' ( AstItem ( ','\? AstItem : "
+    "$2 )* : ($1, $2._) )\? ')'{ *                         :   (AstAstFormer"
+    ", $2._){ *{ *    AstItem              ::= AstChild{ *{ *    AstChild   "
+    "          ::= '$' AstChildSpec '.' AstSliceSpec{ *                     "
+    "    :   (AstAstChild, $2, $4){ *{ *    AstChild             ::= '$' Ast"
+    "ChildSpec{ *                         :   (AstAstChild, $2, (AstNull, @\""
+    "-1\")){ *{ *    AstChild             ::= '$' AstSliceSpec{ *           "
+    "              :   (AstAstChild, (AstNull, @\"-1\"), $2){ *{ *    AstIte"
+    "m              ::= Identifier{ *                         :   (AstIdenti"
+    "fier, &1){ *{ *    AstItem              ::= '%' AstChildSpec{ *        "
+    "                 :   (AstAstKind, $2){ *{ *    AstItem              ::="
+    " '@' AstChildSpec{ *                         :   (AstAstLocation, $2){ "
+    "*{ *    AstItem              ::= '@' StringValue{ *                    "
+    "     :   (AstAstLocationString, $2){ *{ *    AstItem              ::= '"
+    "&' AstChildSpec{ *                         :   (AstAstLexeme, $2){ *{ *"
+    "    AstItem              ::= '&' StringValue{ *                        "
+    " :   (AstAstLexemeString, $2){ *{ *    AstItem              ::= AstForm"
+    "er{ *{ *    AstChildSpec         ::= AstChildNumber ( '.' AstChildNumbe"
+    "r : $2 )*{ *                         :   (AstAstDot, $1, $2._){ *{ *   "
+    " AstSliceSpec         ::= AstFirstChildNumber '_' AstLastChildNumber{ *"
+    "                         :   (AstAstSlice, $1, $3){ *{ *    AstFirstChi"
+    "ldNumber  ::= AstChildNumber{ *{ *    AstFirstChildNumber  ::= empty{ *"
+    "                         :   (AstInteger, &\"1\"){ *{ *    AstLastChild"
+    "Number   ::= AstChildNumber{ *{ *    AstLastChildNumber   ::= empty{ * "
+    "                        :   (AstNegativeInteger, &\"1\"){ *{ *    AstCh"
+    "ildNumber       ::= '-' <integer>{ *                         :   (AstNe"
+    "gativeInteger, &2){ *{ *    AstChildNumber       ::= <integer>{ *      "
+    "                   :   (AstInteger, &1){ *{ *    ReduceGuardAction    :"
+    ":= '[' ActionStatementList ']'{ *                         :   $2{ *{ * "
+    "   //{ *    //  Action Sublanguage{ *    //  ------------------{ *    /"
+    "/{ *{ *    ActionStatementList  ::= ActionStatement*{ *                "
+    "         :   (AstActionStatementList, $1._){ *{ *    ActionStatement   "
+    "   ::= Identifier ':=' ActionExpression ';'{ *                         "
+    ":   (AstActionAssign, @2, $1, $3){ *{ *    ActionStatement      ::= 'du"
+    "mp_stack' ';'{ *                         :   (AstActionDumpStack){ *{ *"
+    "    ActionExpression     ::^ ActionUnopExpression << '{','  : (AstActio"
+    "nOr, $1, $2){ *                                                  << '&'"
+    "  : (AstActionAnd, $1, $2){ *                                          "
+    "        << '='  : (AstActionEqual, $1, $2){ *                          "
+    "                           '/=' : (AstActionNotEqual, $1, $2){ *       "
+    "                                              '<'  : (AstActionLessThan"
+    ", $1, $2){ *                                                     '<=' :"
+    " (AstActionLessEqual, $1, $2){ *                                       "
+    "              '>'  : (AstActionGreaterThan, $1, $2){ *                 "
+    "                                    '>=' : (AstActionGreaterEqual, $1, "
+    "$2){ *                                                  << '+'  : (AstA"
+    "ctionAdd, $1, $2){ *                                                   "
+    "  '-'  : (AstActionSubtract, $1, $2){ *                                "
+    "                  << '*'  : (AstActionMultiply, $1, $2){ *             "
+    "                                        '/'  : (AstActionDivide, $1, $2"
+    "){ *{ *    ActionUnopExpression ::= '-' ActionUnopTerm{ *              "
+    "           :   (AstActionUnaryMinus, $2){ *{ *    ActionUnopExpression "
+    "::= '!' ActionUnopTerm{ *                         :   (AstActionNot, $2"
+    "){ *{ *    ActionUnopExpression ::= ActionUnopTerm{ *{ *    ActionUnopT"
+    "erm       ::= '(' ActionExpression ')'{ *                         :   $"
+    "2{ *{ *    ActionUnopTerm       ::= IntegerValue{ *{ *    ActionUnopTer"
+    "m       ::= Identifier{ *{ *    ActionUnopTerm       ::= 'token_count'{"
+    " *                         :   (AstActionTokenCount){ *{ *    //{ *    "
+    "//  Literal Wrappers{ *    //  ----------------{ *    //{ *{ *    Termi"
+    "nalSymbol       ::= <string>{ *                         :   (AstString,"
+    " &1){ *{ *    TerminalSymbol       ::= <bracketstring>{ *              "
+    "           :   (AstString, &1){ *{ *    NonterminalSymbol    ::= <ident"
+    "ifier>{ *                         :   (AstIdentifier, &1){ *{ *    Inte"
+    "gerValue         ::= <integer>{ *                         :   (AstInteg"
+    "er, &1){ *{ *    BooleanValue         ::= 'true'{ *                    "
+    "     :   (AstTrue){ *{ *    BooleanValue         ::= 'false'{ *        "
+    "                 :   (AstFalse){ *{ *    StringValue          ::= <stri"
+    "ng>{ *                         :   (AstString, &1){ *{ *    StringValue"
+    "          ::= <triplestring>{ *                         :   (AstTripleS"
+    "tring, &1){ *{ *    Identifier           ::= <identifier>{ *           "
+    "              :   (AstIdentifier, &1){ *|}#|$|}$|!|}%|)\"|}&|%|}'|.\"|}"
+    "(|<identifier>|')'|<string>|<bracketstring>|'('|*eof*|'&'|'{','|':'|'-'"
+    "|'rules'|'>>'|'<<'|'='|'$'|']'|'%'|'@'|'+'|','|';'|'*'|<integer>|'lexem"
+    "e'|'/='|'ignore'|'precedence'|'error'|'regex'|'description'|'sync'|'act"
+    "ion'|'template'|'>='|'>'|'<='|'<'|'empty'|'tokens'|'table_scheme'|'pipe"
+    "line_scanner'|'minimize_method'|'lookaheads'|'lookahead_method'|'linear"
+    "_scan'|'lazy_ast'|'keyword_table'|'keep_whitespace'|'intern_lexemes'|'l"
+    "azy_scanner'|'conflicts'|'case_sensitive'|'/'|'token_count'|'!'|'\?'|'["
+    "'|'_'|'.'|'true'|'false'|<triplestring>|'dump_stack'|'::^'|'::='|':='|'"
+    "=>'|'options'||||||||||||||||||||||||||||||||||||||||||||||||||||||||||"
+    "|||||||||||*epsilon*|*error*|<comment>|<stringerror>|<triplestringerror"
+    ">|<whitespace>|})|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!"
     "|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|"
-    "!|!|!|!|!|!|!|!|!|!|!|!|||||||?!||||||||@!|J#|/!||||||A!||||||||A!|||||"
-    "|||P\"|F#|+\"||||||B!||||||||Z!||||||||@!|J#|/!|||!||||||!|}*|\\\"|(\"|"
-    "^\"|Z\"|'\"|W\"|&\"|V\"|0\"|,\"|<\"|6\"|$\"|@\"|%\"|Q\"|>\"|*\"|8\"|+\""
-    "|)\"|4\"|]\"|:\"|;\"|/\"|5\"|7\"|J\"|B\"|E\"|L\"|O\"|P\"|R\"|H\"|G\"|.\""
-    "|S\"|#\"|=\"|?\"|T\"|A\"|-\"|D\"|K\"|C\"|M\"|F\"| #|2\"|1\"|U\"|I\"|3\""
-    "|9\"|N\"|I$||||||%||!~!~||||\"||!~!~||||&||0D\"||||||%||!~!~||||\"||!~!"
-    "~||||%||!~!~||||\"||!~!~||||&||<,|||Y\"||[\"|\"#|_\"|!#|X\"|}+|!||!|!||"
-    "|||||||||||||||||!||||!||||||||||||||||||||||||!||||||||||||||?!|||||||"
-    "|@!|J#|/!||||||A!||||||||A!||||||||@#|R|0!||||||B!||||||||Z!||||||||@!|"
-    "J#|/!|||||!|!|!|!||},|.\"|}-|!|#|!||!||\"|\"||#|#|#|#|\"|\"||!|#|\"||#|"
-    "#|#|#|\"|!|%|!|#|%|#|#|#|\"|!||\"|!|$|$|\"||\"|\"|\"||!|\"|!|\"|\"|\"|!"
-    "|!|!|$|$|\"|!|\"|\"|!|!|!|\"|!|!|!|!|!|!||#|!|\"|\"|\"|!||||!|$|\"|\"|!"
-    "|\"|\"|\"|\"|\"|!|\"|\"|\"||#|!||!||\"|!|#|!|\"||$|\"|#|!|#|!|#|#|#|#|#"
-    "|#|!|#|#|!|#|#|!|\"|\"|!|#|!|!|!|!|!|!|!|!|!|!|!|!|}.|^!|L!|M!|M!|O!|O!"
-    "|Q!|R!|R!|S!|S!|S!|S!|Y!|Z!|Z!|[!|[!|;!|;!|V!|V!|V!|V!|H!|H!|B!|8!|V!|V"
-    "!|V!|V!|V!|N!|U!|U!|P!|P!|C!|0!|0!|0!|3!|F!|\\!|F!|.!|-!|-!|+!|+!|+!|+!"
-    "|*!|*!|*!|C!|D!|D!|@!|W!|W!|:!|:!|G!|$!|$!|%!|!!|6!|6!|6!|,!|=!|<!|E!|I"
-    "!|J!|J!|E!|=!|5!|(!|(!|(!|5!|5!|5!|5!|5!|5!|5!|2!|A!|X!|A!|>!|?!|?!|K!|"
-    "K!|'!|'!|9!|7!|4!|4!|T!|T!|/!|/!|&!|&!|#!|#!|#!|#!|#!|#!|#!|_|_|_|^|^|^"
-    "|]|]|]|\\|\\|\\|\\| !| !|\"!|[|1!|1!|)!|)!|Z|}/|*accept* ::= Grammar|Gr"
-    "ammar ::= Grammar:1 Grammar:2 RuleSection|Grammar:1 ::= OptionSection|G"
-    "rammar:1 ::= *epsilon*|Grammar:2 ::= TokenSection|Grammar:2 ::= *epsilo"
-    "n*|OptionSection ::= 'options' OptionSection:1|OptionSection:1 ::= Opti"
-    "onSection:1 OptionSpec|OptionSection:1 ::= *epsilon*|OptionSpec ::= 'lo"
-    "okaheads' '=' IntegerValue|OptionSpec ::= 'conflicts' '=' IntegerValue|"
-    "OptionSpec ::= 'keep_whitespace' '=' BooleanValue|OptionSpec ::= 'case_"
-    "sensitive' '=' BooleanValue|TokenSection ::= 'tokens' TokenSection:1|To"
-    "kenSection:1 ::= TokenSection:1 TokenSpec|TokenSection:1 ::= *epsilon*|"
-    "TokenSpec ::= TerminalSymbol|TokenSpec ::= TerminalSymbol ':' TokenSpec"
-    ":1|TokenSpec:1 ::= TokenSpec:1 TokenOption|TokenSpec:1 ::= *epsilon*|To"
-    "kenOption ::= 'template' '=' TerminalSymbol|TokenOption ::= 'descriptio"
-    "n' '=' StringValue|TokenOption ::= 'regex' '=' RegexString|TokenOption "
-    "::= 'regex' '=' TokenOption:1|TokenOption:1 ::= TokenOption:1 TokenRege"
-    "x|TokenOption:1 ::= TokenRegex|TokenRegex ::= '[' ActionExpression ']' "
-    "'=>' RegexString|RegexString ::= StringValue|TokenOption ::= 'precedenc"
-    "e' '=' IntegerValue|TokenOption ::= 'action' '=' '[' ActionStatementLis"
-    "t ']'|TokenOption ::= 'lexeme' '=' BooleanValue|TokenOption ::= 'ignore"
-    "' '=' BooleanValue|TokenOption ::= 'error' '=' StringValue|RuleSection "
-    "::= RuleSection:1 RuleSection:2|RuleSection:1 ::= 'rules'|RuleSection:1"
-    " ::= *epsilon*|RuleSection:2 ::= RuleSection:2 Rule|RuleSection:2 ::= R"
-    "ule|Rule ::= NonterminalReference '::=' RuleRhsList ReduceActions|Reduc"
-    "eActions ::= ':' ReduceAstAction ':' ReduceGuardAction|ReduceActions ::"
-    "= ':' ReduceAstAction|ReduceActions ::= *epsilon*|RuleRhsList ::= RuleR"
-    "hs RuleRhsList:1|RuleRhsList:1 ::= RuleRhsList:1 RuleRhsList:2|RuleRhsL"
-    "ist:2 ::= '{',' RuleRhs|RuleRhsList:1 ::= *epsilon*|RuleRhs ::= RuleRhs"
-    ":1|RuleRhs:1 ::= RuleRhs:1 RuleSequenceTerm|RuleRhs:1 ::= RuleSequenceT"
-    "erm|RuleSequenceTerm ::= RuleUnopTerm '*'|RuleSequenceTerm ::= RuleUnop"
-    "Term '+'|RuleSequenceTerm ::= RuleUnopTerm '?'|RuleSequenceTerm ::= Rul"
-    "eUnopTerm|RuleUnopTerm ::= SymbolReference|RuleUnopTerm ::= 'empty'|Rul"
-    "eUnopTerm ::= '(' RuleRhsList ReduceActions ')'|Rule ::= NonterminalRef"
-    "erence '::^' SymbolReference Rule:1|Rule:1 ::= Rule:1 PrecedenceSpec|Ru"
-    "le:1 ::= PrecedenceSpec|PrecedenceSpec ::= Assoc PrecedenceSpec:1|Prece"
-    "denceSpec:1 ::= PrecedenceSpec:1 Operator|PrecedenceSpec:1 ::= Operator"
-    "|Assoc ::= '<<'|Assoc ::= '>>'|Operator ::= SymbolReference ReduceActio"
-    "ns|SymbolReference ::= TerminalReference|SymbolReference ::= Nontermina"
-    "lReference|TerminalReference ::= TerminalSymbol|NonterminalReference ::"
-    "= NonterminalSymbol|ReduceAstAction ::= AstFormer|ReduceAstAction ::= A"
-    "stChild|ReduceAstAction ::= *epsilon*|AstFormer ::= '(' AstFormer:1 ')'"
-    "|AstFormer:1 ::= AstFormer:2|AstFormer:2 ::= AstItem AstFormer:3|AstFor"
-    "mer:3 ::= AstFormer:3 AstFormer:4|AstFormer:4 ::= AstFormer:5 AstItem|A"
-    "stFormer:5 ::= ','|AstFormer:5 ::= *epsilon*|AstFormer:3 ::= *epsilon*|"
-    "AstFormer:1 ::= *epsilon*|AstItem ::= AstChild|AstChild ::= '$' AstChil"
-    "dSpec '.' AstSliceSpec|AstChild ::= '$' AstChildSpec|AstChild ::= '$' A"
-    "stSliceSpec|AstItem ::= Identifier|AstItem ::= '%' AstChildSpec|AstItem"
-    " ::= '@' AstChildSpec|AstItem ::= '@' StringValue|AstItem ::= '&' AstCh"
-    "ildSpec|AstItem ::= '&' StringValue|AstItem ::= AstFormer|AstChildSpec "
-    "::= AstChildNumber AstChildSpec:1|AstChildSpec:1 ::= AstChildSpec:1 Ast"
-    "ChildSpec:2|AstChildSpec:2 ::= '.' AstChildNumber|AstChildSpec:1 ::= *e"
-    "psilon*|AstSliceSpec ::= AstFirstChildNumber '_' AstLastChildNumber|Ast"
-    "FirstChildNumber ::= AstChildNumber|AstFirstChildNumber ::= *epsilon*|A"
-    "stLastChildNumber ::= AstChildNumber|AstLastChildNumber ::= *epsilon*|A"
-    "stChildNumber ::= '-' <integer>|AstChildNumber ::= <integer>|ReduceGuar"
-    "dAction ::= '[' ActionStatementList ']'|ActionStatementList ::= ActionS"
-    "tatementList:1|ActionStatementList:1 ::= ActionStatementList:1 ActionSt"
-    "atement|ActionStatementList:1 ::= *epsilon*|ActionStatement ::= Identif"
-    "ier ':=' ActionExpression ';'|ActionStatement ::= 'dump_stack' ';'|Acti"
-    "onExpression ::= ActionExpression '{',' ActionExpression:1|ActionExpres"
-    "sion ::= ActionExpression:1|ActionExpression:1 ::= ActionExpression:1 '"
-    "&' ActionExpression:2|ActionExpression:1 ::= ActionExpression:2|ActionE"
-    "xpression:2 ::= ActionExpression:2 '=' ActionExpression:3|ActionExpress"
-    "ion:2 ::= ActionExpression:2 '/=' ActionExpression:3|ActionExpression:2"
-    " ::= ActionExpression:2 '<' ActionExpression:3|ActionExpression:2 ::= A"
-    "ctionExpression:2 '<=' ActionExpression:3|ActionExpression:2 ::= Action"
-    "Expression:2 '>' ActionExpression:3|ActionExpression:2 ::= ActionExpres"
-    "sion:2 '>=' ActionExpression:3|ActionExpression:2 ::= ActionExpression:"
-    "3|ActionExpression:3 ::= ActionExpression:3 '+' ActionExpression:4|Acti"
-    "onExpression:3 ::= ActionExpression:3 '-' ActionExpression:4|ActionExpr"
-    "ession:3 ::= ActionExpression:4|ActionExpression:4 ::= ActionExpression"
-    ":4 '*' ActionUnopExpression|ActionExpression:4 ::= ActionExpression:4 '"
-    "/' ActionUnopExpression|ActionExpression:4 ::= ActionUnopExpression|Act"
-    "ionUnopExpression ::= '-' ActionUnopTerm|ActionUnopExpression ::= '!' A"
-    "ctionUnopTerm|ActionUnopExpression ::= ActionUnopTerm|ActionUnopTerm ::"
-    "= '(' ActionExpression ')'|ActionUnopTerm ::= IntegerValue|ActionUnopTe"
-    "rm ::= Identifier|ActionUnopTerm ::= 'token_count'|TerminalSymbol ::= <"
-    "string>|TerminalSymbol ::= <bracketstring>|NonterminalSymbol ::= <ident"
-    "ifier>|IntegerValue ::= <integer>|BooleanValue ::= 'true'|BooleanValue "
-    "::= 'false'|StringValue ::= <string>|StringValue ::= <triplestring>|Ide"
-    "ntifier ::= <identifier>|}0|!~:&|!~W&|!~]&|#'|+'|5'|;'|C'|K'|S'|['|#(|-"
-    "(|3(|>(|M(|W(|](|%)|-)|<)|D)|N)|V)| *|(*|0*|8*|@*|H*|P*|!~X*|^*|(+|0+|B"
-    "+|L+|X+|&,|0,|:,|?,|E,|M,|W,|_,|)-|3-|!~!~=-|C-|Q-|$.|..|6.|E.|O.|W.|]."
-    "|#/|!~!~1/|9/|!~!~A/|G/|!~O/|Y/|#0|!~(0|.0|40|!~:0|D0|P0|\\0|$1|,1|41|<"
-    "1|D1|!~L1|V1| 2|%2|+2|!~52|!~<2|C2|K2|S2|X2| 3|*3|03|<3|B3|!~L3|!~V3| 4"
-    "|*4|44|>4|H4|!~R4|\\4|!~&5|05|!~:5|B5|!~J5|!~!~O5|U5|]5|%6|-6|56|;6|A6|"
-    "I6|Q6|}1|\"|}2||}3|<#|}4|;$|}5|D>|\"%|S<|?$|O]|0)|[&|::|#@|T&|6#|$#|N.|"
-    "L2|%#|V#|'%|@%|&<|I2|X$|R!|;<|3)|6.|D%|\"2|M#|L*|<-|X&|L,|[>|'R|EN|H%|L"
-    "7|@U|?W|R,|09|>_|!M|AK|V%|6-|&:|7L|_Y|JY|,R|U?|NI|,,|QP|A+|5,|O8|+7|\"7"
-    "|X/|'.|&'|.6|I(|0\\|A\"|2#|^Z|E(|D(|3(|#(|!(|P'|8'|7'|UN|@P|!Q|51|,V|R2"
-    "|84|+)|E,|9V|^S|:B|/)|?%|G*|O#|J!|\\'|>%|&%|C%|-0|\"W|C[|6%|%$|!N|E^|S7"
-    "|&E|._|D=|!I|EJ|89|@(|:%|\\*|;F|P$|5+|1V|]1|%3|)V|E@|9S|!X|[M|NS|7X|D/|"
-    "LX|\"Y|7Y|+-|/(|YJ|?S|B_|0=|N^|S_|9_|(_|^X|L:|I6|^=|[A|+'|%B|&C|#)|AC|)"
-    "A|4\\|]R|\\C|J5|22|5?|9R|#&|P4|;'|_^|M=|C-|-K|*#|M,|&G|5I|XK|\\$|>I|*+|"
-    "&@|PQ|!W|[V|UV|(Z|\"X|6Z|-\\|V\\|/]|6]|@B|5Z|>&|O$|Y%|U&|4^|MA|!,|IB| A"
-    "|VI| P|DO|)O|O<|MU|2U|*H|OG|4G|PE|JE|@3|NT|6$|U(|,L|//|X(|M;|Q#|9;||H/|"
-    ":*|.5|9&|O3|W:|B$|0$|S'|Q7|:6|B[|<,|X-|$-|'4|#8|W*|]!|<(|]3|4$|G[|2T|RD"
-    "|5%|-E|7D|CL|^8|RF|8M|;Q|LM|V9|Y0|\"'|2>|M>|-*|L0|<P|F'|.;|@)|RT|A2|97|"
-    "_.|BQ|NO|N\"|&+|@4|'?|A1|&)|?#|EH|X3|0N|.+|}6|X!!|}7| 0  '|!$ *'|\"$ @'"
-    "|#$ N|$$ ('|%4|&$ ^&|'$ <'|($ 2'|)$ 0'|*$ &\"|+$ $\"|,$ B\"|-$ :'|.$ 2#"
-    "|/$ 6|0$ 4#|1$ .'|2$ 6'|3$ *%|4$ ,'|5$ 4'|6$ >'|7$ J%|8$ L%|9$ F%|:$ B%"
-    "|;$ H%|<$ 6\"|=$ 2\"|>$ ,\"|?$ 4\"|@$ 0\"|A$ .\"|B$ *\"|C$ 8\"|D$ D!|E$"
-    " T%|F$ \\$|G$ Z$|H$ Z!|I$ 8'|J$ .|K$ @$|L0 $'|M$ >|N$ @|O$ B|P$ <|Q$ ^%"
-    "|R$ P#|S$ \"!|T$  !|U$ .!|V$ 0!|W$ B&|X$ &&|Y$ (|Z,  (|[, \"(|\\, P'|],"
-    " N'|^, J'|_, H'| - :(|!- $(|\"- L|#- F'|$- 8(|%- H!|&- D'|'- T'|(- R'|)"
-    "- 6(|*- @!|+- 4(|,- X'|-- <!|.- 0(|/- B'|0- *(|1- ^'|2- V'|3- 2(|4- \"%"
-    "|5- Z'|6- :\"|7- L'|8- ,(|9- *$|:- \"\"|;- L!|<- ,#|=- *#|>- \\'|?- @#|"
-    "@- ((|A- >$|B- <(|C- .(|D- ^!|E- .$|F- R!|G- &(|H- Z#|I- &%|J- (%|K- 6%"
-    "|L- \"|M- $|N- 2|O- *|P- F|Q- &|R- 0|S- :|T- \\%|U- 4|V- (\"|W- N\"|X- "
-    "2%|Y- ,|Z- 8|[- R|\\- D\"| 0  '|!0 *'|\"0 P|#0 N|$0 <\"|%0 X&|&0 ^&|'($"
-    "!0K|(0 \"#|)($! N|*0 &\"|+0 $\"|,0 B\"|-($! K|.0 2#|/($!P\"|00 4#|1($!P"
-    "M|2($!@L|30 *%|4($!0N|5($!0U|I$  $|7($!0M|8($!@M|9($!PL|:($!0L|;($! M|<"
-    "($!P2|=($!02|>($!@1|?($!@2|@($! 2|A($!P1|B($!01|C($! 3| (? @$|E($!@N|\""
-    "(?  &|#(? P%|S$ \"!|T$  !|J($!P!|K0 @$|L0 $'|M($!P#|N($! $|O($!0$|P($!@"
-    "#| 0  '|!0 *'|\"0 P|#0 N|$(S @3|%(S  W|&0 ^&|'($!0K|((S 08|)($! N|*(S P"
-    "0|+(S @0|,(S 04|-($! K|.(S 0:|/($!P\"|0(S @:|1($!PM|2($!@L|3(S 0I|4($!0"
-    "N|5($!0U| (1 @$|7($!0M|8($!@M|9($!PL|:($!0L|;($! M|<($!P2|=($!02|>($!@1"
-    "|?($!@2|@($! 2|A($!P1|B($!01|C($! 3| H? @$|E($!@N|\"H?  &|#H? P%| $ D|2"
-    "$ V|J($!P!|K(S  D|L(S @X|M($!P#|N($! $|O($!0$|P($!@#| 0  '|!0 *'|\"0 P|"
-    "#0 N|$HR @3|%HR  W|&0 ^&|'($!0K|(HR 08|)($! N|*HR P0|+HR @0|,HR 04|-($!"
-    " K|.HR 0:|/($!P\"|0HR @:|1($!PM|2($!@L|3HR 0I|4($!0N|5($!0U|KHP  D|7($!"
-    "0M|8($!@M|9($!PL|:($!0L|;($! M|<($!P2|=($!02|>($!@1|?($!@2|@($! 2|A($!P"
-    "1|B($!01|C($! 3|6$ &!|E($!@N|6$ &!|!HD @A|6  V&|2$ X|J($!P!|KHR  D|LHR "
-    "@X|M($!P#|N($! $|O($!0$|P($!@#| $  '|!(H @A|\"$ P|#$ N|$$ ('|!0 *&|&$ 6"
-    "#|!- J|\"- L|)$ L$|&$ @%|'0 :%|,$ B\"|'$ :%|.$ 2#| (! @$|0$ 4#|-0 8%| 0"
-    " D|!HS P<|\"0 P|#0 N|6$ &!|%HS  W|[, (!|50 J&|[, ^#|5$ J&|*HS P0|+HS @0"
-    "|/(! P\"| HT @8| (@ @$|/H. P\"|\"(@  &|#(@ P%|D$ D!|%(@  W|F$ \\$|G$ Z$"
-    "| H2 @$|C- H|*(@ P0|+(@ @0|-HT PX|%H2  W|<H. P2|=H. 02|>H. @1|?H. @2|@H"
-    ".  2|AH. P1|BH. 01|CH.  3|P- F|%4|\"$ N#|J(! P!|Z, H(|[, D$|\\, X$|], N"
-    "$|^, V$|_, T$| - 4!|!- 6!|\"- L|#- R$|$- B!|%- H!|&- P$|!$ ,$|(- (#|2$ "
-    "Z|*- @!|+- >!|,- &#|-- <!|.- :!|/- <%|QHT PO|\"$ N#|-$ &'|3- \\!| (' @$"
-    "|5- .#|\"('  &|#(' P%| ($!@$|!($!0Q|\"($! &|#($!P%|<- ,#|=- *#|&($! L|'"
-    "($!0K|6$ B$|)($! N|2$ \\|/(' P\"|X$ &&|-($! K| H4 @$|/($!P\"|R$ P#|1($!"
-    "PM|2($!@L|%H4  W|4($!0N|5($!0U|($ N!|7($!0M|8($!@M|9($!PL|:($!0L|;($! M"
-    "|<($!P2|=($!02|>($!@1|?($!@2|@($! 2|A($!P1|B($!01|C($! 3|I$ ($|E($!@N|5"
-    "$ D&|)- &$|-$ X%|R$ P#|J($!P!|U$ .!|V$ 0!|M($!P#|N($! $|O($!0$|P($!@#| "
-    "0  '|!0 *'|\"H#! &|#H#!P%|$0 B(|%H#! W|&H&!PW|'0 <'|(H#!P-|)H&! N|*H#!P"
-    "0|+H#!@0|,H&!04|-H&! K|.H&!0:|)- R#|0H&!@:|10 .'|2H&!@L|3H&!0I|40 ,'|5H"
-    "&!0U|1- $$|7H&!0M|8H&!@M|9H&!PL|:H&!0L|;H&! M| HS @$|!HS P<|\"HS  &|#HS"
-    " P%|%H   W|%HS  W| (\" @$|9- *$|DH#!@,|EH&!@N|*HS P0|+HS @0|HH#!0/| 0 D"
-    "|!(!!0Q|\"(.  &|#(. P%|0- P!|!H4 P<|&(!! L|'(!!0K|/(\" P\"|)(!! N|SH#!0"
-    "(|TH#! (|($ N!|-(!! K|WH&!0T|/0 6|'$ :%|1(!!PM|2(!!@L|W$ B&|4(!!0N|5(!!"
-    "0U|-$ 8%|7(!!0M|8(!!@M|9(!!PL|:(!!0L|;(!! M|<(. P2|=(. 02|>(. @1|?(. @2"
-    "|@(.  2|A(. P1|B(. 01|C(.  3| 0 D|E(!!@N|-$  &|2$  #|2$ ^\"|%0 X&|J0 .|"
-    "U$ .!|V$ 0!|M0 >|N0 @|O0 B|P0 <| 0  '|!0 *'|\"0 P|#0 N|$0 B(|%0 X&|&0 ^"
-    "&|'0 <'|(0 D(|)H ! N|*(D P0|+(D @0|,(D 04|-H ! K|.(D 0:|2$ \\\"|0(D @:|"
-    "10 .'|2H !@L|3(D 0I|40 ,'|5H !0U|1- 2!|7H !0M|8H !@M|9H !PL|:H !0L|;H !"
-    " M| H3 @$|!H3 P<|\"H3  &|#H3 P%|2$ Z\"|%H3  W|2$ X\"|0- H\"|DH; @,|EH !"
-    "@N|*H3 P0|+H3 @0|HH; 0/| 0  '|!0 \"'|\"0 P|#0 N|$0 B(|%H\"! W|&H%!P:|'H"
-    "\"!P4|(H\"!0W|2$ V\"|*H\"!P0|+H\"!@0|,H%!04| (= @$|.H%!0:|/0 6|0H%!@:|1"
-    "H\"! /|%(=  W|3H%!0I|4H\"!P.|U$ .!|V$ 0!|*(= P0|+(= @0| HU @8|2$ T\"|2$"
-    " R\"|<0 6\"|=0 2\"|>0 ,\"|?0 4\"|@0 0\"|A0 .\"|B0 *\"|C0 8\"|DH\"!@,|) "
-    " T&|-HU PX| $ $#|HH\"!0/|IH%!@>| $  '|$$ H$|\"$ P|#$ N|$$ J(|K$ @$|!$ F"
-    "#|1- \"$|6  R&|)$ L$| H1 @$|\"$ P|#$ N| (#!@$|!(#!P<|\"(#! &|#(#!P%|$(#"
-    "!P,|%(#! W|6$ &!|'(#!P4|((#!0W|6$ &!|*(#!P0|+(#!@0|/$ 6| H4 @$|!H4 P<|/"
-    "(#!P\"|K(N @C|1(#! /|%H4  W|QHU PO|4(#!P.|($ N!|F$ \\$|D$ D!|!~F$ \\$|G"
-    "$ Z$|!~<(#!P2|=(#!02|>(#!@1|?(#!@2|@(#! 2|A(#!P1|B(#!01|C(#! 3|D(#!@,|!"
-    "~!~!~H(#!0/|!~Z, J$|[, D$|\\, >%|Z, J$|[, D$|\\, X$|], N$|^, V$|_, T$| "
-    "- 4!|!- 6!|\"- L|#- R$|$- B!|%- H!|&- P$| 0 D|!~ - L#|*- @!|+- >!|%0 X&"
-    "|-- <!|.- :!|/- <%|!~*0 &\"|+0 $\"|3- \\!| (D  X|!0 *'|\"(D  &|#(D P%|$"
-    "(D @3|%(D  W|&0 ^&|'H !0K|((D 08|)H ! N|*(D P0|+(D @0|,(D 04|-H ! K|.(D"
-    " 0:|\"$ N#|0(D @:|1H !PM|2H !@L|3(D 0I|4H !0N|5H !0U|0- T(|7H !0M|8H !@"
-    "M|9H !PL|:H !0L|;H ! M|!~ $  '|!~\"$ P|#$ N|$$ J(| (6 @$|!(6 P<|N- 2|EH"
-    " !@N|)$ L$|%(6  W|6$ &!|'(6 P4|((6 P-|U- 4| $  '|!(H @A|\"$ P|#$ N|$$ B"
-    "(|!$ *&|&$ 6#|6$ &!| (3 @$|!$ F#|I$ T#|'$ :%|,$ B\"|%(3  W|.$ 2#| (> @$"
-    "|0$ 4#|\"(>  &|#(> P%|R$ P#|%(>  W|D$ D!|!~F$ \\$|G$ Z$|*(> P0|+(> @0| "
-    "HC @$|!HC P<|\"HC  &|#HC P%|$$ <\"|%HC  W|[, *!|!~(HC 08|D$ D!|*HC P0|+"
-    "HC @0|,$ B\"|!~!~)- V#|Z, J$|[, D$|\\, X$|], N$|^, V$|_, T$| - 4!|!- 6!"
-    "|\"- L|#- R$|$- B!|%- H!|&- (&|!~8- X#|Z, 0#|*- @!|+- >!|\"$ N#|-- <!|."
-    "- D#| - 4!|!- 6!|\"- L|B- \\#|$- B!|%- H!|!~!~(- (#|H- Z#|*- @!|+- >!|,"
-    "- &#|-- <!|.- :!| (3 @$|*$ &\"|+$ $\"|!~3- \\!|%(3  W|5- .#| 0 D|!HC P<"
-    "|\"0 P|#0 N|$$ <\"|%HC  W|<- ,#|=- *#|(HC 08| H< @$|*HC P0|+HC @0|,$ B\""
-    "|(- @\"|%H<  W|/H) P\"| (2 @$|,- >\"|!~*H< P0|+H< @0|%(2  W| H$!@$|R$ P"
-    "#|\"H$! &|#H$!P%|)$ B#|6- :\"|<H) P2|=H) 02|>H) @1|?H) @2|@H)  2|AH) P1"
-    "|BH) 01|CH)  3|!~/H$!P\"|!~6$ 8#| $ $#|I$ ($|\"$ @'|#$ N|$$ H$|!~)- V#|"
-    " (U @8|!~)$ L$|<H$!P2|=H$!02|>H$!@1|?H$!@2|@H$! 2|AH$!P1|BH$!01|CH$! 3|"
-    " H6 @$|!H6 P<|-(U PX|8- F&|6$ &!|%H6  W|JH$!P!|'H6 P4|(H6 P-|MH$!P#|NH$"
-    "! $|OH$!0$|PH$!@#| HF @8|(- @\"|!~:- \"\"|$HF @3|,- >\"|&HF P:|F$ \\$|G"
-    "$ Z$|@-  \"|I$ P(|!~,HF 04|D- ^!|.HF 0:|6- :\"|0HF @:|'- $&|9- *$|R$ P#"
-    "|;- L!| 0 $#|U$ .!|V$ 0!|!~Q(U PO|!~Z, J$|[, \"(|\\, X$|], N$|^, V$|_, "
-    "0&| - L#|-0 &'|!~ H9 @$|!H9 P<|\"H9  &|#H9 P%|$H9 P,|%H9  W|)- R(|'H9 P"
-    "4|(H9 P-|!~U$ .!|V$ 0!|!~!~1- ^'| H\"!@$|!H\"!P<|\"H\"! &|#H\"!P%|$H\"!"
-    "P,|%H\"! W|8- X#|'H\"!P4|(H\"!0W|4- \"%|*H\"!P0|+H\"!@0|7- $%|!~!~/H\"!"
-    "P\"|B- \\#|1H\"! /|!~Q0 ^%|4H\"!P.|DH9 @,|H- Z#|1- ,!| H& @$|!~\"$ P|#$"
-    " N|<H\"!P2|=H\"!02|>H\"!@1|?H\"!@2|@H\"! 2|AH\"!P1|BH\"!01|CH\"! 3|DH\""
-    "!@,|!~F- R!|/H& P\"|HH\"!0/| 0 D|!HA P<|\"0 P|#0 N|$HA P,|%HA  W|!~'HA "
-    "P4|(0 Z&|!~*HA P0|+HA @0|!~!~!~/0 6| $ D|1HA  /|\"$ D|#$ D|4HA P.|%$ D|"
-    "!~!~($ D|!~*$ D|+$ D|<(* P2|=(* 02|>(* @1|?(* @2|@(*  2|A(* P1|B(* 01|C"
-    "(*  3|DHA @,| (U @8|!~!~HHA 0/| 0 D|!HC P<|\"0 P|#0 N|$$ <\"|%HC  W| - "
-    "T|!~(HC 08|-(U PX|*HC P0|+HC @0|,$ B\"|!~!~/H) P\"| (9 @$|!(9 P<|\"(9  "
-    "&|#(9 P%|$(9 P,|%(9  W|!~'(9 P4|((9 P-|!~SH= @$|TH= @$|<H) P2|=H) 02|>H"
-    ") @1|?H) @2|@H)  2|AH) P1|BH) 01|CH)  3|!~ H&!@8|!H&!@W|!~!~$H&!@3|!~&H"
-    "&!PW|'H&!0K|Q(U PO|)H&! N|!~!~,H&!04|-H&! K|.H&!0:|D(9 @,|0H&!@:|1H&!PM"
-    "|2H&!@L|3H&!0I|4H&!0N|5H&!0U|!~7H&!0M|8H&!@M|9H&!PL|:H&!0L|;H&! M|[- R|"
-    "!~!~ 0 D|!$ F#|\"(@  &|#(@ P%|(- @\"|%0 X&|EH&!@N|!~,- >\"|!~*(@ P0|+(@"
-    " @0|4- \"%| HJ @8|!0 \\&|7-  %|!~$HJ @3|6- :\"|&0 ^&|'H!!0K|!~)H!! N|;-"
-    " L!|WH&!0T|,HJ 04|-H!! K|.HJ 0:|!~0HJ @:|1H!!PM|2H!!@L|3HJ 0I|4H!!0N|5H"
-    "!!0U|!~7H!!0M|8H!!@M|9H!!PL|:H!!0L|;H!! M| (C @$|!(C P<|\"(C  &|#(C P%|"
-    "!~%(C  W|!~!~((C 08|EH!!@N|*(C P0|+(C @0| HJ @8|!0 \\&|!~!~$HJ @3|!~&0 "
-    "^&|'H!!0K|!~)H!! N|!~!~,HJ 04|-H!! K|.HJ 0:|W$ B&|0HJ @:|1H!!PM|2H!!@L|"
-    "3HJ 0I|4H!!0N|5H!!0U|!~7H!!0M|8H!!@M|9H!!PL|:H!!0L|;H!! M| H%! X|!H%!@A"
-    "|\"H%! &|#H%!P%|$H%!@3| (( @$|&H%!P:|\"((  &|#(( P%|EH!!@N|!~!~,H%!04|("
-    "$ $!|.H%!0:|/H%!P\"|0H%!@:|!~!~3H%!0I|/(( P\"| $ $#|!~!~!~$$ H$|!~!~<H%"
-    "!P2|=H%!02|>H%!@1|?H%!@2|@H%! 2|AH%!P1|BH%!01|CH%! 3| 0  '|!0 ,$|\"0 P|"
-    "#0 N|$0 <\"|IH%!@>|&0 6#|6$ &!| $ D|!~!~ H# @$|,0 B\"|%H0  W|.0 2#|/0 6"
-    "|00 4#| H5 @$|!H5 P<|30 *%|!~!~%H5  W|F$ \\$|'H5 P4|(H5 P-|/H# P\"|!~<0"
-    " 6\"|=0 2\"|>0 ,\"|?0 4\"|@0 0\"|A0 .\"|B0 *\"|C0 8\"| (&! X|!(&!@A|\"("
-    "&! &|#(&!P%|$(&!@3|IH- @>|&(&!P:|Z, J$|[, D$|\\, V%|!~!~,(&!04|!~.(&!0:"
-    "|/(&!P\"|0(&!@:|JH# P!|!~3(&!0I|MH# P#|NH#  $|OH# 0$|PH# @#|!~!~!~ (V @"
-    "8|<(&!P2|=(&!02|>(&!@1|?(&!@2|@(&! 2|A(&!P1|B(&!01|C(&! 3|!~!- J|\"- L|"
-    "!~-(V PX|I(&!@>| 0  '|!0 \"'|\"0 P|#0 N|$0 B(|%0 X&|&(D P:|'H; P4|(0 D("
-    "| 0 $#|*(D P0|+(D @0|,(D 04|$$ H$|.(D 0:|!$ *&|0(D @:|1H;  /|)$ L$|3(D "
-    "0I|4H; P.|'$ :%|-(U PX|!~ 0 $#|!~!~-$ 8%|$$ H$|C- ^|!~6$ &!|!~)$ L$|Q(V"
-    " PO|5$ J&|DH; @,|-(U PX|!~!~HH; 0/| $ D|!~\"$ P|#$ N|$$ F!|6$ &!|F$ \\$"
-    "|G$ Z$| HC @$|!HC P<|\"HC  &|#HC P%|$$ <\"|%HC  W|!~!~(HC 08|Q(U PO|*HC"
-    " P0|+HC @0|,$ B\"|F$ \\$|G$ Z$|!~ $ $#|!~Z, J$|[, D$|\\, X$|], N$|^, V$"
-    "|_, T$|Q(U PO|!~!~#- R$|D$ D!|-(T PX|&- P$|!~!~Z, J$|[, D$|\\, X$|], N$"
-    "|^, V$|_, T$|/- F$|!~I$ ($|#- R$|!~4- \"%|&- P$| $ $#|7-  %|\"$ N#|!~$$"
-    " H$|!~!~!~/- F$|)$ >(| - 4!|!- 6!|\"- L|4- \"%|$- B!|%- H!|7- L'|!~!~Q$"
-    " ^%|*- @!|+- >!|6$ @(|-- <!|.- D#|!~(- @\"|!~Z, Z%|!( !0Q|,- >\"|!~!~!~"
-    "&( ! L|'( !0K|!~)( ! N|F$ \\$|G$ Z$|6- :\"|-( ! K|!~9- *$|!~1( !PM|2( !"
-    "@L|!~4( !0N|5( !0U|R$ P#|7( !0M|8( !@M|9( !PL|:( !0L|;( ! M|!~!~Z, J$|["
-    ", D$|\\, X$|], N$|^, V$|_, T$| (< @$|E( !@N|!~#- ,&|!~%(<  W|!~'- 2$|!~"
-    ")- 8$|*$ &\"|+$ $\"| 0  '|!(9 P<|\"(9  &|#(9 P%|$0 J(|%(9  W|2- :$|'(9 "
-    "P4|((9 P-|)$ L$|T- \\%|!~!~!~!~ (R  X|!(R 0X|\"(R  &|#(R P%|$(R @3|%(R "
-    " W|&(R P:|6$ &!|((R 08|)$ B#|*(R P0|+(R @0|,(R 04|!~.(R 0:|!~0(R @:|!~!"
-    "~3(R 0I|!~D(9 @,|6$ 8#|F$ \\$|G$ Z$| H8 @$|!H8 P<|\"H8  &|#H8 P%|$H8 P,"
-    "|%H8  W|!~'H8 P4|(H8 P-| H7 @$|!H7 P<|\"H7  &|#H7 P%|$H7 P,|%H7  W|!~'H"
-    "7 P4|(H7 P-|Z, J$|[, D$|\\, X$|], N$|^, :&| 0 D|!H: P<|\"0 P|#0 N|$H: P"
-    ",|%0 X&|!~'H: P4|(0 N!|!~*0 &\"|+0 $\"|!~DH8 @,|!~:- \"\"|!~1H:  /|!~ H"
-    "$ @$|4H: P.|@- J\"|DH7 @,|'- 4%| 0  '|!H8 P<|\"H8  &|#H8 P%|$0 J(|%H8  "
-    "W|!~'H8 P4|(H8 P-|)$ L$|/H$ P\"|)$ B#|DH: @,|!~!~!~HH: 0/|!~ 0 D|!HS P<"
-    "|\"0 P|#0 N|6$ &!|%HS  W|6$ 8#|!~!~!~*HS P0|+HS @0|!~!~!~/H. P\"|!~K- 6"
-    "%|DH8 @,|JH$ P!|F$ \\$|G$ Z$|MH$ P#|NH$  $|OH$ 0$|PH$ @#|!~!~<H. P2|=H."
-    " 02|>H. @1|?H. @2|@H.  2|AH. P1|BH. 01|CH.  3|!~!~0- H#|!~Z, J$|[, D$|\\"
-    ", X$|], >&| (5 @$|!(5 P<|!~!~:- \"\"|%(5  W|!~'$ F\"|((5 P-|!~@-  \"|'-"
-    " 2$|X$ &&|!~D- ^!| 0  '|!0 \"'|\"0 P|#0 N|$0 <\"|%0 X&|&0 6#|2- 0$|(0 \""
-    "#|!~*0 &\"|+0 $\"|,0 B\"|!~.0 2#|!~00 4#|!~ (%!@$|30 *%|\"(%! &|#(%!P%|"
-    "!~!~!~!~ HO  X|!HO 0X|\"HO  &|#HO P%|$HO @3|%HO  W|&HO P:|/(%!P\"|(HO 0"
-    "8|!~*HO P0|+HO @0|,HO 04|!~.HO 0:|!~0HO @:|KHP  D|L0 $'|3HO 0I|<(%!P2|="
-    "(%!02|>(%!@1|?(%!@2|@(%! 2|A(%!P1|B(%!01|C(%! 3|!~!~ 0 D|!~\"0 P|#0 N|J"
-    "(%!P!|!~!~M(%!P#|N(%! $|O(%!0$|P(%!@#|!~!~KHP  D|LHO @X|/0 6|   L&|!(7 "
-    "P<|\"$ P|#$ N|$$ F!|%(7  W|!~'(7 P4|((7 P-|!~!~!~<0 6\"|=0 2\"|>0 ,\"|?"
-    "0 4\"|@0 0\"|A0 .\"|B0 *\"|C0 8\"| H' @$|!~\"H'  &|#H' P%|!~A- >$|J0 .|"
-    "!~!~M0 >|N0 @|O0 B|P0 <|!~!~/H' P\"|D$ D!|\\- D\"| (N  X|!(N 0X|\"(N  &"
-    "|#(N P%|$(N @3|%(N  W|&(N P:|!~((N 08|!~*(N P0|+(N @0|,(N 04|A- >$|.(N "
-    "0:|!~0(N @:|!~!~3(N 0I|)$ B#|!~!~!~!~!~ - 4!|!- 6!|\"- L|!~$- B!|%- H!|"
-    "!~6$ 8#| 0 D|!0 F#|*- @!|+- T!|!~%0 X&|!~'0 F\"|(0 N!|!~L  P&| $ 0%|!$ "
-    "0%|\"$ 0%|#$ 0%|$$ 0%|%$ 0%|&$ 0%|!~($ 0%|K(Q  D|*$ 0%|+$ 0%|,$ 0%|!~.$"
-    " 0%|!~0$ 0%|!~!~3$ 0%| $ 0%|!$ 0%|\"$ 0%|#$ 0%|$$ 0%|%$ 0%|&$ 0%|!~($ 0"
-    "%|!~*$ 0%|+$ 0%|,$ 0%|!~.$ 0%|!~0$ 0%|'- F(|!~3$ 0%|!~!~!~K(N @C|L$ 0%|"
-    " H#!@$|!H#!P<|\"H#! &|#H#!P%|$H#!P,|%H#! W|!~'H#!P4|(H#!P-|!~*H#!P0|+H#"
-    "!@0|!~!~Z- 8|>- ,%|?- @#|1H#! /|K(N @C|L$ 0%|4H#!P.| (B @$|!(B P<|\"(B "
-    " &|#(B P%|$(B P,|%(B  W|!~'(B P4|((B P-|X- 2%|*(B P0|+(B @0|!~!~!~DH#!@"
-    ",|!~1(B  /|!~HH#!0/|4(B P.|!(Z 0Q|!~!~ H\" @$|F- R!|&(Z  L|'(Z 0K|!~)$ "
-    "P%|SH#!0(|TH#! (|!~-(Z  K|!~!~D(B @,|1$ N%|2(Z @L|/H\" P\"|H(B 0/|5(Z 0"
-    "U|!~7(Z 0M|8(Z @M|9(Z PL|:(Z 0L|;(Z  M|!~!~!~S(B 0(|T(B  (| HO  X|!HO 0"
-    "X|\"HO  &|#HO P%|$HO @3|%HO  W|&HO P:|!~(HO 08|!~*HO P0|+HO @0|,HO 04|J"
-    "$ .|.HO 0:|!~0HO @:|!~!~3HO 0I| (S  X|!(S 0X|\"(S  &|#(S P%|$(S @3|%(S "
-    " W|&(S P:|!~((S 08| $ $#|*(S P0|+(S @0|,(S 04|$$ <\"|.(S 0:|&$ 6#|0(S @"
-    ":|!~!~3(S 0I|!~,$ B\"|!~.$ 2#|LHO @X|0$ 4#| HR  X|!HR 0X|\"HR  &|#HR P%"
-    "|$HR @3|%HR  W|&HR P:|!~(HR 08|!~*HR P0|+HR @0|,HR 04|!~.HR 0:|!~0HR @:"
-    "|K(S  D|L(S @X|3HR 0I| (A @$|!(A P<|\"(A  &|#(A P%|$(A P,|%(A  W|!~'(A "
-    "P4|((A P-|!~*(A P0|+(A @0|!~!~!~!~O- *|1(A  /| H! @$|!~4(A P.|Z, 0#|!~K"
-    "HR  D|LHR @X|!~Y- ,| 0 D|!~\"0 P|#0 N|A- >$|%0 X&|/H! P\"|!~(- (#|D(A @"
-    ",|*0 &\"|+0 $\"|,- &#|H(A 0/| $ D|!~\"$ P|#$ N|$$ F!|!~!~5- \"&|!~!~S$ "
-    "\"!|T$  !| (O  X|!(O 0X|\"(O  &|#(O P%|$(O @3|%(O  W|&(O P:|JH! P!|((O "
-    "08|!~*(O P0|+(O @0|,(O 04|!~.(O 0:|!(\"!0Q|0(O @:|!~!~3(O 0I|&(\"! L|'("
-    "\"!0K|Y$ (|)(\"! N|D$ D!|!~!~-(\"! K|!~!~!~1(\"!PM|2(\"!@L|!~4(\"!0N|5("
-    "\"!0U|!~7(\"!0M|8(\"!@M|9(\"!PL|:(\"!0L|;(\"! M|!~KHP  D|L(O @X|!~ $ D|"
-    "!~\"$ P|#$ N|$$ F!|E(\"!@N| - 4!|!- 6!|\"- L|!~$- B!|%- H!|!~!~ (# @$|!"
-    "~*- @!|+- >!|!(_ 0Q|-- <!|.- :!|!~!~&(_  L|'(_ 0K|3- 8!|)(_  N|L- \"|M-"
-    " $|/(# P\"|-(_  K|!~Q- &|!~1(_ PM|2(_ @L|D$ D!|4(_ 0N|5(_ 0U|!~7(_ 0M|8"
-    "(_ @M|9(_ PL|:(_ 0L|;(_  M|!~!~!~ $ $#|!~!~!~$$ H$|!~E(_ @N|!~J(# P!|)$"
-    " L$|!~M$ >|N$ @|O$ B|P$ <|!~ - 4!|!- 6!|\"- L|!~$- B!|%- H!|6$ &!|!~!~!"
-    "~*- @!|+- >!|!H !0Q|-- <!|.- :!|!~!~&H ! L|'H !0K|3- \\!|)H ! N|!(W 0Q|"
-    "F$ \\$|G$ Z$|-H ! K|!~&$ @%|'(W 0K|1H !PM|2H !@L|!~4H !0N|5H !0U|-(W  K"
-    "|7H !0M|8H !@M|9H !PL|:H !0L|;H ! M|!~!~5(W 0U|Z, J$|[, D$|\\, X$|], N$"
-    "|^, V$|_, T$|EH !@N|!~!~#- R$|!~!~&- P$|!~ (O  X|!(O 0X|\"(O  &|#(O P%|"
-    "$(O @3|%(O  W|&(O P:|/- F$|((O 08|S- :|*(O P0|+(O @0|,(O 04|!~.(O 0:|!("
-    "!!0Q|0(O @:|!~!~3(O 0I|&(!! L|'(!!0K|!~)(!! N| $ $#|!~!~-(!! K|$$ H$|!~"
-    "!~1(!!PM|2(!!@L|)$ L$|4(!!0N|5(!!0U|!~7(!!0M|8(!!@M|9(!!PL|:(!!0L|;(!! "
-    "M|!~!~L(O @X| H> @$|6$ &!|\"H>  &|#H> P%|!~%H>  W|E(!!@N|!H_ 0Q|!~!~*H>"
-    " P0|+H> @0|&H_  L|'H_ 0K|!~)H_  N|!HV 0Q|F$ \\$|G$ Z$|-H_  K|!~&$ @%|'H"
-    "V 0K|1H_ PM|2H_ @L|!~4H_ 0N|5H_ 0U|-HV  K|7H_ 0M|8H_ @M|9H_ PL|:H_ 0L|;"
-    "H_  M|!~!~5HV 0U|Z, J$|[, D$|\\, X$|], N$|^, V$|_, T$|EH_ @N|!~!H!!0Q|#"
-    "- R$|!~!~&- P$|&H!! L|'H!!0K|!~)H!! N|!~!~!~-H!! K|/- <%|!~!~1H!!PM|2H!"
-    "!@L|!~4H!!0N|5H!!0U|!~7H!!0M|8H!!@M|9H!!PL|:H!!0L|;H!! M|!H^ 0Q|!~!~!~!"
-    "~&H^  L|'H^ 0K|!~)H^  N|EH!!@N|!~!~-H^  K|!~!~!~1H^ PM|2H^ @L|!~4H^ 0N|"
-    "5H^ 0U|!~7H^ 0M|8H^ @M|9H^ PL|:H^ 0L|;H^  M|!(] 0Q|!~!~!~!~&(]  L|'(] 0"
-    "K|!~)(]  N|EH^ @N|!~!~-(]  K|!~!~!~1(] PM|2(] @L|!~4$ R%|5(] 0U|!~7(] 0"
-    "M|8(] @M|9(] PL|:(] 0L|;(]  M|!0 *&|!~!~!~!~&0 @%|'0 :%|!~)0 P%|E$ T%|!"
-    "~!~-0 8%|!~!~!~10 N%|20 D%|!~40 R%|50 J&|!~70 J%|80 L%|90 F%|:0 B%|;0 H"
-    "%|!0 *&|!~!~!~!~&0 @%|'0 :%|!~)0 P%|E0 T%|!~!~-0 8%|!~!~!~10 N%|20 D%|!"
-    "~4$ R%|50 J&|\"$ N#|70 J%|80 L%|90 F%|:0 B%|;0 H%|!0 *&|)$ B#|!~!~!~&0 "
-    "@%|'0 :%|!~)0 P%|E$ T%|!~!~-0 8%|!~6$ 8#|!~10 N%|20 D%|!~40 R%|50 J&|!~"
-    "70 J%|80 L%|90 F%|:0 B%|;0 H%|!~ $ $#|!~!~!~$$ H$|!~!~!(^ 0Q|E0 T%|)$ L"
-    "$|!~!~&(^  L|'(^ 0K|R$ P#|)(^  N|!~!~!~-(^  K|!~!~6$ &!|1(^ PM|2(^ @L|!"
-    "~4(^ 0N|5(^ 0U|!~7(^ 0M|8(^ @M|9(^ PL|:(^ 0L|;(^  M|!~'- 2$|!~)- 4$|F$ "
-    "\\$|G$ Z$|!~!~!~E(^ @N|!~!~2- 6$|!~!~ H; @$|!H; P<|\"H;  &|#H; P%|$H; P"
-    ",|%H;  W|!~'H; P4|(H; P-|Z, J$|[, D$|\\, X$|], N$|^, V$|_, T$|!~!~1H;  "
-    "/|#- R$|!~4H; P.|&- P$|!~ 0  '|!0 \"'|\"HI  &|#HI P%|$0 <\"|%HI  W|&0 6"
-    "#|/- H&|(HI 08|!~*HI P0|+HI @0|,0 B\"|DH; @,|.0 2#|!~00 4#|HH; 0/|!~30 "
-    "*%| HN  X|!HN 0X|\"HN  &|#HN P%|$HN @3|%HN  W|&HN P:|!~(HN 08|!~*HN P0|"
-    "+HN @0|,HN 04|!~.HN 0:|!H] 0Q|0HN @:|!~!~3HN 0I|&H]  L|'H] 0K|!~)H]  N|"
-    "L$ <$|!~!~-H]  K|!~!~!~1H] PM|2H] @L|!~4H] 0N|5H] 0U|!~7H] 0M|8H] @M|9H"
-    "] PL|:H] 0L|;H]  M|!H\\ 0Q|!~LHN @X|!~!~&H\\  L|'H\\ 0K|!~)H\\  N|EH] @"
-    "N|!~!~-H\\  K|!~!~!~1H\\ PM|2H\\ @L|!~4$ R%|5H\\ 0U|!~7H\\ 0M|8H\\ @M|9"
-    "H\\ PL|:H\\ 0L|;H\\  M|!(\\ 0Q|!~!~!~!~&(\\  L|'(\\ 0K|!~)(\\  N|E$ T%|"
-    "!~!~-(\\  K|!~!~!~1(\\ PM|2(\\ @L|!~4$ R%|5(\\ 0U|!~7(\\ 0M|8(\\ @M|9(\\"
-    " PL|:(\\ 0L|;(\\  M|!0 *&|!~!~!~!~&0 @%|'0 :%|!~)0 P%|E$ T%|!~!~-0 8%|!"
-    "~!~!~10 N%|20 D%|!~40 R%|50 J&|!~70 J%|80 L%|90 F%|:0 B%|;0 H%| HI  X|!"
-    "HI 0X|\"HI  &|#HI P%|$HI @3|%HI  W|&HI P:|!~(HI 08|E0 T%|*HI P0|+HI @0|"
-    ",HI 04|!~.HI 0:|!~0HI @:|!~!~3HI 0I| HQ  X|!HQ 0X|\"HQ  &|#HQ P%|$HQ @3"
-    "|%HQ  W|&HQ P:|!~(HQ 08| $ $#|*HQ P0|+HQ @0|,HQ 04|$$ H$|.HQ 0:|!~0HQ @"
-    ":|!~)$ L$|3HQ 0I|!~!~!~!~L$ <$| H@ @$|!H@ P<|\"H@  &|#H@ P%|$H@ P,|%H@ "
-    " W|6$ &!|'H@ P4|(H@ P-|!HW 0Q|*H@ P0|+H@ @0|!~!~&HW  L|'HW 0K|!~1H@  /|"
-    "!~!~4H@ P.|-HW  K|F$ \\$|G$ Z$|!~!~2$ D%|!~!~5HW 0U|!~7$ J%|8$ L%|9$ F%"
-    "|:$ B%|;$ H%|DH@ @,|!~!~!~HH@ 0/|!~Z, J$|[, D$|\\, X$|], N$|^, V$|_, T$"
-    "|!~!~!~#- R$|!~!~&- (&| (J  X|!(J 0X|\"(J  &|#(J P%|$(J @3|%(J  W|&(J P"
-    ":|!~((J 08|!~*(J P0|+(J @0|,(J 04|!~.(J 0:|!~0(J @:|!~!~3(J 0I| (D  X|!"
-    "(D 0X|\"(D  &|#(D P%|$(D @3|%(D  W|&(D P:|!~((D 08|!~*(D P0|+(D @0|,(D "
-    "04|!~.(D 0:|!~0(D @:|!~!~3(D 0I| (I  X|!(I 0X|\"(I  &|#(I P%|$(I @3|%(I"
-    "  W|&(I P:|!~((I 08|!~*(I P0|+(I @0|,(I 04|!~.(I 0:|!~0(I @:|!~!~3(I 0I"
-    "| (A @$|!(A P<|\"(A  &|#(A P%|$(A P,|%(A  W|!~'(A P4|((A P-|!~*(A P0|+("
-    "A @0|!~!~!~!~!~1(A  /|!~!~4(A P.|!~!~ (P  X|!(P 0X|\"(P  &|#(P P%|$(P @"
-    "3|%(P  W|&(P P:|!~((P 08|!~*(P P0|+(P @0|,(P 04|D(A @,|.(P 0:|!~0(P @:|"
-    "H(A 0/|!~3(P 0I| $ D|!$ D|\"$ D|#$ D|$$ D|%$ D|!~'$ D|($ D|!~!~ (8 @$|!"
-    "(8 P<|\"(8  &|#(8 P%|$(8 P,|%(8  W|1$ D|'(8 P4|((8 P-|4$ D|!~!~ 0  '|!0"
-    " \"'|\"(C  &|#(C P%|$HH @3|%(C  W|&HH P:|!~((C 08|!~*(C P0|+(C @0|,HH 0"
-    "4|D$ D|.HH 0:|!~0HH @:|H$ D|!~3HH 0I|!~!~!~!~D(8 @,|!~!~!~S(7 @$|T(7 @$"
-    "| HA @$|!HA P<|\"HA  &|#HA P%|$HA P,|%HA  W|!~'HA P4|(HA P-|!~*HA P0|+H"
-    "A @0|!~!~!~!~!~1HA  /|!~!~4HA P.|!~!~ 0  '|!0 \"'|\"HB  &|#HB P%|$HM @3"
-    "|%HB  W|&HM P:|!~(HB 08|!~*HB P0|+HB @0|,HM 04|DHA @,|.HM 0:|!~0HM @:|H"
-    "HA 0/|!~3HM 0I| 0  '|!0 \"'|\"0 P|#0 N|$0 <\"|%0 X&|&0 6#|!~(0 \"#|!~*0"
-    " &\"|+0 $\"|,0 B\"|!~.0 2#| H+ @$|00 4#|\"H+  &|#H+ P%|30 *%|!~ HG @8|!"
-    "HG @A|!~!~$HG @3|!~&HG P:|!~!~/H+ P\"|!~!~,HG 04|!~.HG 0:| 0 D|0HG @:|\""
-    "0 P|#0 N|3HG 0I|!~!~<H+ P2|=H+ 02|>H+ @1|?H+ @2|@H+  2|AH+ P1|BH+ 01|CH"
-    "+  3|/0 6|!~!~!~!~I$ T#| H) @$|!~\"H)  &|#H) P%|!~!~!~<0 6\"|=0 2\"|>0 "
-    ",\"|?0 4\"|@0 0\"|A0 .\"|B0 *\"|C0 8\"|/H) P\"| (4 @$|!(4 P<|\"(4  &|#("
-    "4 P%|IH- @>|%(4  W|!~!~($ \"#|!~*(4 P0|+(4 @0|<H) P2|=H) 02|>H) @1|?H) "
-    "@2|@H)  2|AH) P1|BH) 01|CH)  3|!~!(Y 0Q|!~!~!~!~&(Y  L|'(Y 0K|!~)$ P%|!"
-    "~!~!~-(Y  K|!~!~!~1$ N%|2(Y @L|!~B- ^$|5(Y 0U|!~7(Y 0M|8(Y @M|9(Y PL|:("
-    "Y 0L|;(Y  M|!HX 0Q|E- .$|!~!~!~&HX  L|'HX 0K|!~)$ P%| $ $#|!~!~-HX  K|$"
-    "$ H$|!~!~1$ N%|2HX @L|!~!~5HX 0U|!~7HX 0M|8HX @M|9HX PL|:HX 0L|;HX  M|;"
-    "- L!|!HY 0Q|!~!~6$ L(|!~&HY  L|'HY 0K|!~)$ P%|!~!~!~-HY  K|!~!~!~1$ N%|"
-    "2HY @L|!~F$ \\$|5HY 0U|!~7HY 0M|8HY @M|9HY PL|:HY 0L|;HY  M| 0 D|!~\"0 "
-    "P|#0 N| $ $#|!(H @A|!~!~$$ <\"|!~&$ 6#|!~Z, J$|[, D$|\\, >%|/0 6|,$ B\""
-    "|!~.$ 2#|!~0$ 4#| H( @$|!~\"H(  &|#H( P%|!~!~!~<0 6\"|=0 2\"|>0 ,\"|?0 "
-    "4\"|@0 0\"|A0 .\"|B0 *\"|C0 8\"|/H( P\"| HB @$|!HB P<|\"HB  &|#HB P%|I("
-    "- @>|%HB  W|!~!~(HB 08|!~*HB P0|+HB @0|<$ 6\"|=$ 2\"|>$ ,\"|?$ 4\"|@$ 0"
-    "\"|A$ .\"|B$ *\"|C$ 8\"|!~!~!~!~!~Z, 0#| 0 $#|!0 ,$|!~!~$0 <\"|!~&0 6#|"
-    " 0 D|!~\"0 P|#0 N|!~,0 B\"|(- (#|.0 2#|!~00 4#|,- &#|!~30 *%|!~ $ $#|/0"
-    " 6|!~!~$$ H$|5- .#|!~!~!~)$ L$|!~!~<- ,#|=- *#|<0 6\"|=0 2\"|>0 ,\"|?0 "
-    "4\"|@0 0\"|A0 .\"|B0 *\"|C0 8\"|6$ &!| $ D|!~\"$ P|#$ N|I0 T#| (; @$|!("
-    "; P<|\"(;  &|#(; P%|$(; P,|%(;  W|!~'(; P4|((; P-|!~F$ \\$|G$ Z$|!~ (, "
-    "@$|!~\"(,  &|#(, P%|1(;  /|!~!~4(; P.|!~!~!~!~!~!~V- (\"|/(, P\"|!~Z, J"
-    "$|[, D$|\\, X$|], N$|^, V$|_, T$|D(; @,|!~!~#- ,&|H(; 0/|<(, P2|=(, 02|"
-    ">(, @1|?(, @2|@(,  2|A(, P1|B(, 01|C(,  3|!~!H[ 0Q|!~E- .$|!~I(, @>|&H["
-    "  L|'H[ 0K|!~)$ P%| - 4!|!- 6!|\"- L|-H[  K|$- J!|%- H!|!~1$ N%|2H[ @L|"
-    "!~!~5H[ 0U|!~7H[ 0M|8H[ @M|9H[ PL|:H[ 0L|;H[  M| H- @$|!~\"H-  &|#H- P%"
-    "|!~!~ (G @8|!(E @A|!~!~$(G @3|!~&(G P:|!~!~/H- P\"|!~!~,(G 04|!~.(G 0:|"
-    " H, @$|0(G @:|\"H,  &|#H, P%|3$ *%|!~!~<H- P2|=H- 02|>H- @1|?H- @2|@H- "
-    " 2|AH- P1|BH- 01|CH-  3|/H, P\"|   N&|!~\"$ P|#$ N|IH- @>|%H=  W|!~!~!~"
-    "!~*H= P0|+H= @0|<H, P2|=H, 02|>H, @1|?H, @2|@H,  2|AH, P1|BH, 01|CH,  3"
-    "|!~!0 *&|!~!~!~IH, @>|&0 @%|'0 :%|!~)$ P%|!~!~!~-0 8%|!~!~!~1$ N%|20 D%"
-    "|!~!~50 J&|!~70 J%|80 L%|90 F%|:0 B%|;0 H%| (- @$|!~\"(-  &|#(- P%| 0 D"
-    "|!0 F#|\"0 P|#0 N|$0 F!|%0 X&|!~'0 F\"|(0 N!|!~!~/(- P\"| - 4!|!- 6!|\""
-    "- L|!~$- L\"|%- H!|!~!~!~!~I- &%|J- (%|<(- P2|=(- 02|>(- @1|?(- @2|@(- "
-    " 2|A(- P1|B(- 01|C(-  3|!~!([ 0Q|!~!~D0 D!|I(- @>|&([  L|'([ 0K|!~)$ P%"
-    "|!~!~!~-([  K| (% @$|!~!~1$ N%|2([ @L|G- J#|!~5([ 0U|!~7([ 0M|8([ @M|9("
-    "[ PL|:([ 0L|;([  M|!HZ 0Q|/(% P\"|!~!~!~&HZ  L|'HZ 0K|!~)$ P%|!~!~!~-HZ"
-    "  K|!~!~!~1$ N%|2HZ @L|!~!~5HZ 0U|!~7HZ 0M|8HZ @M|9HZ PL|:HZ 0L|;HZ  M|"
-    " H* @$|J(% P!|\"H*  &|#H* P%|M(% P#|N(%  $|O(% 0$|P(% @#| (* @$|!~\"(* "
-    " &|#(* P%|)$ B#|!~!~/H* P\"| H4 @$|!~\"H4  &|#H4 P%|!~%H4  W|!~/(* P\"|"
-    "($ N!|6$ 8#|*H4 P0|+H4 @0|<H* P2|=H* 02|>H* @1|?H* @2|@H*  2|AH* P1|BH*"
-    " 01|CH*  3|<(* P2|=(* 02|>(* @1|?(* @2|@(*  2|A(* P1|B(* 01|C(*  3| $ $"
-    "#|!~K(Q  D|!~$$ H$|!~ $ $#|!~!~)$ L$|$$ H$|!~ $ $#| HM @8|!HM @A|)$ L$|"
-    "$$ H$|$HM @3|!~&HM P:|!~)$ L$|6$ &!|!~!~,HM 04|!~.HM 0:|6$ &!|0HM @:|'-"
-    " >#|!~3HM 0I|!~6$ &!|!~!~!~F$ \\$|G$ Z$|!~2- :#| H% @$|!~F$ \\$|G$ Z$|!"
-    "~!~!~!~F$ \\$|G$ Z$|0- H#|>- <#|?- @#|!~!~/H% P\"|Z, J$|[, D$|\\, X$|],"
-    " N$|^, V$|_, 2&|Z, J$|[, D$|\\, X$|], N$|^, V$|_, 0&|Z, J$|[, D$|\\, X$"
-    "|], N$|^, V$|_, .&| (+ @$| $ $#|\"(+  &|#(+ P%|!~$$ H$|!~!~JH% P!|!~)$ "
-    "L$|MH% P#|NH%  $|OH% 0$|PH% @#|/(+ P\"|!~!~!~!~!~!~ (. @$|6$ &!|\"(.  &"
-    "|#(. P%|!~!~<(+ P2|=(+ 02|>(+ @1|?(+ @2|@(+  2|A(+ P1|B(+ 01|C(+  3|!~/"
-    "(. P\"|!~F$ \\$|G$ Z$|!~!~ (/ @$|!~\"(/  &|#(/ P%|!~!~!~<(. P2|=(. 02|>"
-    "(. @1|?(. @2|@(.  2|A(. P1|B(. 01|C(.  3|/(/ P\"|Z, J$|[, D$|\\, X$|], "
-    "N$|^, V$|_, 6&| H/ @$|!~\"H/  &|#H/ P%|!~)$ B#|<(/ P2|=(/ 02|>(/ @1|?(/"
-    " @2|@(/  2|A(/ P1|B(/ 01|C(/  3|!~/H/ P\"|!~!~6$ 8#|!~!~ (0 @$|!~\"(0  "
-    "&|#(0 P%|!~!~!~<H/ P2|=H/ 02|>H/ @1|?H/ @2|@H/  2|AH/ P1|BH/ 01|CH/  3|"
-    "/(0 P\"|!~!~K(Q  D| H: @$|!H: P<|\"H:  &|#H: P%|$H: P,|%H:  W|!~'H: P4|"
-    "(H: P-|<(0 P2|=(0 02|>(0 @1|?(0 @2|@(0  2|A(0 P1|B(0 01|C(0  3|1H:  /|!"
-    "~!~4H: P.| (: @$|!(: P<|\"(:  &|#(: P%|$(: P,|%(:  W|'- .%|'(: P4|((: P"
-    "-| $ $#|!~!~!~$$ H$|!~DH: @,|!~1$ X!|)$ L$|HH: 0/|4$ V!|!~ H. @$| $ $#|"
-    "\"H.  &|#H. P%|!~$$ H$|!~>- ,%|?- @#|6$ &!|)$ L$|!~!~!~D(: @,|/H. P\"|!"
-    "~!~H$ Z!|!~!~!~!~6$ &!|!~F$ \\$|G$ Z$|!~<H. P2|=H. 02|>H. @1|?H. @2|@H."
-    "  2|AH. P1|BH. 01|CH.  3|!~!~!~F$ \\$|G$ Z$| () @$|!~\"()  &|#() P%|Z, "
-    "J$|[, D$|\\, X$|], N$|^, V$|_, 4&|!~!~!~!~!~/() P\"|!~!~Z, J$|[, D$|\\,"
-    " X$|], N$|^, V$|_, 8&|!~!~!~!~<() P2|=() 02|>() @1|?() @2|@()  2|A() P1"
-    "|B() 01|C()  3| $ $#| HH @8|!HH @A|!~$$ H$|$HH @3|!0 *&|&HH P:|!~)$ L$|"
-    "!~&0 @%|'0 :%|,HH 04|!~.HH 0:|!~0HH @:|-0 8%|!~3HH 0I|!~6$ L(|2$ D%|!~!"
-    "~50 J&|!~7$ J%|8$ L%|9$ F%|:$ B%|;$ H%|!~!~!~!~!~F$ \\$|G$ Z$|!~!~!~ $ "
-    "$#|!~!~ $ D|$$ H$|\"$ P|#$ N|!~!(X 0Q|)$ L$|!~!~!~&(X  L|'(X 0K|Z, J$|["
-    ", D$|\\, N(|], N$|^, <&|-(X  K|!~6$ &!|!~!~2$ D%|!~!~5(X 0U|!~7$ J%|8$ "
-    "L%|9$ F%|:$ B%|;$ H%|!~!~!~F$ \\$|G$ Z$|!~ $ $#|!~!~!~$$ H$|!~!~!~!~)$ "
-    "L$|!~!~!~!~!~!~!~Z, J$|[, D$|\\, X$|], N$|^, :&|6$ &!|!~!~ $ $#| - 4!|!"
-    "- 6!|\"- L|$$ H$|$- L\"|%- H!| $ $#|!~)$ L$|!~$$ H$|!~F$ \\$|G$ Z$|!~)$"
-    " L$|!~!~!~!~!~6$ &!|!~!~!~!~!~!~6$ &!|!~!~ ($ @$|Z, J$|[, D$|\\, X$|], "
-    "N$|^, <&|F$ \\$|G$ Z$|G- P\"|!~!~!~!~F$ \\$|G$ Z$|/($ P\"|!~!~!~!~!~!~!"
-    "~!~W- N\"|!~Z, J$|[, D$|\\, X$|], >&|!~!~!~Z, J$|[, D$|\\, X$|], @&| (F"
-    " @8|!(F @A|!~!~$(F @3|J($ P!|&(F P:|!~M($ P#|N($  $|O($ 0$|P($ @#|,(F 0"
-    "4|!~.(F 0:|!~0(F @:| HJ @8|!HJ @A|3(F 0I|!~$HJ @3|!~&HJ P:|!~!~ (L @8|!"
-    "(L @A|!~,HJ 04|$(L @3|.HJ 0:|&(L P:|0HJ @:|!~!~3HJ 0I|!~,(L 04|!~.(L 0:"
-    "|!~0(L @:| HE @8|!HE @A|3(L 0I|!~$HE @3|!~&HE P:|!~!~ HL @8|!HL @A|!~,H"
-    "E 04|$HL @3|.HE 0:|&HL P:|0HE @:|\"$ N#|!~3HE 0I|!~,HL 04|!~.HL 0:|)$ B"
-    "#|0HL @:| (M @8|!(M @A|3HL 0I|!~$(M @3| (& @$|&(M P:|!~R- 0| (K @8|!(K "
-    "@A|6$ 8#|,(M 04|$(K @3|.(M 0:|&(K P:|0(M @:|!~!~3(M 0I|/(& P\"|,(K 04|!"
-    "~.(K 0:|!~0(K @:| HK @8|!HK @A|3(K 0I|!~$HK @3|!~&HK P:|!~!~!~!~!~,HK 0"
-    "4|R$ P#|.HK 0:|!~0HK @:|!~!~3HK 0I|!~J(& P!|!~!~M(& P#|N(&  $|O(& 0$|P("
-    "& @#|!~!~!~!~!~!~'- 2$|!~)- 8$|!~!~!~!~!~!~!~!~2- :$|!~!~!~!~!~!~!~!~!~"
+    "!|!|!|!|!|!||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||"
+    "|||||||||!|!|||||}*|0#|2\"|2#|.#|1\"|+#|0\"|*#|:\"|6\"|##|F\"|@\"|B\"|."
+    "\"|J\"|/\"|H\"|4\"|5\"|>\"|3\"|1#|Z\"|9\"|T\"|!#|R\"|\"#|O\"|$#|L\"|&#|"
+    "E\"|D\"|A\"|\?\"|Q\"|(#|%#| #|^\"|]\"|\\\"|[\"|X\"|W\"|V\"|U\"|Y\"|N\"|"
+    "M\"|8\"|'#|-\"|G\"|I\"|K\"|7\"|)#|S\"|4#|P\"|<\"|;\"|=\"|C\"|_\"|||||||"
+    "||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||,#|-#|/#|"
+    "3#|5#|6#|}+|!||!|!|||||||||||||||||||!||||||||||||||!||||||||||||||||||"
+    "|||||||!|||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||"
+    "||||||||||||||!|!|!|!|},|8\"|}-|!|#|!||!||\"|\"||#|#|#|#|#|#|#|#|#|#|#|"
+    "#|#|\"|\"||!|#|\"||#|#|#|#|\"|!|%|!|#|%|#|#|#|#|\"|!||\"|!|$|$|\"||\"|\""
+    "|\"||!|\"|!|\"|\"|\"|!|!|!|$|$|\"|!|\"|\"|!|!|!|\"|!|!|!|!|!|!||#|!|\"|"
+    "\"|\"|!||||!|$|\"|\"|!|\"|\"|\"|\"|\"|!|\"|\"|\"||#|!||!||\"|!|#|!|\"||"
+    "$|\"|#|!|#|!|#|#|#|#|#|#|!|#|#|!|#|#|!|\"|\"|!|#|!|!|!|!|!|!|!|!|!|!|!|"
+    "!|}.|'\"|#\"|\"\"|\"\"|U!|U!|&\"| \"| \"|_!|_!|_!|_!|_!|_!|_!|_!|_!|_!|"
+    "_!|_!|_!|Z!|[!|[!|\\!|\\!|F!|F!|Y!|Y!|Y!|Y!|N!|N!|E!|D!|Y!|Y!|Y!|Y!|Y!|"
+    "Y!|S!|V!|V!|W!|W!|Q!|=!|=!|=!|;!|M!|T!|M!|9!|8!|8!|7!|7!|7!|7!|6!|6!|6!"
+    "|Q!|P!|P!|B!|]!|]!|G!|G!|O!|1!|1!|.!|+!|@!|@!|@!|4!|K!|L!|R!|^!|%\"|%\""
+    "|R!|K!|\?!|5!|5!|5!|\?!|\?!|\?!|\?!|\?!|\?!|\?!|<!|I!|!\"|I!|H!|J!|J!|$"
+    "\"|$\"|3!|3!|C!|A!|>!|>!|X!|X!|:!|:!|2!|2!|/!|/!|/!|/!|/!|/!|/!|)!|)!|)"
+    "!|(!|(!|(!|'!|'!|'!|&!|&!|&!|&!|*!|*!|,!|%!|-!|-!|0!|0!|$!|}/|*accept* "
+    "::= Grammar|Grammar ::= Grammar:1 Grammar:2 RuleSection|Grammar:1 ::= O"
+    "ptionSection|Grammar:1 ::= *epsilon*|Grammar:2 ::= TokenSection|Grammar"
+    ":2 ::= *epsilon*|OptionSection ::= 'options' OptionSection:1|OptionSect"
+    "ion:1 ::= OptionSection:1 OptionSpec|OptionSection:1 ::= *epsilon*|Opti"
+    "onSpec ::= 'lookaheads' '=' IntegerValue|OptionSpec ::= 'conflicts' '='"
+    " IntegerValue|OptionSpec ::= 'keep_whitespace' '=' BooleanValue|OptionS"
+    "pec ::= 'case_sensitive' '=' BooleanValue|OptionSpec ::= 'lookahead_met"
+    "hod' '=' StringValue|OptionSpec ::= 'table_scheme' '=' StringValue|Opti"
+    "onSpec ::= 'keyword_table' '=' BooleanValue|OptionSpec ::= 'linear_scan"
+    "' '=' BooleanValue|OptionSpec ::= 'lazy_scanner' '=' BooleanValue|Optio"
+    "nSpec ::= 'pipeline_scanner' '=' BooleanValue|OptionSpec ::= 'intern_le"
+    "xemes' '=' BooleanValue|OptionSpec ::= 'lazy_ast' '=' BooleanValue|Opti"
+    "onSpec ::= 'minimize_method' '=' StringValue|TokenSection ::= 'tokens' "
+    "TokenSection:1|TokenSection:1 ::= TokenSection:1 TokenSpec|TokenSection"
+    ":1 ::= *epsilon*|TokenSpec ::= TerminalSymbol|TokenSpec ::= TerminalSym"
+    "bol ':' TokenSpec:1|TokenSpec:1 ::= TokenSpec:1 TokenOption|TokenSpec:1"
+    " ::= *epsilon*|TokenOption ::= 'template' '=' TerminalSymbol|TokenOptio"
+    "n ::= 'description' '=' StringValue|TokenOption ::= 'regex' '=' RegexSt"
+    "ring|TokenOption ::= 'regex' '=' TokenOption:1|TokenOption:1 ::= TokenO"
+    "ption:1 TokenRegex|TokenOption:1 ::= TokenRegex|TokenRegex ::= '[' Acti"
+    "onExpression ']' '=>' RegexString|RegexString ::= StringValue|TokenOpti"
+    "on ::= 'precedence' '=' IntegerValue|TokenOption ::= 'action' '=' '[' A"
+    "ctionStatementList ']'|TokenOption ::= 'lexeme' '=' BooleanValue|TokenO"
+    "ption ::= 'ignore' '=' BooleanValue|TokenOption ::= 'error' '=' StringV"
+    "alue|TokenOption ::= 'sync' '=' BooleanValue|RuleSection ::= RuleSectio"
+    "n:1 RuleSection:2|RuleSection:1 ::= 'rules'|RuleSection:1 ::= *epsilon*"
+    "|RuleSection:2 ::= RuleSection:2 Rule|RuleSection:2 ::= Rule|Rule ::= N"
+    "onterminalReference '::=' RuleRhsList ReduceActions|ReduceActions ::= '"
+    ":' ReduceAstAction ':' ReduceGuardAction|ReduceActions ::= ':' ReduceAs"
+    "tAction|ReduceActions ::= *epsilon*|RuleRhsList ::= RuleRhs RuleRhsList"
+    ":1|RuleRhsList:1 ::= RuleRhsList:1 RuleRhsList:2|RuleRhsList:2 ::= '{',"
+    "' RuleRhs|RuleRhsList:1 ::= *epsilon*|RuleRhs ::= RuleRhs:1|RuleRhs:1 :"
+    ":= RuleRhs:1 RuleSequenceTerm|RuleRhs:1 ::= RuleSequenceTerm|RuleSequen"
+    "ceTerm ::= RuleUnopTerm '*'|RuleSequenceTerm ::= RuleUnopTerm '+'|RuleS"
+    "equenceTerm ::= RuleUnopTerm '\?'|RuleSequenceTerm ::= RuleUnopTerm|Rul"
+    "eUnopTerm ::= SymbolReference|RuleUnopTerm ::= 'empty'|RuleUnopTerm ::="
+    " '(' RuleRhsList ReduceActions ')'|Rule ::= NonterminalReference '::^' "
+    "SymbolReference Rule:1|Rule:1 ::= Rule:1 PrecedenceSpec|Rule:1 ::= Prec"
+    "edenceSpec|PrecedenceSpec ::= Assoc PrecedenceSpec:1|PrecedenceSpec:1 :"
+    ":= PrecedenceSpec:1 Operator|PrecedenceSpec:1 ::= Operator|Assoc ::= '<"
+    "<'|Assoc ::= '>>'|Operator ::= SymbolReference ReduceActions|SymbolRefe"
+    "rence ::= TerminalReference|SymbolReference ::= NonterminalReference|Te"
+    "rminalReference ::= TerminalSymbol|NonterminalReference ::= Nonterminal"
+    "Symbol|ReduceAstAction ::= AstFormer|ReduceAstAction ::= AstChild|Reduc"
+    "eAstAction ::= *epsilon*|AstFormer ::= '(' AstFormer:1 ')'|AstFormer:1 "
+    "::= AstFormer:2|AstFormer:2 ::= AstItem AstFormer:3|AstFormer:3 ::= Ast"
+    "Former:3 AstFormer:4|AstFormer:4 ::= AstFormer:5 AstItem|AstFormer:5 ::"
+    "= ','|AstFormer:5 ::= *epsilon*|AstFormer:3 ::= *epsilon*|AstFormer:1 :"
+    ":= *epsilon*|AstItem ::= AstChild|AstChild ::= '$' AstChildSpec '.' Ast"
+    "SliceSpec|AstChild ::= '$' AstChildSpec|AstChild ::= '$' AstSliceSpec|A"
+    "stItem ::= Identifier|AstItem ::= '%' AstChildSpec|AstItem ::= '@' AstC"
+    "hildSpec|AstItem ::= '@' StringValue|AstItem ::= '&' AstChildSpec|AstIt"
+    "em ::= '&' StringValue|AstItem ::= AstFormer|AstChildSpec ::= AstChildN"
+    "umber AstChildSpec:1|AstChildSpec:1 ::= AstChildSpec:1 AstChildSpec:2|A"
+    "stChildSpec:2 ::= '.' AstChildNumber|AstChildSpec:1 ::= *epsilon*|AstSl"
+    "iceSpec ::= AstFirstChildNumber '_' AstLastChildNumber|AstFirstChildNum"
+    "ber ::= AstChildNumber|AstFirstChildNumber ::= *epsilon*|AstLastChildNu"
+    "mber ::= AstChildNumber|AstLastChildNumber ::= *epsilon*|AstChildNumber"
+    " ::= '-' <integer>|AstChildNumber ::= <integer>|ReduceGuardAction ::= '"
+    "[' ActionStatementList ']'|ActionStatementList ::= ActionStatementList:"
+    "1|ActionStatementList:1 ::= ActionStatementList:1 ActionStatement|Actio"
+    "nStatementList:1 ::= *epsilon*|ActionStatement ::= Identifier ':=' Acti"
+    "onExpression ';'|ActionStatement ::= 'dump_stack' ';'|ActionExpression "
+    "::= ActionExpression '{',' ActionExpression:1|ActionExpression ::= Acti"
+    "onExpression:1|ActionExpression:1 ::= ActionExpression:1 '&' ActionExpr"
+    "ession:2|ActionExpression:1 ::= ActionExpression:2|ActionExpression:2 :"
+    ":= ActionExpression:2 '=' ActionExpression:3|ActionExpression:2 ::= Act"
+    "ionExpression:2 '/=' ActionExpression:3|ActionExpression:2 ::= ActionEx"
+    "pression:2 '<' ActionExpression:3|ActionExpression:2 ::= ActionExpressi"
+    "on:2 '<=' ActionExpression:3|ActionExpression:2 ::= ActionExpression:2 "
+    "'>' ActionExpression:3|ActionExpression:2 ::= ActionExpression:2 '>=' A"
+    "ctionExpression:3|ActionExpression:2 ::= ActionExpression:3|ActionExpre"
+    "ssion:3 ::= ActionExpression:3 '+' ActionExpression:4|ActionExpression:"
+    "3 ::= ActionExpression:3 '-' ActionExpression:4|ActionExpression:3 ::= "
+    "ActionExpression:4|ActionExpression:4 ::= ActionExpression:4 '*' Action"
+    "UnopExpression|ActionExpression:4 ::= ActionExpression:4 '/' ActionUnop"
+    "Expression|ActionExpression:4 ::= ActionUnopExpression|ActionUnopExpres"
+    "sion ::= '-' ActionUnopTerm|ActionUnopExpression ::= '!' ActionUnopTerm"
+    "|ActionUnopExpression ::= ActionUnopTerm|ActionUnopTerm ::= '(' ActionE"
+    "xpression ')'|ActionUnopTerm ::= IntegerValue|ActionUnopTerm ::= Identi"
+    "fier|ActionUnopTerm ::= 'token_count'|TerminalSymbol ::= <string>|Termi"
+    "nalSymbol ::= <bracketstring>|NonterminalSymbol ::= <identifier>|Intege"
+    "rValue ::= <integer>|BooleanValue ::= 'true'|BooleanValue ::= 'false'|S"
+    "tringValue ::= <string>|StringValue ::= <triplestring>|Identifier ::= <"
+    "identifier>|}0|!~B)|!~!~!~!~Y)|^)|!~$*|(*|,*|0*|4*|8*|<*|@*|D*|H*|L*|P*"
+    "|T*|X*|]*|!~#+|)+|3+|!~9+|=+|A+|J+|O+|!~U+|!~Z+|^+|\",|&,|*,|.,|2,|!~!~"
+    "7,|!~=,|J,|O,|V,|_,|%-|+-|!~.-|3-|!~9-|\?-|E-|!~!~K-|N-|X-|%.|!~+.|5.|!"
+    "~;.|>.|A.|!~!~!~!~!~!~!~K.|!~P.|V.|+-|!~!~!~!~!~\\.|!/|(/|//|4/|8/|</|@"
+    "/|D/|!~H/|N/|+-|!~T/|!~Y/|!~]/|!0|&0|+0|.0|30|!~90|@0|C0|!~H0|!~M0|R0|W"
+    "0|\\0|!1|&1|!~+1|01|!~51|:1|!~\?1|C1|!~+0|!~!~G1|J1|J1|//|&0|O1|R1|J1|U"
+    "1|//|}1|\"|}2||}3|Z#|}4|Y$|}5|N-|@6|X\"|J*|A4|C\?|$-|]%|J&|/%|0\"|A&|I'"
+    "|I%|5$|&$|K#|+#|H$|)&|L&|^&|^@| )|@'|_%|K6|&-|Y+|\?$|A6|-4|33|K/|;/|(0|"
+    "S)|Z&|E.|Q$|_5|Y7|Y)|53|7@|='|TF|B'|M'|//|#0|EF|Q%|VG|$H|XH|&I|(J|ZI|QE"
+    "|[(|T)|CE|OD|AD|LC|;C|KV|4S|Q5| ,|OU|(U|F#!|^X|6/|8A|(6|B)!|=#!|\\#!|5B"
+    "|S\\|K&|,*|_$|7+|5+|4+|\"+|X*|I*|>*|Y!!|K.|H-|6Y|/-|_0|:=|U=|\\W|\\\"|O"
+    ")|X9|M@|=C|Q)|W#|J\"|!+|6*|F'|DO|;)|O&|7*|;U|Y3|U'|B !|[I|YH|D\?|C'| %!"
+    "|X2|,>|V5|I_|>_|]^|R^|1^|EM|E]|:W|ON|VV|&^|:]|P&!|H6|4'|QB|\">|UO|<)|#T"
+    "|G)|\\L|)4|,9|\\0|2+!|+*|'*|K)!|++!|6$|U6|<N|1)|2K|'2|IK|!2|=M|7-|CG|B'"
+    "!|TG|0O|JP|RQ|.Q|&P|JZ|MC|%C|M;|/;|^A|.C|:$!|K%!|4*!|;*!|0,|@@|>;|!,|>\?"
+    "|\\(|R*|#(|!N|_)|YL|2'|7W|:\\|P#!|)$!|D%!|>%!|]$!|3$!|A'!|#'!|+)!|8(!|L"
+    "*|+J|^'|8Z|LY|$Z|,T|V*!|T(!|P'|/(|#K|[J|U#|\\9|=(!|!X|X\"!|'!!|) !|H !|"
+    "F!!|&<|\?K|5>|3L|'I|O*!|F9|N%|+Y|!%|\"\\|)0|&)|](|PD|RE||>5|F+|/3|B:|(4"
+    "|N;|K1|;'|H,|]>|J=|*'!|02|M%|C6| 9|@-|>3|'\"|X$|:8|R;|Y&!|9\"!|3U|P*|6R"
+    "|OT|JX|,\?|OS|N[|4/|8[|W0|D8|F&|:G|XN|.(|4M|UZ|<.|F.|)<|4:|M*|$=|X4|/\\"
+    "|Q2|\?S|_@|WT|\"#|T'|_,|]#|ZR|V:|;.|Q-|}6|A-!|}7| 0 X'|!$ &(|\"$ <(|#$ "
+    "0!|$$ $(|%4|&$  (|'$ 8(|($ .(|)$ ,(|*$ P|+$ .#|,$ ,#|-$ 2(|.$ N#|/$ 6(|"
+    "0$ J$|1$ N$|2$ *(|3$ T&|4$ 0(|5$ ((|6$ :(|7$ P\"|8$ 4&|9$ N\"|:$ R\"|;$"
+    " L\"|<$ T\"|=$ J\"|>$ V\"|\?$ H\"|@$ X\"|A$ >&|B$ <&|C$ 8&|D$ 6&|E$ 2\""
+    "|F$ ,|G$ J|H$ H|I$ F|J$ D|K$ B|L$ @|M$ <|N$ :|O$ 8|P$ 6|Q$ >|R$ 4|S$ 2|"
+    "T$ F&|U$ .%|V$ (%|W$ *#|X$ 4(|Y$ J%|Z0 ^'|[$ D!|\\$ B!|]$ Z!|^$ \"&|_$ "
+    "*\"| % (\"|!% ^&|\"% \"'|#% \"|$- \\(|%- ^(|&- L(|'- J(|(- F(|)- D(|*- "
+    "6)|+-  )|,- <!|-- Z(|.- B\"|/- B(|0- 2)|1- 4)|2- @(|3- P(|4- T(|5- N(|6"
+    "- >\"|7- 0)|8- 8\"|9- ,)|:- >(|;- .)|<- R(|=- &)|>- &%|\?- V(|@- V#|A- "
+    "H(|B- $)|C- ^%|D- ()|E- 8)|F- .\"|G- 0#|H- X(|I- F%|J- F$|K- V$|L- X$|M"
+    "- ^\"|N- 2$|O- \")|P- 4#|Q- *)|R- Z%|S- R|T- L#|U- .|V- T|W- @!|X- $&|Y"
+    "- Z\"|Z- 0|[- N|\\- 6!|]- Z#|^- V&|_- L| . *|!. J&|\". &|#. $|$. R&|%. "
+    "X&|&. (| 0 X'|!0 &(|\"0 2!|#0 0!|$0 P#|%0 T'|&0  (|'()1&|(0 ^$|)()C&|*("
+    ")Q|+0 .#|,0 ,#|-();&|.0 N#|/()/&|00 J$|10 N$|2()A&|30 T&|4()G'|5()E&|-$"
+    " X|7()Q\"|8()5&|9()O\"|:()S\"|;()M\"|<()U\"|=()K\"|>()W\"|\?()I\"|@()Y\""
+    "|A()\?&|B()=&|C()9&|D()7&|\"$ X!|F()-|G()K|H()I|I()G|J()E|K()C|L()A|M()"
+    "=|N();|O()9|P()7|Q()\?|R()5|S()3|T()G&| (D8!|%4|\"(D2!|#(D0!|Y0 J%|Z0 ^"
+    "'| 0 X'|!0 &(|\"0 2!|#0 0!|$(XP#|%(XT'|&0  (|'()1&|((X^$|)()C&|*()Q|+(X"
+    ".#|,(X,#|-();&|.(XN#|/()/&|0(XJ$|1(XN$|2()A&|3(XT&|4()G'|5()E&|-$ &!|7("
+    ")Q\"|8()5&|9()O\"|:()S\"|;()M\"|<()U\"|=()K\"|>()W\"|\?()I\"|@()Y\"|A()"
+    "\?&|B()=&|C()9&|D()7&|]$ Z!|F()-|G()K|H()I|I()G|J()E|K()C|L()A|M()=|N()"
+    ";|O()9|P()7|Q()\?|R()5|S()3|T()G&|\"$ X!|-$ $!|\"$ X!|0- $$|Y(XJ%|Z(X^'"
+    "| 0 X'|!0 &(|\"0 2!|#0 0!|$HWP#|%HWT'|&0  (|'()1&|(HW^$|)()C&|*()Q|+HW."
+    "#|,HW,#|-();&|.HWN#|/()/&|0HWJ$|1HWN$|2()A&|3HWT&|4()G'|5()E&|-$ \"!|7("
+    ")Q\"|8()5&|9()O\"|:()S\"|;()M\"|<()U\"|=()K\"|>()W\"|\?()I\"|@()Y\"|A()"
+    "\?&|B()=&|C()9&|D()7&|-$  !|F()-|G()K|H()I|I()G|J()E|K()C|L()A|M()=|N()"
+    ";|O()9|P()7|Q()\?|R()5|S()3|T()G&|]$ Z!|\"$ X!|]$ Z!|-$ (!|YHWJ%|ZHW^'|"
+    " 0 X'|!0 \\'|\"0 2!|#0 0!|$0 :)|%H'U'|&H*M$|'H'K#|(H'W'| HZP$|*0 P|+H'/"
+    "#|,H'-#|0- 0$|.H*O#|0- \"$|0H*K$|1H*O$|2H')#|3H*U&|-$ 8#|5H''#|X$ \\%|7"
+    "0 P\"|/HZZ'|90 N\"|:0 R\"|;0 L\"|<0 T\"|=0 J\"|>0 V\"|\?0 H\"|@0 X\"|D-"
+    " D'|[$ D!|\\$ B!|-$ V|EH'3\"|FH*-|GH*K|HH*I|IH*G|JH*E|KH*C|LH*A|MH*=|NH"
+    "*;|OH*9|PH*7|QH*\?|RH*5|SH*3|-- L!| 0 P$|]$ Z!|WH'+#|XH*-$| ()9!|!()!'|"
+    "\"()3!|#()1!|'$ 0&|-$ ^|&()3&|'()1&|C- ^%|)()C&|*()Q|/0 Z'| H68!|-();&|"
+    "^HZ\"&|/()/&|0- $\"|4$ F'|2()A&|%H T'|4()G'|5()E&|*$ P|7()Q\"|8()5&|9()"
+    "O\"|:()S\"|;()M\"|<()U\"|=()K\"|>()W\"|\?()I\"|@()Y\"|A()\?&|B()=&|C()9"
+    "&|D()7&|-$ *!|F()-|G()K|H()I|I()G|J()E|K()C|L()A|M()=|N();|O()9|P()7|Q("
+    ")\?|R()5|S()3|T()G&| 0 8!|!(&!'|\"H22!|#H20!| (\"8!|^0 \"&|&(&3&|'(&1&|"
+    "-$ Z|)(&C&|*0 P|\"$ 2!|#$ 0!|-(&;&|*(\"P|/(&/&|+$ .#|,$ ,#|2(&A&|-$ ,!|"
+    "4(&G'|5(&E&|\"$ X!|7H2P\"|8(&5&|9H2N\"|:H2R\"|;H2L\"|<H2T\"|=H2J\"|>H2V"
+    "\"|\?H2H\"|@H2X\"|A(&\?&|B(&=&|C(&9&|D(&7&|-$ .!|F0 ,|G0 J|H0 H|I0 F|J0"
+    " D|K0 B|L0 @|M0 <|N0 :|O0 8|P0 6|Q0 >|R0 4|S0 2|T(&G&| $ X'|!(MX%|\"$ 2"
+    "!|#$ 0!|$$ $(| (68!|&$ L$| H78!| HC8!|)$ ,%|\"HC2!|#HC0!|%H7T'|%HCT'|.$"
+    " N#|6$ D%|0$ J$|1$ N$| $ 8!|+HC.#|,HC,#|S- R|6$ H!|%H5T'|V- T| HOP$|!0 "
+    "\"(|-$ \\|]$ Z!|$HOP#|*- 8$|&0  (|'H&1&|6$ H!|)H&C&|)$ >$|/$ @'|E$ 2\"|"
+    "-H&;&|.HON#|/H&/&|0HOJ$|1HON$|2H&A&|3HOT&|4H&G'|5H&E&|0-  \"|6$ @$|8H&5"
+    "&|B- 2#| 0 8!| ([P$|U$ .%|V$ (%|G- 0#|%0 T'|\"% \"'|AH&\?&|BH&=&|CH&9&|"
+    "DH&7&|+0 .#|,0 ,#|P- 4#|_$ *\"| % (\"|/([Z'|$- D)|%- @%|&- <%|'- :%|(- "
+    "8%|)- 6%|*- D\"|+- 4\"|,- <!|TH&G&|.- B\"|/- 4%|%- *$|1- @\"|2- 2%|Y(VJ"
+    "%|4- T$|5- R$|6- >\"|7- <\"|8- 8\"|9- 6\"|:- *&|;- \\\"|YHUJ%|+- :!|,- "
+    "<!|\?- Z$| H*Y'|!H*Y%|\"H*3!|#H*1!|$H*Q#| (+8!|&H*M$|\"$ 2!|#$ 0!|!% ^&"
+    "|*H*Q|K- V$|L- X$|3- B$|.H*O#|*(+P|0H*K$|1H*O$|^([\"&|3H*U&|)  N'|4$ \\"
+    "&|<- D$|7H*Q\"|6  P'|9H*O\"|:H*S\"|;H*M\"|<H*U\"|=H*K\"|>H*W\"|\?H*I\"|"
+    "@H*Y\"|6  R'|H- H$|Q- ,\"|J- F$|/$  &|FH*-|GH*K|HH*I|IH*G|JH*E|KH*C|LH*"
+    "A|MH*=|NH*;|OH*9|PH*7|QH*\?|RH*5|SH*3| HD8!|)$ >$|\"HD2!|#HD0!|XH*-$| ("
+    "+Y'|!(+Y%|\"(+3!|#(+1!|$(+Q#| H,8!|&(+M$|\"H,2!|#H,0!|6$ @$|*(+Q|Y(SH%|"
+    "!$  '|($ &\"|.(+O#|*H,P|0(+K$|1(+O$|'$ 0&|3(+U&|!HIX%|6$ H!|*- 4!|7(+Q\""
+    "|!$ X%|9(+O\"|:(+S\"|;(+M\"|<(+U\"|=(+K\"|>(+W\"|\?(+I\"|@(+Y\"|Y$ J%|["
+    "$ D!|\\$ B!|!$ :$|-$ 6#|F(+-|G(+K|H(+I|I(+G|J(+E|K(+C|L(+A|M(+=|N(+;|O("
+    "+9|P(+7|Q(+\?|R(+5|S(+3|-- 6$|X$  $| H\"8!|-$ F#|X(+-$| 0 X'|!0 X%|\"0 "
+    "2!|#0 0!|$0 P#| HYP$|&0 L$|*H\"P|)$ >$|-$ D#|*0 P|%- ^!|!~3- L%|.0 N#|\\"
+    "- 6!|00 J$|10 N$|/$ Z'|30 T&|/HYZ'|6$ @$|<- N%|70 P\"|-$ B#|90 N\"|:0 R"
+    "\"|;0 L\"|<0 T\"|=0 J\"|>0 V\"|\?0 H\"|@0 X\"|!~-$ @#|F$ ,|[$ D!|\\$ B!"
+    "|F0 ,|G0 J|H0 H|I0 F|J0 D|K0 B|L0 @|M0 <|N0 :|O0 8|P0 6|Q0 >|R0 4|S0 2|"
+    "-$ >#|-$ <#|-- ($|-$ :#|X(2,$| 0 X'|!0 &(|\"H(3!|#H(1!|$0 :)|%H(U'|&H+!"
+    "(|'0 8(|(H(##|)H+C&|^HY\"&|+H(/#|,H(-#|-H+;&|.H+O#|/H+/&|0H+K$|1H+O$|20"
+    " *(|3H+U&|4H+G'|50 ((|[$ D!|\\$ B!|8H+5&|3- <'| (78!| H88!|!H8:$|\"H82!"
+    "|#H80!|%(7T'|%H8T'|AH+\?&|BH+=&|CH+9&|DH+7&|EH(3\"|+H8.#|,H8,#|-- &$|6$"
+    " H!| (IX'|!(I\\'|\"(I2!|#(I0!|$(IP#|%(IT'|&(IL$|!~((I^$|!~TH+G&|+(I.#|,"
+    "(I,#|WH(+#|.(IN#|U- .|0(IJ$|1(IN$|!~3(IT&|Z- 0|_H(+\"| I()\"|!I+_&| 0 X"
+    "'|!0 &(|\"0 2!|#0 0!|$0 :)|%0 T'|&0  (|'0 8(|(0 <)|)H%C&|!~+(I.#|,(I,#|"
+    "-H%;&|.(IN#|/H%/&|0(IJ$|1(IN$|20 *(|3(IT&|4H%G'|50 ((|%- J!| $ X'|8H%5&"
+    "|\"$ 2!|#$ 0!|$$ F)| (,8!|!~\"(,2!|#(,0!|)$ ,%|AH%\?&|BH%=&|CH%9&|DH%7&"
+    "|EH@2\"|*(,P| HH8!|!HH:$|\"HH2!|#HH0!|$$ P#|%HHT'|6$ H!|!~(HH^$|!~!~+HH"
+    ".#|,HH,#|TH%G&|.$ N#|'$ 0&|WH@*#| 0 8!|!HX:$|\"0 2!|#0 0!|E$ 2\"|%HXT'|"
+    "/$ .&|!~ (:8!|!(::$|*(3P|+HX.#|,HX,#|%(:T'| H!8!|'$ J#|((:\"#| (88!|!$ "
+    ":$|!~U$ .%|V$ (%|%(8T'|7(3P\"|*H!P|9(3N\"|:(3R\"|;(3L\"|<(3T\"|=(3J\"|>"
+    "(3V\"|\?(3H\"|@(3X\"|[$ D!|\\$ B!|$- >%|%- @%|&- <%|'- :%|(- 8%|)- 6%|*"
+    "- D\"|+- 4\"|,- <!|!~.- B\"|/- 4%|!~1- @\"|2- 2%|!~-- F!|FH!,|6- >\"|7-"
+    " <\"|8- 8\"|9- 6\"|:- *&|;- \\\"| 0 8!| 0 8!|\"0 2!|#0 0!|!~!~%0 T'|\"%"
+    " \"'|4- T#|5- R#|*0 P| 0 8!|!0 :$|!~!~!~%0 T'|!H9:$|'0 J#|(0 \"#|@- V#|"
+    "!~#% \"|70 P\"|($ \"#|90 N\"|:0 R\"|;0 L\"|<0 T\"|=0 J\"|>0 V\"|\?0 H\""
+    "|@0 X\"|!~!~!~[- N|!~F0 ,|G0 J|H0 H|I0 F|J0 D|K0 B|L0 @|M0 <|N0 :|O0 8|"
+    "P0 6|Q0 >|R0 4|S0 2| (*9!|!~\"(*3!|#(*1!|X(2,$| 0 P$|!0 X%| H;8!|!H;:$|"
+    "$0 P#|*(*Q|&0 L$|%H;T'|T- L#|'H;J#|(H;\"#|!~[$ D!|\\$ B!|.0 N#|!~00 J$|"
+    "10 N$|7(*Q\"|30 T&|9(*O\"|:(*S\"|;(*M\"|<(*U\"|=(*K\"|>(*W\"|\?(*I\"|@("
+    "*Y\"|\". &|#. $|-- \"\"|!~&. (|F(*-|G(*K|H(*I|I(*G|J(*E|K(*C|L(*A|M(*=|"
+    "N(*;|O(*9|P(*7|Q(*\?|R(*5|S(*3| H)9!|!~\"H)3!|#H)1!|!~=- H#| $ 8!|\"$ X"
+    "!|\"$ 8!|#$ 8!|*H)Q|%$ 8!|!~!~($ 8!|!~M- ^\"|+$ 8!|,$ 8!|[$ D!|\\$ B!|!"
+    "~!~7H)Q\"|!~9H)O\"|:H)S\"|;H)M\"|<H)U\"|=H)K\"|>H)W\"|\?H)I\"|@H)Y\"|!~"
+    "!~[$ D!|\\$ B!|-- V!|FH)-|GH)K|HH)I|IH)G|JH)E|KH)C|LH)A|MH)=|NH);|OH)9|"
+    "PH)7|QH)\?|RH)5|SH)3| 0 8!|-- T!|\"0 2!|#0 0!|!~ HMP$|!HMX%|!~ (88!|$HM"
+    "P#|*0 P|&HML$|M- ^\"|%(8T'|]$ Z!|R- Z%|!~_HB8!| IB8!|.HMN#|!~0HMJ$|1HMN"
+    "$|70 P\"|3HMT&|90 N\"|:0 R\"|;0 L\"|<0 T\"|=0 J\"|>0 V\"|\?0 H\"|@0 X\""
+    "|0- \\!|!~!~!~!~F0 ,|G0 J|H0 H|I0 F|J0 D|K0 B|L0 @|M0 <|N0 :|O0 8|P0 6|"
+    "Q0 >|R0 4|S0 2| (IX'|!0 &(|\"(I2!|#(I0!|$(IP#|%(IT'|&0  (|'H%1&|((I^$|)"
+    "H%C&|!~+(I.#|,(I,#|-H%;&|.(IN#|/H%/&|0(IJ$|1(IN$|2H%A&|3(IT&|4H%G'|5H%E"
+    "&| $ P$|!~8H%5&|!~$$ *%|!~ $ P$|!~!~!~$$ *%|AH%\?&|BH%=&|CH%9&|DH%7&| 0"
+    " 8!|!HH:$|\"0 2!|#0 0!|$$ P#|%HHT'|!~6$ H!|(HH^$|!~*(.P|+HH.#|,HH,#|6$ "
+    "H!|.$ N#|TH%G&|!~!~!~!~!~!~!~7(.P\"|!~9(.N\"|:(.R\"|;(.L\"|<(.T\"|=(.J\""
+    "|>(.V\"|\?(.H\"|@(.X\"| $ X'|!(MX%|\"$ 2!|#$ 0!|$$ :)|U$ .%|&$ L$| H98!"
+    "|!~\"H92!|#H90!|U$ .%|%H9T'|!~.$ N#|($ \"#|0$ J$|1$ N$|+H9.#|,H9,#|$- >"
+    "%|%- @%|&- ,&|X$ \\%|!~!~$- >%|%- @%|&- (&|!~ 0 8!|!HX:$|\"0 2!|#0 0!|!"
+    "~%HXT'| H+8!|E$ 2\"|\"H+2!|#H+0!|*(3P|+HX.#|,HX,#|!~!~ $ X'|*H+P|\"$ 2!"
+    "|#$ 0!|$$ F)|!~4- T#|5- R#|7(3P\"|)$ ,%|9(3N\"|:(3R\"|;(3L\"|<(3T\"|=(3"
+    "J\"|>(3V\"|\?(3H\"|@(3X\"|@- V#|!~!~C- ^%|6$ H!|$- \\$|F- .\"|!~!~ H:8!"
+    "|!H::$|*- D\"|+- 4\"|,- <!|%H:T'|.- B\"|'H:J#|(H:\"#|1- @\"|E$ 2\"|!~4-"
+    " T$|5- R$|6- >\"|7- <\"|8- 8\"|9- 6\"|\"$ X!|;- \\\"|!~[$ D!|\\$ B!|\?-"
+    " Z$|)$ >$|)$ >$|U$ .%|V$ (%|=- \"%|!~!~!~!~!~!~K- V$|L- X$|6$ @$|6$ @$|"
+    "-- R!| (!8!|$- >%|%- @%|&- <%|'- :%|(- 8%|)- 6%|*- D\"|+- 4\"|,- <!|*(!"
+    "P|.- B\"|/- 4%|!~1- @\"|2- $'|!~!~!~6- >\"|7- <\"|8- 8\"|9- <$| 0 8!|!H"
+    "F:$|\"0 2!|#0 0!|$HF0\"|%HFT'|!~'HFJ#|(0 V'|Y(VJ%|*0 P|+HF.#|,HF,#|!~]$"
+    " Z!|F(!,|[$ D!|\\$ B!|2HF(#|!~!~5HF&#|!~7H.P\"|!~9H.N\"|:H.R\"|;H.L\"|<"
+    "H.T\"|=H.J\"|>H.V\"|\?H.H\"|@H.X\"|0- V%|-- P!|3- >)|3- L%|EHF2\"| 0 8!"
+    "|!HH:$|\"0 2!|#0 0!|$$ P#|%HHT'|!~<- T%|(HH^$|!~*(.P|+HH.#|,HH,#|!~.$ N"
+    "#|!~!~WHF*#|H- N&| $ 8!|J- F$|\"$ 2!|#$ 0!|7(.P\"| (ZP$|9(.N\"|:(.R\"|;"
+    "(.L\"|<(.T\"|=(.J\"|>(.V\"|\?(.H\"|@(.X\"| ((9!|!((;$|\"((3!|#((1!|$((1"
+    "\"|%((U'|/(ZZ'|'((K#|(((W'| H98!|*((Q|+((/#|,((-#|!~%H9T'|!~!~($ \"#|2("
+    "()#|!~!~5(('#|!~7((Q\"|!~9((O\"|:((S\"|;((M\"|<((U\"|=((K\"|>((W\"|\?(("
+    "I\"|@((Y\"| ($8!|!~!~ $ P$|E((3\"|\"$ <(|#$ 0!|$$ *%| (;8!|!(;:$|*($P| "
+    "$ 8!|)$ ,%|%(;T'|!~'(;J#|((;\"#|!~4- T#|5- R#|^(Z\"&| (C8!|W((+#|\"(C2!"
+    "|#(C0!|6$ H!|%(CT'|*- D\"|+- 4\"|,- <!|@- V#|.- B\"|+(C.#|,(C,#|1- F\"|"
+    "!~F- .\"|!~F($,|G($J|H($H|I($F|J($D|K($B|L($@|M($<|N($:|O($8|P($6|Q($>|"
+    "R($4|S($2|>- &%|!~!~A- $%|U$ .%|V$ (%|!~X$ L)|[$ D!|\\$ B!|[$ D!|\\$ B!"
+    "|]$ Z!|!~!~!~!~=- $#|!~$- >%|%- ^(|&- <%|'- :%|(- 8%|)- .'|*- 8$|-- N!|"
+    "!~-- Z(|!~!~0- N)|!~!~+- :!|,- <!|!~ H'9!|!H';$|\"H'3!|#H'1!|$H'1\"|%H'"
+    "U'|!~'H'K#|(H'W'|!~*H'Q|+H'/#|,H'-#|!~D- .$|E- 4$|!~!~2H')#|!~!~5H''#|!"
+    "~7H'Q\"|N- 2$|9H'O\"|:H'S\"|;H'M\"|<H'U\"|=H'K\"|>H'W\"|\?H'I\"|@H'Y\"|"
+    "!~!$  '|Q- >!|!~EH'3\"|!~ . *|'$ 0&|W- @!|!~ HOP$|!0 \"(|!~!~$HOP#|/$ ."
+    "&|&0  (|'H&1&|!~)H&C&|4$ F'|!~WH'+#|-H&;&|.HON#|/H&/&|0HOJ$|1HON$|2H&A&"
+    "|3HOT&|4H&G'|5H&E&|!~!~8H&5&|!~!~!~ 0 P$|!~!~!~$$ *%|AH&\?&|BH&=&|CH&9&"
+    "|DH&7&|)$ ,%|!~!~ H+Q$|!H+#(|!~/(ZZ'|$H+Q#|!~&H+!(|'H+1&|!~)H+C&|6$ H!|"
+    "!~TH&G&|-H+;&|.H+O#|/H+/&|0H+K$|1H+O$|2H+A&|3H+U&|4H+G'|5H+E&|!~!~8H+5&"
+    "|!% ^&| HX8!|!HX:$|\"HX2!|#HX0!|!~%HXT'|!~AH+\?&|BH+=&|CH+9&|DH+7&|+HX."
+    "#|,HX,#|!~!~U$ .%|V$ (%|!~ $ 8!|!~\"$ 2!|#$ 0!|!~!H[ '|^(Z\"&|!~TH+G&|!"
+    "~&$ 2&|'H[0&|$- >%|%- @%|&- <%|'- :%|(- 8%|)- 6%|!~/H[.&|!~!I+_&|!~/- 4"
+    "%|4H[F'|!~2- 2%|!~ 0 8!|!0 :$|\"0 2!|#0 0!|$0 0\"|%0 T'|:- 0%|'0 J#|(0 "
+    "\"#|!~>- &%|!~!~A- H(| 0 X'|!0 \\'|\"0 2!|#0 0!|$0 :)|%0 T'|&(IL$|'H@J#"
+    "|(0 <)|!~!~+(I.#|,(I,#|!~.(IN#|!~0(IJ$|1(IN$|2H@(#|3(IT&| 0 P$|5H@&#|!~"
+    "E0 2\"|$$ *%|!~!~!~!~)$ ,%|!~!~*- D\"|+- 4\"|,- <!|/(ZZ'|.- B\"|EH@2\"|"
+    "!~1- \\#|!~!~6$ H!|!~!~ (WX'|!(W\\'|\"(W2!|#(W0!|$(WP#|%(WT'|&(WL$|!~(("
+    "W^$|)$ >$|WH@*#|+(W.#|,(W,#|!~.(WN#| (ZP$|0(WJ$|1(WN$|!~3(WT&|!~!~6$ @$"
+    "|!~O- X#|!~!~!~U$ .%|V$ (%|/(ZZ'| $ P$|!~\"$ X!|!~$$ *%|!0  '|^(Z\"&|]-"
+    " Z#|)$ >$|)$ @)|&$ 2&|'0 0&|$- >%|%- @%|&- <%|'- :%|(- 8%|)- 6%|!~/0 .&"
+    "|!~6$ @$|6$ B)|/- 4%|40 F'|!(!!'|2- 2%| H98!|!H9:$|!~&(!3&|'(!1&|%H9T'|"
+    ")(!C&|:- 0%|($ \"#|!~-(!;&|>- &%|/(!/&|!~A- $%|2(!A&|!~4(!G'|5$ D&|^(Z\""
+    "&|!~8(!5&|!~!~!~3- P&|U$ .%|V$ (%|!~Y(VJ%|A(!\?&|B(!=&|C(!9&|D(!7&|]$ Z"
+    "!|!~!~!~!~!~!~$- >%|%- @%|&- <%|'- :%|(- 8%|)- 6%|!~!~T$ F&|!~>- &%|/- "
+    "&'|0- R%|A- Z&|3- L&|3- L%|!~!~ 0 8!|!H\?:$|\"0 2!|#0 0!|$H\?0\"|%0 T'|"
+    "<- P%|'H\?J#|(0 \"#|!~!~+0 .#|,0 ,#|!~!~$. R&|!~H- N&|2H\?(#|J- F$|!~5H"
+    "\?&#| H=8!|!H=:$|\"H=2!|#H=0!|$H=0\"|%H=T'|!~'H=J#|(H=\"#|!~!~!~=- P)|!"
+    "~!~EH\?2\"| 0 X'|!(>:$|\"(>2!|#(>0!|$0 F)|%(>T'|!~'(>J#|((>\"#|)$ ,%|!~"
+    " (>8!|!(>:$|\"(>2!|#(>0!|$(>0\"|%(>T'|WH\?*#|'(>J#|((>\"#|!~EH=2\"|6$ H"
+    "!|!~ HTX'|!HT\\'|\"HT2!|#HT0!|$HTP#|%HTT'|&HTL$|!~(HT^$|!~ HA8!|+HT.#|,"
+    "HT,#|E(>2\"|.HTN#|%HAT'|0HTJ$|1HTN$|!~3HTT&|!H\"!'|+HA.#|,HA,#|!~E(>2\""
+    "|&H\"3&|'H\"1&|!~)H\"C&|U$ .%|V$ (%|=- \"%|-H\";&|!~/H\"/&|!~B- 2#|2H\""
+    "A&|!~4H\"G'|5H\"E&|G- 0#|!~8H\"5&|$- >%|%- @%|&- <%|'- :%|(- 4'|!~P- 4#"
+    "|!~AH\"\?&|BH\"=&|CH\"9&|DH\"7&|!~YHUJ%|ZHT^'| 0 X'|!H=:$|\"H=2!|#H=0!|"
+    "$0 F)|%H=T'|!~'H=J#|(H=\"#|)$ ,%|!~!~TH\"G&|!~!~ 0 X'|!0 \\'|\"0 2!|#0 "
+    "0!|$0 P#|%0 T'|&0 L$|6$ H!|(0 ^$|!~!~+0 .#|,0 ,#|!~.0 N#|!~00 J$|10 N$|"
+    " (38!|30 T&|\"(32!|#(30!|EH=2\"| (#8!| (98!|!(9:$|\"(92!|#(90!|*(3P|%(9"
+    "T'|!~I- F%|($ ^$|*(#P|!~+(9.#|,(9,#|!~U$ .%|V$ (%|!~7(3P\"|!~9(3N\"|:(3"
+    "R\"|;(3L\"|<(3T\"|=(3J\"|>(3V\"|\?(3H\"|@(3X\"|!~!~$- >%|%- @%|&- <%|'-"
+    " 8'|YHUJ%|Z0 ^'|!~!~F(#,|G$ J|H$ H|I$ F|J$ D|K$ B|L$ @|M$ <|N$ :|O$ 8|P"
+    "$ 6|Q$ >|R$ 4|S$ 2| H(9!|!H(;$|\"H(3!|#H(1!|$H(1\"|%H(U'|!~'H(K#|(H(##|"
+    " (LP$|!(JX%|+H(/#|,H(-#|$(LP#|!~&(LL$|!~!~2H()#|!~!~5H('#| (B8!|.(LN#|!"
+    "~0(LJ$|1(LN$|%(BT'|3$ T&|!~I- F%|!~!~+(B.#|,(B,#|!~!~EH(3\"|!~ H#8!| (T"
+    "X'|!(T\\'|\"(T2!|#(T0!|$(TP#|%(TT'|&(TL$|!~((T^$|*H#P|!~+(T.#|,(T,#|!~."
+    "(TN#|WH(+#|0(TJ$|1(TN$|!~3(TT&|!~!~!~_H(+\"| I()\"|   H'|!(<:$|\"$ 2!|#"
+    "$ 0!|$$ 0\"|%(<T'|!~'(<J#|((<\"#|!~_- L|!~FH#,|GH#J|HH#H|IH#F|JH#D|KH#B"
+    "|LH#@|MH#<|NH#:|OH#8|PH#6|QH#>|RH#4|SH#2|!~!~!~!~!~!~YHUJ%|Z(T^'|!~!~!~"
+    "E$ 2\"| HTX'|!HT\\'|\"HT2!|#HT0!|$HTP#|%HTT'|&HTL$|!~(HT^$|!~!~+HT.#|,H"
+    "T,#|!~.HTN#|!~0HTJ$|1HTN$|!~3HTT&|!~!~!~ HE8!|!HE:$|\"HE2!|#HE0!|$HE0\""
+    "|%HET'|!~'HEJ#|(HE\"#|^- V&|!~+HE.#|,HE,#|*- D\"|+- 4\"|,- <!|%. X&|.- "
+    "B\"|2HE(#|!~1- @\"|5HE&#|!~!~!~6- >\"|7-  #|!~ (XX'|!(X\\'|\"(X2!|#(X0!"
+    "|$(XP#|%(XT'|&(XL$|ZHT^'|((X^$|EHE2\"|!~+(X.#|,(X,#|!~.(XN#|!~0(XJ$|1(X"
+    "N$|!~3(XT&| (SX'|!(S\\'|\"(S2!|#(S0!|$(SP#|%(ST'|&(SL$|WHE*#|((S^$| (PP"
+    "$|!(PX%|+(S.#|,(S,#|$(PP#|.(SN#|&(PL$|0(SJ$|1(SN$|!~3(ST&|!~!~ ('8!|.(P"
+    "N#| (A8!|0(PJ$|1(PN$|!~3(PT&|%(AT'|!~!~*('P|!~I- F%|+$ .#|,$ ,#|Y(XJ%|Z"
+    "(X^'| ()8!| HWX'|!HW\\'|\"HW2!|#HW0!|$HWP#|%HWT'|&HWL$|!~(HW^$|*()P|!~+"
+    "HW.#|,HW,#|!~.HWN#|!~0HWJ$|1HWN$|Z  L'|3HWT&|F(',|G('J|H('H|I('F|J('D|K"
+    "('B|L('@|M('<|N(':|O('8|P('6|Q('>|R('4|S('2|!~!~!~F(),|G()J|H()H|I()F|J"
+    "()D|K()B|L()@|M()<|N():|O()8|P()6|Q()>|R()4|S()2|!~ H*8!|!~!~!~!~YHWJ%|"
+    "ZHW^'|!~!~!~*H*P|!~!~!~ H$8!| $ H&|!$ H&|\"$ H&|#$ H&|$$ H&|%$ H&|&$ H&"
+    "|!~($ H&|*H$P|!~+$ H&|,$ H&|!~.$ H&|B- ^#|0$ H&|1$ H&|!~3$ H&|G- 0#|!~!"
+    ". J&|FH*,|GH*J|HH*H|IH*F|JH*D|KH*B|LH*@|MH*<|NH*:|OH*8|PH*6|QH*>|RH*4|S"
+    "H*2|FH$,|GH$J|HH$H|IH$F|JH$D|KH$B|LH$@|MH$<|NH$:|OH$8|PH$6|QH$>|RH$4|SH"
+    "$2| H&8!|!~!~!~!~!~Y(SH%|Z$ H&|!~!~*H&P|!~!~!~ ((8!| $ H&|!$ H&|\"$ H&|"
+    "#$ H&|$$ H&|%$ H&|&$ H&|!~($ H&|*((P|!~+$ H&|,$ H&|!~.$ H&|!~0$ H&|1$ H"
+    "&|!~3$ H&|!~!~!~FH&,|GH&J|HH&H|IH&F|JH&D|KH&B|LH&@|MH&<|NH&:|OH&8|PH&6|"
+    "QH&>|RH&4|SH&2|F((,|G((J|H((H|I((F|J((D|K((B|L((@|M((<|N((:|O((8|P((6|Q"
+    "((>|R((4|S((2| (&8!|!~!~!~!~!~Y(SH%|Z$ H&|!~!~*(&P|!~!~!~!~ (G8!|!(G:$|"
+    "\"(G2!|#(G0!|$(G0\"|%(GT'|!~'(GJ#|((G\"#|!~!~+(G.#|,(G,#|!~!~!~!~!~2(G("
+    "#|!~!~5(G&#|!~F(&,|G(&J|H(&H|I(&F|J(&D|K(&B|L(&@|M(&<|N(&:|O(&8|P(&6|Q("
+    "&>|R(&4|S(&2|E(G2\"| (F8!|!(F:$|\"(F2!|#(F0!|$(F0\"|%(FT'|!~'(FJ#|((F\""
+    "#|!~!(\\ '|+(F.#|,(F,#|!~!~&$ 2&|'(\\0&|W(G*#|2(F(#|!~!~5(F&#|!~!~/(\\."
+    "&|_(G*\"| )G(\"|!H !'| (%8!|4(\\F'|!~!~&H 3&|'H 1&|!~)$ B&|!~E(F2\"|*(%"
+    "P|-H ;&|!~/H /&| H)8!|!~2$ @&|!~4H G'|!~!~!~8H 5&|!~*H)P|!~!~W(F*#|!~!~"
+    "!~AH \?&|BH =&|CH 9&|DH 7&|_$ *\"| % (\"|!~F(%,|G(%J|H(%H|I(%F|J(%D|K(%"
+    "B|L(%@|M(%<|N(%:|O(%8|P(%6|Q(%>|R(%4|S(%2|FH),|GH)J|HH)H|IH)F|JH)D|KH)B"
+    "|LH)@|MH)<|NH):|OH)8|PH)6|QH)>|RH)4|SH)2| H%8!| HG8!|!HG:$|\"HG2!|#HG0!"
+    "|!~%HGT'|!~!~(HG^$|*H%P|!~+HG.#|,HG,#| H'8!| (TX'|!(T\\'|\"(T2!|#(T0!|$"
+    "(TP#|%(TT'|&(TL$|!~((T^$|*H'P|!~+(T.#|,(T,#|!~.(TN#|!~0(TJ$|1(TN$|!~3(T"
+    "T&|!~!~!~FH%,|GH%J|HH%H|IH%F|JH%D|KH%B|LH%@|MH%<|NH%:|OH%8|PH%6|QH%>|RH"
+    "%4|SH%2|FH',|GH'J|HH'H|IH'F|JH'D|KH'B|LH'@|MH'<|NH':|OH'8|PH'6|QH'>|RH'"
+    "4|SH'2| H(8!| (H8!|!(H:$|\"(H2!|#(H0!|!~%(HT'|Z(T^'|!~((H^$|*H(P|!~+(H."
+    "#|,(H,#| (*8!|!~!~ HSX'|!HS\\'|\"HS2!|#HS0!|$HSP#|%HST'|&HSL$|*(*P|(HS^"
+    "$|!~!~+HS.#|,HS,#|!~.HSN#|!~0HSJ$|1HSN$|!~3HST&|!~FH(,|GH(J|HH(H|IH(F|J"
+    "H(D|KH(B|LH(@|MH(<|NH(:|OH(8|PH(6|QH(>|RH(4|SH(2|F(*,|G(*J|H(*H|I(*F|J("
+    "*D|K(*B|L(*@|M(*<|N(*:|O(*8|P(*6|Q(*>|R(*4|S(*2|!H%!'|!~!~!~!~&H%3&|'H%"
+    "1&| $ P$|)H%C&|ZHS^'|!~$$ *%|-H%;&|!~/H%/&|!~)$ ,%|2H%A&|!~4H%G'|5H%E&|"
+    "!~ $ P$|8H%5&|!~!~!~!~!~6$ H!|!~!~AH%\?&|BH%=&|CH%9&|DH%7&|!H!!'|/(YZ'|"
+    "!~!~!~&H!3&|'H!1&|!~)H!C&| $ P$|!~!~-H!;&|$$ *%|/H!/&|TH%G&|!~2H!A&|)$ "
+    ",%|4H!G'|5$ D&|!~!~8H!5&|U$ .%|V$ (%|!~!~!~!~!~6$ H!|AH!\?&|BH!=&|CH!9&"
+    "|DH!7&|!~!~!~$- >%|%- @%|&- <%|'- :%|(- 8%|)- 6%|!~!~!~^$ \"&|!~/- 4%|T"
+    "$ F&|!(#!'|2- 2%|$- &&|!~!~&(#3&|'(#1&|!~)(#C&|:- B'|U$ .%|V$ (%|-(#;&|"
+    "!~/(#/&|!~!~2(#A&|!~4(#G'|5(#E&|!~!~8(#5&|!~$- >%|%- @%|&- <%|'- :%|(- "
+    "8%|)- 6%|!~A(#\?&|B(#=&|C(#9&|D(#7&|/- 4%|!~!($!'|2- 2%|!~!~\"$ X!|&($3"
+    "&|'($1&|!~)($C&|:- *&|!~)$ >$|-($;&|T(#G&|/($/&|!~X- $&|2($A&|!~4($G'|5"
+    "($E&|!~!~8($5&|6$ @$|!~ 0 8!|!$ :$|\"(E2!|#(E0!|!~%0 T'|A($\?&|B($=&|C("
+    "$9&|D($7&|!('!'|+(E.#|,(E,#|!~!~&('3&|'('1&| $ P$|)('C&|!~!~$$ *%|-(';&"
+    "|!~/('/&|T($G&|)$ ,%|2('A&|!~4('G'|5('E&|!~!~8('5&|!~!~!~]$ Z!|!~6$ H!|"
+    "!~!~A('\?&|B('=&|C('9&|D('7&|!H$!'|!~!~!~!~&H$3&|'H$1&|!~)H$C&|!~0- R%|"
+    "!~-H$;&|3- L%|/H$/&|T('G&|!~2H$A&|!~4H$G'|5H$E&|!~<- P%|8H$5&|U$ .%|V$ "
+    "(%| (E8!|!~\"(E2!|#(E0!|!~%(ET'|AH$\?&|BH$=&|CH$9&|DH$7&|!~+(E.#|,(E,#|"
+    "$- >%|%- @%|&- <%|'- :%|(- 8%|)- 6%| (08!|!~\"(02!|#(00!|!~/- 4%|TH$G&|"
+    "!~2- 2%| 0 8!|*(0P|\"0 2!|#0 0!|!~%0 T'|!~:- 0%|!~!~!~+0 .#|,0 ,#|!~7(0"
+    "P\"|!~9(0N\"|:(0R\"|;(0L\"|<(0T\"|=(0J\"|>(0V\"|\?(0H\"|@(0X\"|!~!(\"!'"
+    "|!~!~!~!~&(\"3&|'(\"1&|!~)(\"C&|!~!~!~-(\";&|!~/(\"/&|!~!~2(\"A&|!~4(\""
+    "G'|5$ D&|\"$ X!|X$ ,$|8(\"5&|!~!~!~!~!~!~!~!~A(\"\?&|B(\"=&|C(\"9&|D(\""
+    "7&| HNX'|!HN\\'|\"HN2!|#HN0!|$HNP#|%HNT'|&HNL$|!~(HN^$|!~!~+HN.#|,HN,#|"
+    "!~.HNN#|T$ F&|0HNJ$|1HNN$|!(&!'|3HNT&|!~!~!~&(&3&|'(&1&|!~)(&C&|!~!~!~-"
+    "(&;&|E- B%|/(&/&|!~!~2(&A&|!~4(&G'|5(&E&|X$ ,$|!~8(&5&|!~!~]$ Z!|!~!~!~"
+    "!~!~A(&\?&|B(&=&|C(&9&|D(&7&|!H#!'|!~!~!~Z$ H%|&H#3&|'H#1&|!~)H#C&|0- 0"
+    "$|!~!~-H#;&|!~/H#/&|T(&G&|!~2H#A&|!~4H#G'|5H#E&|!~!~8H#5&|!~!~!~!~!~D- "
+    ".$|E- 4$|!~AH#\?&|BH#=&|CH#9&|DH#7&|!H&!'|!~!~N- 2$|!~&H&3&|'H&1&|!~)H&"
+    "C&|!~!~!~-H&;&|!~/H&/&|TH#G&|!~2H&A&|!~4H&G'|5H&E&|!~!~8H&5&|!~!~!~!~!~"
+    "!~!~!~AH&\?&|BH&=&|CH&9&|DH&7&|!(%!'|!~!~!~!~&(%3&|'(%1&|!~)(%C&|!~!~!~"
+    "-(%;&|!~/(%/&|TH&G&|!~2(%A&|!~4(%G'|5(%E&|!~!~8(%5&|!~!~!~!~!~!~!~!~A(%"
+    "\?&|B(%=&|C(%9&|D(%7&|!0  '|!~!~!~!~&0 2&|'0 0&|!~)0 B&|!~!~!~-0 :&|!~/"
+    "0 .&|T(%G&|!~20 @&|!~40 F'|50 D&|!~!~80 4&|!~!~!~!~!~!~!~!~A0 >&|B0 <&|"
+    "C0 8&|D0 6&|!0  '|!~!~!~!~&0 2&|'0 0&|!~)0 B&|!~!~!~-0 :&|!~/0 .&|T0 F&"
+    "|!~20 @&|!~40 F'|50 D&|!~!~80 4&|!~ $ 8!|!~\"$ 2!|#$ 0!|$$ 0\"|!~!~A0 >"
+    "&|B0 <&|C0 8&|D0 6&| HH8!|!HH:$|\"HH2!|#HH0!|$$ P#|%HHT'|!~!~(HH^$|!~!~"
+    "+HH.#|,HH,#|!~.$ N#|T0 F&| 0 X'|!0 \\'|\"HN2!|#HN0!|$0 P#|%HNT'|&0 L$|!"
+    "~(HN^$|!~E$ 2\"|+HN.#|,HN,#|!~.0 N#|!~00 J$|10 N$|!~30 T&| (OX'|!(O\\'|"
+    "\"(O2!|#(O0!|$(OP#|%(OT'|&(OL$|!~((O^$| HKP$|!~+(O.#|,(O,#|$HKP#|.(ON#|"
+    "&HKL$|0(OJ$|1(ON$|!~3(OT&|X$ \\%|!~!~.HKN#|!~0HKJ$|1HKN$|*- D\"|+- 4\"|"
+    ",- <!|!~.- B\"|!~!~1- @\"|!~!~!~Z$ H%|6- >\"|7- <\"|8- 8\"|9- 6\"|!~;- "
+    ":\"|!0  '|!~!~4- T#|5- R#|&0 2&|'0 0&| $ P$|)0 B&|!~!~$$ *%|-0 :&|!~/0 "
+    ".&|@- V#|!~20 @&|C- ^%|40 F'|50 D&|!~!~80 4&| $ 8!|!~\"$ 2!|#$ 0!|$$ 0\""
+    "|6$ H)|!~!~A0 >&|B0 <&|C0 8&|D0 6&|!0  '|!~!~!~!~&0 2&|'0 0&| $ 8!|)0 B"
+    "&|\"$ 2!|#$ 0!|$$ 0\"|-0 :&|!~/0 .&|T0 F&|!~20 @&|!~40 F'|5$ D&|!~!~80 "
+    "4&|U$ .%|E$ 2\"|!~ (-8!|!~\"(-2!|#(-0!|!~A0 >&|B0 <&|C0 8&|D0 6&|!~*(-P"
+    "|!~$- >%|%- @%|&- ,&|!~!~E$ 2\"|!~!~!~!~!~7$ P\"|T$ F&|9$ N\"|:$ R\"|;$"
+    " L\"|<$ T\"|=$ J\"|>$ V\"|\?$ H\"|@$ X\"|!~!~*- D\"|+- 4\"|,- <!|!~.- B"
+    "\"|!~!~1- @\"|!~!~!~!~6- >\"|7- <\"|8- 8\"|9- 6\"|!~;- \\\"|!~*- D\"|+-"
+    " 4\"|,- <!|!~.- B\"|!~ (.8!|1- @\"|\"(.2!|#(.0!|!~!~6- >\"|7- <\"|8- 8\""
+    "|9- <$|*(.P| (18!|!~\"(12!|#(10!|!~!~!~!~!~!~*(1P|!~7(.P\"|!~9(.N\"|:(."
+    "R\"|;(.L\"|<(.T\"|=(.J\"|>(.V\"|\?(.H\"|@(.X\"|!~7(1P\"|!~9(1N\"|:(1R\""
+    "|;(1L\"|<(1T\"|=(1J\"|>(1V\"|\?(1H\"|@(1X\"| $ P$|!~!~ (28!|$$ *%|\"(22"
+    "!|#(20!|!~!~)$ ,%|!~!~!~*(2P|!~!~!~Y- Z\"|!~!~!~!~6$ H!|X(1,$|!~!~7(2P\""
+    "|!~9(2N\"|:(2R\"|;(2L\"|<(2T\"|=(2J\"|>(2V\"|\?(2H\"|@(2X\"|!~ H>8!|!H>"
+    ":$|\"H>2!|#H>0!|$H>0\"|%H>T'|!(^ '|'H>J#|(H>\"#|!~!~&(^2&|'(^0&|!~)$ B&"
+    "|!~U$ .%|V$ (%|-(^:&|!~/(^.&|F- .\"|X(2,$|2$ @&|!~4(^F'|!~!~!~8(^4&|!~$"
+    "- >%|%- @%|&- <%|'- :%|(- 8%|)- 6%|EH>2\"|A(^>&|B(^<&|C(^8&|D(^6&|/- 4%"
+    "|!~!~2- $'| 0 X'|!0 \\'|\"(H2!|#(H0!|$HMP#|%(HT'|&HML$|!~((H^$|!~!~+(H."
+    "#|,(H,#|!~.HMN#|!~0HMJ$|1HMN$|!~3HMT&| (F8!|!(F:$|\"(F2!|#(F0!|$(F0\"|%"
+    "(FT'|!~'(FJ#|((F\"#|!~!~+(F.#|,(F,#| H18!|!~\"H12!|#H10!|!~2(F(#|!~!~5("
+    "F&#|!~*H1P| H<8!|!H<:$|\"H<2!|#H<0!|$H<0\"|%H<T'|!~'H<J#|(H<\"#|!~!~!~7"
+    "H1P\"|E(F2\"|9H1N\"|:H1R\"|;H1L\"|<H1T\"|=H1J\"|>H1V\"|\?H1H\"|@H1X\"| "
+    "HVX'|!HV\\'|\"HV2!|#HV0!|$HVP#|%HVT'|&HVL$|!~(HV^$|W(F*#|!~+HV.#|,HV,#|"
+    "!~.HVN#|EH<2\"|0HVJ$|1HVN$|!~3HVT&|!~!~!~XH1,$| (UX'|!(U\\'|\"(U2!|#(U0"
+    "!|$(UP#|%(UT'|&(UL$|!~((U^$|!~!~+(U.#|,(U,#|!~.(UN#|!~0(UJ$|1(UN$|!~3(U"
+    "T&| (NX'|!(N\\'|\"(N2!|#(N0!|$(NP#|%(NT'|&(NL$|!~((N^$|!~!~+(N.#|,(N,#|"
+    "!~.(NN#|!~0(NJ$|1(NN$| H08!|3(NT&|\"H02!|#H00!|!~!~!~!~!~!~*H0P| 0 8!|!"
+    "~\"0 2!|#0 0!|!~!~!~!~!~!~*0 P|!~7H0P\"|!~9H0N\"|:H0R\"|;H0L\"|<H0T\"|="
+    "H0J\"|>H0V\"|\?H0H\"|@H0X\"|!~70 P\"|!~90 N\"|:0 R\"|;0 L\"|<0 T\"|=0 J"
+    "\"|>0 V\"|\?0 H\"|@0 X\"|!~!~ 0 X'|!0 \\'|\"0 2!|#0 0!|$0 P#|%0 T'|&0 L"
+    "$|!~(0 ^$|!~XH0,$|+0 .#|,0 ,#|!~.0 N#|!~00 J$|10 N$|!~30 T&|!~XH1,$| 0 "
+    "X'|!0 \\'|\"HG2!|#HG0!|$HRP#|%HGT'|&HRL$|!~(HG^$|!~!~+HG.#|,HG,#|!~.HRN"
+    "#|!~0HRJ$|1HRN$|!~3HRT&| $ 8!|!$ 8!|\"$ 8!|#$ 8!|$$ 8!|%$ 8!|!~'$ 8!|($"
+    " 8!|!~!~!~!~ 0 8!|!~\"0 2!|#0 0!|!~2$ 8!|!~!~5$ 8!|!~*0 P| $ P$|!~!~!~$"
+    "$ *%|!~!~!~!~)$ ,%|!~!~70 P\"|E$ 8!|90 N\"|:0 R\"|;0 L\"|<0 T\"|=0 J\"|"
+    ">0 V\"|\?0 H\"|@0 X\"|6$ H!|!~!~ HF8!|!HF:$|\"HF2!|#HF0!|$HF0\"|%HFT'|W"
+    "$ 8!|'HFJ#|(HF\"#|!~!~+HF.#|,HF,#|!~_(<8!| )<8!|!~!~2HF(#|!~X0 ,$|5HF&#"
+    "|!~!~!~!~!~!~U$ .%|V$ (%|!~!~!~!~!~!~!~EHF2\"|!~ H.8!|!~\"H.2!|#H.0!|$-"
+    " >%|%- @%|&- <%|'- :%|(- 8%|)- 6%|*H.P| H/8!|!~\"H/2!|#H/0!|/- &'|WHF*#"
+    "|!~!~!~!~*H/P|!~7H.P\"|!~9H.N\"|:H.R\"|;H.L\"|<H.T\"|=H.J\"|>H.V\"|\?H."
+    "H\"|@H.X\"|!~7H/P\"|!~9H/N\"|:H/R\"|;H/L\"|<H/T\"|=H/J\"|>H/V\"|\?H/H\""
+    "|@H/X\"| (58!|!~\"(52!|#(50!|!~!~!~!~!~!~*(5P| H28!|!~\"H22!|#H20!|!~!~"
+    "!~!~!~!~*H2P|!~7(5P\"|!~9(5N\"|:(5R\"|;(5L\"|<(5T\"|=(5J\"|>(5V\"|\?(5H"
+    "\"|@(5X\"|!~7H2P\"|!~9H2N\"|:H2R\"|;H2L\"|<H2T\"|=H2J\"|>H2V\"|\?H2H\"|"
+    "@H2X\"| H38!|!~\"H32!|#H30!|!~!~!~!~!~!~*H3P| (48!|!~\"(42!|#(40!|!~!~!"
+    "~!~!~!~*(4P|!~7H3P\"|!~9H3N\"|:H3R\"|;H3L\"|<H3T\"|=H3J\"|>H3V\"|\?H3H\""
+    "|@H3X\"|!~7(4P\"|!~9(4N\"|:(4R\"|;(4L\"|<(4T\"|=(4J\"|>(4V\"|\?(4H\"|@("
+    "4X\"| H48!|!~\"H42!|#H40!|!~!~!~!~!~!~*H4P| (/8!|!~\"(/2!|#(/0!|!~!~!~!"
+    "~!~!~*(/P|!~7H4P\"|!~9H4N\"|:H4R\"|;H4L\"|<H4T\"|=H4J\"|>H4V\"|\?H4H\"|"
+    "@H4X\"|!~7(/P\"|!~9(/N\"|:(/R\"|;(/L\"|<(/T\"|=(/J\"|>(/V\"|\?(/H\"|@(/"
+    "X\"|!H] '|!~!~!~!~&H]2&|'H]0&|!~)$ B&|!~!~!~-H]:&|!~/H].&|!~!~2$ @&|!~4"
+    "H]F'|!~!~!~8H]4&| $ P$|!(MX%|!~!~$$ P#|!~&$ L$|!H_ '|AH]>&|BH]<&|CH]8&|"
+    "DH]6&|&H_2&|'H_0&|.$ N#|)$ B&|0$ J$|1$ N$|!~-H_:&|!~/H_.&|!~!~2$ @&|!~4"
+    "H_F'|!~!~!~8H_4&|!~!~!~!~!~!~!~!(_ '|AH_>&|BH_<&|CH_8&|DH_6&|&(_2&|'(_0"
+    "&|!~)$ B&|!~!~!~-(_:&|!~/(_.&|!~!~2$ @&|!~4(_F'|!~!~!~8(_4&|!~!~!~!~!~!"
+    "~$- \\$|!( !'|A(_>&|B(_<&|C(_8&|D(_6&|&( 3&|'( 1&|!~)$ B&|!~!~!~-( ;&|!"
+    "~/( /&|4- T$|5- R$|2$ @&| H-8!|4( G'|\"H-2!|#H-0!|!~8( 5&|!~!~\?- Z$|!~"
+    "*H-P|!~!~!~A( \?&|B( =&|C( 9&|D( 7&|!~!~K- V$|L- X$|!~7H-P\"|!~9H-N\"|:"
+    "H-R\"|;H-L\"|<H-T\"|=H-J\"|>H-V\"|\?H-H\"|@H-X\"|!0  '|!~!~!~!~&0 2&|'0"
+    " 0&|!~)$ B&|!~!~!~-0 :&|!~/0 .&|!~!~2$ @&|!~40 F'|!~!~!~80 4&|!~!~!~!~!"
+    "~!~!~!H^ '|A0 >&|B0 <&|C0 8&|D0 6&|&H^2&|'H^0&|!~)$ B&|!~!~!~-H^:&|!~/H"
+    "^.&|!~!~2$ @&|!~4H^F'|!~!~!~8H^4&|!~!~!~!~!~!~!~!~AH^>&|BH^<&|CH^8&|DH^"
+    "6&| (\?8!|!(\?:$|\"(\?2!|#(\?0!|$(\?0\"|%(\?T'|!~'(\?J#|((\?\"#| (@8!|!"
+    "(@:$|\"(@2!|#(@0!|$(@0\"|%(@T'|!~'(@J#|((@\"#|2$ (#| $ P$|!~5$ &#|!~$$ "
+    "*%|!~!~!~2(@(#|)$ ,%|!~5(@&#| H\?8!|!H\?:$|\"H\?2!|#H\?0!|$H\?0\"|%H\?T"
+    "'|E(\?2\"|'H\?J#|(H\?\"#|!~6$ H!|!~!~ $ P$|!~E(@2\"|!~$$ *%|2H\?(#|!~!~"
+    "5H\?&#|)$ ,%| $ P$|W$ *#|!~!~$$ *%|!~!~ HQP$|!HQX%|)$ ,%|W(@*#|$HQP#|6$"
+    " H!|&HQL$|EH\?2\"|!~!~!~U$ .%|V$ (%|!~.HQN#|6$ H!|0HQJ$|1HQN$|!~3HQT&|!"
+    "~!~!~!~!~WH\?*#|$- >%|%- @%|&- <%|'- :%|(- 8%|)- ('|!~!~!~ $ P$|U$ .%|V"
+    "$ (%|   J'|$$ *%|\"$ 2!|#$ 0!|!~%HBT'|)$ ,%|!~U$ .%|V$ (%|!~+HB.#|,HB,#"
+    "|$- >%|%- @%|&- <%|'- :%|(- 8%|)- *'|6$ H!|!~!~!~$- >%|%- @%|&- <%|'- :"
+    "%|(- 8%|)- 2'|!~ $ P$|!~!~!~$$ *%|!~ $ P$|!~!~)$ ,%|$$ *%|!~!~ (RP$|!(R"
+    "X%|)$ ,%|!~$(RP#|!~&(RL$|U$ .%|V$ (%|6$ H!|!~!~!~!~.(RN#|6$ H!|0(RJ$|1("
+    "RN$|!~3(RT&|!~!~$- >%|%- @%|&- <%|'- :%|(- 8%|)- 0'|!~!~!~*- D\"|+- 4\""
+    "|,- <!|!~.- B\"|!~!~1- \\#|!~U$ .%|V$ (%|!~!~!~!~U$ .%|V$ (%|!~!~!~!~!~"
+    "!~!~$- >%|%- @%|&- <%|'- :%|(- 8%|)- .'|$- >%|%- @%|&- <%|'- :%|(- 8%|)"
+    "- ,'|!~O-  %| H@8!|!H@:$|\"H@2!|#H@0!|$H@0\"|%H@T'|!~'H@J#|(H@\"#|!~!0 "
+    " '|!~!~!~!~&0 2&|'0 0&|!~2H@(#| $ P$|!~5H@&#|-$ :&|$$ *%|/0 .&|!~ $ P$|"
+    "!~)$ ,%|40 F'|$$ *%|!~!~8$ 4&|!~)$ ,%|!~EH@2\"|!~!~!~6$ H!|A$ >&|B$ <&|"
+    "C$ 8&|D$ 6&|!~!~6$ H)| $ P$|!~!(] '|!~$$ *%|!~WH@*#|&(]2&|'(]0&|)$ ,%|!"
+    "~!~!~!~-$ :&|!~/(].&|!~!~!~!~4(]F'|6$ H!|U$ .%|V$ (%|8$ 4&|!~!~!~!~U$ ."
+    "%|V$ (%|!~!~A$ >&|B$ <&|C$ 8&|D$ 6&|$- >%|%- @%|&- <%|'- :%|(- 6'|!~!~$"
+    "- >%|%- @%|&- J)|'- :%|(- 6'|!~!~!~U$ .%|V$ (%| $ P$|!~!~!~$$ *%|!~!H\\"
+    " '|!~!~)$ ,%|!~&H\\2&|'H\\0&|$- >%|%- @%|&- <%|'- :%|(- 4'|-$ :&|!~/H\\"
+    ".&|!~6$ H!|!~!~4H\\F'|!~!~ $ P$|8$ 4&|!~!~$$ P#|!~&$ L$|!~!~!~A$ >&|B$ "
+    "<&|C$ 8&|D$ 6&|.$ N#|!~0$ J$|1$ N$|!~!~!~!~!~ $ P$|!~U$ .%|V$ (%|$$ *%|"
+    "!~!~!~!~)$ ,%|!~!~!~!~!~!~!~$- >%|%- @%|&- <%|'- :'|!~6$ H!| (=8!|!(=:$"
+    "|\"(=2!|#(=0!|$(=0\"|%(=T'|!~'(=J#|((=\"#| HLP$|!HLX%|!~!~$HLP#|!~&HLL$"
+    "|!~!~!~!~!~!~$- \\$|.HLN#|!~0HLJ$|1HLN$|!~3HLT&|!~U$ .%|V$ (%|!~!~!~!~!"
+    "~E(=2\"|4- T$|5- R$|!~!~!~!~!~$- >%|%- @%|&- <%|'- 8'|\?- >'| HPP$|!HPX"
+    "%|!~!~$HPP#|!~&HPL$| (QP$|!(QX%|!~!~$(QP#|!~&(QL$|.HPN#|!~0HPJ$|1HPN$|!"
+    "~3HPT&|!~.(QN#|!~0(QJ$|1(QN$|!~3(QT&| (KP$|!(KX%|!~!~$(KP#|!~&(KL$| HJP"
+    "$|!HJX%|!~!~$HJP#|!~&HJL$|.(KN#|!~0(KJ$|1(KN$|!~3(KT&|!~.HJN#|!~0HJJ$|1"
+    "HJN$|!~3HJT&|!~ HOP$|!HOX%|!~!~$HOP#|!~&HOL$| HRP$|!HRX%|!~!~$HRP#|!~&H"
+    "RL$|.HON#|!~0HOJ$|1HON$|R- Z%|3HOT&|!~.HRN#|!~0HRJ$|1HRN$|!~3HRT&|!~!~!"
+    "~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~"
     "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!"
     "~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~"
-    "!~!~!~!~!~!~!~}8|!|}9||}:||};|_#|}<||}=|(|}>|'|}?||}@|+|}A|_#|}B||}C|3|"
-    "}D|_'|}E||}F|<|}G|_'|}H|Null||Halt|!|Label|\"|Call|#|ScanStart|$|ScanCh"
-    "ar|%|ScanAccept|&|ScanToken|'|ScanError|(|AstStart|)|AstFinish|*|AstNew"
-    "|+|AstForm|,|AstLoad|-|AstIndex|.|AstChild|/|AstChildSlice|0|AstKind|1|"
-    "AstKindNum|2|AstLocation|3|AstLocationNum|4|AstLexeme|5|AstLexemeString"
-    "|6|Assign|7|DumpStack|8|Add|9|Subtract|:|Multiply|;|Divide|<|UnaryMinus"
-    "|=|Return|>|Branch|?|BranchEqual|@|BranchNotEqual|A|BranchLessThan|B|Br"
-    "anchLessEqual|C|BranchGreaterThan|D|BranchGreaterEqual|E|}I|Y6|}J|E.!|}"
-    "K|7|!~|'||>|!~\"|$|!~\"|%|!~\"|P|)|-|$|@|@|$|A|A|&|B|B|(|D|D|.|E|E|0|F|"
-    "F|2|G|G|4|H|H|?|I|I|A|J|J|C|K|K|E|L|L|G|M|M|I|N|N|K|O|O|M|P|Y|W|Z|Z|Y|["
-    "|[|\"!|\\|\\|$!|]|]|/!|^|^|3!|_|_|9!| !| !|;!|!!|:!|=!|;!|;!|?!|=!|=!|A"
-    "!|?!|?!|C!|A!|A!|E!|B!|B!|=!|C!|C!|Q!|D!|D!|=\"|E!|E!|%#|F!|F!|7#|G!|H!"
-    "|=!|I!|I!|A#|J!|J!|=!|K!|K!|M#|L!|L!|+$|M!|N!|=!|O!|O!|I$|P!|P!|W$|Q!|Q"
-    "!|=!|R!|R!|+%|S!|S!|=!|T!|T!|=%|U!|Z!|=!|\\!|\\!|)&|&|I$|3\"| \"|\"|%|!"
-    "~5\"|\"|)|-|$|@|@|$|&|0D\"|<\"|G|+&|%|!~>\"||%|!~?\"|'||)|(|*|*|)|+|A|("
-    "|B|B|+|C|;!|(|<!|<!|-|=!|_____#|(|&|<,|U\"|!\"|.&|%|!~W\"||&|**|X\"|\"|"
-    "+&|%|!~Z\"||%|!~[\"|\"||)|(|+|_____#|(|&|@O!|\"#|,|+&|%|!~$#||&|9V!|%#|"
-    ".|+&|%|!~'#||&|&[!|(#|&|+&|%|!~*#||%|!~+#|'||)|5|*|*|)|+|F|5|G|G|7|H|;!"
-    "|5|<!|<!|6|=!|_____#|5|%|!~A#|'||)|5|*|*|)|+|F|5|G|G|+|H|;!|5|<!|<!|6|="
-    "!|_____#|5|%|!~W#|\"||)|5|+|_____#|5|&|**|^#|\"|+&|%|!~ $|!|G|G|9|&|)1|"
-    "$$|\"\"|0&|%|!~&$|#||F|9|G|G|;|H|_____#|9|%|!~0$|#||F|9|G|G|<|H|_____#|"
-    "9|%|!~:$|#||F|9|G|G|=|H|_____#|9|&|^/|D$|R|+&|%|!~F$||&|*8!|G$|$|+&|%|!"
-    "~I$||&|H8!|J$|!|+&|%|!~L$||&|U0!|M$|4|+&|%|!~O$||&|=2!|P$|1|+&|%|!~R$||"
-    "&|[L!|S$|3|+&|%|!~U$||&|,'\"|V$|)|+&|%|!~X$||&|QO!|Y$|L|+&|%|!~[$||&|DA"
-    "\"|\\$|E|+&|%|!~^$|#|J|J|O|O|O|S|]|]|U|%|!~(%|#||I|O|J|J|P|K|_____#|O|%"
-    "|!~2%|%||I|O|J|J|P|K|N|O|O|O|Q|P|_____#|O|&|##|B%|_!|\"|%|!~D%||&|##|E%"
-    "|_!|\"|%|!~G%|\"||)|S|+|_____#|S|&|96\"|N%|9|+&|%|!~P%||&|.&|Q%|6|+&|%|"
-    "!~S%|!|P|Y|W|&|(M|W%|(|+&|%|!~Y%|\"|Z|Z|[|]|]| !|%|!~ &|\"|]|]|\\|>!|>!"
-    "|^|&|+&!|'&|T|+&|%|!~)&||&|::!|*&|S|+&|%|!~,&||&|J.\"|-&|W|+&|%|!~/&||&"
-    "| /\"|0&|5|+&|%|!~2&||@|!6|3&|&!|&||&|@5|6&|:|+&|%|!~8&|$|\\|\\|'!|]|]|"
-    ")!|!!|:!|+!|A!|Z!|+!|&|,?!|E&|+|+&|%|!~G&||&|+9\"|H&|;|+&|%|!~J&||%|!~K"
-    "&|%|P|Y|+!|^|^|,!|!!|:!|+!|?!|?!|+!|A!|Z!|+!|A|5)|[&|.!|&||&|S(|^&|#|+&"
-    "|%|!~ '||&|,A|!'|2|+&|%|!~#'|!|^|^|1!|&|4W|''|X|+&|%|!~)'||&|E:\"|*'|7|"
-    "+&|%|!~,'|\"|]|]|5!|^|^|7!|&|!<\"|3'|8|+&|%|!~5'||&|B@!|6'|*|+&|%|!~8'|"
-    "|&|$4!|9'|H|+&|%|!~;'||&|YW!|<'|0|+&|%|!~>'||&|#'|?'||+&|%|!~A'|$|P|Y|="
-    "!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|L3|N'|I|2&|%|!~P'||&|F4|Q'|-|6&|%|!~S'||"
-    "&|-!\"|T'|K|+&|%|!~V'||&|#'|W'||+&|%|!~Y'|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!"
-    "|B!|=!|C!|C!|G!|D!|Z!|=!|&|#'|,(||+&|%|!~.(|&|P|Y|=!|!!|:!|=!|?!|?!|=!|"
-    "A!|S!|=!|T!|T!|I!|U!|Z!|=!|&|#'|A(||+&|%|!~C(|&|P|Y|=!|!!|:!|=!|?!|?!|="
-    "!|A!|H!|=!|I!|I!|K!|J!|Z!|=!|&|#'|V(||+&|%|!~X(|&|P|Y|=!|!!|:!|=!|?!|?!"
-    "|=!|A!|N!|=!|O!|O!|M!|P!|Z!|=!|&|#'|+)||+&|%|!~-)|&|P|Y|=!|!!|:!|=!|?!|"
-    "?!|=!|A!|M!|=!|N!|N!|O!|O!|Z!|=!|&|/\\|@)|=|+&|%|!~B)|$|P|Y|=!|!!|:!|=!"
-    "|?!|?!|=!|A!|Z!|=!|&|#'|O)||+&|%|!~Q)|'|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|A!|"
-    "S!|B!|N!|=!|O!|O!|-\"|P!|Z!|=!|&|#'|'*||+&|%|!~)*|&|P|Y|=!|!!|:!|=!|?!|"
-    "?!|=!|A!|R!|=!|S!|S!|U!|T!|Z!|=!|&|#'|<*||+&|%|!~>*|&|P|Y|=!|!!|:!|=!|?"
-    "!|?!|=!|A!|D!|=!|E!|E!|W!|F!|Z!|=!|&|#'|Q*||+&|%|!~S*|$|P|Y|=!|!!|:!|=!"
-    "|?!|?!|Y!|A!|Z!|=!|&|#'| +||+&|%|!~\"+|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|R!"
-    "|=!|S!|S!|[!|T!|Z!|=!|&|#'|5+||+&|%|!~7+|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|"
-    "D!|=!|E!|E!|]!|F!|Z!|=!|&|#'|J+||+&|%|!~L+|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A"
-    "!|M!|=!|N!|N!|_!|O!|Z!|=!|&|#'|_+||+&|%|!~!,|&|P|Y|=!|!!|:!|=!|?!|?!|=!"
-    "|A!|R!|=!|S!|S!|!\"|T!|Z!|=!|&|#'|4,||+&|%|!~6,|&|P|Y|=!|!!|:!|=!|?!|?!"
-    "|=!|A!|H!|=!|I!|I!|#\"|J!|Z!|=!|&|#'|I,||+&|%|!~K,|&|P|Y|=!|!!|:!|=!|?!"
-    "|?!|=!|A!|S!|=!|T!|T!|%\"|U!|Z!|=!|&|#'|^,||+&|%|!~ -|&|P|Y|=!|!!|:!|=!"
-    "|?!|?!|=!|A!|H!|=!|I!|I!|'\"|J!|Z!|=!|&|#'|3-||+&|%|!~5-|&|P|Y|=!|!!|:!"
-    "|=!|?!|?!|=!|A!|U!|=!|V!|V!|)\"|W!|Z!|=!|&|#'|H-||+&|%|!~J-|&|P|Y|=!|!!"
-    "|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|+\"|F!|Z!|=!|&|6F|]-|O|+&|%|!~_-|$|P|Y|="
-    "!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|,.||+&|%|!~..|&|P|Y|=!|!!|:!|=!|?!|?!"
-    "|=!|A!|M!|=!|N!|N!|/\"|O!|Z!|=!|&|#'|A.||+&|%|!~C.|&|P|Y|=!|!!|:!|=!|?!"
-    "|?!|=!|A!|E!|=!|F!|F!|1\"|G!|Z!|=!|&|#'|V.||+&|%|!~X.|&|P|Y|=!|!!|:!|=!"
-    "|?!|?!|=!|A!|K!|=!|L!|L!|3\"|M!|Z!|=!|&|#'|+/||+&|%|!~-/|&|P|Y|=!|!!|:!"
-    "|=!|?!|?!|=!|A!|H!|=!|I!|I!|5\"|J!|Z!|=!|&|#'|@/||+&|%|!~B/|&|P|Y|=!|!!"
-    "|:!|=!|?!|?!|=!|A!|B!|=!|C!|C!|7\"|D!|Z!|=!|&|#'|U/||+&|%|!~W/|&|P|Y|=!"
-    "|!!|:!|=!|?!|?!|=!|A!|S!|=!|T!|T!|9\"|U!|Z!|=!|&|#'|*0||+&|%|!~,0|&|P|Y"
-    "|=!|!!|:!|=!|?!|?!|=!|A!|R!|=!|S!|S!|;\"|T!|Z!|=!|&|OB|?0|M|+&|%|!~A0|$"
-    "|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|N0||+&|%|!~P0|(|P|Y|=!|!!|:!|=!"
-    "|?!|?!|=!|A!|D!|=!|E!|E!|?\"|F!|T!|=!|U!|U!|S\"|V!|Z!|=!|&|#'|)1||+&|%|"
-    "!~+1|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|R!|=!|S!|S!|A\"|T!|Z!|=!|&|#'|>1||+&"
-    "|%|!~@1|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|B!|=!|C!|C!|C\"|D!|Z!|=!|&|#'|S1|"
-    "|+&|%|!~U1|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Q!|=!|R!|R!|E\"|S!|Z!|=!|&|#'|"
-    "(2||+&|%|!~*2|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|H!|=!|I!|I!|G\"|J!|Z!|=!|&|"
-    "#'|=2||+&|%|!~?2|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|O!|=!|P!|P!|I\"|Q!|Z!|=!"
-    "|&|#'|R2||+&|%|!~T2|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|S!|=!|T!|T!|K\"|U!|Z!"
-    "|=!|&|#'|'3||+&|%|!~)3|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|H!|=!|I!|I!|M\"|J!"
-    "|Z!|=!|&|#'|<3||+&|%|!~>3|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|N!|=!|O!|O!|O\""
-    "|P!|Z!|=!|&|#'|Q3||+&|%|!~S3|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|M!|=!|N!|N!|"
-    "Q\"|O!|Z!|=!|&|$Q|&4|>|+&|%|!~(4|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|"
-    "#'|54||+&|%|!~74|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|L!|=!|M!|M!|U\"|N!|Z!|=!"
-    "|&|#'|J4||+&|%|!~L4|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|O!|=!|P!|P!|W\"|Q!|Z!"
-    "|=!|&|#'|_4||+&|%|!~!5|$|P|Y|=!|!!|:!|=!|?!|?!|Y\"|A!|Z!|=!|&|#'|.5||+&"
-    "|%|!~05|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|R!|=!|S!|S!|[\"|T!|Z!|=!|&|#'|C5|"
-    "|+&|%|!~E5|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|S!|=!|T!|T!|]\"|U!|Z!|=!|&|#'|"
-    "X5||+&|%|!~Z5|%|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|A!|_\"|B!|Z!|=!|&|#'|*6||+&"
-    "|%|!~,6|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|B!|=!|C!|C!|!#|D!|Z!|=!|&|#'|?6||"
-    "+&|%|!~A6|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|J!|=!|K!|K!|##|L!|Z!|=!|&|@0\"|"
-    "T6|Q|+&|%|!~V6|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|#7||+&|%|!~%7|("
-    "|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|L!|=!|M!|M!|'#|N!|Q!|=!|R!|R!|/#|S!|Z!|=!|"
-    "&|#'|>7||+&|%|!~@7|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|O!|=!|P!|P!|)#|Q!|Z!|="
-    "!|&|#'|S7||+&|%|!~U7|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|S!|=!|T!|T!|+#|U!|Z!"
-    "|=!|&|#'|(8||+&|%|!~*8|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|X!|=!|Y!|Y!|-#|Z!|"
-    "Z!|=!|&|Y6!|=8|D|+&|%|!~?8|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|L8|"
-    "|+&|%|!~N8|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Q!|=!|R!|R!|1#|S!|Z!|=!|&|#'|!"
-    "9||+&|%|!~#9|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|N!|=!|O!|O!|3#|P!|Z!|=!|&|#'"
-    "|69||+&|%|!~89|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Q!|=!|R!|R!|5#|S!|Z!|=!|&|"
-    "E!!|K9|C|+&|%|!~M9|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|Z9||+&|%|!~"
-    "\\9|%|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|A!|9#|B!|Z!|=!|&|#'|,:||+&|%|!~.:|&|P"
-    "|Y|=!|!!|:!|=!|?!|?!|=!|A!|K!|=!|L!|L!|;#|M!|Z!|=!|&|#'|A:||+&|%|!~C:|&"
-    "|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|R!|=!|S!|S!|=#|T!|Z!|=!|&|#'|V:||+&|%|!~X:"
-    "|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|?#|F!|Z!|=!|&|YR\"|+;|V|+&|%"
-    "|!~-;|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|:;||+&|%|!~<;|&|P|Y|=!|!"
-    "!|:!|=!|?!|?!|=!|A!|F!|=!|G!|G!|C#|H!|Z!|=!|&|#'|O;||+&|%|!~Q;|&|P|Y|=!"
-    "|!!|:!|=!|?!|?!|=!|A!|M!|=!|N!|N!|E#|O!|Z!|=!|&|#'|$<||+&|%|!~&<|&|P|Y|"
-    "=!|!!|:!|=!|?!|?!|=!|A!|N!|=!|O!|O!|G#|P!|Z!|=!|&|#'|9<||+&|%|!~;<|&|P|"
-    "Y|=!|!!|:!|=!|?!|?!|=!|A!|Q!|=!|R!|R!|I#|S!|Z!|=!|&|#'|N<||+&|%|!~P<|&|"
-    "P|Y|=!|!!|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|K#|F!|Z!|=!|&|X_|#=|<|+&|%|!~%="
-    "|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|2=||+&|%|!~4=|&|P|Y|=!|!!|:!|"
-    "=!|?!|?!|=!|A!|D!|=!|E!|E!|O#|F!|Z!|=!|&|#'|G=||+&|%|!~I=|&|P|Y|=!|!!|:"
-    "!|=!|?!|?!|=!|A!|D!|=!|E!|E!|Q#|F!|Z!|=!|&|#'|\\=||+&|%|!~^=|&|P|Y|=!|!"
-    "!|:!|=!|?!|?!|=!|A!|O!|=!|P!|P!|S#|Q!|Z!|=!|&|#'|1>||+&|%|!~3>|$|P|Y|=!"
-    "|!!|:!|=!|?!|?!|U#|A!|Z!|=!|&|#'|@>||+&|%|!~B>|&|P|Y|=!|!!|:!|=!|?!|?!|"
-    "=!|A!|V!|=!|W!|W!|W#|X!|Z!|=!|&|#'|U>||+&|%|!~W>|&|P|Y|=!|!!|:!|=!|?!|?"
-    "!|=!|A!|G!|=!|H!|H!|Y#|I!|Z!|=!|&|#'|*?||+&|%|!~,?|&|P|Y|=!|!!|:!|=!|?!"
-    "|?!|=!|A!|H!|=!|I!|I!|[#|J!|Z!|=!|&|#'|??||+&|%|!~A?|&|P|Y|=!|!!|:!|=!|"
-    "?!|?!|=!|A!|S!|=!|T!|T!|]#|U!|Z!|=!|&|#'|T?||+&|%|!~V?|&|P|Y|=!|!!|:!|="
-    "!|?!|?!|=!|A!|D!|=!|E!|E!|_#|F!|Z!|=!|&|#'|)@||+&|%|!~+@|&|P|Y|=!|!!|:!"
-    "|=!|?!|?!|=!|A!|R!|=!|S!|S!|!$|T!|Z!|=!|&|#'|>@||+&|%|!~@@|&|P|Y|=!|!!|"
-    ":!|=!|?!|?!|=!|A!|O!|=!|P!|P!|#$|Q!|Z!|=!|&|#'|S@||+&|%|!~U@|%|P|Y|=!|!"
-    "!|:!|=!|?!|?!|=!|A!|A!|%$|B!|Z!|=!|&|#'|%A||+&|%|!~'A|&|P|Y|=!|!!|:!|=!"
-    "|?!|?!|=!|A!|B!|=!|C!|C!|'$|D!|Z!|=!|&|#'|:A||+&|%|!~<A|&|P|Y|=!|!!|:!|"
-    "=!|?!|?!|=!|A!|D!|=!|E!|E!|)$|F!|Z!|=!|&|=D|OA|N|+&|%|!~QA|$|P|Y|=!|!!|"
-    ":!|=!|?!|?!|=!|A!|Z!|=!|&|#'|^A||+&|%|!~ B|(|P|Y|=!|!!|:!|=!|?!|?!|=!|A"
-    "!|D!|=!|E!|E!|-$|F!|N!|=!|O!|O!|7$|P!|Z!|=!|&|#'|9B||+&|%|!~;B|&|P|Y|=!"
-    "|!!|:!|=!|?!|?!|=!|A!|W!|=!|X!|X!|/$|Y!|Z!|=!|&|#'|NB||+&|%|!~PB|&|P|Y|"
-    "=!|!!|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|1$|F!|Z!|=!|&|#'|#C||+&|%|!~%C|&|P|"
-    "Y|=!|!!|:!|=!|?!|?!|=!|A!|L!|=!|M!|M!|3$|N!|Z!|=!|&|#'|8C||+&|%|!~:C|&|"
-    "P|Y|=!|!!|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|5$|F!|Z!|=!|&|+^|MC|?|+&|%|!~OC"
-    "|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|\\C||+&|%|!~^C|&|P|Y|=!|!!|:!"
-    "|=!|?!|?!|=!|A!|N!|=!|O!|O!|9$|P!|Z!|=!|&|#'|1D||+&|%|!~3D|&|P|Y|=!|!!|"
-    ":!|=!|?!|?!|=!|A!|J!|=!|K!|K!|;$|L!|Z!|=!|&|#'|FD||+&|%|!~HD|%|P|Y|=!|!"
-    "!|:!|=!|?!|?!|=!|A!|A!|=$|B!|Z!|=!|&|#'|XD||+&|%|!~ZD|&|P|Y|=!|!!|:!|=!"
-    "|?!|?!|=!|A!|G!|=!|H!|H!|?$|I!|Z!|=!|&|#'|-E||+&|%|!~/E|&|P|Y|=!|!!|:!|"
-    "=!|?!|?!|=!|A!|D!|=!|E!|E!|A$|F!|Z!|=!|&|#'|BE||+&|%|!~DE|%|P|Y|=!|!!|:"
-    "!|=!|?!|?!|=!|A!|A!|C$|B!|Z!|=!|&|#'|TE||+&|%|!~VE|&|P|Y|=!|!!|:!|=!|?!"
-    "|?!|=!|A!|C!|=!|D!|D!|E$|E!|Z!|=!|&|#'|)F||+&|%|!~+F|&|P|Y|=!|!!|:!|=!|"
-    "?!|?!|=!|A!|R!|=!|S!|S!|G$|T!|Z!|=!|&|_@|>F|P|+&|%|!~@F|$|P|Y|=!|!!|:!|"
-    "=!|?!|?!|=!|A!|Z!|=!|&|#'|MF||+&|%|!~OF|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|O"
-    "!|=!|P!|P!|K$|Q!|Z!|=!|&|#'|\"G||+&|%|!~$G|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A"
-    "!|S!|=!|T!|T!|M$|U!|Z!|=!|&|#'|7G||+&|%|!~9G|&|P|Y|=!|!!|:!|=!|?!|?!|=!"
-    "|A!|H!|=!|I!|I!|O$|J!|Z!|=!|&|#'|LG||+&|%|!~NG|&|P|Y|=!|!!|:!|=!|?!|?!|"
-    "=!|A!|N!|=!|O!|O!|Q$|P!|Z!|=!|&|#'|!H||+&|%|!~#H|&|P|Y|=!|!!|:!|=!|?!|?"
-    "!|=!|A!|M!|=!|N!|N!|S$|O!|Z!|=!|&|#'|6H||+&|%|!~8H|&|P|Y|=!|!!|:!|=!|?!"
-    "|?!|=!|A!|R!|=!|S!|S!|U$|T!|Z!|=!|&|5?|KH|Y|+&|%|!~MH|$|P|Y|=!|!!|:!|=!"
-    "|?!|?!|=!|A!|Z!|=!|&|#'|ZH||+&|%|!~\\H|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Q!"
-    "|=!|R!|R!|Y$|S!|Z!|=!|&|#'|/I||+&|%|!~1I|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|"
-    "D!|=!|E!|E!|[$|F!|Z!|=!|&|#'|DI||+&|%|!~FI|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A"
-    "!|B!|=!|C!|C!|]$|D!|Z!|=!|&|#'|YI||+&|%|!~[I|&|P|Y|=!|!!|:!|=!|?!|?!|=!"
-    "|A!|D!|=!|E!|E!|_$|F!|Z!|=!|&|#'|.J||+&|%|!~0J|&|P|Y|=!|!!|:!|=!|?!|?!|"
-    "=!|A!|C!|=!|D!|D!|!%|E!|Z!|=!|&|#'|CJ||+&|%|!~EJ|&|P|Y|=!|!!|:!|=!|?!|?"
-    "!|=!|A!|D!|=!|E!|E!|#%|F!|Z!|=!|&|#'|XJ||+&|%|!~ZJ|&|P|Y|=!|!!|:!|=!|?!"
-    "|?!|=!|A!|M!|=!|N!|N!|%%|O!|Z!|=!|&|#'|-K||+&|%|!~/K|&|P|Y|=!|!!|:!|=!|"
-    "?!|?!|=!|A!|B!|=!|C!|C!|'%|D!|Z!|=!|&|#'|BK||+&|%|!~DK|&|P|Y|=!|!!|:!|="
-    "!|?!|?!|=!|A!|D!|=!|E!|E!|)%|F!|Z!|=!|&|:Z|WK|@|+&|%|!~YK|$|P|Y|=!|!!|:"
-    "!|=!|?!|?!|=!|A!|Z!|=!|&|#'|&L||+&|%|!~(L|(|P|Y|=!|!!|:!|=!|?!|?!|=!|A!"
-    "|D!|=!|E!|E!|-%|F!|T!|=!|U!|U!|5%|V!|Z!|=!|&|#'|AL||+&|%|!~CL|&|P|Y|=!|"
-    "!!|:!|=!|?!|?!|=!|A!|F!|=!|G!|G!|/%|H!|Z!|=!|&|#'|VL||+&|%|!~XL|&|P|Y|="
-    "!|!!|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|1%|F!|Z!|=!|&|#'|+M||+&|%|!~-M|&|P|Y"
-    "|=!|!!|:!|=!|?!|?!|=!|A!|W!|=!|X!|X!|3%|Y!|Z!|=!|&|ZR|@M|A|+&|%|!~BM|$|"
-    "P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|OM||+&|%|!~QM|&|P|Y|=!|!!|:!|=!|"
-    "?!|?!|=!|A!|K!|=!|L!|L!|7%|M!|Z!|=!|&|#'|$N||+&|%|!~&N|&|P|Y|=!|!!|:!|="
-    "!|?!|?!|=!|A!|D!|=!|E!|E!|9%|F!|Z!|=!|&|#'|9N||+&|%|!~;N|&|P|Y|=!|!!|:!"
-    "|=!|?!|?!|=!|A!|R!|=!|S!|S!|;%|T!|Z!|=!|&|5$!|NN|/|+&|%|!~PN|$|P|Y|=!|!"
-    "!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|]N||+&|%|!~_N|*|P|Y|=!|!!|:!|=!|?!|?!|=!"
-    "|A!|D!|=!|E!|E!|?%|F!|N!|=!|O!|O!|M%|P!|Q!|=!|R!|R!|#&|S!|Z!|=!|&|#'|>O"
-    "||+&|%|!~@O|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|L!|=!|M!|M!|A%|N!|Z!|=!|&|#'|"
-    "SO||+&|%|!~UO|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|O!|=!|P!|P!|C%|Q!|Z!|=!|&|#"
-    "'|(P||+&|%|!~*P|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|K!|=!|L!|L!|E%|M!|Z!|=!|&"
-    "|#'|=P||+&|%|!~?P|%|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|A!|G%|B!|Z!|=!|&|#'|OP|"
-    "|+&|%|!~QP|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|S!|=!|T!|T!|I%|U!|Z!|=!|&|#'|$"
-    "Q||+&|%|!~&Q|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|K%|F!|Z!|=!|&|1O"
-    "|9Q|B|+&|%|!~;Q|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|HQ||+&|%|!~JQ|"
-    "&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|J!|=!|K!|K!|O%|L!|Z!|=!|&|#'|]Q||+&|%|!~_"
-    "Q|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|Q%|F!|Z!|=!|&|#'|2R||+&|%|!"
-    "~4R|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|M!|=!|N!|N!|S%|O!|Z!|=!|&|#'|GR||+&|%"
-    "|!~IR|&|P|Y|=!|!!|:!|=!|?!|?!|U%|A!|R!|=!|S!|S!|!&|T!|Z!|=!|&|#'|\\R||+"
-    "&|%|!~^R|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|B!|=!|C!|C!|W%|D!|Z!|=!|&|#'|1S|"
-    "|+&|%|!~3S|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|N!|=!|O!|O!|Y%|P!|Z!|=!|&|#'|F"
-    "S||+&|%|!~HS|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|T!|=!|U!|U!|[%|V!|Z!|=!|&|#'"
-    "|[S||+&|%|!~]S|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|M!|=!|N!|N!|]%|O!|Z!|=!|&|"
-    "#'|0T||+&|%|!~2T|&|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|S!|=!|T!|T!|_%|U!|Z!|=!|"
-    "&|5I\"|ET|F|+&|%|!~GT|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|5I|TT|J|+&|"
-    "%|!~VT|$|P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|#'|#U||+&|%|!~%U|&|P|Y|=!|"
-    "!!|:!|=!|?!|?!|=!|A!|T!|=!|U!|U!|%&|V!|Z!|=!|&|#'|8U||+&|%|!~:U|&|P|Y|="
-    "!|!!|:!|=!|?!|?!|=!|A!|D!|=!|E!|E!|'&|F!|Z!|=!|&|JQ\"|MU|U|+&|%|!~OU|$|"
-    "P|Y|=!|!!|:!|=!|?!|?!|=!|A!|Z!|=!|&|8-!|\\U|'|+&|%|!~^U||'|!~_U|9|!~_U|"
-    "'|'|!|>|!~\"V|(|<,|\"V|!|>|<,|#V|(|)1|#V|\"|>|)1|$V|7|74|$V|&|!|'|L3|&V"
-    "|9|L3|&V|'|'|!|>|L3|)V|7|15|)V|&||'|F4|+V|9|F4|+V|'|'|!|>|F4|.V|)|':|.V"
-    "|\"|+|':|/V|#|+|Z:|0V|$|-|/;|1V||\"|#~0|1;|4V|||!~,|Z:|7V|\"|$|#|2|[:|:"
-    "V|#|-|+;|;V||\"|#~3|*;|>V||+|W;|?V|$|-|+<|@V||\"|\"~0|-<|CV|||!~,|W;|FV"
-    "|\"|$|#|2|X;|IV|$|-|'<|JV||\"|\"~3|&<|MV||+|S<|NV|$|-|&=|OV||\"|!~0|(=|"
-    "RV|||!~,|S<|UV|\"|$|#|2|T<|XV|%|-|\"=|YV||\"|!~3|!=|\\V||,|':|]V|\"|#|#"
-    "|2|(:| W|\"|-|5:|!W||\"|!~3|4:|$W||*|':|%W|#|>|K7|&W|)|$8|&W|$|+|$8|'W|"
-    "#|,|$8|(W|$|#||2|$8|+W| \"|*|$8|,W||>|$8|-W|)|Q8|-W|\"|+|Q8|.W|#|,|Q8|/"
-    "W|\"|#||2|Q8|2W| \"|*|Q8|3W||>|Q8|4W|)|)@|4W|$|+|)@|5W|#|-|:@|6W||$|!~0"
-    "|<@|9W|||!~,|)@|<W|$|#|\"|2|*@|?W|#|*|)@|@W|\"|>|\\>|AW|)|5?|AW|\"|+|5?"
-    "|BW|#|-|5?|CW||\"|\"~0|5?|FW|||!~-|5?|IW||\"|!~/|5?|LW||,|5?|MW|\"|#|\""
-    "|2|5?|PW|_!|*|5?|QW|\"|>|5?|RW|)|5?|RW|$|+|5?|SW|#|,|5?|TW|$|#||2|5?|WW"
-    "|_!|*|5?|XW||>|5?|YW|)|[A|YW|\"|+|[A|ZW|#|-|,B|[W||\"|!~/|+B|^W||,|[A|_"
-    "W|\"|#|#|2|\\A|\"X|&|*|[A|#X|#|>|F@|$X|)|JC|$X|$|+|JC|%X|#|-|ZC|&X||$|!"
-    "~/|YC|)X||,|JC|*X|$|#|#|2|KC|-X|(|*|JC|.X|#|>|6B|/X|)|>E|/X|\"|+|>E|0X|"
-    "#|-|SE|1X||\"|!~/|RE|4X||,|>E|5X|\"|#|#|2|?E|8X|)|*|>E|9X|#|>|$D|:X|)|6"
-    "G|:X|$|+|6G|;X|#|-|JG|<X||$|!~/|IG|?X||,|6G|@X|$|#|#|2|7G|CX|*|*|6G|DX|"
-    "#|>|]E|EX|)|'J|EX|\"|+|'J|FX|#|-|7J|GX||\"|!~0|9J|JX|||!~,|'J|MX|\"|#|\""
-    "|2|(J|PX|$|*|'J|QX|\"|>|\\H|RX|)|5I|RX|$|+|5I|SX|#|-|5I|TX||$|\"~0|5I|W"
-    "X|||!~-|5I|ZX||$|!~/|5I|]X||,|5I|^X|$|#|\"|2|5I|!Y|_!|*|5I|\"Y|\"|>|5I|"
-    "#Y|)|5I|#Y|\"|+|5I|$Y|#|,|5I|%Y|\"|#||2|5I|(Y|_!|*|5I|)Y||>|5I|*Y|)|IK|"
-    "*Y|$|+|IK|+Y|#|-| L|,Y||$|!~/|_K|/Y||+|#L|0Y|\"|,|#L|1Y|$|\"|!|2|$L|4Y|"
-    ",|,|IK|5Y|$|#|!|2|JK|8Y|+|*|IK|9Y|!|>|CJ|:Y|)|WM|:Y|\"|+|WM|;Y|#|-|.N|<"
-    "Y||\"|#~/|-N|?Y||+|1N|@Y|$|-|KN|AY||\"|!~0|MN|DY|||!~,|1N|GY|\"|$|#|2|2"
-    "N|JY|,|-|GN|KY||\"|!~3|FN|NY||,|WM|OY|\"|#|#|2|XM|RY|+|*|WM|SY|#|>|@L|T"
-    "Y|)|(M|TY|$|+|(M|UY|#|-|(M|VY||$|\"~0|(M|YY|||!~-|(M|\\Y||$|!~/|(M|_Y||"
-    ",|(M| Z|$|#|\"|2|(M|#Z|_!|*|(M|$Z|\"|>|(M|%Z|)|(M|%Z|\"|+|(M|&Z|#|,|(M|"
-    "'Z|\"|#||2|(M|*Z|_!|*|(M|+Z||>|(M|,Z|)|-P|,Z|$|+|-P|-Z|#|-|AP|.Z||$|!~/"
-    "|@P|1Z||,|-P|2Z|$|#|#|2|.P|5Z|-|*|-P|6Z|#|>|XN|7Z|)| R|7Z|\"|+| R|8Z|#|"
-    "-|7R|9Z||\"|!~/|6R|<Z||,| R|=Z|\"|#|#|2|!R|@Z|.|*| R|AZ|#|>|KP|BZ|)|PS|"
-    "BZ|$|+|PS|CZ|#|+|$T|DZ|\"|+|4T|EZ|%|,|4T|FZ|$|%|#|2|5T|IZ|!|4|>T|JZ|!~-"
-    "|GT|KZ||$|!~/|FT|NZ||,|$T|OZ|$|\"|#|2|%T|RZ|0|,|PS|SZ|$|#|#|2|QS|VZ|/|*"
-    "|PS|WZ|#|>|AR|XZ|)|!V|XZ|%|+|!V|YZ|\"|-|6V|ZZ||%|!~0|8V|]Z|||!~,|!V| [|"
-    "%|\"|#|2|\"V|#[|/|*|!V|$[|#|>|RT|%[|)|3U|%[|#|+|3U|&[|$|-|3U|'[||#|\"~0"
-    "|3U|*[|||!~-|3U|-[||#|!~/|3U|0[||,|3U|1[|#|$|\"|2|3U|4[|_!|*|3U|5[|\"|>"
-    "|3U|6[|)|3U|6[|\"|+|3U|7[|%|-|3U|8[||\"|!~/|3U|;[||,|3U|<[|\"|%|!|2|3U|"
-    "?[|_!|*|3U|@[|!|>|3U|A[|)|#X|A[|$|+|#X|B[|#|-|4X|C[||$|$~/|3X|F[||-|8X|"
-    "G[||$|!~/|7X|J[||,|#X|K[|$|#|%|2|$X|N[|0|*|#X|O[|%|>|BV|P[|)|EY|P[|%|+|"
-    "EY|Q[|\"|-|WY|R[||%|!~/|VY|U[||,|EY|V[|%|\"|!|2|FY|Y[|U|*|EY|Z[|!|>|BX|"
-    "[[|)|6[|[[|#|+|6[|\\[|$|-|L[|][||#|!~/|K[| \\||,|6[|!\\|#|$|#|2|7[|$\\|"
-    "1|*|6[|%\\|#|>|!Z|&\\|)|6]|&\\|\"|+|6]|'\\|%|-|H]|(\\||\"|\"~/|G]|+\\||"
-    ",|6]|,\\|\"|%|%|2|7]|/\\|2|*|6]|0\\|%|>|V[|1\\|)|#_|1\\|$|+|#_|2\\|#|-|"
-    "5_|3\\||$|!~/|4_|6\\||,|#_|7\\|$|#|#|2|$_|:\\|3|*|#_|;\\|#|>|R]|<\\|)|P"
-    " !|<\\|%|+|P !|=\\|\"|-|\"!!|>\\||%|!~/|!!!|A\\||,|P !|B\\|%|\"|#|2|Q !"
-    "|E\\|4|*|P !|F\\|#|>|?_|G\\|)|;\"!|G\\|#|+|;\"!|H\\|$|-|L\"!|I\\||#|!~/"
-    "|K\"!|L\\||,|;\"!|M\\|#|$|#|2|<\"!|P\\|5|*|;\"!|Q\\|#|>|,!!|R\\|)|\"%!|"
-    "R\\|\"|+|\"%!|S\\|%|-|1%!|T\\||\"|!~0|3%!|W\\|||!~,|\"%!|Z\\|\"|%|\"|2|"
-    "#%!|]\\|%|*|\"%!|^\\|\"|>|\\#!|_\\|)|5$!|_\\|$|+|5$!| ]|#|,|5$!|!]|$|#|"
-    "|2|5$!|$]| \"|*|5$!|%]||>|5$!|&]|)|\\#!|&]|%|+|\\#!|']|\"|-|\\#!|(]||%|"
-    "\"~0|\\#!|+]|||!~-|\\#!|.]||%|!~/|\\#!|1]||,|\\#!|2]|%|\"|\"|2|\\#!|5]|"
-    "_!|*|\\#!|6]|\"|>|\\#!|7]|)|\\#!|7]|#|+|\\#!|8]|$|-|\\#!|9]||#|!~/|\\#!"
-    "|<]||,|\\#!|=]|#|$|!|2|\\#!|@]|_!|*|\\#!|A]|!|>|\\#!|B]|)|)'!|B]|\"|+|)"
-    "'!|C]|%|-|8'!|D]||\"|$~/|7'!|G]||-|<'!|H]||\"|\"~/|;'!|K]||-|@'!|L]||\""
-    "|!~.|@'!|O]|||/|?'!|Q]||-|F'!|R]||\"|!~.|F'!|U]||!|/|E'!|W]||,|)'!|X]|\""
-    "|%|$|2|*'!|[]|6|-|4'!|\\]||\"|#~3|3'!|_]||*|)'!| ^|$|>|=%!|!^|)|3)!|!^|"
-    "$|+|3)!|\"^|#|-|5)!|#^||$|#~/|4)!|&^||-|9)!|'^||$|!~/|8)!|*^||,|3)!|+^|"
-    "$|#|$|2|3)!|.^|!\"|*|3)!|/^|$|>|R'!|0^|)|N*!|0^|%|+|N*!|1^|\"|-|P*!|2^|"
-    "|%|!~/|O*!|5^||+|S*!|6^|#|,|S*!|7^|%|#|\"|2|T*!|:^|!|4|]*!|;^|!~,|N*!|<"
-    "^|%|\"|\"|2|N*!|?^|!\"|*|N*!|@^|\"|>|C)!|A^|)|),!|A^|$|+|),!|B^|#|+|*,!"
-    "|C^|\"|,|*,!|D^|$|\"||2|+,!|G^|!|4|4,!|H^|!~+|<,!|I^|%|,|<,!|J^|$|%||2|"
-    "=,!|M^|!|4|F,!|N^|!~,|),!|O^|$|#||2|),!|R^|!\"|*|),!|S^||>|,+!|T^|)|*.!"
-    "|T^|\"|+|*.!|U^|%|-|<.!|V^||\"|\"~/|;.!|Y^||-|@.!|Z^||\"|!~0|B.!|]^|||!"
-    "~,|*.!| _|\"|%|\"|2|+.!|#_|7|*|*.!|$_|\"|>|U,!|%_|)|.-!|%_|#|+|.-!|&_|$"
-    "|-|.-!|'_||#|\"~0|.-!|*_|||!~-|.-!|-_||#|!~/|.-!|0_||,|.-!|1_|#|$|\"|2|"
-    ".-!|4_|_!|*|.-!|5_|\"|>|.-!|6_|)|F-!|6_|%|-|G-!|7_|!|%|!~/|F-!|:_|!|*|F"
-    "-!|;_|\"|>|!~<_|)|.-!|<_|\"|+|.-!|=_|$|,|.-!|>_|\"|$||2|.-!|A_|_!|*|.-!"
-    "|B_||>|.-!|C_|)|U/!|C_|#|+|U/!|D_|%|-|#0!|E_|!|#|!~0|%0!|H_|!||!~,|U/!|"
-    "K_|#|%|!|2|V/!|N_|8|*|U/!|O_|!|>|L.!|P_|)|L.!|P_|$|+|L.!|Q_|\"|-|L.!|R_"
-    "|!|$|\"~0|L.!|U_|!||!~-|L.!|X_|!|$|!~/|L.!|[_|!|,|L.!|\\_|$|\"|\"|2|L.!"
-    "|__|_!|*|L.!|  !|\"|>|L.!|! !|)|L.!|! !|%|+|L.!|\" !|#|-|L.!|# !|!|%|!~"
-    "/|L.!|& !|!|,|L.!|' !|%|#|!|2|L.!|* !|_!|*|L.!|+ !|!|>|L.!|, !|)|71!|, "
-    "!|\"|+|71!|- !|$|-|M1!|. !|!|\"|\"~/|L1!|1 !|!|,|71!|2 !|\"|$|\"|2|81!|"
-    "5 !|:|-|I1!|6 !|!|\"|!~3|H1!|9 !|!|*|71!|: !|\"|>|/0!|; !|)|_2!|; !|#|+"
-    "|_2!|< !|%|-|43!|= !|!|#|\"~/|33!|@ !|!|,|_2!|A !|#|%|\"|2| 3!|D !|;|-|"
-    "03!|E !|!|#|!~3|/3!|H !|!|*|_2!|I !|\"|>|W1!|J !|)|F4!|J !|$|+|F4!|K !|"
-    "\"|-|Y4!|L !|!|$|\"~/|X4!|O !|!|,|F4!|P !|$|\"|\"|2|G4!|S !|9|-|U4!|T !"
-    "|!|$|!~3|T4!|W !|!|*|F4!|X !|\"|>|>3!|Y !|)|?7!|Y !|%|+|?7!|Z !|#|,|?7!"
-    "|[ !|%|#|!|2|@7!|^ !|F|*|?7!|_ !|!|>|@6!| !!|)|*9!| !!|\"|+|*9!|!!!|$|-"
-    "|69!|\"!!|!|\"|#~/|59!|%!!|!|-|:9!|&!!|!|\"|\"~.|:9!|)!!|!||/|99!|+!!|!"
-    "|-|@9!|,!!|!|\"|\"~.|@9!|/!!|!|!|/|?9!|1!!|!|,|*9!|2!!|\"|$|$|2|+9!|5!!"
-    "|<|*|*9!|6!!|$|>|Q7!|7!!|)|>;!|7!!|#|+|>;!|8!!|%|-|W;!|9!!|!|#|$~/|V;!|"
-    "<!!|!|-|[;!|=!!|!|#|\"~/|Z;!|@!!|!|+|^;!|A!!|$|-|;<!|B!!|!|#|!~0|=<!|E!"
-    "!|!||!~,|^;!|H!!|#|$|$|2|_;!|K!!|>|-|7<!|L!!|!|#|!~3|6<!|O!!|!|,|>;!|P!"
-    "!|#|%|$|2|?;!|S!!|=|-|S;!|T!!|!|#|#~3|R;!|W!!|!|*|>;!|X!!|$|>|L9!|Y!!|)"
-    "|@:!|Y!!|\"|+|@:!|Z!!|$|-|@:!|[!!|!|\"|\"~0|@:!|^!!|!||!~-|@:!|!\"!|!|\""
-    "|!~/|@:!|$\"!|!|,|@:!|%\"!|\"|$|\"|2|@:!|(\"!|_!|*|@:!|)\"!|\"|>|@:!|*\""
-    "!|)|@:!|*\"!|%|+|@:!|+\"!|#|-|@:!|,\"!|!|%|!~/|@:!|/\"!|!|,|@:!|0\"!|%|"
-    "#|!|2|@:!|3\"!|_!|*|@:!|4\"!|!|>|@:!|5\"!|)|O=!|5\"!|$|+|O=!|6\"!|\"|-|"
-    "(>!|7\"!|!|$|\"~/|'>!|:\"!|!|+|+>!|;\"!|#|-|F>!|<\"!|!|$|!~0|H>!|?\"!|!"
-    "||!~,|+>!|B\"!|$|#|\"|2|,>!|E\"!|B|-|B>!|F\"!|!|$|!~3|A>!|I\"!|!|,|O=!|"
-    "J\"!|$|\"|\"|2|P=!|M\"!|?|*|O=!|N\"!|\"|>|H<!|O\"!|)|!=!|O\"!|%|+|!=!|P"
-    "\"!|#|-|!=!|Q\"!|!|%|\"~0|!=!|T\"!|!||!~-|!=!|W\"!|!|%|!~/|!=!|Z\"!|!|,"
-    "|!=!|[\"!|%|#|\"|2|!=!|^\"!|_!|*|!=!|_\"!|\"|>|!=!| #!|)|!=!| #!|\"|+|!"
-    "=!|!#!|$|-|!=!|\"#!|!|\"|!~/|!=!|%#!|!|,|!=!|&#!|\"|$|!|2|!=!|)#!|_!|*|"
-    "!=!|*#!|!|>|!=!|+#!|)|O?!|+#!|#|+|O?!|,#!|%|,|O?!|-#!|#|%|!|2|P?!|0#!|@"
-    "|*|O?!|1#!|!|>|S>!|2#!|)|%A!|2#!|$|+|%A!|3#!|\"|,|%A!|4#!|$|\"|!|2|&A!|"
-    "7#!|A|*|%A!|8#!|!|>|)@!|9#!|)|UB!|9#!|%|+|UB!|:#!|#|-|,C!|;#!|!|%|\"~/|"
-    "+C!|>#!|!|-|0C!|?#!|!|%|!~.|0C!|B#!|!||/|/C!|D#!|!|-|6C!|E#!|!|%|!~.|6C"
-    "!|H#!|!|!|/|5C!|J#!|!|,|UB!|K#!|%|#|\"|2|VB!|N#!|C|*|UB!|O#!|\"|>|@A!|P"
-    "#!|)|/F!|P#!|\"|+|/F!|Q#!|$|-|GF!|R#!|!|\"|!~/|FF!|U#!|!|,|/F!|V#!|\"|$"
-    "|!|2|0F!|Y#!|D|*|/F!|Z#!|!|>|)E!|[#!|)|ZG!|[#!|#|+|ZG!|\\#!|%|-|5H!|]#!"
-    "|!|#|!~/|4H!| $!|!|,|ZG!|!$!|#|%|!|2|[G!|$$!|E|*|ZG!|%$!|!|>|QF!|&$!|)|"
-    "!L!|&$!|$|+|!L!|'$!|\"|,|!L!|($!|$|\"||2|\"L!|+$!|!|*|!L!|,$!||>|$K!|-$"
-    "!|)|\"N!|-$!|%|+|\"N!|.$!|#|-|2N!|/$!|!|%|\"~0|4N!|2$!|!||!~,|\"N!|5$!|"
-    "%|#|#|2|#N!|8$!|G|*|\"N!|9$!|#|>|2L!|:$!|)|2M!|:$!|\"|+|2M!|;$!|$|-|4M!"
-    "|<$!|!|\"|\"~/|3M!|?$!|!|-|8M!|@$!|!|\"|!~0|:M!|C$!|!||!~,|2M!|F$!|\"|$"
-    "|\"|2|2M!|I$!|\"\"|*|2M!|J$!|\"|>|!~K$!|)|QL!|K$!|#|+|QL!|L$!|%|-|QL!|M"
-    "$!|!|#|\"~0|QL!|P$!|!||!~-|QL!|S$!|!|#|!~/|QL!|V$!|!|,|QL!|W$!|#|%|\"|2"
-    "|QL!|Z$!|_!|*|QL!|[$!|\"|>|QL!|\\$!|)|*M!|\\$!|$|-|+M!|]$!|\"|$|!~/|*M!"
-    "| %!|\"|*|*M!|!%!|\"|>|!~\"%!|)|[L!|\"%!|\"|+|[L!|#%!|%|,|[L!|$%!|\"|%|"
-    "|2|[L!|'%!| \"|*|[L!|(%!||>|[L!|)%!|)|QL!|)%!|#|+|QL!|*%!|$|,|QL!|+%!|#"
-    "|$||2|QL!|.%!|_!|*|QL!|/%!||>|QL!|0%!|)|!~0%!|%|+|!~1%!|\"|,|!~2%!|%|\""
-    "||2|!~5%!| \"|*|!~6%!||>|!~7%!|)|@P!|7%!|$|+|@P!|8%!|#|-|OP!|9%!|\"|$|#"
-    "~/|NP!|<%!|\"|-|SP!|=%!|\"|$|!~/|RP!|@%!|\"|,|@P!|A%!|$|#|$|2|AP!|D%!|I"
-    "|*|@P!|E%!|$|>|'O!|F%!|)|%R!|F%!|\"|+|%R!|G%!|%|-|4R!|H%!|\"|\"|!~/|3R!"
-    "|K%!|\"|+|7R!|L%!|#|,|7R!|M%!|\"|#|\"|2|8R!|P%!|!|4|AR!|Q%!|!~,|%R!|R%!"
-    "|\"|%|\"|2|&R!|U%!|I|*|%R!|V%!|\"|>|]P!|W%!|)|XS!|W%!|$|+|XS!|X%!|#|+|&"
-    "T!|Y%!|%|,|&T!|Z%!|$|%|\"|2|'T!|]%!|!|4|0T!|^%!|!~-|9T!|_%!|\"|$|!~/|8T"
-    "!|\"&!|\"|,|XS!|#&!|$|#|\"|2|YS!|&&!|I|*|XS!|'&!|\"|>|PR!|(&!|)|EU!|(&!"
-    "|\"|+|EU!|)&!|%|,|EU!|*&!|\"|%|!|2|FU!|-&!|X|-|VU!|.&!|\"|\"|!~5|UU!|1&"
-    "!|\"|*|EU!|2&!|!|>|CT!|3&!|)|(W!|3&!|#|+|(W!|4&!|$|-|6W!|5&!|\"|#|!~/|5"
-    "W!|8&!|\"|,|(W!|9&!|#|$|\"|2|)W!|<&!|J|*|(W!|=&!|\"|>| V!|>&!|)|HX!|>&!"
-    "|%|+|HX!|?&!|\"|-|ZX!|@&!|\"|%|!~/|YX!|C&!|\"|,|HX!|D&!|%|\"|\"|2|IX!|G"
-    "&!|K|*|HX!|H&!|\"|>|@W!|I&!|)|+Z!|I&!|$|+|+Z!|J&!|#|-|CZ!|K&!|\"|$|!~/|"
-    "BZ!|N&!|\"|,|+Z!|O&!|$|#|\"|2|,Z!|R&!|L|*|+Z!|S&!|\"|>|$Y!|T&!|)|U[!|T&"
-    "!|\"|+|U[!|U&!|%|-|%\\!|V&!|\"|\"|!~/|$\\!|Y&!|\"|,|U[!|Z&!|\"|%|\"|2|V"
-    "[!|]&!|M|*|U[!|^&!|\"|>|MZ!|_&!|)|6]!|_&!|#|+|6]!| '!|$|-|L]!|!'!|\"|#|"
-    "!~/|K]!|$'!|\"|,|6]!|%'!|#|$|\"|2|7]!|('!|N|*|6]!|)'!|\"|>|/\\!|*'!|)|#"
-    " \"|*'!|%|+|# \"|+'!|\"|-|0 \"|,'!|\"|%|\"~/|/ \"|/'!|\"|-|4 \"|0'!|\"|"
-    "%|!~0|6 \"|3'!|\"||!~,|# \"|6'!|%|\"|\"|2|$ \"|9'!|P|*|# \"|:'!|\"|>|@^"
-    "!|;'!|)|Y^!|;'!|$|+|Y^!|<'!|#|-|Y^!|='!|\"|$|\"~0|Y^!|@'!|\"||!~-|Y^!|C"
-    "'!|\"|$|!~/|Y^!|F'!|\"|,|Y^!|G'!|$|#|\"|2|Y^!|J'!|_!|*|Y^!|K'!|\"|>|Y^!"
-    "|L'!|)|?_!|L'!|\"|-|@_!|M'!|#|\"|!~/|?_!|P'!|#|*|?_!|Q'!|\"|>|!~R'!|)|Y"
-    "^!|R'!|%|+|Y^!|S'!|#|,|Y^!|T'!|%|#||2|Y^!|W'!|_!|*|Y^!|X'!||>|Y^!|Y'!|)"
-    "|\"\"\"|Y'!|$|+|\"\"\"|Z'!|\"|-|1\"\"|['!|#|$|#~/|0\"\"|^'!|#|-|5\"\"|_"
-    "'!|#|$|!~/|4\"\"|\"(!|#|,|\"\"\"|#(!|$|\"|#|2|#\"\"|&(!|Q|*|\"\"\"|'(!|"
-    "#|>|@ \"|((!|)|+$\"|((!|#|+|+$\"|)(!|%|,|+$\"|*(!|#|%||2|,$\"|-(!|Y|6|8"
-    "$\"|.(!||*|+$\"|/(!||>|.#\"|0(!|)|1&\"|0(!|\"|+|1&\"|1(!|$|,|1&\"|2(!|\""
-    "|$||2|2&\"|5(!|Z|6|F&\"|6(!||*|1&\"|7(!||>|4%\"|8(!|)|X'\"|8(!|%|+|X'\""
-    "|9(!|#|,|X'\"|:(!|%|#|\"|2|Y'\"|=(!|Z|-|.(\"|>(!|#|%|!~5|-(\"|A(!|#|*|X"
-    "'\"|B(!|\"|>|S&\"|C(!|)|9)\"|C(!|$|+|9)\"|D(!|\"|,|9)\"|E(!|$|\"|!|2|:)"
-    "\"|H(!|Y|-|G)\"|I(!|#|$|!~5|F)\"|L(!|#|*|9)\"|M(!|!|>|8(\"|N(!|)|$+\"|N"
-    "(!|#|-|%+\"|O(!|$|#|\"~/|$+\"|R(!|$|*|$+\"|S(!|#|>|Q)\"|T(!|)|@-\"|T(!|"
-    "%|+|@-\"|U(!|\"|-|Z-\"|V(!|$|%|!~0|\\-\"|Y(!|$||!~,|@-\"|\\(!|%|\"|!|2|"
-    "A-\"|_(!|M!|*|@-\"| )!|!|>|8,\"|!)!|)|8,\"|!)!|$|+|8,\"|\")!|#|-|8,\"|#"
-    ")!|$|$|\"~0|8,\"|&)!|$||!~-|8,\"|))!|$|$|!~/|8,\"|,)!|$|,|8,\"|-)!|$|#|"
-    "\"|2|8,\"|0)!|_!|*|8,\"|1)!|\"|>|8,\"|2)!|)|8,\"|2)!|\"|+|8,\"|3)!|%|,|"
-    "8,\"|4)!|\"|%||2|8,\"|7)!|_!|*|8,\"|8)!||>|8,\"|9)!|)|B/\"|9)!|#|+|B/\""
-    "|:)!|$|-|Y/\"|;)!|$|#|$~/|X/\"|>)!|$|-|]/\"|?)!|$|#|\"~/|\\/\"|B)!|$|,|"
-    "B/\"|C)!|#|$|$|2|C/\"|F)!|N!|-|U/\"|G)!|$|#|#~3|T/\"|J)!|$|*|B/\"|K)!|$"
-    "|>|&.\"|L)!|)|/1\"|L)!|%|+|/1\"|M)!|\"|,|/1\"|N)!|%|\"|\"|2|01\"|Q)!|]!"
-    "|*|/1\"|R)!|\"|>|'0\"|S)!|)|C2\"|S)!|$|+|C2\"|T)!|#|-|R2\"|U)!|$|$|#~/|"
-    "Q2\"|X)!|$|-|V2\"|Y)!|$|$|\"~/|U2\"|\\)!|$|,|C2\"|])!|$|#|#|2|D2\"| *!|"
-    "[!|*|C2\"|!*!|#|>|!~\"*!|)|V3\"|\"*!|\"|+|V3\"|#*!|%|-|&4\"|$*!|$|\"|#~"
-    "/|%4\"|'*!|$|-|*4\"|(*!|$|\"|\"~/|)4\"|+*!|$|,|V3\"|,*!|\"|%|#|2|W3\"|/"
-    "*!|Z!|*|V3\"|0*!|#|>|!~1*!|)|*5\"|1*!|#|+|*5\"|2*!|$|-|<5\"|3*!|$|#|#~/"
-    "|;5\"|6*!|$|-|@5\"|7*!|$|#|\"~/|?5\"|:*!|$|,|*5\"|;*!|#|$|#|2|+5\"|>*!|"
-    "O!|*|*5\"|?*!|#|>|!~@*!|)|@6\"|@*!|%|+|@6\"|A*!|\"|-|U6\"|B*!|$|%|#~/|T"
-    "6\"|E*!|$|-|Y6\"|F*!|$|%|\"~/|X6\"|I*!|$|,|@6\"|J*!|%|\"|#|2|A6\"|M*!|P"
-    "!|*|@6\"|N*!|#|>|!~O*!|)|Y7\"|O*!|$|+|Y7\"|P*!|#|-|.8\"|Q*!|$|$|#~/|-8\""
-    "|T*!|$|-|28\"|U*!|$|$|\"~/|18\"|X*!|$|,|Y7\"|Y*!|$|#|#|2|Z7\"|\\*!|Q!|*"
-    "|Y7\"|]*!|#|>|!~^*!|)|29\"|^*!|\"|+|29\"|_*!|%|-|H9\"| +!|$|\"|#~/|G9\""
-    "|#+!|$|-|L9\"|$+!|$|\"|\"~/|K9\"|'+!|$|,|29\"|(+!|\"|%|#|2|39\"|++!|R!|"
-    "*|29\"|,+!|#|>|!~-+!|)|L:\"|-+!|#|+|L:\"|.+!|$|-|$;\"|/+!|$|#|#~/|#;\"|"
-    "2+!|$|-|(;\"|3+!|$|#|\"~/|';\"|6+!|$|,|L:\"|7+!|#|$|#|2|M:\"|:+!|S!|*|L"
-    ":\"|;+!|#|>|!~<+!|)|(<\"|<+!|%|+|(<\"|=+!|\"|-|A<\"|>+!|$|%|#~/|@<\"|A+"
-    "!|$|-|E<\"|B+!|$|%|\"~/|D<\"|E+!|$|,|(<\"|F+!|%|\"|#|2|)<\"|I+!|T!|*|(<"
-    "\"|J+!|#|>|!~K+!|)|E=\"|K+!|$|+|E=\"|L+!|#|-|U=\"|M+!|$|$|#~/|T=\"|P+!|"
-    "$|-|Y=\"|Q+!|$|$|\"~/|X=\"|T+!|$|,|E=\"|U+!|$|#|#|2|F=\"|X+!|U!|*|E=\"|"
-    "Y+!|#|>|!~Z+!|)|Y>\"|Z+!|\"|+|Y>\"|[+!|%|-|.?\"|\\+!|$|\"|#~/|-?\"|_+!|"
-    "$|-|2?\"| ,!|$|\"|\"~/|1?\"|#,!|$|,|Y>\"|$,!|\"|%|#|2|Z>\"|',!|V!|*|Y>\""
-    "|(,!|#|>|!~),!|)|2@\"|),!|#|+|2@\"|*,!|$|-|G@\"|+,!|$|#|#~/|F@\"|.,!|$|"
-    "-|K@\"|/,!|$|#|\"~/|J@\"|2,!|$|,|2@\"|3,!|#|$|#|2|3@\"|6,!|W!|*|2@\"|7,"
-    "!|#|>|!~8,!|)|KA\"|8,!|%|+|KA\"|9,!|\"|-|^A\"|:,!|$|%|#~/|]A\"|=,!|$|-|"
-    "\"B\"|>,!|$|%|\"~/|!B\"|A,!|$|,|KA\"|B,!|%|\"|#|2|LA\"|E,!|X!|*|KA\"|F,"
-    "!|#|>|!~G,!|)|6C\"|G,!|$|+|6C\"|H,!|#|-|MC\"|I,!|$|$|!~/|LC\"|L,!|$|,|6"
-    "C\"|M,!|$|#|\"|2|7C\"|P,!|Y!|*|6C\"|Q,!|\"|>|,B\"|R,!|)|!E\"|R,!|\"|+|!"
-    "E\"|S,!|%|-|1E\"|T,!|$|\"|!~/|0E\"|W,!|$|,|!E\"|X,!|\"|%|\"|2|\"E\"|[,!"
-    "|\\!|*|!E\"|\\,!|\"|>|WC\"|],!|)|:G\"|],!|#|-|;G\"|^,!|%|#|\"~/|:G\"|!-"
-    "!|%|*|:G\"|\"-!|#|>|*F\"|#-!|)|!J\"|#-!|$|+|!J\"|$-!|%|,|!J\"|%-!|$|%|!"
-    "|2|\"J\"|(-!|^!|*|!J\"|)-!|!|>|\\H\"|*-!|)|DL\"|*-!|\"|+|DL\"|+-!|#|,|D"
-    "L\"|,-!|\"|#|!|2|EL\"|/-!|[|-|QL\"|0-!|%|\"|!~5|PL\"|3-!|%|*|DL\"|4-!|!"
-    "|>|DK\"|5-!|)|\"N\"|5-!|%|+|\"N\"|6-!|$|,|\"N\"|7-!|%|$|!|2|#N\"|:-!|[|"
-    "-|/N\"|;-!|%|%|!~5|.N\"|>-!|%|*|\"N\"|?-!|!|>|[L\"|@-!|)|=O\"|@-!|#|+|="
-    "O\"|A-!|\"|,|=O\"|B-!|#|\"|!|2|>O\"|E-!|X|-|NO\"|F-!|%|#|!~5|MO\"|I-!|%"
-    "|*|=O\"|J-!|!|>|9N\"|K-!|)|YP\"|K-!|$|+|YP\"|L-!|%|,|YP\"|M-!|$|%|!|2|Z"
-    "P\"|P-!|Y|-|'Q\"|Q-!|%|$|!~5|&Q\"|T-!|%|*|YP\"|U-!|!|>|XO\"|V-!|)|/R\"|"
-    "V-!|\"|+|/R\"|W-!|#|,|/R\"|X-!|\"|#|!|2|0R\"|[-!|]|*|/R\"|\\-!|!|>|1Q\""
-    "|]-!|)|?S\"|]-!|%|+|?S\"|^-!|$|,|?S\"|_-!|%|$|!|2|@S\"|\".!|^|*|?S\"|#."
-    "!|!|>|@R\"|$.!|)|QT\"|$.!|#|+|QT\"|%.!|\"|,|QT\"|&.!|#|\"|!|2|RT\"|).!|"
-    "[|-|^T\"|*.!|%|#|!~5|]T\"|-.!|%|*|QT\"|..!|!|>|QS\"|/.!|)|.V\"|/.!|$|+|"
-    ".V\"|0.!|%|,|.V\"|1.!|$|%|!|2|/V\"|4.!|\\|-|AV\"|5.!|%|$|!~5|@V\"|8.!|%"
-    "|*|.V\"|9.!|!|>|(U\"|:.!|)|OW\"|:.!|\"|+|OW\"|;.!|#|,|OW\"|<.!|\"|#|!|2"
-    "|PW\"|?.!|X|-| X\"|@.!|%|\"|!~5|_W\"|C.!|%|*|OW\"|D.!|!|>|KV\"|E.!|}L|("
-    "|}M||0|!|1||Temp$0||Temp$1||Temp$2||Temp$3||in_guard||token_count|}N|&|"
-    "}O|#|}P|1|Missing closing quote on string literal|Missing closing quote"
-    " on triple quoted string literal|}Q|}"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~}8|!|}9||}:||};|_#|}<||}=|(|}>|'|}\?||}@|+|"
+    "}A|_#|}B||}C|3|}D|_'|}E||}F|3|}G|_'|}H|Null||Halt|!|Label|\"|Call|#|Sca"
+    "nStart|$|ScanChar|%|ScanAccept|&|ScanToken|'|ScanError|(|AstStart|)|Ast"
+    "Finish|*|AstNew|+|AstForm|,|AstLoad|-|AstIndex|.|AstChild|/|AstChildSli"
+    "ce|0|AstKind|1|AstKindNum|2|AstLocation|3|AstLocationNum|4|AstLexeme|5|"
+    "AstLexemeString|6|Assign|7|DumpStack|8|Add|9|Subtract|:|Multiply|;|Divi"
+    "de|<|UnaryMinus|=|Return|>|Branch|\?|BranchEqual|@|BranchNotEqual|A|Bra"
+    "nchLessThan|B|BranchLessEqual|C|BranchGreaterThan|D|BranchGreaterEqual|"
+    "E|ScanClass|F|ScanKeyword|G|ScanClassMemo|H|ScanLazy|I|AstLoadChild|J|A"
+    "stFormKind|K|AstFinishReturn|L|}I|Z1|}J|/G!|}K|7|!~|'||>|!~\"|$|!~\"|F|"
+    "!~\"|!|W|$|$|&|(|.|0|2|4|\?|A|C|E|G|I|K|M|W|Y|\"!|$!|/!|3!|9!|;!|=!|\?!"
+    "|!~A!|!~C!|E!|=!|Q!|=\"|%#|7#|=!|=!|A#|'$|[$|7&|=!|U&|#'|U'|'(|/(|=!|=!"
+    "|=!|=!|=!|=!|1)|&|7$|[|-\"|\"|F|!~]|!|\"|$|$|&|)Q\"|!!|V|3)|%|!~#!||%|!"
+    "~$!|'||)|(|*|*|)|+|A|(|B|B|+|C|;!|(|<!|<!|-|=!|_____#|(|&|]+|:!|+\"|>)|"
+    "%|!~<!||&|N)|=!|\"|3)|%|!~\?!||%|!~@!|\"||)|(|+|_____#|(|&|M]!|G!|.|3)|"
+    "%|!~I!||&|:$\"|J!|0|3)|%|!~L!||&|^(\"|M!|&|3)|%|!~O!||%|!~P!|'||)|5|*|*"
+    "|)|+|F|5|G|G|7|H|;!|5|<!|<!|6|=!|_____#|5|%|!~&\"|'||)|5|*|*|)|+|F|5|G|"
+    "G|+|H|;!|5|<!|<!|6|=!|_____#|5|%|!~<\"|\"||)|5|+|_____#|5|&|N)|C\"|\"|3"
+    ")|F|!~E\"|(|!|9|&|D0|H\"|,\"|@)|%|!~J\"|#||F|9|G|G|;|H|_____#|9|%|!~T\""
+    "|#||F|9|G|G|<|H|_____#|9|%|!~^\"|#||F|9|G|G|=|H|_____#|9|&|;/|(#|]|3)|%"
+    "|!~*#||&|$G!|+#|$|3)|%|!~-#||&|BG!|.#|!|3)|%|!~0#||&|_\?!|1#|5|3)|%|!~3"
+    "#||&|DA!|4#|2|3)|%|!~6#||&|-[!|7#|3|3)|%|!~9#||&|L4\"|:#|)|3)|%|!~<#||&"
+    "|^]!|=#|Z|3)|%|!~\?#||&|BN\"|@#|T|3)|%|!~B#|#|J|J|O|O|O|S|]|]|U|%|!~L#|"
+    "#||I|O|J|J|P|K|_____#|O|%|!~V#|%||I|O|J|J|P|K|N|O|O|O|Q|P|_____#|O|&|T\""
+    "|&$|*\"|\"|%|!~($||&|T\"|)$|*\"|\"|%|!~+$|\"||)|S|+|_____#|S|&|\?C\"|2$"
+    "|8|3)|%|!~4$||&|Y%|5$|6|3)|F|!~7$|1|!|W|&|J[|:$|(|3)|F|!~<$|2|$|[|!~!~ "
+    "!|%|!~B$|\"|]|]|\\|>!|>!|^|&|G5!|I$| !|3)|%|!~K$||&|1I!|L$|_|3)|%|!~N$|"
+    "|&|Y;\"|O$|!!|3)|%|!~Q$||&|/<\"|R$|4|3)|%|!~T$||@|55|U$|&!|&||&|T4|X$|D"
+    "|3)|%|!~Z$|$|\\|\\|'!|]|]|)!|!!|:!|+!|A!|Z!|+!|&|]M!|'%|,|3)|%|!~)%||&|"
+    "/F\"|*%|C|3)|%|!~,%||%|!~-%|%|P|Y|+!|^|^|,!|!!|:!|+!|\?!|\?!|+!|A!|Z!|+"
+    "!|A|[(|=%|.!|&||&|9(|@%|#|3)|%|!~B%||&|&@|C%|-|3)|F|!~E%|6|!|1!|&|G%!|H"
+    "%|\"!|3)|%|!~J%||&|HG\"|K%|B|3)|F|!~M%|5|\"|5!|7!|&|#I\"|Q%|A|3)|%|!~S%"
+    "||&|0O!|T%|+|3)|%|!~V%||&|(C!|W%|W|3)|%|!~Y%||&|W%\"|Z%|1|3)|%|!~\\%||&"
+    "|L&|]%||3)|%|!~_%|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|$3|,&|X|6)|%|"
+    "!~.&||&|\\3|/&|/|:)|%|!~1&||&|Z.\"|2&|Y|3)|%|!~4&||&|L&|5&||3)|%|!~7&|&"
+    "|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|C!|C!|G!|D!|Z!|=!|&|L&|J&||3)|%|!~"
+    "L&|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|I!|U!|Z!|=!|&|L&|_&||3)|"
+    "%|!~!'|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H!|=!|I!|I!|K!|J!|Z!|=!|&|L&|4'|"
+    "|3)|%|!~6'|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|N!|=!|O!|O!|M!|P!|Z!|=!|&|L&"
+    "|I'||3)|%|!~K'|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|O!|O!|Z!|=!|"
+    "&|9*!|^'|\?|3)|%|!~ (|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|-(||3)"
+    "|%|!~/(|'|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|S!|B!|N!|=!|O!|O!|-\"|P!|Z!|"
+    "=!|&|L&|E(||3)|%|!~G(|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|U!|T!"
+    "|Z!|=!|&|L&|Z(||3)|%|!~\\(|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|"
+    "W!|F!|Z!|=!|&|L&|/)||3)|%|!~1)|$|P|Y|=!|!!|:!|=!|\?!|\?!|Y!|A!|Z!|=!|&|"
+    "L&|>)||3)|%|!~@)|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|[!|T!|Z!|="
+    "!|&|L&|S)||3)|%|!~U)|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|]!|F!|"
+    "Z!|=!|&|L&|(*||3)|%|!~**|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|_!"
+    "|O!|Z!|=!|&|L&|=*||3)|%|!~\?*|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|"
+    "S!|!\"|T!|Z!|=!|&|L&|R*||3)|%|!~T*|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H!|="
+    "!|I!|I!|#\"|J!|Z!|=!|&|L&|'+||3)|%|!~)+|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!"
+    "|S!|=!|T!|T!|%\"|U!|Z!|=!|&|L&|<+||3)|%|!~>+|&|P|Y|=!|!!|:!|=!|\?!|\?!|"
+    "=!|A!|H!|=!|I!|I!|'\"|J!|Z!|=!|&|L&|Q+||3)|%|!~S+|&|P|Y|=!|!!|:!|=!|\?!"
+    "|\?!|=!|A!|U!|=!|V!|V!|)\"|W!|Z!|=!|&|L&|&,||3)|%|!~(,|&|P|Y|=!|!!|:!|="
+    "!|\?!|\?!|=!|A!|D!|=!|E!|E!|+\"|F!|Z!|=!|&|'E|;,|S|3)|%|!~=,|$|P|Y|=!|!"
+    "!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|J,||3)|%|!~L,|&|P|Y|=!|!!|:!|=!|\?!|\?"
+    "!|=!|A!|M!|=!|N!|N!|/\"|O!|Z!|=!|&|L&|_,||3)|%|!~!-|&|P|Y|=!|!!|:!|=!|\?"
+    "!|\?!|=!|A!|E!|=!|F!|F!|1\"|G!|Z!|=!|&|L&|4-||3)|%|!~6-|&|P|Y|=!|!!|:!|"
+    "=!|\?!|\?!|=!|A!|K!|=!|L!|L!|3\"|M!|Z!|=!|&|L&|I-||3)|%|!~K-|&|P|Y|=!|!"
+    "!|:!|=!|\?!|\?!|=!|A!|H!|=!|I!|I!|5\"|J!|Z!|=!|&|L&|^-||3)|%|!~ .|&|P|Y"
+    "|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|C!|C!|7\"|D!|Z!|=!|&|L&|3.||3)|%|!~5.|"
+    "&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|9\"|U!|Z!|=!|&|L&|H.||3)|%|"
+    "!~J.|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|;\"|T!|Z!|=!|&|FA|].|R"
+    "|3)|%|!~_.|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|,/||3)|%|!~./|(|P"
+    "|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|\?\"|F!|T!|=!|U!|U!|S\"|V!|Z!|"
+    "=!|&|L&|G/||3)|%|!~I/|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|A\"|T"
+    "!|Z!|=!|&|L&|\\/||3)|%|!~^/|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|C!|C!"
+    "|C\"|D!|Z!|=!|&|L&|10||3)|%|!~30|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Q!|=!|"
+    "R!|R!|E\"|S!|Z!|=!|&|L&|F0||3)|%|!~H0|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H"
+    "!|=!|I!|I!|G\"|J!|Z!|=!|&|L&|[0||3)|%|!~]0|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!"
+    "|A!|O!|=!|P!|P!|I\"|Q!|Z!|=!|&|L&|01||3)|%|!~21|&|P|Y|=!|!!|:!|=!|\?!|\?"
+    "!|=!|A!|S!|=!|T!|T!|K\"|U!|Z!|=!|&|L&|E1||3)|%|!~G1|&|P|Y|=!|!!|:!|=!|\?"
+    "!|\?!|=!|A!|H!|=!|I!|I!|M\"|J!|Z!|=!|&|L&|Z1||3)|%|!~\\1|&|P|Y|=!|!!|:!"
+    "|=!|\?!|\?!|=!|A!|N!|=!|O!|O!|O\"|P!|Z!|=!|&|L&|/2||3)|%|!~12|&|P|Y|=!|"
+    "!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|Q\"|O!|Z!|=!|&|@_|D2|=|3)|%|!~F2|$|P"
+    "|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|S2||3)|%|!~U2|&|P|Y|=!|!!|:!|=!"
+    "|\?!|\?!|=!|A!|L!|=!|M!|M!|U\"|N!|Z!|=!|&|L&|(3||3)|%|!~*3|&|P|Y|=!|!!|"
+    ":!|=!|\?!|\?!|=!|A!|O!|=!|P!|P!|W\"|Q!|Z!|=!|&|L&|=3||3)|%|!~\?3|$|P|Y|"
+    "=!|!!|:!|=!|\?!|\?!|Y\"|A!|Z!|=!|&|L&|L3||3)|%|!~N3|&|P|Y|=!|!!|:!|=!|\?"
+    "!|\?!|=!|A!|R!|=!|S!|S!|[\"|T!|Z!|=!|&|L&|!4||3)|%|!~#4|&|P|Y|=!|!!|:!|"
+    "=!|\?!|\?!|=!|A!|S!|=!|T!|T!|]\"|U!|Z!|=!|&|L&|64||3)|%|!~84|%|P|Y|=!|!"
+    "!|:!|=!|\?!|\?!|=!|A!|A!|_\"|B!|Z!|=!|&|L&|H4||3)|%|!~J4|&|P|Y|=!|!!|:!"
+    "|=!|\?!|\?!|=!|A!|B!|=!|C!|C!|!#|D!|Z!|=!|&|L&|]4||3)|%|!~_4|&|P|Y|=!|!"
+    "!|:!|=!|\?!|\?!|=!|A!|J!|=!|K!|K!|##|L!|Z!|=!|&|L=\"|25|^|3)|%|!~45|$|P"
+    "|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|A5||3)|%|!~C5|(|P|Y|=!|!!|:!|=!"
+    "|\?!|\?!|=!|A!|L!|=!|M!|M!|'#|N!|Q!|=!|R!|R!|/#|S!|Z!|=!|&|L&|\\5||3)|%"
+    "|!~^5|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|O!|=!|P!|P!|)#|Q!|Z!|=!|&|L&|16||"
+    "3)|%|!~36|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|+#|U!|Z!|=!|&|L&|"
+    "F6||3)|%|!~H6|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|X!|=!|Y!|Y!|-#|Z!|Z!|=!|&"
+    "|VE!|[6|E|3)|%|!~]6|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|*7||3)|%"
+    "|!~,7|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Q!|=!|R!|R!|1#|S!|Z!|=!|&|L&|\?7|"
+    "|3)|%|!~A7|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|N!|=!|O!|O!|3#|P!|Z!|=!|&|L&"
+    "|T7||3)|%|!~V7|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Q!|=!|R!|R!|5#|S!|Z!|=!|"
+    "&|F/!|)8|;|3)|%|!~+8|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|88||3)|"
+    "%|!~:8|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|9#|B!|Z!|=!|&|L&|J8||3)|%|!~L"
+    "8|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|K!|=!|L!|L!|;#|M!|Z!|=!|&|L&|_8||3)|%"
+    "|!~!9|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|=#|T!|Z!|=!|&|L&|49||"
+    "3)|%|!~69|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|\?#|F!|Z!|=!|&|/_"
+    "\"|I9|\\|3)|%|!~K9|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|X9||3)|%|"
+    "!~Z9|(|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|F!|=!|G!|G!|C#|H!|M!|=!|N!|N!|M#|O"
+    "!|Z!|=!|&|L&|3:||3)|%|!~5:|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|"
+    "E#|O!|Z!|=!|&|L&|H:||3)|%|!~J:|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|N!|=!|O!"
+    "|O!|G#|P!|Z!|=!|&|L&|]:||3)|%|!~_:|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Q!|="
+    "!|R!|R!|I#|S!|Z!|=!|&|L&|2;||3)|%|!~4;|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|"
+    "D!|=!|E!|E!|K#|F!|Z!|=!|&|\\-!|G;|9|3)|%|!~I;|$|P|Y|=!|!!|:!|=!|\?!|\?!"
+    "|=!|A!|Z!|=!|&|L&|V;||3)|%|!~X;|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T"
+    "!|T!|O#|U!|Z!|=!|&|L&|+<||3)|%|!~-<|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|"
+    "=!|E!|E!|Q#|F!|Z!|=!|&|L&|@<||3)|%|!~B<|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!"
+    "|Q!|=!|R!|R!|S#|S!|Z!|=!|&|L&|U<||3)|%|!~W<|&|P|Y|=!|!!|:!|=!|\?!|\?!|="
+    "!|A!|M!|=!|N!|N!|U#|O!|Z!|=!|&|L&|*=||3)|%|!~,=|$|P|Y|=!|!!|:!|=!|\?!|\?"
+    "!|W#|A!|Z!|=!|&|L&|9=||3)|%|!~;=|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|K!|=!|"
+    "L!|L!|Y#|M!|Z!|=!|&|L&|N=||3)|%|!~P=|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!"
+    "|=!|E!|E!|[#|F!|Z!|=!|&|L&|#>||3)|%|!~%>|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A"
+    "!|W!|=!|X!|X!|]#|Y!|Z!|=!|&|L&|8>||3)|%|!~:>|&|P|Y|=!|!!|:!|=!|\?!|\?!|"
+    "=!|A!|D!|=!|E!|E!|_#|F!|Z!|=!|&|L&|M>||3)|%|!~O>|&|P|Y|=!|!!|:!|=!|\?!|"
+    "\?!|=!|A!|L!|=!|M!|M!|!$|N!|Z!|=!|&|L&|\"\?||3)|%|!~$\?|&|P|Y|=!|!!|:!|"
+    "=!|\?!|\?!|=!|A!|D!|=!|E!|E!|#$|F!|Z!|=!|&|L&|7\?||3)|%|!~9\?|&|P|Y|=!|"
+    "!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|%$|T!|Z!|=!|&|IQ|L\?|P|3)|%|!~N\?|$|"
+    "P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|[\?||3)|%|!~]\?|&|P|Y|=!|!!|:!"
+    "|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|)$|F!|Z!|=!|&|L&|0@||3)|%|!~2@|(|P|Y|=!|!"
+    "!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|+$|F!|X!|=!|Y!|Y!|E$|Z!|Z!|=!|&|L&|K@"
+    "||3)|%|!~M@|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|O!|=!|P!|P!|-$|Q!|Z!|=!|&|L"
+    "&| A||3)|%|!~\"A|$|P|Y|=!|!!|:!|=!|\?!|\?!|/$|A!|Z!|=!|&|L&|/A||3)|%|!~"
+    "1A|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|V!|=!|W!|W!|1$|X!|Z!|=!|&|L&|DA||3)|"
+    "%|!~FA|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|G!|=!|H!|H!|3$|I!|Z!|=!|&|L&|YA|"
+    "|3)|%|!~[A|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H!|=!|I!|I!|5$|J!|Z!|=!|&|L&"
+    "|.B||3)|%|!~0B|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|7$|U!|Z!|=!|"
+    "&|L&|CB||3)|%|!~EB|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|9$|F!|Z!"
+    "|=!|&|L&|XB||3)|%|!~ZB|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|;$|T"
+    "!|Z!|=!|&|L&|-C||3)|%|!~/C|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|O!|=!|P!|P!|"
+    "=$|Q!|Z!|=!|&|L&|BC||3)|%|!~DC|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|\?$|B"
+    "!|Z!|=!|&|L&|TC||3)|%|!~VC|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|C!|C!|"
+    "A$|D!|Z!|=!|&|L&|)D||3)|%|!~+D|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!"
+    "|E!|C$|F!|Z!|=!|&|1C|>D|O|3)|%|!~@D|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|"
+    "=!|&|L&|MD||3)|%|!~OD|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|V!|=!|W!|W!|G$|X!"
+    "|Z!|=!|&|L&|\"E||3)|%|!~$E|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|N!|=!|O!|O!|"
+    "I$|P!|Z!|=!|&|L&|7E||3)|%|!~9E|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Q!|=!|R!"
+    "|R!|K$|S!|Z!|=!|&|L&|LE||3)|%|!~NE|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|C!|="
+    "!|D!|D!|M$|E!|Z!|=!|&|L&|!F||3)|%|!~#F|$|P|Y|=!|!!|:!|=!|\?!|\?!|O$|A!|"
+    "Z!|=!|&|L&|0F||3)|%|!~2F|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|Q$"
+    "|U!|Z!|=!|&|L&|EF||3)|%|!~GF|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|S$|B!|Z"
+    "!|=!|&|L&|WF||3)|%|!~YF|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|=!|B!|B!|U$|"
+    "C!|Z!|=!|&|L&|,G||3)|%|!~.G|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|K!|=!|L!|L!"
+    "|W$|M!|Z!|=!|&|L&|AG||3)|%|!~CG|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E"
+    "!|E!|Y$|F!|Z!|=!|&|AJ|VG|N|3)|%|!~XG|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!"
+    "|=!|&|L&|%H||3)|%|!~'H|+|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|]$|B!|D!|=!|E"
+    "!|E!|9%|F!|H!|=!|I!|I!|C%|J!|N!|=!|O!|O!|W%|P!|Z!|=!|&|L&|IH||3)|%|!~KH"
+    "|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Y!|=!|Z!|Z!|_$|&|L&|[H||3)|%|!~]H|&|P|"
+    "Y|=!|!!|:!|=!|\?!|\?!|=!|A!|X!|=!|Y!|Y!|!%|Z!|Z!|=!|&|L&|0I||3)|%|!~2I|"
+    "$|P|Y|=!|!!|:!|=!|\?!|\?!|#%|A!|Z!|=!|&|L&|\?I||3)|%|!~AI|'|P|Y|=!|!!|:"
+    "!|=!|\?!|\?!|=!|A!|A!|%%|B!|R!|=!|S!|S!|+%|T!|Z!|=!|&|L&|WI||3)|%|!~YI|"
+    "&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|'%|T!|Z!|=!|&|L&|,J||3)|%|!"
+    "~.J|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|)%|U!|Z!|=!|&|=S|AJ|M|3"
+    ")|%|!~CJ|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|PJ||3)|%|!~RJ|&|P|Y"
+    "|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|C!|C!|-%|D!|Z!|=!|&|L&|%K||3)|%|!~'K|%"
+    "|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|/%|B!|Z!|=!|&|L&|7K||3)|%|!~9K|&|P|Y|"
+    "=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|1%|O!|Z!|=!|&|L&|LK||3)|%|!~NK|&|"
+    "P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|3%|O!|Z!|=!|&|L&|!L||3)|%|!~#"
+    "L|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|5%|F!|Z!|=!|&|L&|6L||3)|%"
+    "|!~8L|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Q!|=!|R!|R!|7%|S!|Z!|=!|&|!N|KL|Q"
+    "|3)|%|!~ML|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|ZL||3)|%|!~\\L|&|"
+    "P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|W!|=!|X!|X!|;%|Y!|Z!|=!|&|L&|/M||3)|%|!~1"
+    "M|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|=%|F!|Z!|=!|&|L&|DM||3)|%"
+    "|!~FM|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|L!|=!|M!|M!|\?%|N!|Z!|=!|&|L&|YM|"
+    "|3)|%|!~[M|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|A%|F!|Z!|=!|&|2,"
+    "!|.N|7|3)|%|!~0N|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|=N||3)|%|!~"
+    "\?N|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|E%|O!|Z!|=!|&|L&|RN||3)"
+    "|%|!~TN|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|G%|F!|Z!|=!|&|L&|'O"
+    "||3)|%|!~)O|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|I%|B!|Z!|=!|&|L&|9O||3)|"
+    "%|!~;O|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Q!|=!|R!|R!|K%|S!|Z!|=!|&|L&|NO|"
+    "|3)|%|!~PO|$|P|Y|=!|!!|:!|=!|\?!|\?!|M%|A!|Z!|=!|&|L&|]O||3)|%|!~_O|&|P"
+    "|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|O%|T!|Z!|=!|&|L&|2P||3)|%|!~4P"
+    "|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|C!|C!|Q%|D!|Z!|=!|&|L&|GP||3)|%|"
+    "!~IP|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|S%|B!|Z!|=!|&|L&|YP||3)|%|!~[P|"
+    "&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|U%|O!|Z!|=!|&|3L|.Q|L|3)|%|"
+    "!~0Q|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|=Q||3)|%|!~\?Q|&|P|Y|=!"
+    "|!!|:!|=!|\?!|\?!|=!|A!|N!|=!|O!|O!|Y%|P!|Z!|=!|&|L&|RQ||3)|%|!~TQ|&|P|"
+    "Y|=!|!!|:!|=!|\?!|\?!|=!|A!|J!|=!|K!|K!|[%|L!|Z!|=!|&|L&|'R||3)|%|!~)R|"
+    "%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|]%|B!|Z!|=!|&|L&|9R||3)|%|!~;R|&|P|Y"
+    "|=!|!!|:!|=!|\?!|\?!|=!|A!|G!|=!|H!|H!|_%|I!|Z!|=!|&|L&|NR||3)|%|!~PR|&"
+    "|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|!&|F!|Z!|=!|&|L&|#S||3)|%|!~"
+    "%S|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|#&|B!|Z!|=!|&|L&|5S||3)|%|!~7S|&|"
+    "P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|C!|=!|D!|D!|%&|E!|Z!|=!|&|L&|JS||3)|%|!~L"
+    "S|&|P|Y|=!|!!|:!|=!|\?!|\?!|'&|A!|R!|=!|S!|S!|5&|T!|Z!|=!|&|L&|_S||3)|%"
+    "|!~!T|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|L!|=!|M!|M!|)&|N!|Z!|=!|&|L&|4T||"
+    "3)|%|!~6T|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|+&|F!|Z!|=!|&|L&|"
+    "IT||3)|%|!~KT|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|-&|U!|Z!|=!|&"
+    "|L&|^T||3)|%|!~ U|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|G!|=!|H!|H!|/&|I!|Z!|"
+    "=!|&|L&|3U||3)|%|!~5U|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|N!|=!|O!|O!|1&|P!"
+    "|Z!|=!|&|L&|HU||3)|%|!~JU|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|C!|=!|D!|D!|3"
+    "&|E!|Z!|=!|&|[F|]U|K|3)|%|!~_U|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|"
+    "Y\?|,V|J|3)|%|!~.V|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|;V||3)|%|"
+    "!~=V|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H!|=!|I!|I!|9&|J!|Z!|=!|&|L&|PV||3"
+    ")|%|!~RV|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|;&|O!|Z!|=!|&|L&|%"
+    "W||3)|%|!~'W|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H!|=!|I!|I!|=&|J!|Z!|=!|&|"
+    "L&|:W||3)|%|!~<W|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|L!|=!|M!|M!|\?&|N!|Z!|"
+    "=!|&|L&|OW||3)|%|!~QW|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H!|=!|I!|I!|A&|J!"
+    "|Z!|=!|&|L&|$X||3)|%|!~&X|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Y!|=!|Z!|Z!|C"
+    "&|&|L&|6X||3)|%|!~8X|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|E&|F!|"
+    "Z!|=!|&|L&|KX||3)|%|!~MX|$|P|Y|=!|!!|:!|=!|\?!|\?!|G&|A!|Z!|=!|&|L&|ZX|"
+    "|3)|%|!~\\X|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|L!|=!|M!|M!|I&|N!|Z!|=!|&|L"
+    "&|/Y||3)|%|!~1Y|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|K&|F!|Z!|=!"
+    "|&|L&|DY||3)|%|!~FY|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|M&|U!|Z"
+    "!|=!|&|L&|YY||3)|%|!~[Y|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|G!|=!|H!|H!|O&|"
+    "I!|Z!|=!|&|L&|.Z||3)|%|!~0Z|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|N!|=!|O!|O!"
+    "|Q&|P!|Z!|=!|&|L&|CZ||3)|%|!~EZ|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|C!|=!|D"
+    "!|D!|S&|E!|Z!|=!|&|%U|XZ|I|3)|%|!~ZZ|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!"
+    "|=!|&|L&|'[||3)|%|!~)[|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|O!|=!|P!|P!|W&|Q"
+    "!|Z!|=!|&|L&|<[||3)|%|!~>[|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|"
+    "Y&|U!|Z!|=!|&|L&|Q[||3)|%|!~S[|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H!|=!|I!"
+    "|I!|[&|J!|Z!|=!|&|L&|&\\||3)|%|!~(\\|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|N!"
+    "|=!|O!|O!|]&|P!|Z!|=!|&|L&|;\\||3)|%|!~=\\|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!"
+    "|A!|M!|=!|N!|N!|_&|O!|Z!|=!|&|L&|P\\||3)|%|!~R\\|&|P|Y|=!|!!|:!|=!|\?!|"
+    "\?!|=!|A!|R!|=!|S!|S!|!'|T!|Z!|=!|&|2>|%]|#!|3)|%|!~']|$|P|Y|=!|!!|:!|="
+    "!|\?!|\?!|=!|A!|Z!|=!|&|L&|4]||3)|%|!~6]|(|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A"
+    "!|H!|=!|I!|I!|%'|J!|Q!|=!|R!|R!|C'|S!|Z!|=!|&|L&|O]||3)|%|!~Q]|&|P|Y|=!"
+    "|!!|:!|=!|\?!|\?!|=!|A!|O!|=!|P!|P!|''|Q!|Z!|=!|&|L&|$^||3)|%|!~&^|&|P|"
+    "Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|)'|F!|Z!|=!|&|L&|9^||3)|%|!~;^|"
+    "&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|K!|=!|L!|L!|+'|M!|Z!|=!|&|L&|N^||3)|%|!"
+    "~P^|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|H!|=!|I!|I!|-'|J!|Z!|=!|&|L&|#_||3)"
+    "|%|!~%_|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|/'|O!|Z!|=!|&|L&|8_"
+    "||3)|%|!~:_|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|1'|F!|Z!|=!|&|L"
+    "&|M_||3)|%|!~O_|$|P|Y|=!|!!|:!|=!|\?!|\?!|3'|A!|Z!|=!|&|L&|\\_||3)|%|!~"
+    "^_|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|=!|S!|S!|5'|T!|Z!|=!|&|L&|1 !||3)"
+    "|%|!~3 !|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|C!|C!|7'|D!|Z!|=!|&|L&|F"
+    " !||3)|%|!~H !|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|9'|B!|Z!|=!|&|L&|X !|"
+    "|3)|%|!~Z !|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|;'|O!|Z!|=!|&|L"
+    "&|-!!||3)|%|!~/!!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|='|O!|Z!|"
+    "=!|&|L&|B!!||3)|%|!~D!!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|\?'"
+    "|F!|Z!|=!|&|L&|W!!||3)|%|!~Y!!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Q!|=!|R!"
+    "|R!|A'|S!|Z!|=!|&|QO|,\"!|H|3)|%|!~.\"!|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!"
+    "|Z!|=!|&|L&|;\"!||3)|%|!~=\"!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|"
+    "E!|E'|F!|Z!|=!|&|L&|P\"!||3)|%|!~R\"!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|B"
+    "!|=!|C!|C!|G'|D!|Z!|=!|&|L&|%#!||3)|%|!~'#!|&|P|Y|=!|!!|:!|=!|\?!|\?!|="
+    "!|A!|D!|=!|E!|E!|I'|F!|Z!|=!|&|L&|:#!||3)|%|!~<#!|&|P|Y|=!|!!|:!|=!|\?!"
+    "|\?!|=!|A!|C!|=!|D!|D!|K'|E!|Z!|=!|&|L&|O#!||3)|%|!~Q#!|&|P|Y|=!|!!|:!|"
+    "=!|\?!|\?!|=!|A!|D!|=!|E!|E!|M'|F!|Z!|=!|&|L&|$$!||3)|%|!~&$!|&|P|Y|=!|"
+    "!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|O'|O!|Z!|=!|&|L&|9$!||3)|%|!~;$!|&|P"
+    "|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|C!|C!|Q'|D!|Z!|=!|&|L&|N$!||3)|%|!~P"
+    "$!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|S'|F!|Z!|=!|&|G(!|#%!|:|"
+    "3)|%|!~%%!|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|2%!||3)|%|!~4%!|("
+    "|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|W'|F!|T!|=!|U!|U!|_'|V!|Z!|="
+    "!|&|L&|M%!||3)|%|!~O%!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|F!|=!|G!|G!|Y'|H"
+    "!|Z!|=!|&|L&|\"&!||3)|%|!~$&!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|"
+    "E!|['|F!|Z!|=!|&|L&|7&!||3)|%|!~9&!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|W!|"
+    "=!|X!|X!|]'|Y!|Z!|=!|&|3!!|L&!|<|3)|%|!~N&!|$|P|Y|=!|!!|:!|=!|\?!|\?!|="
+    "!|A!|Z!|=!|&|L&|[&!||3)|%|!~]&!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|K!|=!|L"
+    "!|L!|!(|M!|Z!|=!|&|L&|0'!||3)|%|!~2'!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D"
+    "!|=!|E!|E!|#(|F!|Z!|=!|&|L&|E'!||3)|%|!~G'!|&|P|Y|=!|!!|:!|=!|\?!|\?!|="
+    "!|A!|R!|=!|S!|S!|%(|T!|Z!|=!|&|T3!|Z'!|*|3)|%|!~\\'!|$|P|Y|=!|!!|:!|=!|"
+    "\?!|\?!|=!|A!|Z!|=!|&|L&|)(!||3)|%|!~+(!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A"
+    "!|X!|=!|Y!|Y!|)(|Z!|Z!|=!|&|L&|>(!||3)|%|!~@(!|&|P|Y|=!|!!|:!|=!|\?!|\?"
+    "!|=!|A!|M!|=!|N!|N!|+(|O!|Z!|=!|&|L&|S(!||3)|%|!~U(!|&|P|Y|=!|!!|:!|=!|"
+    "\?!|\?!|=!|A!|B!|=!|C!|C!|-(|D!|Z!|=!|&|-1!|()!|>|3)|%|!~*)!|$|P|Y|=!|!"
+    "!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|7)!||3)|%|!~9)!|+|P|Y|=!|!!|:!|=!|\?!|"
+    "\?!|=!|A!|A!|1(|B!|D!|=!|E!|E!|G(|F!|N!|=!|O!|O!|U(|P!|Q!|=!|R!|R!|+)|S"
+    "!|Z!|=!|&|L&|[)!||3)|%|!~])!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|=!|B!|B"
+    "!|3(|C!|Z!|=!|&|L&|0*!||3)|%|!~2*!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|K!|="
+    "!|L!|L!|5(|M!|Z!|=!|&|L&|E*!||3)|%|!~G*!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A"
+    "!|D!|=!|E!|E!|7(|F!|Z!|=!|&|L&|Z*!||3)|%|!~\\*!|$|P|Y|=!|!!|:!|=!|\?!|\?"
+    "!|9(|A!|Z!|=!|&|L&|)+!||3)|%|!~++!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|R!|="
+    "!|S!|S!|;(|T!|Z!|=!|&|L&|>+!||3)|%|!~@+!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A"
+    "!|B!|=!|C!|C!|=(|D!|Z!|=!|&|L&|S+!||3)|%|!~U+!|&|P|Y|=!|!!|:!|=!|\?!|\?"
+    "!|=!|A!|G!|=!|H!|H!|\?(|I!|Z!|=!|&|L&|(,!||3)|%|!~*,!|&|P|Y|=!|!!|:!|=!"
+    "|\?!|\?!|=!|A!|D!|=!|E!|E!|A(|F!|Z!|=!|&|L&|=,!||3)|%|!~\?,!|&|P|Y|=!|!"
+    "!|:!|=!|\?!|\?!|=!|A!|L!|=!|M!|M!|C(|N!|Z!|=!|&|L&|R,!||3)|%|!~T,!|&|P|"
+    "Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|E(|F!|Z!|=!|&|RH|'-!|G|3)|%|!~)"
+    "-!|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|6-!||3)|%|!~8-!|&|P|Y|=!|"
+    "!!|:!|=!|\?!|\?!|=!|A!|L!|=!|M!|M!|I(|N!|Z!|=!|&|L&|K-!||3)|%|!~M-!|&|P"
+    "|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|O!|=!|P!|P!|K(|Q!|Z!|=!|&|L&| .!||3)|%|!~\""
+    ".!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|K!|=!|L!|L!|M(|M!|Z!|=!|&|L&|5.!||3)"
+    "|%|!~7.!|%|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|A!|O(|B!|Z!|=!|&|L&|G.!||3)|%|"
+    "!~I.!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|Q(|U!|Z!|=!|&|L&|\\.!"
+    "||3)|%|!~^.!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|S(|F!|Z!|=!|&|"
+    "P]|1/!|@|3)|%|!~3/!|$|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|@/!||3)|"
+    "%|!~B/!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|J!|=!|K!|K!|W(|L!|Z!|=!|&|L&|U/"
+    "!||3)|%|!~W/!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|D!|=!|E!|E!|Y(|F!|Z!|=!|&"
+    "|L&|*0!||3)|%|!~,0!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|M!|=!|N!|N!|[(|O!|Z"
+    "!|=!|&|L&|\?0!||3)|%|!~A0!|&|P|Y|=!|!!|:!|=!|\?!|\?!|](|A!|R!|=!|S!|S!|"
+    "))|T!|Z!|=!|&|L&|T0!||3)|%|!~V0!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|B!|=!|"
+    "C!|C!|_(|D!|Z!|=!|&|L&|)1!||3)|%|!~+1!|&|P|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|"
+    "N!|=!|O!|O!|!)|P!|Z!|=!|&|L&|>1!||3)|%|!~@1!|&|P|Y|=!|!!|:!|=!|\?!|\?!|"
+    "=!|A!|T!|=!|U!|U!|#)|V!|Z!|=!|&|L&|S1!||3)|%|!~U1!|&|P|Y|=!|!!|:!|=!|\?"
+    "!|\?!|=!|A!|M!|=!|N!|N!|%)|O!|Z!|=!|&|L&|(2!||3)|%|!~*2!|&|P|Y|=!|!!|:!"
+    "|=!|\?!|\?!|=!|A!|S!|=!|T!|T!|')|U!|Z!|=!|&|\"V\"|=2!|U|3)|%|!~\?2!|$|P"
+    "|Y|=!|!!|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|]W|L2!|F|3)|%|!~N2!|$|P|Y|=!|!!|:!"
+    "|=!|\?!|\?!|=!|A!|Z!|=!|&|L&|[2!||3)|%|!~]2!|&|P|Y|=!|!!|:!|=!|\?!|\?!|"
+    "=!|A!|T!|=!|U!|U!|-)|V!|Z!|=!|&|L&|03!||3)|%|!~23!|&|P|Y|=!|!!|:!|=!|\?"
+    "!|\?!|=!|A!|D!|=!|E!|E!|/)|F!|Z!|=!|&|#^\"|E3!|[|3)|%|!~G3!|$|P|Y|=!|!!"
+    "|:!|=!|\?!|\?!|=!|A!|Z!|=!|&|H<!|T3!|'|3)|%|!~V3!||'|!~W3!|9|!~W3!|'|'|"
+    "!|>|!~Z3!|7|O3|Z3!|&|!|'|$3|\\3!|9|$3|\\3!|'|'|!|>|$3|_3!|7|G4|_3!|&||'"
+    "|\\3|!4!|9|\\3|!4!|'|'|!|>|\\3|$4!|(|]+|$4!|!|>|]+|%4!|(|D0|%4!|\"|>|D0"
+    "|&4!|)|/9|&4!|\"|+|!:|'4!|$|-|6:|(4!||\"|#~0|8:|+4!|||!~K|!:|.4!|\"|$|#"
+    "|#|-|2:|24!||\"|#~3|1:|54!||+|]:|64!|$|-|1;|74!||\"|\"~0|3;|:4!|||!~K|]"
+    ":|=4!|\"|$|#|$|-|-;|A4!||\"|\"~3|,;|D4!||+|X;|E4!|$|-|+<|F4!||\"|!~0|-<"
+    "|I4!|||!~K|X;|L4!|\"|$|#|%|-|'<|P4!||\"|!~3|&<|S4!||K|/9|T4!|\"|\"|#|\""
+    "|-|=9|X4!||\"|!~3|<9|[4!||L|/9|\\4!|#|)|%\?|]4!|\"|-|6\?|^4!||\"|!~0|8\?"
+    "|!5!|||!~K|%\?|$5!|\"|\"|\"|#|L|%\?|(5!|\"|)|2>|)5!|\"|-|2>|*5!||\"|\"~"
+    "0|2>|-5!|||!~J|2>|05!||\"|!~K|2>|35!|\"|\"|\"|)\"|L|2>|75!|\"|)|T@|85!|"
+    "\"|J|%A|95!||\"|!~K|T@|<5!|\"|\"|#|&|L|T@|@5!|#|)|@B|A5!|\"|J|PB|B5!||\""
+    "|!~K|@B|E5!|\"|\"|#|(|L|@B|I5!|#|)|1D|J5!|\"|J|FD|K5!||\"|!~K|1D|N5!|\""
+    "|\"|#|)|L|1D|R5!|#|)|&F|S5!|\"|J|:F|T5!||\"|!~K|&F|W5!|\"|\"|#|*|L|&F|["
+    "5!|#|)|[G|\\5!|\"|J|1H|]5!||\"|!~K|[G| 6!|\"|\"|#|+|L|[G|$6!|#|)|NI|%6!"
+    "|\"|J| J|&6!||\"|!~K|NI|)6!|\"|\"|#|,|L|NI|-6!|#|)|\?K|.6!|\"|J|RK|/6!|"
+    "|\"|!~K|\?K|26!|\"|\"|#|-|L|\?K|66!|#|)|/M|76!|\"|J|@M|86!||\"|!~K|/M|;"
+    "6!|\"|\"|#|.|L|/M|\?6!|#|)|^N|@6!|\"|J|0O|A6!||\"|!~K|^N|D6!|\"|\"|#|/|"
+    "L|^N|H6!|#|)|RP|I6!|\"|J|(Q|J6!||\"|!~K|RP|M6!|\"|\"|#|0|L|RP|Q6!|#|)|H"
+    "R|R6!|\"|J|\\R|S6!||\"|!~K|HR|V6!|\"|\"|#|1|L|HR|Z6!|#|)|6T|[6!|\"|J|DT"
+    "|\\6!||\"|!~K|6T|_6!|\"|\"|#|2|L|6T|#7!|#|)|$V|$7!|\"|J|9V|%7!||\"|!~K|"
+    "$V|(7!|\"|\"|#|3|L|$V|,7!|#|)|NX|-7!|\"|-|^X|.7!||\"|!~0| Y|17!|||!~K|N"
+    "X|47!|\"|\"|\"|$|L|NX|87!|\"|)|]W|97!|\"|-|]W|:7!||\"|\"~0|]W|=7!|||!~J"
+    "|]W|@7!||\"|!~K|]W|C7!|\"|\"|\"|)\"|L|]W|G7!|\"|)|-Z|H7!|\"|J|DZ|I7!||\""
+    "|!~+|GZ|L7!|$|K|GZ|M7!|\"|$|!|5|K|-Z|Q7!|\"|\"|!|4|L|-Z|U7!|!|)|8\\|V7!"
+    "|\"|J|O\\|W7!||\"|#~+|R\\|Z7!|$|-|,]|[7!||\"|!~0|.]|^7!|||!~K|R\\|!8!|\""
+    "|$|#|5|-|(]|%8!||\"|!~3|']|(8!||K|8\\|)8!|\"|\"|#|4|L|8\\|-8!|#|)|J[|.8"
+    "!|\"|-|J[|/8!||\"|\"~0|J[|28!|||!~J|J[|58!||\"|!~K|J[|88!|\"|\"|\"|)\"|"
+    "L|J[|<8!|\"|)|K^|=8!|\"|J|_^|>8!||\"|!~K|K^|A8!|\"|\"|#|6|L|K^|E8!|#|)|"
+    "; !|F8!|\"|J|R !|G8!||\"|!~K|; !|J8!|\"|\"|#|7|L|; !|N8!|#|)|(\"!|O8!|\""
+    "|+|<\"!|P8!|$|+|L\"!|Q8!|%|K|L\"!|R8!|\"|%|#|!|4|V\"!|V8!|!~J|_\"!|W8!|"
+    "|\"|!~K|<\"!|Z8!|\"|$|#|9|K|(\"!|^8!|\"|\"|#|8|L|(\"!|\"9!|#|)|6$!|#9!|"
+    "\"|-|K$!|$9!||\"|!~0|M$!|'9!|||!~K|6$!|*9!|\"|\"|#|8|L|6$!|.9!|#|)|I#!|"
+    "/9!|\"|-|I#!|09!||\"|\"~0|I#!|39!|||!~J|I#!|69!||\"|!~K|I#!|99!|\"|\"|\""
+    "|)\"|L|I#!|=9!|\"|)|5&!|>9!|\"|J|F&!|\?9!||\"|$~J|J&!|B9!||\"|!~K|5&!|E"
+    "9!|\"|\"|%|9|L|5&!|I9!|%|)|B)!|J9!|\"|J|X)!|K9!||\"|!~K|B)!|N9!|\"|\"|#"
+    "|:|L|B)!|R9!|#|)|\?+!|S9!|\"|J|Q+!|T9!||\"|\"~K|\?+!|W9!|\"|\"|%|;|L|\?"
+    "+!|[9!|%|)|)-!|\\9!|\"|J|;-!|]9!||\"|!~K|)-!| :!|\"|\"|#|<|L|)-!|$:!|#|"
+    ")|S.!|%:!|\"|J|%/!|&:!||\"|!~K|S.!|):!|\"|\"|#|=|L|S.!|-:!|#|)|;0!|.:!|"
+    "\"|J|L0!|/:!||\"|!~K|;0!|2:!|\"|\"|#|>|L|;0!|6:!|#|)|\"2!|7:!|\"|J|22!|"
+    "8:!||\"|!~K|\"2!|;:!|\"|\"|#|\?|L|\"2!|\?:!|#|)|@4!|@:!|\"|-|O4!|A:!||\""
+    "|!~0|Q4!|D:!|||!~K|@4!|G:!|\"|\"|\"|%|L|@4!|K:!|\"|)|;3!|L:!|\"|-|;3!|M"
+    ":!||\"|\"~0|;3!|P:!|||!~J|;3!|S:!||\"|!~K|;3!|V:!|\"|\"|\"|)\"|L|;3!|Z:"
+    "!|\"|)|D6!|[:!|\"|J|S6!|\\:!||\"|$~J|W6!|_:!||\"|\"~-|[6!|\";!||\"|!~.|"
+    "[6!|%;!|||/|Z6!|';!||-|!7!|(;!||\"|!~.|!7!|+;!||!|/| 7!|-;!||K|D6!|.;!|"
+    "\"|\"|$|@|-|O6!|2;!||\"|#~3|N6!|5;!||L|D6!|6;!|$|)|K8!|7;!|\"|J|M8!|8;!"
+    "||\"|#~J|Q8!|;;!||\"|!~K|K8!|>;!|\"|\"|$|+\"|L|K8!|B;!|$|)|#:!|C;!|\"|J"
+    "|%:!|D;!||\"|!~+|(:!|G;!|$|K|(:!|H;!|\"|$|\"|!|4|2:!|L;!|!~K|#:!|M;!|\""
+    "|\"|\"|+\"|L|#:!|Q;!|\"|)|;;!|R;!|\"|+|<;!|S;!|$|K|<;!|T;!|\"|$||!|4|F;"
+    "!|X;!|!~+|N;!|Y;!|%|K|N;!|Z;!|\"|%||!|4|X;!|^;!|!~K|;;!|_;!|\"|\"||+\"|"
+    "L|;;!|#<!||)|9=!|$<!|\"|J|K=!|%<!||\"|\"~-|O=!|(<!||\"|!~0|Q=!|+<!|||!~"
+    "K|9=!|.<!|\"|\"|\"|A|L|9=!|2<!|\"|)|><!|3<!|\"|-|><!|4<!||\"|\"~0|><!|7"
+    "<!|||!~J|><!|:<!||\"|!~K|><!|=<!|\"|\"|\"|)\"|L|><!|A<!|\"|)|V<!|B<!|\""
+    "|J|W<!|C<!|!|\"|!~L|V<!|F<!|\"|)|!\?!|G<!|\"|-|/\?!|H<!||\"|!~0|1\?!|K<"
+    "!|||!~K|!\?!|N<!|\"|\"|!|B|L|!\?!|R<!|!|)|Y=!|S<!|\"|-|Y=!|T<!||\"|\"~0"
+    "|Y=!|W<!|||!~J|Y=!|Z<!|!|\"|!~K|Y=!|]<!|\"|\"|\"|)\"|L|Y=!|!=!|\"|)|@@!"
+    "|\"=!|\"|J|V@!|#=!||\"|\"~K|@@!|&=!|\"|\"|\"|D|-|R@!|*=!|!|\"|!~3|Q@!|-"
+    "=!|!|L|@@!|.=!|\"|)|%B!|/=!|\"|J|:B!|0=!||\"|\"~K|%B!|3=!|\"|\"|\"|E|-|"
+    "6B!|7=!|!|\"|!~3|5B!|:=!|!|L|%B!|;=!|\"|)|IC!|<=!|\"|J|\\C!|==!||\"|\"~"
+    "K|IC!|@=!|\"|\"|\"|C|-|XC!|D=!|!|\"|!~3|WC!|G=!|!|L|IC!|H=!|\"|)|;F!|I="
+    "!|\"|K|;F!|J=!|\"|\"|!|P|L|;F!|N=!|!|)|#H!|O=!|\"|J|/H!|P=!||\"|#~-|3H!"
+    "|S=!|!|\"|\"~.|3H!|V=!|!||/|2H!|X=!|!|-|9H!|Y=!||\"|\"~.|9H!|\\=!||!|/|"
+    "8H!|^=!||K|#H!|_=!|\"|\"|$|F|L|#H!|#>!|$|)|4J!|$>!|\"|J|MJ!|%>!||\"|$~J"
+    "|QJ!|(>!|!|\"|\"~+|TJ!|+>!|$|-|1K!|,>!||\"|!~0|3K!|/>!|||!~K|TJ!|2>!|\""
+    "|$|$|H|-|-K!|6>!|!|\"|!~3|,K!|9>!|!|K|4J!|:>!|\"|\"|$|G|-|IJ!|>>!||\"|#"
+    "~3|HJ!|A>!||L|4J!|B>!|$|)|7I!|C>!|\"|-|7I!|D>!||\"|\"~0|7I!|G>!|||!~J|7"
+    "I!|J>!|!|\"|!~K|7I!|M>!|\"|\"|\"|)\"|L|7I!|Q>!|\"|)|BL!|R>!|\"|J|[L!|S>"
+    "!||\"|\"~+|^L!|V>!|$|-|9M!|W>!|!|\"|!~0|;M!|Z>!|!||!~K|^L!|]>!|\"|$|\"|"
+    "L|-|5M!|!\?!||\"|!~3|4M!|$\?!||K|BL!|%\?!|\"|\"|\"|I|L|BL!|)\?!|\"|)|UK"
+    "!|*\?!|\"|-|UK!|+\?!||\"|\"~0|UK!|.\?!|||!~J|UK!|1\?!|!|\"|!~K|UK!|4\?!"
+    "|\"|\"|\"|)\"|L|UK!|8\?!|\"|)|\?N!|9\?!|\"|K|\?N!|:\?!|\"|\"|!|J|L|\?N!"
+    "|>\?!|!|)|RO!|\?\?!|\"|K|RO!|@\?!|\"|\"|!|K|L|RO!|D\?!|!|)|\?Q!|E\?!|\""
+    "|J|VQ!|F\?!||\"|\"~-|ZQ!|I\?!|!|\"|!~.|ZQ!|L\?!|!||/|YQ!|N\?!|!|-| R!|O"
+    "\?!||\"|!~.| R!|R\?!||!|/|_Q!|T\?!||K|\?Q!|U\?!|\"|\"|\"|M|L|\?Q!|Y\?!|"
+    "\"|)|3\\!|Z\?!|\"|-|C\\!|[\?!||\"|\"~0|E\\!|^\?!|||!~K|3\\!|!@!|\"|\"|#"
+    "|Q|L|3\\!|%@!|#|)|D[!|&@!|\"|J|F[!|'@!||\"|\"~-|J[!|*@!|!|\"|!~0|L[!|-@"
+    "!|!||!~K|D[!|0@!|\"|\"|\"|,\"|L|D[!|4@!|\"|)|#[!|5@!|\"|-|#[!|6@!||\"|\""
+    "~0|#[!|9@!|||!~J|#[!|<@!|!|\"|!~K|#[!|\?@!|\"|\"|\"|)\"|L|#[!|C@!|\"|)|"
+    "L^!|D@!|\"|J|[^!|E@!||\"|#~J|_^!|H@!|!|\"|!~K|L^!|K@!|\"|\"|$|S|L|L^!|O"
+    "@!|$|)|. \"|P@!|\"|J|= \"|Q@!||\"|!~+|@ \"|T@!|$|K|@ \"|U@!|\"|$|\"|!|4"
+    "|J \"|Y@!|!~K|. \"|Z@!|\"|\"|\"|S|L|. \"|^@!|\"|)|^!\"|_@!|\"|+|,\"\"| "
+    "A!|$|K|,\"\"|!A!|\"|$|\"|!|4|6\"\"|%A!|!~J|\?\"\"|&A!||\"|!~K|^!\"|)A!|"
+    "\"|\"|\"|S|L|^!\"|-A!|\"|)|H#\"|.A!|\"|K|H#\"|/A!|\"|\"|!|\"!|-|Y#\"|3A"
+    "!||\"|!~5|X#\"|6A!||L|H#\"|7A!|!|)|(%\"|8A!|\"|J|6%\"|9A!||\"|!~K|(%\"|"
+    "<A!|\"|\"|\"|T|L|(%\"|@A!|\"|)|E&\"|AA!|\"|J|W&\"|BA!||\"|!~K|E&\"|EA!|"
+    "\"|\"|\"|U|L|E&\"|IA!|\"|)|%(\"|JA!|\"|J|=(\"|KA!||\"|!~K|%(\"|NA!|\"|\""
+    "|\"|V|L|%(\"|RA!|\"|)|L)\"|SA!|\"|J|\\)\"|TA!||\"|!~K|L)\"|WA!|\"|\"|\""
+    "|W|L|L)\"|[A!|\"|)|*+\"|\\A!|\"|J|@+\"|]A!||\"|!~K|*+\"| B!|\"|\"|\"|X|"
+    "L|*+\"|$B!|\"|)|R-\"|%B!|\"|J|_-\"|&B!||\"|\"~-|#.\"|)B!|!|\"|!~0|%.\"|"
+    ",B!|!||!~K|R-\"|/B!|\"|\"|\"|Z|L|R-\"|3B!|\"|)|I,\"|4B!|\"|-|I,\"|5B!||"
+    "\"|\"~0|I,\"|8B!|||!~J|I,\"|;B!|!|\"|!~K|I,\"|>B!|\"|\"|\"|)\"|L|I,\"|B"
+    "B!|\"|)|N/\"|CB!|\"|J|]/\"|DB!||\"|#~J|!0\"|GB!|!|\"|!~K|N/\"|JB!|\"|\""
+    "|#|[|L|N/\"|NB!|#|)|R1\"|OB!|\"|K|R1\"|PB!|\"|\"||#!|6|_1\"|TB!||L|R1\""
+    "|UB!||)|S3\"|VB!|\"|K|S3\"|WB!|\"|\"||$!|6|(4\"|[B!||L|S3\"|\\B!||)|75\""
+    "|]B!|\"|K|75\"|^B!|\"|\"|\"|$!|-|M5\"|\"C!||\"|!~5|L5\"|%C!||L|75\"|&C!"
+    "|\"|)|U6\"|'C!|\"|K|U6\"|(C!|\"|\"|!|#!|-|#7\"|,C!||\"|!~5|\"7\"|/C!||L"
+    "|U6\"|0C!|!|)|=8\"|1C!|\"|J|>8\"|2C!|!|\"|\"~L|=8\"|5C!|#|)|Q:\"|6C!|\""
+    "|-|+;\"|7C!||\"|!~0|-;\"|:C!|||!~K|Q:\"|=C!|\"|\"|!|W!|L|Q:\"|AC!|!|)|J"
+    "9\"|BC!|\"|-|J9\"|CC!||\"|\"~0|J9\"|FC!|||!~J|J9\"|IC!|!|\"|!~K|J9\"|LC"
+    "!|\"|\"|\"|)\"|L|J9\"|PC!|\"|)|P<\"|QC!|\"|J|'=\"|RC!||\"|$~J|+=\"|UC!|"
+    "!|\"|\"~K|P<\"|XC!|\"|\"|$|X!|-|#=\"|\\C!||\"|#~3|\"=\"|_C!||L|P<\"| D!"
+    "|$|)|:>\"|!D!|\"|K|:>\"|\"D!|\"|\"|\"|'\"|L|:>\"|&D!|\"|)|L\?\"|'D!|\"|"
+    "J|[\?\"|(D!||\"|#~J|_\?\"|+D!|!|\"|\"~K|L\?\"|.D!|\"|\"|#|%\"|L|L\?\"|2"
+    "D!|#|)|^@\"|3D!|\"|J|.A\"|4D!||\"|#~J|2A\"|7D!|!|\"|\"~K|^@\"|:D!|\"|\""
+    "|#|$\"|L|^@\"|>D!|#|)|1B\"|\?D!|\"|J|CB\"|@D!||\"|#~J|GB\"|CD!|!|\"|\"~"
+    "K|1B\"|FD!|\"|\"|#|Y!|L|1B\"|JD!|#|)|FC\"|KD!|\"|J|[C\"|LD!||\"|#~J|_C\""
+    "|OD!|!|\"|\"~K|FC\"|RD!|\"|\"|#|Z!|L|FC\"|VD!|#|)|^D\"|WD!|\"|J|3E\"|XD"
+    "!||\"|#~J|7E\"|[D!|!|\"|\"~K|^D\"|^D!|\"|\"|#|[!|L|^D\"|\"E!|#|)|6F\"|#"
+    "E!|\"|J|LF\"|$E!||\"|#~J|PF\"|'E!|!|\"|\"~K|6F\"|*E!|\"|\"|#|\\!|L|6F\""
+    "|.E!|#|)|OG\"|/E!|\"|J|'H\"|0E!||\"|#~J|+H\"|3E!|!|\"|\"~K|OG\"|6E!|\"|"
+    "\"|#|]!|L|OG\"|:E!|#|)|*I\"|;E!|\"|J|CI\"|<E!||\"|#~J|GI\"|\?E!|!|\"|\""
+    "~K|*I\"|BE!|\"|\"|#|^!|L|*I\"|FE!|#|)|FJ\"|GE!|\"|J|VJ\"|HE!||\"|#~J|ZJ"
+    "\"|KE!|!|\"|\"~K|FJ\"|NE!|\"|\"|#|_!|L|FJ\"|RE!|#|)|YK\"|SE!|\"|J|.L\"|"
+    "TE!||\"|#~J|2L\"|WE!|!|\"|\"~K|YK\"|ZE!|\"|\"|#| \"|L|YK\"|^E!|#|)|1M\""
+    "|_E!|\"|J|FM\"| F!||\"|#~J|JM\"|#F!|!|\"|\"~K|1M\"|&F!|\"|\"|#|!\"|L|1M"
+    "\"|*F!|#|)|IN\"|+F!|\"|J|\\N\"|,F!||\"|#~J| O\"|/F!|!|\"|\"~K|IN\"|2F!|"
+    "\"|\"|#|\"\"|L|IN\"|6F!|#|)|1P\"|7F!|\"|J|HP\"|8F!||\"|!~K|1P\"|;F!|\"|"
+    "\"|\"|#\"|L|1P\"|\?F!|\"|)|YQ\"|@F!|\"|J|)R\"|AF!||\"|!~K|YQ\"|DF!|\"|\""
+    "|\"|&\"|L|YQ\"|HF!|\"|)|MV\"|IF!|\"|K|MV\"|JF!|\"|\"|!|(\"|L|MV\"|NF!|!"
+    "|)|(Y\"|OF!|\"|K|(Y\"|PF!|\"|\"|!|%!|-|5Y\"|TF!||\"|!~5|4Y\"|WF!||L|(Y\""
+    "|XF!|!|)|G^\"|YF!|\"|K|G^\"|ZF!|\"|\"|!|'!|L|G^\"|^F!|!|)|T_\"|_F!|\"|K"
+    "|T_\"| G!|\"|\"|!|(!|L|T_\"|$G!|!|)|=\"#|%G!|\"|K|=\"#|&G!|\"|\"|!|&!|-"
+    "|P\"#|*G!||\"|!~5|O\"#|-G!||L|=\"#|.G!|!|}L|(|}M||0|!|1||Temp$0||Temp$1"
+    "||Temp$2||Temp$3||in_guard||token_count|}N|\"|}O|#|}P|1|Missing closing"
+    " quote on string literal|Missing closing quote on triple quoted string "
+    "literal|}R||}S||}T|}U||}V||}W|}X|@|}Y|!|}Z||}[| $|}\\||||||||||!|\"|!|!"
+    "|!|||||||||||||||||||!|#|$||%|&|'|(|)|*|+|,|-|.|/|0|1|1|1|1|1|1|1|1|1|1"
+    "|2|3|4|5|6|7|8|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|9|:|;|"
+    "<|=|>||\?|@|A|B|C|D|E|F|G|9|H|I|J|K|L|M|9|N|O|P|Q|R|S|T|U|V||W|||||||||"
+    "|||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||"
+    "||||||||||||||||||||||||||||||||||||||||||||||||||||}]|!|}^| $|}_||} !|"
+    "!~!~!~*\"|!~*\"|!~!~)\"|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~)\"|!~!~!~)\"|!~!"
+    "~!~!~!~)\"|!~_|!~!~!~!~!~!~!~!~*\"|!~)\"|!~!~!~!~!~!~!~)\"|!~!~)\"|!~!~"
+    "!~!~!~!~!~!~!~)\"|!~!~)\"|!~!~!~!~!~N|O|!~!~!|!~!~!~!~!~!~*\"|)\"|*\"|!"
+    "~!~!~!~!~!~!~!~!~!~!~!~!~!~)\"|!~!~!~!~!~!~!~!~!~!~)\"|!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~}!!||}\"!||||||||"
+    "|||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||"
+    "||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||}#!||}$"
+    "!||}Q|}"
 };
 
 static const char* regex_str =
 {
-    "|!|}!|'$'| \"|'('|!\"|')'|\"\"|'*'|#\"|'+'|$\"|'.'|%\"|'?'|&\"|'\\\\$'|"
-    "'\"|'\\\\('|(\"|'\\\\)'|)\"|'\\\\*'|*\"|'\\\\+'|+\"|'\\\\.'|,\"|'\\\\?'"
-    "|-\"|'\\\\D'|.\"|'\\\\S'|/\"|'\\\\['|0\"|'\\\\\\\\'|1\"|'\\\\]'|2\"|'\\"
-    "\\b'|3\"|'\\\\d'|4\"|'\\\\n'|5\"|'\\\\r'|6\"|'\\\\s'|7\"|'\\\\{'+'|8\"|"
-    "'\\\\{','|9\"|'\\\\{'-'|:\"|'{','|;\"|*eof*|<\"|*epsilon*|=\"|*error*|>"
-    "\"|<char>|?\"|<charset>|@\"|<macro>|A\"|<whitespace>|B\"|AstActionAdd|U"
-    "!|AstActionAnd|Z!|AstActionAssign|N!|AstActionDivide|X!|AstActionDumpSt"
-    "ack|]!|AstActionEqual|O!|AstActionGreaterEqual|T!|AstActionGreaterThan|"
-    "S!|AstActionLessEqual|R!|AstActionLessThan|Q!|AstActionMultiply|W!|AstA"
-    "ctionNot|\\!|AstActionNotEqual|P!|AstActionOr|[!|AstActionStatementList"
-    "|M!|AstActionSubtract|V!|AstActionTokenCount|^!|AstActionUnaryMinus|Y!|"
-    "AstAstChild|I|AstAstDot|P|AstAstFormer|G|AstAstItemList|H|AstAstKind|J|"
-    "AstAstLexeme|M|AstAstLexemeString|N|AstAstLocation|K|AstAstLocationStri"
-    "ng|L|AstAstLocator|O|AstAstSlice|Q|AstCaseSensitive|*|AstCharset|<!|Ast"
-    "CharsetAltNewline|E!|AstCharsetCaret|H!|AstCharsetChar|?!|AstCharsetCr|"
-    "G!|AstCharsetDash|I!|AstCharsetDigits|B!|AstCharsetDollar|J!|AstCharset"
-    "Escape|D!|AstCharsetInvert|=!|AstCharsetLeftBracket|K!|AstCharsetNewlin"
-    "e|F!|AstCharsetNotDigits|C!|AstCharsetNotWhitespace|A!|AstCharsetRange|"
-    ">!|AstCharsetRightBracket|L!|AstCharsetString|V|AstCharsetWhitespace|@!"
-    "|AstConflicts|(|AstEmpty|F|AstErrorRecovery|'|AstFalse|^|AstGrammar|\"|"
-    "AstGroup|<|AstIdentifier|X|AstInteger|Y|AstKeepWhitespace|)|AstLookahea"
-    "ds|&|AstMacroString|W|AstNegativeInteger|Z|AstNonterminalReference|E|As"
-    "tNull|!|AstOneClosure|;|AstOptionList|#|AstOptional|9|AstOptions|S|AstR"
-    "educeActions|T|AstRegex|_|AstRegexAltNewline|,!|AstRegexChar|%!|AstRege"
-    "xCr|.!|AstRegexDigits|)!|AstRegexDollar|4!|AstRegexEscape|+!|AstRegexLe"
-    "ftBrace|:!|AstRegexLeftBracket|8!|AstRegexLeftParen|6!|AstRegexList|!!|"
-    "AstRegexNewline|-!|AstRegexNotDigits|*!|AstRegexNotWhitespace|(!|AstReg"
-    "exOneClosure|$!|AstRegexOptional|\"!|AstRegexOr| !|AstRegexPeriod|3!|As"
-    "tRegexPlus|1!|AstRegexQuestion|2!|AstRegexRightBrace|;!|AstRegexRightBr"
-    "acket|9!|AstRegexRightParen|7!|AstRegexSpace|5!|AstRegexStar|0!|AstRege"
-    "xString|U|AstRegexVBar|/!|AstRegexWhitespace|'!|AstRegexWildcard|&!|Ast"
-    "RegexZeroClosure|#!|AstRule|6|AstRuleLeftAssoc|@|AstRuleList|%|AstRuleO"
-    "peratorList|B|AstRuleOperatorSpec|C|AstRulePrecedence|=|AstRulePreceden"
-    "ceList|>|AstRulePrecedenceSpec|?|AstRuleRhs|8|AstRuleRhsList|7|AstRuleR"
-    "ightAssoc|A|AstString|[|AstTerminalReference|D|AstToken|R|AstTokenActio"
-    "n|2|AstTokenDeclaration|+|AstTokenDescription|.|AstTokenError|5|AstToke"
-    "nIgnore|4|AstTokenLexeme|3|AstTokenList|$|AstTokenOptionList|,|AstToken"
-    "Precedence|1|AstTokenRegex|0|AstTokenRegexList|/|AstTokenTemplate|-|Ast"
-    "TripleString|\\|AstTrue|]|AstUnknown||AstZeroClosure|:|Unknown|_!|}\"|/"
-    "/{ -{ *//  Regular Expression Grammar{ -{ *//  ------------------------"
-    "--{ -{ *//{ -{ *//  Grammar file for the scanner regular expressions.{ "
-    "-{ *//{ -{ *{ -{ *options{ -{ *{ -{ *    lookaheads = 2{ -{ *    confli"
-    "cts = 0{ -{ *    case_sensitive = true{ -{ *{ -{ *tokens{ -{ *{ -{ *   "
-    " <whitespace>         : regex = ''' \\s+ '''{ -{ *                     "
-    "      ignore = true{ -{ *{ -{ *    <macro>              : regex = ''' \\"
-    "{'+ [^{'-]* \\{'- '''{ -{ *        { -{ *    <charset>            : reg"
-    "ex = ''' \\[ ( [^\\]] {', \\\\ \\] )* \\] '''{ -{ *        { -{ *    <c"
-    "har>               : regex = ''' [^?+*()\\[\\]{'+{'-{',.\\$\\s] '''{ -{"
-    " *        { -{ *rules       { -{ *        { -{ *    Regex              "
-    "  ::= RegexOr{ -{ *                         :   (AstRegex, $1){ -{ *{ -"
-    "{ *    RegexOr              ::= RegexOrTerm ( '{',' RegexOrTerm : $2 )+"
-    "{ -{ *                         :   (AstRegexOr, $1, $2._){ -{ *        "
-    "{ -{ *    RegexOr              ::= RegexOrTerm{ -{ *        { -{ *    R"
-    "egexOrTerm          ::= RegexUnopTerm+{ -{ *                         : "
-    "  (AstRegexList, $1._){ -{ *        { -{ *    RegexUnopTerm        ::= "
-    "RegexUnopTerm '*'{ -{ *                         :   (AstRegexZeroClosur"
-    "e, $1){ -{ *        { -{ *    RegexUnopTerm        ::= RegexUnopTerm '+"
-    "'{ -{ *                         :   (AstRegexOneClosure, $1){ -{ *     "
-    "   { -{ *    RegexUnopTerm        ::= RegexUnopTerm '?'{ -{ *          "
-    "               :   (AstRegexOptional, $1){ -{ *        { -{ *    RegexU"
-    "nopTerm        ::= '(' RegexOr ')'{ -{ *                         :   $2"
-    "{ -{ *        { -{ *    RegexUnopTerm        ::= <macro>{ -{ *         "
-    "                :   (AstMacroString, &1){ -{ *        { -{ *    RegexUn"
-    "opTerm        ::= Charset{ -{ *        { -{ *    RegexUnopTerm        :"
-    ":= Char{ -{ *        { -{ *    Charset              ::= <charset>{ -{ *"
-    "                         :   (AstCharsetString, &1) { -{ *{ -{ *    Cha"
-    "rset              ::= '.' { -{ *                         :   (AstRegexW"
-    "ildcard){ -{ *{ -{ *    Charset              ::= '\\\\s' { -{ *        "
-    "                 :   (AstRegexWhitespace){ -{ *{ -{ *    Charset       "
-    "       ::= '\\\\S' { -{ *                         :   (AstRegexNotWhite"
-    "space){ -{ *{ -{ *    Charset              ::= '\\\\d' { -{ *          "
-    "               :   (AstRegexDigits){ -{ *{ -{ *    Charset             "
-    " ::= '\\\\D' { -{ *                         :   (AstRegexNotDigits){ -{"
-    " *{ -{ *    Char                 ::= <char>{ -{ *                      "
-    "   :   (AstRegexChar, &1){ -{ *{ -{ *    Char                 ::= '\\\\"
-    "\\\\' { -{ *                         :   (AstRegexEscape){ -{ *{ -{ *  "
-    "  Char                 ::= '$' { -{ *                         :   (AstR"
-    "egexAltNewline){ -{ *{ -{ *    Char                 ::= '\\\\n' { -{ * "
-    "                        :   (AstRegexNewline){ -{ *{ -{ *    Char      "
-    "           ::= '\\\\r' { -{ *                         :   (AstRegexCr){"
-    " -{ *{ -{ *    Char                 ::= '\\\\{',' { -{ *               "
-    "          :   (AstRegexVBar){ -{ *{ -{ *    Char                 ::= '\\"
-    "\\*' { -{ *                         :   (AstRegexStar){ -{ *{ -{ *    C"
-    "har                 ::= '\\\\+' { -{ *                         :   (Ast"
-    "RegexPlus){ -{ *{ -{ *    Char                 ::= '\\\\?' { -{ *      "
-    "                   :   (AstRegexQuestion){ -{ *{ -{ *    Char          "
-    "       ::= '\\\\.' { -{ *                         :   (AstRegexPeriod){"
-    " -{ *{ -{ *    Char                 ::= '\\\\$' { -{ *                 "
-    "        :   (AstRegexDollar){ -{ *{ -{ *    Char                 ::= '\\"
-    "\\b' { -{ *                         :   (AstRegexSpace){ -{ *{ -{ *    "
-    "Char                 ::= '\\\\(' { -{ *                         :   (As"
-    "tRegexLeftParen){ -{ *{ -{ *    Char                 ::= '\\\\)' { -{ *"
-    "                         :   (AstRegexRightParen){ -{ *{ -{ *    Char  "
-    "               ::= '\\\\[' { -{ *                         :   (AstRegex"
-    "LeftBracket){ -{ *{ -{ *    Char                 ::= '\\\\]' { -{ *    "
-    "                     :   (AstRegexRightBracket){ -{ *{ -{ *    Char    "
-    "             ::= '\\\\{'+' { -{ *                         :   (AstRegex"
-    "LeftBrace){ -{ *{ -{ *    Char                 ::= '\\\\{'-' { -{ *    "
-    "                     :   (AstRegexRightBrace){ -{ *{ -{ *|}#|\"|}$|!|}%"
-    "|I|}&||}'|M|}(|*eof*|')'|'{','|'$'|'('|<charset>|<macro>|'.'|'\\\\$'|'\\"
-    "\\('|'\\\\)'|'\\\\*'|'\\\\+'|'\\\\.'|'\\\\?'|'\\\\D'|'\\\\S'|'\\\\['|'\\"
-    "\\]'|'\\\\b'|'\\\\d'|'\\\\n'|'\\\\\\\\'|'\\\\s'|'\\\\{'+'|'\\\\{','|'\\"
-    "\\{'-'|'\\\\r'|<char>|'*'|'+'|'?'||||||||||*error*||*epsilon*|<whitespa"
-    "ce>|})|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|"
-    "@|X!|'!|||||| !|!|(!|!||}*|<\"|\"\"|;\"| \"|!\"|@\"|A\"|%\"|'\"|(\"|)\""
-    "|*\"|+\"|,\"|-\"|.\"|/\"|0\"|2\"|3\"|4\"|5\"|1\"|7\"|8\"|9\"|:\"|6\"|?\""
-    "|#\"|$\"|&\"|P$EA||||||P#EA|||>\"|08GB|=\"|B\"|}+||||||!|!|||||||||||||"
-    "|||||||||!|||| \"|)!|]||||||!||||!|},|I|}-|!|!|\"|\"|\"|!|!|!|\"|!|\"|\""
-    "|\"|#|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|}.|J|H|G|F|"
-    "C|F|G|D|E|E|B|B|B|B|B|B|B|A|A|A|A|A|A|@|@|@|@|@|@|@|@|@|@|@|@|@|@|@|@|@"
-    "|@|}/|*accept* ::= Regex|Regex ::= RegexOr|RegexOr ::= RegexOrTerm Rege"
-    "xOr:1|RegexOr:1 ::= RegexOr:1 RegexOr:2|RegexOr:2 ::= '{',' RegexOrTerm"
-    "|RegexOr:1 ::= RegexOr:2|RegexOr ::= RegexOrTerm|RegexOrTerm ::= RegexO"
-    "rTerm:1|RegexOrTerm:1 ::= RegexOrTerm:1 RegexUnopTerm|RegexOrTerm:1 ::="
-    " RegexUnopTerm|RegexUnopTerm ::= RegexUnopTerm '*'|RegexUnopTerm ::= Re"
-    "gexUnopTerm '+'|RegexUnopTerm ::= RegexUnopTerm '?'|RegexUnopTerm ::= '"
-    "(' RegexOr ')'|RegexUnopTerm ::= <macro>|RegexUnopTerm ::= Charset|Rege"
-    "xUnopTerm ::= Char|Charset ::= <charset>|Charset ::= '.'|Charset ::= '\\"
-    "\\s'|Charset ::= '\\\\S'|Charset ::= '\\\\d'|Charset ::= '\\\\D'|Char :"
-    ":= <char>|Char ::= '\\\\\\\\'|Char ::= '$'|Char ::= '\\\\n'|Char ::= '\\"
-    "\\r'|Char ::= '\\\\{','|Char ::= '\\\\*'|Char ::= '\\\\+'|Char ::= '\\\\"
-    "?'|Char ::= '\\\\.'|Char ::= '\\\\$'|Char ::= '\\\\b'|Char ::= '\\\\('|"
-    "Char ::= '\\\\)'|Char ::= '\\\\['|Char ::= '\\\\]'|Char ::= '\\\\{'+'|C"
-    "har ::= '\\\\{'-'|}0|!~.!|6!|@!|J!|O!|!~W!|_!|)\"|1\"|9\"|A\"|I\"|N\"|!"
-    "~!~V\"|^\"|$#|*#|0#|6#|<#|D#|J#|P#|V#|\\#|\"$|($|.$|4$|:$|@$|F$|L$|R$|X"
-    "$|^$|$%|}1|\"|}2||}3|M|}4|R|}5|F|/!|O!|/\"|)!|,!|Q3|/$|R$|/%|W%|7&|O#|W"
-    "&|7'|W'|7(|W(|7)|W)|7*|W*|7+|W+|7,|W,|7-|W-|7.|W.|7/|W/|70|W0|^3|L$|43|"
-    "71|W1|72|W2|Q%|#!|!4|/#||$4|L%|Z3|O\"|}6|R4|}7| %|!!@%|\"!@$|#!0\"|$!(!"
-    "|%!0|&!(|'!@!|(!0#|)!@#|*!H#|+!P\"|,!X\"|-!(#|.! #|/! \"|0!P!|1!P#|2!X#"
-    "|3!8#|4!X!|5!8\"|6!(\"|7!H!|8! $|9!H\"|:!($|;!@\"|<!8|=!P$|>!X$|?! %|@#"
-    "8!|A#0!|B#(&|C#X%|D# &|E#X|F#0$|G#P%|H#@|#!0\"|$!(!|%!0|&!(|'!@!|(!0#|)"
-    "!@#|*!H#|+!P\"|,!X\"|-!(#|.! #|/! \"|0!P!|1!P#|2!X#|3!8#|4!X!|5!8\"|6!("
-    "\"|7!H!|8! $|9!H\"|:!($|;!@\"|<!8| : H%|!: @%|\": @$|@#8!|A#0!|B# !| %|"
-    "D#P|E#X| * H%|G#H|H#@| R!H%|!R!@%|\"R!@$|#R!0\"|$R!(!|%R!0|&R!(|'R!@!|("
-    "R!0#|)R!@#|*R!H#|+R!P\"|,R!X\"|-R!(#|.R! #|/R! \"|0R!P!|1R!P#|2R!X#|3R!"
-    "8#|4R!X!|5R!8\"|6R!(\"|7R!H!|8R! $|9R!H\"|:R!($|;R!@\"|<R!8|=R!P$|>R!X$"
-    "|?R! %| *\"H%|!*\"@%|\"*\"@$|#*\"0\"|$*\"(!|%*\"0|&*\"(|'*\"@!|(*\"0#|)"
-    "*\"@#|**\"H#|+*\"P\"|,*\"X\"|-*\"(#|.*\" #|/*\" \"|0*\"P!|1*\"P#|2*\"X#"
-    "|3*\"8#|4*\"X!|5*\"8\"|6*\"(\"|7*\"H!|8*\" $|9*\"H\"|:*\"($|;*\"@\"|<*\""
-    "8|=*\"P$|>*\"X$|?*\" %| Z\"H%|!Z\"@%|\"Z\"@$|#Z\"0\"|$Z\"(!|%Z\"0|&Z\"("
-    "|'Z\"@!|(Z\"0#|)Z\"@#|*Z\"H#|+Z\"P\"|,Z\"X\"|-Z\"(#|.Z\" #|/Z\" \"|0Z\""
-    "P!|1Z\"P#|2Z\"X#|3Z\"8#|4Z\"X!|5Z\"8\"|6Z\"(\"|7Z\"H!|8Z\" $|9Z\"H\"|:Z"
-    "\"($|;Z\"@\"|<Z\"8|=Z\"P$|>Z\"X$|?Z\" %| $H%|!$@%|\"$@$|#$0\"|$$(!|%$0|"
-    "&$(|'$@!|($0#|)$@#|*$H#|+$P\"|,$X\"|-$(#|.$ #|/$ \"|0$P!|1$P#|2$X#|3$8#"
-    "|4$X!|5$8\"|6$(\"|7$H!|8$ $|9$H\"|:$($|;$@\"|<$8|=!P$|>!X$|?! %| J!H%|!"
-    "J!@%|\"J!@$|#J!0\"|$J!(!|%J!0|&J!(|'J!@!|(J!0#|)J!@#|*J!H#|+J!P\"|,J!X\""
-    "|-J!(#|.J! #|/J! \"|0J!P!|1J!P#|2J!X#|3J!8#|4J!X!|5J!8\"|6J!(\"|7J!H!|8"
-    "J! $|9J!H\"|:J!($|;J!@\"|<J!8|=J!P$|>J!X$|?J! %| 2\"H%|!2\"@%|\"2\"@$|#"
-    "2\"0\"|$2\"(!|%2\"0|&2\"(|'2\"@!|(2\"0#|)2\"@#|*2\"H#|+2\"P\"|,2\"X\"|-"
-    "2\"(#|.2\" #|/2\" \"|02\"P!|12\"P#|22\"X#|32\"8#|42\"X!|52\"8\"|62\"(\""
-    "|72\"H!|82\" $|92\"H\"|:2\"($|;2\"@\"|<2\"8|=2\"P$|>2\"X$|?2\" %| Z H%|"
-    "!Z @%|\"Z @$|#!0\"|$!(!|%!0|&!(|'!@!|(!0#|)!@#|*!H#|+!P\"|,!X\"|-!(#|.!"
-    " #|/! \"|0!P!|1!P#|2!X#|3!8#|4!X!|5!8\"|6!(\"|7!H!|8! $|9!H\"|:!($|;!@\""
-    "|<!8| J H%|!J @%|\"J @$|@#8!|A#0!|B#H$| *!H%|!*!@%|\"*!@$|#*!0\"|$*!(!|"
-    "%*!0|&*!(|'*!@!|(*!0#|)*!@#|**!H#|+*!P\"|,*!X\"|-*!(#|.*! #|/*! \"|0*!P"
-    "!|1*!P#|2*!X#|3*!8#|4*!X!|5*!8\"|6*!(\"|7*!H!|8*! $|9*!H\"|:*!($|;*!@\""
-    "|<*!8|=!P$|>!X$|?! %|#!0\"|$!(!|%!0|&!(|'!@!|(!0#|)!@#|*!H#|+!P\"|,!X\""
-    "|-!(#|.! #|/! \"|0!P!|1!P#|2!X#|3!8#|4!X!|5!8\"|6!(\"|7!H!|8! $|9!H\"|:"
-    "!($|;!@\"|<!8| $H%|!$@%|\"$@$|@#8!|A#0!|B# !|!!@%|D#P|E#X|!~G#(%| Z!H%|"
-    "!Z!@%|\"Z!@$|#Z!0\"|$Z!(!|%Z!0|&Z!(|'Z!@!|(Z!0#|)Z!@#|*Z!H#|+Z!P\"|,Z!X"
-    "\"|-Z!(#|.Z! #|/Z! \"|0Z!P!|1Z!P#|2Z!X#|3Z!8#|4Z!X!|5Z!8\"|6Z!(\"|7Z!H!"
-    "|8Z! $|9Z!H\"|:Z!($|;Z!@\"|<Z!8|=Z!P$|>Z!X$|?Z! %| \"\"H%|!\"\"@%|\"\"\""
-    "@$|#\"\"0\"|$\"\"(!|%\"\"0|&\"\"(|'\"\"@!|(\"\"0#|)\"\"@#|*\"\"H#|+\"\""
-    "P\"|,\"\"X\"|-\"\"(#|.\"\" #|/\"\" \"|0\"\"P!|1\"\"P#|2\"\"X#|3\"\"8#|4"
-    "\"\"X!|5\"\"8\"|6\"\"(\"|7\"\"H!|8\"\" $|9\"\"H\"|:\"\"($|;\"\"@\"|<\"\""
-    "8|=\"\"P$|>\"\"X$|?\"\" %| :\"H%|!:\"@%|\":\"@$|#:\"0\"|$:\"(!|%:\"0|&:"
-    "\"(|':\"@!|(:\"0#|):\"@#|*:\"H#|+:\"P\"|,:\"X\"|-:\"(#|.:\" #|/:\" \"|0"
-    ":\"P!|1:\"P#|2:\"X#|3:\"8#|4:\"X!|5:\"8\"|6:\"(\"|7:\"H!|8:\" $|9:\"H\""
-    "|::\"($|;:\"@\"|<:\"8|=:\"P$|>:\"X$|?:\" %| B\"H%|!B\"@%|\"B\"@$|#B\"0\""
-    "|$B\"(!|%B\"0|&B\"(|'B\"@!|(B\"0#|)B\"@#|*B\"H#|+B\"P\"|,B\"X\"|-B\"(#|"
-    ".B\" #|/B\" \"|0B\"P!|1B\"P#|2B\"X#|3B\"8#|4B\"X!|5B\"8\"|6B\"(\"|7B\"H"
-    "!|8B\" $|9B\"H\"|:B\"($|;B\"@\"|<B\"8|=B\"P$|>B\"X$|?B\" %| J\"H%|!J\"@"
-    "%|\"J\"@$|#J\"0\"|$J\"(!|%J\"0|&J\"(|'J\"@!|(J\"0#|)J\"@#|*J\"H#|+J\"P\""
-    "|,J\"X\"|-J\"(#|.J\" #|/J\" \"|0J\"P!|1J\"P#|2J\"X#|3J\"8#|4J\"X!|5J\"8"
-    "\"|6J\"(\"|7J\"H!|8J\" $|9J\"H\"|:J\"($|;J\"@\"|<J\"8|=J\"P$|>J\"X$|?J\""
-    " %| R\"H%|!R\"@%|\"R\"@$|#R\"0\"|$R\"(!|%R\"0|&R\"(|'R\"@!|(R\"0#|)R\"@"
-    "#|*R\"H#|+R\"P\"|,R\"X\"|-R\"(#|.R\" #|/R\" \"|0R\"P!|1R\"P#|2R\"X#|3R\""
-    "8#|4R\"X!|5R\"8\"|6R\"(\"|7R\"H!|8R\" $|9R\"H\"|:R\"($|;R\"@\"|<R\"8|=R"
-    "\"P$|>R\"X$|?R\" %| \"#H%|!\"#@%|\"\"#@$|#\"#0\"|$\"#(!|%\"#0|&\"#(|'\""
-    "#@!|(\"#0#|)\"#@#|*\"#H#|+\"#P\"|,\"#X\"|-\"#(#|.\"# #|/\"# \"|0\"#P!|1"
-    "\"#P#|2\"#X#|3\"#8#|4\"#X!|5\"#8\"|6\"#(\"|7\"#H!|8\"# $|9\"#H\"|:\"#($"
-    "|;\"#@\"|<\"#8|=\"#P$|>\"#X$|?\"# %| *#H%|!*#@%|\"*#@$|#*#0\"|$*#(!|%*#"
-    "0|&*#(|'*#@!|(*#0#|)*#@#|**#H#|+*#P\"|,*#X\"|-*#(#|.*# #|/*# \"|0*#P!|1"
-    "*#P#|2*#X#|3*#8#|4*#X!|5*#8\"|6*#(\"|7*#H!|8*# $|9*#H\"|:*#($|;*#@\"|<*"
-    "#8|=*#P$|>*#X$|?*# %| 2#H%|!2#@%|\"2#@$|#2#0\"|$2#(!|%2#0|&2#(|'2#@!|(2"
-    "#0#|)2#@#|*2#H#|+2#P\"|,2#X\"|-2#(#|.2# #|/2# \"|02#P!|12#P#|22#X#|32#8"
-    "#|42#X!|52#8\"|62#(\"|72#H!|82# $|92#H\"|:2#($|;2#@\"|<2#8|=2#P$|>2#X$|"
-    "?2# %| :#H%|!:#@%|\":#@$|#:#0\"|$:#(!|%:#0|&:#(|':#@!|(:#0#|):#@#|*:#H#"
-    "|+:#P\"|,:#X\"|-:#(#|.:# #|/:# \"|0:#P!|1:#P#|2:#X#|3:#8#|4:#X!|5:#8\"|"
-    "6:#(\"|7:#H!|8:# $|9:#H\"|::#($|;:#@\"|<:#8|=:#P$|>:#X$|?:# %| B#H%|!B#"
-    "@%|\"B#@$|#B#0\"|$B#(!|%B#0|&B#(|'B#@!|(B#0#|)B#@#|*B#H#|+B#P\"|,B#X\"|"
-    "-B#(#|.B# #|/B# \"|0B#P!|1B#P#|2B#X#|3B#8#|4B#X!|5B#8\"|6B#(\"|7B#H!|8B"
-    "# $|9B#H\"|:B#($|;B#@\"|<B#8|=B#P$|>B#X$|?B# %| J#H%|!J#@%|\"J#@$|#J#0\""
-    "|$J#(!|%J#0|&J#(|'J#@!|(J#0#|)J#@#|*J#H#|+J#P\"|,J#X\"|-J#(#|.J# #|/J# "
-    "\"|0J#P!|1J#P#|2J#X#|3J#8#|4J#X!|5J#8\"|6J#(\"|7J#H!|8J# $|9J#H\"|:J#($"
-    "|;J#@\"|<J#8|=J#P$|>J#X$|?J# %| R#H%|!R#@%|\"R#@$|#R#0\"|$R#(!|%R#0|&R#"
-    "(|'R#@!|(R#0#|)R#@#|*R#H#|+R#P\"|,R#X\"|-R#(#|.R# #|/R# \"|0R#P!|1R#P#|"
-    "2R#X#|3R#8#|4R#X!|5R#8\"|6R#(\"|7R#H!|8R# $|9R#H\"|:R#($|;R#@\"|<R#8|=R"
-    "#P$|>R#X$|?R# %| Z#H%|!Z#@%|\"Z#@$|#Z#0\"|$Z#(!|%Z#0|&Z#(|'Z#@!|(Z#0#|)"
-    "Z#@#|*Z#H#|+Z#P\"|,Z#X\"|-Z#(#|.Z# #|/Z# \"|0Z#P!|1Z#P#|2Z#X#|3Z#8#|4Z#"
-    "X!|5Z#8\"|6Z#(\"|7Z#H!|8Z# $|9Z#H\"|:Z#($|;Z#@\"|<Z#8|=Z#P$|>Z#X$|?Z# %"
-    "| \"$H%|!\"$@%|\"\"$@$|#\"$0\"|$\"$(!|%\"$0|&\"$(|'\"$@!|(\"$0#|)\"$@#|"
-    "*\"$H#|+\"$P\"|,\"$X\"|-\"$(#|.\"$ #|/\"$ \"|0\"$P!|1\"$P#|2\"$X#|3\"$8"
-    "#|4\"$X!|5\"$8\"|6\"$(\"|7\"$H!|8\"$ $|9\"$H\"|:\"$($|;\"$@\"|<\"$8|=\""
-    "$P$|>\"$X$|?\"$ %| *$H%|!*$@%|\"*$@$|#*$0\"|$*$(!|%*$0|&*$(|'*$@!|(*$0#"
-    "|)*$@#|**$H#|+*$P\"|,*$X\"|-*$(#|.*$ #|/*$ \"|0*$P!|1*$P#|2*$X#|3*$8#|4"
-    "*$X!|5*$8\"|6*$(\"|7*$H!|8*$ $|9*$H\"|:*$($|;*$@\"|<*$8|=*$P$|>*$X$|?*$"
-    " %| 2$H%|!2$@%|\"2$@$|#2$0\"|$2$(!|%2$0|&2$(|'2$@!|(2$0#|)2$@#|*2$H#|+2"
-    "$P\"|,2$X\"|-2$(#|.2$ #|/2$ \"|02$P!|12$P#|22$X#|32$8#|42$X!|52$8\"|62$"
-    "(\"|72$H!|82$ $|92$H\"|:2$($|;2$@\"|<2$8|=2$P$|>2$X$|?2$ %| :$H%|!:$@%|"
-    "\":$@$|#:$0\"|$:$(!|%:$0|&:$(|':$@!|(:$0#|):$@#|*:$H#|+:$P\"|,:$X\"|-:$"
-    "(#|.:$ #|/:$ \"|0:$P!|1:$P#|2:$X#|3:$8#|4:$X!|5:$8\"|6:$(\"|7:$H!|8:$ $"
-    "|9:$H\"|::$($|;:$@\"|<:$8|=:$P$|>:$X$|?:$ %| B$H%|!B$@%|\"B$@$|#B$0\"|$"
-    "B$(!|%B$0|&B$(|'B$@!|(B$0#|)B$@#|*B$H#|+B$P\"|,B$X\"|-B$(#|.B$ #|/B$ \""
-    "|0B$P!|1B$P#|2B$X#|3B$8#|4B$X!|5B$8\"|6B$(\"|7B$H!|8B$ $|9B$H\"|:B$($|;"
-    "B$@\"|<B$8|=B$P$|>B$X$|?B$ %| J$H%|!J$@%|\"J$@$|#J$0\"|$J$(!|%J$0|&J$(|"
-    "'J$@!|(J$0#|)J$@#|*J$H#|+J$P\"|,J$X\"|-J$(#|.J$ #|/J$ \"|0J$P!|1J$P#|2J"
-    "$X#|3J$8#|4J$X!|5J$8\"|6J$(\"|7J$H!|8J$ $|9J$H\"|:J$($|;J$@\"|<J$8|=J$P"
-    "$|>J$X$|?J$ %| R$H%|!R$@%|\"R$@$|#R$0\"|$R$(!|%R$0|&R$(|'R$@!|(R$0#|)R$"
-    "@#|*R$H#|+R$P\"|,R$X\"|-R$(#|.R$ #|/R$ \"|0R$P!|1R$P#|2R$X#|3R$8#|4R$X!"
-    "|5R$8\"|6R$(\"|7R$H!|8R$ $|9R$H\"|:R$($|;R$@\"|<R$8|=R$P$|>R$X$|?R$ %| "
-    "Z$H%|!Z$@%|\"Z$@$|#Z$0\"|$Z$(!|%Z$0|&Z$(|'Z$@!|(Z$0#|)Z$@#|*Z$H#|+Z$P\""
-    "|,Z$X\"|-Z$(#|.Z$ #|/Z$ \"|0Z$P!|1Z$P#|2Z$X#|3Z$8#|4Z$X!|5Z$8\"|6Z$(\"|"
-    "7Z$H!|8Z$ $|9Z$H\"|:Z$($|;Z$@\"|<Z$8|=Z$P$|>Z$X$|?Z$ %| \"%H%|!\"%@%|\""
-    "\"%@$|#\"%0\"|$\"%(!|%\"%0|&\"%(|'\"%@!|(\"%0#|)\"%@#|*\"%H#|+\"%P\"|,\""
-    "%X\"|-\"%(#|.\"% #|/\"% \"|0\"%P!|1\"%P#|2\"%X#|3\"%8#|4\"%X!|5\"%8\"|6"
-    "\"%(\"|7\"%H!|8\"% $|9\"%H\"|:\"%($|;\"%@\"|<\"%8|=\"%P$|>\"%X$|?\"% %|"
-    " \"!H%|!\"!@%|\"\"!@$|#\"!0\"|$\"!(!|%\"!0|&\"!(|'\"!@!|(\"!0#|)\"!@#|*"
-    "\"!H#|+\"!P\"|,\"!X\"|-\"!(#|.\"! #|/\"! \"|0\"!P!|1\"!P#|2\"!X#|3\"!8#"
-    "|4\"!X!|5\"!8\"|6\"!(\"|7\"!H!|8\"! $|9\"!H\"|:\"!($|;\"!@\"|<\"!8|=!P$"
-    "|>!X$|?! %| 2!H%|!2!@%|\"2!@$|#2!0\"|$2!(!|%2!0|&2!(|'2!@!|(2!0#|)2!@#|"
-    "*2!H#|+2!P\"|,2!X\"|-2!(#|.2! #|/2! \"|02!P!|12!P#|22!X#|32!8#|42!X!|52"
-    "!8\"|62!(\"|72!H!|82! $|92!H\"|:2!($|;2!@\"|<2!8|=2!P$|>2!X$|?2! %| :!H"
-    "%|!:!@%|\":!@$|#:!0\"|$:!(!|%:!0|&:!(|':!@!|(:!0#|):!@#|*:!H#|+:!P\"|,:"
-    "!X\"|-:!(#|.:! #|/:! \"|0:!P!|1:!P#|2:!X#|3:!8#|4:!X!|5:!8\"|6:!(\"|7:!"
-    "H!|8:! $|9:!H\"|::!($|;:!@\"|<:!8|=:!P$|>:!X$|?:! %| B!H%|!B!@%|\"B!@$|"
-    "#B!0\"|$B!(!|%B!0|&B!(|'B!@!|(B!0#|)B!@#|*B!H#|+B!P\"|,B!X\"|-B!(#|.B! "
-    "#|/B! \"|0B!P!|1B!P#|2B!X#|3B!8#|4B!X!|5B!8\"|6B!(\"|7B!H!|8B! $|9B!H\""
-    "|:B!($|;B!@\"|<B!8|=B!P$|>B!X$|?B! %|#!0\"|$!(!|%!0|&!(|'!@!|(!0#|)!@#|"
-    "*!H#|+!P\"|,!X\"|-!(#|.! #|/! \"|0!P!|1!P#|2!X#|3!8#|4!X!|5!8\"|6!(\"|7"
-    "!H!|8! $|9!H\"|:!($|;!@\"|<!8| R H%|!R @%|\"!@$|@#8!|A#0!|B# !|!~D#8%|E"
-    "#X| $H%|!$@%|\"$@$|!~ 2 H%|!2 @%|\"!@$| B H%|!B @%|\"B @$| * H%|!!@%|!~"
-    "!~!~!~!~!~!~!~!~!~!~!~!~!~C#8$|!~!~F#0$|!~!~!~!~!~C#8$|!~!~F#0$|C#0%|!~"
-    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~}8|!|}9||}:||};|_|}<||}=|&|}>|'|}?||}@|)|"
-    "}A|_|}B||}C|/|}D|_|}E||}F|5|}G|_|}H|Null||Halt|!|Label|\"|Call|#|ScanSt"
-    "art|$|ScanChar|%|ScanAccept|&|ScanToken|'|ScanError|(|AstStart|)|AstFin"
-    "ish|*|AstNew|+|AstForm|,|AstLoad|-|AstIndex|.|AstChild|/|AstChildSlice|"
-    "0|AstKind|1|AstKindNum|2|AstLocation|3|AstLocationNum|4|AstLexeme|5|Ast"
-    "LexemeString|6|Assign|7|DumpStack|8|Add|9|Subtract|:|Multiply|;|Divide|"
-    "<|UnaryMinus|=|Return|>|Branch|?|BranchEqual|@|BranchNotEqual|A|BranchL"
-    "essThan|B|BranchLessEqual|C|BranchGreaterThan|D|BranchGreaterEqual|E|}I"
-    "|*%|}J|I)|}K|7|!~|$||>|!~\"|$|!~\"|%|!~\"|6||(|$|)|-|&|.|?|$|@|@|&|A|C|"
-    "$|D|D|(|E|G|$|H|H|*|I|I|,|J|J|.|K|K|0|L|M|$|N|N|2|O|^|$|_|_|4| !|:!|$|;"
-    "!|;!|6|<!|<!|<|>!|Z!|$|[!|[!|&!|\\!|\\!|)!|^!|_____#|$|&|/'|%!|<|+!|%|!"
-    "~'!||&|B#|(!|L|\"|%|!~*!|\"|)|-|&|@|@|&|&|WC|1!|#|+!|%|!~3!||&|34|4!|$|"
-    "+!|%|!~6!||&|?4|7!|!|+!|%|!~9!||&|//|:!|=|+!|%|!~<!||&|!1|=!|>|+!|%|!~?"
-    "!||&|,:|@!|'|+!|%|!~B!||&|R2|C!|?|+!|%|!~E!||%|!~F!|$||;!|6|<!|<!|7|=!|"
-    "=!|:|>!|_____#|6|%|!~S!|$||;!|6|<!|<!|7|=!|=!|8|>!|_____#|6|&| &| \"|%|"
-    "+!|%|!~\"\"|$||;!|6|<!|<!|7|=!|=!|:|>!|_____#|6|&| &|/\"|%|+!|%|!~1\"||"
-    "&|/'|2\"|<|+!|%|!~4\"|4|D|D|>|H|H|@|I|I|B|J|J|D|K|K|F|N|N|H|_|_|J|$!|$!"
-    "|L|3!|3!|N|;!|;!|P|<!|<!|R|=!|=!|T|B!|B!|V|D!|D!|X|N!|N!|Z|R!|R!|\\|S!|"
-    "S!|^|[!|[!| !|\\!|\\!|\"!|]!|]!|$!|&|BN|1#|(|+!|%|!~3#||&|-Q|4#|)|+!|%|"
-    "!~6#||&|FR|7#|*|+!|%|!~9#||&|,I|:#|+|+!|%|!~<#||&|@J|=#|,|+!|%|!~?#||&|"
-    ",M|@#|-|+!|%|!~B#||&|TK|C#|.|+!|%|!~E#||&|O?|F#|/|+!|%|!~H#||&|\\<|I#|0"
-    "|+!|%|!~K#||&| T|L#|1|+!|%|!~N#||&|@B|O#|6|+!|%|!~Q#||&|;U|R#|2|+!|%|!~"
-    "T#||&|XO|U#|3|+!|%|!~W#||&|9>|X#|4|+!|%|!~Z#||&|/E|[#|5|+!|%|!~]#||&|FF"
-    "|^#|;|+!|%|!~ $||&|B;|!$|7|+!|%|!~#$||&|WV|$$|8|+!|%|!~&$||&|XG|'$|9|+!"
-    "|%|!~)$||&|0X|*$|:|+!|%|!~,$||%|!~-$|#||\\!|&!|]!|]!|'!|^!|_____#|&!|&|"
-    "^$|7$|&|+!|%|!~9$||&|N*|:$|\"|+!|%|!~<$||'|!~=$|9|!~=$|$|$|!|>|!~@$|)|Q"
-    ")|@$|\"|+|Q)|A$|#|-|])|B$||\"|!~/|\\)|E$||,|Q)|F$|\"|#|!|2|R)|I$|_|*|Q)"
-    "|J$|!|>|R(|K$|)|D+|K$|#|+|D+|L$|\"|-|R+|M$||#|\"~/|Q+|P$||-|V+|Q$||#|!~"
-    "0|X+|T$|||!~,|D+|W$|#|\"|\"|2|E+|Z$| !|*|D+|[$|\"|>|'*|\\$|)|@*|\\$|\"|"
-    "+|@*|]$|#|-|@*|^$||\"|\"~0|@*|!%|||!~-|@*|$%||\"|!~/|@*|'%||,|@*|(%|\"|"
-    "#|\"|2|@*|+%|_!|*|@*|,%|\"|>|@*|-%|)| +|-%|#|-|!+|.%|!|#|!~/| +|1%|!|*|"
-    " +|2%|\"|>|!~3%|)|@*|3%|\"|+|@*|4%|#|-|@*|5%|!|\"|!~/|@*|8%|!|,|@*|9%|\""
-    "|#|!|2|@*|<%|_!|*|@*|=%|!|>|@*|>%|)|$.|>%|#|+|$.|?%|\"|-|4.|@%|!|#|!~0|"
-    "6.|C%|!||!~,|$.|F%|#|\"|!|2|%.|I%|!!|*|$.|J%|!|>|^,|K%|)|^,|K%|\"|+|^,|"
-    "L%|#|-|^,|M%|!|\"|\"~0|^,|P%|!||!~-|^,|S%|!|\"|!~/|^,|V%|!|,|^,|W%|\"|#"
-    "|\"|2|^,|Z%|_!|*|^,|[%|\"|>|^,|\\%|)|^,|\\%|#|+|^,|]%|\"|-|^,|^%|!|#|!~"
-    "/|^,|!&|!|,|^,|\"&|#|\"|!|2|^,|%&|_!|*|^,|&&|!|>|^,|'&|)|Q/|'&|\"|+|Q/|"
-    "(&|#|-|(0|)&|!|\"|\"~/|'0|,&|!|,|Q/|-&|\"|#|\"|2|R/|0&|#!|*|Q/|1&|\"|>|"
-    "H.|2&|)|C1|2&|#|+|C1|3&|\"|-|Y1|4&|!|#|\"~/|X1|7&|!|,|C1|8&|#|\"|\"|2|D"
-    "1|;&|$!|*|C1|<&|\"|>|:0|=&|)|43|=&|\"|+|43|>&|#|-|H3|?&|!|\"|\"~/|G3|B&"
-    "|!|,|43|C&|\"|#|\"|2|53|F&|\"!|*|43|G&|\"|>|+2|H&|)|!5|H&|#|-|\"5|I&|\""
-    "|#|\"~/|!5|L&|\"|*|!5|M&|#|>|Z3|N&|)|26|N&|\"|+|26|O&|#|,|26|P&|\"|#|!|"
-    "2|36|S&|W|-|D6|T&|\"|\"|!~5|C6|W&|\"|*|26|X&|!|>|35|Y&|)|49|Y&|#|+|49|Z"
-    "&|\"|,|49|[&|#|\"|!|2|59|^&|V|-|H9|_&|\"|#|!~5|G9|\"'|\"|*|49|#'|!|>|38"
-    "|$'|)|O:|$'|\"|+|O:|%'|#|,|O:|&'|\"|#|!|2|P:|)'|&!|*|O:|*'|!|>|S9|+'|)|"
-    "'<|+'|#|+|'<|,'|\"|,|'<|-'|#|\"|!|2|(<|0'|'!|*|'<|1'|!|>|);|2'|)|A=|2'|"
-    "\"|+|A=|3'|#|,|A=|4'|\"|#|!|2|B=|7'|(!|*|A=|8'|!|>|C<|9'|)|^>|9'|#|+|^>"
-    "|:'|\"|,|^>|;'|#|\"|!|2|_>|>'|)!|*|^>|?'|!|>| >|@'|)|4@|@'|\"|+|4@|A'|#"
-    "|,|4@|B'|\"|#|!|2|5@|E'|*!|*|4@|F'|!|>|6?|G'|)|MA|G'|#|+|MA|H'|\"|,|MA|"
-    "I'|#|\"|!|2|NA|L'|%!|-|]A|M'|\"|#|!~5|\\A|P'|\"|*|MA|Q'|!|>|O@|R'|)|&C|"
-    "R'|\"|+|&C|S'|#|,|&C|T'|\"|#|!|2|'C|W'|+!|*|&C|X'|!|>|'B|Y'|)|:D|Y'|#|+"
-    "|:D|Z'|\"|,|:D|['|#|\"|!|2|;D|^'|,!|*|:D|_'|!|>|>C| (|)|TE| (|\"|+|TE|!"
-    "(|#|,|TE|\"(|\"|#|!|2|UE|%(|-!|*|TE|&(|!|>|VD|'(|)|+G|'(|#|+|+G|((|\"|,"
-    "|+G|)(|#|\"|!|2|,G|,(|.!|*|+G|-(|!|>|-F|.(|)|=H|.(|\"|+|=H|/(|#|,|=H|0("
-    "|\"|#|!|2|>H|3(|/!|*|=H|4(|!|>|?G|5(|)|QI|5(|#|+|QI|6(|\"|,|QI|7(|#|\"|"
-    "!|2|RI|:(|0!|*|QI|;(|!|>|SH|<(|)|%K|<(|\"|+|%K|=(|#|,|%K|>(|\"|#|!|2|&K"
-    "|A(|1!|*|%K|B(|!|>|'J|C(|)|9L|C(|#|+|9L|D(|\"|,|9L|E(|#|\"|!|2|:L|H(|2!"
-    "|*|9L|I(|!|>|;K|J(|)|QM|J(|\"|+|QM|K(|#|,|QM|L(|\"|#|!|2|RM|O(|3!|*|QM|"
-    "P(|!|>|SL|Q(|)|'O|Q(|#|+|'O|R(|\"|,|'O|S(|#|\"|!|2|(O|V(|4!|*|'O|W(|!|>"
-    "|)N|X(|)|=P|X(|\"|+|=P|Y(|#|,|=P|Z(|\"|#|!|2|>P|](|5!|*|=P|^(|!|>|?O|_("
-    "|)|RQ|_(|#|+|RQ| )|\"|,|RQ|!)|#|\"|!|2|SQ|$)|6!|*|RQ|%)|!|>|TP|&)|)|+S|"
-    "&)|\"|+|+S|')|#|,|+S|()|\"|#|!|2|,S|+)|7!|*|+S|,)|!|>|-R|-)|)|ET|-)|#|+"
-    "|ET|.)|\"|,|ET|/)|#|\"|!|2|FT|2)|8!|*|ET|3)|!|>|GS|4)|)| V|4)|\"|+| V|5"
-    ")|#|,| V|6)|\"|#|!|2|!V|9)|9!|*| V|:)|!|>|\"U|;)|)|<W|;)|#|+|<W|<)|\"|,"
-    "|<W|=)|#|\"|!|2|=W|@)|:!|*|<W|A)|!|>|>V|B)|)|UX|B)|\"|+|UX|C)|#|,|UX|D)"
-    "|\"|#|!|2|VX|G)|;!|*|UX|H)|!|>|WW|I)|}L|%|}M||0|!|1||Temp$0||Temp$1||to"
-    "ken_count|}N|#|}O||}P|}Q|}"
-};
-
-static const char* charset_str =
-{
-    "|!|}!|'$'| \"|'-'|!\"|'\\\\$'|\"\"|'\\\\-'|#\"|'\\\\D'|$\"|'\\\\S'|%\"|"
-    "'\\\\['|&\"|'\\\\\\\\'|'\"|'\\\\]'|(\"|'\\\\^'|)\"|'\\\\d'|*\"|'\\\\n'|"
-    "+\"|'\\\\r'|,\"|'\\\\s'|-\"|'^'|.\"|*eof*|/\"|*epsilon*|0\"|*error*|1\""
-    "|<char>|2\"|AstActionAdd|U!|AstActionAnd|Z!|AstActionAssign|N!|AstActio"
-    "nDivide|X!|AstActionDumpStack|]!|AstActionEqual|O!|AstActionGreaterEqua"
-    "l|T!|AstActionGreaterThan|S!|AstActionLessEqual|R!|AstActionLessThan|Q!"
-    "|AstActionMultiply|W!|AstActionNot|\\!|AstActionNotEqual|P!|AstActionOr"
-    "|[!|AstActionStatementList|M!|AstActionSubtract|V!|AstActionTokenCount|"
-    "^!|AstActionUnaryMinus|Y!|AstAstChild|I|AstAstDot|P|AstAstFormer|G|AstA"
-    "stItemList|H|AstAstKind|J|AstAstLexeme|M|AstAstLexemeString|N|AstAstLoc"
-    "ation|K|AstAstLocationString|L|AstAstLocator|O|AstAstSlice|Q|AstCaseSen"
-    "sitive|*|AstCharset|<!|AstCharsetAltNewline|E!|AstCharsetCaret|H!|AstCh"
-    "arsetChar|?!|AstCharsetCr|G!|AstCharsetDash|I!|AstCharsetDigits|B!|AstC"
-    "harsetDollar|J!|AstCharsetEscape|D!|AstCharsetInvert|=!|AstCharsetLeftB"
-    "racket|K!|AstCharsetNewline|F!|AstCharsetNotDigits|C!|AstCharsetNotWhit"
-    "espace|A!|AstCharsetRange|>!|AstCharsetRightBracket|L!|AstCharsetString"
-    "|V|AstCharsetWhitespace|@!|AstConflicts|(|AstEmpty|F|AstErrorRecovery|'"
-    "|AstFalse|^|AstGrammar|\"|AstGroup|<|AstIdentifier|X|AstInteger|Y|AstKe"
-    "epWhitespace|)|AstLookaheads|&|AstMacroString|W|AstNegativeInteger|Z|As"
-    "tNonterminalReference|E|AstNull|!|AstOneClosure|;|AstOptionList|#|AstOp"
-    "tional|9|AstOptions|S|AstReduceActions|T|AstRegex|_|AstRegexAltNewline|"
-    ",!|AstRegexChar|%!|AstRegexCr|.!|AstRegexDigits|)!|AstRegexDollar|4!|As"
-    "tRegexEscape|+!|AstRegexLeftBrace|:!|AstRegexLeftBracket|8!|AstRegexLef"
-    "tParen|6!|AstRegexList|!!|AstRegexNewline|-!|AstRegexNotDigits|*!|AstRe"
-    "gexNotWhitespace|(!|AstRegexOneClosure|$!|AstRegexOptional|\"!|AstRegex"
-    "Or| !|AstRegexPeriod|3!|AstRegexPlus|1!|AstRegexQuestion|2!|AstRegexRig"
-    "htBrace|;!|AstRegexRightBracket|9!|AstRegexRightParen|7!|AstRegexSpace|"
-    "5!|AstRegexStar|0!|AstRegexString|U|AstRegexVBar|/!|AstRegexWhitespace|"
-    "'!|AstRegexWildcard|&!|AstRegexZeroClosure|#!|AstRule|6|AstRuleLeftAsso"
-    "c|@|AstRuleList|%|AstRuleOperatorList|B|AstRuleOperatorSpec|C|AstRulePr"
-    "ecedence|=|AstRulePrecedenceList|>|AstRulePrecedenceSpec|?|AstRuleRhs|8"
-    "|AstRuleRhsList|7|AstRuleRightAssoc|A|AstString|[|AstTerminalReference|"
-    "D|AstToken|R|AstTokenAction|2|AstTokenDeclaration|+|AstTokenDescription"
-    "|.|AstTokenError|5|AstTokenIgnore|4|AstTokenLexeme|3|AstTokenList|$|Ast"
-    "TokenOptionList|,|AstTokenPrecedence|1|AstTokenRegex|0|AstTokenRegexLis"
-    "t|/|AstTokenTemplate|-|AstTripleString|\\|AstTrue|]|AstUnknown||AstZero"
-    "Closure|:|Unknown|_!|}\"|//{ -{ *//  Character Set Grammar{ -{ *//  ---"
-    "------------------{ -{ *//{ -{ *//  Grammar file for the scanner regula"
-    "r expression character sets.{ -{ *//{ -{ *{ -{ *options{ -{ *{ -{ *    "
-    "lookaheads = 2{ -{ *    conflicts = 0{ -{ *    keep_whitespace = true{ "
-    "-{ *    case_sensitive = true{ -{ *{ -{ *tokens{ -{ *{ -{ *    <char>  "
-    "             : regex = ''' [^\\^\\-\\[\\]\\$] '''{ -{ *{ -{ *rules     "
-    "  { -{ *        { -{ *    CharsetRoot          ::= '^' CharsetList{ -{ "
-    "*                         :   (AstCharsetInvert, $2._){ -{ *{ -{ *    C"
-    "harsetRoot          ::= CharsetList{ -{ *{ -{ *    CharsetList         "
-    " ::= CharsetItem+{ -{ *                         :   (AstCharset, $1._){"
-    " -{ *{ -{ *    CharsetItem          ::= Char '-' Char{ -{ *            "
-    "             :   (AstCharsetRange, $1, $3, @2){ -{ *{ -{ *    CharsetIt"
-    "em          ::= Charset{ -{ *{ -{ *    CharsetItem          ::= Char{ -"
-    "{ *                         :   (AstCharsetRange, $1){ -{ *{ -{ *    Ch"
-    "arset              ::= '\\\\s' { -{ *                         :   (AstC"
-    "harsetWhitespace){ -{ *{ -{ *    Charset              ::= '\\\\S' { -{ "
-    "*                         :   (AstCharsetNotWhitespace){ -{ *{ -{ *    "
-    "Charset              ::= '\\\\d' { -{ *                         :   (As"
-    "tCharsetDigits){ -{ *{ -{ *    Charset              ::= '\\\\D' { -{ * "
-    "                        :   (AstCharsetNotDigits){ -{ *{ -{ *    Char  "
-    "               ::= '\\\\\\\\' { -{ *                         :   (AstCh"
-    "arsetEscape){ -{ *{ -{ *    Char                 ::= '$' { -{ *        "
-    "                 :   (AstCharsetAltNewline){ -{ *{ -{ *    Char        "
-    "         ::= '\\\\n' { -{ *                         :   (AstCharsetNewl"
-    "ine){ -{ *{ -{ *    Char                 ::= '\\\\r' { -{ *            "
-    "             :   (AstCharsetCr){ -{ *{ -{ *    Char                 ::="
-    " '\\\\^' { -{ *                         :   (AstCharsetCaret){ -{ *{ -{"
-    " *    Char                 ::= '\\\\-' { -{ *                         :"
-    "   (AstCharsetDash){ -{ *{ -{ *    Char                 ::= '\\\\$' { -"
-    "{ *                         :   (AstCharsetDollar){ -{ *{ -{ *    Char "
-    "                ::= '\\\\[' { -{ *                         :   (AstChar"
-    "setLeftBracket){ -{ *{ -{ *    Char                 ::= '\\\\]' { -{ * "
-    "                        :   (AstCharsetRightBracket){ -{ *{ -{ *    Cha"
-    "r                 ::= <char>{ -{ *                         :   (AstChar"
-    "setChar, &1){ -{ *{ -{ *{ -{ *|}#|\"|}$|!|}%|7|}&||}'|:|}(|*eof*|'$'|'\\"
-    "\\$'|'\\\\-'|'\\\\['|'\\\\\\\\'|'\\\\]'|'\\\\^'|'\\\\n'|'\\\\r'|<char>|"
-    "'\\\\D'|'\\\\S'|'\\\\d'|'\\\\s'|'-'|'^'|||||||*error*||*epsilon*|})|!|!"
-    "|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|6#|=|||||!|!|!|}*|/\"| \"|\"\"|#\"|&\"|'"
-    "\"|(\"|)\"|+\"|,\"|2\"|$\"|%\"|*\"|-\"|!\"|.\"||!~!~|||1\"|0S'1|0\"|}+|"
-    "||||||||||!|||||||6#|=||||||!||},|7|}-|!|\"|!|!|\"|!|#|!|!|!|!|!|!|!|!|"
-    "!|!|!|!|!|!|!|!|}.|8|6|6|4|5|5|3|3|3|2|2|2|2|1|1|1|1|1|1|1|1|1|1|}/|*ac"
-    "cept* ::= CharsetRoot|CharsetRoot ::= '^' CharsetList|CharsetRoot ::= C"
-    "harsetList|CharsetList ::= CharsetList:1|CharsetList:1 ::= CharsetList:"
-    "1 CharsetItem|CharsetList:1 ::= CharsetItem|CharsetItem ::= Char '-' Ch"
-    "ar|CharsetItem ::= Charset|CharsetItem ::= Char|Charset ::= '\\\\s'|Cha"
-    "rset ::= '\\\\S'|Charset ::= '\\\\d'|Charset ::= '\\\\D'|Char ::= '\\\\"
-    "\\\\'|Char ::= '$'|Char ::= '\\\\n'|Char ::= '\\\\r'|Char ::= '\\\\^'|C"
-    "har ::= '\\\\-'|Char ::= '\\\\$'|Char ::= '\\\\['|Char ::= '\\\\]'|Char"
-    " ::= <char>|}0|!~I|!~Q|Y|#!|+!|!~7!|?!|E!|K!|Q!|W!|]!|#\"|)\"|/\"|5\"|;"
-    "\"|A\"|G\"|M\"|}1|\"|}2||}3|:|}4|>|}5|6|6!|E|L|[|\"!|6$|F!|E$|T$|#%|2%|"
-    "A%|V!|&\"|6\"|F\"|V\"|&#|6#|F#|V#|\\|P%|<&|_%||&$|.&|1!|}6|W&|}7|@\"|A "
-    "<|B F|C D|D H|E :|F J|G B|H >|I @|J \"|K 8|L 4|M 6|N 2|O P|P &|Q!V|R!0|"
-    "S!X|T!Z|U!*|V!$|A <|B F|C D|D H|E :|F J|G B|H >|I @|J \"|K 8|L 4|M 6|N "
-    "2|@\"|P &|Q!.|R!0|S!,|T!(|U!*|V!$|A <|B F|C D|D H|E :|F J|G B|H >|I @|J"
-    " \"|K 8|L 4|M 6|N 2| ) :| % :|Q!.|R!0|S!,|T!L|U!*| - :|A <|B F|C D|D H|"
-    "E :|F J|G B|H >|I @|J \"|K 8|L 4|M 6|N 2| \"T|!~Q!.|R!0|S!N| 9!:|!9!.|\""
-    "9!3|#9!2|$9!4|%9!-|&9!5|'9!1|(9!/|)9!0|*9!!|+9!,|,9!*|-9!+|.9!)|/9!8| A"
-    " :|!A .|\"A 3|#A 2|$A 4|%A -|&A 5|'A 1|(A /|)A 0|*A !|+A ,|,A *|-A +|.A"
-    " )|O P| U :|!U .|\"U 3|#U 2|$U 4|%U -|&U 5|'U 1|(U /|)U 0|*U !|+U ,|,U "
-    "*|-U +|.U )|/U 8| Y :|!Y .|\"Y 3|#Y 2|$Y 4|%Y -|&Y 5|'Y 1|(Y /|)Y 0|*Y "
-    "!|+Y ,|,Y *|-Y +|.Y )|/Y 8| ] :|!] .|\"] 3|#] 2|$] 4|%] -|&] 5|'] 1|(] "
-    "/|)] 0|*] !|+] ,|,] *|-] +|.] )|/] 8| !!:|!!!.|\"!!3|#!!2|$!!4|%!!-|&!!"
-    "5|'!!1|(!!/|)!!0|*!!!|+!!,|,!!*|-!!+|.!!)|/!!8| %!:|!%!.|\"%!3|#%!2|$%!"
-    "4|%%!-|&%!5|'%!1|(%!/|)%!0|*%!!|+%!,|,%!*|-%!+|.%!)|/%!8| )!:|!)!.|\")!"
-    "3|#)!2|$)!4|%)!-|&)!5|')!1|()!/|))!0|*)!!|+)!,|,)!*|-)!+|.)!)|/)!8| -!:"
-    "|!-!.|\"-!3|#-!2|$-!4|%-!-|&-!5|'-!1|(-!/|)-!0|*-!!|+-!,|,-!*|--!+|.-!)"
-    "|/-!8| 1!:|!1!.|\"1!3|#1!2|$1!4|%1!-|&1!5|'1!1|(1!/|)1!0|*1!!|+1!,|,1!*"
-    "|-1!+|.1!)|/1!8| 5!:|!5!.|\"5!3|#5!2|$5!4|%5!-|&5!5|'5!1|(5!/|)5!0|*5!!"
-    "|+5!,|,5!*|-5!+|.5!)|/5!8| \"T|!\"<|\"\"F|#\"D|$\"H|%\":|&\"J|'\"B|(\">"
-    "|)\"@|*\"\"|+\"8|,\"4|-\"6|.\"2|O P| 5 :|!5 .|\"5 3|#5 2|$5 4|%5 -|&5 5"
-    "|'5 1|(5 /|)5 0|*5 !|+5 ,|,5 *|-5 +|.5 )| = :|!= .|\"= 3|#= 2|$= 4|%= -"
-    "|&= 5|'= 1|(= /|)= 0|*= !|+= ,|,= *|-= +|.= )| E :|!E .|\"E 3|#E 2|$E 4"
-    "|%E -|&E 5|'E 1|(E /|)E 0|*E !|+E ,|,E *|-E +|.E )| I :|!I .|\"I 3|#I 2"
-    "|$I 4|%I -|&I 5|'I 1|(I /|)I 0|*I !|+I ,|,I *|-I +|.I )| M :|!M .|\"M 3"
-    "|#M 2|$M 4|%M -|&M 5|'M 1|(M /|)M 0|*M !|+M ,|,M *|-M +|.M )| Q :|!Q .|"
-    "\"Q 3|#Q 2|$Q 4|%Q -|&Q 5|'Q 1|(Q /|)Q 0|*Q !|+Q ,|,Q *|-Q +|.Q )| 1 :|"
-    "!1 .|\"1 3|#1 2|$1 4|%1 -|&1 5|'1 1|(1 /|)1 0|*1 !|+1 ,|,1 *|-1 +|.1 )|"
-    " 9 :|!9 .|\"9 3|#9 2|$9 4|%9 -|&9 5|'9 1|(9 /|)9 0|*9 !|+9 ,|,9 *|-9 +|"
-    ".9 )| \"T|!\"<|\"\"F|#\"D|$\"H|%\":|&\"J|'\"B|(\">|)\"@|*\"\"|+\"8|,\"4"
-    "|-\"6|.\"2|A <|B F|C D|D H|E :|F J|G B|H >|I @|J \"|!~!~!~!~!~!~Q!R|!~!"
-    "~!~!~!~!~!~!~!~}8|!|}9||}:||};|?|}<||}=|%|}>|'|}?||}@|(|}A|?|}B||}C|-|}"
-    "D|?|}E||}F|2|}G|?|}H|Null||Halt|!|Label|\"|Call|#|ScanStart|$|ScanChar|"
+    "|#|}!|'$'|*\"|'('|+\"|')'|,\"|'*'|-\"|'+'|.\"|'.'|/\"|'\?'|0\"|'\\\\$'|"
+    "1\"|'\\\\('|2\"|'\\\\)'|3\"|'\\\\*'|4\"|'\\\\+'|5\"|'\\\\.'|6\"|'\\\\\?"
+    "'|7\"|'\\\\D'|8\"|'\\\\S'|9\"|'\\\\['|:\"|'\\\\\\\\'|;\"|'\\\\]'|<\"|'\\"
+    "\\b'|=\"|'\\\\d'|>\"|'\\\\n'|\?\"|'\\\\r'|@\"|'\\\\s'|A\"|'\\\\{'+'|B\""
+    "|'\\\\{','|C\"|'\\\\{'-'|D\"|'{','|E\"|*eof*|F\"|*epsilon*|G\"|*error*|"
+    "H\"|<char>|I\"|<charset>|J\"|<macro>|K\"|<whitespace>|L\"|AstActionAdd|"
+    "_!|AstActionAnd|$\"|AstActionAssign|X!|AstActionDivide|\"\"|AstActionDu"
+    "mpStack|'\"|AstActionEqual|Y!|AstActionGreaterEqual|^!|AstActionGreater"
+    "Than|]!|AstActionLessEqual|\\!|AstActionLessThan|[!|AstActionMultiply|!"
+    "\"|AstActionNot|&\"|AstActionNotEqual|Z!|AstActionOr|%\"|AstActionState"
+    "mentList|W!|AstActionSubtract| \"|AstActionTokenCount|(\"|AstActionUnar"
+    "yMinus|#\"|AstAstChild|S|AstAstDot|Z|AstAstFormer|Q|AstAstItemList|R|As"
+    "tAstKind|T|AstAstLexeme|W|AstAstLexemeString|X|AstAstLocation|U|AstAstL"
+    "ocationString|V|AstAstLocator|Y|AstAstSlice|[|AstCaseSensitive|*|AstCha"
+    "rset|F!|AstCharsetAltNewline|O!|AstCharsetCaret|R!|AstCharsetChar|I!|As"
+    "tCharsetCr|Q!|AstCharsetDash|S!|AstCharsetDigits|L!|AstCharsetDollar|T!"
+    "|AstCharsetEscape|N!|AstCharsetInvert|G!|AstCharsetLeftBracket|U!|AstCh"
+    "arsetNewline|P!|AstCharsetNotDigits|M!|AstCharsetNotWhitespace|K!|AstCh"
+    "arsetRange|H!|AstCharsetRightBracket|V!|AstCharsetString| !|AstCharsetW"
+    "hitespace|J!|AstConflicts|(|AstEmpty|P|AstErrorRecovery|'|AstFalse|(!|A"
+    "stGrammar|\"|AstGroup|F|AstIdentifier|\"!|AstInteger|#!|AstInternLexeme"
+    "s|1|AstKeepWhitespace|)|AstKeywordTable|-|AstLazyAst|2|AstLazyScanner|/"
+    "|AstLinearScan|.|AstLookaheadMethod|+|AstLookaheads|&|AstMacroString|!!"
+    "|AstMinimizeMethod|3|AstNegativeInteger|$!|AstNonterminalReference|O|As"
+    "tNull|!|AstOneClosure|E|AstOptionList|#|AstOptional|C|AstOptions|]|AstP"
+    "ipelineScanner|0|AstReduceActions|^|AstRegex|)!|AstRegexAltNewline|6!|A"
+    "stRegexChar|/!|AstRegexCr|8!|AstRegexDigits|3!|AstRegexDollar|>!|AstReg"
+    "exEscape|5!|AstRegexLeftBrace|D!|AstRegexLeftBracket|B!|AstRegexLeftPar"
+    "en|@!|AstRegexList|+!|AstRegexNewline|7!|AstRegexNotDigits|4!|AstRegexN"
+    "otWhitespace|2!|AstRegexOneClosure|.!|AstRegexOptional|,!|AstRegexOr|*!"
+    "|AstRegexPeriod|=!|AstRegexPlus|;!|AstRegexQuestion|<!|AstRegexRightBra"
+    "ce|E!|AstRegexRightBracket|C!|AstRegexRightParen|A!|AstRegexSpace|\?!|A"
+    "stRegexStar|:!|AstRegexString|_|AstRegexVBar|9!|AstRegexWhitespace|1!|A"
+    "stRegexWildcard|0!|AstRegexZeroClosure|-!|AstRule|@|AstRuleLeftAssoc|J|"
+    "AstRuleList|%|AstRuleOperatorList|L|AstRuleOperatorSpec|M|AstRulePreced"
+    "ence|G|AstRulePrecedenceList|H|AstRulePrecedenceSpec|I|AstRuleRhs|B|Ast"
+    "RuleRhsList|A|AstRuleRightAssoc|K|AstString|%!|AstTableScheme|,|AstTerm"
+    "inalReference|N|AstToken|\\|AstTokenAction|;|AstTokenDeclaration|4|AstT"
+    "okenDescription|7|AstTokenError|>|AstTokenIgnore|=|AstTokenLexeme|<|Ast"
+    "TokenList|$|AstTokenOptionList|5|AstTokenPrecedence|:|AstTokenRegex|9|A"
+    "stTokenRegexList|8|AstTokenSync|\?|AstTokenTemplate|6|AstTripleString|&"
+    "!|AstTrue|'!|AstUnknown||AstZeroClosure|D|Unknown|)\"|}\"|//{ *//  Regu"
+    "lar Expression Grammar{ *//  --------------------------{ *//{ *//  Gram"
+    "mar file for the scanner regular expressions.{ *//{ *{ *options{ *{ *  "
+    "  lookaheads = 2{ *    conflicts = 0{ *    case_sensitive = true{ *{ *t"
+    "okens{ *{ *    <whitespace>         : regex = ''' \\s+ '''{ *          "
+    "                 ignore = true{ *{ *    <macro>              : regex = "
+    "''' \\{'+ [^{'-]* \\{'- '''{ *        { *    <charset>            : reg"
+    "ex = ''' \\[ ( [^\\]] {', \\\\ \\] )* \\] '''{ *        { *    <char>  "
+    "             : regex = ''' [^\?+*()\\[\\]{'+{'-{',.\\$\\s] '''{ *      "
+    "  { *rules       { *        { *    Regex                ::= RegexOr{ * "
+    "                        :   (AstRegex, $1){ *{ *    RegexOr            "
+    "  ::= RegexOrTerm ( '{',' RegexOrTerm : $2 )+{ *                       "
+    "  :   (AstRegexOr, $1, $2._){ *        { *    RegexOr              ::= "
+    "RegexOrTerm{ *        { *    RegexOrTerm          ::= RegexUnopTerm+{ *"
+    "                         :   (AstRegexList, $1._){ *        { *    Rege"
+    "xUnopTerm        ::= RegexUnopTerm '*'{ *                         :   ("
+    "AstRegexZeroClosure, $1){ *        { *    RegexUnopTerm        ::= Rege"
+    "xUnopTerm '+'{ *                         :   (AstRegexOneClosure, $1){ "
+    "*        { *    RegexUnopTerm        ::= RegexUnopTerm '\?'{ *         "
+    "                :   (AstRegexOptional, $1){ *        { *    RegexUnopTe"
+    "rm        ::= '(' RegexOr ')'{ *                         :   $2{ *     "
+    "   { *    RegexUnopTerm        ::= <macro>{ *                         :"
+    "   (AstMacroString, &1){ *        { *    RegexUnopTerm        ::= Chars"
+    "et{ *        { *    RegexUnopTerm        ::= Char{ *        { *    Char"
+    "set              ::= <charset>{ *                         :   (AstChars"
+    "etString, &1) { *{ *    Charset              ::= '.' { *               "
+    "          :   (AstRegexWildcard){ *{ *    Charset              ::= '\\\\"
+    "s' { *                         :   (AstRegexWhitespace){ *{ *    Charse"
+    "t              ::= '\\\\S' { *                         :   (AstRegexNot"
+    "Whitespace){ *{ *    Charset              ::= '\\\\d' { *              "
+    "           :   (AstRegexDigits){ *{ *    Charset              ::= '\\\\"
+    "D' { *                         :   (AstRegexNotDigits){ *{ *    Char   "
+    "              ::= <char>{ *                         :   (AstRegexChar, "
+    "&1){ *{ *    Char                 ::= '\\\\\\\\' { *                   "
+    "      :   (AstRegexEscape){ *{ *    Char                 ::= '$' { *   "
+    "                      :   (AstRegexAltNewline){ *{ *    Char           "
+    "      ::= '\\\\n' { *                         :   (AstRegexNewline){ *{"
+    " *    Char                 ::= '\\\\r' { *                         :   "
+    "(AstRegexCr){ *{ *    Char                 ::= '\\\\{',' { *           "
+    "              :   (AstRegexVBar){ *{ *    Char                 ::= '\\\\"
+    "*' { *                         :   (AstRegexStar){ *{ *    Char        "
+    "         ::= '\\\\+' { *                         :   (AstRegexPlus){ *{"
+    " *    Char                 ::= '\\\\\?' { *                         :  "
+    " (AstRegexQuestion){ *{ *    Char                 ::= '\\\\.' { *      "
+    "                   :   (AstRegexPeriod){ *{ *    Char                 :"
+    ":= '\\\\$' { *                         :   (AstRegexDollar){ *{ *    Ch"
+    "ar                 ::= '\\\\b' { *                         :   (AstRege"
+    "xSpace){ *{ *    Char                 ::= '\\\\(' { *                  "
+    "       :   (AstRegexLeftParen){ *{ *    Char                 ::= '\\\\)"
+    "' { *                         :   (AstRegexRightParen){ *{ *    Char   "
+    "              ::= '\\\\[' { *                         :   (AstRegexLeft"
+    "Bracket){ *{ *    Char                 ::= '\\\\]' { *                 "
+    "        :   (AstRegexRightBracket){ *{ *    Char                 ::= '\\"
+    "\\{'+' { *                         :   (AstRegexLeftBrace){ *{ *    Cha"
+    "r                 ::= '\\\\{'-' { *                         :   (AstReg"
+    "exRightBrace){ *{ *|}#|\"|}$|!|}%|K|}&||}'|M|}(|*eof*|')'|'{','|'\\\\{'"
+    ",'|'\\\\\\\\'|'\\\\]'|'\\\\b'|'\\\\d'|'\\\\n'|'\\\\r'|'\\\\s'|'\\\\{'+'"
+    "|'('|'\\\\{'-'|<char>|<charset>|<macro>|'\\\\$'|'$'|'.'|'\\\\['|'\\\\('"
+    "|'\\\\)'|'\\\\*'|'\\\\+'|'\\\\.'|'\\\\\?'|'\\\\D'|'\\\\S'|'\?'|'+'|'*'|"
+    "||||||||||*epsilon*|*error*|<whitespace>|})|!|!|!|!|!|!|!|!|!|!|!|!|!|!"
+    "|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|||||||||||!|!||}*|F\"|,\"|E\"|C\"|"
+    ";\"|<\"|=\"|>\"|\?\"|@\"|A\"|B\"|+\"|D\"|I\"|J\"|K\"|1\"|*\"|/\"|:\"|2\""
+    "|3\"|4\"|5\"|6\"|7\"|8\"|9\"|0\"|.\"|-\"|||||||||||G\"|H\"|L\"|}+||||||"
+    "|||||||||!|!|!||||||||||||||||||||||||||||!|},|I|}-|!|!|\"|\"|\"|!|!|!|"
+    "\"|!|\"|\"|\"|#|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|}"
+    ".|I|H|F|G|C|G|F|D|E|E|@|@|@|@|@|@|@|A|A|A|A|A|A|B|B|B|B|B|B|B|B|B|B|B|B"
+    "|B|B|B|B|B|B|}/|*accept* ::= Regex|Regex ::= RegexOr|RegexOr ::= RegexO"
+    "rTerm RegexOr:1|RegexOr:1 ::= RegexOr:1 RegexOr:2|RegexOr:2 ::= '{',' R"
+    "egexOrTerm|RegexOr:1 ::= RegexOr:2|RegexOr ::= RegexOrTerm|RegexOrTerm "
+    "::= RegexOrTerm:1|RegexOrTerm:1 ::= RegexOrTerm:1 RegexUnopTerm|RegexOr"
+    "Term:1 ::= RegexUnopTerm|RegexUnopTerm ::= RegexUnopTerm '*'|RegexUnopT"
+    "erm ::= RegexUnopTerm '+'|RegexUnopTerm ::= RegexUnopTerm '\?'|RegexUno"
+    "pTerm ::= '(' RegexOr ')'|RegexUnopTerm ::= <macro>|RegexUnopTerm ::= C"
+    "harset|RegexUnopTerm ::= Char|Charset ::= <charset>|Charset ::= '.'|Cha"
+    "rset ::= '\\\\s'|Charset ::= '\\\\S'|Charset ::= '\\\\d'|Charset ::= '\\"
+    "\\D'|Char ::= <char>|Char ::= '\\\\\\\\'|Char ::= '$'|Char ::= '\\\\n'|"
+    "Char ::= '\\\\r'|Char ::= '\\\\{','|Char ::= '\\\\*'|Char ::= '\\\\+'|C"
+    "har ::= '\\\\\?'|Char ::= '\\\\.'|Char ::= '\\\\$'|Char ::= '\\\\b'|Cha"
+    "r ::= '\\\\('|Char ::= '\\\\)'|Char ::= '\\\\['|Char ::= '\\\\]'|Char :"
+    ":= '\\\\{'+'|Char ::= '\\\\{'-'|}0|!~!~.!|4!|:!|!~!~=!|B!|!~H!|L!|P!|T!"
+    "|W!|!~!~\\!|!\"|$\"|'\"|*\"|-\"|0\"|5\"|8\"|;\"|>\"|A\"|D\"|G\"|J\"|M\""
+    "|P\"|S\"|V\"|Y\"|\\\"|_\"|\"#|%#|}1|\"|}2||}3|M|}4|R|}5||M|:!|'\"|T\"|A"
+    "#|.$|[$|H%|5&|\"'|O'|<(|))|V)|C*|0+|]+|J,|7-|$.|Q.|>/|+0|X0|E1|22|_2|L3"
+    "|94|&5|S5|@6|-7|Z7|G8|49|!:|N:|;;|(<|U<|B=|/>|\\>|I\?|6@|#A|PA|=B|}6|*C"
+    "|}7|!~!~!~!P\"|!P!|!X!|! \"|!(\"|!0\"|!8\"|!@\"|!H\"|!0|!X\"|! #|!(#|!0"
+    "#|!@|!(|!8|!H!|!H|!P|!X|! !|!(!|!0!|!8!|!@!|!~!~!~#($|#@#|#8#|!~#X#|# $"
+    "|#P#|!~#H#|!~!~!~!~*K%|*3%|*;$|*S\"|*S!|*[!|*#\"|*+\"|*3\"|*;\"|*C\"|*K"
+    "\"|*3|*[\"|*##|*+#|*3#|*C|*+|*;|*K!|*K|*S|*[|*#!|*+!|*3!|*;!|*C!|*+%|*#"
+    "%|*[$|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!P\"|!P!|!X!|! \"|!(\"|!0\"|!8\"|"
+    "!@\"|!H\"|!0|!X\"|! #|!(#|!0#|!@|!(|!8|!H!|!H|!P|!X|! !|!(!|!0!|!8!|!@!"
+    "|!~!~!~#($|#@#|#8#|!~#X#|# $|#0$|!~!~!~!~!~!~2J%|22%|2:$|2R\"|2R!|2Z!|2"
+    "\"\"|2*\"|22\"|2:\"|2B\"|2J\"|22|2Z\"|2\"#|2*#|22#|2B|2*|2:|2J!|2J|2R|2"
+    "Z|2\"!|2*!|22!|2:!|2B!|2*%|2\"%|2Z$|!~!~!~!~!~!~!~!~!~!~!~!~!~*L%|*4%|*"
+    "<$|*T\"|*T!|*\\!|*$\"|*,\"|*4\"|*<\"|*D\"|*L\"|*4|*\\\"|*$#|*,#|*4#|*D|"
+    "*,|*<|*L!|*L|*T|*\\|*$!|*,!|*4!|*<!|*D!|*,%|*$%|*\\$|!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~:L%|:4%|:<$|:T\"|:T!|:\\!|:$\"|:,\"|:4\"|:<\"|:D\"|:L\"|:4|:\\\""
+    "|:$#|:,#|:4#|:D|:,|:<|:L!|:L|:T|:\\|:$!|:,!|:4!|:<!|:D!|:,%|:$%|:\\$|!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~BL%|B4%|B<$|BT\"|BT!|B\\!|B$\"|B,\"|B4\"|B<\"|B"
+    "D\"|BL\"|B4|B\\\"|B$#|B,#|B4#|BD|B,|B<|BL!|BL|BT|B\\|B$!|B,!|B4!|B<!|BD"
+    "!|B,%|B$%|B\\$|!~!~!~!~!~!~!~!~!~!~!~!~!~JK%|J3%|J;$|JS\"|JS!|J[!|J#\"|"
+    "J+\"|J3\"|J;\"|JC\"|JK\"|J3|J[\"|J##|J+#|J3#|JC|J+|J;|JK!|JK|JS|J[|J#!|"
+    "J+!|J3!|J;!|JC!|J+%|J#%|J[$|!~!~!~!~!~!~!~!~!~!~!~!~!~RK%|R3%|R;$|RS\"|"
+    "RS!|R[!|R#\"|R+\"|R3\"|R;\"|RC\"|RK\"|R3|R[\"|R##|R+#|R3#|RC|R+|R;|RK!|"
+    "RK|RS|R[|R#!|R+!|R3!|R;!|RC!|R+%|R#%|R[$|!~!~!~!~!~!~!~!~!~!~!~!~!~\"L%"
+    "|\"4%|\"<$|\"T\"|\"T!|\"\\!|\"$\"|\",\"|\"4\"|\"<\"|\"D\"|\"L\"|\"4|\"\\"
+    "\"|\"$#|\",#|\"4#|\"D|\",|\"<|\"L!|\"L|\"T|\"\\|\"$!|\",!|\"4!|\"<!|\"D"
+    "!|\",%|\"$%|\"\\$|!~!~!~!~!~!~!~!~!~!~!~!~!~ZK%|Z3%|Z;$|ZS\"|ZS!|Z[!|Z#"
+    "\"|Z+\"|Z3\"|Z;\"|ZC\"|ZK\"|Z3|Z[\"|Z##|Z+#|Z3#|ZC|Z+|Z;|ZK!|ZK|ZS|Z[|Z"
+    "#!|Z+!|Z3!|Z;!|ZC!|Z+%|Z#%|Z[$|!~!~!~!~!~!~!~!~!~!~!~!~!~RJ%|R2%|R:$|RR"
+    "\"|RR!|RZ!|R\"\"|R*\"|R2\"|R:\"|RB\"|RJ\"|R2|RZ\"|R\"#|R*#|R2#|RB|R*|R:"
+    "|RJ!|RJ|RR|RZ|R\"!|R*!|R2!|R:!|RB!|R*%|R\"%|RZ$|!~!~!~!~!~!~!~!~!~!~!~!"
+    "~!~BJ%|B2%|B:$|BR\"|BR!|BZ!|B\"\"|B*\"|B2\"|B:\"|BB\"|BJ\"|B2|BZ\"|B\"#"
+    "|B*#|B2#|BB|B*|B:|BJ!|BJ|BR|BZ|B\"!|B*!|B2!|B:!|BB!|B*%|B\"%|BZ$|!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~JL%|J4%|J<$|JT\"|JT!|J\\!|J$\"|J,\"|J4\"|J<\"|JD\"|"
+    "JL\"|J4|J\\\"|J$#|J,#|J4#|JD|J,|J<|JL!|JL|JT|J\\|J$!|J,!|J4!|J<!|JD!|J,"
+    "%|J$%|J\\$|!~!~!~!~!~!~!~!~!~!~!~!~!~\"K%|\"3%|\";$|\"S\"|\"S!|\"[!|\"#"
+    "\"|\"+\"|\"3\"|\";\"|\"C\"|\"K\"|\"3|\"[\"|\"##|\"+#|\"3#|\"C|\"+|\";|\""
+    "K!|\"K|\"S|\"[|\"#!|\"+!|\"3!|\";!|\"C!|\"+%|\"#%|\"[$|!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~RL%|R4%|R<$|RT\"|RT!|R\\!|R$\"|R,\"|R4\"|R<\"|RD\"|RL\"|R4|R\\"
+    "\"|R$#|R,#|R4#|RD|R,|R<|RL!|RL|RT|R\\|R$!|R,!|R4!|R<!|RD!|R,%|R$%|R\\$|"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~2L%|24%|2<$|2T\"|2T!|2\\!|2$\"|2,\"|24\"|2<\""
+    "|2D\"|2L\"|24|2\\\"|2$#|2,#|24#|2D|2,|2<|2L!|2L|2T|2\\|2$!|2,!|24!|2<!|"
+    "2D!|2,%|2$%|2\\$|!~!~!~!~!~!~!~!~!~!~!~!~!~JJ%|J2%|J:$|JR\"|JR!|JZ!|J\""
+    "\"|J*\"|J2\"|J:\"|JB\"|JJ\"|J2|JZ\"|J\"#|J*#|J2#|JB|J*|J:|JJ!|JJ|JR|JZ|"
+    "J\"!|J*!|J2!|J:!|JB!|J*%|J\"%|JZ$|!~!~!~!~!~!~!~!~!~!~!~!~!~2K%|23%|2;$"
+    "|2S\"|2S!|2[!|2#\"|2+\"|23\"|2;\"|2C\"|2K\"|23|2[\"|2##|2+#|23#|2C|2+|2"
+    ";|2K!|2K|2S|2[|2#!|2+!|23!|2;!|2C!|2+%|2#%|2[$|!~!~!~!~!~!~!~!~!~!~!~!~"
+    "!~:K%|:3%|:;$|:S\"|:S!|:[!|:#\"|:+\"|:3\"|:;\"|:C\"|:K\"|:3|:[\"|:##|:+"
+    "#|:3#|:C|:+|:;|:K!|:K|:S|:[|:#!|:+!|:3!|:;!|:C!|:+%|:#%|:[$|!~!~!~!~!~!"
+    "~!~!~!~!~!~!~!~:J%|:2%|::$|:R\"|:R!|:Z!|:\"\"|:*\"|:2\"|::\"|:B\"|:J\"|"
+    ":2|:Z\"|:\"#|:*#|:2#|:B|:*|::|:J!|:J|:R|:Z|:\"!|:*!|:2!|::!|:B!|:*%|:\""
+    "%|:Z$|!~!~!~!~!~!~!~!~!~!~!~!~!~ZL%|Z4%|Z<$|ZT\"|ZT!|Z\\!|Z$\"|Z,\"|Z4\""
+    "|Z<\"|ZD\"|ZL\"|Z4|Z\\\"|Z$#|Z,#|Z4#|ZD|Z,|Z<|ZL!|ZL|ZT|Z\\|Z$!|Z,!|Z4!"
+    "|Z<!|ZD!|Z,%|Z$%|Z\\$|!~!~!~!~!~!~!~!~!~!~!~!~!~BK%|B3%|B;$|BS\"|BS!|B["
+    "!|B#\"|B+\"|B3\"|B;\"|BC\"|BK\"|B3|B[\"|B##|B+#|B3#|BC|B+|B;|BK!|BK|BS|"
+    "B[|B#!|B+!|B3!|B;!|BC!|B+%|B#%|B[$|!~!~!~!~!~!~!~!~!~!~!~!~!~\"M%|\"5%|"
+    "\"=$|\"U\"|\"U!|\"]!|\"%\"|\"-\"|\"5\"|\"=\"|\"E\"|\"M\"|\"5|\"]\"|\"%#"
+    "|\"-#|\"5#|\"E|\"-|\"=|\"M!|\"M|\"U|\"]|\"%!|\"-!|\"5!|\"=!|\"E!|\"-%|\""
+    "%%|\"]$|!~!~!~!~!~!~!~!~!~!~!~!~!~ZJ%|Z2%|Z:$|ZR\"|ZR!|ZZ!|Z\"\"|Z*\"|Z"
+    "2\"|Z:\"|ZB\"|ZJ\"|Z2|ZZ\"|Z\"#|Z*#|Z2#|ZB|Z*|Z:|ZJ!|ZJ|ZR|ZZ|Z\"!|Z*!|"
+    "Z2!|Z:!|ZB!|Z*%|Z\"%|ZZ$|!~!~!~!~!~!~!~!~!~!~!~!~!~*J%|*2%|*:$|*R\"|*R!"
+    "|*Z!|*\"\"|**\"|*2\"|*:\"|*B\"|*J\"|*2|*Z\"|*\"#|**#|*2#|*B|**|*:|*J!|*"
+    "J|*R|*Z|*\"!|**!|*2!|*:!|*B!|**%|*\"%|*Z$|!~!~!~!~!~!~!~!~!~!~!~!~!~RI%"
+    "|R1%|R9$|RQ\"|RQ!|RY!|R!\"|R)\"|R1\"|R9\"|RA\"|RI\"|R1|RY\"|R!#|R)#|R1#"
+    "|RA|R)|R9|RI!|RI|RQ|RY|R!!|R)!|R1!|R9!|RA!|R)%|R!%|RY$|!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~\"J%|\"2%|\":$|\"R\"|\"R!|\"Z!|\"\"\"|\"*\"|\"2\"|\":\"|\"B\""
+    "|\"J\"|\"2|\"Z\"|\"\"#|\"*#|\"2#|\"B|\"*|\":|\"J!|\"J|\"R|\"Z|\"\"!|\"*"
+    "!|\"2!|\":!|\"B!|\"*%|\"\"%|\"Z$|!~!~!~!~!~!~!~!~!~!~!~!~!~ZI%|Z1%|Z9$|"
+    "ZQ\"|ZQ!|ZY!|Z!\"|Z)\"|Z1\"|Z9\"|ZA\"|ZI\"|Z1|ZY\"|Z!#|Z)#|Z1#|ZA|Z)|Z9"
+    "|ZI!|ZI|ZQ|ZY|Z!!|Z)!|Z1!|Z9!|ZA!|Z)%|Z!%|ZY$|!~!~!~!~!~!~!~!~!~!~!~!~!"
+    "~%|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~*H%|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!"
+    "~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~RH%|R0%|!8$|!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~#H$|!~!~!~#@$|!~!~!~!~!~Z"
+    "H%|Z0%|Z8$|!P\"|!P!|!X!|! \"|!(\"|!0\"|!8\"|!@\"|!H\"|!0|!X\"|! #|!(#|!"
+    "0#|!@|!(|!8|!H!|!H|!P|!X|! !|!(!|!0!|!8!|!@!|!~!~!~#P$|#@#|#8#|!~!~!~!~"
+    "!~!~!~!~!~!~*I%|*1%|*9$|*Q\"|*Q!|*Y!|*!\"|*)\"|*1\"|*9\"|*A\"|*I\"|*1|*"
+    "Y\"|*!#|*)#|*1#|*A|*)|*9|*I!|*I|*Q|*Y|*!!|*)!|*1!|*9!|*A!|!(%|! %|!X$|!"
+    "~!~!~!~!~!~!~!~!~!~!~!~!~!~!0%|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!P\"|!P!|!X!|! \"|!"
+    "(\"|!0\"|!8\"|!@\"|!H\"|!0|!X\"|! #|!(#|!0#|!@|!(|!8|!H!|!H|!P|!X|! !|!"
+    "(!|!0!|!8!|!@!|!~!~!~#($|#@#|#8#|!~#8%|# $|!~!~!~!~!~!~!~2H%|20%|!8$|!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~#@%|!~!~!"
+    "~!~!~!~!~!~!~JH%|J0%|J8$|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~\"I%|\"1%|\"9$|\"Q\"|\"Q!|\"Y!|\""
+    "!\"|\")\"|\"1\"|\"9\"|\"A\"|\"I\"|\"1|\"Y\"|\"!#|\")#|\"1#|\"A|\")|\"9|"
+    "\"I!|\"I|\"Q|\"Y|\"!!|\")!|\"1!|\"9!|\"A!|!(%|! %|!X$|!~!~!~!~!~!~!~!~!"
+    "~!~!~!~!~2I%|21%|29$|2Q\"|2Q!|2Y!|2!\"|2)\"|21\"|29\"|2A\"|2I\"|21|2Y\""
+    "|2!#|2)#|21#|2A|2)|29|2I!|2I|2Q|2Y|2!!|2)!|21!|29!|2A!|2)%|2!%|2Y$|!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~:I%|:1%|:9$|:Q\"|:Q!|:Y!|:!\"|:)\"|:1\"|:9\"|:A\""
+    "|:I\"|:1|:Y\"|:!#|:)#|:1#|:A|:)|:9|:I!|:I|:Q|:Y|:!!|:)!|:1!|:9!|:A!|:)%"
+    "|:!%|:Y$|!~!~!~!~!~!~!~!~!~!~!~!~!~BI%|B1%|B9$|BQ\"|BQ!|BY!|B!\"|B)\"|B"
+    "1\"|B9\"|BA\"|BI\"|B1|BY\"|B!#|B)#|B1#|BA|B)|B9|BI!|BI|BQ|BY|B!!|B)!|B1"
+    "!|B9!|BA!|B)%|B!%|BY$|!~!~!~!~!~!~!~!~!~!~!~!~!~JI%|J1%|J9$|JQ\"|JQ!|JY"
+    "!|J!\"|J)\"|J1\"|J9\"|JA\"|JI\"|J1|JY\"|J!#|J)#|J1#|JA|J)|J9|JI!|JI|JQ|"
+    "JY|J!!|J)!|J1!|J9!|JA!|J)%|J!%|JY$|!~!~!~!~!~!~!~!~!~!~!~!~!~BH%|B0%|B8"
+    "$|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!"
+    "~!~!~!~!~!~!~!~:H%|:0%|:8$|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~%|!0%|!8$|!P\"|!P!|!X!|! \"|!(\""
+    "|!0\"|!8\"|!@\"|!H\"|!0|!X\"|! #|!(#|!0#|!@|!(|!8|!H!|!H|!P|!X|! !|!(!|"
+    "!0!|!8!|!@!|!(%|! %|!X$|#(&|#@#|#8#|#X%|# &|# $|#P%|#@$|#H#|!~!~!~!~*H%"
+    "|!0%|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~$H%|$0%|$8$|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!"
+    "~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~$H%|$0%|$8$|!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~#H$|!~!~!~#@$|!~!~!~!"
+    "~!~$H%|$0%|$8$|$P\"|$P!|$X!|$ \"|$(\"|$0\"|$8\"|$@\"|$H\"|$0|$X\"|$ #|$"
+    "(#|$0#|$@|$(|$8|$H!|$H|$P|$X|$ !|$(!|$0!|$8!|$@!|!(%|! %|!X$|!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~}8|!|}9||}:||};||}<||}=||}>|'|}\?||}@|#|}A|_|}B||}C|)|}"
+    "D|_|}E||}F|)|}G|_|}H|Null||Halt|!|Label|\"|Call|#|ScanStart|$|ScanChar|"
     "%|ScanAccept|&|ScanToken|'|ScanError|(|AstStart|)|AstFinish|*|AstNew|+|"
     "AstForm|,|AstLoad|-|AstIndex|.|AstChild|/|AstChildSlice|0|AstKind|1|Ast"
     "KindNum|2|AstLocation|3|AstLocationNum|4|AstLexeme|5|AstLexemeString|6|"
     "Assign|7|DumpStack|8|Add|9|Subtract|:|Multiply|;|Divide|<|UnaryMinus|=|"
-    "Return|>|Branch|?|BranchEqual|@|BranchNotEqual|A|BranchLessThan|B|Branc"
-    "hLessEqual|C|BranchGreaterThan|D|BranchGreaterEqual|E|}I|U\"|}J|O$|}K|7"
-    "|!~|$||>|!~\"|$|!~\"|%|!~\"|(||C|$|D|D|&|E|L|$|M|M|(|N|:!|$|<!|<!|*|>!|"
-    ">!|D|?!|_____#|$|&|\"$|;|*|F|%|!~=||&|24|>|!|F|%|!~@||&|E)|A|/|F|%|!~C|"
-    "|&|\"$|D|*|F|%|!~F|,|D|D|,|M|M|.|$!|$!|0|3!|3!|2|;!|;!|4|<!|<!|6|=!|=!|"
-    "8|>!|>!|:|D!|D!|<|N!|N!|>|R!|R!|@|S!|S!|B|&|&;|+!|\"|F|%|!~-!||&|P9|.!|"
-    "#|F|%|!~0!||&|>1|1!|+|F|%|!~3!||&|G.|4!|,|F|%|!~6!||&|><|7!|$|F|%|!~9!|"
-    "|&|Y2|:!|%|F|%|!~<!||&|[=|=!|&|F|%|!~?!||&|98|@!|'|F|%|!~B!||&|&0|C!|-|"
-    "F|%|!~E!||&|L5|F!|(|F|%|!~H!||&|%7|I!|)|F|%|!~K!||&|+-|L!|.|F|%|!~N!||&"
-    "|O%|O!|0|F|%|!~Q!||'|!~R!|9|!~R!|$|$|!|>|!~U!|)|=&|U!|\"|+|=&|V!|#|-|Q&"
-    "|W!||\"|!~0|S&|Z!|||!~,|=&|]!|\"|#|\"|2|>&| \"|=!|*|=&|!\"|\"|>|6%|\"\""
-    "|)|M(|\"\"|#|+|M(|#\"|\"|-|[(|$\"||#|!~0|](|'\"|||!~,|M(|*\"|#|\"|!|2|N"
-    "(|-\"|<!|*|M(|.\"|!|>|I'|/\"|)|I'|/\"|\"|+|I'|0\"|#|-|I'|1\"||\"|\"~0|I"
-    "'|4\"|||!~-|I'|7\"||\"|!~/|I'|:\"||,|I'|;\"|\"|#|\"|2|I'|>\"|_!|*|I'|?\""
-    "|\"|>|I'|@\"|)|I'|@\"|#|+|I'|A\"|\"|-|I'|B\"||#|!~/|I'|E\"||,|I'|F\"|#|"
-    "\"|!|2|I'|I\"|_!|*|I'|J\"|!|>|I'|K\"|)|,*|K\"|\"|+|,*|L\"|#|-|?*|M\"||\""
-    "|#~/|>*|P\"||-|C*|Q\"||\"|!~/|B*|T\"||,|,*|U\"|\"|#|#|2|-*|X\"|>!|-|G*|"
-    "Y\"||\"|\"~3|F*|\\\"||*|,*|]\"|#|>|')|^\"|)|5,|^\"|#|+|5,|_\"|\"|-|H,| "
-    "#||#|!~/|G,|##||,|5,|$#|#|\"|!|2|6,|'#|>!|*|5,|(#|!|>|9+|)#|)|P-|)#|\"|"
-    "+|P-|*#|#|,|P-|+#|\"|#|!|2|Q-|.#|@!|*|P-|/#|!|>|R,|0#|)|,/|0#|#|+|,/|1#"
-    "|\"|,|,/|2#|#|\"|!|2|-/|5#|A!|*|,/|6#|!|>|..|7#|)|K0|7#|\"|+|K0|8#|#|,|"
-    "K0|9#|\"|#|!|2|L0|<#|B!|*|K0|=#|!|>|M/|>#|)|#2|>#|#|+|#2|?#|\"|,|#2|@#|"
-    "#|\"|!|2|$2|C#|C!|*|#2|D#|!|>|%1|E#|)|?3|E#|\"|+|?3|F#|#|,|?3|G#|\"|#|!"
-    "|2|@3|J#|D!|*|?3|K#|!|>|@2|L#|)|U4|L#|#|+|U4|M#|\"|,|U4|N#|#|\"|!|2|V4|"
-    "Q#|E!|*|U4|R#|!|>|Y3|S#|)|16|S#|\"|+|16|T#|#|,|16|U#|\"|#|!|2|26|X#|F!|"
-    "*|16|Y#|!|>|35|Z#|)|J7|Z#|#|+|J7|[#|\"|,|J7|\\#|#|\"|!|2|K7|_#|G!|*|J7|"
-    " $|!|>|L6|!$|)|^8|!$|\"|+|^8|\"$|#|,|^8|#$|\"|#|!|2|_8|&$|H!|*|^8|'$|!|"
-    ">| 8|($|)|5:|($|#|+|5:|)$|\"|,|5:|*$|#|\"|!|2|6:|-$|I!|*|5:|.$|!|>|79|/"
-    "$|)|K;|/$|\"|+|K;|0$|#|,|K;|1$|\"|#|!|2|L;|4$|J!|*|K;|5$|!|>|M:|6$|)|#="
-    "|6$|#|+|#=|7$|\"|,|#=|8$|#|\"|!|2|$=|;$|K!|*|#=|<$|!|>|%<|=$|)|@>|=$|\""
-    "|+|@>|>$|#|,|@>|?$|\"|#|!|2|A>|B$|L!|*|@>|C$|!|>|B=|D$|)|^?|D$|#|+|^?|E"
-    "$|\"|,|^?|F$|#|\"|!|2|_?|I$|?!|-|0@|J$||#|!~5|/@|M$||*|^?|N$|!|>| ?|O$|"
-    "}L|%|}M||0|!|1||Temp$0||Temp$1||token_count|}N|!|}O||}P|}Q|}"
+    "Return|>|Branch|\?|BranchEqual|@|BranchNotEqual|A|BranchLessThan|B|Bran"
+    "chLessEqual|C|BranchGreaterThan|D|BranchGreaterEqual|E|ScanClass|F|Scan"
+    "Keyword|G|ScanClassMemo|H|ScanLazy|I|AstLoadChild|J|AstFormKind|K|AstFi"
+    "nishReturn|L|}I|(#|}J|)'|}K|7|!~|$||>|!~\"|$|!~\"|F|!~\"||5|$|&|(|*|,|."
+    "|0|2|4|$|$|6|<|!~$|$|$|$|$|&!|)!|&|Y&|9|.|+!|%|!~;||&|3#|<|L|\"|F|!~>|!"
+    "|!|&|&|GB|A|2|+!|%|!~C||&|E3|D|,|+!|%|!~F||&|Q3|G|!|+!|%|!~I||&|J.|J|\?"
+    "|+!|%|!~L||&|90|M|>|+!|%|!~O||&|19|P|3|+!|%|!~R||&|'2|S|=|+!|%|!~U||%|!"
+    "~V|$||;!|6|<!|<!|7|=!|=!|:|>!|_____#|6|%|!~#!|$||;!|6|<!|<!|7|=!|=!|8|>"
+    "!|_____#|6|&|L%|0!|/|+!|%|!~2!|$||;!|6|<!|<!|7|=!|=!|:|>!|_____#|6|&|L%"
+    "|\?!|/|+!|%|!~A!||&|Y&|B!|.|+!|F|!~D!|\"|4|>|@|B|D|F|H|J|L|N|P|R|T|V|X|"
+    "Z|\\|^| !|\"!|$!|&|ZL|Z!|1|+!|%|!~\\!||&|\?O|]!|5|+!|%|!~_!||&|UP| \"|6"
+    "|+!|%|!~\"\"||&|PG|#\"|7|+!|%|!~%\"||&|!I|&\"|8|+!|%|!~(\"||&|GK|)\"|9|"
+    "+!|%|!~+\"||&|2J|,\"|:|+!|%|!~.\"||&|H>|/\"|;|+!|%|!~1\"||&|[;|2\"|<|+!"
+    "|%|!~4\"||&|,R|5\"|4|+!|%|!~7\"||&|3A|8\"|$|+!|%|!~:\"||&|DS|;\"|%|+!|%"
+    "|!~=\"||&|-N|>\"|&|+!|%|!~@\"||&|5=|A\"|'|+!|%|!~C\"||&|\\C|D\"|(|+!|%|"
+    "!~F\"||&|0E|G\"|)|+!|%|!~I\"||&|D:|J\"|*|+!|%|!~L\"||&|]T|M\"|+|+!|%|!~"
+    "O\"||&|\?F|P\"|#|+!|%|!~R\"||&|3V|S\"|-|+!|%|!~U\"||%|!~V\"|#||\\!|&!|]"
+    "!|]!|'!|^!|_____#|&!|&|L$| #|0|+!|%|!~\"#||&|1*|##|\"|+!|%|!~%#||'|!~&#"
+    "|9|!~&#|$|$|!|>|!~)#|)|&+|)#|\"|J|4+|*#||\"|\"~-|8+|-#||\"|!~0|:+|0#|||"
+    "!~K|&+|3#|\"|\"|\"|*!|L|&+|7#|\"|)|#*|8#|\"|-|#*|9#||\"|\"~0|#*|<#|||!~"
+    "J|#*|\?#||\"|!~K|#*|B#|\"|\"|\"|)\"|L|#*|F#|\"|)|C*|G#|\"|J|D*|H#|!|\"|"
+    "!~L|C*|K#|\"|)|A-|L#|\"|-|Q-|M#||\"|!~0|S-|P#|||!~K|A-|S#|\"|\"|!|+!|L|"
+    "A-|W#|!|)|<,|X#|\"|-|<,|Y#||\"|\"~0|<,|\\#|||!~J|<,|_#|!|\"|!~K|<,|\"$|"
+    "\"|\"|\"|)\"|L|<,|&$|\"|)|+/|'$|\"|J|B/|($||\"|\"~K|+/|+$|\"|\"|\"|-!|L"
+    "|+/|/$|\"|)|Z0|0$|\"|J|01|1$||\"|\"~K|Z0|4$|\"|\"|\"|.!|L|Z0|8$|\"|)|H2"
+    "|9$|\"|J|\\2|:$||\"|\"~K|H2|=$|\"|\"|\"|,!|L|H2|A$|\"|)|24|B$|\"|J|34|C"
+    "$|!|\"|\"~L|24|F$|#|)|@5|G$|\"|K|@5|H$|\"|\"|!|!!|-|R5|L$||\"|!~5|Q5|O$"
+    "||L|@5|P$|!|)|;8|Q$|\"|K|;8|R$|\"|\"|!| !|-|O8|V$||\"|!~5|N8|Y$||L|;8|Z"
+    "$|!|)|S9|[$|\"|K|S9|\\$|\"|\"|!|0!|L|S9| %|!|)|(;|!%|\"|K|(;|\"%|\"|\"|"
+    "!|1!|L|(;|&%|!|)|\?<|'%|\"|K|\?<|(%|\"|\"|!|2!|L|\?<|,%|!|)|Y=|-%|\"|K|"
+    "Y=|.%|\"|\"|!|3!|L|Y=|2%|!|)|,\?|3%|\"|K|,\?|4%|\"|\"|!|4!|L|,\?|8%|!|)"
+    "|B@|9%|\"|K|B@|:%|\"|\"|!|/!|-|R@|>%||\"|!~5|Q@|A%||L|B@|B%|!|)|XA|C%|\""
+    "|K|XA|D%|\"|\"|!|5!|L|XA|H%|!|)|)C|I%|\"|K|)C|J%|\"|\"|!|6!|L|)C|N%|!|)"
+    "|@D|O%|\"|K|@D|P%|\"|\"|!|7!|L|@D|T%|!|)|TE|U%|\"|K|TE|V%|\"|\"|!|8!|L|"
+    "TE|Z%|!|)|#G|[%|\"|K|#G|\\%|\"|\"|!|9!|L|#G| &|!|)|4H|!&|\"|K|4H|\"&|\""
+    "|\"|!|:!|L|4H|&&|!|)|EI|'&|\"|K|EI|(&|\"|\"|!|;!|L|EI|,&|!|)|VJ|-&|\"|K"
+    "|VJ|.&|\"|\"|!|<!|L|VJ|2&|!|)|+L|3&|\"|K|+L|4&|\"|\"|!|=!|L|+L|8&|!|)|>"
+    "M|9&|\"|K|>M|:&|\"|\"|!|>!|L|>M|>&|!|)|QN|\?&|\"|K|QN|@&|\"|\"|!|\?!|L|"
+    "QN|D&|!|)|#P|E&|\"|K|#P|F&|\"|\"|!|@!|L|#P|J&|!|)|9Q|K&|\"|K|9Q|L&|\"|\""
+    "|!|A!|L|9Q|P&|!|)|PR|Q&|\"|K|PR|R&|\"|\"|!|B!|L|PR|V&|!|)|(T|W&|\"|K|(T"
+    "|X&|\"|\"|!|C!|L|(T|\\&|!|)|AU|]&|\"|K|AU|^&|\"|\"|!|D!|L|AU|\"'|!|)|WV"
+    "|#'|\"|K|WV|$'|\"|\"|!|E!|L|WV|('|!|}L|%|}M||0|!|1||Temp$0||Temp$1||tok"
+    "en_count|}N|\"|}O||}P|}R|#|}S||}T|}U||}V||}W|}X|0|}Y|!|}Z||}[| $|}\\|||"
+    "|||||||!|!|!|!|!|||||||||||||||||||!||||\"||||#|$|%|&|||'||||||||||||||"
+    "|||(|||||)|||||||||||||||*||||||||+|,|-|||||.||/||||||||||0||||1|2|||||"
+    "|||3|4|5|||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||"
+    "||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||}]|"
+    "!|}^| $|}_||} !|!~)!|!~!~!~)\"|!~!~!~)\"|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~}!!||}\"!||||||||||||||||||||||||||||||"
+    "||||||||||||||||}#!||}$!||}Q|}"
+};
+
+static const char* charset_str =
+{
+    "|#|}!|'$'|*\"|'-'|+\"|'\\\\$'|,\"|'\\\\-'|-\"|'\\\\D'|.\"|'\\\\S'|/\"|'"
+    "\\\\['|0\"|'\\\\\\\\'|1\"|'\\\\]'|2\"|'\\\\^'|3\"|'\\\\d'|4\"|'\\\\n'|5"
+    "\"|'\\\\r'|6\"|'\\\\s'|7\"|'^'|8\"|*eof*|9\"|*epsilon*|:\"|*error*|;\"|"
+    "<char>|<\"|AstActionAdd|_!|AstActionAnd|$\"|AstActionAssign|X!|AstActio"
+    "nDivide|\"\"|AstActionDumpStack|'\"|AstActionEqual|Y!|AstActionGreaterE"
+    "qual|^!|AstActionGreaterThan|]!|AstActionLessEqual|\\!|AstActionLessTha"
+    "n|[!|AstActionMultiply|!\"|AstActionNot|&\"|AstActionNotEqual|Z!|AstAct"
+    "ionOr|%\"|AstActionStatementList|W!|AstActionSubtract| \"|AstActionToke"
+    "nCount|(\"|AstActionUnaryMinus|#\"|AstAstChild|S|AstAstDot|Z|AstAstForm"
+    "er|Q|AstAstItemList|R|AstAstKind|T|AstAstLexeme|W|AstAstLexemeString|X|"
+    "AstAstLocation|U|AstAstLocationString|V|AstAstLocator|Y|AstAstSlice|[|A"
+    "stCaseSensitive|*|AstCharset|F!|AstCharsetAltNewline|O!|AstCharsetCaret"
+    "|R!|AstCharsetChar|I!|AstCharsetCr|Q!|AstCharsetDash|S!|AstCharsetDigit"
+    "s|L!|AstCharsetDollar|T!|AstCharsetEscape|N!|AstCharsetInvert|G!|AstCha"
+    "rsetLeftBracket|U!|AstCharsetNewline|P!|AstCharsetNotDigits|M!|AstChars"
+    "etNotWhitespace|K!|AstCharsetRange|H!|AstCharsetRightBracket|V!|AstChar"
+    "setString| !|AstCharsetWhitespace|J!|AstConflicts|(|AstEmpty|P|AstError"
+    "Recovery|'|AstFalse|(!|AstGrammar|\"|AstGroup|F|AstIdentifier|\"!|AstIn"
+    "teger|#!|AstInternLexemes|1|AstKeepWhitespace|)|AstKeywordTable|-|AstLa"
+    "zyAst|2|AstLazyScanner|/|AstLinearScan|.|AstLookaheadMethod|+|AstLookah"
+    "eads|&|AstMacroString|!!|AstMinimizeMethod|3|AstNegativeInteger|$!|AstN"
+    "onterminalReference|O|AstNull|!|AstOneClosure|E|AstOptionList|#|AstOpti"
+    "onal|C|AstOptions|]|AstPipelineScanner|0|AstReduceActions|^|AstRegex|)!"
+    "|AstRegexAltNewline|6!|AstRegexChar|/!|AstRegexCr|8!|AstRegexDigits|3!|"
+    "AstRegexDollar|>!|AstRegexEscape|5!|AstRegexLeftBrace|D!|AstRegexLeftBr"
+    "acket|B!|AstRegexLeftParen|@!|AstRegexList|+!|AstRegexNewline|7!|AstReg"
+    "exNotDigits|4!|AstRegexNotWhitespace|2!|AstRegexOneClosure|.!|AstRegexO"
+    "ptional|,!|AstRegexOr|*!|AstRegexPeriod|=!|AstRegexPlus|;!|AstRegexQues"
+    "tion|<!|AstRegexRightBrace|E!|AstRegexRightBracket|C!|AstRegexRightPare"
+    "n|A!|AstRegexSpace|\?!|AstRegexStar|:!|AstRegexString|_|AstRegexVBar|9!"
+    "|AstRegexWhitespace|1!|AstRegexWildcard|0!|AstRegexZeroClosure|-!|AstRu"
+    "le|@|AstRuleLeftAssoc|J|AstRuleList|%|AstRuleOperatorList|L|AstRuleOper"
+    "atorSpec|M|AstRulePrecedence|G|AstRulePrecedenceList|H|AstRulePrecedenc"
+    "eSpec|I|AstRuleRhs|B|AstRuleRhsList|A|AstRuleRightAssoc|K|AstString|%!|"
+    "AstTableScheme|,|AstTerminalReference|N|AstToken|\\|AstTokenAction|;|As"
+    "tTokenDeclaration|4|AstTokenDescription|7|AstTokenError|>|AstTokenIgnor"
+    "e|=|AstTokenLexeme|<|AstTokenList|$|AstTokenOptionList|5|AstTokenPreced"
+    "ence|:|AstTokenRegex|9|AstTokenRegexList|8|AstTokenSync|\?|AstTokenTemp"
+    "late|6|AstTripleString|&!|AstTrue|'!|AstUnknown||AstZeroClosure|D|Unkno"
+    "wn|)\"|}\"|//{ *//  Character Set Grammar{ *//  ---------------------{ "
+    "*//{ *//  Grammar file for the scanner regular expression character set"
+    "s.{ *//{ *{ *options{ *{ *    lookaheads = 2{ *    conflicts = 0{ *    "
+    "keep_whitespace = true{ *    case_sensitive = true{ *{ *tokens{ *{ *   "
+    " <char>               : regex = ''' [^\\^\\-\\[\\]\\$] '''{ *{ *rules  "
+    "     { *        { *    CharsetRoot          ::= '^' CharsetList{ *     "
+    "                    :   (AstCharsetInvert, $2._){ *{ *    CharsetRoot  "
+    "        ::= CharsetList{ *{ *    CharsetList          ::= CharsetItem+{"
+    " *                         :   (AstCharset, $1._){ *{ *    CharsetItem "
+    "         ::= Char '-' Char{ *                         :   (AstCharsetRa"
+    "nge, $1, $3, @2){ *{ *    CharsetItem          ::= Charset{ *{ *    Cha"
+    "rsetItem          ::= Char{ *                         :   (AstCharsetRa"
+    "nge, $1){ *{ *    Charset              ::= '\\\\s' { *                 "
+    "        :   (AstCharsetWhitespace){ *{ *    Charset              ::= '\\"
+    "\\S' { *                         :   (AstCharsetNotWhitespace){ *{ *   "
+    " Charset              ::= '\\\\d' { *                         :   (AstC"
+    "harsetDigits){ *{ *    Charset              ::= '\\\\D' { *            "
+    "             :   (AstCharsetNotDigits){ *{ *    Char                 ::"
+    "= '\\\\\\\\' { *                         :   (AstCharsetEscape){ *{ *  "
+    "  Char                 ::= '$' { *                         :   (AstChar"
+    "setAltNewline){ *{ *    Char                 ::= '\\\\n' { *           "
+    "              :   (AstCharsetNewline){ *{ *    Char                 ::="
+    " '\\\\r' { *                         :   (AstCharsetCr){ *{ *    Char  "
+    "               ::= '\\\\^' { *                         :   (AstCharsetC"
+    "aret){ *{ *    Char                 ::= '\\\\-' { *                    "
+    "     :   (AstCharsetDash){ *{ *    Char                 ::= '\\\\$' { *"
+    "                         :   (AstCharsetDollar){ *{ *    Char          "
+    "       ::= '\\\\[' { *                         :   (AstCharsetLeftBrack"
+    "et){ *{ *    Char                 ::= '\\\\]' { *                      "
+    "   :   (AstCharsetRightBracket){ *{ *    Char                 ::= <char"
+    ">{ *                         :   (AstCharsetChar, &1){ *{ *{ *|}#|\"|}$"
+    "|!|}%|9|}&||}'|:|}(|*eof*|'$'|'\\\\$'|'\\\\-'|'\\\\['|'\\\\\\\\'|'\\\\]"
+    "'|'\\\\^'|'\\\\n'|'\\\\r'|<char>|'\\\\D'|'\\\\S'|'\\\\d'|'\\\\s'|'-'|'^"
+    "'||||||||*epsilon*|*error*|})|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!||||||||"
+    "!|!|}*|9\"|*\"|,\"|-\"|0\"|1\"|2\"|3\"|5\"|6\"|<\"|.\"|/\"|4\"|7\"|+\"|"
+    "8\"||||||||:\"|;\"|}+|||||||||||!||||||||||||||||},|7|}-|!|\"|!|!|\"|!|"
+    "#|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|!|}.|7|6|6|4|5|5|3|3|3|2|2|2|2|1|1|1|1|"
+    "1|1|1|1|1|1|}/|*accept* ::= CharsetRoot|CharsetRoot ::= '^' CharsetList"
+    "|CharsetRoot ::= CharsetList|CharsetList ::= CharsetList:1|CharsetList:"
+    "1 ::= CharsetList:1 CharsetItem|CharsetList:1 ::= CharsetItem|CharsetIt"
+    "em ::= Char '-' Char|CharsetItem ::= Charset|CharsetItem ::= Char|Chars"
+    "et ::= '\\\\s'|Charset ::= '\\\\S'|Charset ::= '\\\\d'|Charset ::= '\\\\"
+    "D'|Char ::= '\\\\\\\\'|Char ::= '$'|Char ::= '\\\\n'|Char ::= '\\\\r'|C"
+    "har ::= '\\\\^'|Char ::= '\\\\-'|Char ::= '\\\\$'|Char ::= '\\\\['|Char"
+    " ::= '\\\\]'|Char ::= <char>|}0|!~I|!~N|S|!~Y|!~!~ !|#!|&!|)!|,!|/!|2!|"
+    "5!|8!|;!|>!|A!|D!|G!|}1|\"|}2||}3|:|}4|>|}5||:|T|.!|H!|\"\"|<\"|V\"|0#|"
+    "J#|$$|>$|X$|2%|L%|&&|@&|Z&|4'|N'|((|B(|\\(|6)|P)|**|D*|^*|8+|R+|}6|,,|}"
+    "7|!~!$|!(|!,|!8|!<|!@|!D|!L|!P|!\\|!0|!4|!H|!T|!~!X|# !|#$!|#(!|#,!|#0!"
+    "|#4!|!~!~!~RI!|R%|R)|R-|R9|R=|RA|RE|RM|RQ|R]|R1|R5|RI|RU|R=!|!~!~!~!~!~"
+    "!~!~!~!~!~:J!|:&|:*|:.|::|:>|:B|:F|:N|:R|:^|:2|:6|:J|:V|:>!|!~!~!~!~!~!"
+    "~!~!~!~!~2J!|2&|2*|2.|2:|2>|2B|2F|2N|2R|2^|22|26|2J|2V|2>!|!~!~!~!~!~!~"
+    "!~!~!~!~BI!|B%|B)|B-|B9|B=|BA|BE|BM|BQ|B]|B1|B5|BI|BU|!~!~!~!~!~!~!~!~!"
+    "~!~!~2I!|2%|2)|2-|29|2=|2A|2E|2M|2Q|2]|21|25|2I|2U|!~!~!~!~!~!~!~!~!~!~"
+    "!~BJ!|B&|B*|B.|B:|B>|BB|BF|BN|BR|B^|B2|B6|BJ|BV|B>!|!~!~!~!~!~!~!~!~!~!"
+    "~JI!|J%|J)|J-|J9|J=|JA|JE|JM|JQ|J]|J1|J5|JI|JU|J=!|!~!~!~!~!~!~!~!~!~!~"
+    "JJ!|J&|J*|J.|J:|J>|JB|JF|JN|JR|J^|J2|J6|JJ|JV|J>!|!~!~!~!~!~!~!~!~!~!~*"
+    "J!|*&|**|*.|*:|*>|*B|*F|*N|*R|*^|*2|*6|*J|*V|*>!|!~!~!~!~!~!~!~!~!~!~:I"
+    "!|:%|:)|:-|:9|:=|:A|:E|:M|:Q|:]|:1|:5|:I|:U|!~!~!~!~!~!~!~!~!~!~!~ZI!|Z"
+    "%|Z)|Z-|Z9|Z=|ZA|ZE|ZM|ZQ|Z]|Z1|Z5|ZI|ZU|Z=!|!~!~!~!~!~!~!~!~!~!~\"J!|\""
+    "&|\"*|\".|\":|\">|\"B|\"F|\"N|\"R|\"^|\"2|\"6|\"J|\"V|\">!|!~!~!~!~!~!~"
+    "!~!~!~!~*I!|*%|*)|*-|*9|*=|*A|*E|*M|*Q|*]|*1|*5|*I|*U|!~!~!~!~!~!~!~!~!"
+    "~!~!~!~!$|!(|!,|!8|!<|!@|!D|!L|!P|!\\|!0|!4|!H|!T|!~!~# !|#$!|#(!|#8!|#"
+    "0!|!~!~!~!~RJ!|R&|R*|R.|R:|R>|RB|RF|RN|RR|R^|R2|R6|RJ|RV|R>!|!~!~!~!~!~"
+    "!~!~!~!~!~\"I!|\"%|\")|\"-|\"9|\"=|\"A|\"E|\"M|\"Q|\"]|\"1|\"5|\"I|\"U|"
+    "!<!|!~!~!~!~!~!~!~!~!~!~ZH!|Z$|Z(|Z,|Z8|Z<|Z@|ZD|ZL|ZP|Z\\|Z0|Z4|ZH|ZT|"
+    "!~!~!~!~!~!~!~!~!~!~!~JH!|J$|J(|J,|J8|J<|J@|JD|JL|JP|J\\|J0|J4|JH|JT|!~"
+    "!~!~!~!~!~!~!~!~!~!~2H!|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!"
+    "~!~:H!|!$|!(|!,|!8|!<|!@|!D|!L|!P|!\\|!0|!4|!H|!T|!~!~# !|#$!|#@!|!~!~!"
+    "~!~!~!~%|!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~*H!|!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!~!$|!(|!,|!8|!<|!@|!D|!L|!P|"
+    "!\\|!~!~!~!~!~!~#D!|!~!~!~!~!~!~!~!~BH!|B$|B(|B,|B8|B<|B@|BD|BL|BP|B\\|"
+    "B0|B4|BH|BT|!~!~!~!~!~!~!~!~!~!~!~RH!|R$|R(|R,|R8|R<|R@|RD|RL|RP|R\\|R0"
+    "|R4|RH|RT|!~!~!~!~!~!~!~!~!~!~!~%|!$|!(|!,|!8|!<|!@|!D|!L|!P|!\\|!0|!4|"
+    "!H|!T|!<!|!X|#L!|#$!|#P!|#T!|#0!|#4!|!~!~!~$H!|$$|$(|$,|$8|$<|$@|$D|$L|"
+    "$P|$\\|$0|$4|$H|$T|!<!|!~!~!~!~!~!~!~!~!~!~$H!|$$|$(|$,|$8|$<|$@|$D|$L|"
+    "$P|$\\|$0|$4|$H|$T|!~!~!~!~!~!~!~!~!~!~!~$H!|!~!~!~!~!~!~!~!~!~!~!~!~!~"
+    "!~!~!~!~!~!~!~!~!~!~!~!~}8|!|}9||}:||};||}<||}=||}>|'|}\?||}@|#|}A|\?|}"
+    "B||}C|(|}D|\?|}E||}F|(|}G|\?|}H|Null||Halt|!|Label|\"|Call|#|ScanStart|"
+    "$|ScanChar|%|ScanAccept|&|ScanToken|'|ScanError|(|AstStart|)|AstFinish|"
+    "*|AstNew|+|AstForm|,|AstLoad|-|AstIndex|.|AstChild|/|AstChildSlice|0|As"
+    "tKind|1|AstKindNum|2|AstLocation|3|AstLocationNum|4|AstLexeme|5|AstLexe"
+    "meString|6|Assign|7|DumpStack|8|Add|9|Subtract|:|Multiply|;|Divide|<|Un"
+    "aryMinus|=|Return|>|Branch|\?|BranchEqual|@|BranchNotEqual|A|BranchLess"
+    "Than|B|BranchLessEqual|C|BranchGreaterThan|D|BranchGreaterEqual|E|ScanC"
+    "lass|F|ScanKeyword|G|ScanClassMemo|H|ScanLazy|I|AstLoadChild|J|AstFormK"
+    "ind|K|AstFinishReturn|L|}I|L!|}J|C#|}K|7|!~|$||>|!~\"|$|!~\"|F|!~\"||-|"
+    "$|&|(|$|$|!~*|!~D|$|$|$|$|&|R#|1|*|F|%|!~3||&|\?3|4|!|F|%|!~6||&|))|7|/"
+    "|F|%|!~9||&|R#|:|*|F|F|!~<|!|,|,|.|0|2|4|6|8|:|<|>|@|B|&|$:|J|\"|F|%|!~"
+    "L||&|Q8|M|#|F|%|!~O||&|Q0|P|+|F|%|!~R||&| .|S|,|F|%|!~U||&|9;|V|$|F|%|!"
+    "~X||&|)2|Y|%|F|%|!~[||&|S<|\\|&|F|%|!~^||&|=7|_|'|F|%|!~!!||&|</|\"!|-|"
+    "F|%|!~$!||&|V4|%!|(|F|%|!~'!||&|,6|(!|)|F|%|!~*!||&|G,|+!|.|F|%|!~-!||&"
+    "|;%|.!|0|F|%|!~0!||'|!~1!|9|!~1!|$|$|!|>|!~4!|)|(&|4!|\"|-|<&|5!||\"|!~"
+    "0|>&|8!|||!~K|(&|;!|\"|\"|\"|G!|L|(&|\?!|\"|)|3(|@!|\"|-|A(|A!||\"|!~0|"
+    "C(|D!|||!~K|3(|G!|\"|\"|!|F!|L|3(|K!|!|)|0'|L!|\"|-|0'|M!||\"|\"~0|0'|P"
+    "!|||!~J|0'|S!||\"|!~K|0'|V!|\"|\"|\"|)\"|L|0'|Z!|\"|)|O)|[!|\"|J|\"*|\\"
+    "!||\"|#~J|&*|_!||\"|!~K|O)|\"\"|\"|\"|#|H!|-|**|&\"||\"|\"~3|)*|)\"||L|"
+    "O)|*\"|#|)|+-|+\"|\"|K|+-|,\"|\"|\"|!|J!|L|+-|0\"|!|)|D.|1\"|\"|K|D.|2\""
+    "|\"|\"|!|K!|L|D.|6\"|!|)| 0|7\"|\"|K| 0|8\"|\"|\"|!|L!|L| 0|<\"|!|)|51|"
+    "=\"|\"|K|51|>\"|\"|\"|!|M!|L|51|B\"|!|)|N2|C\"|\"|K|N2|D\"|\"|\"|!|N!|L"
+    "|N2|H\"|!|)|!4|I\"|\"|K|!4|J\"|\"|\"|!|O!|L|!4|N\"|!|)|:5|O\"|\"|K|:5|P"
+    "\"|\"|\"|!|P!|L|:5|T\"|!|)|P6|U\"|\"|K|P6|V\"|\"|\"|!|Q!|L|P6|Z\"|!|)|!"
+    "8|[\"|\"|K|!8|\\\"|\"|\"|!|R!|L|!8| #|!|)|59|!#|\"|K|59|\"#|\"|\"|!|S!|"
+    "L|59|&#|!|)|H:|'#|\"|K|H:|(#|\"|\"|!|T!|L|H:|,#|!|)|];|-#|\"|K|];|.#|\""
+    "|\"|!|U!|L|];|2#|!|)|7=|3#|\"|K|7=|4#|\"|\"|!|V!|L|7=|8#|!|)|R>|9#|\"|K"
+    "|R>|:#|\"|\"|!|I!|-|$\?|>#||\"|!~5|#\?|A#||L|R>|B#|!|}L|%|}M||0|!|1||Te"
+    "mp$0||Temp$1||token_count|}N|!|}O||}P|}R|#|}S||}T|}U||}V||}W|}X|0|}Y|!|"
+    "}Z||}[| $|}\\|||||||||||||||||||||||||||||||||||||!|||||||||\"|||||||||"
+    "||||||||||||||#|||||||||||||||$||||||||%|&|'|(||||||)||||||||||*||||+|,"
+    "|||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||"
+    "||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||||}"
+    "]|!|}^| $|}_||} !|!~!~!~!~!~)\"|!~!~H!|!~!~!~!~!~!~!~!~!~!~!~!~!~!~}!!|"
+    "|}\"!|||||||||||||||||||||||||||}#!||}$!||}Q|}"
 };
 
 //
@@ -1645,6 +1709,15 @@ void ParserImpl::initialize()
     kind_map["AstConflicts"] = AstType::AstConflicts;
     kind_map["AstKeepWhitespace"] = AstType::AstKeepWhitespace;
     kind_map["AstCaseSensitive"] = AstType::AstCaseSensitive;
+    kind_map["AstLookaheadMethod"] = AstType::AstLookaheadMethod;
+    kind_map["AstTableScheme"] = AstType::AstTableScheme;
+    kind_map["AstKeywordTable"] = AstType::AstKeywordTable;
+    kind_map["AstLinearScan"] = AstType::AstLinearScan;
+    kind_map["AstLazyScanner"] = AstType::AstLazyScanner;
+    kind_map["AstPipelineScanner"] = AstType::AstPipelineScanner;
+    kind_map["AstInternLexemes"] = AstType::AstInternLexemes;
+    kind_map["AstLazyAst"] = AstType::AstLazyAst;
+    kind_map["AstMinimizeMethod"] = AstType::AstMinimizeMethod;
     kind_map["AstTokenDeclaration"] = AstType::AstTokenDeclaration;
     kind_map["AstTokenOptionList"] = AstType::AstTokenOptionList;
     kind_map["AstTokenTemplate"] = AstType::AstTokenTemplate;
@@ -1656,6 +1729,7 @@ void ParserImpl::initialize()
     kind_map["AstTokenLexeme"] = AstType::AstTokenLexeme;
     kind_map["AstTokenIgnore"] = AstType::AstTokenIgnore;
     kind_map["AstTokenError"] = AstType::AstTokenError;
+    kind_map["AstTokenSync"] = AstType::AstTokenSync;
     kind_map["AstRule"] = AstType::AstRule;
     kind_map["AstRuleRhsList"] = AstType::AstRuleRhsList;
     kind_map["AstRuleRhs"] = AstType::AstRuleRhs;
@@ -1778,7 +1852,8 @@ void ParserImpl::initialize()
 //                                                                       
 //  The ParserImpl object does support copying. But note that copying    
 //  ParserData is a pointer copy. We use a reference count on ParserData 
-//  to control that.                                                     
+//  to control that. A copy holds the source's lazy_ast mutex, since     
+//  another thread may be building its Ast.                              
 //
 
 ParserImpl::~ParserImpl()
@@ -1791,12 +1866,19 @@ ParserImpl::~ParserImpl()
 ParserImpl::ParserImpl(const ParserImpl& rhs)
 {
 
+    lock_guard<mutex> lock(rhs.lazy_ast_mutex);
+
     state = rhs.state;
 
     prsd = rhs.prsd;
     ParserData::attach(prsd);
 
-    if (errh == nullptr)
+    kind_overlay = rhs.kind_overlay;
+    kind_ioverlay = rhs.kind_ioverlay;
+    lexeme_table = rhs.lexeme_table;
+    reduce_log = rhs.reduce_log;
+
+    if (rhs.errh == nullptr)
     {
         errh = nullptr;
     }
@@ -1805,7 +1887,7 @@ ParserImpl::ParserImpl(const ParserImpl& rhs)
         errh = new ErrorHandler(*rhs.errh);
     }
 
-    if (ast == nullptr)
+    if (rhs.ast == nullptr)
     {
         ast = nullptr;
     }
@@ -1823,6 +1905,10 @@ ParserImpl::ParserImpl(ParserImpl&& rhs) noexcept
     swap(prsd, rhs.prsd);    
     swap(errh, rhs.errh);    
     swap(ast, rhs.ast);    
+    swap(kind_overlay, rhs.kind_overlay);
+    swap(kind_ioverlay, rhs.kind_ioverlay);
+    swap(lexeme_table, rhs.lexeme_table);
+    swap(reduce_log, rhs.reduce_log);
 
 }
 
@@ -1832,6 +1918,8 @@ ParserImpl& ParserImpl::operator=(const ParserImpl& rhs)
     if (&rhs != this)
     {
 
+        lock_guard<mutex> lock(rhs.lazy_ast_mutex);
+
         state = rhs.state;
 
         ParserData::detach(prsd);
@@ -1839,23 +1927,29 @@ ParserImpl& ParserImpl::operator=(const ParserImpl& rhs)
         prsd = rhs.prsd;
         ParserData::attach(prsd);   
 
-        if (errh == nullptr)
+        kind_overlay = rhs.kind_overlay;
+        kind_ioverlay = rhs.kind_ioverlay;
+        lexeme_table = rhs.lexeme_table;
+        reduce_log = rhs.reduce_log;
+
+        delete errh;
+        delete ast;
+
+        if (rhs.errh == nullptr)
         {
             errh = nullptr;
         }
         else
         {
-            delete errh;
             errh = new ErrorHandler(*rhs.errh);
         }
 
-        if (ast == nullptr)
+        if (rhs.ast == nullptr)
         {
             ast = nullptr;
         }
         else
         {
-            delete ast;
             ast = rhs.ast->clone();
         }
 
@@ -1872,6 +1966,10 @@ ParserImpl& ParserImpl::operator=(ParserImpl&& rhs) noexcept
     swap(prsd, rhs.prsd);    
     swap(errh, rhs.errh);    
     swap(ast, rhs.ast);    
+    swap(kind_overlay, rhs.kind_overlay);
+    swap(kind_ioverlay, rhs.kind_ioverlay);
+    swap(lexeme_table, rhs.lexeme_table);
+    swap(reduce_log, rhs.reduce_log);
 
     return *this;
 
@@ -1993,6 +2091,9 @@ void ParserImpl::set_kind_map(const std::map<std::string, int>& kind_map)
         prsd = new ParserData();
         ParserData::attach(prsd);
 
+        kind_overlay.clear();
+        kind_ioverlay.clear();
+
         prsd->set_kind_map(kind_map);
 
         state = ParserState::KindMapGood;
@@ -2100,8 +2201,18 @@ void ParserImpl::generate(Ast* ast,
     ActionGenerator* actg = nullptr;
     CodeGenerator* code = nullptr;
     ScannerGenerator* scan = nullptr;
+    ErrorHandler* scan_errh = nullptr;
     ReduceGenerator* redg = nullptr;
 
+    //
+    //  Independent phases run on a thread pool. When we're producing 
+    //  debug output we keep everything on this thread so the output  
+    //  comes out in the usual order.                                  
+    //
+
+    ThreadPool pool((debug_flags == 0) ? ThreadPool::default_num_threads() : 1);
+    future<void> scan_future;
+
     try
     {
 
@@ -2112,6 +2223,9 @@ void ParserImpl::generate(Ast* ast,
         prsd = new ParserData();
         ParserData::attach(prsd);
 
+        kind_overlay.clear();
+        kind_ioverlay.clear();
+
         prsd->set_kind_map(kind_map);
         prsd->src = src;
         errh = new ErrorHandler(prsd->src);
@@ -2150,25 +2264,46 @@ void ParserImpl::generate(Ast* ast,
         code = new CodeGenerator(*this, *errh, *gram, *prsd, debug_flags);
         actg = new ActionGenerator(*this, *errh, *code, debug_flags);
 
+        //
+        //  The scanner automaton doesn't depend on the parse tables, so we 
+        //  start building it now and let it run alongside LALR generation. 
+        //  It reports to its own error handler and we merge the messages  
+        //  afterwards.                                                    
+        //
+
+        scan_errh = new ErrorHandler(prsd->src);
+        scan = new ScannerGenerator(*this, *scan_errh, *gram, *code, *actg, *prsd, debug_flags);
+        scan_future = pool.submit([scan]() -> void { scan->build_automaton(); });
+
         //
         //  Generate the LALR(k) parser and save the automaton in an action 
         //  table.                                                        
         //
 
-        LalrGenerator(*this, *errh, *gram, *prsd, debug_flags).generate();
+        LalrGenerator(*this, *errh, *gram, *prsd, pool, debug_flags).generate();
 
         if (errh->get_error_count() > 0)
         {
+            scan_future.wait();
             throw GrammarError("Grammar errors");
         }
 
         //
-        //  Generate the scanner. 
+        //  Finish the scanner. This needs the symbol numbers assigned with 
+        //  the parse tables.                                               
         //
 
-        scan = new ScannerGenerator(*this, *errh, *gram, *code, *actg, *prsd, debug_flags);
+        scan_future.get();
         scan->generate();
 
+        for (auto msg: scan_errh->get_error_messages())
+        {
+            errh->add_error(msg.get_type(),
+                            msg.get_location(),
+                            msg.get_short_message(),
+                            msg.get_long_message());
+        }
+
         if (errh->get_error_count() > 0)
         {
             throw GrammarError("Grammar errors");
@@ -2206,6 +2341,7 @@ void ParserImpl::generate(Ast* ast,
         scan->save_parser_data();
         gram->save_parser_data();
         redg->save_parser_data();
+        prsd->freeze_kind_map();
 
         //
         //  Reclaim memory from remaining work objects. 
@@ -2214,6 +2350,9 @@ void ParserImpl::generate(Ast* ast,
         delete scan;
         scan = nullptr;
 
+        delete scan_errh;
+        scan_errh = nullptr;
+
         delete gram;
         gram = nullptr;
 
@@ -2235,9 +2374,21 @@ void ParserImpl::generate(Ast* ast,
     catch (...)
     {
 
+        //
+        //  The scanner may still be running on another thread. Let it 
+        //  finish before we free anything it's using.                 
+        //
+
+        if (scan_future.valid())
+        {
+            scan_future.wait();
+        }
+
         ParserData::detach(prsd);
         state = ParserState::GrammarBad;
 
+        delete scan;
+        delete scan_errh;
         delete gram;
         delete code;
         delete actg;
@@ -2392,8 +2543,18 @@ void ParserImpl::generate(const Source& src,
     ActionGenerator* actg = nullptr;
     CodeGenerator* code = nullptr;
     ScannerGenerator* scan = nullptr;
+    ErrorHandler* scan_errh = nullptr;
     ReduceGenerator* redg = nullptr;
 
+    //
+    //  Independent phases run on a thread pool. When we're producing 
+    //  debug output we keep everything on this thread so the output  
+    //  comes out in the usual order.                                  
+    //
+
+    ThreadPool pool((debug_flags == 0) ? ThreadPool::default_num_threads() : 1);
+    future<void> scan_future;
+
     try
     {
 
@@ -2404,6 +2565,9 @@ void ParserImpl::generate(const Source& src,
         prsd = new ParserData();
         ParserData::attach(prsd);
 
+        kind_overlay.clear();
+        kind_ioverlay.clear();
+
         prsd->set_kind_map(kind_map);
         prsd->src = src;
         errh = new ErrorHandler(prsd->src);
@@ -2462,25 +2626,46 @@ void ParserImpl::generate(const Source& src,
         code = new CodeGenerator(*this, *errh, *gram, *prsd, debug_flags);
         actg = new ActionGenerator(*this, *errh, *code, debug_flags);
 
+        //
+        //  The scanner automaton doesn't depend on the parse tables, so we 
+        //  start building it now and let it run alongside LALR generation. 
+        //  It reports to its own error handler and we merge the messages  
+        //  afterwards.                                                    
+        //
+
+        scan_errh = new ErrorHandler(prsd->src);
+        scan = new ScannerGenerator(*this, *scan_errh, *gram, *code, *actg, *prsd, debug_flags);
+        scan_future = pool.submit([scan]() -> void { scan->build_automaton(); });
+
         //
         //  Generate the LALR(k) parser and save the automaton in an action 
         //  table.                                                        
         //
 
-        LalrGenerator(*this, *errh, *gram, *prsd, debug_flags).generate();
+        LalrGenerator(*this, *errh, *gram, *prsd, pool, debug_flags).generate();
 
         if (errh->get_error_count() > 0)
         {
+            scan_future.wait();
             throw GrammarError("Grammar errors");
         }
 
         //
-        //  Generate the scanner. 
+        //  Finish the scanner. This needs the symbol numbers assigned with 
+        //  the parse tables.                                               
         //
 
-        scan = new ScannerGenerator(*this, *errh, *gram, *code, *actg, *prsd, debug_flags);
+        scan_future.get();
         scan->generate();
 
+        for (auto msg: scan_errh->get_error_messages())
+        {
+            errh->add_error(msg.get_type(),
+                            msg.get_location(),
+                            msg.get_short_message(),
+                            msg.get_long_message());
+        }
+
         if (errh->get_error_count() > 0)
         {
             throw GrammarError("Grammar errors");
@@ -2518,6 +2703,7 @@ void ParserImpl::generate(const Source& src,
         scan->save_parser_data();
         gram->save_parser_data();
         redg->save_parser_data();
+        prsd->freeze_kind_map();
 
         //
         //  Reclaim memory from remaining work objects. 
@@ -2526,6 +2712,9 @@ void ParserImpl::generate(const Source& src,
         delete scan;
         scan = nullptr;
 
+        delete scan_errh;
+        scan_errh = nullptr;
+
         delete gram;
         gram = nullptr;
 
@@ -2538,6 +2727,15 @@ void ParserImpl::generate(const Source& src,
         delete redg;
         redg = nullptr;
 
+        //
+        //  Everything we need from the grammar Ast is in the ParserData   
+        //  object now. Drop it so parsers don't carry it around, or copy  
+        //  it with each Parser.                                           
+        //
+
+        delete ast;
+        ast = nullptr;
+
     }
 
     //
@@ -2547,6 +2745,16 @@ void ParserImpl::generate(const Source& src,
     catch (...)
     {
 
+        //
+        //  The scanner may still be running on another thread. Let it 
+        //  finish before we free anything it's using.                 
+        //
+
+        if (scan_future.valid())
+        {
+            scan_future.wait();
+        }
+
         ParserData::detach(prsd);
 
         delete ast;
@@ -2554,6 +2762,8 @@ void ParserImpl::generate(const Source& src,
 
         state = ParserState::GrammarBad;
 
+        delete scan;
+        delete scan_errh;
         delete gram;
         delete code;
         delete actg;
@@ -2586,7 +2796,12 @@ void ParserImpl::parse(const Source& src, const int64_t debug_flags)
 
         case ParserState::GrammarGood:
         {
+
+            delete errh;
+            errh = nullptr;
+
             break;
+
         }
 
         case ParserState::SourceBad:
@@ -2615,7 +2830,24 @@ void ParserImpl::parse(const Source& src, const int64_t debug_flags)
 
         errh = new ErrorHandler(src);
         ast = nullptr;
-        ParserEngine(*this, *errh, *prsd, src, ast, debug_flags).parse();
+        lexeme_table.clear();
+        reduce_log.clear();
+
+        ParserEngine engine(*this, *errh, *prsd, src, ast, debug_flags, &lexeme_table,
+                            prsd->lazy_ast ? &reduce_log : nullptr);
+
+        engine.parse();
+
+        if ((debug_flags & DebugType::DebugProgress) != 0)
+        {
+            cout << "VM instructions executed: " << engine.get_vcode_count() << endl;
+        }
+
+        if (reduce_log.may_fail)
+        {
+            build_lazy_ast();
+        }
+
         state = ParserState::SourceGood;
 
     }
@@ -2625,12 +2857,595 @@ void ParserImpl::parse(const Source& src, const int64_t debug_flags)
         delete ast;
         ast = nullptr;
 
-        state = ParserState::SourceBad;
+        state = ParserState::SourceBad;
+
+        throw;
+
+    }
+
+}
+
+//
+//  parse_parallel                                                         
+//  --------------                                                         
+//                                                                         
+//  Parse a large source on several threads. A grammar can mark tokens    
+//  that only ever begin a top-level unit with sync = true. We scan the    
+//  source once on this thread looking for those tokens, cut it into      
+//  chunks before them and parse each chunk on the pool as soon as it's   
+//  cut. Every chunk yields a list of units under its own root, and we    
+//  stitch the lists together under one root.                             
+//                                                                         
+//  A sync token that isn't really at the start of a unit makes some      
+//  chunk fail to parse. In that case, or on any error at all, we throw   
+//  the chunks away and parse the whole source sequentially, so errors    
+//  are reported exactly as parse would report them.                      
+//                                                                         
+//  We need the chunk trees to stitch them together, so here we build the 
+//  Ast as we go even with lazy_ast.                                      
+//
+
+void ParserImpl::parse_parallel(const Source& src,
+                                const int64_t num_threads,
+                                const int64_t debug_flags)
+{
+
+    static const int64_t min_chunk_length = 65536;
+
+    //
+    //  We're about to do a state transition. Check whether we are in an 
+    //  appropriate state and clear unnecessary data from the existing   
+    //  state.                                                           
+    //
+
+    switch (state)
+    {
+
+        case ParserState::GrammarGood:
+        {
+
+            delete errh;
+            errh = nullptr;
+
+            break;
+
+        }
+
+        case ParserState::SourceBad:
+        case ParserState::SourceGood:
+        {
+
+            delete ast;
+            ast = nullptr;
+
+            delete errh;
+            errh = nullptr;
+
+            break;
+
+        }
+
+        default:
+        {
+            throw logic_error("State error in Parser::parse_parallel");
+        }
+
+    }
+
+    //
+    //  Without sync tokens, with debug output or with a short source we  
+    //  just parse sequentially.                                          
+    //
+
+    bool has_sync = false;
+    if (prsd->token_is_sync != nullptr)
+    {
+
+        for (int i = 0; i < prsd->token_count; i++)
+        {
+            if (prsd->token_is_sync[i])
+            {
+                has_sync = true;
+            }
+        }
+
+    }
+
+    int64_t thread_count = (num_threads > 0) ? num_threads : ThreadPool::default_num_threads();
+
+    try
+    {
+
+        errh = new ErrorHandler(src);
+        ast = nullptr;
+        lexeme_table.clear();
+        reduce_log.clear();
+
+        if (!has_sync || debug_flags != 0 || src.length() < min_chunk_length * 2)
+        {
+
+            ParserEngine engine(*this, *errh, *prsd, src, ast, debug_flags, &lexeme_table);
+            engine.parse();
+
+            if ((debug_flags & DebugType::DebugProgress) != 0)
+            {
+                cout << "VM instructions executed: " << engine.get_vcode_count() << endl;
+            }
+
+            state = ParserState::SourceGood;
+            return;
+
+        }
+
+        //
+        //  Cut the source into chunks and parse each on the pool. A chunk 
+        //  that fails to parse comes back as a null Ast. Each chunk       
+        //  interns lexemes in its own table.                              
+        //
+
+        int64_t chunk_length = max(min_chunk_length, src.length() / (thread_count * 4));
+
+        ThreadPool pool(thread_count);
+        vector<future<Ast*>> chunk_list;
+        vector<unique_ptr<LexemeTable>> chunk_table_list;
+        int64_t chunk_start = 0;
+
+        function<void(int64_t)> add_chunk = [&](int64_t chunk_end) -> void
+        {
+
+            chunk_table_list.push_back(unique_ptr<LexemeTable>(new LexemeTable()));
+            LexemeTable* chunk_table = chunk_table_list.back().get();
+
+            chunk_list.push_back(pool.submit([this, &src, chunk_start, chunk_end, chunk_table]() -> Ast*
+            {
+
+                ErrorHandler chunk_errh(src);
+                Ast* chunk_ast = nullptr;
+
+                try
+                {
+
+                    ParserEngine(*this, chunk_errh, *prsd, src, chunk_ast, 0, chunk_table)
+                        .parse(chunk_start, chunk_end);
+
+                }
+                catch (...)
+                {
+                    delete chunk_ast;
+                    return nullptr;
+                }
+
+                if (chunk_errh.get_error_count() > 0)
+                {
+                    delete chunk_ast;
+                    return nullptr;
+                }
+
+                return chunk_ast;
+
+            }));
+
+            chunk_start = chunk_end;
+
+        };
+
+        {
+
+            ErrorHandler scan_errh(src);
+            Ast* scan_ast = nullptr;
+            ParserEngine(*this, scan_errh, *prsd, src, scan_ast, 0)
+                .scan_sync_points(chunk_length, add_chunk);
+
+        }
+
+        add_chunk(src.length());
+
+        //
+        //  Collect the chunks in order. They must all have parsed and    
+        //  agree on the kind of the root. Once one has failed we only     
+        //  wait for the rest, since any of them may be null, the first    
+        //  included.                                                      
+        //
+
+        vector<Ast*> chunk_ast_list;
+        bool chunks_good = true;
+        int64_t child_count = 0;
+
+        for (future<Ast*>& chunk: chunk_list)
+        {
+
+            Ast* chunk_ast = chunk.get();
+            chunk_ast_list.push_back(chunk_ast);
+
+            if (chunk_ast == nullptr)
+            {
+                chunks_good = false;
+            }
+
+            if (!chunks_good || chunk_ast->get_kind() != chunk_ast_list[0]->get_kind())
+            {
+                chunks_good = false;
+                continue;
+            }
+
+            child_count += chunk_ast->get_num_children();
+
+        }
+
+        if (!chunks_good)
+        {
+
+            for (Ast* chunk_ast: chunk_ast_list)
+            {
+                delete chunk_ast;
+            }
+
+            ParserEngine(*this, *errh, *prsd, src, ast, debug_flags, &lexeme_table).parse();
+            state = ParserState::SourceGood;
+            return;
+
+        }
+
+        //
+        //  Merge the chunk lexeme tables in source order, which numbers   
+        //  the lexemes as a sequential parse would. Then stitch the lists 
+        //  together under a copy of the first root.                       
+        //
+
+        if (prsd->intern_lexemes)
+        {
+
+            for (size_t i = 0; i < chunk_ast_list.size(); i++)
+            {
+                lexeme_table.absorb(*chunk_table_list[i], chunk_ast_list[i]);
+            }
+
+        }
+
+        ast = new Ast(child_count);
+        ast->set_kind(chunk_ast_list[0]->get_kind());
+        ast->set_location(chunk_ast_list[0]->get_location());
+        ast->share_lexeme(chunk_ast_list[0]);
+
+        int64_t child_num = 0;
+        for (Ast* chunk_ast: chunk_ast_list)
+        {
+
+            for (int i = 0; i < chunk_ast->get_num_children(); i++)
+            {
+                ast->set_child(child_num++, chunk_ast->get_child(i));
+                chunk_ast->set_child(i, nullptr);
+            }
+
+            delete chunk_ast;
+
+        }
+
+        state = ParserState::SourceGood;
+
+    }
+    catch (...)
+    {
+
+        delete ast;
+        ast = nullptr;
+
+        state = ParserState::SourceBad;
+
+        throw;
+
+    }
+
+}
+
+//
+//  parse_batch                                                            
+//  -----------                                                            
+//                                                                         
+//  Parse a list of sources on a pool of threads. Each thread keeps one    
+//  engine and points it at one source after another, so the registers,   
+//  stacks and token buffer are allocated once per thread rather than     
+//  once per source. Threads claim the next unparsed source as they come  
+//  free, so a few long sources don't leave the other threads idle.       
+//                                                                         
+//  Each result is a parser sharing our parse tables, in the state parse  
+//  would have left it. A source with errors leaves its parser in the     
+//  SourceBad state with the error messages rather than throwing. Any     
+//  other exception from one source, such as a bad_alloc, fails just that 
+//  source the same way, with the exception's text as its error, so the   
+//  other results are still whole.                                        
+//
+
+void ParserImpl::parse_batch(const vector<Source>& src_list,
+                             vector<Parser>& parser_list,
+                             const int64_t num_threads)
+{
+
+    switch (state)
+    {
+
+        case ParserState::GrammarGood:
+        case ParserState::SourceBad:
+        case ParserState::SourceGood:
+        {
+            break;
+        }
+
+        default:
+        {
+            throw logic_error("State error in Parser::parse_batch");
+        }
+
+    }
+
+    int64_t thread_count = (num_threads > 0) ? num_threads : ThreadPool::default_num_threads();
+    thread_count = max(min(thread_count, static_cast<int64_t>(src_list.size())),
+                       static_cast<int64_t>(1));
+
+    ThreadPool pool(thread_count);
+    atomic<int64_t> next_index(0);
+
+    pool.parallel_for(thread_count, [&](int64_t thread_num) -> void
+    {
+
+        ParserEngine engine(*this, *prsd, 0);
+
+        for (;;)
+        {
+
+            int64_t i = next_index++;
+            if (i >= static_cast<int64_t>(src_list.size()))
+            {
+                return;
+            }
+
+            ParserImpl& result = *parser_list[i].impl;
+
+            result.prsd = prsd;
+            ParserData::attach(result.prsd);
+
+            result.kind_overlay = kind_overlay;
+            result.kind_ioverlay = kind_ioverlay;
+
+            result.errh = new ErrorHandler(src_list[i]);
+            result.ast = nullptr;
+
+            engine.set_source(*result.errh, src_list[i], result.ast, &result.lexeme_table,
+                              prsd->lazy_ast ? &result.reduce_log : nullptr);
+
+            try
+            {
+
+                engine.parse();
+
+                if (result.reduce_log.may_fail)
+                {
+                    result.build_lazy_ast();
+                }
+
+                result.state = ParserState::SourceGood;
+
+            }
+            catch (SourceError& e)
+            {
+
+                delete result.ast;
+                result.ast = nullptr;
+
+                result.state = ParserState::SourceBad;
+
+            }
+            catch (exception& e)
+            {
+
+                //
+                //  Whatever the engine reported before it was cut off may 
+                //  be half made, so the exception is the only error.       
+                //
+
+                delete result.errh;
+                result.errh = new ErrorHandler(src_list[i]);
+                result.errh->add_error(ErrorType::ErrorError, -1, e.what());
+
+                delete result.ast;
+                result.ast = nullptr;
+                result.reduce_log.clear();
+
+                result.state = ParserState::SourceBad;
+
+            }
+
+        }
+
+    });
+
+}
+
+//
+//  parse_binary_batch                                                     
+//  ------------------                                                     
+//                                                                         
+//  Parse a batch of sources for the language wrappers. One call into the 
+//  library takes all the sources and returns all the results, so a       
+//  wrapper with many small sources doesn't pay for a crossing, a handler 
+//  and a marshalled result per source and per accessor. Both sides are   
+//  little-endian byte strings in the style of the FlatAst binary form.   
+//  The sources come packed as:                                           
+//                                                                         
+//      int64     number of sources, n                                    
+//      int64     source_start[n + 1], offsets into the text              
+//      byte      text, UTF-8                                             
+//                                                                         
+//  and the results go back as:                                           
+//                                                                         
+//      char[4]   "HBAT"                                                  
+//      int32     version                                                 
+//      int64     number of results, n                                    
+//      int64     result_start[n + 1], offsets from the start             
+//                                                                         
+//  followed by one record for each source, each starting on an eight     
+//  byte boundary:                                                        
+//                                                                         
+//      int32     1 if the source failed, otherwise 0                     
+//      int32     error count                                             
+//      int32     warning count                                           
+//      int32     unused                                                  
+//      int64     bytes of error messages, e                              
+//      int64     bytes of Ast, a                                         
+//      byte      error messages[e], as get_encoded_error_messages        
+//                gives them, zero padded to eight bytes                  
+//      byte      Ast[a], in FlatAst binary form without a kind map,      
+//                zero padded to eight bytes                              
+//                                                                         
+//  We leave out the error messages when there are none and the Ast when  
+//  the source failed. The results are encoded on the same pool of        
+//  threads as the parse.                                                 
+//
+
+static const char batch_magic[] = "HBAT";
+static const int32_t batch_version = 1;
+
+string ParserImpl::parse_binary_batch(const string& packed_sources,
+                                      const int64_t num_threads)
+{
+
+    //
+    //  Unpack the sources. 
+    //
+
+    size_t offset = 0;
+
+    int64_t source_count = 0;
+    get_binary(packed_sources, offset, &source_count, 1);
+
+    if (source_count < 0 || source_count >= static_cast<int64_t>(packed_sources.size() / 8))
+    {
+        throw invalid_argument("Malformed source batch");
+    }
+
+    vector<int64_t> source_start_list(source_count + 1);
+    get_binary(packed_sources, offset, source_start_list.data(), source_count + 1);
+
+    int64_t text_size = packed_sources.size() - offset;
+
+    vector<Source> src_list;
+    src_list.reserve(source_count);
+
+    for (int64_t i = 0; i < source_count; i++)
+    {
+
+        if (source_start_list[i] < 0 ||
+            source_start_list[i] > source_start_list[i + 1] ||
+            source_start_list[i + 1] > text_size)
+        {
+            throw invalid_argument("Malformed source batch");
+        }
+
+        src_list.emplace_back(packed_sources.substr(offset + source_start_list[i],
+                                                    source_start_list[i + 1] - source_start_list[i]));
+
+    }
+
+    //
+    //  Parse them all, then encode each result into its own record. 
+    //
+
+    vector<Parser> parser_list(source_count);
+    parse_batch(src_list, parser_list, num_threads);
+
+    int64_t thread_count = (num_threads > 0) ? num_threads : ThreadPool::default_num_threads();
+    thread_count = max(min(thread_count, source_count), static_cast<int64_t>(1));
+
+    vector<string> record_list(source_count);
+
+    ThreadPool pool(thread_count);
+    atomic<int64_t> next_index(0);
+
+    pool.parallel_for(thread_count, [&](int64_t thread_num) -> void
+    {
+
+        for (;;)
+        {
+
+            int64_t i = next_index++;
+            if (i >= source_count)
+            {
+                return;
+            }
+
+            ParserImpl& result = *parser_list[i].impl;
+            string& record = record_list[i];
+
+            int32_t header[4];
+            header[0] = (result.state == ParserState::SourceGood) ? 0 : 1;
+            header[1] = result.get_error_count();
+            header[2] = result.get_warning_count();
+            header[3] = 0;
+
+            string messages;
+            if (header[1] + header[2] > 0)
+            {
+                messages = result.get_encoded_error_messages();
+            }
+
+            string ast;
+            if (result.state == ParserState::SourceGood)
+            {
+                ast = FlatAst(result.get_ast()).encode();
+            }
+
+            int64_t size[2];
+            size[0] = messages.size();
+            size[1] = ast.size();
+
+            put_binary(record, header, 4);
+            put_binary(record, size, 2);
+            record.append(messages);
+            put_padding(record);
+            record.append(ast);
+            put_padding(record);
+
+            //
+            //  Let the tree go as soon as it's encoded. 
+            //
+
+            parser_list[i] = Parser();
+
+        }
+
+    });
+
+    //
+    //  Put the records together behind the header. 
+    //
+
+    vector<int64_t> result_start_list(source_count + 1);
+
+    int64_t position = 4 + sizeof(int32_t) + sizeof(int64_t) * (source_count + 2);
+    for (int64_t i = 0; i < source_count; i++)
+    {
+        result_start_list[i] = position;
+        position += record_list[i].size();
+    }
+
+    result_start_list[source_count] = position;
+
+    string buffer;
+    buffer.reserve(position);
 
-        throw;
+    buffer.append(batch_magic, 4);
+    put_binary(buffer, &batch_version, 1);
+    put_binary(buffer, &source_count, 1);
+    put_binary(buffer, result_start_list.data(), result_start_list.size());
 
+    for (string& record: record_list)
+    {
+        buffer.append(record);
+        string().swap(record);
     }
 
+    return buffer;
+
 }
 
 //
@@ -2655,7 +3470,10 @@ map<string, int> ParserImpl::get_kind_map() const
 
     }       
 
-    return prsd->get_kind_map();
+    map<string, int> kind_map = prsd->get_kind_map();
+    kind_map.insert(kind_overlay.begin(), kind_overlay.end());
+
+    return kind_map;
 
 }
 
@@ -2687,7 +3505,7 @@ string ParserImpl::get_encoded_kind_map() const
 
     ostringstream ost;
 
-    map<string, int> kind_map = prsd->get_kind_map();
+    map<string, int> kind_map = get_kind_map();
     encode_long(ost, kind_map.size());
 
     for (auto mp: kind_map)
@@ -2729,10 +3547,74 @@ Ast* ParserImpl::get_ast() const
 
     }
 
+    build_lazy_ast();
+
     return ast;
 
 }
 
+//
+//  build_lazy_ast                                                       
+//  --------------                                                       
+//                                                                       
+//  With lazy_ast the parse leaves only a log of its shifts and reduces. 
+//  The first accessor that needs the tree replays the log, and we let   
+//  the log go once the tree is built. A log that may fail was replayed  
+//  by the parse, so this can't add errors.                              
+//
+
+void ParserImpl::build_lazy_ast() const
+{
+
+    lock_guard<mutex> lock(lazy_ast_mutex);
+
+    if (reduce_log.empty())
+    {
+        return;
+    }
+
+    ParserEngine engine(const_cast<ParserImpl&>(*this), *prsd, 0);
+    engine.replay(reduce_log, *errh, ast, &lexeme_table);
+
+    reduce_log = ReduceLog();
+
+}
+
+//
+//  get_lexeme_table                                      
+//  ----------------                                      
+//                                                        
+//  Return the interned lexemes from a successful parse.  
+//
+
+const LexemeTable& ParserImpl::get_lexeme_table() const
+{
+
+    //
+    //  We need a valid parse to do this. 
+    //
+
+    switch (state)
+    {
+
+        case ParserState::SourceGood:
+        {
+            break;
+        }
+
+        default:
+        {
+            throw logic_error("State error in Parser::get_lexeme_table");
+        }
+
+    }
+
+    build_lazy_ast();
+
+    return lexeme_table;
+
+}
+
 //
 //  get_encoded_ast                                        
 //  ---------------                                        
@@ -2762,13 +3644,15 @@ string ParserImpl::get_encoded_ast() const
 
     }
 
+    build_lazy_ast();
+
     //
     //  Encode the kind map first followed by the Ast. 
     //
 
     ostringstream ost;
 
-    map<string, int> kind_map = prsd->get_kind_map();
+    map<string, int> kind_map = get_kind_map();
     encode_long(ost, kind_map.size());
 
     for (auto mp: kind_map)
@@ -2783,6 +3667,42 @@ string ParserImpl::get_encoded_ast() const
 
 }
 
+//
+//  get_binary_ast                                         
+//  --------------                                         
+//                                                 
+//  Return the result Ast from a successful parse in the binary form 
+//  described in FlatAst.cpp, with the kind map.
+//
+
+string ParserImpl::get_binary_ast() const
+{
+
+    //
+    //  We need a valid parse to do this. 
+    //
+
+    switch (state)
+    {
+
+        case ParserState::SourceGood:
+        {
+            break;
+        }
+
+        default:
+        {
+            throw logic_error("State error in Parser::get_binary_ast");
+        }
+
+    }
+
+    build_lazy_ast();
+
+    return FlatAst(ast).encode(get_kind_map());
+
+}
+
 //
 //  dump_ast                                              
 //  --------                                              
@@ -2793,7 +3713,14 @@ string ParserImpl::get_encoded_ast() const
 void ParserImpl::dump_ast(Ast* root, std::ostream& os, int indent) const
 {
 
-    function<void(const Ast*, int)> dump = [&](const Ast* ast, int indent) -> void
+    //
+    //  dump_node                                       
+    //  ---------                                       
+    //                                                  
+    //  Dump one node. The caller walks the children.   
+    //
+
+    function<void(const Ast*, int)> dump_node = [&](const Ast* ast, int indent) -> void
     {
 
         if (indent > 0)
@@ -2822,15 +3749,36 @@ void ParserImpl::dump_ast(Ast* root, std::ostream& os, int indent) const
 
         os << std::endl;
 
-        for (int i = 0; i < ast->get_num_children(); i++)
+    };
+
+    //
+    //  The function body begins here. We walk the tree in preorder with 
+    //  an explicit stack so a deep tree can't overflow the call stack.  
+    //
+
+    vector<pair<const Ast*, int>> stack;
+    stack.push_back(make_pair(root, indent));
+
+    while (stack.size() > 0)
+    {
+
+        const Ast* ast = stack.back().first;
+        int ast_indent = stack.back().second;
+        stack.pop_back();
+
+        dump_node(ast, ast_indent);
+
+        if (ast == nullptr)
         {
-            Ast* child = ast->get_child(i);
-            dump(child, indent + 4);
+            continue;
         }
 
-    };
+        for (int i = ast->get_num_children() - 1; i >= 0; i--)
+        {
+            stack.push_back(make_pair(ast->get_child(i), ast_indent + 4));
+        }
 
-    dump(root, indent);
+    }
 
 }
 
@@ -2863,6 +3811,17 @@ int ParserImpl::get_kind(const string& kind_str) const
 
     }       
 
+    if (kind_overlay.size() > 0)
+    {
+
+        auto it = kind_overlay.find(kind_str);
+        if (it != kind_overlay.end())
+        {
+            return it->second;
+        }
+
+    }
+
     return prsd->get_kind(kind_str);
 
 }
@@ -2871,7 +3830,9 @@ int ParserImpl::get_kind(const string& kind_str) const
 //  get_kind_force                                                          
 //  --------------                                                          
 //                                                                    
-//  Get the integer code for a given string.
+//  Get the integer code for a given string, adding it if it's new. Once 
+//  the ParserData is frozen it may be shared with other threads, so new 
+//  kinds go in our own overlay, numbered above anything it holds.       
 //
 
 int ParserImpl::get_kind_force(const string& kind_str)
@@ -2896,7 +3857,27 @@ int ParserImpl::get_kind_force(const string& kind_str)
 
     }       
 
-    return prsd->get_kind_force(kind_str);
+    if (!prsd->kind_map_frozen)
+    {
+        return prsd->get_kind_force(kind_str);
+    }
+
+    int kind = get_kind(kind_str);
+    if (kind >= 0)
+    {
+        return kind;
+    }
+
+    kind = prsd->kind_max + 1;
+    if (kind_ioverlay.size() > 0)
+    {
+        kind = kind_ioverlay.rbegin()->first + 1;
+    }
+
+    kind_overlay[kind_str] = kind;
+    kind_ioverlay[kind] = kind_str;
+
+    return kind;
 
 }
 
@@ -2921,6 +3902,17 @@ string ParserImpl::get_kind_string(int kind) const
 
     }       
 
+    if (kind_ioverlay.size() > 0)
+    {
+
+        auto it = kind_ioverlay.find(kind);
+        if (it != kind_ioverlay.end())
+        {
+            return it->second;
+        }
+
+    }
+
     return prsd->get_kind_string(kind);
 
 }
@@ -2951,7 +3943,7 @@ string ParserImpl::get_kind_string(const Ast* root) const
         return "Unknown";
     }
 
-    return prsd->get_kind_string(root->get_kind());
+    return get_kind_string(root->get_kind());
 
 }
 
@@ -3431,6 +4423,9 @@ void ParserImpl::decode(const string& str,
         prsd = new ParserData();
         ParserData::attach(prsd);
 
+        kind_overlay.clear();
+        kind_ioverlay.clear();
+
         errh = new ErrorHandler(prsd->src);
         prsd->decode(str, kind_map);
 
@@ -3530,7 +4525,14 @@ string ParserImpl::get_grammar_kind_string(int kind) const
 void ParserImpl::dump_grammar_ast(Ast* root, std::ostream& os, int indent) const
 {
 
-    function<void(const Ast*, int)> dump = [&](const Ast* ast, int indent) -> void
+    //
+    //  dump_node                                       
+    //  ---------                                       
+    //                                                  
+    //  Dump one node. The caller walks the children.   
+    //
+
+    function<void(const Ast*, int)> dump_node = [&](const Ast* ast, int indent) -> void
     {
 
         if (indent > 0)
@@ -3559,15 +4561,36 @@ void ParserImpl::dump_grammar_ast(Ast* root, std::ostream& os, int indent) const
 
         os << std::endl;
 
-        for (int i = 0; i < ast->get_num_children(); i++)
+    };
+
+    //
+    //  The function body begins here. We walk the tree in preorder with 
+    //  an explicit stack so a deep tree can't overflow the call stack.  
+    //
+
+    vector<pair<const Ast*, int>> stack;
+    stack.push_back(make_pair(root, indent));
+
+    while (stack.size() > 0)
+    {
+
+        const Ast* ast = stack.back().first;
+        int ast_indent = stack.back().second;
+        stack.pop_back();
+
+        dump_node(ast, ast_indent);
+
+        if (ast == nullptr)
         {
-            Ast* child = ast->get_child(i);
-            dump(child, indent + 4);
+            continue;
         }
 
-    };
+        for (int i = ast->get_num_children() - 1; i >= 0; i--)
+        {
+            stack.push_back(make_pair(ast->get_child(i), ast_indent + 4));
+        }
 
-    dump(root, indent);
+    }
 
 }
 
@@ -3652,13 +4675,38 @@ void ParserImpl::get_source_string(Ast* ast, string& source, int64_t& adjustment
 //                                                                      
 //  Expand expressions in sub languages. These are regular expressions, 
 //  character sets in regular expressions and regex macros.                   
+//                                                                      
+//  The sub parses are independent, so we collect them in a first pass, 
+//  run them in parallel and then splice the results back in tree      
+//  order. Errors are reported in that same order, so the outcome      
+//  doesn't depend on thread scheduling.                                
 //
 
 void ParserImpl::expand_subtrees(Ast* ast, bool& any_changes, int64_t debug_flags)
 {
 
-    function<void(Ast*, bool&, int64_t)> expand_subtrees_r =
-        [&](Ast* ast, bool& any_changes, int64_t debug_flags) -> void
+    //
+    //  SubParse                                                       
+    //  --------                                                       
+    //                                                                 
+    //  A single string to parse and where to put the result.          
+    //
+
+    struct SubParse
+    {
+        Ast* parent = nullptr;
+        int child_num = 0;
+        ParserData* parser_data = nullptr;
+        string source;
+        int64_t adjustment = 0;
+        bool unknown_macro = false;
+        Ast* child_ast = nullptr;
+        vector<ErrorMessage> error_list;
+    };
+
+    vector<SubParse> sub_parse_list;
+
+    function<void(Ast*)> find_sub_parses = [&](Ast* ast) -> void
     {
 
         for (int i = 0; i < ast->get_num_children(); i++)
@@ -3676,46 +4724,15 @@ void ParserImpl::expand_subtrees(Ast* ast, bool& any_changes, int64_t debug_flag
 
                     any_changes = true;
 
-                    string source;
-                    int64_t adjustment = 0;
-                    get_source_string(ast->get_child(i)->get_child(0), source, adjustment);
-                     
-                    ErrorHandler child_errh(source);
-                    Ast* child_ast = nullptr;
-        
-                    try {
-
-                        ParserEngine(*this,
-                                     child_errh,
-                                     *regex_parser_data,
-                                     source,
-                                     child_ast,
-                                     debug_flags)
-                            .parse();
-
-                    }
-                    catch (SourceError e)
-                    {
-
-                       for (auto msg: child_errh.get_error_messages())
-                       {
-
-                            errh->add_error(msg.get_type(),
-                                            (msg.get_location() < 0 || adjustment < 0) ?
-                                                msg.get_location() : msg.get_location() + adjustment,
-                                            msg.get_short_message(),
-                                            msg.get_long_message());
-
-                        }
+                    SubParse sub_parse;
+                    sub_parse.parent = ast;
+                    sub_parse.child_num = i;
+                    sub_parse.parser_data = regex_parser_data;
+                    get_source_string(ast->get_child(i)->get_child(0),
+                                      sub_parse.source,
+                                      sub_parse.adjustment);
 
-                        child_ast = new Ast(0);
-                        child_ast->set_kind(-1);
-
-                    }
-                                        
-                    adjust_location(child_ast, adjustment);
-                    delete ast->get_child(i);
-                    ast->set_child(i, child_ast);
+                    sub_parse_list.push_back(sub_parse);
 
                     break;
 
@@ -3730,46 +4747,15 @@ void ParserImpl::expand_subtrees(Ast* ast, bool& any_changes, int64_t debug_flag
 
                     any_changes = true;
 
-                    string source;
-                    int64_t adjustment = 0;
-                    get_source_string(ast->get_child(i), source, adjustment);
-                     
-                    ErrorHandler child_errh(source);
-                    Ast* child_ast = nullptr;
-        
-                    try {
-
-                        ParserEngine(*this,
-                                     child_errh,
-                                     *charset_parser_data,
-                                     source,
-                                     child_ast,
-                                     debug_flags)
-                            .parse();
-
-                    }
-                    catch (SourceError e)
-                    {
-
-                       for (auto msg: child_errh.get_error_messages())
-                       {
+                    SubParse sub_parse;
+                    sub_parse.parent = ast;
+                    sub_parse.child_num = i;
+                    sub_parse.parser_data = charset_parser_data;
+                    get_source_string(ast->get_child(i),
+                                      sub_parse.source,
+                                      sub_parse.adjustment);
 
-                            errh->add_error(msg.get_type(),
-                                            (msg.get_location() < 0 || adjustment < 0) ?
-                                                msg.get_location() : msg.get_location() + adjustment,
-                                            msg.get_short_message(),
-                                            msg.get_long_message());
-
-                        }
-
-                        child_ast = new Ast(0);
-                        child_ast->set_kind(-1);
-
-                    }
-                                        
-                    adjust_location(child_ast, adjustment);
-                    delete ast->get_child(i);
-                    ast->set_child(i, child_ast);
+                    sub_parse_list.push_back(sub_parse);
 
                     break;
 
@@ -3784,61 +4770,26 @@ void ParserImpl::expand_subtrees(Ast* ast, bool& any_changes, int64_t debug_flag
 
                     any_changes = true;
 
+                    SubParse sub_parse;
+                    sub_parse.parent = ast;
+                    sub_parse.child_num = i;
+                    sub_parse.parser_data = regex_parser_data;
+
                     string key;
-                    int64_t adjustment = 0;
-                    get_source_string(ast->get_child(i), key, adjustment);
+                    get_source_string(ast->get_child(i), key, sub_parse.adjustment);
 
                     LibraryToken* token = LibraryToken::get_library_token(key);
                     if (token == nullptr || token->regex_string.length() == 0)
                     {
-
-                        ostringstream ost;
-                        ost << "Unknown regex macro: " << key << ".";
-
-                        errh->add_error(ErrorType::ErrorUnknownMacro,
-                                        ast->get_child(i)->get_location(),
-                                        ost.str());
-
-                        throw GrammarError("Grammar errors");
-                        
-                    }
-
-                    ErrorHandler child_errh(token->regex_string);
-                    Ast* child_ast = nullptr;
-        
-                    try {
-
-                        ParserEngine(*this,
-                                     child_errh,
-                                     *regex_parser_data,
-                                     token->regex_string,
-                                     child_ast,
-                                     debug_flags)
-                            .parse();
-
+                        sub_parse.unknown_macro = true;
+                        sub_parse.source = key;
                     }
-                    catch (SourceError e)
+                    else
                     {
-
-                       for (auto msg: child_errh.get_error_messages())
-                       {
-
-                            errh->add_error(msg.get_type(),
-                                            (msg.get_location() < 0 || adjustment < 0) ?
-                                                msg.get_location() : msg.get_location() + adjustment,
-                                            msg.get_short_message(),
-                                            msg.get_long_message());
-
-                        }
-
-                        child_ast = new Ast(0);
-                        child_ast->set_kind(-1);
-
+                        sub_parse.source = token->regex_string;
                     }
-                                        
-                    adjust_location(child_ast, adjustment);
-                    delete ast->get_child(i);
-                    ast->set_child(i, child_ast);
+
+                    sub_parse_list.push_back(sub_parse);
 
                     break;
 
@@ -3851,7 +4802,7 @@ void ParserImpl::expand_subtrees(Ast* ast, bool& any_changes, int64_t debug_flag
 
                 default:
                 {
-                    expand_subtrees_r(ast->get_child(i), any_changes, debug_flags);
+                    find_sub_parses(ast->get_child(i));
                     break;
                 }
 
@@ -3861,7 +4812,107 @@ void ParserImpl::expand_subtrees(Ast* ast, bool& any_changes, int64_t debug_flag
 
     };
 
-    expand_subtrees_r(ast, any_changes, debug_flags);
+    find_sub_parses(ast);
+
+    //
+    //  Run the parses. Each has its own error handler and touches      
+    //  nothing shared but the parse tables, which are read only. With  
+    //  debug output on we stay on this thread to keep it readable.      
+    //
+
+    int64_t num_threads = 1;
+    if (debug_flags == 0)
+    {
+        num_threads = min(ThreadPool::default_num_threads(),
+                          static_cast<int64_t>(sub_parse_list.size()));
+    }
+
+    ThreadPool pool(num_threads);
+
+    pool.parallel_for(sub_parse_list.size(), [&](int64_t i) -> void
+    {
+
+        SubParse& sub_parse = sub_parse_list[i];
+
+        if (sub_parse.unknown_macro)
+        {
+            return;
+        }
+
+        ErrorHandler child_errh(sub_parse.source);
+        Ast* child_ast = nullptr;
+
+        try {
+
+            ParserEngine(*this,
+                         child_errh,
+                         *sub_parse.parser_data,
+                         sub_parse.source,
+                         child_ast,
+                         debug_flags)
+                .parse();
+
+        }
+        catch (SourceError e)
+        {
+
+            sub_parse.error_list = child_errh.get_error_messages();
+
+            child_ast = new Ast(0);
+            child_ast->set_kind(-1);
+
+        }
+
+        adjust_location(child_ast, sub_parse.adjustment);
+        sub_parse.child_ast = child_ast;
+
+    });
+
+    //
+    //  Splice the results in and report errors in tree order. An unknown 
+    //  macro stops us short, just as if we'd been parsing as we went.    
+    //
+
+    for (size_t i = 0; i < sub_parse_list.size(); i++)
+    {
+
+        SubParse& sub_parse = sub_parse_list[i];
+        Ast* old_ast = sub_parse.parent->get_child(sub_parse.child_num);
+
+        if (sub_parse.unknown_macro)
+        {
+
+            ostringstream ost;
+            ost << "Unknown regex macro: " << sub_parse.source << ".";
+
+            errh->add_error(ErrorType::ErrorUnknownMacro,
+                            old_ast->get_location(),
+                            ost.str());
+
+            for (size_t j = i + 1; j < sub_parse_list.size(); j++)
+            {
+                delete sub_parse_list[j].child_ast;
+            }
+
+            throw GrammarError("Grammar errors");
+                        
+        }
+
+        for (auto msg: sub_parse.error_list)
+        {
+
+            errh->add_error(msg.get_type(),
+                            (msg.get_location() < 0 || sub_parse.adjustment < 0) ?
+                                msg.get_location() : msg.get_location() + sub_parse.adjustment,
+                            msg.get_short_message(),
+                            msg.get_long_message());
+
+        }
+
+        delete old_ast;
+        sub_parse.parent->set_child(sub_parse.child_num, sub_parse.child_ast);
+
+    }
 
     if (errh->get_error_count() > 0)
     {
@@ -4003,23 +5054,39 @@ string ParserImpl::decode_string(istream& is)
 
 }
 
-void ParserImpl::encode_ast(ostream& os, const Ast* ast)
+void ParserImpl::encode_ast(ostream& os, const Ast* root)
 {
 
-    if (ast == nullptr)
-    {
-        encode_long(os, -1);
-        return;
-    }
+    //
+    //  We walk the tree in preorder with an explicit stack so a deep tree 
+    //  can't overflow the call stack.                                     
+    //
 
-    encode_long(os, ast->get_num_children());
-    encode_long(os, ast->get_kind());
-    encode_long(os, ast->get_location());
-    encode_string(os, ast->get_lexeme());
+    vector<const Ast*> stack;
+    stack.push_back(root);
 
-    for (int i = 0; i < ast->get_num_children(); i++)
+    while (stack.size() > 0)
     {
-        encode_ast(os, ast->get_child(i));
+
+        const Ast* ast = stack.back();
+        stack.pop_back();
+
+        if (ast == nullptr)
+        {
+            encode_long(os, -1);
+            continue;
+        }
+
+        encode_long(os, ast->get_num_children());
+        encode_long(os, ast->get_kind());
+        encode_long(os, ast->get_location());
+        encode_string(os, ast->get_lexeme());
+
+        for (int i = ast->get_num_children() - 1; i >= 0; i--)
+        {
+            stack.push_back(ast->get_child(i));
+        }
+
     }
 
 }
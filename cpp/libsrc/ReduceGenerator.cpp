@@ -13,6 +13,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -56,6 +57,15 @@ void (*ReduceGenerator::former_handler[])(ReduceGenerator& redg,
     handle_error,                  // Conflicts
     handle_error,                  // KeepWhitespace
     handle_error,                  // CaseSensitive
+    handle_error,                  // LookaheadMethod
+    handle_error,                  // TableScheme
+    handle_error,                  // KeywordTable
+    handle_error,                  // LinearScan
+    handle_error,                  // LazyScanner
+    handle_error,                  // PipelineScanner
+    handle_error,                  // InternLexemes
+    handle_error,                  // LazyAst
+    handle_error,                  // MinimizeMethod
     handle_error,                  // TokenDeclaration
     handle_error,                  // TokenOptionList
     handle_error,                  // TokenTemplate
@@ -67,6 +77,7 @@ void (*ReduceGenerator::former_handler[])(ReduceGenerator& redg,
     handle_error,                  // TokenLexeme
     handle_error,                  // TokenIgnore
     handle_error,                  // TokenError
+    handle_error,                  // TokenSync
     handle_error,                  // Rule
     handle_error,                  // RuleRhsList
     handle_error,                  // RuleRhs
@@ -187,6 +198,15 @@ const char* ReduceGenerator::former_handler_name[]
     "handle_error",                // Conflicts
     "handle_error",                // KeepWhitespace
     "handle_error",                // CaseSensitive
+    "handle_error",                // LookaheadMethod
+    "handle_error",                // TableScheme
+    "handle_error",                // KeywordTable
+    "handle_error",                // LinearScan
+    "handle_error",                // LazyScanner
+    "handle_error",                // PipelineScanner
+    "handle_error",                // InternLexemes
+    "handle_error",                // LazyAst
+    "handle_error",                // MinimizeMethod
     "handle_error",                // TokenDeclaration
     "handle_error",                // TokenOptionList
     "handle_error",                // TokenTemplate
@@ -198,6 +218,7 @@ const char* ReduceGenerator::former_handler_name[]
     "handle_error",                // TokenLexeme
     "handle_error",                // TokenIgnore
     "handle_error",                // TokenError
+    "handle_error",                // TokenSync
     "handle_error",                // Rule
     "handle_error",                // RuleRhsList
     "handle_error",                // RuleRhs
@@ -311,12 +332,21 @@ const char* ReduceGenerator::former_handler_name[]
 //                                                                      
 //  Traverse the Ast attached to the rule generating code to adjust the 
 //  Ast stack.                                                          
+//                                                                      
+//  Rules without actions need no code, and rules that just form an Ast 
+//  from their rhs with the default former are left for the parser to   
+//  do inline. Many of the rest have exactly the same code, like all    
+//  the rules of a given length hoisting $1, so we keep one copy of     
+//  each distinct block and point the rules at that.                    
 //
 
 void ReduceGenerator::generate()
 {
 
     rule_label.clear();
+    rule_kind.clear();
+
+    map<string, ICodeLabel*> signature_map;
 
     for (Rule* rule: gram.rule_list)
     {
@@ -327,10 +357,26 @@ void ReduceGenerator::generate()
                 rule->action_ast->get_kind() == AstType::AstNull))  
         {
             rule_label.push_back(nullptr);
+            rule_kind.push_back(-1);
+        }
+        else if (get_inline_kind(rule) >= 0)
+        {
+            rule_label.push_back(nullptr);
+            rule_kind.push_back(get_inline_kind(rule));
         }
         else
         {
 
+            //
+            //  Start each block with the same temporaries, so identical 
+            //  blocks come out identical.                               
+            //
+
+            code.free_all_temporaries();
+            code.free_all_asts();
+
+            int64_t position = code.get_code_size();
+
             ICodeLabel* label_ptr = code.get_label();
             rule_label.push_back(label_ptr);
             label_ptr->is_extern = true;
@@ -383,12 +429,86 @@ void ReduceGenerator::generate()
 
             code.emit(OpcodeType::OpcodeReturn, rule->location);
 
+            rule_kind.push_back(-1);
+
+            string signature = code.get_code_signature(position + 1);
+            auto it = signature_map.find(signature);
+
+            if (it == signature_map.end())
+            {
+                signature_map[signature] = label_ptr;
+            }
+            else
+            {
+                code.discard_code(position);
+                label_ptr->is_extern = false;
+                rule_label.back() = it->second;
+            }
+
         }
 
     }
 
 }
 
+//
+//  get_inline_kind                                                       
+//  ---------------                                                       
+//                                                                        
+//  If the rule's only action is a former like (Kind, $1, $2, ..., $n),    
+//  using each rhs item once and in order, return the kind. That's what   
+//  the default former looks like, and the parser can do it without any  
+//  code. Otherwise return -1.                                            
+//
+
+int64_t ReduceGenerator::get_inline_kind(Rule* rule)
+{
+
+    if (rule->action_ast != nullptr &&
+        rule->action_ast->get_kind() != AstType::AstNull)
+    {
+        return -1;
+    }
+
+    Ast* root = rule->ast_former_ast;
+
+    if (root == nullptr ||
+        root->get_kind() != AstType::AstAstFormer ||
+        root->get_num_children() != rule->rhs.size() + 1 ||
+        root->get_child(0)->get_kind() != AstType::AstIdentifier)
+    {
+        return -1;
+    }
+
+    for (int i = 1; i <= rule->rhs.size(); i++)
+    {
+
+        Ast* child = root->get_child(i);
+
+        if (child->get_kind() != AstType::AstAstChild ||
+            (child->get_child(1) != nullptr &&
+             child->get_child(1)->get_kind() != AstType::AstNull))
+        {
+            return -1;
+        }
+
+        Ast* dot = child->get_child(0);
+
+        if (dot == nullptr ||
+            dot->get_kind() != AstType::AstAstDot ||
+            dot->get_num_children() != 1 ||
+            dot->get_child(0)->get_kind() != AstType::AstInteger ||
+            atol(dot->get_child(0)->get_lexeme().c_str()) != i)
+        {
+            return -1;
+        }
+
+    }
+
+    return prsd.get_kind_force(root->get_child(0)->get_lexeme());
+
+}
+
 //
 //  handle_former                                                         
 //  -------------                                                         
@@ -1085,6 +1205,9 @@ void ReduceGenerator::save_parser_data()
 
     }
 
+    prsd.rule_kind = new int[rule_kind.size()];
+    copy(rule_kind.begin(), rule_kind.end(), prsd.rule_kind);
+
 }
 
 } // namespace hoshi
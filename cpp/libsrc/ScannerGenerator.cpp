@@ -17,6 +17,7 @@
 #include <cctype>
 #include <memory>
 #include <cstdlib>
+#include <algorithm>
 #include <functional>
 #include <string>
 #include <queue>
@@ -72,6 +73,15 @@ void (*ScannerGenerator::build_nfa_handler[])(ScannerGenerator& scan, Ast* root,
     handle_error,                     // Conflicts
     handle_error,                     // KeepWhitespace
     handle_error,                     // CaseSensitive
+    handle_error,                     // LookaheadMethod
+    handle_error,                     // TableScheme
+    handle_error,                     // KeywordTable
+    handle_error,                     // LinearScan
+    handle_error,                     // LazyScanner
+    handle_error,                     // PipelineScanner
+    handle_error,                     // InternLexemes
+    handle_error,                     // LazyAst
+    handle_error,                     // MinimizeMethod
     handle_error,                     // TokenDeclaration
     handle_error,                     // TokenOptionList
     handle_error,                     // TokenTemplate
@@ -83,6 +93,7 @@ void (*ScannerGenerator::build_nfa_handler[])(ScannerGenerator& scan, Ast* root,
     handle_error,                     // TokenLexeme
     handle_error,                     // TokenIgnore
     handle_error,                     // TokenError
+    handle_error,                     // TokenSync
     handle_error,                     // Rule
     handle_error,                     // RuleRhsList
     handle_error,                     // RuleRhs
@@ -203,6 +214,15 @@ const char* ScannerGenerator::build_nfa_handler_name[]
     "handle_error",                   // Conflicts
     "handle_error",                   // KeepWhitespace
     "handle_error",                   // CaseSensitive
+    "handle_error",                   // LookaheadMethod
+    "handle_error",                   // TableScheme
+    "handle_error",                   // KeywordTable
+    "handle_error",                   // LinearScan
+    "handle_error",                   // LazyScanner
+    "handle_error",                   // PipelineScanner
+    "handle_error",                   // InternLexemes
+    "handle_error",                   // LazyAst
+    "handle_error",                   // MinimizeMethod
     "handle_error",                   // TokenDeclaration
     "handle_error",                   // TokenOptionList
     "handle_error",                   // TokenTemplate
@@ -214,6 +234,7 @@ const char* ScannerGenerator::build_nfa_handler_name[]
     "handle_error",                   // TokenLexeme
     "handle_error",                   // TokenIgnore
     "handle_error",                   // TokenError
+    "handle_error",                   // TokenSync
     "handle_error",                   // Rule
     "handle_error",                   // RuleRhsList
     "handle_error",                   // RuleRhs
@@ -329,6 +350,18 @@ const char* ScannerGenerator::build_nfa_handler_name[]
 //
 
 ScannerGenerator::~ScannerGenerator()
+{
+    delete_states();
+}
+
+//
+//  delete_states                                                  
+//  -------------                                                  
+//                                                                 
+//  Free the states, so we can build another automaton if we must. 
+//
+
+void ScannerGenerator::delete_states()
 {
 
     for (auto p: allocated_states)
@@ -336,6 +369,8 @@ ScannerGenerator::~ScannerGenerator()
         delete p;
     }
 
+    allocated_states.clear();
+
 }
 
 //
@@ -353,57 +388,174 @@ ScannerGenerator::~ScannerGenerator()
 void ScannerGenerator::generate()
 {
 
-    if ((debug_flags & DebugType::DebugProgress) != 0)
+    if (!automaton_built)
     {
-        cout << "Beginning scanner generation: "
-             << prsi.elapsed_time_string() << endl;
+        build_automaton();
     }
 
     //
-    //  Construct an NFA with e-moves from the Ast's or literal strings 
-    //  stored with the tokens.                                       
+    //  Create the intermediate code for the scanner and save it in the 
+    //  ParserData.                                                      
     //
 
-    construct_nfa();
-    if ((debug_flags & DebugType::DebugScanner) != 0)
+    create_vmcode();
+    check_pipeline();
+    check_parallel();
+
+    if ((debug_flags & DebugType::DebugProgress) != 0)
     {
-        prsi.log_heading("NFA scanner: " + prsi.elapsed_time_string());
-        dump_automaton(nfa_start_state);
+        cout << "Finished scanner generation: " << prsi.elapsed_time_string() << endl;
     }
 
-    //
-    //  Convert the NFA with e-moves into a DFA. 
-    //
+}
+
+//
+//  build_automaton                                                        
+//  ---------------                                                        
+//                                                                         
+//  Build the minimal DFA. None of this depends on the parse tables, so    
+//  the caller may run it alongside LALR generation and then call          
+//  generate() to finish up once symbol numbers have been assigned.       
+//
 
-    nfa_to_dfa();
-    if ((debug_flags & DebugType::DebugScanner) != 0)
+void ScannerGenerator::build_automaton()
+{
+
+    if ((debug_flags & DebugType::DebugProgress) != 0)
     {
-        prsi.log_heading("DFA scanner: " + prsi.elapsed_time_string());
-        dump_automaton(dfa_start_state);
+        cout << "Beginning scanner generation: "
+             << prsi.elapsed_time_string() << endl;
     }
 
     //
-    //  Minimize the size of the DFA. 
+    //  Pick out the keywords we can leave to the keyword table. 
     //
 
-    minimize_dfa();
-    if ((debug_flags & DebugType::DebugScanner) != 0)
+    find_keywords();
+
+    for (;;)
+    {
+
+        //
+        //  Construct an NFA with e-moves from the Ast's or literal strings 
+        //  stored with the tokens.                                       
+        //
+
+        construct_nfa();
+        if ((debug_flags & DebugType::DebugScanner) != 0)
+        {
+            prsi.log_heading("NFA scanner: " + prsi.elapsed_time_string());
+            dump_automaton(nfa_start_state);
+        }
+
+        //
+        //  The lazy scanner stops here. The parser builds DFA states from 
+        //  the NFA as it needs them.                                      
+        //
+
+        if (gram.lazy_scanner)
+        {
+
+            if ((debug_flags & DebugType::DebugProgress) != 0)
+            {
+                cout << "Scanner NFA built: "
+                     << allocated_states.size() << " states, "
+                     << prsi.elapsed_time_string()
+                     << endl;
+            }
+
+            break;
+
+        }
+
+        //
+        //  Convert the NFA with e-moves into a DFA. 
+        //
+
+        nfa_to_dfa();
+        if ((debug_flags & DebugType::DebugProgress) != 0)
+        {
+            cout << "Scanner DFA built: "
+                 << allocated_states.size() - nfa_state_count << " states, "
+                 << prsi.elapsed_time_string()
+                 << endl;
+        }
+
+        if ((debug_flags & DebugType::DebugScanner) != 0)
+        {
+            prsi.log_heading("DFA scanner: " + prsi.elapsed_time_string());
+            dump_automaton(dfa_start_state);
+        }
+
+        //
+        //  Minimize the size of the DFA. 
+        //
+
+        if (gram.minimize_method == "pairwise")
+        {
+            minimize_dfa_pairwise();
+        }
+        else if (gram.minimize_method == "compare")
+        {
+            compare_minimize_methods();
+        }
+        else
+        {
+            minimize_dfa();
+        }
+
+        if ((debug_flags & DebugType::DebugProgress) != 0)
+        {
+            cout << "Scanner DFA minimized: "
+                 << dfa_state_count << " states, "
+                 << prsi.elapsed_time_string()
+                 << endl;
+        }
+
+        if ((debug_flags & DebugType::DebugScanner) != 0)
+        {
+            prsi.log_heading("DFA scanner after optimizing: " + prsi.elapsed_time_string());
+            dump_automaton(dfa_start_state);
+        }
+
+        //
+        //  A keyword the identifier wouldn't win with has to go back in 
+        //  the automaton, so in that rare case we build it again.       
+        //
+
+        if (!check_keywords())
+        {
+            break;
+        }
+
+        delete_states();
+
+    }
+
+    if ((debug_flags & DebugType::DebugProgress) != 0 && keyword_set.size() > 0)
     {
-        prsi.log_heading("DFA scanner after optimizing: " + prsi.elapsed_time_string());
-        dump_automaton(dfa_start_state);
+        cout << "Scanner keyword table: "
+             << keyword_set.size() << " keywords, "
+             << prsi.elapsed_time_string()
+             << endl;
     }
 
     //
-    //  Create the intermediate code for the scanner and save it in the 
-    //  ParserData.                                                      
+    //  Group the characters into equivalence classes. 
     //
 
-    create_vmcode();
+    build_char_classes();
     if ((debug_flags & DebugType::DebugProgress) != 0)
     {
-        cout << "Finished scanner generation: " << prsi.elapsed_time_string() << endl;
+        cout << "Scanner character classes: "
+             << char_class_count << " classes, "
+             << char_page_data.size() / 256 << " distinct pages, "
+             << prsi.elapsed_time_string()
+             << endl;
     }
 
+    automaton_built = true;
+
 }
 
 //
@@ -412,10 +564,10 @@ void ScannerGenerator::generate()
 //                                                                    
 //  Construct an NFA with e-moves from regex Ast's stored with the   
 //  tokens. For tokens without Ast's build one from the literal 
-//  string.                                                           
+//  string. If we're given a token we build the NFA for it alone.    
 //
 
-void ScannerGenerator::construct_nfa()
+void ScannerGenerator::construct_nfa(Symbol* only_token)
 {
 
     nfa_start_state = get_new_state();
@@ -425,7 +577,9 @@ void ScannerGenerator::construct_nfa()
 
         Symbol* token = mp.second;
 
-        if (!token->is_scanned)
+        if (!token->is_scanned ||
+            keyword_set.find(token) != keyword_set.end() ||
+            (only_token != nullptr && token != only_token))
         {
             continue;
         }
@@ -812,7 +966,7 @@ void ScannerGenerator::handle_regex_char(ScannerGenerator& scan,
                                          Context& ctx)
 {
 
-    char32_t character = root->get_lexeme()[0];
+    char32_t character = Source::to_utf32(root->get_lexeme())[0];
     ctx.final_state = scan.get_new_state();
 
     ctx.start_state->transitions.insert(
@@ -1419,7 +1573,7 @@ void ScannerGenerator::handle_charset_char(ScannerGenerator& scan,
                                            Ast* root,
                                            Context& ctx)
 {
-    ctx.character = root->get_lexeme()[0];
+    ctx.character = Source::to_utf32(root->get_lexeme())[0];
 }
 
 //
@@ -1553,7 +1707,8 @@ void ScannerGenerator::handle_charset_right_bracket(ScannerGenerator& scan,
 //  ----------
 //                                                                      
 //  Convert the NFA with e-moves into a DFA. This is described well in 
-//  Hopcraft and Ullman's automata book.                           
+//  Hopcraft and Ullman's automata book. Everything allocated so far is 
+//  part of the NFA, so that's the size of our state sets.             
 //
 
 void ScannerGenerator::nfa_to_dfa()
@@ -1561,9 +1716,10 @@ void ScannerGenerator::nfa_to_dfa()
 
     nfa_to_dfa_map.clear();
     dfa_to_nfa_map.clear();
+    nfa_state_count = allocated_states.size();
 
-    StateSet state_set;
-    state_set.get().insert(nfa_start_state);
+    StateSet state_set(nfa_state_count);
+    state_set.insert(nfa_start_state);
     find_e_closure(state_set);
     dfa_start_state = get_dfa_state(state_set);
 
@@ -1597,9 +1753,8 @@ void ScannerGenerator::find_e_closure(StateSet& closure)
         for (auto next_state: state->e_moves)
         {
         
-            if (closure.get().find(next_state) == closure.get().end())
+            if (closure.insert(next_state))
             {
-                closure.get().insert(next_state);
                 additions.push_back(next_state);
             }
 
@@ -1619,14 +1774,15 @@ void ScannerGenerator::find_e_closure(StateSet& closure)
 ScannerGenerator::State* ScannerGenerator::get_dfa_state(StateSet& state_set)
 {
 
-    if (nfa_to_dfa_map.find(state_set) != nfa_to_dfa_map.end())
+    auto it = nfa_to_dfa_map.find(state_set);
+    if (it != nfa_to_dfa_map.end())
     {
-        return nfa_to_dfa_map[state_set];
+        return it->second;
     }
 
     State* state = get_new_state();
-    nfa_to_dfa_map[state_set] = state;
-    dfa_to_nfa_map[state] = state_set;
+    nfa_to_dfa_map.insert(make_pair(state_set, state));
+    dfa_to_nfa_map.insert(make_pair(state, state_set));
     workpile.push(state);
 
     return state;
@@ -1649,7 +1805,7 @@ void ScannerGenerator::collapse_dfa_state(State* state)
 
     set<Transition> transitions;
 
-    for (auto nfa_state: dfa_to_nfa_map[state].get())
+    for (auto nfa_state: dfa_to_nfa_map.find(state)->second.get())
     {
 
         for (auto transition: nfa_state->transitions)
@@ -1779,10 +1935,10 @@ void ScannerGenerator::collapse_dfa_state(State* state)
             if (!included_heap.empty())
             {
 
-                StateSet state_set;
+                StateSet state_set(nfa_state_count);
                 for (auto transition: included_set)
                 {
-                    state_set.get().insert(transition.target_state);
+                    state_set.insert(transition.target_state);
                 }
 
                 find_e_closure(state_set);
@@ -1809,10 +1965,10 @@ void ScannerGenerator::collapse_dfa_state(State* state)
             if (!included_heap.empty())
             {
 
-                StateSet state_set;
+                StateSet state_set(nfa_state_count);
                 for (auto transition: included_set)
                 {
-                    state_set.get().insert(transition.target_state);
+                    state_set.insert(transition.target_state);
                 }
 
                 find_e_closure(state_set);
@@ -1857,407 +2013,1814 @@ void ScannerGenerator::collapse_dfa_state(State* state)
 //  states. I doubt if this will actually improve the automaton much but 
 //  it seems like we should try.                                         
 //                                                                       
-//  The algorithm is again described in Hopcraft and Ullman.        
+//  We use Hopcroft's partition refinement algorithm. We start with the  
+//  states grouped by what they accept, and split groups until no group  
+//  has states that disagree on where some character takes them. Each    
+//  time a block splits we only need to revisit the smaller half, which  
+//  keeps the whole thing at O(n log n) in the number of transitions.    
+//                                                                       
+//  Transitions are on character ranges rather than single characters,   
+//  so we work with the elementary intervals between range boundaries as 
+//  our alphabet.                                                        
 //
 
 void ScannerGenerator::minimize_dfa()
 {
 
     //
-    //  SimilarKey                                                         
-    //  ----------                                                         
-    //                                                                     
-    //  This is a map key facilitating an efficiency gimmick. On each pass 
-    //  of this procedure we need to determine if each pair of states is   
-    //  distinguishable. We can cut this down by only comparing states     
-    //  that are similar, where two states are definitely similar if they  
-    //  are indistinguishable. Here we define similar as having the same     
-    //  accepted tokens and the same transition domain.                    
+    //  identical_asts                       
+    //  --------------                       
+    //                                       
+    //  Test whether two asts are identical. 
     //
 
-    class SimilarKey
+    function<bool(Ast*, Ast*)> identical_asts = [&](Ast* left, Ast* right) -> bool
     {
 
-    public:    
+        if (left == right)
+        {
+            return true;
+        }
 
-        explicit SimilarKey(State* state) : state(state) {}
+        if (left == nullptr || right == nullptr)
+        {
+            return false;
+        }
 
-        bool operator<(const SimilarKey& rhs) const
+        if (left->get_kind() != right->get_kind() ||
+            left->get_lexeme() != right->get_lexeme() ||
+            left->get_num_children() != right->get_num_children())
+        {
+            return false;
+        }
+        
+        for (int i = 0; i < left->get_num_children(); i++)
         {
 
-            State* left = state;
-            State* right = rhs.state;
+            if (!identical_asts(left->get_child(i), right->get_child(i)))
+            {
+                return false;
+            }
 
-            auto left_accept = left->accept_actions.begin();
-            auto right_accept = right->accept_actions.begin();
+        }
 
-            while (left_accept != left->accept_actions.end() ||
-                   right_accept != right->accept_actions.end())
-            {
+        return true;
 
-                if (left_accept == left->accept_actions.end())
-                {
-                    return true;
-                }
-                else if (right_accept == right->accept_actions.end())
-                {
-                    return false;
-                }
+    };
 
-                if (left_accept->token < right_accept->token)
-                {
-                    return true;
-                }
-                else if (left_accept->token > right_accept->token)
-                {
-                    return false;
-                }
-                 
-                left_accept++;
-                right_accept++;
+    //
+    //  same_accepts                                          
+    //  ------------                                          
+    //                                                        
+    //  Test whether two states accept the same tokens under  
+    //  the same guards. States that don't can never merge.   
+    //
 
-            } 
+    function<bool(State*, State*)> same_accepts = [&](State* left, State* right) -> bool
+    {
 
-            auto left_transition = left->transitions.begin();
-            auto right_transition = right->transitions.begin();
+        auto left_accept = left->accept_actions.begin();
+        auto right_accept = right->accept_actions.begin();
 
-            while (left_transition != left->transitions.end() ||
-                   right_transition != right->transitions.end())
+        while (left_accept != left->accept_actions.end() ||
+               right_accept != right->accept_actions.end())
+        {
+
+            if (left_accept == left->accept_actions.end() ||
+                right_accept == right->accept_actions.end() ||
+                left_accept->token != right_accept->token ||
+                !identical_asts(left_accept->guard_ast, right_accept->guard_ast))
             {
+                return false;
+            }
 
-                if (left_transition == left->transitions.end())
-                {
-                    return true;
-                }
-                else if (right_transition == right->transitions.end())
-                {
-                    return false;
-                }
+            left_accept++;
+            right_accept++;
 
-                if (left_transition->range_start < right_transition->range_start)
-                {
-                    return true;
-                }
-                else if (left_transition->range_start > right_transition->range_start)
-                {
-                    return false;
-                }
-                 
-                if (left_transition->range_end < right_transition->range_end)
-                {
-                    return true;
-                }
-                else if (left_transition->range_end > right_transition->range_end)
-                {
-                    return false;
-                }
-                 
-                left_transition++;
-                right_transition++;
+        } 
 
-            } 
+        return true;
 
-            return false;
+    };
 
-        }
+    //
+    //  Find the reachable states, numbered in the order we find them. 
+    //
 
-        bool operator>(const SimilarKey& rhs) const 
-        {
-            return rhs < *this;
-        } 
+    vector<State*> state_list;
+    vector<int64_t> state_index(allocated_states.size(), -1);
 
-        bool operator==(const SimilarKey& rhs)
-        {
+    state_index[dfa_start_state->state_num] = 0;
+    state_list.push_back(dfa_start_state);
 
-            State* left = state;
-            State* right = rhs.state;
+    for (int64_t i = 0; i < state_list.size(); i++)
+    {
 
-            auto left_accept = left->accept_actions.begin();
-            auto right_accept = right->accept_actions.begin();
+        for (auto transition: state_list[i]->transitions)
+        {
 
-            while (left_accept != left->accept_actions.end() ||
-                   right_accept != right->accept_actions.end())
+            if (state_index[transition.target_state->state_num] < 0)
             {
+                state_index[transition.target_state->state_num] = state_list.size();
+                state_list.push_back(transition.target_state);
+            }
 
-                if (left_accept == left->accept_actions.end() ||
-                    right_accept == right->accept_actions.end() ||
-                    left_accept->token != right_accept->token)
-                {
-                    return false;
-                }
-                 
-                left_accept++;
-                right_accept++;
+        }
 
-            } 
+    }
 
-            auto left_transition = left->transitions.begin();
-            auto right_transition = right->transitions.begin();
+    int64_t state_count = state_list.size();
 
-            while (left_transition != left->transitions.end() ||
-                   right_transition != right->transitions.end())
-            {
+    //
+    //  Cut the character space into elementary intervals, so that every 
+    //  transition covers a run of whole intervals.                      
+    //
 
-                if (left_transition == left->transitions.end() ||
-                    right_transition == right->transitions.end() ||
-                    left_transition->range_start != right_transition->range_start ||
-                    left_transition->range_end != right_transition->range_end)
-                {
+    vector<int64_t> boundary_list;
+
+    for (State* state: state_list)
+    {
+
+        for (auto transition: state->transitions)
+        {
+            boundary_list.push_back(transition.range_start);
+            boundary_list.push_back(static_cast<int64_t>(transition.range_end) + 1);
+        }
+
+    }
+
+    sort(boundary_list.begin(), boundary_list.end());
+    boundary_list.erase(unique(boundary_list.begin(), boundary_list.end()),
+                        boundary_list.end());
+
+    //
+    //  Build the inverse transitions. For each state we want the states 
+    //  that move to it and the intervals they move on.                  
+    //
+
+    struct InverseTransition
+    {
+        int32_t interval;
+        int32_t source;
+    };
+
+    vector<vector<InverseTransition>> inverse_list(state_count);
+
+    for (int64_t source = 0; source < state_count; source++)
+    {
+
+        for (auto transition: state_list[source]->transitions)
+        {
+
+            int64_t first = lower_bound(boundary_list.begin(),
+                                        boundary_list.end(),
+                                        static_cast<int64_t>(transition.range_start)) -
+                            boundary_list.begin();
+
+            int64_t last = lower_bound(boundary_list.begin(),
+                                       boundary_list.end(),
+                                       static_cast<int64_t>(transition.range_end) + 1) -
+                           boundary_list.begin();
+
+            for (int64_t interval = first; interval < last; interval++)
+            {
+                inverse_list[state_index[transition.target_state->state_num]].push_back(
+                    InverseTransition{static_cast<int32_t>(interval),
+                                      static_cast<int32_t>(source)});
+            }
+
+        }
+
+    }
+
+    //
+    //  The partition. Each block is a contiguous slice of element_list  
+    //  and the states we mark while splitting are moved to the front of 
+    //  their block.                                                     
+    //
+
+    vector<int64_t> element_list(state_count);
+    vector<int64_t> element_location(state_count);
+    vector<int64_t> block_of(state_count);
+
+    vector<int64_t> block_start;
+    vector<int64_t> block_end;
+    vector<int64_t> block_marked;
+    vector<bool> block_pending;
+    vector<int64_t> workpile;
+
+    //
+    //  The initial partition groups states by what they accept. 
+    //
+
+    {
+
+        map<vector<Symbol*>, vector<int64_t>> group_map;
+        vector<vector<int64_t>> group_list;
+
+        for (int64_t s = 0; s < state_count; s++)
+        {
+
+            vector<Symbol*> token_list;
+            for (auto accept_action: state_list[s]->accept_actions)
+            {
+                token_list.push_back(accept_action.token);
+            }
+
+            vector<int64_t>& candidate_list = group_map[token_list];
+            int64_t group = -1;
+
+            for (int64_t candidate: candidate_list)
+            {
+
+                if (same_accepts(state_list[group_list[candidate][0]], state_list[s]))
+                {
+                    group = candidate;
+                    break;
+                }
+
+            }
+
+            if (group < 0)
+            {
+                group = group_list.size();
+                group_list.push_back(vector<int64_t>());
+                candidate_list.push_back(group);
+            }
+
+            group_list[group].push_back(s);
+
+        }
+
+        int64_t location = 0;
+
+        for (auto& group: group_list)
+        {
+
+            int64_t block = block_start.size();
+
+            block_start.push_back(location);
+            block_marked.push_back(location);
+
+            for (int64_t s: group)
+            {
+                element_list[location] = s;
+                element_location[s] = location;
+                block_of[s] = block;
+                location++;
+            }
+
+            block_end.push_back(location);
+
+            //
+            //  Some states have no transition on some intervals, so we 
+            //  can't leave out any block here the way we could with a  
+            //  complete automaton.                                     
+            //
+
+            block_pending.push_back(true);
+            workpile.push_back(block);
+
+        }
+
+    }
+
+    //
+    //  Refine the partition. We take a block off the workpile, gather the 
+    //  states that move into it on each interval, and split every block  
+    //  by whether its states are in that group.                          
+    //
+
+    vector<vector<int64_t>> source_list(boundary_list.size());
+    vector<int64_t> interval_list;
+    vector<int64_t> touched_list;
+
+    while (workpile.size() > 0)
+    {
+
+        int64_t splitter = workpile.back();
+        workpile.pop_back();
+        block_pending[splitter] = false;
+
+        for (int64_t i = block_start[splitter]; i < block_end[splitter]; i++)
+        {
+
+            for (auto& inverse: inverse_list[element_list[i]])
+            {
+
+                if (source_list[inverse.interval].size() == 0)
+                {
+                    interval_list.push_back(inverse.interval);
+                }
+
+                source_list[inverse.interval].push_back(inverse.source);
+
+            }
+
+        }
+
+        for (int64_t interval: interval_list)
+        {
+
+            //
+            //  Mark the states that move into the splitter on this 
+            //  interval.                                           
+            //
+
+            touched_list.clear();
+
+            for (int64_t s: source_list[interval])
+            {
+
+                int64_t block = block_of[s];
+
+                if (element_location[s] < block_marked[block])
+                {
+                    continue;
+                }
+
+                if (block_marked[block] == block_start[block])
+                {
+                    touched_list.push_back(block);
+                }
+
+                int64_t other = element_list[block_marked[block]];
+                swap(element_list[element_location[s]], element_list[block_marked[block]]);
+                element_location[other] = element_location[s];
+                element_location[s] = block_marked[block];
+                block_marked[block]++;
+
+            }
+
+            source_list[interval].clear();
+
+            //
+            //  Split off the marked states unless that's everything. 
+            //
+
+            for (int64_t block: touched_list)
+            {
+
+                if (block_marked[block] == block_end[block])
+                {
+                    block_marked[block] = block_start[block];
+                    continue;
+                }
+
+                int64_t new_block = block_start.size();
+
+                block_start.push_back(block_start[block]);
+                block_end.push_back(block_marked[block]);
+                block_marked.push_back(block_start[block]);
+                block_pending.push_back(false);
+
+                block_start[block] = block_marked[block];
+
+                for (int64_t i = block_start[new_block]; i < block_end[new_block]; i++)
+                {
+                    block_of[element_list[i]] = new_block;
+                }
+
+                if (block_pending[block] ||
+                    block_end[new_block] - block_start[new_block] <=
+                    block_end[block] - block_start[block])
+                {
+                    block_pending[new_block] = true;
+                    workpile.push_back(new_block);
+                }
+                else
+                {
+                    block_pending[block] = true;
+                    workpile.push_back(block);
+                }
+
+            }
+
+        }
+
+        interval_list.clear();
+
+    }
+
+    //
+    //  Pick the first state we found in each block to stand for it. 
+    //
+
+    vector<State*> representative(block_start.size(), nullptr);
+
+    for (int64_t s = 0; s < state_count; s++)
+    {
+
+        if (representative[block_of[s]] == nullptr)
+        {
+            representative[block_of[s]] = state_list[s];
+        }
+
+    }
+
+    //
+    //  Rebuild the transitions of the representatives to point at other 
+    //  representatives. Adjacent ranges that now go to the same place   
+    //  are merged.                                                      
+    //
+
+    for (int64_t s = 0; s < state_count; s++)
+    {
+
+        State* state = state_list[s];
+
+        if (representative[block_of[s]] != state)
+        {
+            continue;
+        }
+
+        decltype(state->transitions) new_transitions;
+        bool range_open = false;
+        char32_t range_start = 0;
+        char32_t range_end = 0;
+        State* target_state = nullptr;
+
+        for (auto transition: state->transitions)
+        {
+
+            State* next_state =
+                representative[block_of[state_index[transition.target_state->state_num]]];
+
+            if (range_open &&
+                next_state == target_state &&
+                static_cast<int64_t>(transition.range_start) ==
+                    static_cast<int64_t>(range_end) + 1)
+            {
+                range_end = transition.range_end;
+                continue;
+            }
+
+            if (range_open)
+            {
+                new_transitions.insert(Transition(range_start, range_end, target_state));
+            }
+
+            range_open = true;
+            range_start = transition.range_start;
+            range_end = transition.range_end;
+            target_state = next_state;
+
+        }
+
+        if (range_open)
+        {
+            new_transitions.insert(Transition(range_start, range_end, target_state));
+        }
+
+        state->transitions = new_transitions;
+
+    }
+
+    dfa_start_state = representative[block_of[0]];
+    dfa_state_count = block_start.size();
+
+}
+
+//
+//  minimize_dfa_pairwise                                                
+//  ---------------------                                                
+//                                                                       
+//  The original minimizer, kept for the `pairwise' and `compare' values 
+//  of minimize_method. We put states that are obviously similar in the  
+//  same list, then merge pairs of indistinguishable states until a pass 
+//  finds nothing more. That's quadratic in the size of the lists, which 
+//  gets slow when one token has many alternatives, but it's simple      
+//  enough to trust.                                                     
+//
+
+void ScannerGenerator::minimize_dfa_pairwise()
+{
+
+    //
+    //  SimilarKey                                                         
+    //  ----------                                                         
+    //                                                                     
+    //  This is a map key facilitating an efficiency gimmick. On each pass 
+    //  of this procedure we need to determine if each pair of states is   
+    //  distinguishable. We can cut this down by only comparing states     
+    //  that are similar, where two states are definitely similar if they  
+    //  are indistinguishable. Here we define similar as having the same     
+    //  accepted tokens and the same transition domain.                    
+    //
+
+    class SimilarKey
+    {
+
+    public:    
+
+        explicit SimilarKey(State* state) : state(state) {}
+
+        bool operator<(const SimilarKey& rhs) const
+        {
+
+            State* left = state;
+            State* right = rhs.state;
+
+            auto left_accept = left->accept_actions.begin();
+            auto right_accept = right->accept_actions.begin();
+
+            while (left_accept != left->accept_actions.end() ||
+                   right_accept != right->accept_actions.end())
+            {
+
+                if (left_accept == left->accept_actions.end())
+                {
+                    return true;
+                }
+                else if (right_accept == right->accept_actions.end())
+                {
+                    return false;
+                }
+
+                if (left_accept->token < right_accept->token)
+                {
+                    return true;
+                }
+                else if (left_accept->token > right_accept->token)
+                {
                     return false;
                 }
                  
-                left_transition++;
-                right_transition++;
+                left_accept++;
+                right_accept++;
+
+            } 
+
+            auto left_transition = left->transitions.begin();
+            auto right_transition = right->transitions.begin();
+
+            while (left_transition != left->transitions.end() ||
+                   right_transition != right->transitions.end())
+            {
+
+                if (left_transition == left->transitions.end())
+                {
+                    return true;
+                }
+                else if (right_transition == right->transitions.end())
+                {
+                    return false;
+                }
+
+                if (left_transition->range_start < right_transition->range_start)
+                {
+                    return true;
+                }
+                else if (left_transition->range_start > right_transition->range_start)
+                {
+                    return false;
+                }
+                 
+                if (left_transition->range_end < right_transition->range_end)
+                {
+                    return true;
+                }
+                else if (left_transition->range_end > right_transition->range_end)
+                {
+                    return false;
+                }
+                 
+                left_transition++;
+                right_transition++;
+
+            } 
+
+            return false;
+
+        }
+
+        bool operator>(const SimilarKey& rhs) const 
+        {
+            return rhs < *this;
+        } 
+
+        bool operator==(const SimilarKey& rhs)
+        {
+
+            State* left = state;
+            State* right = rhs.state;
+
+            auto left_accept = left->accept_actions.begin();
+            auto right_accept = right->accept_actions.begin();
+
+            while (left_accept != left->accept_actions.end() ||
+                   right_accept != right->accept_actions.end())
+            {
+
+                if (left_accept == left->accept_actions.end() ||
+                    right_accept == right->accept_actions.end() ||
+                    left_accept->token != right_accept->token)
+                {
+                    return false;
+                }
+                 
+                left_accept++;
+                right_accept++;
+
+            } 
+
+            auto left_transition = left->transitions.begin();
+            auto right_transition = right->transitions.begin();
+
+            while (left_transition != left->transitions.end() ||
+                   right_transition != right->transitions.end())
+            {
+
+                if (left_transition == left->transitions.end() ||
+                    right_transition == right->transitions.end() ||
+                    left_transition->range_start != right_transition->range_start ||
+                    left_transition->range_end != right_transition->range_end)
+                {
+                    return false;
+                }
+                 
+                left_transition++;
+                right_transition++;
+
+            } 
+
+            return true;
+
+        }   
+
+    private:
+
+        State* state;
+
+    };
+
+    //
+    //  Common maps used throughout. 
+    //
+
+    vector<set<State*>> bucket_list;
+    map<State*, size_t> bucket_map;
+    map<SimilarKey, vector<State*>> similar_states;
+    set<State*> rebuilt_states;
+
+    //
+    //  initialize_state                                                
+    //  ----------------                                                
+    //                                                                  
+    //  Insert a state and all reachable states into our initial bucket 
+    //  list and similar state map.                                     
+    //
+
+    function<void(State*)> initialize_state = [&](State* start_state) -> void
+    {
+
+        vector<State*> state_stack;
+        state_stack.push_back(start_state);
+
+        while (state_stack.size() > 0)
+        {
+
+            State* state = state_stack.back();
+            state_stack.pop_back();
+
+            if (bucket_map.find(state) != bucket_map.end())
+            {
+                continue;
+            }
+ 
+            set<State*> bucket;
+            bucket.insert(state);
+            bucket_map[state] = bucket_list.size();
+            bucket_list.push_back(bucket); 
+
+            similar_states[SimilarKey(state)].push_back(state);
+
+            for (auto transition: state->transitions)
+            {
+                state_stack.push_back(transition.target_state);
+            }
+
+        }
+    
+    };
+
+    //
+    //  merge_buckets                                  
+    //  -------------                                  
+    //                                                 
+    //  Merge two buckets of indistinguishable states. 
+    //
+
+    function<void(int, int)> merge_buckets = [&](int left, int right) -> void
+    {
+
+        for (auto state: bucket_list[right])
+        {
+            bucket_list[left].insert(state);
+            bucket_map[state] = left;
+        }
+        
+        bucket_list[right].clear();
+
+    };
+
+    //
+    //  identical_asts                       
+    //  --------------                       
+    //                                       
+    //  Test whether two asts are identical. 
+    //
+
+    function<bool(Ast*, Ast*)> identical_asts = [&](Ast* left, Ast* right) -> bool
+    {
+
+        if (left == right)
+        {
+            return true;
+        }
+
+        if (left == nullptr || right == nullptr)
+        {
+            return false;
+        }
+
+        if (left->get_kind() != right->get_kind() ||
+            left->get_lexeme() != right->get_lexeme() ||
+            left->get_num_children() != right->get_num_children())
+        {
+            return false;
+        }
+        
+        for (int i = 0; i < left->get_num_children(); i++)
+        {
+
+            if (!identical_asts(left->get_child(i), right->get_child(i)))
+            {
+                return false;
+            }
+
+        }
+
+        return true;
+
+    };
+
+    //
+    //  indistinguishable                              
+    //  -----------------                              
+    //                                                 
+    //  Test whether two states are indistinguishable. 
+    //
+
+    function<bool(State*, State*)> indistinguishable = [&](State* left, State* right) -> bool
+    {
+
+        auto left_accept = left->accept_actions.begin();
+        auto right_accept = right->accept_actions.begin();
+
+        while (left_accept != left->accept_actions.end() ||
+               right_accept != right->accept_actions.end())
+        {
+
+            if (left_accept == left->accept_actions.end() ||
+                right_accept == right->accept_actions.end() ||
+                left_accept->token != right_accept->token ||
+                !identical_asts(left_accept->guard_ast, right_accept->guard_ast))
+            {
+                return false;
+            }
+
+            left_accept++;
+            right_accept++;
+
+        } 
+
+        auto left_transition = left->transitions.begin();
+        auto right_transition = right->transitions.begin();
+
+        while (left_transition != left->transitions.end() ||
+               right_transition != right->transitions.end())
+        {
+
+            if (left_transition == left->transitions.end() ||
+                right_transition == right->transitions.end() ||
+                left_transition->range_start != right_transition->range_start ||
+                left_transition->range_end != right_transition->range_end ||
+                bucket_map[left_transition->target_state] != bucket_map[right_transition->target_state])
+            {
+                return false;
+            }
+
+            left_transition++;
+            right_transition++;
+
+        } 
+
+        return true;
+
+    };
+    
+    //
+    //  rebuild_state                                                      
+    //  -------------                                                      
+    //                                                                     
+    //  Rebuild the transitions of a state and reachable states, replacing 
+    //  all target states with those of the minimized automaton.           
+    //
+
+    function<void(State*)> rebuild_state = [&](State* start_state) -> void
+    {
+
+        vector<State*> state_stack;
+        state_stack.push_back(start_state);
+
+        while (state_stack.size() > 0)
+        {
+
+            State* state = state_stack.back();
+            state_stack.pop_back();
+
+            if (rebuilt_states.find(state) != rebuilt_states.end())
+            {
+                continue;
+            }
+
+            rebuilt_states.insert(state);
+
+            decltype(state->transitions) new_transitions;
+            for (auto transition: state->transitions)
+            {
+                new_transitions.insert(Transition(transition.range_start,
+                                                  transition.range_end,
+                                                  *(bucket_list[bucket_map[transition.target_state]].begin())));
+            }
+
+            state->transitions = new_transitions;
+
+            for (auto transition: state->transitions)
+            {
+                state_stack.push_back(transition.target_state);
+            }
+
+        }
+    
+    };
+
+    //
+    //  minimize_dfa_pairwise
+    //  ---------------------
+    //                                 
+    //  The function body begins here. 
+    //
+
+    //
+    //  Setup our similar states map and initialize the buckets of 
+    //  indistinguishable states.                                  
+    //
+
+    initialize_state(dfa_start_state);
+
+    //
+    //  Use a fixpoint algorithm to merge indistinguishable states until 
+    //  we can't find any more to merge.                                 
+    //
+
+    bool any_changes = true;
+    while (any_changes)
+    {
+
+        any_changes = false;
+        for (auto sp: similar_states)
+        {
+
+            vector<State*> state_list = sp.second;
+            for (int i = 0; i < state_list.size(); i++)
+            {
+
+                for (int j = i + 1; j < state_list.size(); j++)
+                {
+
+                    if (bucket_map[state_list[i]] != bucket_map[state_list[j]] &&
+                        indistinguishable(*(bucket_list[bucket_map[state_list[i]]].begin()),
+                                          *(bucket_list[bucket_map[state_list[j]]].begin())))
+                    {
+                        merge_buckets(bucket_map[state_list[i]], bucket_map[state_list[j]]);
+                        any_changes = true;
+                    }
+
+                }
+
+            }
+
+        }
+
+    }                          
+
+    //
+    //  All the states are arranged in buckets. Rebuild the transitions to 
+    //  use the new states.                                                
+    //
+
+    dfa_start_state = *(bucket_list[bucket_map[dfa_start_state]].begin());
+    rebuild_state(dfa_start_state);
+    dfa_state_count = rebuilt_states.size();
+
+}
+
+//
+//  copy_dfa                                                             
+//  --------                                                             
+//                                                                       
+//  Make a copy of the states reachable from a start state. The new      
+//  states are allocated like any other, so they're deleted with the     
+//  rest.                                                                
+//
+
+ScannerGenerator::State* ScannerGenerator::copy_dfa(State* start_state)
+{
+
+    map<State*, State*> copy_map;
+    vector<State*> state_list;
+
+    copy_map[start_state] = get_new_state();
+    state_list.push_back(start_state);
+
+    for (int64_t i = 0; i < state_list.size(); i++)
+    {
+
+        for (auto transition: state_list[i]->transitions)
+        {
+
+            if (copy_map.find(transition.target_state) == copy_map.end())
+            {
+                copy_map[transition.target_state] = get_new_state();
+                state_list.push_back(transition.target_state);
+            }
+
+        }
+
+    }
+
+    for (State* state: state_list)
+    {
+
+        State* copy = copy_map[state];
+        copy->accept_actions = state->accept_actions;
+
+        for (auto transition: state->transitions)
+        {
+            copy->transitions.insert(Transition(transition.range_start,
+                                                transition.range_end,
+                                                copy_map[transition.target_state]));
+        }
+
+    }
+
+    return copy_map[start_state];
+
+}
+
+//
+//  compare_minimize_methods                                             
+//  ------------------------                                             
+//                                                                       
+//  Minimize a copy of the DFA with the pairwise method and the DFA      
+//  itself with Hopcroft's, and complain if the results differ. This is  
+//  a check on the generator, not the grammar. Minimal automata are      
+//  unique, so we walk the two together from their start states and      
+//  insist that they pair off one to one, with the same accepts and the  
+//  same targets on every character.                                     
+//
+
+void ScannerGenerator::compare_minimize_methods()
+{
+
+    //
+    //  identical_asts                       
+    //  --------------                       
+    //                                       
+    //  Test whether two asts are identical. 
+    //
+
+    function<bool(Ast*, Ast*)> identical_asts = [&](Ast* left, Ast* right) -> bool
+    {
+
+        if (left == right)
+        {
+            return true;
+        }
+
+        if (left == nullptr || right == nullptr)
+        {
+            return false;
+        }
+
+        if (left->get_kind() != right->get_kind() ||
+            left->get_lexeme() != right->get_lexeme() ||
+            left->get_num_children() != right->get_num_children())
+        {
+            return false;
+        }
+        
+        for (int i = 0; i < left->get_num_children(); i++)
+        {
+
+            if (!identical_asts(left->get_child(i), right->get_child(i)))
+            {
+                return false;
+            }
+
+        }
+
+        return true;
+
+    };
+
+    //
+    //  same_accepts                                          
+    //  ------------                                          
+    //                                                        
+    //  Test whether two states accept the same tokens under  
+    //  the same guards.                                      
+    //
+
+    function<bool(State*, State*)> same_accepts = [&](State* left, State* right) -> bool
+    {
+
+        auto left_accept = left->accept_actions.begin();
+        auto right_accept = right->accept_actions.begin();
+
+        while (left_accept != left->accept_actions.end() ||
+               right_accept != right->accept_actions.end())
+        {
+
+            if (left_accept == left->accept_actions.end() ||
+                right_accept == right->accept_actions.end() ||
+                left_accept->token != right_accept->token ||
+                !identical_asts(left_accept->guard_ast, right_accept->guard_ast))
+            {
+                return false;
+            }
+
+            left_accept++;
+            right_accept++;
+
+        } 
+
+        return true;
+
+    };
+
+    //
+    //  compare_minimize_methods
+    //  ------------------------
+    //                                 
+    //  The function body begins here. 
+    //
+
+    State* original_start = dfa_start_state;
+
+    dfa_start_state = copy_dfa(original_start);
+    minimize_dfa_pairwise();
+    State* pairwise_start = dfa_start_state;
+    int64_t pairwise_count = dfa_state_count;
+
+    dfa_start_state = original_start;
+    minimize_dfa();
+    State* hopcroft_start = dfa_start_state;
+    int64_t hopcroft_count = dfa_state_count;
+
+    int errors = 0;
+    ostringstream error_ost;
+
+    if (pairwise_count != hopcroft_count)
+    {
+        error_ost << "  Pairwise states: " << pairwise_count
+                  << ", Hopcroft states: " << hopcroft_count << endl;
+        errors++;
+    }
+
+    //
+    //  Pair off the states. Each pair is numbered by the order we find 
+    //  it, which is all we have to name states by in a message.        
+    //
+
+    map<State*, State*> hopcroft_map;
+    map<State*, State*> pairwise_map;
+    vector<pair<State*, State*>> pair_list;
+
+    hopcroft_map[hopcroft_start] = pairwise_start;
+    pairwise_map[pairwise_start] = hopcroft_start;
+    pair_list.push_back(make_pair(hopcroft_start, pairwise_start));
+
+    for (int64_t i = 0; i < pair_list.size() && errors < 10; i++)
+    {
+
+        State* hopcroft_state = pair_list[i].first;
+        State* pairwise_state = pair_list[i].second;
+
+        if (!same_accepts(hopcroft_state, pairwise_state))
+        {
+            error_ost << "  State pair " << i << ": accepts differ" << endl;
+            errors++;
+        }
+
+        //
+        //  Walk the elementary intervals of both transition lists. 
+        //
+
+        vector<int64_t> boundary_list;
+
+        for (State* state: { hopcroft_state, pairwise_state })
+        {
+
+            for (auto transition: state->transitions)
+            {
+                boundary_list.push_back(transition.range_start);
+                boundary_list.push_back(static_cast<int64_t>(transition.range_end) + 1);
+            }
+
+        }
+
+        sort(boundary_list.begin(), boundary_list.end());
+        boundary_list.erase(unique(boundary_list.begin(), boundary_list.end()),
+                            boundary_list.end());
+
+        auto hopcroft_transition = hopcroft_state->transitions.begin();
+        auto pairwise_transition = pairwise_state->transitions.begin();
+
+        for (int64_t j = 0; j + 1 < boundary_list.size(); j++)
+        {
+
+            int64_t character = boundary_list[j];
+
+            while (hopcroft_transition != hopcroft_state->transitions.end() &&
+                   static_cast<int64_t>(hopcroft_transition->range_end) < character)
+            {
+                hopcroft_transition++;
+            }
+
+            while (pairwise_transition != pairwise_state->transitions.end() &&
+                   static_cast<int64_t>(pairwise_transition->range_end) < character)
+            {
+                pairwise_transition++;
+            }
+
+            State* hopcroft_target = nullptr;
+            if (hopcroft_transition != hopcroft_state->transitions.end() &&
+                static_cast<int64_t>(hopcroft_transition->range_start) <= character)
+            {
+                hopcroft_target = hopcroft_transition->target_state;
+            }
+
+            State* pairwise_target = nullptr;
+            if (pairwise_transition != pairwise_state->transitions.end() &&
+                static_cast<int64_t>(pairwise_transition->range_start) <= character)
+            {
+                pairwise_target = pairwise_transition->target_state;
+            }
+
+            if (hopcroft_target == nullptr && pairwise_target == nullptr)
+            {
+                continue;
+            }
+
+            if (hopcroft_target == nullptr || pairwise_target == nullptr)
+            {
+                error_ost << "  State pair " << i << ": only one moves on "
+                          << hex << character << dec << endl;
+                errors++;
+                break;
+            }
+
+            auto hopcroft_iter = hopcroft_map.find(hopcroft_target);
+            auto pairwise_iter = pairwise_map.find(pairwise_target);
+
+            if (hopcroft_iter == hopcroft_map.end() && pairwise_iter == pairwise_map.end())
+            {
+                hopcroft_map[hopcroft_target] = pairwise_target;
+                pairwise_map[pairwise_target] = hopcroft_target;
+                pair_list.push_back(make_pair(hopcroft_target, pairwise_target));
+            }
+            else if (hopcroft_iter == hopcroft_map.end() ||
+                     pairwise_iter == pairwise_map.end() ||
+                     hopcroft_iter->second != pairwise_target)
+            {
+                error_ost << "  State pair " << i << ": targets don't pair off on "
+                          << hex << character << dec << endl;
+                errors++;
+                break;
+            }
+
+        }
+
+    }
+
+    if (errors > 0)
+    {
+        errh.add_error(ErrorType::ErrorError,
+                       -1,
+                       "Minimize methods disagree\n\n" + error_ost.str());
+    }
+
+}
+
+//
+//  build_char_classes                                                   
+//  ------------------                                                   
+//                                                                       
+//  Partition the characters into equivalence classes, where two         
+//  characters are in the same class if every state of the minimized    
+//  DFA sends them to the same place. The scanner then looks up a class  
+//  once per character and each state only needs one branch target per   
+//  class instead of a sorted list of ranges. For the lazy scanner we do  
+//  the same with the NFA, which splits the classes at least as finely   
+//  as any DFA built from it.                                            
+//                                                                       
+//  We start from the elementary intervals between range boundaries,     
+//  all in one class, and refine by each state in turn: intervals that   
+//  shared a class and go to the same target keep sharing one. Finally   
+//  we build the two-level lookup table the parser engine uses.          
+//
+
+void ScannerGenerator::build_char_classes()
+{
+
+    static const int64_t page_size = 256;
+    static const int64_t char_limit = int64_t(1) << 32;
+    static const int64_t unicode_limit = 0x110000;
+
+    //
+    //  Find the reachable states. 
+    //
+
+    vector<State*> state_list;
+    set<State*> state_seen;
+
+    State* start_state = gram.lazy_scanner ? nfa_start_state : dfa_start_state;
+    state_list.push_back(start_state);
+    state_seen.insert(start_state);
+
+    for (int64_t i = 0; i < state_list.size(); i++)
+    {
+
+        for (auto transition: state_list[i]->transitions)
+        {
+
+            if (state_seen.find(transition.target_state) == state_seen.end())
+            {
+                state_seen.insert(transition.target_state);
+                state_list.push_back(transition.target_state);
+            }
+
+        }
+
+        for (auto next_state: state_list[i]->e_moves)
+        {
+
+            if (state_seen.find(next_state) == state_seen.end())
+            {
+                state_seen.insert(next_state);
+                state_list.push_back(next_state);
+            }
+
+        }
+
+    }
+
+    //
+    //  Cut the character space into elementary intervals. 
+    //
+
+    interval_start.clear();
+    interval_start.push_back(0);
+
+    for (State* state: state_list)
+    {
+
+        for (auto transition: state->transitions)
+        {
+
+            interval_start.push_back(transition.range_start);
+            if (static_cast<int64_t>(transition.range_end) + 1 < char_limit)
+            {
+                interval_start.push_back(static_cast<int64_t>(transition.range_end) + 1);
+            }
+
+        }
+
+    }
+
+    sort(interval_start.begin(), interval_start.end());
+    interval_start.erase(unique(interval_start.begin(), interval_start.end()),
+                         interval_start.end());
+
+    //
+    //  Refine the classes one state at a time. Intervals a state doesn't 
+    //  cover keep their class, the others get a fresh class for each     
+    //  combination of old class and target.                              
+    //
 
-            } 
+    interval_class.assign(interval_start.size(), 0);
+    int64_t next_class = 1;
 
-            return true;
+    for (State* state: state_list)
+    {
 
-        }   
+        map<pair<int64_t, State*>, int64_t> refined_class;
 
-    private:
+        for (auto transition: state->transitions)
+        {
 
-        State* state;
+            for (int64_t i = find_interval(transition.range_start);
+                 i < interval_start.size() && interval_start[i] <= transition.range_end;
+                 i++)
+            {
 
-    };
+                auto key = make_pair(interval_class[i], transition.target_state);
+                auto it = refined_class.find(key);
 
-    //
-    //  Common maps used throughout. 
-    //
+                if (it == refined_class.end())
+                {
+                    it = refined_class.insert(make_pair(key, next_class++)).first;
+                }
 
-    vector<set<State*>> bucket_list;
-    map<State*, size_t> bucket_map;
-    map<SimilarKey, vector<State*>> similar_states;
-    set<State*> rebuilt_states;
+                interval_class[i] = it->second;
+
+            }
+
+        }
+
+    }
 
     //
-    //  initialize_state                                                
-    //  ----------------                                                
-    //                                                                  
-    //  Insert a state and all reachable states into our initial bucket 
-    //  list and similar state map.                                     
+    //  Renumber the classes densely in character order. 
     //
 
-    function<void(State*)> initialize_state = [&](State* state) -> void
+    map<int64_t, int64_t> class_num_map;
+
+    for (int64_t i = 0; i < interval_class.size(); i++)
     {
 
-        if (bucket_map.find(state) != bucket_map.end())
+        auto it = class_num_map.find(interval_class[i]);
+        if (it == class_num_map.end())
         {
-            return;
+            int64_t class_num = class_num_map.size();
+            it = class_num_map.insert(make_pair(interval_class[i], class_num)).first;
         }
- 
-        set<State*> bucket;
-        bucket.insert(state);
-        bucket_map[state] = bucket_list.size();
-        bucket_list.push_back(bucket); 
 
-        SimilarKey key(state);
+        interval_class[i] = it->second;
+
+    }
+
+    char_class_count = class_num_map.size();
+
+    //
+    //  Build the two-level table. It only has to reach the start of the 
+    //  last interval, but we stop at the end of Unicode and list any     
+    //  intervals past the table separately. Pages that come out the     
+    //  same are shared.                                                 
+    //
+
+    int64_t page_count = (min(interval_start.back(), unicode_limit) + page_size - 1) / page_size;
+
+    char_page_index.assign(page_count, 0);
+    char_page_data.clear();
+
+    map<vector<int32_t>, int32_t> page_offset_map;
+    vector<int32_t> page(page_size);
+
+    for (int64_t page_num = 0; page_num < page_count; page_num++)
+    {
+
+        //
+        //  Most pages lie inside one interval, so check that before we  
+        //  fill in the page a character at a time.                      
+        //
+
+        int64_t interval = find_interval(page_num * page_size);
 
-        if (similar_states.find(key) == similar_states.end())
+        if (interval + 1 == interval_start.size() ||
+            interval_start[interval + 1] >= (page_num + 1) * page_size)
         {
-            similar_states[key] = vector<State*>();
+            fill(page.begin(), page.end(), interval_class[interval]);
         }
+        else
+        {
 
-        similar_states[key].push_back(state);
+            for (int64_t i = 0; i < page_size; i++)
+            {
 
-        for (auto transition: state->transitions)
+                int64_t c = page_num * page_size + i;
+                while (interval + 1 < interval_start.size() && interval_start[interval + 1] <= c)
+                {
+                    interval++;
+                }
+
+                page[i] = interval_class[interval];
+
+            }
+
+        }
+
+        auto it = page_offset_map.find(page);
+        if (it == page_offset_map.end())
         {
-            initialize_state(transition.target_state);
+            it = page_offset_map.insert(make_pair(page, char_page_data.size())).first;
+            char_page_data.insert(char_page_data.end(), page.begin(), page.end());
         }
-    
-    };
 
-    //
-    //  merge_buckets                                  
-    //  -------------                                  
-    //                                                 
-    //  Merge two buckets of indistinguishable states. 
-    //
+        char_page_index[page_num] = it->second;
 
-    function<void(int, int)> merge_buckets = [&](int left, int right) -> void
+    }
+
+    char_high_start.clear();
+    char_high_class.clear();
+
+    char_high_start.push_back(page_count * page_size);
+    char_high_class.push_back(interval_class[find_interval(page_count * page_size)]);
+
+    for (int64_t i = find_interval(page_count * page_size) + 1; i < interval_start.size(); i++)
     {
+        char_high_start.push_back(interval_start[i]);
+        char_high_class.push_back(interval_class[i]);
+    }
 
-        for (auto state: bucket_list[right])
-        {
-            bucket_list[left].insert(state);
-            bucket_map[state] = left;
-        }
-        
-        bucket_list[right].clear();
+}
 
-    };
+//
+//  find_interval                                                 
+//  -------------                                                 
+//                                                                
+//  Find the elementary interval containing a character. 
+//
+
+int64_t ScannerGenerator::find_interval(char32_t c) const
+{
+    return upper_bound(interval_start.begin(), interval_start.end(), static_cast<int64_t>(c)) -
+           interval_start.begin() - 1;
+}
+
+//
+//  find_keywords                                                         
+//  -------------                                                         
+//                                                                        
+//  With the keyword_table option, find the literals we can take out of   
+//  the DFA. They must be plain literals with no action that beat the     
+//  identifier on precedence. Whether the identifier actually matches     
+//  them we check on the DFA itself, in check_keywords. Only ASCII        
+//  literals qualify.                                                     
+//
+
+void ScannerGenerator::find_keywords()
+{
+
+    keyword_host = nullptr;
+    keyword_set.clear();
+
+    if (!gram.keyword_table || gram.lazy_scanner)
+    {
+        return;
+    }
+
+    keyword_host = gram.get_symbol("<identifier>");
+    if (keyword_host == nullptr ||
+        !keyword_host->is_scanned ||
+        !keyword_host->is_terminal ||
+        keyword_host->is_ignored ||
+        keyword_host->is_error ||
+        (keyword_host->action_ast != nullptr &&
+         keyword_host->action_ast->get_kind() != AstType::AstNull))
+    {
+        keyword_host = nullptr;
+        return;
+    }
 
     //
-    //  identical_asts                       
-    //  --------------                       
-    //                                       
-    //  Test whether two asts are identical. 
+    //  Without case sensitivity two literals can differ only in case.  
+    //  Leave those to the DFA, which decides between them as before.   
     //
 
-    function<bool(Ast*, Ast*)> identical_asts = [&](Ast* left, Ast* right) -> bool
+    map<string, vector<Symbol*>> folded_map;
+
+    for (auto mp: gram.symbol_map)
     {
 
-        if (left == right)
+        Symbol* token = mp.second;
+
+        if (token == keyword_host ||
+            !token->is_scanned ||
+            !token->is_terminal ||
+            token->is_ignored ||
+            token->is_error ||
+            !token->is_ast_synthesized ||
+            token->string_value.length() == 0 ||
+            token->precedence <= keyword_host->precedence ||
+            (token->action_ast != nullptr &&
+             token->action_ast->get_kind() != AstType::AstNull))
         {
-            return true;
+            continue;
         }
 
-        if (left == nullptr || right == nullptr)
+        //
+        //  The engine compares and hashes the lexeme a code point at a  
+        //  time and the table holds the literal's bytes, which only     
+        //  agree for ASCII. Leave other literals to the DFA.            
+        //
+
+        bool is_ascii = true;
+        for (char c: token->string_value)
         {
-            return false;
+            is_ascii = is_ascii && (static_cast<unsigned char>(c) < 0x80);
         }
 
-        if (left->get_kind() != right->get_kind() ||
-            left->get_lexeme() != right->get_lexeme() ||
-            left->get_num_children() != right->get_num_children())
+        if (!is_ascii)
         {
-            return false;
+            continue;
         }
-        
-        for (int i = 0; i < left->get_num_children(); i++)
+
+        string folded = token->string_value;
+        for (char& c: folded)
         {
+            c = ParserEngine::fold_keyword_char(c, gram.case_sensitive);
+        }
 
-            if (!identical_asts(left->get_child(i), right->get_child(i)))
+        folded_map[folded].push_back(token);
+
+    }
+
+    for (auto& mp: folded_map)
+    {
+
+        if (mp.second.size() == 1)
+        {
+            keyword_set.insert(mp.second[0]);
+        }
+
+    }
+
+    //
+    //  Most literals won't look like identifiers at all. Weed them out  
+    //  on a small DFA for the identifier alone, so we rarely have to     
+    //  build the full one twice.                                        
+    //
+
+    if (keyword_set.size() > 0)
+    {
+        construct_nfa(keyword_host);
+        nfa_to_dfa();
+        check_keywords();
+        delete_states();
+    }
+
+    if (keyword_set.size() == 0)
+    {
+        keyword_host = nullptr;
+    }
+
+}
+
+//
+//  check_keywords                                                        
+//  --------------                                                        
+//                                                                        
+//  Run each keyword through the DFA built without the keywords. The      
+//  identifier must be the token accepted at the end, or the keyword      
+//  would have lost to something else and can't use the table. Without   
+//  case sensitivity we try the literal as written, in lower case and in  
+//  upper case. We return true if any keyword had to be put back.         
+//
+
+bool ScannerGenerator::check_keywords()
+{
+
+    //
+    //  accepts_host                                                 
+    //  ------------                                                 
+    //                                                               
+    //  Check whether the identifier wins on one particular string.  
+    //
+
+    function<bool(const string&)> accepts_host = [&](const string& lexeme) -> bool
+    {
+
+        State* state = dfa_start_state;
+
+        for (char c: lexeme)
+        {
+
+            char32_t character = c;
+            State* next_state = nullptr;
+
+            for (auto& transition: state->transitions)
+            {
+
+                if (transition.range_start <= character && character <= transition.range_end)
+                {
+                    next_state = transition.target_state;
+                    break;
+                }
+
+            }
+
+            if (next_state == nullptr)
             {
                 return false;
             }
 
+            state = next_state;
+
         }
 
-        return true;
+        if (state->accept_actions.size() == 0)
+        {
+            return false;
+        }
+
+        const AcceptAction& accept_action = *state->accept_actions.begin();
+
+        return accept_action.token == keyword_host &&
+               (accept_action.guard_ast == nullptr ||
+                accept_action.guard_ast->get_kind() == AstType::AstNull);
 
     };
 
     //
-    //  indistinguishable                              
-    //  -----------------                              
-    //                                                 
-    //  Test whether two states are indistinguishable. 
+    //  check_keywords
+    //  --------------
+    //                                 
+    //  The function body begins here. 
     //
 
-    function<bool(State*, State*)> indistinguishable = [&](State* left, State* right) -> bool
+    bool changed = false;
+
+    for (auto it = keyword_set.begin(); it != keyword_set.end(); )
     {
 
-        auto left_accept = left->accept_actions.begin();
-        auto right_accept = right->accept_actions.begin();
+        string lexeme = (*it)->string_value;
+        bool found = accepts_host(lexeme);
 
-        while (left_accept != left->accept_actions.end() ||
-               right_accept != right->accept_actions.end())
+        if (found && !gram.case_sensitive)
         {
 
-            if (left_accept == left->accept_actions.end() ||
-                right_accept == right->accept_actions.end() ||
-                left_accept->token != right_accept->token ||
-                !identical_asts(left_accept->guard_ast, right_accept->guard_ast))
+            for (char& c: lexeme)
             {
-                return false;
+                c = tolower(c);
             }
 
-            left_accept++;
-            right_accept++;
+            found = accepts_host(lexeme);
 
-        } 
+            for (char& c: lexeme)
+            {
+                c = toupper(c);
+            }
 
-        auto left_transition = left->transitions.begin();
-        auto right_transition = right->transitions.begin();
+            found = found && accepts_host(lexeme);
 
-        while (left_transition != left->transitions.end() ||
-               right_transition != right->transitions.end())
+        }
+
+        if (found)
         {
+            it++;
+            continue;
+        }
 
-            if (left_transition == left->transitions.end() ||
-                right_transition == right->transitions.end() ||
-                left_transition->range_start != right_transition->range_start ||
-                left_transition->range_end != right_transition->range_end ||
-                bucket_map[left_transition->target_state] != bucket_map[right_transition->target_state])
-            {
-                return false;
-            }
+        it = keyword_set.erase(it);
+        changed = true;
 
-            left_transition++;
-            right_transition++;
+    }
 
-        } 
+    if (keyword_set.size() == 0)
+    {
+        keyword_host = nullptr;
+    }
 
-        return true;
+    return changed;
+
+}
+
+//
+//  encode_keyword_table                                                  
+//  --------------------                                                  
+//                                                                        
+//  Emit the ScanKeyword instruction holding a perfect hash table of the  
+//  keywords. We use hash and displace: the lexeme hash picks a bucket,   
+//  and each bucket gets a seed that sends all its keywords to free       
+//  slots. Buckets are placed largest first with the table at most half   
+//  full, so seeds are found after a few tries.                           
+//
+
+void ScannerGenerator::encode_keyword_table()
+{
+
+    int64_t keyword_count = keyword_set.size();
+
+    int64_t bucket_count = 1;
+    while (bucket_count * 4 < keyword_count)
+    {
+        bucket_count *= 2;
+    }
+
+    int64_t slot_count = 1;
+    while (slot_count < keyword_count * 2)
+    {
+        slot_count *= 2;
+    }
 
-    };
-    
     //
-    //  rebuild_state                                                      
-    //  -------------                                                      
-    //                                                                     
-    //  Rebuild the transitions of a state and reachable states, replacing 
-    //  all target states with those of the minimized automaton.           
+    //  Hash each keyword the same way the engine will hash the lexeme. 
+    //
+
+    vector<pair<uint64_t, Symbol*>> keyword_list;
+
+    for (Symbol* token: keyword_set)
+    {
+
+        uint64_t hash = ParserEngine::keyword_hash_basis;
+        for (char c: token->string_value)
+        {
+            hash = ParserEngine::hash_keyword_char(
+                       hash, ParserEngine::fold_keyword_char(c, gram.case_sensitive));
+        }
+
+        keyword_list.push_back(make_pair(hash, token));
+
+    }
+
+    //
+    //  Find a seed for each bucket, doubling the table if some bucket   
+    //  can't be placed. That should only happen with a hash collision,  
+    //  which we don't expect among a few hundred keywords.              
     //
 
-    function<void(State*)> rebuild_state = [&](State* state) -> void
+    vector<int64_t> bucket_seed;
+    vector<Symbol*> slot_symbol;
+
+    for (;;)
     {
 
-        if (rebuilt_states.find(state) != rebuilt_states.end())
+        vector<vector<uint64_t>> bucket_list(bucket_count);
+        map<uint64_t, Symbol*> hash_symbol_map;
+
+        for (auto& keyword: keyword_list)
         {
-            return;
+            bucket_list[(keyword.first >> 32) & (bucket_count - 1)].push_back(keyword.first);
+            hash_symbol_map[keyword.first] = keyword.second;
         }
 
-        rebuilt_states.insert(state);
-
-        decltype(state->transitions) new_transitions;
-        for (auto transition: state->transitions)
+        vector<int64_t> bucket_order;
+        for (int64_t i = 0; i < bucket_count; i++)
         {
-            new_transitions.insert(Transition(transition.range_start,
-                                              transition.range_end,
-                                              *(bucket_list[bucket_map[transition.target_state]].begin())));
+            bucket_order.push_back(i);
         }
 
-        state->transitions = new_transitions;
+        stable_sort(bucket_order.begin(), bucket_order.end(),
+                    [&](int64_t lhs, int64_t rhs) -> bool
+                    { return bucket_list[lhs].size() > bucket_list[rhs].size(); });
 
-        for (auto transition: state->transitions)
+        bucket_seed.assign(bucket_count, 0);
+        slot_symbol.assign(slot_count, nullptr);
+        bool placed = hash_symbol_map.size() == keyword_list.size();
+
+        for (int64_t bucket: bucket_order)
         {
-            rebuild_state(transition.target_state);
-        }
-    
-    };
 
-    //
-    //  minimize_dfa
-    //  ------------
-    //                                 
-    //  The function body begins here. 
-    //
+            if (!placed || bucket_list[bucket].size() == 0)
+            {
+                break;
+            }
 
-    //
-    //  Setup our similar states map and initialize the buckets of 
-    //  indistinguishable states.                                  
-    //
+            placed = false;
 
-    initialize_state(dfa_start_state);
+            for (int64_t seed = 0; seed < 4096 && !placed; seed++)
+            {
 
-    //
-    //  Use a fixpoint algorithm to merge indistinguishable states until 
-    //  we can't find any more to merge.                                 
-    //
+                vector<int64_t> slot_list;
+                placed = true;
 
-    bool any_changes = true;
-    while (any_changes)
-    {
+                for (uint64_t hash: bucket_list[bucket])
+                {
 
-        any_changes = false;
-        for (auto sp: similar_states)
-        {
+                    int64_t slot = ParserEngine::hash_keyword_slot(hash, seed) & (slot_count - 1);
 
-            vector<State*> state_list = sp.second;
-            for (int i = 0; i < state_list.size(); i++)
-            {
+                    if (slot_symbol[slot] != nullptr ||
+                        find(slot_list.begin(), slot_list.end(), slot) != slot_list.end())
+                    {
+                        placed = false;
+                        break;
+                    }
 
-                for (int j = i + 1; j < state_list.size(); j++)
+                    slot_list.push_back(slot);
+
+                }
+
+                if (placed)
                 {
 
-                    if (bucket_map[state_list[i]] != bucket_map[state_list[j]] &&
-                        indistinguishable(*(bucket_list[bucket_map[state_list[i]]].begin()),
-                                          *(bucket_list[bucket_map[state_list[j]]].begin())))
+                    bucket_seed[bucket] = seed;
+                    for (int64_t i = 0; i < slot_list.size(); i++)
                     {
-                        merge_buckets(bucket_map[state_list[i]], bucket_map[state_list[j]]);
-                        any_changes = true;
+                        slot_symbol[slot_list[i]] = hash_symbol_map[bucket_list[bucket][i]];
                     }
 
                 }
@@ -2266,14 +3829,53 @@ void ScannerGenerator::minimize_dfa()
 
         }
 
-    }                          
+        if (placed)
+        {
+            break;
+        }
+
+        if (slot_count > keyword_count * 64)
+        {
+            cout << "Unable to build keyword hash table!" << endl;
+            exit(1);
+        }
+
+        slot_count *= 2;
+
+    }
 
     //
-    //  All the states are arranged in buckets. Rebuild the transitions to 
-    //  use the new states.                                                
+    //  Emit the instruction. 
     //
 
-    rebuild_state(dfa_start_state);
+    vector<ICodeOperand> operands;
+    operands.push_back(ICodeOperand(static_cast<int64_t>(gram.case_sensitive ? 1 : 0)));
+    operands.push_back(ICodeOperand(bucket_count));
+
+    for (int64_t seed: bucket_seed)
+    {
+        operands.push_back(ICodeOperand(seed));
+    }
+
+    operands.push_back(ICodeOperand(slot_count));
+
+    for (Symbol* token: slot_symbol)
+    {
+
+        if (token == nullptr)
+        {
+            operands.push_back(ICodeOperand(static_cast<int64_t>(-1)));
+            operands.push_back(ICodeOperand(code.get_string("")));
+        }
+        else
+        {
+            operands.push_back(ICodeOperand(static_cast<int64_t>(token->symbol_num)));
+            operands.push_back(ICodeOperand(code.get_string(token->string_value)));
+        }
+
+    }
+
+    code.emit(OpcodeType::OpcodeScanKeyword, keyword_host->location, operands);
 
 }
 
@@ -2290,6 +3892,93 @@ void ScannerGenerator::create_vmcode()
     map<State*, ICodeLabel*> state_label_map;
     set<State*> state_coded_set;
     map<Symbol*, ICodeLabel*> symbol_action_map;
+    set<State*> memo_state_set;
+
+    //
+    //  find_memo_states                                                   
+    //  ----------------                                                   
+    //                                                                     
+    //  In linear scan mode the engine remembers the states and locations  
+    //  that led to no accept. That only holds if the answer can't change, 
+    //  so we leave out any state from which a guarded accept is reachable 
+    //  and memoize the rest.                                              
+    //
+
+    function<void()> find_memo_states = [&]() -> void
+    {
+
+        map<State*, vector<State*>> predecessor_map;
+        vector<State*> workpile;
+        set<State*> guarded_set;
+
+        set<State*> reachable_set{dfa_start_state};
+        workpile.push_back(dfa_start_state);
+
+        while (workpile.size() > 0)
+        {
+
+            State* state = workpile.back();
+            workpile.pop_back();
+
+            for (auto transition: state->transitions)
+            {
+
+                predecessor_map[transition.target_state].push_back(state);
+                if (reachable_set.insert(transition.target_state).second)
+                {
+                    workpile.push_back(transition.target_state);
+                }
+
+            }
+
+        }
+
+        for (State* state: reachable_set)
+        {
+
+            for (auto accept_action: state->accept_actions)
+            {
+
+                if (accept_action.guard_ast != nullptr &&
+                    accept_action.guard_ast->get_kind() != AstType::AstNull &&
+                    guarded_set.insert(state).second)
+                {
+                    workpile.push_back(state);
+                }
+
+            }
+
+        }
+
+        while (workpile.size() > 0)
+        {
+
+            State* state = workpile.back();
+            workpile.pop_back();
+
+            for (State* predecessor: predecessor_map[state])
+            {
+
+                if (guarded_set.insert(predecessor).second)
+                {
+                    workpile.push_back(predecessor);
+                }
+
+            }
+
+        }
+
+        for (State* state: reachable_set)
+        {
+
+            if (guarded_set.find(state) == guarded_set.end())
+            {
+                memo_state_set.insert(state);
+            }
+
+        }
+
+    };
 
     //
     //  state_label                                
@@ -2344,60 +4033,281 @@ void ScannerGenerator::create_vmcode()
             Symbol* token = it->second.token;
             Ast* guard_ast = it->second.guard_ast;
 
-            ICodeLabel* true_label = nullptr;
-            ICodeLabel* false_label = nullptr;
+            ICodeLabel* true_label = nullptr;
+            ICodeLabel* false_label = nullptr;
+
+            if (guard_ast != nullptr && guard_ast->get_kind() != AstType::AstNull)
+            {
+
+                true_label = code.get_label();
+                false_label = code.get_label();
+
+                actg.generate_condition(guard_ast, true_label, false_label);
+                code.emit(OpcodeType::OpcodeLabel, token->location,
+                          ICodeOperand(true_label));
+
+            }
+                
+            code.emit(OpcodeType::OpcodeScanAccept, token->location,
+                      ICodeOperand(static_cast<int64_t>(it->second.token->symbol_num)),
+                      ICodeOperand(symbol_action_map[token]));
+
+            if (false_label == nullptr)
+            {
+                break;
+            }
+
+            code.emit(OpcodeType::OpcodeLabel, token->location,
+                      ICodeOperand(false_label));
+            
+        }
+
+        //
+        //  Encode the character transitions, either as a dense slice of  
+        //  targets from the lowest class this state moves on to the      
+        //  highest, or as a list of ranges to search. The slice is a     
+        //  single lookup but needs a target for every class in its span, 
+        //  and keyword prefixes split the letters into many classes, so  
+        //  we only use it when it's no longer than the ranges. Memoized  
+        //  states always use the slice, since only ScanClassMemo records 
+        //  where the scanner has been.                                   
+        //
+
+        map<int64_t, State*> class_target_map;
+
+        for (auto transition: state->transitions)
+        {
+
+            for (int64_t i = find_interval(transition.range_start);
+                 i < interval_start.size() && interval_start[i] <= transition.range_end;
+                 i++)
+            {
+                class_target_map[interval_class[i]] = transition.target_state;
+            }
+
+        }
+
+        int64_t first_class = 0;
+        int64_t class_count = 0;
+
+        if (class_target_map.size() > 0)
+        {
+            first_class = class_target_map.begin()->first;
+            class_count = class_target_map.rbegin()->first - first_class + 1;
+        }
+
+        bool memo_state = memo_state_set.find(state) != memo_state_set.end();
+
+        if (!memo_state && 2 + class_count > 1 + 3 * state->transitions.size())
+        {
+
+            vector<ICodeOperand> operands;
+            operands.push_back(ICodeOperand(state->transitions.size()));
+
+            for (auto transition: state->transitions)
+            {
+                operands.push_back(ICodeOperand(transition.range_start));
+                operands.push_back(ICodeOperand(transition.range_end));
+                operands.push_back(ICodeOperand(state_label(transition.target_state)));
+            }
+
+            code.emit(OpcodeScanChar, -1, operands);
+
+        }
+        else
+        {
+
+            vector<ICodeOperand> operands;
+            operands.push_back(ICodeOperand(first_class));
+            operands.push_back(ICodeOperand(class_count));
+
+            for (int64_t char_class = first_class;
+                 char_class < first_class + class_count;
+                 char_class++)
+            {
+
+                auto it = class_target_map.find(char_class);
+                if (it == class_target_map.end())
+                {
+                    operands.push_back(ICodeOperand(static_cast<ICodeLabel*>(nullptr)));
+                }
+                else
+                {
+                    operands.push_back(ICodeOperand(state_label(it->second)));
+                }
+
+            }
+
+            if (memo_state)
+            {
+                code.emit(OpcodeScanClassMemo, -1, operands);
+            }
+            else
+            {
+                code.emit(OpcodeScanClass, -1, operands);
+            }
+
+        }
+
+        //
+        //  Process all the states reachable from this one. 
+        //
+
+        for (auto transition: state->transitions)
+        {
+            encode_state(transition.target_state);
+        }
+    
+    };
+
+    //
+    //  encode_nfa                                                         
+    //  ----------                                                         
+    //                                                                     
+    //  For the lazy scanner, store the NFA in the operands of a ScanLazy  
+    //  instruction, laid out as described in LazyDfa.cpp. Each accept    
+    //  with a guard gets a small routine that evaluates the guard and     
+    //  executes a ScanAccept if it holds.                                 
+    //
+
+    function<void()> encode_nfa = [&]() -> void
+    {
+
+        //
+        //  Number the reachable states with the start state first. 
+        //
+
+        map<State*, int64_t> state_num_map;
+        vector<State*> state_list;
+
+        state_num_map[nfa_start_state] = 0;
+        state_list.push_back(nfa_start_state);
+
+        for (int64_t i = 0; i < state_list.size(); i++)
+        {
+
+            vector<State*> next_list(state_list[i]->e_moves.begin(),
+                                     state_list[i]->e_moves.end());
+
+            for (auto transition: state_list[i]->transitions)
+            {
+                next_list.push_back(transition.target_state);
+            }
+
+            for (State* next_state: next_list)
+            {
+
+                if (state_num_map.find(next_state) == state_num_map.end())
+                {
+                    state_num_map[next_state] = state_list.size();
+                    state_list.push_back(next_state);
+                }
+
+            }
+
+        }
+
+        //
+        //  Number the accepts in the order the scanner should try them. 
+        //
+
+        set<AcceptAction> accept_set;
+        for (State* state: state_list)
+        {
+            accept_set.insert(state->accept_actions.begin(), state->accept_actions.end());
+        }
+
+        vector<ICodeOperand> operands;
+        operands.push_back(ICodeOperand(char_class_count));
+        operands.push_back(ICodeOperand(accept_set.size()));
+
+        map<AcceptAction, int64_t> accept_num_map;
+        vector<pair<AcceptAction, ICodeLabel*>> guard_list;
 
-            if (guard_ast != nullptr && guard_ast->get_kind() != AstType::AstNull)
-            {
+        for (auto accept_action: accept_set)
+        {
 
-                true_label = code.get_label();
-                false_label = code.get_label();
+            int64_t accept_num = accept_num_map.size();
+            accept_num_map.insert(make_pair(accept_action, accept_num));
 
-                actg.generate_condition(guard_ast, true_label, false_label);
-                code.emit(OpcodeType::OpcodeLabel, token->location,
-                          ICodeOperand(true_label));
+            operands.push_back(ICodeOperand(static_cast<int64_t>(accept_action.token->symbol_num)));
+            operands.push_back(ICodeOperand(symbol_action_map[accept_action.token]));
 
+            if (accept_action.guard_ast != nullptr &&
+                accept_action.guard_ast->get_kind() != AstType::AstNull)
+            {
+                guard_list.push_back(make_pair(accept_action, code.get_label()));
+                operands.push_back(ICodeOperand(guard_list.back().second));
             }
-                
-            code.emit(OpcodeType::OpcodeScanAccept, token->location,
-                      ICodeOperand(static_cast<int64_t>(it->second.token->symbol_num)),
-                      ICodeOperand(symbol_action_map[token]));
-
-            if (false_label == nullptr)
+            else
             {
-                break;
+                operands.push_back(ICodeOperand(static_cast<ICodeLabel*>(nullptr)));
             }
 
-            code.emit(OpcodeType::OpcodeLabel, token->location,
-                      ICodeOperand(false_label));
-            
         }
 
         //
-        //  Encode the character transitions. 
+        //  Then the states. 
         //
 
-        vector<ICodeOperand> operands;
-        operands.push_back(ICodeOperand(state->transitions.size()));
+        operands.push_back(ICodeOperand(state_list.size()));
 
-        for (auto transition: state->transitions)
+        for (State* state: state_list)
         {
-            operands.push_back(ICodeOperand(transition.range_start));
-            operands.push_back(ICodeOperand(transition.range_end));
-            operands.push_back(ICodeOperand(state_label(transition.target_state)));
+
+            operands.push_back(ICodeOperand(state->e_moves.size()));
+            for (State* next_state: state->e_moves)
+            {
+                operands.push_back(ICodeOperand(state_num_map[next_state]));
+            }
+
+            operands.push_back(ICodeOperand(state->transitions.size()));
+            for (auto transition: state->transitions)
+            {
+                operands.push_back(ICodeOperand(transition.range_start));
+                operands.push_back(ICodeOperand(transition.range_end));
+                operands.push_back(ICodeOperand(state_num_map[transition.target_state]));
+            }
+
+            operands.push_back(ICodeOperand(state->accept_actions.size()));
+            for (auto accept_action: state->accept_actions)
+            {
+                operands.push_back(ICodeOperand(accept_num_map[accept_action]));
+            }
+
         }
 
-        code.emit(OpcodeScanChar, -1, operands);
+        code.emit(OpcodeScanLazy, -1, operands);
 
         //
-        //  Process all the states reachable from this one. 
+        //  Generate the guard routines. 
         //
 
-        for (auto transition: state->transitions)
+        for (auto& guard: guard_list)
         {
-            encode_state(transition.target_state);
+
+            Symbol* token = guard.first.token;
+            ICodeLabel* true_label = code.get_label();
+            ICodeLabel* false_label = code.get_label();
+
+            code.emit(OpcodeType::OpcodeLabel, token->location,
+                      ICodeOperand(guard.second));
+
+            actg.generate_condition(guard.first.guard_ast, true_label, false_label);
+
+            code.emit(OpcodeType::OpcodeLabel, token->location,
+                      ICodeOperand(true_label));
+            code.emit(OpcodeType::OpcodeScanAccept, token->location,
+                      ICodeOperand(static_cast<int64_t>(token->symbol_num)),
+                      ICodeOperand(symbol_action_map[token]));
+            code.emit(OpcodeType::OpcodeReturn, token->location);
+
+            code.emit(OpcodeType::OpcodeLabel, token->location,
+                      ICodeOperand(false_label));
+            code.emit(OpcodeType::OpcodeReturn, token->location);
+
         }
-    
+
     };
 
     //
@@ -2426,8 +4336,9 @@ void ScannerGenerator::create_vmcode()
             continue;
         }
 
-        if (token->action_ast == nullptr ||
-            token->action_ast->get_kind() == AstType::AstNull)
+        if ((token->action_ast == nullptr ||
+             token->action_ast->get_kind() == AstType::AstNull) &&
+            token != keyword_host)
         {
 
             if (token->is_ignored)
@@ -2455,7 +4366,21 @@ void ScannerGenerator::create_vmcode()
     code.emit(OpcodeType::OpcodeLabel, -1, ICodeOperand(scan_label));
     code.emit(OpcodeType::OpcodeScanStart, -1);
 
-    encode_state(dfa_start_state);
+    if (gram.lazy_scanner)
+    {
+        encode_nfa();
+    }
+    else
+    {
+
+        if (gram.linear_scan)
+        {
+            find_memo_states();
+        }
+
+        encode_state(dfa_start_state);
+
+    }
 
     //
     //  Default accept (no actions).
@@ -2480,20 +4405,27 @@ void ScannerGenerator::create_vmcode()
     code.emit(OpcodeType::OpcodeBranch, -1, ICodeOperand(scan_label));
 
     //
-    //  Generate accept actions for the other symbols. 
+    //  Generate accept actions for the other symbols. We walk the symbols
+    //  by name so the code comes out in the same order every time.
     //
 
-    for (auto mp: symbol_action_map)
+    for (auto mp: gram.symbol_map)
     {
           
-        if (mp.second == default_accept_label || mp.second == default_ignore_label)
+        Symbol* token = mp.second;
+        if (symbol_action_map.find(token) == symbol_action_map.end())
+        {
+            continue;
+        }
+
+        ICodeLabel* action_label = symbol_action_map[token];
+        if (action_label == default_accept_label || action_label == default_ignore_label)
         {
             continue;
         }
 
-        Symbol* token = mp.first;
         code.emit(OpcodeType::OpcodeLabel, token->location,
-                  ICodeOperand(mp.second));
+                  ICodeOperand(action_label));
 
         if (token->action_ast != nullptr &&
             token->action_ast->get_kind() != AstType::AstNull)
@@ -2516,6 +4448,11 @@ void ScannerGenerator::create_vmcode()
             continue;
         }
 
+        if (token == keyword_host)
+        {
+            encode_keyword_table();
+        }
+
         code.emit(OpcodeType::OpcodeScanToken, token->location);
 
         code.emit(OpcodeType::OpcodeAdd, token->location,
@@ -2529,6 +4466,318 @@ void ScannerGenerator::create_vmcode()
 
 }
 
+//
+//  check_pipeline                                                         
+//  --------------                                                         
+//                                                                         
+//  With pipeline_scanner the scanner runs ahead of the parser on its own  
+//  thread, so anything the scanner does must be independent of anything   
+//  the parser does. Collect the registers the token guards and actions    
+//  use, including the token count the scanner keeps, and compare them     
+//  with the registers the reduce actions use. If they overlap, or a token  
+//  action dumps the parse stack, we warn and scan inline as usual.        
+//
+
+void ScannerGenerator::check_pipeline()
+{
+
+    pipeline_scanner = gram.pipeline_scanner;
+    if (!pipeline_scanner)
+    {
+        return;
+    }
+
+    set<string> scan_read_set;
+    set<string> scan_write_set;
+    bool scan_dumps_stack = false;
+
+    scan_write_set.insert("token_count");
+
+    for (auto mp: gram.symbol_map)
+    {
+
+        Symbol* token = mp.second;
+        if (!token->is_scanned)
+        {
+            continue;
+        }
+
+        for (int i = 0; i < token->regex_list_ast->get_num_children(); i++)
+        {
+            ActionGenerator::find_registers(token->regex_list_ast->get_child(i)->get_child(0),
+                                            scan_read_set,
+                                            scan_write_set,
+                                            scan_dumps_stack);
+        }
+
+        ActionGenerator::find_registers(token->action_ast,
+                                        scan_read_set,
+                                        scan_write_set,
+                                        scan_dumps_stack);
+
+        if (scan_dumps_stack)
+        {
+            errh.add_error(ErrorType::ErrorWarning,
+                           token->location,
+                           "Token action dumps the parse stack, pipeline_scanner ignored");
+            pipeline_scanner = false;
+            return;
+        }
+
+    }
+
+    for (Rule* rule: gram.rule_list)
+    {
+
+        set<string> rule_read_set;
+        set<string> rule_write_set;
+        bool rule_dumps_stack = false;
+
+        ActionGenerator::find_registers(rule->action_ast,
+                                        rule_read_set,
+                                        rule_write_set,
+                                        rule_dumps_stack);
+
+        string shared_name = "";
+
+        for (auto name: rule_read_set)
+        {
+            if (scan_write_set.find(name) != scan_write_set.end())
+            {
+                shared_name = name;
+            }
+        }
+
+        for (auto name: rule_write_set)
+        {
+            if (scan_read_set.find(name) != scan_read_set.end() ||
+                scan_write_set.find(name) != scan_write_set.end())
+            {
+                shared_name = name;
+            }
+        }
+
+        if (shared_name.size() > 0)
+        {
+            errh.add_error(ErrorType::ErrorWarning,
+                           rule->location,
+                           "Reduce action shares register " + shared_name +
+                           " with the scanner, pipeline_scanner ignored");
+            pipeline_scanner = false;
+            return;
+        }
+
+    }
+
+}
+
+//
+//  check_parallel                                                         
+//  --------------                                                         
+//                                                                         
+//  A parallel parse cuts the source before sync tokens, parses the pieces 
+//  independently and joins the lists they produce. That only gives the   
+//  same Ast as a sequential parse if the start symbol is a list, t+, and  
+//  its Ast is that list, and if no guard or action carries state from one 
+//  piece to the next. Otherwise we warn and forget the sync tokens.       
+//
+
+void ScannerGenerator::check_parallel()
+{
+
+    Symbol* sync_token = nullptr;
+
+    for (auto mp: gram.symbol_map)
+    {
+        if (mp.second->is_sync && sync_token == nullptr)
+        {
+            sync_token = mp.second;
+        }
+    }
+
+    if (sync_token == nullptr)
+    {
+        return;
+    }
+
+    //
+    //  is_integer
+    //  ----------
+    //
+    //  Check whether an Ast is a specific child number.
+    //
+
+    function<bool(Ast*, int, const string&)> is_integer =
+        [&](Ast* root, int kind, const string& lexeme) -> bool
+    {
+        return root != nullptr && root->get_kind() == kind && root->get_lexeme() == lexeme;
+    };
+
+    //
+    //  is_list_former
+    //  --------------
+    //
+    //  Check whether the start rule passes the list through, either as is 
+    //  or with its children under a new kind.                             
+    //
+
+    function<bool(Ast*)> is_list_former = [&](Ast* root) -> bool
+    {
+
+        if (root == nullptr || root->get_kind() == AstType::AstNull)
+        {
+            return true;
+        }
+
+        Ast* child = root;
+
+        if (root->get_kind() == AstType::AstAstFormer)
+        {
+
+            if (root->get_num_children() != 2 ||
+                root->get_child(0)->get_kind() != AstType::AstIdentifier)
+            {
+                return false;
+            }
+
+            child = root->get_child(1);
+
+        }
+
+        if (child->get_kind() != AstType::AstAstChild ||
+            child->get_child(0)->get_kind() != AstType::AstAstDot ||
+            child->get_child(0)->get_num_children() != 1 ||
+            !is_integer(child->get_child(0)->get_child(0), AstType::AstInteger, "1"))
+        {
+            return false;
+        }
+
+        Ast* slice = child->get_child(1);
+
+        if (root->get_kind() != AstType::AstAstFormer)
+        {
+            return slice->get_kind() == AstType::AstNull;
+        }
+
+        return slice->get_kind() == AstType::AstAstSlice &&
+               is_integer(slice->get_child(0), AstType::AstInteger, "1") &&
+               is_integer(slice->get_child(1), AstType::AstNegativeInteger, "1");
+
+    };
+
+    //
+    //  check_parallel                 
+    //  --------------                 
+    //                                 
+    //  The function body begins here. 
+    //
+
+    string problem = "";
+
+    vector<Rule*> start_list;
+    vector<Rule*> list_list;
+
+    Symbol* start_symbol = nullptr;
+    if (gram.start_rule->rhs.size() > 0)
+    {
+        start_symbol = gram.start_rule->rhs[0];
+    }
+
+    for (Rule* rule: gram.rule_list)
+    {
+        if (rule->lhs == start_symbol)
+        {
+            start_list.push_back(rule);
+        }
+    }
+
+    Symbol* list_symbol = nullptr;
+    if (start_list.size() == 1 &&
+        start_list[0]->rhs.size() == 1 &&
+        start_list[0]->rhs[0]->symbol_name.find(':') != string::npos)
+    {
+        list_symbol = start_list[0]->rhs[0];
+    }
+
+    for (Rule* rule: gram.rule_list)
+    {
+        if (list_symbol != nullptr && rule->lhs == list_symbol)
+        {
+            list_list.push_back(rule);
+        }
+    }
+
+    if (list_list.size() != 2 ||
+        list_list[0]->rhs.size() != 2 ||
+        list_list[0]->rhs[0] != list_symbol ||
+        list_list[1]->rhs.size() != 1 ||
+        list_list[1]->rhs[0] != list_list[0]->rhs[1] ||
+        !is_list_former(start_list[0]->ast_former_ast))
+    {
+        problem = "Start rule is not a list";
+    }
+
+    //
+    //  Any register written or the token count read would carry state 
+    //  across a cut.                                                  
+    //
+
+    set<string> read_set;
+    set<string> write_set;
+    bool dumps_stack = false;
+
+    for (auto mp: gram.symbol_map)
+    {
+
+        Symbol* token = mp.second;
+        if (!token->is_scanned)
+        {
+            continue;
+        }
+
+        for (int i = 0; i < token->regex_list_ast->get_num_children(); i++)
+        {
+            ActionGenerator::find_registers(token->regex_list_ast->get_child(i)->get_child(0),
+                                            read_set,
+                                            write_set,
+                                            dumps_stack);
+        }
+
+        ActionGenerator::find_registers(token->action_ast, read_set, write_set, dumps_stack);
+
+    }
+
+    for (Rule* rule: gram.rule_list)
+    {
+        ActionGenerator::find_registers(rule->action_ast, read_set, write_set, dumps_stack);
+    }
+
+    if (problem.size() == 0 && write_set.size() > 0)
+    {
+        problem = "Action sets register " + *write_set.begin();
+    }
+
+    if (problem.size() == 0 && read_set.find("token_count") != read_set.end())
+    {
+        problem = "Action reads token_count";
+    }
+
+    if (problem.size() == 0)
+    {
+        return;
+    }
+
+    errh.add_error(ErrorType::ErrorWarning,
+                   sync_token->location,
+                   problem + ", sync tokens ignored");
+
+    for (auto mp: gram.symbol_map)
+    {
+        mp.second->is_sync = false;
+    }
+
+}
+
 //
 //  save_parser_data                                                     
 //  ----------------                                                     
@@ -2540,7 +4789,25 @@ void ScannerGenerator::create_vmcode()
 
 void ScannerGenerator::save_parser_data()
 {
+
     prsd.scanner_pc = scan_label->pc;
+    prsd.pipeline_scanner = pipeline_scanner;
+
+    prsd.char_page_count = char_page_index.size();
+    prsd.char_page_index = new int32_t[prsd.char_page_count];
+    copy(char_page_index.begin(), char_page_index.end(), prsd.char_page_index);
+
+    prsd.char_page_data_count = char_page_data.size();
+    prsd.char_page_data = new int32_t[prsd.char_page_data_count];
+    copy(char_page_data.begin(), char_page_data.end(), prsd.char_page_data);
+
+    prsd.char_high_count = char_high_start.size();
+    prsd.char_high_start = new int64_t[prsd.char_high_count];
+    copy(char_high_start.begin(), char_high_start.end(), prsd.char_high_start);
+
+    prsd.char_high_class = new int32_t[prsd.char_high_count];
+    copy(char_high_class.begin(), char_high_class.end(), prsd.char_high_class);
+
 }
 
 //
@@ -43,7 +43,7 @@ int64_t Source::char_length(const string& str)
 {
 
 #ifndef NOCODECVT
-    static wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
+    thread_local wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
 #endif
 
     try
@@ -74,7 +74,7 @@ string Source::to_ascii_chop(const string& str)
 {
 
 #ifndef NOCODECVT
-    static wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
+    thread_local wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
 #endif
 
     try
@@ -177,7 +177,7 @@ u32string Source::to_utf32(const string& str)
 {
 
 #ifndef NOCODECVT
-    static wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
+    thread_local wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
 #endif
 
     try
@@ -250,7 +250,7 @@ string Source::get_string(int64_t first, int64_t last) const
 {
 
 #ifndef NOCODECVT
-    static wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
+    thread_local wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
 #endif
 
     if (last < 0)
@@ -344,7 +344,7 @@ Source::Source(const string& str)
 {
 
 #ifndef NOCODECVT
-    static wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
+    thread_local wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
 #endif
 
     try
@@ -377,7 +377,7 @@ SourceFile::SourceFile(const string& file_name)
 {
 
 #ifndef NOCODECVT
-    static wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
+    thread_local wstring_convert<codecvt_utf8<char32_t>, char32_t> myconv;
 #endif
 
     ifstream strm(file_name.c_str(), ifstream::binary);
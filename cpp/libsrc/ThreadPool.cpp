@@ -0,0 +1,233 @@
+//
+//  ThreadPool
+//  ----------
+//
+//  A small fixed-size pool of worker threads used during parser
+//  generation. See the header for the ground rules.
+//
+
+#include <cstdint>
+#include <vector>
+#include <queue>
+#include <memory>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include "ThreadPool.H"
+
+//
+//  Namespace hoshi: Not indenting...
+//
+
+namespace hoshi
+{
+
+using namespace std;
+
+//
+//  default_num_threads
+//  -------------------
+//
+//  Use whatever the hardware offers, but never less than one.
+//
+
+int64_t ThreadPool::default_num_threads()
+{
+
+    int64_t num_threads = thread::hardware_concurrency();
+    if (num_threads < 1)
+    {
+        num_threads = 1;
+    }
+
+    return num_threads;
+
+}
+
+//
+//  Constructor
+//  -----------
+//
+//  The caller counts as one of the threads, so we start one fewer
+//  workers than requested.
+//
+
+ThreadPool::ThreadPool(int64_t num_threads)
+{
+
+    for (int64_t i = 1; i < num_threads; i++)
+    {
+        workers.push_back(thread([this]() { run_worker(); }));
+    }
+
+}
+
+//
+//  Destructor
+//  ----------
+//
+//  Let the workers drain the queue and exit.
+//
+
+ThreadPool::~ThreadPool()
+{
+
+    {
+        lock_guard<mutex> task_guard(task_mutex);
+        stopping = true;
+    }
+
+    task_available.notify_all();
+
+    for (thread& worker: workers)
+    {
+        worker.join();
+    }
+
+}
+
+//
+//  run_worker
+//  ----------
+//
+//  The body of each worker thread. Pull tasks off the queue until we're
+//  told to stop and the queue is empty.
+//
+
+void ThreadPool::run_worker()
+{
+
+    for (;;)
+    {
+
+        function<void()> task;
+
+        {
+
+            unique_lock<mutex> task_guard(task_mutex);
+            task_available.wait(task_guard, [this]() {
+                return stopping || task_queue.size() > 0;
+            });
+
+            if (task_queue.size() == 0)
+            {
+                return;
+            }
+
+            task = move(task_queue.front());
+            task_queue.pop();
+
+        }
+
+        task();
+
+    }
+
+}
+
+//
+//  parallel_for
+//  ------------
+//
+//  Call body(i) for each i in [0, count). The caller works through the
+//  indices along with any workers that are free, so this never waits on
+//  a worker that hasn't started, and it's safe to call from inside a
+//  task. Helpers that start after the work is gone find nothing to do,
+//  which is why the shared state lives on the heap.
+//
+//  If any call throws we rethrow the exception from the lowest index
+//  once everything has finished.
+//
+
+void ThreadPool::parallel_for(int64_t count, const function<void(int64_t)>& body)
+{
+
+    struct Shared
+    {
+        atomic<int64_t> next_index;
+        int64_t finished = 0;
+        int64_t error_index = -1;
+        exception_ptr error;
+        mutex finished_mutex;
+        condition_variable all_finished;
+    };
+
+    auto shared = make_shared<Shared>();
+    shared->next_index = 0;
+
+    function<void()> run = [shared, count, body]() -> void
+    {
+
+        for (;;)
+        {
+
+            int64_t i = shared->next_index++;
+            if (i >= count)
+            {
+                return;
+            }
+
+            exception_ptr error;
+
+            try
+            {
+                body(i);
+            }
+            catch (...)
+            {
+                error = current_exception();
+            }
+
+            lock_guard<mutex> finished_guard(shared->finished_mutex);
+
+            if (error && (shared->error_index < 0 || i < shared->error_index))
+            {
+                shared->error_index = i;
+                shared->error = error;
+            }
+
+            if (++shared->finished == count)
+            {
+                shared->all_finished.notify_all();
+            }
+
+        }
+
+    };
+
+    int64_t num_helpers = min(static_cast<int64_t>(workers.size()), count - 1);
+
+    if (num_helpers > 0)
+    {
+
+        {
+            lock_guard<mutex> task_guard(task_mutex);
+            for (int64_t i = 0; i < num_helpers; i++)
+            {
+                task_queue.push(run);
+            }
+        }
+
+        task_available.notify_all();
+
+    }
+
+    run();
+
+    unique_lock<mutex> finished_guard(shared->finished_mutex);
+    shared->all_finished.wait(finished_guard, [shared, count]() {
+        return shared->finished == count;
+    });
+
+    if (shared->error)
+    {
+        rethrow_exception(shared->error);
+    }
+
+}
+
+} // namespace hoshi
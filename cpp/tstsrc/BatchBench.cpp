@@ -0,0 +1,313 @@
+//
+//  Batch Bench
+//  -----------
+//
+//  Many small sources, parsed three ways on 1 up to the number of cores.
+//  The first copies a master parser for each source, the way the DateTime
+//  example does, with the sources split evenly among threads. The second
+//  hands all of them to parse_batch. The last does nothing but attach to
+//  and detach from a shared ParserData on every thread, which is what
+//  each parser copy adds to the parse when all the threads are doing it
+//  at once.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include "Parser.H"
+#include "ParserData.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  A small statement language, a few statements per source.
+//
+
+static const string grammar = R"!(
+tokens
+
+    <identifier>              : regex = ''' [A-Za-z_][A-Za-z_0-9]* '''
+
+    <integer>                 : regex = ''' [0-9]+ '''
+
+rules
+
+    Unit                      ::= Statement+
+                              :   (Unit, $1._)
+
+    Statement                 ::= <identifier> '=' Expression ';'
+                              :   (Assign, $1, $3)
+
+    Expression                ::^ Term
+                                  << '+' : (Add, $1, $2)
+                                     '-' : (Subtract, $1, $2)
+                                  << '*' : (Multiply, $1, $2)
+                                     '/' : (Divide, $1, $2)
+
+    Term                      ::= <identifier> | <integer>
+
+    Term                      ::= '(' Expression ')' : $2
+)!";
+
+//
+//  make_source_list                                
+//  ----------------                                
+//                                                  
+//  Build a list of small sources, a few statements 
+//  each.                                           
+//
+
+vector<Source> make_source_list(int64_t source_count)
+{
+
+    BenchRandom random;
+    vector<Source> source_list;
+
+    for (int64_t i = 0; i < source_count; i++)
+    {
+
+        string source;
+
+        int64_t statement_count = random.next(4) + 1;
+        for (int64_t j = 0; j < statement_count; j++)
+        {
+            source += "v" + to_string(random.next(1000)) + " = " + make_expression(random, 4) + "; ";
+        }
+
+        source_list.push_back(Source(source));
+
+    }
+
+    return source_list;
+
+}
+
+//
+//  BadCharSource                                                       
+//  -------------                                                       
+//                                                                      
+//  A source with a code point past the end of Unicode planted in it.   
+//  Turning its text back into UTF-8 throws a range_error rather than a 
+//  SourceError. An error with no location shows the last line, so we   
+//  keep the bad character off that one.                                
+//
+
+class BadCharSource : public Source
+{
+public:
+
+    BadCharSource(const string& str, int64_t location) : Source(str)
+    {
+        source[location] = 0x110000;
+    }
+
+};
+
+//
+//  check_failures                                                       
+//  --------------                                                       
+//                                                                       
+//  A source that fails, whether with syntax errors or with some other   
+//  exception, should fail only its own result. The others should come   
+//  back as a lone parse would leave them.                               
+//
+
+bool check_failures(Parser& parser)
+{
+
+    vector<Source> src_list =
+    {
+        Source("a = 1;"),
+        Source("a = = 1;"),
+        BadCharSource("a = b1;\nc = 2;", 5),
+        Source("a = b + 2; c = 3;"),
+        Source("d = (a - b) * c;")
+    };
+
+    bool all_passed = true;
+
+    for (int64_t num_threads: { 1, 2 })
+    {
+
+        string found;
+        string expected = ".FF..";
+
+        try
+        {
+
+            vector<Parser> result_list = parser.parse_batch(src_list, num_threads);
+
+            for (size_t i = 0; i < src_list.size(); i++)
+            {
+
+                if (!result_list[i].is_source_failed())
+                {
+
+                    Parser lone = parser;
+                    lone.parse(src_list[i], static_cast<DebugType>(0));
+
+                    found += (result_list[i].get_encoded_ast() == lone.get_encoded_ast()) ? "." : "?";
+
+                }
+                else if (result_list[i].get_error_messages().empty())
+                {
+                    found += "?";
+                }
+                else
+                {
+                    found += "F";
+                }
+
+            }
+
+        }
+        catch (exception& e)
+        {
+            found = e.what();
+        }
+
+        bool passed = found == expected;
+        all_passed = all_passed && passed;
+
+        cout << setw(30) << left << "Failures, " + to_string(num_threads) + " threads"
+             << (passed ? "ok" : "failed: " + found) << endl;
+
+    }
+
+    cout << endl;
+
+    return all_passed;
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t source_count = 100000;
+    static const int64_t attach_count = 10000000;
+
+    Parser parser;
+
+    try
+    {
+        parser.generate(grammar, map<string, int>(), static_cast<DebugType>(0));
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        parser.dump_source(grammar, cout);
+        return 1;
+    }
+
+    if (!check_failures(parser))
+    {
+        return 1;
+    }
+
+    vector<Source> source_list = make_source_list(source_count);
+
+    vector<int64_t> thread_counts;
+    int64_t max_threads = max(static_cast<int64_t>(thread::hardware_concurrency()),
+                              static_cast<int64_t>(1));
+
+    for (int64_t num_threads = 1; num_threads < max_threads; num_threads *= 2)
+    {
+        thread_counts.push_back(num_threads);
+    }
+
+    thread_counts.push_back(max_threads);
+
+    cout << "Sources: " << source_count << endl << endl;
+
+    cout << setw(10) << right << "Threads"
+         << setw(12) << right << "Copy ms"
+         << setw(12) << right << "Batch ms"
+         << setw(10) << right << "Scaling"
+         << setw(16) << right << "ns / attach" << endl;
+
+    double one_thread_time = 0;
+
+    for (int64_t num_threads: thread_counts)
+    {
+
+        double copy_time = run_threads(num_threads, [&](int64_t thread_num) -> void
+        {
+
+            for (int64_t i = thread_num; i < source_count; i += num_threads)
+            {
+
+                Parser copy = parser;
+
+                try
+                {
+                    copy.parse(source_list[i], static_cast<DebugType>(0));
+                }
+                catch (SourceError& e)
+                {
+                    copy.dump_source(source_list[i], cout);
+                }
+
+            }
+
+        });
+
+        double batch_time = best_time([&]() -> void
+        {
+
+            vector<Parser> result_list = parser.parse_batch(source_list, num_threads);
+
+            for (int64_t i = 0; i < source_count; i++)
+            {
+                if (result_list[i].is_source_failed())
+                {
+                    result_list[i].dump_source(source_list[i], cout);
+                }
+            }
+
+        });
+
+        ParserData* shared_prsd = new ParserData();
+        ParserData::attach(shared_prsd);
+
+        double attach_time = run_threads(num_threads, [&](int64_t thread_num) -> void
+        {
+
+            for (int64_t i = 0; i < attach_count / num_threads; i++)
+            {
+                ParserData* prsd = shared_prsd;
+                ParserData::attach(prsd);
+                ParserData::detach(prsd);
+            }
+
+        });
+
+        ParserData::detach(shared_prsd);
+
+        if (num_threads == 1)
+        {
+            one_thread_time = batch_time;
+        }
+
+        cout << setw(10) << right << num_threads
+             << setw(12) << right << fixed << setprecision(2) << copy_time
+             << setw(12) << right << fixed << setprecision(2) << batch_time
+             << setw(10) << right << fixed << setprecision(2) << one_thread_time / batch_time
+             << setw(16) << right << fixed << setprecision(2)
+             << attach_time * 1000000 / (attach_count / num_threads * num_threads)
+             << endl;
+
+    }
+
+}
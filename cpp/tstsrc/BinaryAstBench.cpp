@@ -0,0 +1,227 @@
+//
+//  Binary Ast Bench
+//  ----------------
+//
+//  Compare the two ways we hand a tree to the language wrappers: the
+//  delimited text from get_encoded_ast and the binary form from
+//  get_binary_ast. For each we time producing the string and reading it
+//  back into a pointer tree, and report both per megabyte of source.
+//
+//  The text reader works the way the wrappers did, a character at a time
+//  through a stream. The binary reader is FlatAst::decode and to_ast.
+//  Finally we check that both readers give back the tree we started with.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  decode_text
+//  -----------
+//
+//  Read the text form back into a tree the way the wrappers did, one
+//  character at a time.
+//
+
+Ast* decode_text(const string& str, map<string, int>& kind_map)
+{
+
+    istringstream is(str);
+
+    function<string()> decode_string = [&]() -> string
+    {
+
+        string result;
+
+        for (;;)
+        {
+
+            char c = is.get();
+
+            if (c == '`')
+            {
+                c = is.get();
+            }
+            else if (c == '|')
+            {
+                break;
+            }
+
+            result += c;
+
+        }
+
+        return result;
+
+    };
+
+    function<int64_t()> decode_long = [&]() -> int64_t
+    {
+        return stoll(decode_string());
+    };
+
+    function<Ast*()> decode_ast = [&]() -> Ast*
+    {
+
+        int64_t num_children = decode_long();
+
+        if (num_children < 0)
+        {
+            return nullptr;
+        }
+
+        Ast* ast = new Ast(num_children);
+
+        ast->set_kind(decode_long());
+        ast->set_location(decode_long());
+        ast->set_lexeme(decode_string());
+
+        for (int i = 0; i < num_children; i++)
+        {
+            ast->set_child(i, decode_ast());
+        }
+
+        return ast;
+
+    };
+
+    //
+    //  The function body begins here.
+    //
+
+    int64_t size = decode_long();
+    for (int64_t i = 0; i < size; i++)
+    {
+        string key = decode_string();
+        kind_map[key] = decode_long();
+    }
+
+    return decode_ast();
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t procedure_count = 2000;
+
+    Parser parser;
+
+    try
+    {
+        parser.generate(procedure_grammar, map<string, int>(), static_cast<DebugType>(0));
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        parser.dump_source(procedure_grammar, cout);
+        return 1;
+    }
+
+    string source = make_procedure_source(procedure_count);
+
+    try
+    {
+        parser.parse(source, static_cast<DebugType>(0));
+    }
+    catch (SourceError& e)
+    {
+        parser.dump_source(source, cout);
+        return 1;
+    }
+
+    double megabytes = source.size() / 1e6;
+
+    string text = parser.get_encoded_ast();
+    string binary = parser.get_binary_ast();
+
+    double text_encode_time = best_time([&]() -> void
+    {
+        text = parser.get_encoded_ast();
+    });
+
+    double binary_encode_time = best_time([&]() -> void
+    {
+        binary = parser.get_binary_ast();
+    });
+
+    double text_decode_time = best_time([&]() -> void
+    {
+        map<string, int> kind_map;
+        delete decode_text(text, kind_map);
+    });
+
+    double binary_decode_time = best_time([&]() -> void
+    {
+        FlatAst flat;
+        flat.decode(binary);
+        delete flat.to_ast();
+    });
+
+    //
+    //  Round trip.
+    //
+
+    ostringstream original_dump;
+    parser.dump_ast(parser.get_ast(), original_dump);
+
+    map<string, int> text_kind_map;
+    Ast* text_ast = decode_text(text, text_kind_map);
+    ostringstream text_dump;
+    parser.dump_ast(text_ast, text_dump);
+    delete text_ast;
+
+    map<string, int> binary_kind_map;
+    FlatAst flat;
+    flat.decode(binary, &binary_kind_map);
+    Ast* binary_ast = flat.to_ast();
+    ostringstream binary_dump;
+    parser.dump_ast(binary_ast, binary_dump);
+    delete binary_ast;
+
+    cout << "Source MB: " << fixed << setprecision(2) << megabytes
+         << "  Nodes: " << flat.size() << endl << endl;
+
+    cout << setw(16) << left << ""
+         << setw(12) << right << "Size MB"
+         << setw(14) << right << "Encode ms/MB"
+         << setw(14) << right << "Decode ms/MB" << endl;
+
+    cout << setw(16) << left << "Text"
+         << setw(12) << right << fixed << setprecision(2) << text.size() / 1e6
+         << setw(14) << right << fixed << setprecision(2) << text_encode_time / megabytes
+         << setw(14) << right << fixed << setprecision(2) << text_decode_time / megabytes
+         << endl;
+
+    cout << setw(16) << left << "Binary"
+         << setw(12) << right << fixed << setprecision(2) << binary.size() / 1e6
+         << setw(14) << right << fixed << setprecision(2) << binary_encode_time / megabytes
+         << setw(14) << right << fixed << setprecision(2) << binary_decode_time / megabytes
+         << endl << endl;
+
+    cout << "Text round trip: "
+         << (text_dump.str() == original_dump.str() ? "same" : "differ")
+         << "  Binary round trip: "
+         << (binary_dump.str() == original_dump.str() ? "same" : "differ")
+         << "  Kind maps: "
+         << (text_kind_map == parser.get_kind_map() && binary_kind_map == text_kind_map ?
+             "same" : "differ")
+         << endl;
+
+}
@@ -0,0 +1,113 @@
+//
+//  Copy Bench
+//  ----------
+//
+//  Parser.H recommends copying a parser for each thread, or for each
+//  request as the DateTime example does. Every copy attaches to the
+//  shared parse tables and every destruction detaches, so here we have
+//  up to 64 threads doing nothing but that and report the cost of one
+//  copy and destruction. A copy also allocates its own ParserImpl, so we
+//  time attach and detach on their own as well, which is the part that
+//  contends between threads.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include "Parser.H"
+#include "ParserData.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+static const string grammar = R"!(
+rules
+
+    Unit                      ::= Item+
+
+    Item                      ::= 'a' | 'b'
+)!";
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t thread_counts[] = { 1, 2, 4, 8, 16, 32, 64 };
+    static const int64_t copy_count = 4000000;
+
+    Parser parser;
+
+    try
+    {
+        parser.generate(grammar, map<string, int>(), static_cast<DebugType>(0));
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        parser.dump_source(grammar, cout);
+        return 1;
+    }
+
+    ParserData* shared_prsd = new ParserData();
+    ParserData::attach(shared_prsd);
+
+    cout << "Cores: " << thread::hardware_concurrency()
+         << "  Copies: " << copy_count << endl << endl;
+
+    cout << setw(10) << right << "Threads"
+         << setw(12) << right << "Copy ms"
+         << setw(14) << right << "ns / copy"
+         << setw(12) << right << "Attach ms"
+         << setw(14) << right << "ns / attach" << endl;
+
+    for (int64_t num_threads: thread_counts)
+    {
+
+        int64_t copies_per_thread = copy_count / num_threads;
+
+        double copy_time = run_threads(num_threads, [&](int64_t thread_num) -> void
+        {
+
+            for (int64_t i = 0; i < copies_per_thread; i++)
+            {
+                Parser copy = parser;
+            }
+
+        });
+
+        double attach_time = run_threads(num_threads, [&](int64_t thread_num) -> void
+        {
+
+            for (int64_t i = 0; i < copies_per_thread; i++)
+            {
+                ParserData* prsd = shared_prsd;
+                ParserData::attach(prsd);
+                ParserData::detach(prsd);
+            }
+
+        });
+
+        cout << setw(10) << right << num_threads
+             << setw(12) << right << fixed << setprecision(2) << copy_time
+             << setw(14) << right << fixed << setprecision(2)
+             << copy_time * 1000000 / (copies_per_thread * num_threads)
+             << setw(12) << right << fixed << setprecision(2) << attach_time
+             << setw(14) << right << fixed << setprecision(2)
+             << attach_time * 1000000 / (copies_per_thread * num_threads)
+             << endl;
+
+    }
+
+    ParserData::detach(shared_prsd);
+
+}
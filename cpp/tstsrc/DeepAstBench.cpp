@@ -0,0 +1,126 @@
+//
+//  Deep Ast Bench
+//  --------------
+//
+//  A left recursive list with a new node at each step builds a tree as
+//  deep as the list is long. Here we build those at depths up to ten
+//  million and time the operations that walk the whole tree: cloning,
+//  deleting, encoding and flattening. We don't time dump_ast since its
+//  indentation makes the output grow with the square of the depth.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  Each item wraps the list so far.
+//
+
+static const string grammar = R"!(
+rules
+
+    List                      ::= List 'a'
+                              :   (List, $1)
+
+    List                      ::= 'a'
+                              :   (List)
+)!";
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t depths[] = { 1000000, 3000000, 10000000 };
+
+    Parser parser;
+
+    try
+    {
+        parser.generate(grammar, map<string, int>(), static_cast<DebugType>(0));
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        parser.dump_source(grammar, cout);
+        return 1;
+    }
+
+    cout << setw(10) << right << "Depth"
+         << setw(12) << right << "Parse ms"
+         << setw(12) << right << "Clone ms"
+         << setw(12) << right << "Delete ms"
+         << setw(12) << right << "Encode ms"
+         << setw(12) << right << "Flatten ms" << endl;
+
+    for (int64_t depth: depths)
+    {
+
+        string source;
+        source.reserve(depth * 2);
+
+        for (int64_t i = 0; i < depth; i++)
+        {
+            source += "a ";
+        }
+
+        try
+        {
+
+            double parse_time = time_of([&]() -> void
+            {
+                parser.parse(source, static_cast<DebugType>(0));
+            });
+
+            Ast* copy = nullptr;
+
+            double clone_time = time_of([&]() -> void
+            {
+                copy = parser.get_ast()->clone();
+            });
+
+            double delete_time = time_of([&]() -> void
+            {
+                delete copy;
+            });
+
+            double encode_time = time_of([&]() -> void
+            {
+                parser.get_encoded_ast();
+            });
+
+            double flatten_time = time_of([&]() -> void
+            {
+                FlatAst flat(parser.get_ast());
+            });
+
+            cout << setw(10) << right << depth
+                 << setw(12) << right << fixed << setprecision(2) << parse_time
+                 << setw(12) << right << fixed << setprecision(2) << clone_time
+                 << setw(12) << right << fixed << setprecision(2) << delete_time
+                 << setw(12) << right << fixed << setprecision(2) << encode_time
+                 << setw(12) << right << fixed << setprecision(2) << flatten_time
+                 << endl;
+
+        }
+        catch (SourceError& e)
+        {
+            parser.dump_source(source, cout);
+            return 1;
+        }
+
+    }
+
+}
@@ -0,0 +1,236 @@
+//
+//  Flat Ast Bench
+//  --------------
+//
+//  Compare the pointer Ast with a FlatAst built from it. We parse one
+//  large source and report the time to build each form, an estimate of
+//  the memory each one holds and the time for a full traversal. The
+//  pointer estimate counts the nodes, child arrays and any lexeme too
+//  long for the short string buffer, but not the allocator overhead on
+//  each of those, so the real difference is larger. Finally we convert
+//  the flat tree back and check that it dumps the same.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t procedure_count = 2000;
+
+    Parser parser;
+
+    try
+    {
+        parser.generate(procedure_grammar, map<string, int>(), static_cast<DebugType>(0));
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        parser.dump_source(procedure_grammar, cout);
+        return 1;
+    }
+
+    string source = make_procedure_source(procedure_count);
+
+    try
+    {
+        parser.parse(source, static_cast<DebugType>(0));
+    }
+    catch (SourceError& e)
+    {
+        parser.dump_source(source, cout);
+        return 1;
+    }
+
+    Ast* root = parser.get_ast();
+    FlatAst flat = parser.get_flat_ast();
+
+    //
+    //  Build times. The pointer tree is built by the parse so that's what
+    //  we time for it.
+    //
+
+    double parse_time = best_time([&]() -> void
+    {
+        parser.parse(source, static_cast<DebugType>(0));
+    }, 5);
+
+    root = parser.get_ast();
+
+    double flatten_time = best_time([&]() -> void
+    {
+        FlatAst temp(root);
+    }, 5);
+
+    double expand_time = best_time([&]() -> void
+    {
+        delete flat.to_ast();
+    }, 5);
+
+    //
+    //  Memory.
+    //
+
+    int64_t pointer_size = 0;
+
+    function<void(const Ast*)> measure = [&](const Ast* ast) -> void
+    {
+
+        if (ast == nullptr)
+        {
+            return;
+        }
+
+        pointer_size += sizeof(Ast) + ast->get_num_children() * sizeof(Ast*);
+
+        if (ast->get_lexeme().size() >= sizeof(string))
+        {
+            pointer_size += ast->get_lexeme().size() + 1;
+        }
+
+        for (int i = 0; i < ast->get_num_children(); i++)
+        {
+            measure(ast->get_child(i));
+        }
+
+    };
+
+    measure(root);
+
+    //
+    //  Traversals. Each one visits every node and sums the kinds,
+    //  locations and lexeme lengths so the work can't be skipped.
+    //
+
+    int64_t pointer_sum = 0;
+    int64_t linear_sum = 0;
+    int64_t iterator_sum = 0;
+
+    function<void(const Ast*)> walk_pointer = [&](const Ast* ast) -> void
+    {
+
+        if (ast == nullptr)
+        {
+            return;
+        }
+
+        pointer_sum += ast->get_kind() + ast->get_location() + ast->get_lexeme().size();
+
+        for (int i = 0; i < ast->get_num_children(); i++)
+        {
+            walk_pointer(ast->get_child(i));
+        }
+
+    };
+
+    function<void(const FlatAst::Node&)> walk_iterator =
+        [&](const FlatAst::Node& node) -> void
+    {
+
+        if (node.is_null())
+        {
+            return;
+        }
+
+        iterator_sum += node.get_kind() + node.get_location() + node.get_lexeme().size();
+
+        for (FlatAst::Node child: node)
+        {
+            walk_iterator(child);
+        }
+
+    };
+
+    double pointer_time = best_time([&]() -> void
+    {
+        pointer_sum = 0;
+        walk_pointer(root);
+    }, 5);
+
+    double linear_time = best_time([&]() -> void
+    {
+
+        linear_sum = 0;
+
+        for (int64_t i = 0; i < flat.size(); i++)
+        {
+
+            FlatAst::Node node = flat.get_node(i);
+
+            if (!node.is_null())
+            {
+                linear_sum += node.get_kind() + node.get_location() + node.get_lexeme().size();
+            }
+
+        }
+
+    }, 5);
+
+    double iterator_time = best_time([&]() -> void
+    {
+        iterator_sum = 0;
+        walk_iterator(flat.root());
+    }, 5);
+
+    //
+    //  Round trip.
+    //
+
+    ostringstream pointer_dump;
+    parser.dump_ast(root, pointer_dump);
+
+    Ast* copy = flat.to_ast();
+    ostringstream copy_dump;
+    parser.dump_ast(copy, copy_dump);
+    delete copy;
+
+    cout << "Characters: " << source.size()
+         << "  Nodes: " << flat.size() << endl << endl;
+
+    cout << setw(30) << left << "Parse (pointer Ast) ms"
+         << setw(12) << right << fixed << setprecision(2) << parse_time << endl;
+    cout << setw(30) << left << "Flatten ms"
+         << setw(12) << right << fixed << setprecision(2) << flatten_time << endl;
+    cout << setw(30) << left << "Flat to pointer ms"
+         << setw(12) << right << fixed << setprecision(2) << expand_time << endl;
+    cout << endl;
+
+    cout << setw(30) << left << "Pointer bytes / node"
+         << setw(12) << right << fixed << setprecision(2)
+         << static_cast<double>(pointer_size) / flat.size() << endl;
+    cout << setw(30) << left << "Flat bytes / node"
+         << setw(12) << right << fixed << setprecision(2)
+         << static_cast<double>(flat.get_memory_size()) / flat.size() << endl;
+    cout << endl;
+
+    cout << setw(30) << left << "Pointer traversal ms"
+         << setw(12) << right << fixed << setprecision(2) << pointer_time << endl;
+    cout << setw(30) << left << "Flat preorder traversal ms"
+         << setw(12) << right << fixed << setprecision(2) << linear_time << endl;
+    cout << setw(30) << left << "Flat iterator traversal ms"
+         << setw(12) << right << fixed << setprecision(2) << iterator_time << endl;
+    cout << endl;
+
+    cout << "Sums: " << (pointer_sum == linear_sum && pointer_sum == iterator_sum ? "same" : "differ")
+         << "  Round trip: " << (pointer_dump.str() == copy_dump.str() ? "same" : "differ")
+         << endl;
+
+}
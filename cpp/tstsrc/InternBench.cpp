@@ -0,0 +1,242 @@
+//
+//  Intern Bench
+//  ------------
+//
+//  The Pascal grammar from the Pascal test over a large generated source,
+//  parsed with and without the intern_lexemes option. Real programs use
+//  the same identifiers over and over, so we draw ours from a small
+//  vocabulary. We report the parse time, an estimate of the bytes held
+//  by the tree and its lexemes, and the time to count the uses of each
+//  identifier by string and by lexeme id, as a symbol table builder
+//  might. The estimate counts nodes, child arrays and lexeme texts but
+//  not allocator overhead.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t program_count = 10;
+    static const int64_t procedure_count = 2000;
+
+    //
+    //  A shared lexeme text is a reference count and a string. 
+    //
+
+    static const int64_t text_size = sizeof(int64_t) + sizeof(string);
+
+    Parser plain_parser;
+    Parser intern_parser;
+
+    try
+    {
+
+        plain_parser.generate("options\n    intern_lexemes = false\n" + pascal_grammar_body,
+                              map<string, int>(),
+                              static_cast<DebugType>(0));
+
+        intern_parser.generate("options\n    intern_lexemes = true\n" + pascal_grammar_body,
+                               map<string, int>(),
+                               static_cast<DebugType>(0));
+
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        plain_parser.dump_source(pascal_grammar_body, cout);
+        return 1;
+    }
+
+    string source = make_pascal_source(program_count, procedure_count);
+
+    cout << "Characters: " << source.size() << endl << endl;
+
+    cout << setw(10) << left << "Parser"
+         << setw(12) << right << "Parse ms"
+         << setw(10) << right << "Nodes"
+         << setw(10) << right << "Texts"
+         << setw(12) << right << "Bytes/node"
+         << setw(14) << right << "Count ms" << endl;
+
+    for (Parser* parser: { &plain_parser, &intern_parser })
+    {
+
+        try
+        {
+
+            double parse_time = best_time([&]() -> void
+            {
+                parser->parse(source, static_cast<DebugType>(0));
+            });
+
+            //
+            //  Memory. Without interning every node with a lexeme has its
+            //  own text, with it there is one text per table entry.
+            //
+
+            int64_t node_count = 0;
+            int64_t text_count = 0;
+            int64_t byte_count = 0;
+
+            function<void(const Ast*)> measure = [&](const Ast* root) -> void
+            {
+
+                vector<const Ast*> stack;
+                stack.push_back(root);
+
+                while (stack.size() > 0)
+                {
+
+                    const Ast* ast = stack.back();
+                    stack.pop_back();
+
+                    if (ast == nullptr)
+                    {
+                        continue;
+                    }
+
+                    node_count++;
+                    byte_count += sizeof(Ast) + ast->get_num_children() * sizeof(Ast*);
+
+                    if (ast->get_lexeme_id() < 0 && ast->get_lexeme().size() > 0)
+                    {
+
+                        text_count++;
+                        byte_count += text_size;
+
+                        if (ast->get_lexeme().size() >= sizeof(string))
+                        {
+                            byte_count += ast->get_lexeme().size() + 1;
+                        }
+
+                    }
+
+                    for (int i = 0; i < ast->get_num_children(); i++)
+                    {
+                        stack.push_back(ast->get_child(i));
+                    }
+
+                }
+
+            };
+
+            measure(parser->get_ast());
+
+            const LexemeTable& lexeme_table = parser->get_lexeme_table();
+
+            for (int i = 0; i < lexeme_table.size(); i++)
+            {
+
+                text_count++;
+                byte_count += text_size;
+
+                if (lexeme_table.get_lexeme(i).size() >= sizeof(string))
+                {
+                    byte_count += lexeme_table.get_lexeme(i).size() + 1;
+                }
+
+            }
+
+            //
+            //  Count the uses of each identifier. With interning we index
+            //  a vector by id, otherwise we need a map of strings.
+            //
+
+            int identifier_kind = parser->get_kind("<identifier>");
+
+            function<void(const function<void(const Ast*)>&)> walk =
+                [&](const function<void(const Ast*)>& visit) -> void
+            {
+
+                vector<const Ast*> stack;
+                stack.push_back(parser->get_ast());
+
+                while (stack.size() > 0)
+                {
+
+                    const Ast* ast = stack.back();
+                    stack.pop_back();
+
+                    if (ast == nullptr)
+                    {
+                        continue;
+                    }
+
+                    if (ast->get_kind() == identifier_kind)
+                    {
+                        visit(ast);
+                    }
+
+                    for (int i = 0; i < ast->get_num_children(); i++)
+                    {
+                        stack.push_back(ast->get_child(i));
+                    }
+
+                }
+
+            };
+
+            double count_time = best_time([&]() -> void
+            {
+
+                if (lexeme_table.size() > 0)
+                {
+
+                    vector<int64_t> use_count(lexeme_table.size());
+
+                    walk([&](const Ast* ast) -> void
+                    {
+                        use_count[ast->get_lexeme_id()]++;
+                    });
+
+                }
+                else
+                {
+
+                    map<string, int64_t> use_count;
+
+                    walk([&](const Ast* ast) -> void
+                    {
+                        use_count[ast->get_lexeme()]++;
+                    });
+
+                }
+
+            });
+
+            cout << setw(10) << left << ((parser == &plain_parser) ? "plain" : "intern")
+                 << setw(12) << right << fixed << setprecision(2) << parse_time
+                 << setw(10) << right << node_count
+                 << setw(10) << right << text_count
+                 << setw(12) << right << fixed << setprecision(2)
+                 << static_cast<double>(byte_count) / node_count
+                 << setw(14) << right << fixed << setprecision(2) << count_time
+                 << endl;
+
+        }
+        catch (SourceError& e)
+        {
+            parser->dump_source(source, cout);
+            return 1;
+        }
+
+    }
+
+}
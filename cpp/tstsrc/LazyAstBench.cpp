@@ -0,0 +1,321 @@
+//
+//  Lazy Ast Bench
+//  --------------
+//
+//  The Pascal grammar from the Pascal test over a large generated source,
+//  parsed with and without the lazy_ast option. With lazy_ast the parse
+//  only logs its shifts and reduces, and the tree is built from the log
+//  when get_ast is first called. We time a parse alone, a parse followed
+//  by get_ast, and parse_batch over many small sources where we only look
+//  at which ones failed. We check both ways give the same trees and the
+//  same error messages, that a former error comes out of the parse in
+//  both, and that threads reading one lazy parser see the same tree.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  A grammar whose former can fail. A group with fewer than two names 
+//  has no second child to take.                                       
+//
+
+static const string former_grammar = R"!(
+tokens
+
+    <identifier>              : regex = ''' [A-Za-z_][A-Za-z_0-9]* '''
+
+rules
+
+    Unit                      ::= Group+
+                              :   (Unit, $1._)
+
+    Group                     ::= '(' Names ')'
+                              :   (Group, $2.2)
+
+    Names                     ::= <identifier>*
+                              :   (Names, $1._)
+)!";
+
+//
+//  check_former_errors                                               
+//  -------------------                                               
+//                                                                    
+//  The errors a former reports should come out of parse, with or     
+//  without lazy_ast, not appear later when we ask for the tree.      
+//
+
+bool check_former_errors()
+{
+
+    static const char* source_list[] = { "(a b) (c d)", "(a b) (c)" };
+
+    vector<string> result_list;
+
+    for (string option: { "false", "true" })
+    {
+
+        Parser parser;
+        string results;
+
+        try
+        {
+
+            parser.generate("options\n    lazy_ast = " + option + "\n" + former_grammar,
+                            map<string, int>(),
+                            static_cast<DebugType>(0));
+
+            for (int i = 0; i < LENGTH(source_list); i++)
+            {
+
+                parser.parse(source_list[i], static_cast<DebugType>(0));
+
+                results += to_string(parser.get_error_messages().size()) + "|";
+                parser.get_ast();
+                results += to_string(parser.get_error_messages().size()) + "|";
+
+            }
+
+        }
+        catch (exception& e)
+        {
+            results += e.what();
+        }
+
+        result_list.push_back(results);
+
+    }
+
+    bool passed = result_list[0] == result_list[1] && result_list[0] == "0|0|1|1|";
+
+    cout << setw(30) << left << "Lazy Ast, former errors"
+         << (passed ? "ok" : "failed: " + result_list[0] + " " + result_list[1]) << endl;
+
+    return passed;
+
+}
+
+//
+//  check_threads                                                     
+//  -------------                                                     
+//                                                                    
+//  Several threads ask one lazy parser for its tree at once. Each    
+//  should get the tree the eager parser built.                       
+//
+
+bool check_threads(Parser& lazy_parser, const string& expected)
+{
+
+    static const int thread_count = 4;
+
+    vector<string> encoded_list(thread_count);
+    vector<thread> thread_list;
+
+    for (int i = 0; i < thread_count; i++)
+    {
+
+        thread_list.push_back(thread([&, i]() -> void
+        {
+            encoded_list[i] = lazy_parser.get_encoded_ast();
+        }));
+
+    }
+
+    for (thread& t: thread_list)
+    {
+        t.join();
+    }
+
+    bool passed = true;
+
+    for (const string& encoded: encoded_list)
+    {
+        passed = passed && encoded == expected;
+    }
+
+    cout << setw(30) << left << "Lazy Ast, threads"
+         << (passed ? "ok" : "failed") << endl;
+
+    return passed;
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t program_count = 10;
+    static const int64_t procedure_count = 2000;
+    static const int64_t batch_count = 2000;
+
+    if (!check_former_errors())
+    {
+        return 1;
+    }
+
+    Parser eager_parser;
+    Parser lazy_parser;
+
+    try
+    {
+
+        eager_parser.generate("options\n    lazy_ast = false\n" + pascal_grammar_body,
+                              map<string, int>(),
+                              static_cast<DebugType>(0));
+
+        lazy_parser.generate("options\n    lazy_ast = true\n" + pascal_grammar_body,
+                             map<string, int>(),
+                             static_cast<DebugType>(0));
+
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        eager_parser.dump_source(pascal_grammar_body, cout);
+        return 1;
+    }
+
+    string source = make_pascal_source(program_count, procedure_count);
+
+    //
+    //  Many small sources for the batch, every tenth one with a missing 
+    //  semicolon.                                                       
+    //
+
+    vector<Source> src_list;
+
+    for (int64_t i = 0; i < batch_count; i++)
+    {
+
+        string small_source = make_pascal_source(1, 2);
+
+        if (i % 10 == 9)
+        {
+            small_source.erase(small_source.find(";\n    var"), 1);
+        }
+
+        src_list.push_back(small_source);
+
+    }
+
+    cout << "Characters: " << source.size() << endl << endl;
+
+    cout << setw(10) << left << "Parser"
+         << setw(12) << right << "Parse ms"
+         << setw(16) << right << "With Ast ms"
+         << setw(16) << right << "Batch ms" << endl;
+
+    vector<string> encoded_list;
+    vector<string> batch_list;
+
+    for (Parser* parser: { &eager_parser, &lazy_parser })
+    {
+
+        try
+        {
+
+            double parse_time = best_time([&]() -> void
+            {
+                parser->parse(source, static_cast<DebugType>(0));
+            });
+
+            double ast_time = best_time([&]() -> void
+            {
+                parser->parse(source, static_cast<DebugType>(0));
+                parser->get_ast();
+            });
+
+            encoded_list.push_back(parser->get_encoded_ast());
+
+            //
+            //  A batch where we only want to know what failed. 
+            //
+
+            string verdicts;
+
+            double batch_time = best_time([&]() -> void
+            {
+
+                verdicts.clear();
+
+                for (Parser& result: parser->parse_batch(src_list, 1))
+                {
+                    verdicts += result.is_source_failed() ? "F" : ".";
+                }
+
+            });
+
+            //
+            //  The results of the batch, to compare. 
+            //
+
+            string results = verdicts;
+
+            for (Parser& result: parser->parse_batch(src_list, 1))
+            {
+
+                if (result.is_source_failed())
+                {
+
+                    for (ErrorMessage& message: result.get_error_messages())
+                    {
+                        results += message.get_short_message();
+                    }
+
+                }
+                else
+                {
+                    results += result.get_encoded_ast();
+                }
+
+            }
+
+            batch_list.push_back(results);
+
+            cout << setw(10) << left << ((parser == &eager_parser) ? "eager" : "lazy")
+                 << setw(12) << right << fixed << setprecision(2) << parse_time
+                 << setw(16) << right << fixed << setprecision(2) << ast_time
+                 << setw(16) << right << fixed << setprecision(2) << batch_time
+                 << endl;
+
+        }
+        catch (SourceError& e)
+        {
+            parser->dump_source(source, cout);
+            return 1;
+        }
+
+    }
+
+    cout << endl
+         << "Trees: " << ((encoded_list[0] == encoded_list[1]) ? "same" : "differ")
+         << "  Batches: " << ((batch_list[0] == batch_list[1]) ? "same" : "differ")
+         << endl << endl;
+
+    //
+    //  A fresh lazy parse, so the threads race to build its tree. 
+    //
+
+    lazy_parser.parse(source, static_cast<DebugType>(0));
+
+    if (!check_threads(lazy_parser, encoded_list[0]))
+    {
+        return 1;
+    }
+
+}
@@ -0,0 +1,241 @@
+//
+//  Lookahead Bench
+//  ---------------
+//
+//  Generate synthetic grammars of growing size with each lookahead method
+//  and time the lookahead phase and the whole generation. Each grammar
+//  has up to a few hundred statement forms over a shared expression
+//  grammar, which gives the lookahead relations long chains. We take the
+//  phase time from the progress log. We also generate each one with the
+//  compare method, which runs both and reports any differences, and parse
+//  a sample source with both parsers to check they build the same tree.
+//
+//  The largest grammar takes a while. Most of its generation time is
+//  spent after the lookaheads are found, encoding the parse actions and
+//  resolving conflicts, which both methods share.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  make_grammar
+//  ------------
+//
+//  A grammar with statement_count statement forms, each with three
+//  alternatives and its own keyword.
+//
+
+string make_grammar(const string& method, int64_t statement_count)
+{
+
+    string grammar = "options\n    lookahead_method = \"" + method + "\"\n\n";
+
+    grammar += "rules\n\n   Program ::= Stmt+\n\n   Stmt ::= S0\n";
+
+    for (int64_t i = 1; i < statement_count; i++)
+    {
+        grammar += "        | S" + to_string(i) + "\n";
+    }
+
+    grammar += "\n";
+
+    for (int64_t i = 0; i < statement_count; i++)
+    {
+
+        string name = "S" + to_string(i);
+        string keyword = "'kw" + to_string(i) + "'";
+
+        grammar += "   " + name + " ::= " + keyword + " Expr ';'\n";
+        grammar += "        |  " + keyword + " '(' ExprList ')' Stmt\n";
+        grammar += "        |  " + keyword + " <identifier> ':=' Expr ';'\n";
+
+    }
+
+    grammar += R"!(
+   ExprList ::= Expr (',' Expr)*
+
+   Expr ::= Expr '+' Term | Expr '-' Term | Term
+   Term ::= Term '*' Factor | Term '/' Factor | Factor
+   Factor ::= <identifier> | <integer> | '(' Expr ')' | <identifier> '(' ExprList ')'
+)!";
+
+    return grammar;
+
+}
+
+//
+//  make_source
+//  -----------
+//
+//  A source that uses every statement form.
+//
+
+string make_source(int64_t statement_count)
+{
+
+    string source;
+
+    for (int64_t i = 0; i < statement_count; i++)
+    {
+
+        string keyword = "kw" + to_string(i);
+
+        switch (i % 3)
+        {
+            case 0: source += keyword + " a + b * (c - 1);\n";                  break;
+            case 1: source += keyword + " (a, f(b, c)) " + keyword + " x;\n";   break;
+            case 2: source += keyword + " v := w / 2;\n";                       break;
+        }
+
+    }
+
+    return source;
+
+}
+
+//
+//  generate_timed
+//  --------------
+//
+//  Generate a parser with the progress log captured. We return the
+//  milliseconds from the LR(0) automaton to the lookaheads, and set the
+//  total generation time.
+//
+
+double generate_timed(Parser& parser, const string& grammar, double& total_time)
+{
+
+    string log;
+
+    total_time = time_of([&]() -> void
+    {
+        log = generate_logged(parser, grammar);
+    });
+
+    return log_time(log_line(log, "Lookaheads found")) - log_time(log_line(log, "LR(0) automaton built"));
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    cout << setw(12) << left << "Statements"
+         << setw(16) << right << "Propagate"
+         << setw(16) << right << "Digraph"
+         << setw(16) << right << "Propagate"
+         << setw(16) << right << "Digraph"
+         << setw(10) << right << "Errors"
+         << setw(10) << right << "Warnings"
+         << setw(8) << right << "Trees" << endl;
+
+    cout << setw(12) << left << ""
+         << setw(16) << right << "lookahead ms"
+         << setw(16) << right << "lookahead ms"
+         << setw(16) << right << "total ms"
+         << setw(16) << right << "total ms" << endl;
+
+    for (int64_t statement_count: { 25, 50, 100, 200 })
+    {
+
+        Parser propagate_parser;
+        Parser digraph_parser;
+        Parser compare_parser;
+
+        string propagate_grammar = make_grammar("propagate", statement_count);
+        string digraph_grammar = make_grammar("digraph", statement_count);
+
+        try
+        {
+
+            double propagate_total = 0;
+            double propagate_time = generate_timed(propagate_parser,
+                                                   propagate_grammar,
+                                                   propagate_total);
+
+            double digraph_total = 0;
+            double digraph_time = generate_timed(digraph_parser,
+                                                 digraph_grammar,
+                                                 digraph_total);
+
+            //
+            //  The compare method fails generation if the two disagree on
+            //  anything but a propagated superset, which is a warning.
+            //
+
+            int errors = 0;
+            int warnings = 0;
+
+            try
+            {
+                compare_parser.generate(make_grammar("compare", statement_count),
+                                        map<string, int>(),
+                                        static_cast<DebugType>(0));
+            }
+            catch (GrammarError& e)
+            {
+            }
+
+            for (ErrorMessage& message: compare_parser.get_error_messages())
+            {
+
+                if (message.get_type() == ErrorType::ErrorWarning)
+                {
+                    warnings++;
+                }
+                else
+                {
+                    errors++;
+                }
+
+            }
+
+            string source = make_source(statement_count);
+            propagate_parser.parse(source, static_cast<DebugType>(0));
+            digraph_parser.parse(source, static_cast<DebugType>(0));
+
+            bool same_trees = propagate_parser.get_encoded_ast() == digraph_parser.get_encoded_ast();
+
+            cout << setw(12) << left << statement_count
+                 << setw(16) << right << fixed << setprecision(2) << propagate_time
+                 << setw(16) << right << fixed << setprecision(2) << digraph_time
+                 << setw(16) << right << fixed << setprecision(2) << propagate_total
+                 << setw(16) << right << fixed << setprecision(2) << digraph_total
+                 << setw(10) << right << errors
+                 << setw(10) << right << warnings
+                 << setw(8) << right << (same_trees ? "same" : "differ") << endl;
+
+        }
+        catch (GrammarError& e)
+        {
+            cout << "Grammar errors:" << endl;
+            propagate_parser.dump_source(propagate_grammar, cout);
+            digraph_parser.dump_source(digraph_grammar, cout);
+            return 1;
+        }
+        catch (SourceError& e)
+        {
+            cout << "Source errors:" << endl;
+            propagate_parser.dump_source(make_source(statement_count), cout);
+            digraph_parser.dump_source(make_source(statement_count), cout);
+            return 1;
+        }
+
+    }
+
+}
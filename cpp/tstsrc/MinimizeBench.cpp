@@ -0,0 +1,311 @@
+//
+//  Minimize Bench
+//  --------------
+//
+//  Keyword-heavy grammars put a chain of states in the scanner for each
+//  keyword, which is where the DFA minimizer has the most to do. Here we
+//  generate such grammars with the Hopcroft and pairwise minimizers and
+//  time the minimize phase from the progress log. We also generate each
+//  one with the compare method, which checks the two minimized automata
+//  are the same, and scan a source with both parsers to check they build
+//  the same tree.
+//
+//  The pairwise minimizer only compares states with the same accepted
+//  tokens and transition ranges. Keywords that are separate tokens give
+//  it short lists, but keywords that are alternatives of one token give
+//  it one long list, and there it goes quadratic. Parser generation for
+//  a thousand separate keywords is slow, so we stop that kind at five
+//  hundred.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  An identifier covering several scripts, as in UnicodeBench. Its long
+//  range lists make every state on the identifier path expensive to
+//  compare.
+//
+
+static const string unicode_identifier = R"!(
+    <identifier>              : regex = ''' [A-Za-z_À-ÖØ-öø-ɏͰ-ϿЀ-ӿ԰-֏א-׿ؠ-ي぀-ヿ㐀-䶿一-鿿가-힯]
+                                            [A-Za-z_0-9À-ÖØ-öø-ɏͰ-ϿЀ-ӿ԰-֏א-׿ؠ-ي٠-٩぀-ヿ㐀-䶿一-鿿가-힯]* '''
+                                precedence = 50
+)!";
+
+//
+//  Each case is a number of keywords, whether they are alternatives of a
+//  single <keyword> token rather than literals in the rules, and whether
+//  to use the Unicode identifier rather than the default one.
+//
+
+struct MinimizeCase
+{
+    string name;
+    int64_t keyword_count;
+    bool one_token;
+    bool unicode;
+};
+
+MinimizeCase minimize_case[] =
+{
+    { "literals",            250, false, false },
+    { "literals",            500, false, false },
+    { "literals, Unicode",   500, false, true  },
+    { "one token",          1000, true,  false },
+    { "one token, Unicode", 1000, true,  true  }
+};
+
+//
+//  make_keyword
+//  ------------
+//
+//  The keyword for an index. We spell the index in letters so keywords
+//  share prefixes with each other and with identifiers.
+//
+
+string make_keyword(int64_t index)
+{
+
+    string keyword = "k";
+
+    for (int64_t n = index + 1; n > 0; n = (n - 1) / 26)
+    {
+        keyword += static_cast<char>('a' + (n - 1) % 26);
+    }
+
+    return keyword;
+
+}
+
+//
+//  make_grammar
+//  ------------
+//
+//  A grammar with keyword_count keywords, either as literal alternatives
+//  of one item or as the regex of a single token.
+//
+
+string make_grammar(const string& method, const MinimizeCase& mcase)
+{
+
+    string grammar = "options\n    minimize_method = \"" + method + "\"\n";
+
+    if (mcase.unicode || mcase.one_token)
+    {
+        grammar += "\ntokens\n";
+    }
+
+    if (mcase.unicode)
+    {
+        grammar += unicode_identifier;
+    }
+
+    if (mcase.one_token)
+    {
+
+        grammar += "\n    <keyword> : regex = ''' " + make_keyword(0);
+
+        for (int64_t i = 1; i < mcase.keyword_count; i++)
+        {
+            grammar += " | " + make_keyword(i);
+        }
+
+        grammar += " '''\n";
+
+    }
+
+    grammar += "\nrules\n\n    Unit ::= Item+\n\n    Item ::= <identifier> | <integer>\n";
+
+    if (mcase.one_token)
+    {
+        grammar += "         | <keyword>\n";
+    }
+    else
+    {
+
+        for (int64_t i = 0; i < mcase.keyword_count; i++)
+        {
+            grammar += "         | '" + make_keyword(i) + "'\n";
+        }
+
+    }
+
+    return grammar;
+
+}
+
+//
+//  make_source
+//  -----------
+//
+//  A source with every keyword, and identifiers that are a keyword with
+//  a letter added or the last letter dropped.
+//
+
+string make_source(const MinimizeCase& mcase)
+{
+
+    string source;
+
+    for (int64_t i = 0; i < mcase.keyword_count; i++)
+    {
+
+        string keyword = make_keyword(i);
+
+        source += keyword + " " + keyword + "z " +
+                  keyword.substr(0, keyword.length() - 1) + " " +
+                  to_string(i) + "\n";
+
+    }
+
+    return source;
+
+}
+
+//
+//  generate_timed
+//  --------------
+//
+//  Generate a parser with the progress log captured. We return the
+//  milliseconds taken to minimize the DFA and set its number of states.
+//
+
+double generate_timed(Parser& parser, const string& grammar, int64_t& state_count)
+{
+
+    string log = generate_logged(parser, grammar);
+
+    string built_line = log_line(log, "Scanner DFA built");
+    string minimized_line = log_line(log, "Scanner DFA minimized");
+
+    state_count = 0;
+    size_t colon = minimized_line.find(':');
+
+    if (colon != string::npos)
+    {
+        state_count = stoll(minimized_line.substr(colon + 1));
+    }
+
+    return log_time(minimized_line) - log_time(built_line);
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    cout << setw(22) << left << "Case"
+         << setw(10) << right << "Keywords"
+         << setw(12) << right << "Hopcroft"
+         << setw(12) << right << "Pairwise"
+         << setw(12) << right << "Hopcroft"
+         << setw(12) << right << "Pairwise"
+         << setw(10) << right << "Errors"
+         << setw(8) << right << "Trees" << endl;
+
+    cout << setw(32) << left << ""
+         << setw(12) << right << "ms"
+         << setw(12) << right << "ms"
+         << setw(12) << right << "states"
+         << setw(12) << right << "states" << endl;
+
+    for (int64_t i = 0; i < LENGTH(minimize_case); i++)
+    {
+
+        MinimizeCase& mcase = minimize_case[i];
+
+        Parser hopcroft_parser;
+        Parser pairwise_parser;
+        Parser compare_parser;
+
+        string hopcroft_grammar = make_grammar("hopcroft", mcase);
+        string pairwise_grammar = make_grammar("pairwise", mcase);
+        string source = make_source(mcase);
+
+        try
+        {
+
+            int64_t hopcroft_states = 0;
+            double hopcroft_time = generate_timed(hopcroft_parser,
+                                                  hopcroft_grammar,
+                                                  hopcroft_states);
+
+            int64_t pairwise_states = 0;
+            double pairwise_time = generate_timed(pairwise_parser,
+                                                  pairwise_grammar,
+                                                  pairwise_states);
+
+            //
+            //  The compare method fails generation if the two minimized
+            //  automata differ.
+            //
+
+            int errors = 0;
+
+            try
+            {
+                compare_parser.generate(make_grammar("compare", mcase),
+                                        map<string, int>(),
+                                        static_cast<DebugType>(0));
+            }
+            catch (GrammarError& e)
+            {
+            }
+
+            for (ErrorMessage& message: compare_parser.get_error_messages())
+            {
+
+                if (message.get_type() != ErrorType::ErrorWarning)
+                {
+                    errors++;
+                }
+
+            }
+
+            hopcroft_parser.parse(source, static_cast<DebugType>(0));
+            pairwise_parser.parse(source, static_cast<DebugType>(0));
+
+            bool same_trees = hopcroft_parser.get_encoded_ast() == pairwise_parser.get_encoded_ast();
+
+            cout << setw(22) << left << mcase.name
+                 << setw(10) << right << mcase.keyword_count
+                 << setw(12) << right << fixed << setprecision(2) << hopcroft_time
+                 << setw(12) << right << fixed << setprecision(2) << pairwise_time
+                 << setw(12) << right << hopcroft_states
+                 << setw(12) << right << pairwise_states
+                 << setw(10) << right << errors
+                 << setw(8) << right << (same_trees ? "same" : "differ") << endl;
+
+        }
+        catch (GrammarError& e)
+        {
+            cout << "Grammar errors:" << endl;
+            hopcroft_parser.dump_source(hopcroft_grammar, cout);
+            pairwise_parser.dump_source(pairwise_grammar, cout);
+            return 1;
+        }
+        catch (SourceError& e)
+        {
+            cout << "Source errors:" << endl;
+            hopcroft_parser.dump_source(source, cout);
+            pairwise_parser.dump_source(source, cout);
+            return 1;
+        }
+
+    }
+
+}
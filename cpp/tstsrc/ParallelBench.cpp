@@ -0,0 +1,213 @@
+//
+//  Parallel Bench
+//  --------------
+//
+//  A procedure_grammar can mark tokens that only begin a top-level unit with
+//  sync = true, and parse_parallel then cuts a large source before them
+//  and parses the pieces on a thread pool. Here we time one large source
+//  with a plain parse and with parse_parallel on 1 up to the number of
+//  cores. Cutting the source changes the work a little, since each piece
+//  builds a shorter list, so the one thread row is the one to measure the
+//  scaling against.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  check_parallel
+//  --------------
+//
+//  Check that parse_parallel gives what parse does: the same tree for a
+//  good source, and the same errors when one chunk has a syntax error,
+//  whether that is the first chunk or the last. A failed chunk sends
+//  parse_parallel back to a sequential parse.
+//
+
+bool check_parallel(Parser& parser, const string& source)
+{
+
+    //
+    //  parse_result
+    //  ------------
+    //
+    //  The encoded tree after a parse, or the error count if it failed.
+    //
+
+    function<string(const function<void()>&)> parse_result =
+        [&](const function<void()>& parse) -> string
+    {
+
+        try
+        {
+            parse();
+        }
+        catch (SourceError& e)
+        {
+            return "errors " + to_string(parser.get_error_count());
+        }
+
+        return parser.get_encoded_ast();
+
+    };
+
+    //
+    //  check_parallel
+    //  --------------
+    //
+    //  The function body begins here.
+    //
+
+    string first_error = source;
+    first_error.replace(first_error.find(" = "), 3, " = = ");
+
+    string last_error = source;
+    last_error.replace(last_error.rfind(" = "), 3, " = = ");
+
+    struct ParallelCheck
+    {
+        string name;
+        const string& source;
+    };
+
+    ParallelCheck parallel_check[] =
+    {
+        { "good source",           source      },
+        { "error in first chunk",  first_error },
+        { "error in last chunk",   last_error  }
+    };
+
+    bool all_passed = true;
+
+    for (int i = 0; i < LENGTH(parallel_check); i++)
+    {
+
+        ParallelCheck& check = parallel_check[i];
+
+        string sequential = parse_result([&]() -> void
+        {
+            parser.parse(check.source, static_cast<DebugType>(0));
+        });
+
+        string parallel = parse_result([&]() -> void
+        {
+            parser.parse_parallel(check.source, 4, static_cast<DebugType>(0));
+        });
+
+        bool passed = parallel == sequential && (i == 0) == (sequential.compare(0, 7, "errors ") != 0);
+        all_passed = all_passed && passed;
+
+        cout << setw(32) << left << "Parallel, " + check.name
+             << (passed ? "ok" : "failed") << endl;
+
+    }
+
+    cout << endl;
+
+    return all_passed;
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t procedure_count = 4000;
+
+    Parser parser;
+
+    try
+    {
+        parser.generate(procedure_grammar, map<string, int>(), static_cast<DebugType>(0));
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        parser.dump_source(procedure_grammar, cout);
+        return 1;
+    }
+
+    string source = make_procedure_source(procedure_count);
+
+    if (!check_parallel(parser, source))
+    {
+        return 1;
+    }
+
+    vector<int64_t> thread_counts;
+    int64_t max_threads = max(static_cast<int64_t>(thread::hardware_concurrency()),
+                              static_cast<int64_t>(1));
+
+    for (int64_t num_threads = 1; num_threads < max_threads; num_threads *= 2)
+    {
+        thread_counts.push_back(num_threads);
+    }
+
+    thread_counts.push_back(max_threads);
+
+    cout << "Procedures: " << procedure_count
+         << "  Characters: " << source.size() << endl << endl;
+
+    cout << setw(12) << left << "Parse"
+         << setw(10) << right << "Threads"
+         << setw(12) << right << "ms"
+         << setw(10) << right << "Scaling" << endl;
+
+    try
+    {
+
+        double sequential_time = best_time([&]() -> void
+        {
+            parser.parse(source, static_cast<DebugType>(0));
+        });
+
+        cout << setw(12) << left << "parse"
+             << setw(10) << right << 1
+             << setw(12) << right << fixed << setprecision(2) << sequential_time
+             << endl;
+
+        double one_thread_time = 0;
+
+        for (int64_t num_threads: thread_counts)
+        {
+
+            double parallel_time = best_time([&]() -> void
+            {
+                parser.parse_parallel(source, num_threads, static_cast<DebugType>(0));
+            });
+
+            if (num_threads == 1)
+            {
+                one_thread_time = parallel_time;
+            }
+
+            cout << setw(12) << left << "parallel"
+                 << setw(10) << right << num_threads
+                 << setw(12) << right << fixed << setprecision(2) << parallel_time
+                 << setw(10) << right << fixed << setprecision(2) << one_thread_time / parallel_time
+                 << endl;
+
+        }
+
+    }
+    catch (SourceError& e)
+    {
+        parser.dump_source(source, cout);
+    }
+
+}
@@ -0,0 +1,161 @@
+//
+//  Pipeline Bench
+//  --------------
+//
+//  With the pipeline_scanner option the scanner runs on its own thread
+//  ahead of the parser. Here we generate the same grammar with and
+//  without the option and time both on large single sources. Each
+//  statement gets a full Ast so the parser has real work to overlap
+//  with scanning, but the rules for the unit throw the statements away
+//  so we aren't timing a huge list.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  A small statement language. The option line is filled in below.
+//
+
+static const string grammar_body = R"!(
+tokens
+
+    <identifier>              : regex = ''' [A-Za-z_][A-Za-z_0-9]* '''
+
+    <integer>                 : regex = ''' [0-9]+ '''
+
+    <comment>                 : regex = ''' // [^\n]* '''
+                                ignore = true
+
+rules
+
+    Unit                      ::= Unit Statement : $1
+
+    Unit                      ::= Statement : ()
+
+    Statement                 ::= <identifier> '=' Expression ';'
+                              :   (Assign, $1, $3)
+
+    Expression                ::^ Term
+                                  << '+' : (Add, $1, $2)
+                                     '-' : (Subtract, $1, $2)
+                                  << '*' : (Multiply, $1, $2)
+                                     '/' : (Divide, $1, $2)
+
+    Term                      ::= <identifier> | <integer>
+
+    Term                      ::= '(' Expression ')' : $2
+)!";
+
+//
+//  make_source                                                         
+//  -----------                                                         
+//                                                                      
+//  Build a source of assignments with a comment every so often.        
+//
+
+string make_source(int64_t statement_count)
+{
+
+    BenchRandom random;
+    string source;
+
+    for (int64_t i = 0; i < statement_count; i++)
+    {
+
+        if (i % 10 == 0)
+        {
+            source += "// statement " + to_string(i) + "\n";
+        }
+
+        source += "v" + to_string(random.next(1000)) + " = " + make_expression(random, 6) + ";\n";
+
+    }
+
+    return source;
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t sizes[] = { 10000, 100000, 500000 };
+
+    Parser inline_parser;
+    Parser pipeline_parser;
+
+    try
+    {
+
+        inline_parser.generate("options\n    pipeline_scanner = false\n" + grammar_body,
+                               map<string, int>(),
+                               static_cast<DebugType>(0));
+
+        pipeline_parser.generate("options\n    pipeline_scanner = true\n" + grammar_body,
+                                 map<string, int>(),
+                                 static_cast<DebugType>(0));
+
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        inline_parser.dump_source(grammar_body, cout);
+        return 1;
+    }
+
+    cout << setw(12) << right << "Statements"
+         << setw(12) << right << "Characters"
+         << setw(12) << right << "Inline ms"
+         << setw(14) << right << "Pipeline ms"
+         << setw(10) << right << "Speedup" << endl;
+
+    for (int64_t statement_count: sizes)
+    {
+
+        string source = make_source(statement_count);
+
+        try
+        {
+
+            double inline_time = best_time([&]() -> void
+            {
+                inline_parser.parse(source, static_cast<DebugType>(0));
+            },
+            5);
+
+            double pipeline_time = best_time([&]() -> void
+            {
+                pipeline_parser.parse(source, static_cast<DebugType>(0));
+            },
+            5);
+
+            cout << setw(12) << right << statement_count
+                 << setw(12) << right << source.size()
+                 << setw(12) << right << fixed << setprecision(2) << inline_time
+                 << setw(14) << right << fixed << setprecision(2) << pipeline_time
+                 << setw(10) << right << fixed << setprecision(2) << inline_time / pipeline_time
+                 << endl;
+
+        }
+        catch (SourceError& e)
+        {
+            inline_parser.dump_source(source, cout);
+        }
+
+    }
+
+}
@@ -0,0 +1,187 @@
+//
+//  Scan Bench
+//  ----------
+//
+//  The scanner backs up to the last accepting state when it gets stuck,
+//  so a long token that never closes can make it rescan the rest of the
+//  source once for each short token it falls back to. Here we time a few
+//  of those inputs at doubling sizes, with and without the linear_scan
+//  option. Without it the times should grow four-fold per row, with it
+//  two-fold.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <map>
+#include <iostream>
+#include <iomanip>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  Each case is a grammar with a long token that the input keeps starting
+//  and never finishes, and a string repeated to build the input. The     
+//  rules are left recursive and throw away the Ast so the parser itself  
+//  stays linear.                                                         
+//
+
+struct ScanCase
+{
+    string name;
+    string grammar;
+    string fragment;
+};
+
+ScanCase scan_case[] =
+{
+
+    {
+        "unterminated comments",
+        R"!(
+tokens
+
+    <comment>                 : template = <c_comment>
+
+rules
+
+    Unit                      ::= Unit Item : $1
+
+    Unit                      ::= Item : ()
+
+    Item                      ::= '/' | '*' | 'a'
+        )!",
+        "/*a"
+    },
+
+    {
+        "unterminated strings",
+        R"!(
+tokens
+
+    <string>                  : regex = ''' " ( \\ [^\n] | [^"\\] )* " '''
+
+rules
+
+    Unit                      ::= Unit Item : $1
+
+    Unit                      ::= Item : ()
+
+    Item                      ::= '"' | '\\' | <string>
+        )!",
+        "\"\\"
+    },
+
+    {
+        "a+b against a",
+        R"!(
+tokens
+
+    <ab>                      : regex = ''' a+ b '''
+
+rules
+
+    Unit                      ::= Unit Item : $1
+
+    Unit                      ::= Item : ()
+
+    Item                      ::= 'a' | <ab>
+        )!",
+        "a"
+    }
+
+};
+
+//
+//  time_parse
+//  ----------
+//
+//  Parse the source and return the elapsed time in milliseconds, or -1
+//  on errors.
+//
+
+double time_parse(Parser& parser, const string& source)
+{
+
+    try
+    {
+
+        return time_of([&]() -> void
+        {
+            parser.parse(source, static_cast<DebugType>(0));
+        });
+
+    }
+    catch (SourceError& e)
+    {
+        parser.dump_source(source, cout);
+    }
+
+    return -1;
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    for (int i = 0; i < LENGTH(scan_case); i++)
+    {
+
+        Parser parser[2];
+
+        try
+        {
+
+            for (int j = 0; j < 2; j++)
+            {
+
+                parser[j].generate(string("options\n\n    linear_scan = ") +
+                                   (j == 0 ? "false" : "true") + "\n" +
+                                   scan_case[i].grammar,
+                                   map<string, int>(),
+                                   static_cast<DebugType>(0)
+                                  );
+
+            }
+
+        }
+        catch (GrammarError& e)
+        {
+            cout << "Grammar errors:" << endl;
+            parser[0].dump_source(scan_case[i].grammar, cout);
+            continue;
+        }
+
+        cout << scan_case[i].name << endl << endl
+             << setw(10) << right << "Length"
+             << setw(14) << right << "Backtrack ms"
+             << setw(14) << right << "Linear ms" << endl;
+
+        for (int64_t count = 1000; count <= 16000; count *= 2)
+        {
+
+            string source;
+            for (int64_t j = 0; j < count; j++)
+            {
+                source += scan_case[i].fragment;
+            }
+
+            cout << setw(10) << right << source.length()
+                 << setw(14) << right << fixed << setprecision(2) << time_parse(parser[0], source)
+                 << setw(14) << right << fixed << setprecision(2) << time_parse(parser[1], source)
+                 << endl;
+
+        }
+
+        cout << endl;
+
+    }
+
+}
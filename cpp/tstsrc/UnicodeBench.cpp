@@ -0,0 +1,328 @@
+//
+//  Unicode Bench
+//  -------------
+//
+//  The scanner finds the character class of each code point through a
+//  two-level table, so identifiers written in Chinese, Korean or Cyrillic
+//  should scan as fast as ASCII ones even though the identifier token is
+//  a long list of ranges. Here we time the scanner on sources made of
+//  identifiers from different scripts and report the rate for each.
+//
+//  First we check that literals with non-ASCII characters scan as whole
+//  code points, with and without case sensitivity.
+//
+
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <map>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include "Parser.H"
+#include "BenchUtil.H"
+
+using namespace std;
+using namespace hoshi;
+
+//
+//  The grammar has a Unicode identifier covering several scripts. The
+//  rules are left recursive and throw away the Ast so we mostly time
+//  the scanner.
+//
+
+static const string grammar = R"!(
+tokens
+
+    <identifier>              : regex = ''' [A-Za-z_À-ÖØ-öø-ɏͰ-ϿЀ-ӿ԰-֏א-׿ؠ-ي぀-ヿ㐀-䶿一-鿿가-힯]
+                                            [A-Za-z_0-9À-ÖØ-öø-ɏͰ-ϿЀ-ӿ԰-֏א-׿ؠ-ي٠-٩぀-ヿ㐀-䶿一-鿿가-힯]* '''
+
+    <integer>                 : regex = ''' [0-9]+ '''
+
+rules
+
+    Unit                      ::= Unit Item : $1
+
+    Unit                      ::= Item : ()
+
+    Item                      ::= <identifier> | <integer> | '=' | '+' | ';'
+)!";
+
+//
+//  Each literal check generates a grammar with non-ASCII literals under 
+//  some options, scans a source and compares the kind of each item, and 
+//  the lexeme of each identifier, with what we expect.                  
+//
+
+struct LiteralCheck
+{
+    string name;
+    string options;
+    string source;
+    string expected;
+};
+
+static const string literal_grammar = R"!(
+tokens
+
+    <identifier>              : regex = ''' [A-Za-zÀ-ÖØ-öø-ɏͰ-Ͽ] [A-Za-z0-9À-ÖØ-öø-ɏͰ-Ͽ]* '''
+                                precedence = 50
+
+rules
+
+    Unit                      ::= Item+
+
+    Item                      ::= 'für' : (Fur)
+
+    Item                      ::= 'Straße' : (Strasse)
+
+    Item                      ::= 'λόγος' : (Logos)
+
+    Item                      ::= <identifier> : (Name &1)
+)!";
+
+LiteralCheck literal_check[] =
+{
+
+    {
+        "case sensitive",
+        "",
+        "für Straße λόγος fürs Stra λ",
+        "Fur Strasse Logos Name:fürs Name:Stra Name:λ"
+    },
+
+    {
+        "case insensitive",
+        "case_sensitive = false",
+        "FüR STRAßE λόγος FÜR",
+        "Fur Strasse Logos Name:FÜR"
+    },
+
+    {
+        "keyword table",
+        "keyword_table = true",
+        "für Straße λόγος fürs Stra λ",
+        "Fur Strasse Logos Name:fürs Name:Stra Name:λ"
+    }
+
+};
+
+//
+//  check_literals
+//  --------------
+//
+//  Run each literal check and report whether it passed.
+//
+
+bool check_literals()
+{
+
+    bool all_passed = true;
+
+    for (int i = 0; i < LENGTH(literal_check); i++)
+    {
+
+        LiteralCheck& check = literal_check[i];
+        string grammar = "options\n    " + check.options + "\n" + literal_grammar;
+        Parser parser;
+
+        try
+        {
+
+            parser.generate(grammar, map<string, int>(), static_cast<DebugType>(0));
+            parser.parse(check.source, static_cast<DebugType>(0));
+
+            Ast* root = parser.get_ast();
+            string found;
+
+            for (int j = 0; j < root->get_num_children(); j++)
+            {
+
+                Ast* item = root->get_child(j);
+
+                found += (j > 0 ? " " : "") + parser.get_kind_string(item);
+                if (item->get_lexeme().length() > 0)
+                {
+                    found += ":" + item->get_lexeme();
+                }
+
+            }
+
+            bool passed = found == check.expected;
+            all_passed = all_passed && passed;
+
+            cout << setw(28) << left << "Literals, " + check.name
+                 << (passed ? "ok" : "failed: " + found) << endl;
+
+        }
+        catch (GrammarError& e)
+        {
+            cout << "Grammar errors:" << endl;
+            parser.dump_source(grammar, cout);
+            all_passed = false;
+        }
+        catch (SourceError& e)
+        {
+            cout << "Source errors:" << endl;
+            parser.dump_source(check.source, cout);
+            all_passed = false;
+        }
+        catch (exception& e)
+        {
+            cout << setw(28) << left << "Literals, " + check.name
+                 << "failed: " << e.what() << endl;
+            all_passed = false;
+        }
+
+    }
+
+    cout << endl;
+
+    return all_passed;
+
+}
+
+//
+//  Each corpus draws identifier characters from a few code point ranges.
+//
+
+struct Corpus
+{
+    string name;
+    char32_t range[3][2];
+};
+
+Corpus corpus[] =
+{
+    { "ASCII",    { { 'a', 'z' },       { 'A', 'Z' },       { 'a', 'z' }       } },
+    { "CJK",      { { 0x4e00, 0x9fff }, { 0x4e00, 0x9fff }, { 0x3400, 0x4dbf } } },
+    { "Hangul",   { { 0xac00, 0xd7a3 }, { 0xac00, 0xd7a3 }, { 0xac00, 0xd7a3 } } },
+    { "Cyrillic", { { 0x0430, 0x044f }, { 0x0410, 0x042f }, { 0x0430, 0x044f } } },
+    { "Mixed",    { { 'a', 'z' },       { 0x4e00, 0x9fff }, { 0x0430, 0x044f } } }
+};
+
+//
+//  append_utf8
+//  -----------
+//
+//  Append a code point to a string in UTF-8.
+//
+
+void append_utf8(string& str, char32_t c)
+{
+
+    if (c < 0x80)
+    {
+        str += static_cast<char>(c);
+    }
+    else if (c < 0x800)
+    {
+        str += static_cast<char>(0xc0 | (c >> 6));
+        str += static_cast<char>(0x80 | (c & 0x3f));
+    }
+    else
+    {
+        str += static_cast<char>(0xe0 | (c >> 12));
+        str += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+        str += static_cast<char>(0x80 | (c & 0x3f));
+    }
+
+}
+
+//
+//  make_source
+//  -----------
+//
+//  Build a source of identifiers, each followed by an operator.
+//
+
+string make_source(const Corpus& corpus, int64_t identifier_count)
+{
+
+    static const char* separator[] = { " = ", " + ", " ; " };
+
+    BenchRandom random;
+    string source;
+
+    for (int64_t i = 0; i < identifier_count; i++)
+    {
+
+        int64_t length = random.next(8) + 1;
+        for (int64_t j = 0; j < length; j++)
+        {
+            const char32_t* range = corpus.range[random.next(LENGTH(corpus.range))];
+            append_utf8(source, range[0] + random.next(range[1] - range[0] + 1));
+        }
+
+        source += separator[random.next(LENGTH(separator))];
+
+    }
+
+    return source;
+
+}
+
+//
+//  Test Driver.
+//
+
+int main()
+{
+
+    static const int64_t identifier_count = 200000;
+    static const int64_t token_count = identifier_count * 2;
+
+    if (!check_literals())
+    {
+        return 1;
+    }
+
+    Parser parser;
+
+    try
+    {
+        parser.generate(grammar, map<string, int>(), static_cast<DebugType>(0));
+    }
+    catch (GrammarError& e)
+    {
+        cout << "Grammar errors:" << endl;
+        parser.dump_source(grammar, cout);
+        return 1;
+    }
+
+    cout << setw(10) << left << "Corpus"
+         << setw(12) << right << "Characters"
+         << setw(10) << right << "Tokens"
+         << setw(10) << right << "ms"
+         << setw(14) << right << "Tokens / us" << endl;
+
+    for (int i = 0; i < LENGTH(corpus); i++)
+    {
+
+        string source = make_source(corpus[i], identifier_count);
+
+        try
+        {
+
+            double parse_time = best_time([&]() -> void
+            {
+                parser.parse(source, static_cast<DebugType>(0));
+            },
+            5);
+
+            cout << setw(10) << left << corpus[i].name
+                 << setw(12) << right << Source::char_length(source)
+                 << setw(10) << right << token_count
+                 << setw(10) << right << fixed << setprecision(2) << parse_time
+                 << setw(14) << right << fixed << setprecision(2) << token_count / parse_time / 1000
+                 << endl;
+
+        }
+        catch (SourceError& e)
+        {
+            parser.dump_source(source, cout);
+        }
+
+    }
+
+}
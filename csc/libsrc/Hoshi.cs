@@ -13,6 +13,7 @@ using System.IO;
 using System.Security;
 using System.Threading;
 using System.Collections.Generic;
+using System.Buffers.Binary;
 using System.Runtime.InteropServices;
 
 //
@@ -118,6 +119,27 @@ internal unsafe class Services
     private static extern void register_string_creator(
                                    StringCreator creator);
 
+    //
+    //  Binary. We decode the tree or the batch while the native buffer is
+    //  still alive, reading it in place through a span.
+    //
+
+    public delegate void BinaryCreator(ref object target,
+                                       byte *bytes,
+                                       long length);
+
+    private static BinaryCreator binaryCreator = 
+        delegate (ref object target, byte *bytes, long length)
+        {
+            target = TypeConvert.DecodeBinary(new ReadOnlySpan<byte>(bytes, (int)length));
+        };
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_Services_register_binary_creator"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern void register_binary_creator(
+                                   BinaryCreator creator);
+
     //
     //  register                                            
     //  --------                                            
@@ -131,6 +153,7 @@ internal unsafe class Services
         register_source_error_creator(sourceErrorCreator);
         register_unknown_error_creator(unknownErrorCreator);
         register_string_creator(stringCreator);
+        register_binary_creator(binaryCreator);
     }
 
 }
@@ -558,6 +581,221 @@ internal class TypeConvert
 
     }
 
+    //
+    //  DecodeBinary                                                       
+    //  ------------                                                       
+    //                                                                     
+    //  All binary results come through one callback, so we tell a tree    
+    //  from a batch by its magic number.                                  
+    //
+
+    public static object DecodeBinary(ReadOnlySpan<byte> bytes)
+    {
+
+        if (BinaryPrimitives.ReadInt32LittleEndian(bytes) == 0x54414248)
+        {
+            return DecodeBinaryBatch(bytes);
+        }
+
+        return DecodeBinaryAst(bytes);
+
+    }
+
+    //
+    //  DecodeBinaryBatch                                                  
+    //  -----------------                                                  
+    //                                                                     
+    //  Unpack the results of Parser.ParseBatch, in the form described in  
+    //  ParserImpl.cpp. The native buffer is freed when we return, so we   
+    //  decode every source here.                                          
+    //
+
+    public static BatchResult [] DecodeBinaryBatch(ReadOnlySpan<byte> bytes)
+    {
+
+        if (BinaryPrimitives.ReadInt32LittleEndian(bytes) != 0x54414248 ||
+            BinaryPrimitives.ReadInt32LittleEndian(bytes.Slice(4)) != 1)
+        {
+            throw new UnknownError("Invalid binary batch");
+        }
+
+        int count = (int)BinaryPrimitives.ReadInt64LittleEndian(bytes.Slice(8));
+        BatchResult [] results = new BatchResult[count];
+
+        for (int i = 0; i < count; i++)
+        {
+
+            int offset = (int)BinaryPrimitives.ReadInt64LittleEndian(bytes.Slice(16 + 8 * i));
+            ReadOnlySpan<byte> record = bytes.Slice(offset);
+
+            BatchResult result = new BatchResult();
+            result.SourceFailed = BinaryPrimitives.ReadInt32LittleEndian(record) != 0;
+            result.ErrorCount = BinaryPrimitives.ReadInt32LittleEndian(record.Slice(4));
+            result.WarningCount = BinaryPrimitives.ReadInt32LittleEndian(record.Slice(8));
+
+            int messagesSize = (int)BinaryPrimitives.ReadInt64LittleEndian(record.Slice(16));
+            int astSize = (int)BinaryPrimitives.ReadInt64LittleEndian(record.Slice(24));
+
+            if (messagesSize > 0)
+            {
+
+                StringReader reader = 
+                    new StringReader(Encoding.UTF8.GetString(record.Slice(32, messagesSize)));
+
+                int size = (int)DecodeLong(reader);
+                while (size-- > 0)
+                {
+                    result.ErrorMessages.Add(DecodeErrorMessage(reader));
+                }
+
+            }
+
+            if (astSize > 0)
+            {
+                result.Ast = DecodeBinaryAst(record.Slice(32 + ((messagesSize + 7) & ~7), astSize)).Item2;
+            }
+
+            results[i] = result;
+
+        }
+
+        return results;
+
+    }
+
+    //
+    //  ReadNarrow                                                         
+    //  ----------                                                         
+    //                                                                     
+    //  One value of an array in the binary Ast, stored in one, two, four  
+    //  or eight bytes.                                                    
+    //
+
+    public static long ReadNarrow(ReadOnlySpan<byte> bytes, int width, int index)
+    {
+
+        switch (width)
+        {
+            case 1:  return (sbyte)bytes[index];
+            case 2:  return BinaryPrimitives.ReadInt16LittleEndian(bytes.Slice(2 * index));
+            case 4:  return BinaryPrimitives.ReadInt32LittleEndian(bytes.Slice(4 * index));
+            case 8:  return BinaryPrimitives.ReadInt64LittleEndian(bytes.Slice(8 * index));
+            default: throw new UnknownError("Invalid binary Ast");
+        }
+
+    }
+
+    //
+    //  DecodeBinaryAst                                                    
+    //  ---------------                                                    
+    //                                                                     
+    //  Build an Ast from the binary form described in FlatAst.cpp, along  
+    //  with the kind map that comes with it. We use an explicit stack so  
+    //  a deep tree can't overflow the CLR stack.                          
+    //
+
+    public static Tuple<Dictionary<string, int>, Ast> DecodeBinaryAst(ReadOnlySpan<byte> bytes)
+    {
+
+        if (BinaryPrimitives.ReadInt32LittleEndian(bytes) != 0x54534148 ||
+            BinaryPrimitives.ReadInt32LittleEndian(bytes.Slice(4)) != 2)
+        {
+            throw new UnknownError("Invalid binary Ast");
+        }
+
+        long kindMapCount = BinaryPrimitives.ReadInt64LittleEndian(bytes.Slice(8));
+        long kindMapSize = BinaryPrimitives.ReadInt64LittleEndian(bytes.Slice(16));
+
+        Dictionary<string, int> kindMap = new Dictionary<string, int>();
+
+        int offset = 24;
+        for (long i = 0; i < kindMapCount; i++)
+        {
+
+            int kind = BinaryPrimitives.ReadInt32LittleEndian(bytes.Slice(offset));
+            int length = BinaryPrimitives.ReadInt32LittleEndian(bytes.Slice(offset + 4));
+
+            kindMap[Encoding.UTF8.GetString(bytes.Slice(offset + 8, length))] = kind;
+            offset += 8 + length;
+
+        }
+
+        offset = 24 + (int)kindMapSize;
+
+        int nodeCount = (int)BinaryPrimitives.ReadInt64LittleEndian(bytes.Slice(offset));
+        int kindWidth = bytes[offset + 16];
+        int numChildrenWidth = bytes[offset + 17];
+        int locationWidth = bytes[offset + 18];
+        int lexemeWidth = bytes[offset + 19];
+
+        offset += 24;
+        ReadOnlySpan<byte> kinds = bytes.Slice(offset, kindWidth * nodeCount);
+        offset += (kindWidth * nodeCount + 7) & ~7;
+        ReadOnlySpan<byte> numChildren = bytes.Slice(offset, numChildrenWidth * nodeCount);
+        offset += (numChildrenWidth * nodeCount + 7) & ~7;
+        ReadOnlySpan<byte> locations = bytes.Slice(offset, locationWidth * nodeCount);
+        offset += (locationWidth * nodeCount + 7) & ~7;
+        ReadOnlySpan<byte> lexemeLengths = bytes.Slice(offset, lexemeWidth * nodeCount);
+        offset += (lexemeWidth * nodeCount + 7) & ~7;
+        ReadOnlySpan<byte> pool = bytes.Slice(offset);
+
+        Ast root = null;
+        Stack<Ast> stack = new Stack<Ast>();
+        Stack<int> nextChild = new Stack<int>();
+        int first = 0;
+
+        for (int i = 0; i < nodeCount; i++)
+        {
+
+            Ast ast = null;
+            int kind = (int)ReadNarrow(kinds, kindWidth, i);
+            int length = (int)ReadNarrow(lexemeLengths, lexemeWidth, i);
+
+            if (kind >= 0)
+            {
+
+                ast = new Ast((int)ReadNarrow(numChildren, numChildrenWidth, i));
+                ast.Kind = kind;
+                ast.Location = ReadNarrow(locations, locationWidth, i);
+
+                if (length > 0)
+                {
+                    ast.Lexeme = Encoding.UTF8.GetString(pool.Slice(first, length));
+                }
+
+            }
+
+            first += length;
+
+            if (stack.Count == 0)
+            {
+                root = ast;
+            }
+            else
+            {
+                int child = nextChild.Pop();
+                stack.Peek().SetChild(child, ast);
+                nextChild.Push(child + 1);
+            }
+
+            if (ast != null && ast.Children.Length > 0)
+            {
+                stack.Push(ast);
+                nextChild.Push(0);
+            }
+
+            while (stack.Count > 0 && nextChild.Peek() == stack.Peek().Children.Length)
+            {
+                stack.Pop();
+                nextChild.Pop();
+            }
+
+        }
+
+        return Tuple.Create(kindMap, root);
+
+    }
+
     //
     //  DecodeErrorMessage
     //  ------------------                    
@@ -787,6 +1025,64 @@ public class Parser {
         
     }
 
+    //
+    //  ParseBatch
+    //  ----------
+    //  
+    //  Parse a list of sources in one call, on numThreads threads or one  
+    //  per core by default. We return a BatchResult for each source, in   
+    //  order. A source with errors doesn't throw an exception, it's marked 
+    //  failed in its result.                                              
+    //
+
+    public BatchResult [] ParseBatch(string [] sourceList, long numThreads = 0)
+    {
+
+        byte [][] encodedList = new byte[sourceList.Length][];
+        long textSize = 0;
+
+        for (int i = 0; i < sourceList.Length; i++)
+        {
+            encodedList[i] = Encoding.UTF8.GetBytes(sourceList[i]);
+            textSize += encodedList[i].Length;
+        }
+
+        byte [] packed = new byte[8 * (sourceList.Length + 2) + textSize];
+        Span<byte> header = packed;
+
+        BinaryPrimitives.WriteInt64LittleEndian(header, sourceList.Length);
+
+        long sourceStart = 0;
+        int offset = 8 * (sourceList.Length + 2);
+
+        for (int i = 0; i < sourceList.Length; i++)
+        {
+
+            BinaryPrimitives.WriteInt64LittleEndian(header.Slice(8 * (i + 1)), sourceStart);
+            sourceStart += encodedList[i].Length;
+
+            Buffer.BlockCopy(encodedList[i], 0, packed, offset, encodedList[i].Length);
+            offset += encodedList[i].Length;
+
+        }
+
+        BinaryPrimitives.WriteInt64LittleEndian(header.Slice(8 * (sourceList.Length + 1)),
+                                                sourceStart);
+
+        object exception = null;
+        object result = null;
+
+        parse_binary_batch(thisHandle, ref exception, packed, packed.Length, numThreads, ref result);
+        
+        if (exception != null)
+        {
+            throw (Exception)exception;
+        }
+
+        return (BatchResult [])result;
+
+    }
+
     //
     //  GetAst
     //  ------
@@ -803,17 +1099,17 @@ public class Parser {
             object exception = null;
             object result = null;
 
-            get_encoded_ast(thisHandle, ref exception, ref result);
+            get_binary_ast(thisHandle, ref exception, ref result);
         
             if (exception != null)
             {
                 throw (Exception)exception;
             }
 
-            string marshalled = (string)result;
+            Tuple<Dictionary<string, int>, Ast> decoded = 
+                (Tuple<Dictionary<string, int>, Ast>)result;
 
-            StringReader reader = new StringReader(marshalled);
-            kindMap = TypeConvert.DecodeKindMap(reader);
+            kindMap = decoded.Item1;
 
             kindIMap = new Dictionary<int, string>();
             foreach (string key in kindMap.Keys)
@@ -821,9 +1117,7 @@ public class Parser {
                 kindIMap[kindMap[key]] = key;
             }
 
-            Ast ast = TypeConvert.DecodeAst(reader);
-
-            return ast;
+            return decoded.Item2;
 
         }
         catch (UnknownError e)
@@ -840,6 +1134,35 @@ public class Parser {
 
     }
 
+    //
+    //  GetAstHandle
+    //  ------------
+    //  
+    //  Return a handle on the root of the native Ast, or null. This is the 
+    //  way to go when you only need to look at part of a large tree.       
+    //
+    
+    public AstHandle GetAstHandle()
+    {
+
+        object exception = null;
+
+        long handle = get_ast_handle(thisHandle, ref exception);
+        
+        if (exception != null)
+        {
+            throw (Exception)exception;
+        }
+
+        if (handle == 0)
+        {
+            return null;
+        }
+
+        return new AstHandle(this, handle);
+
+    }
+
     //
     //  DumpAst
     //  -------
@@ -1291,6 +1614,16 @@ public class Parser {
                                      [MarshalAs(UnmanagedType.LPWStr)] string source, 
                                      long debugFlags);
 
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_Parser_parse_binary_batch"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern void parse_binary_batch(long thisHandle, 
+                                                  ref object exception, 
+                                                  byte [] packedSources, 
+                                                  long packedSize, 
+                                                  long numThreads, 
+                                                  ref object result);
+
     [DllImport("hoshi.dll", ExactSpelling=true,
                EntryPoint="csc_Parser_get_encoded_ast"),
      SuppressUnmanagedCodeSecurity]
@@ -1298,6 +1631,19 @@ public class Parser {
                                                ref object exception, 
                                                ref object result);
 
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_Parser_get_binary_ast"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern void get_binary_ast(long thisHandle, 
+                                              ref object exception, 
+                                              ref object result);
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_Parser_get_ast_handle"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern long get_ast_handle(long thisHandle, 
+                                              ref object exception);
+
     [DllImport("hoshi.dll", ExactSpelling=true,
                EntryPoint="csc_Parser_get_encoded_kind_map"),
      SuppressUnmanagedCodeSecurity]
@@ -1453,6 +1799,243 @@ public class Ast
 
 }
 
+//
+//  BatchResult                                                            
+//  -----------                                                            
+//                                                                         
+//  The result of one source from Parser.ParseBatch: whether it failed,    
+//  its error messages and its Ast. These are all brought over with the    
+//  batch, so nothing here calls back into the library.                    
+//
+
+public class BatchResult
+{
+
+    static BatchResult()
+    {
+        Initializer.Initialize();
+    }
+
+    private bool sourceFailed;
+    private int errorCount;
+    private int warningCount;
+    private List<ErrorMessage> errorMessages;
+    private Ast ast;
+
+    internal BatchResult()
+    {
+        sourceFailed = false;
+        errorCount = 0;
+        warningCount = 0;
+        errorMessages = new List<ErrorMessage>();
+        ast = null;
+    }
+
+    public bool SourceFailed
+    {
+        get { return sourceFailed; }
+        internal set { sourceFailed = value; }
+    }
+
+    public int ErrorCount
+    {
+        get { return errorCount; }
+        internal set { errorCount = value; }
+    }
+
+    public int WarningCount
+    {
+        get { return warningCount; }
+        internal set { warningCount = value; }
+    }
+
+    public List<ErrorMessage> ErrorMessages
+    {
+        get { return errorMessages; }
+    }
+
+    public Ast Ast
+    {
+        get { return ast; }
+        internal set { ast = value; }
+    }
+
+}
+
+//
+//  AstHandle                                                              
+//  ---------                                                              
+//                                                                         
+//  A node of the Ast left in the native library. Each accessor is a call  
+//  into the library, so this costs more per node than an Ast but nothing  
+//  for the nodes you never look at. GetChildren fetches a slice of the    
+//  children in one call and GetSubtree brings over a whole subtree as an  
+//  Ast.                                                                   
+//                                                                         
+//  The handle points into the parser's tree, so it is only good until the 
+//  parser parses again.                                                   
+//
+
+public class AstHandle
+{
+
+    static AstHandle()
+    {
+        Initializer.Initialize();
+    }
+
+    private Parser parser;
+    private long handle;
+
+    internal AstHandle(Parser parser, long handle)
+    {
+        this.parser = parser;
+        this.handle = handle;
+    }
+
+    public int Kind
+    {
+        get { return get_kind(handle); }
+    }
+
+    public long Location
+    {
+        get { return get_location(handle); }
+    }
+
+    public string Lexeme
+    {
+
+        get
+        {
+            object result = null;
+            get_lexeme(handle, ref result);
+            return (string)result;
+        }
+
+    }
+
+    public int NumChildren
+    {
+        get { return get_num_children(handle); }
+    }
+
+    public AstHandle GetChild(int childNum)
+    {
+        return HandleIn(get_child(handle, childNum));
+    }
+
+    public AstHandle [] GetChildren()
+    {
+        return GetChildren(0, NumChildren);
+    }
+
+    public AstHandle [] GetChildren(int first, int count)
+    {
+
+        if (count <= 0)
+        {
+            return new AstHandle[0];
+        }
+
+        long [] handleList = new long[count];
+        count = get_children(handle, first, count, handleList);
+
+        AstHandle [] children = new AstHandle[count];
+        for (int i = 0; i < count; i++)
+        {
+            children[i] = HandleIn(handleList[i]);
+        }
+
+        return children;
+
+    }
+
+    //
+    //  GetSubtree
+    //  ----------
+    //  
+    //  Bring over the subtree at this node as an Ast, the way Parser.GetAst 
+    //  brings over the whole tree.                                          
+    //
+
+    public Ast GetSubtree()
+    {
+
+        object exception = null;
+        object result = null;
+
+        get_subtree(handle, ref exception, ref result);
+    
+        if (exception != null)
+        {
+            throw (Exception)exception;
+        }
+
+        return ((Tuple<Dictionary<string, int>, Ast>)result).Item2;
+
+    }
+
+    private AstHandle HandleIn(long childHandle)
+    {
+
+        if (childHandle == 0)
+        {
+            return null;
+        }
+
+        return new AstHandle(parser, childHandle);
+
+    }
+
+    //
+    //  Declarations of functions in the Hoshi native library. 
+    //
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_AstHandle_get_kind"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern int get_kind(long handle);
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_AstHandle_get_location"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern long get_location(long handle);
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_AstHandle_get_lexeme"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern void get_lexeme(long handle, 
+                                          ref object result);
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_AstHandle_get_num_children"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern int get_num_children(long handle);
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_AstHandle_get_child"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern long get_child(long handle, 
+                                         int childNum);
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_AstHandle_get_children"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern int get_children(long handle, 
+                                           int first, 
+                                           int count, 
+                                           long [] handleList);
+
+    [DllImport("hoshi.dll", ExactSpelling=true,
+               EntryPoint="csc_AstHandle_get_subtree"),
+     SuppressUnmanagedCodeSecurity]
+    private static extern void get_subtree(long handle, 
+                                           ref object exception, 
+                                           ref object result);
+
+}
+
 //
 //  ErrorMessage                                                           
 //  ------------                                                           
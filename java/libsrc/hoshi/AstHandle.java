@@ -0,0 +1,126 @@
+//
+//  AstHandle
+//  ---------
+//
+//  A node of the Ast left in the native library. Each accessor is a call
+//  into the library, so this costs more per node than an Ast but nothing
+//  for the nodes you never look at. getChildren fetches a slice of the
+//  children in one call and getSubtree brings over a whole subtree as an
+//  Ast.
+//
+//  The handle points into the parser's tree, so it is only good until the
+//  parser parses again.
+//
+
+package hoshi;
+
+import java.io.*;
+import java.lang.*;
+import java.util.*;
+import java.nio.*;
+
+public class AstHandle {
+
+    private static final Initializer initializer = Initializer.getInitializer();
+
+    private Parser parser;
+    private long handle;
+
+    AstHandle(Parser parser, long handle) {
+        this.parser = parser;
+        this.handle = handle;
+    }
+
+    public int getKind() {
+        return get_kind(handle);
+    }
+
+    public long getLocation() {
+        return get_location(handle);
+    }
+
+    public String getLexeme() {
+        return get_lexeme(handle);
+    }
+
+    public int getNumChildren() {
+        return get_num_children(handle);
+    }
+
+    public AstHandle getChild(int childNum) {
+        return handleIn(get_child(handle, childNum));
+    }
+
+    public AstHandle [] getChildren() {
+        return getChildren(0, getNumChildren());
+    }
+
+    public AstHandle [] getChildren(int first, int count) {
+
+        if (count <= 0) {
+            return new AstHandle[0];
+        }
+
+        long [] handleList = new long[count];
+        count = get_children(handle, first, count, handleList);
+
+        AstHandle [] children = new AstHandle[count];
+        for (int i = 0; i < count; i++) {
+            children[i] = handleIn(handleList[i]);
+        }
+
+        return children;
+
+    }
+
+    //
+    //  getSubtree
+    //  ----------
+    //
+    //  Bring over the subtree at this node as an Ast, the way Parser.getAst
+    //  brings over the whole tree.
+    //
+
+    public Ast getSubtree() {
+
+        long resultHandle = get_subtree(handle);
+
+        try {
+
+            ByteBuffer buffer = Parser.get_binary_buffer(resultHandle);
+            buffer.order(ByteOrder.LITTLE_ENDIAN);
+
+            return TypeConvert.decodeBinaryAst(buffer, new HashMap<String, Integer>());
+
+        } finally {
+            Parser.delete_binary(resultHandle);
+        }
+
+    }
+
+    private AstHandle handleIn(long childHandle) {
+
+        if (childHandle == 0) {
+            return null;
+        }
+
+        return new AstHandle(parser, childHandle);
+
+    }
+
+    //
+    //  Declarations of functions in the Hoshi native library.
+    //
+
+    private static native int get_kind(long handle);
+    private static native long get_location(long handle);
+    private static native String get_lexeme(long handle);
+    private static native int get_num_children(long handle);
+    private static native long get_child(long handle, int childNum);
+    private static native int get_children(long handle,
+                                           int first,
+                                           int count,
+                                           long [] handleList);
+    private static native long get_subtree(long handle);
+
+}
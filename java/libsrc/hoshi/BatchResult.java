@@ -0,0 +1,70 @@
+//
+//  BatchResult                                                            
+//  -----------                                                            
+//                                                                         
+//  The result of one source from Parser.parseBatch: whether it failed,    
+//  its error messages and its Ast. These are all brought over with the    
+//  batch, so nothing here calls back into the library.                    
+//
+
+package hoshi;
+
+import java.io.*;
+import java.lang.*;
+import java.util.*;
+
+public class BatchResult {
+
+    private static final Initializer initializer = Initializer.getInitializer();
+
+    private boolean sourceFailed;
+    private int errorCount;
+    private int warningCount;
+    private ArrayList<ErrorMessage> errorMessages;
+    private Ast ast;
+
+    BatchResult() {
+        sourceFailed = false;
+        errorCount = 0;
+        warningCount = 0;
+        errorMessages = new ArrayList<ErrorMessage>();
+        ast = null;
+    }
+
+    public boolean isSourceFailed() {
+        return sourceFailed;
+    }
+
+    void setSourceFailed(boolean sourceFailed) {
+        this.sourceFailed = sourceFailed;
+    }
+
+    public int getErrorCount() {
+        return errorCount;
+    }
+
+    void setErrorCount(int errorCount) {
+        this.errorCount = errorCount;
+    }
+
+    public int getWarningCount() {
+        return warningCount;
+    }
+
+    void setWarningCount(int warningCount) {
+        this.warningCount = warningCount;
+    }
+
+    public ArrayList<ErrorMessage> getErrorMessages() {
+        return errorMessages;
+    }
+
+    public Ast getAst() {
+        return ast;
+    }
+
+    void setAst(Ast ast) {
+        this.ast = ast;
+    }
+
+}
@@ -12,6 +12,8 @@ package hoshi;
 import java.io.*;
 import java.lang.*;
 import java.util.*;
+import java.nio.*;
+import java.nio.charset.*;
 
 public class Parser {
 
@@ -166,6 +168,62 @@ public class Parser {
         parse(thisHandle, source, debugFlags);
     }
 
+    //
+    //  parseBatch
+    //  ----------
+    //  
+    //  Parse a list of sources in one call, on numThreads threads or one  
+    //  per core by default. We return a BatchResult for each source, in   
+    //  order. A source with errors doesn't throw an exception, it's marked 
+    //  failed in its result.                                              
+    //
+
+    public BatchResult [] parseBatch(String [] sourceList) {
+        return parseBatch(sourceList, 0);
+    }
+    
+    public BatchResult [] parseBatch(String [] sourceList, long numThreads) {
+
+        byte [][] encodedList = new byte[sourceList.length][];
+        long textSize = 0;
+
+        for (int i = 0; i < sourceList.length; i++) {
+            encodedList[i] = sourceList[i].getBytes(StandardCharsets.UTF_8);
+            textSize += encodedList[i].length;
+        }
+
+        ByteBuffer packed = 
+            ByteBuffer.allocate((int)(8 * (sourceList.length + 2) + textSize));
+        packed.order(ByteOrder.LITTLE_ENDIAN);
+
+        packed.putLong(sourceList.length);
+
+        long sourceStart = 0;
+        packed.putLong(sourceStart);
+        for (byte [] encoded: encodedList) {
+            sourceStart += encoded.length;
+            packed.putLong(sourceStart);
+        }
+
+        for (byte [] encoded: encodedList) {
+            packed.put(encoded);
+        }
+
+        long resultHandle = parse_binary_batch(thisHandle, packed.array(), numThreads);
+
+        try {
+
+            ByteBuffer buffer = get_binary_buffer(resultHandle);
+            buffer.order(ByteOrder.LITTLE_ENDIAN);
+
+            return TypeConvert.decodeBinaryBatch(buffer);
+
+        } finally {
+            delete_binary(resultHandle);
+        }
+
+    }
+
     //
     //  getAst
     //  ------
@@ -177,18 +235,26 @@ public class Parser {
 
         try {
 
-            String marshalled = get_encoded_ast(thisHandle);
-            StringReader reader = new StringReader(marshalled);
-            kindMap = TypeConvert.decodeKindMap(reader);
+            long resultHandle = get_binary_ast(thisHandle);
 
-            kindIMap = new HashMap<Integer, String>();
-            for (String key: kindMap.keySet()) {
-                kindIMap.put(kindMap.get(key), key);
-            }
+            try {
+
+                ByteBuffer buffer = get_binary_buffer(resultHandle);
+                buffer.order(ByteOrder.LITTLE_ENDIAN);
+
+                kindMap = new HashMap<String, Integer>();
+                Ast ast = TypeConvert.decodeBinaryAst(buffer, kindMap);
 
-            Ast ast = TypeConvert.decodeAst(reader);
+                kindIMap = new HashMap<Integer, String>();
+                for (String key: kindMap.keySet()) {
+                    kindIMap.put(kindMap.get(key), key);
+                }
+
+                return ast;
 
-            return ast;
+            } finally {
+                delete_binary(resultHandle);
+            }
 
         } catch (hoshi.UnknownError e) {
             throw e;
@@ -201,6 +267,26 @@ public class Parser {
 
     }
 
+    //
+    //  getAstHandle
+    //  ------------
+    //  
+    //  Return a handle on the root of the native Ast, or null. This is the 
+    //  way to go when you only need to look at part of a large tree.       
+    //
+    
+    public AstHandle getAstHandle() {
+
+        long handle = get_ast_handle(thisHandle);
+
+        if (handle == 0) {
+            return null;
+        }
+
+        return new AstHandle(this, handle);
+
+    }
+
     //
     //  dumpAst
     //  -------
@@ -487,7 +573,14 @@ public class Parser {
     private static native void parse(long thisHandle, 
                                      String source, 
                                      long debugFlags);
+    private static native long parse_binary_batch(long thisHandle, 
+                                                  byte [] packedSources, 
+                                                  long numThreads);
     private static native String get_encoded_ast(long thisHandle);
+    private static native long get_binary_ast(long thisHandle);
+    static native ByteBuffer get_binary_buffer(long resultHandle);
+    static native void delete_binary(long resultHandle);
+    private static native long get_ast_handle(long thisHandle);
     private static native String get_encoded_kind_map(long thisHandle);
     private static native int get_kind(long thisHandle, String kindString);
     private static native int get_kind_force(long thisHandle, 
@@ -11,6 +11,8 @@ package hoshi;
 import java.lang.*;
 import java.util.*;
 import java.io.*;
+import java.nio.*;
+import java.nio.charset.*;
 
 class TypeConvert {
 
@@ -221,6 +223,200 @@ class TypeConvert {
 
     }
 
+    //
+    //  getNarrow                                                         
+    //  ---------                                                         
+    //                                                                    
+    //  One value of an array in the binary Ast, stored in one, two, four 
+    //  or eight bytes.                                                   
+    //
+
+    public static long getNarrow(ByteBuffer buffer, int start, int width, int index) {
+
+        switch (width) {
+            case 1:  return buffer.get(start + index);
+            case 2:  return buffer.getShort(start + 2 * index);
+            case 4:  return buffer.getInt(start + 4 * index);
+            case 8:  return buffer.getLong(start + 8 * index);
+            default: throw new hoshi.UnknownError("Invalid binary Ast");
+        }
+
+    }
+
+    //
+    //  decodeBinaryAst                                                   
+    //  ---------------                                                   
+    //                                                                    
+    //  Build an Ast from the binary form described in FlatAst.cpp. The   
+    //  buffer is a view of the native result, so we read each field in   
+    //  place. We use an explicit stack so a deep tree can't overflow the  
+    //  Java stack.                                                        
+    //
+
+    public static Ast decodeBinaryAst(ByteBuffer buffer, HashMap<String, Integer> kindMap) {
+
+        if (buffer.getInt(0) != 0x54534148 || buffer.getInt(4) != 2) {
+            throw new hoshi.UnknownError("Invalid binary Ast");
+        }
+
+        long kindMapCount = buffer.getLong(8);
+        long kindMapSize = buffer.getLong(16);
+
+        int offset = 24;
+        for (long i = 0; i < kindMapCount; i++) {
+
+            int kind = buffer.getInt(offset);
+            int length = buffer.getInt(offset + 4);
+            byte [] name = new byte[length];
+
+            buffer.position(offset + 8);
+            buffer.get(name);
+            kindMap.put(new String(name, StandardCharsets.UTF_8), kind);
+
+            offset += 8 + length;
+
+        }
+
+        offset = 24 + (int)kindMapSize;
+
+        int nodeCount = (int)buffer.getLong(offset);
+        int kindWidth = buffer.get(offset + 16);
+        int numChildrenWidth = buffer.get(offset + 17);
+        int locationWidth = buffer.get(offset + 18);
+        int lexemeWidth = buffer.get(offset + 19);
+
+        int kindStart = offset + 24;
+        int numChildrenStart = kindStart + ((kindWidth * nodeCount + 7) & ~7);
+        int locationStart = numChildrenStart + ((numChildrenWidth * nodeCount + 7) & ~7);
+        int lexemeStart = locationStart + ((locationWidth * nodeCount + 7) & ~7);
+        int poolStart = lexemeStart + ((lexemeWidth * nodeCount + 7) & ~7);
+
+        Ast root = null;
+        Ast [] stack = new Ast[16];
+        int [] nextChild = new int[16];
+        int depth = 0;
+        int first = 0;
+
+        for (int i = 0; i < nodeCount; i++) {
+
+            Ast ast = null;
+            int kind = (int)getNarrow(buffer, kindStart, kindWidth, i);
+            int length = (int)getNarrow(buffer, lexemeStart, lexemeWidth, i);
+
+            if (kind >= 0) {
+
+                ast = new Ast((int)getNarrow(buffer, numChildrenStart, numChildrenWidth, i));
+                ast.setKind(kind);
+                ast.setLocation(getNarrow(buffer, locationStart, locationWidth, i));
+
+                if (length > 0) {
+                    byte [] lexeme = new byte[length];
+                    buffer.position(poolStart + first);
+                    buffer.get(lexeme);
+                    ast.setLexeme(new String(lexeme, StandardCharsets.UTF_8));
+                }
+
+            }
+
+            first += length;
+
+            if (depth == 0) {
+                root = ast;
+            } else {
+                stack[depth - 1].setChild(nextChild[depth - 1]++, ast);
+            }
+
+            if (ast != null && ast.getChildren().length > 0) {
+
+                if (depth == stack.length) {
+                    stack = Arrays.copyOf(stack, depth * 2);
+                    nextChild = Arrays.copyOf(nextChild, depth * 2);
+                }
+
+                stack[depth] = ast;
+                nextChild[depth] = 0;
+                depth++;
+
+            }
+
+            while (depth > 0 && nextChild[depth - 1] == stack[depth - 1].getChildren().length) {
+                depth--;
+            }
+
+        }
+
+        return root;
+
+    }
+
+    //
+    //  decodeBinaryBatch                                                 
+    //  -----------------                                                 
+    //                                                                    
+    //  Unpack the results of Parser.parseBatch, in the form described in 
+    //  ParserImpl.cpp. The buffer is a view of the native result, which  
+    //  is freed when we're done, so we decode every source here.         
+    //
+
+    public static BatchResult [] decodeBinaryBatch(ByteBuffer buffer) {
+
+        if (buffer.getInt(0) != 0x54414248 || buffer.getInt(4) != 1) {
+            throw new hoshi.UnknownError("Invalid binary batch");
+        }
+
+        int count = (int)buffer.getLong(8);
+        BatchResult [] results = new BatchResult[count];
+
+        for (int i = 0; i < count; i++) {
+
+            int offset = (int)buffer.getLong(16 + 8 * i);
+
+            BatchResult result = new BatchResult();
+            result.setSourceFailed(buffer.getInt(offset) != 0);
+            result.setErrorCount(buffer.getInt(offset + 4));
+            result.setWarningCount(buffer.getInt(offset + 8));
+
+            int messagesSize = (int)buffer.getLong(offset + 16);
+            int astSize = (int)buffer.getLong(offset + 24);
+            offset += 32;
+
+            if (messagesSize > 0) {
+
+                byte [] messages = new byte[messagesSize];
+                buffer.position(offset);
+                buffer.get(messages);
+
+                StringReader reader = 
+                    new StringReader(new String(messages, StandardCharsets.UTF_8));
+
+                int size = (int)decodeLong(reader);
+                while (size-- > 0) {
+                    result.getErrorMessages().add(decodeErrorMessage(reader));
+                }
+
+            }
+
+            offset += (messagesSize + 7) & ~7;
+
+            if (astSize > 0) {
+
+                buffer.position(offset);
+                ByteBuffer astBuffer = buffer.slice();
+                astBuffer.limit(astSize);
+                astBuffer.order(ByteOrder.LITTLE_ENDIAN);
+
+                result.setAst(decodeBinaryAst(astBuffer, new HashMap<String, Integer>()));
+
+            }
+
+            results[i] = result;
+
+        }
+
+        return results;
+
+    }
+
     //
     //  decodeErrorMessage
     //  ------------------                    
@@ -101,7 +101,9 @@ module Hoshi
         is_source_failed::Function
         generate::Function
         parse::Function
+        parse_batch::Function
         get_ast::Function
+        get_ast_handle::Function
         get_encoded_ast::Function
         dump_ast::Function
         copy_kind_map::Function
@@ -354,6 +356,84 @@ module Hoshi
                 
             end
         
+            #
+            #  parse_batch
+            #  -----------
+            #  
+            #  Parse a list of sources in one call, on num_threads threads or  
+            #  one per core by default. We return a BatchResult for each       
+            #  source, in order. A source with errors doesn't throw an         
+            #  exception, it's marked failed in its result.                    
+            #
+        
+            this.parse_batch = function(source_list::Array, args...)
+                
+                if length(args) > 1
+                    throw(ArgumentError("Too many arguments for Hoshi.parse_batch"))
+                end
+                
+                num_threads::Int64 = 0
+                
+                if length(args) > 0
+                    if isa(args[1], Int64)
+                        num_threads = args[1]
+                    else
+                        throw(ArgumentError("Invalid type for num_threads in Hoshi.parse_batch"))
+                    end
+                end
+                
+                packed = IOBuffer()
+                write(packed, convert(Int64, length(source_list)))
+
+                source_start::Int64 = 0
+                write(packed, source_start)
+                for source in source_list
+                    source_start += sizeof(source)
+                    write(packed, source_start)
+                end
+
+                for source in source_list
+                    write(packed, source)
+                end
+
+                packed_sources = takebuf_array(packed)
+
+                exception_ptr = Array(Cptrdiff_t, 1)
+                exception_handle = convert(Ptr{Cptrdiff_t}, exception_ptr)
+                
+                result_ptr = Array(Cptrdiff_t, 1)
+                result_handle = convert(Ptr{Cptrdiff_t}, result_ptr)
+                
+                ccall((:jl_parser_parse_binary_batch, "libhoshi"),
+                      Void,
+                      (Ptr{Void}, Ptr{Cptrdiff_t}, Ptr{Uint8}, Int64, Int64, Ptr{Cptrdiff_t}),
+                      this.this_ptr, 
+                      exception_handle, 
+                      packed_sources, 
+                      length(packed_sources), 
+                      num_threads, 
+                      result_handle)
+                
+                check_exceptions(exception_handle)
+                
+                size_ptr = Array(Int64, 1)
+                data = ccall((:jl_get_string_data, "libhoshi"),
+                             Ptr{Uint8},
+                             (Ptr{Cptrdiff_t}, Ptr{Int64}),
+                             result_handle,
+                             convert(Ptr{Int64}, size_ptr))
+
+                try
+                    return decode_binary_batch(data, size_ptr[1])
+                finally
+                    ccall((:jl_delete_string, "libhoshi"),
+                          Void,
+                          (Ptr{Cptrdiff_t},),
+                          result_handle)
+                end
+                
+            end
+        
             #
             #  get_ast
             #  -------
@@ -363,11 +443,67 @@ module Hoshi
             
             this.get_ast = function()
         
-                marshalled::String = this.get_encoded_ast()
-                (kind_map, tail_ptr) = decode_kind_map(marshalled, 1)
-                (ast, tail_ptr) = decode_ast(kind_map, marshalled, tail_ptr)
+                exception_ptr = Array(Cptrdiff_t, 1)
+                exception_handle = convert(Ptr{Cptrdiff_t}, exception_ptr)
+                
+                result_ptr = Array(Cptrdiff_t, 1)
+                result_handle = convert(Ptr{Cptrdiff_t}, result_ptr)
+                
+                ccall((:jl_parser_get_binary_ast, "libhoshi"),
+                      Void,
+                      (Ptr{Void}, Ptr{Cptrdiff_t}, Ptr{Cptrdiff_t}),
+                      this.this_ptr, 
+                      exception_handle, 
+                      result_handle)
+                
+                check_exceptions(exception_handle)
+                
+                size_ptr = Array(Int64, 1)
+                data = ccall((:jl_get_string_data, "libhoshi"),
+                             Ptr{Uint8},
+                             (Ptr{Cptrdiff_t}, Ptr{Int64}),
+                             result_handle,
+                             convert(Ptr{Int64}, size_ptr))
+
+                try
+                    (kind_map, ast) = decode_binary_ast(data, size_ptr[1])
+                    return ast
+                finally
+                    ccall((:jl_delete_string, "libhoshi"),
+                          Void,
+                          (Ptr{Cptrdiff_t},),
+                          result_handle)
+                end
+        
+            end
+        
+            #
+            #  get_ast_handle
+            #  --------------
+            #  
+            #  Return a handle on the root of the native Ast, or nothing. This 
+            #  is the way to go when you only need to look at part of a large 
+            #  tree.                                                           
+            #
+            
+            this.get_ast_handle = function()
         
-                return ast
+                exception_ptr = Array(Cptrdiff_t, 1)
+                exception_handle = convert(Ptr{Cptrdiff_t}, exception_ptr)
+                
+                handle = ccall((:jl_parser_get_ast_handle, "libhoshi"),
+                               Int64,
+                               (Ptr{Void}, Ptr{Cptrdiff_t}),
+                               this.this_ptr, 
+                               exception_handle)
+                
+                check_exceptions(exception_handle)
+                
+                if handle == 0
+                    return nothing
+                end
+
+                return AstHandle(this, handle)
         
             end
         
@@ -670,19 +806,7 @@ module Hoshi
             
             this.get_error_messages = function()
         
-                marshalled::String = this.get_encoded_error_messages()
-        
-                (len, tail_ptr) = decode_int(marshalled, 1)
-                messages = Array(ErrorMessage, 0)
-                sizehint(messages, len)
-        
-                while len > 0
-                    (message, tail_ptr) = decode_error_message(marshalled, tail_ptr)
-                    push!(messages, message)
-                    len -= 1
-                end
-        
-                return messages
+                return decode_error_messages(this.get_encoded_error_messages())
         
             end
         
@@ -877,6 +1001,191 @@ module Hoshi
 
     end
 
+    #
+    #  AstHandle                                                              
+    #  ---------                                                              
+    #                                                                         
+    #  A node of the Ast left in the native library. Each accessor is a call  
+    #  into the library, so this costs more per node than an Ast but nothing  
+    #  for the nodes you never look at. get_children fetches a slice of the   
+    #  children in one call and get_subtree brings over a whole subtree as an 
+    #  Ast.                                                                   
+    #                                                                         
+    #  The handle points into the parser's tree, so it is only good until the 
+    #  parser parses again.                                                   
+    #
+
+    export AstHandle
+    type AstHandle
+
+        #
+        #  Instance variables. 
+        #
+
+        parser::Parser
+        handle::Int64
+
+        #
+        #  Member function variables. 
+        #
+
+        get_kind::Function
+        get_location::Function
+        get_lexeme::Function
+        get_num_children::Function
+        get_child::Function
+        get_children::Function
+        get_subtree::Function
+
+        #
+        #  Internal constructor. 
+        #
+
+        function AstHandle(parser::Parser, handle::Int64)
+
+            this = new()
+
+            this.parser = parser
+            this.handle = handle
+
+            this.get_kind = function()
+                return ccall((:jl_ast_get_kind, "libhoshi"),
+                             Int32,
+                             (Int64,),
+                             this.handle)
+            end
+
+            this.get_location = function()
+                return ccall((:jl_ast_get_location, "libhoshi"),
+                             Int64,
+                             (Int64,),
+                             this.handle)
+            end
+
+            this.get_lexeme = function()
+
+                result_ptr = Array(Cptrdiff_t, 1)
+                result_handle = convert(Ptr{Cptrdiff_t}, result_ptr)
+
+                ccall((:jl_ast_get_lexeme, "libhoshi"),
+                      Void,
+                      (Int64, Ptr{Cptrdiff_t}),
+                      this.handle,
+                      result_handle)
+
+                return string_result_in(result_handle)
+
+            end
+
+            this.get_num_children = function()
+                return ccall((:jl_ast_get_num_children, "libhoshi"),
+                             Int32,
+                             (Int64,),
+                             this.handle)
+            end
+
+            this.get_child = function(num::Integer)
+
+                handle = ccall((:jl_ast_get_child, "libhoshi"),
+                               Int64,
+                               (Int64, Int32),
+                               this.handle,
+                               num)
+
+                if handle == 0
+                    return nothing
+                end
+
+                return AstHandle(this.parser, handle)
+
+            end
+
+            #
+            #  get_children
+            #  ------------
+            #  
+            #  Return a slice of the children, by default all of them, in one 
+            #  call. Null children come back as nothing.                       
+            #
+
+            this.get_children = function(args...)
+
+                first_child = length(args) > 0 ? args[1] : 0
+                child_count = length(args) > 1 ? args[2] : this.get_num_children() - first_child
+
+                if child_count <= 0
+                    return Array(Any, 0)
+                end
+
+                handle_list = Array(Int64, child_count)
+
+                child_count = ccall((:jl_ast_get_children, "libhoshi"),
+                              Int32,
+                              (Int64, Int32, Int32, Ptr{Int64}),
+                              this.handle,
+                              first_child,
+                              child_count,
+                              convert(Ptr{Int64}, handle_list))
+
+                children = Array(Any, child_count)
+                for i = 1:child_count
+                    children[i] = handle_list[i] == 0 ? nothing : AstHandle(this.parser, handle_list[i])
+                end
+
+                return children
+
+            end
+
+            #
+            #  get_subtree
+            #  -----------
+            #  
+            #  Bring over the subtree at this node as an Ast, the way get_ast 
+            #  brings over the whole tree.                                    
+            #
+
+            this.get_subtree = function()
+
+                exception_ptr = Array(Cptrdiff_t, 1)
+                exception_handle = convert(Ptr{Cptrdiff_t}, exception_ptr)
+                
+                result_ptr = Array(Cptrdiff_t, 1)
+                result_handle = convert(Ptr{Cptrdiff_t}, result_ptr)
+                
+                ccall((:jl_ast_get_subtree, "libhoshi"),
+                      Void,
+                      (Int64, Ptr{Cptrdiff_t}, Ptr{Cptrdiff_t}),
+                      this.handle, 
+                      exception_handle, 
+                      result_handle)
+                
+                check_exceptions(exception_handle)
+                
+                size_ptr = Array(Int64, 1)
+                data = ccall((:jl_get_string_data, "libhoshi"),
+                             Ptr{Uint8},
+                             (Ptr{Cptrdiff_t}, Ptr{Int64}),
+                             result_handle,
+                             convert(Ptr{Int64}, size_ptr))
+
+                try
+                    (kind_map, ast) = decode_binary_ast(data, size_ptr[1])
+                    return ast
+                finally
+                    ccall((:jl_delete_string, "libhoshi"),
+                          Void,
+                          (Ptr{Cptrdiff_t},),
+                          result_handle)
+                end
+
+            end
+
+            return this
+
+        end
+
+    end
+
     #
     #  ErrorType                                                               
     #  ----------                                                              
@@ -953,6 +1262,47 @@ module Hoshi
 
     end
 
+    #
+    #  BatchResult                                                            
+    #  -----------                                                            
+    #                                                                         
+    #  The result of one source from parse_batch: whether it failed, its      
+    #  error messages and its Ast.                                            
+    #
+
+    export BatchResult
+    type BatchResult
+
+        #
+        #  Instance variables. 
+        #
+
+        source_failed::Bool
+        error_count::Int32
+        warning_count::Int32
+        error_messages::Array{ErrorMessage, 1}
+        ast::Any
+
+        #
+        #  Internal constructor. 
+        #
+
+        function BatchResult()
+
+            this = new()
+
+            this.source_failed = false
+            this.error_count = 0
+            this.warning_count = 0
+            this.error_messages = Array(ErrorMessage, 0)
+            this.ast = nothing
+
+            return this
+
+        end
+
+    end
+
     #
     #  string_out                                           
     #  ----------                                           
@@ -1189,6 +1539,110 @@ module Hoshi
 
     end
 
+    #
+    #  decode_binary_ast
+    #  -----------------
+    #                                                                
+    #  Build an Ast from the binary form described in FlatAst.cpp. We view 
+    #  the arrays in place in the native result, and build the tree with  
+    #  an explicit stack so a deep tree can't overflow the julia stack. A 
+    #  null child is left undefined.                                      
+    #
+
+    function binary_narrow_array(data::Ptr{Uint8}, tail_ptr, width, count)
+
+        element_type = width == 1 ? Int8 :
+                       width == 2 ? Int16 :
+                       width == 4 ? Int32 :
+                       width == 8 ? Int64 :
+                       throw(UnknownError("Invalid binary Ast"))
+
+        result = pointer_to_array(convert(Ptr{element_type}, data + tail_ptr), count)
+
+        return (result, (tail_ptr + width * count + 7) & ~7)
+
+    end
+
+    function decode_binary_ast(data::Ptr{Uint8}, size::Int64)
+
+        if size < 24 ||
+           unsafe_load(convert(Ptr{Int32}, data)) != 0x54534148 ||
+           unsafe_load(convert(Ptr{Int32}, data + 4)) != 2
+            throw(UnknownError("Invalid binary Ast"))
+        end
+
+        kind_map_count = unsafe_load(convert(Ptr{Int64}, data + 8))
+        kind_map_size = unsafe_load(convert(Ptr{Int64}, data + 16))
+
+        kind_map = Dict{String, Int32}()
+        tail_ptr = 24
+        for i in 1:kind_map_count
+            num = unsafe_load(convert(Ptr{Int32}, data + tail_ptr))
+            name_length = unsafe_load(convert(Ptr{Int32}, data + tail_ptr + 4))
+            kind_map[bytestring(data + tail_ptr + 8, name_length)] = num
+            tail_ptr += 8 + name_length
+        end
+
+        tail_ptr = 24 + kind_map_size
+        node_count = unsafe_load(convert(Ptr{Int64}, data + tail_ptr))
+        width_list = pointer_to_array(convert(Ptr{Int8}, data + tail_ptr + 16), 4)
+        tail_ptr += 24
+
+        (kind_list, tail_ptr) = binary_narrow_array(data, tail_ptr, width_list[1], node_count)
+        (num_children_list, tail_ptr) = binary_narrow_array(data, tail_ptr, width_list[2], node_count)
+        (location_list, tail_ptr) = binary_narrow_array(data, tail_ptr, width_list[3], node_count)
+        (lexeme_length_list, tail_ptr) = binary_narrow_array(data, tail_ptr, width_list[4], node_count)
+        pool = data + tail_ptr
+
+        root = nothing
+        stack = Ast[]
+        next_child = Int[]
+        lexeme_start = 0
+
+        for i in 1:node_count
+
+            ast = nothing
+
+            if kind_list[i] >= 0
+
+                ast = Ast()
+                ast.kind = kind_list[i]
+                ast.location = location_list[i]
+                ast.children = Array(Ast, num_children_list[i])
+
+                if lexeme_length_list[i] > 0
+                    ast.lexeme = bytestring(pool + lexeme_start, lexeme_length_list[i])
+                end
+
+            end
+
+            lexeme_start += lexeme_length_list[i]
+
+            if length(stack) == 0
+                root = ast
+            else
+                if ast != nothing
+                    stack[end].children[next_child[end] + 1] = ast
+                end
+                next_child[end] += 1
+            end
+
+            if ast != nothing && length(ast.children) > 0
+                push!(stack, ast)
+                push!(next_child, 0)
+            end
+
+            while length(stack) > 0 && next_child[end] == length(stack[end].children)
+                pop!(stack)
+                pop!(next_child)
+            end
+
+        end
+
+        return (kind_map, root)
+
+    end
+
     function decode_error_message(marshalled::String, tail_ptr)
 
         message = ErrorMessage()
@@ -1208,6 +1662,73 @@ module Hoshi
 
     end
 
+    function decode_error_messages(marshalled::String)
+
+        (len, tail_ptr) = decode_int(marshalled, 1)
+        messages = Array(ErrorMessage, 0)
+        sizehint(messages, len)
+
+        while len > 0
+            (message, tail_ptr) = decode_error_message(marshalled, tail_ptr)
+            push!(messages, message)
+            len -= 1
+        end
+
+        return messages
+
+    end
+
+    #
+    #  decode_binary_batch                                             
+    #  -------------------                                             
+    #                                                                  
+    #  Unpack the results of parse_batch, in the form described in     
+    #  ParserImpl.cpp. The native buffer is freed when we return, so   
+    #  we decode the messages and trees of every source here.          
+    #
+
+    function decode_binary_batch(data::Ptr{Uint8}, size::Int64)
+
+        if size < 16 ||
+           unsafe_load(convert(Ptr{Int32}, data)) != 0x54414248 ||
+           unsafe_load(convert(Ptr{Int32}, data + 4)) != 1
+            throw(UnknownError("Invalid binary batch"))
+        end
+
+        count = unsafe_load(convert(Ptr{Int64}, data + 8))
+        result_start_list = pointer_to_array(convert(Ptr{Int64}, data + 16), count + 1)
+
+        results = Array(BatchResult, count)
+
+        for i in 1:count
+
+            record = data + result_start_list[i]
+
+            result = BatchResult()
+            result.source_failed = unsafe_load(convert(Ptr{Int32}, record)) != 0
+            result.error_count = unsafe_load(convert(Ptr{Int32}, record + 4))
+            result.warning_count = unsafe_load(convert(Ptr{Int32}, record + 8))
+
+            messages_size = unsafe_load(convert(Ptr{Int64}, record + 16))
+            ast_size = unsafe_load(convert(Ptr{Int64}, record + 24))
+
+            if messages_size > 0
+                result.error_messages = decode_error_messages(bytestring(record + 32, messages_size))
+            end
+
+            if ast_size > 0
+                (kind_map, result.ast) = 
+                    decode_binary_ast(record + 32 + ((messages_size + 7) & ~7), ast_size)
+            end
+
+            results[i] = result
+
+        end
+
+        return results
+
+    end
+
 end
 
 
@@ -9,6 +9,9 @@
 from ctypes import *
 import os
 import os.path
+import sys
+import struct
+import array
 
 #
 #  Setup the search path for the .dll. I'm not sure what the acceptable    
@@ -32,6 +35,9 @@ HOSHI.py_get_exception_string.argtypes = [c_void_p, c_char_p]
 HOSHI.py_get_string_length.restype = c_int64
 HOSHI.py_get_string_length.argtypes = [c_void_p]
 HOSHI.py_get_string_string.argtypes = [c_void_p, c_char_p]
+HOSHI.py_get_string_data.restype = c_void_p
+HOSHI.py_get_string_data.argtypes = [c_void_p, c_void_p]
+HOSHI.py_delete_string.argtypes = [c_void_p]
 HOSHI.py_parser_new_parser.restype = c_int64
 HOSHI.py_parser_clone_parser.restype = c_int64
 HOSHI.py_parser_clone_parser.argtypes = [c_int64]
@@ -50,7 +56,23 @@ HOSHI.py_parser_generate.argtypes = [c_int64,
                                      c_char_p, 
                                      c_int64]
 HOSHI.py_parser_parse.argtypes = [c_int64, c_void_p, c_char_p, c_int64]
+HOSHI.py_parser_parse_binary_batch.argtypes = [c_int64, c_void_p, c_char_p, c_int64, c_int64, c_void_p]
 HOSHI.py_parser_get_encoded_ast.argtypes = [c_int64, c_void_p, c_void_p]
+HOSHI.py_parser_get_binary_ast.argtypes = [c_int64, c_void_p, c_void_p]
+HOSHI.py_parser_get_ast_handle.restype = c_int64
+HOSHI.py_parser_get_ast_handle.argtypes = [c_int64, c_void_p]
+HOSHI.py_ast_get_kind.restype = c_int
+HOSHI.py_ast_get_kind.argtypes = [c_int64]
+HOSHI.py_ast_get_location.restype = c_int64
+HOSHI.py_ast_get_location.argtypes = [c_int64]
+HOSHI.py_ast_get_num_children.restype = c_int
+HOSHI.py_ast_get_num_children.argtypes = [c_int64]
+HOSHI.py_ast_get_lexeme.argtypes = [c_int64, c_void_p]
+HOSHI.py_ast_get_child.restype = c_int64
+HOSHI.py_ast_get_child.argtypes = [c_int64, c_int]
+HOSHI.py_ast_get_children.restype = c_int
+HOSHI.py_ast_get_children.argtypes = [c_int64, c_int, c_int, c_void_p]
+HOSHI.py_ast_get_subtree.argtypes = [c_int64, c_void_p, c_void_p]
 HOSHI.py_parser_get_encoded_kind_map.argtypes = [c_int64, c_void_p, c_void_p]
 HOSHI.py_parser_get_kind.restype = c_int
 HOSHI.py_parser_get_kind.argtypes = [c_int64, c_void_p, c_char_p]
@@ -239,6 +261,35 @@ def string_result_in(result_ptr):
     except:
         return ""
     
+#
+#  binary_result_in                                                   
+#  ----------------
+#                                                                      
+#  Wrap the returned value for a binary string in a memoryview without 
+#  copying it. The native string is deleted when the last view of it   
+#  goes away.                                                          
+#
+
+class BinaryResult:
+
+    def __init__(self, result_ptr):
+        self.result_ptr = result_ptr
+
+    def __del__(self):
+        HOSHI.py_delete_string(byref(self.result_ptr))
+
+def binary_result_in(result_ptr):
+
+    size = c_int64(0)
+    address = HOSHI.py_get_string_data(byref(result_ptr), byref(size))
+    if address is None or size.value == 0:
+        return memoryview(b"")
+
+    buf = (c_char * size.value).from_address(address)
+    buf.owner = BinaryResult(result_ptr)
+
+    return memoryview(buf).cast('B')
+
 #
 #  kind_map_out
 #  ------------
@@ -377,6 +428,98 @@ def decode_ast(kind_map, marshalled, tail_ptr):
 
     return (root, tail_ptr)
 
+#
+#  decode_binary_ast                                                     
+#  -----------------                                                     
+#                                                                        
+#  Build an Ast from the binary form described in FlatAst.cpp. We view   
+#  each array in place, and build the tree with an explicit stack so a   
+#  deep tree can't exceed the recursion limit.                           
+#
+
+binary_width_code = { 1: 'b', 2: 'h', 4: 'i', 8: 'q' }
+
+def binary_array(view, offset, code, count):
+
+    size = count * struct.calcsize(code)
+
+    if sys.byteorder == 'little':
+        return (view[offset:offset + size].cast(code), offset + size)
+
+    result = array.array(code)
+    result.frombytes(view[offset:offset + size])
+    result.byteswap()
+
+    return (result, offset + size)
+
+def binary_narrow_array(view, offset, width, count):
+
+    if width not in binary_width_code:
+        raise UnknownError("Invalid binary Ast")
+
+    (result, offset) = binary_array(view, offset, binary_width_code[width], count)
+
+    return (result, (offset + 7) & ~7)
+
+def decode_binary_ast(view):
+
+    (magic, version, kind_map_count, kind_map_size) = struct.unpack_from('<4siqq', view, 0)
+    if magic != b'HAST' or version != 2:
+        raise UnknownError("Invalid binary Ast")
+
+    kind_map = dict()
+    tail_ptr = 24
+    for i in range(0, kind_map_count):
+        (num, length) = struct.unpack_from('<ii', view, tail_ptr)
+        kind_map[str(view[tail_ptr + 8:tail_ptr + 8 + length], "utf-8")] = num
+        tail_ptr += 8 + length
+
+    tail_ptr = 24 + kind_map_size
+    (node_count, pool_size) = struct.unpack_from('<qq', view, tail_ptr)
+    width_list = struct.unpack_from('<4b', view, tail_ptr + 16)
+    tail_ptr += 24
+
+    (kind_list, tail_ptr) = binary_narrow_array(view, tail_ptr, width_list[0], node_count)
+    (num_children_list, tail_ptr) = binary_narrow_array(view, tail_ptr, width_list[1], node_count)
+    (location_list, tail_ptr) = binary_narrow_array(view, tail_ptr, width_list[2], node_count)
+    (lexeme_length_list, tail_ptr) = binary_narrow_array(view, tail_ptr, width_list[3], node_count)
+    pool = view[tail_ptr:tail_ptr + pool_size]
+
+    root = None
+    stack = []
+    lexeme_start = 0
+
+    for i in range(0, node_count):
+
+        ast = None
+
+        if kind_list[i] >= 0:
+
+            ast = Ast()
+            ast.kind = kind_list[i]
+            ast.location = location_list[i]
+            ast.children = [None] * num_children_list[i]
+
+            if lexeme_length_list[i] > 0:
+                ast.lexeme = str(pool[lexeme_start:lexeme_start + lexeme_length_list[i]], "utf-8")
+
+        lexeme_start += lexeme_length_list[i]
+
+        if len(stack) == 0:
+            root = ast
+        else:
+            top = stack[-1]
+            top[0].children[top[1]] = ast
+            top[1] += 1
+
+        if ast is not None and len(ast.children) > 0:
+            stack.append([ast, 0])
+
+        while len(stack) > 0 and stack[-1][1] == len(stack[-1][0].children):
+            stack.pop()
+
+    return (kind_map, root)
+
 def decode_error_message(marshalled, tail_ptr):
 
     message = ErrorMessage()
@@ -411,7 +554,52 @@ def decode_error_message(marshalled, tail_ptr):
     (string, tail_ptr) = decode_string(marshalled, tail_ptr)
     message.set_string(string)
 
-    return message
+    return (message, tail_ptr)
+
+def decode_error_messages(marshalled):
+
+    (length, tail_ptr) = decode_int(marshalled, 0)
+    messages = []
+
+    while length > 0:
+        (message, tail_ptr) = decode_error_message(marshalled, tail_ptr)
+        messages.append(message)
+        length -= 1
+
+    return messages
+
+def decode_binary_batch(view):
+
+    (magic, version, count) = struct.unpack_from('<4siq', view, 0)
+    if magic != b'HBAT' or version != 1:
+        raise UnknownError("Invalid binary batch")
+
+    (result_start_list, tail_ptr) = binary_array(view, 16, 'q', count + 1)
+    results = []
+
+    for i in range(0, count):
+
+        tail_ptr = result_start_list[i]
+        (failed, error_count, warning_count, unused, messages_size, ast_size) = \
+            struct.unpack_from('<iiiiqq', view, tail_ptr)
+        tail_ptr += 32
+
+        result = BatchResult()
+        result.source_failed = failed != 0
+        result.error_count = error_count
+        result.warning_count = warning_count
+
+        if messages_size > 0:
+            result.error_messages_view = view[tail_ptr:tail_ptr + messages_size]
+
+        tail_ptr += (messages_size + 7) & ~7
+
+        if ast_size > 0:
+            result.ast_view = view[tail_ptr:tail_ptr + ast_size]
+
+        results.append(result)
+
+    return results
 
 #
 #  Parser                         
@@ -580,6 +768,44 @@ class Parser:
         
         check_exceptions(exception_ptr)
         
+    #
+    #  parse_batch
+    #  -----------
+    #  
+    #  Parse a list of sources in one call, on num_threads threads or one  
+    #  per core by default. We return a BatchResult for each source, in    
+    #  order. A source with errors doesn't raise an exception, it's marked 
+    #  failed in its result.                                               
+    #
+
+    def parse_batch(self, source_list, num_threads = 0):
+
+        encoded_list = [source.encode("utf-8") for source in source_list]
+
+        source_start_list = array.array('q', [0] * (len(encoded_list) + 1))
+        for i in range(0, len(encoded_list)):
+            source_start_list[i + 1] = source_start_list[i] + len(encoded_list[i])
+
+        if sys.byteorder != 'little':
+            source_start_list.byteswap()
+
+        packed_sources = b"".join([struct.pack('<q', len(encoded_list)),
+                                   source_start_list.tobytes()] + encoded_list)
+
+        exception_ptr = c_void_p(None)
+        result_ptr = c_void_p(None)
+        
+        HOSHI.py_parser_parse_binary_batch(parser_handle_out(self.this_handle), 
+                                           byref(exception_ptr), 
+                                           packed_sources, 
+                                           int64_out(len(packed_sources)), 
+                                           int64_out(num_threads), 
+                                           byref(result_ptr))
+        
+        check_exceptions(exception_ptr)
+        
+        return decode_binary_batch(binary_result_in(result_ptr))
+
     #
     #  get_ast
     #  -------
@@ -590,13 +816,12 @@ class Parser:
     def get_ast(self):
 
         try:
-            marshalled = self.get_encoded_ast()
+            view = self.get_binary_ast()
         except Exception as e:
             print(str(e))
             return None
 
-        (kind_map, tail_ptr) = decode_kind_map(marshalled, 0)
-        (ast, tail_ptr) = decode_ast(kind_map, marshalled, tail_ptr)
+        (kind_map, ast) = decode_binary_ast(view)
 
         return ast
 
@@ -621,6 +846,49 @@ class Parser:
         
         return string_result_in(result_ptr)
         
+    #
+    #  get_binary_ast
+    #  --------------
+    #  
+    #  Return the Ast in the binary form described in FlatAst.cpp, as a 
+    #  memoryview on the native result. Nothing is copied.
+    #
+
+    def get_binary_ast(self):
+        
+        exception_ptr = c_void_p(None)
+        result_ptr = c_void_p(None)
+        
+        HOSHI.py_parser_get_binary_ast(parser_handle_out(self.this_handle), 
+                                       byref(exception_ptr), 
+                                       byref(result_ptr))
+        
+        check_exceptions(exception_ptr)
+        
+        return binary_result_in(result_ptr)
+        
+    #
+    #  get_ast_handle
+    #  --------------
+    #  
+    #  Return a handle on the root of the native Ast, or None. This is the 
+    #  way to go when you only need to look at part of a large tree.       
+    #
+
+    def get_ast_handle(self):
+        
+        exception_ptr = c_void_p(None)
+        
+        handle = HOSHI.py_parser_get_ast_handle(parser_handle_out(self.this_handle), 
+                                                byref(exception_ptr))
+        
+        check_exceptions(exception_ptr)
+        
+        if handle == 0:
+            return None
+
+        return AstHandle(self, handle)
+        
     #
     #  dump_ast
     #  --------
@@ -825,15 +1093,7 @@ class Parser:
             print(str(e))
             return []
 
-        (length, tail_ptr) = decode_int(marshalled, 0)
-        messages = []
-
-        while length > 0:
-            (message, tail_ptr) = decode_error_message(marshalled, tail_ptr)
-            messages.append(message)
-            length -= 1
-
-        return messages
+        return decode_error_messages(marshalled)
 
     #
     #  get_encoded_error_messages
@@ -981,6 +1241,120 @@ class Ast:
             self.children.append(None)
         self.children[num] = child
 
+#
+#  AstHandle                                                              
+#  ---------                                                              
+#                                                                         
+#  A node of the Ast left in the native library. Each accessor is a call  
+#  into the library, so this costs more per node than an Ast but nothing 
+#  for the nodes you never look at. get_children fetches a slice of the   
+#  children in one call and get_subtree brings over a whole subtree as an 
+#  Ast.                                                                   
+#                                                                         
+#  The handle points into the parser's tree, so it is only good until the 
+#  parser parses again.                                                   
+#
+
+class AstHandle:
+
+    def __init__(self, parser, handle):
+        self.parser = parser
+        self.handle = handle
+
+    def get_kind(self):
+        return HOSHI.py_ast_get_kind(self.handle)
+
+    def get_location(self):
+        return HOSHI.py_ast_get_location(self.handle)
+
+    def get_lexeme(self):
+        result_ptr = c_void_p(None)
+        HOSHI.py_ast_get_lexeme(self.handle, byref(result_ptr))
+        return string_result_in(result_ptr)
+
+    def get_num_children(self):
+        return HOSHI.py_ast_get_num_children(self.handle)
+
+    def get_child(self, num):
+        handle = HOSHI.py_ast_get_child(self.handle, num)
+        if handle == 0:
+            return None
+        return AstHandle(self.parser, handle)
+
+    def get_children(self, first = 0, count = None):
+
+        if count is None:
+            count = self.get_num_children() - first
+
+        if count <= 0:
+            return []
+
+        handle_list = (c_int64 * count)()
+        count = HOSHI.py_ast_get_children(self.handle, first, count, handle_list)
+
+        return [None if handle_list[i] == 0 else AstHandle(self.parser, handle_list[i])
+                for i in range(0, count)]
+
+    def get_subtree(self):
+
+        exception_ptr = c_void_p(None)
+        result_ptr = c_void_p(None)
+
+        HOSHI.py_ast_get_subtree(self.handle, byref(exception_ptr), byref(result_ptr))
+
+        check_exceptions(exception_ptr)
+
+        (kind_map, ast) = decode_binary_ast(binary_result_in(result_ptr))
+
+        return ast
+
+#
+#  BatchResult                                                            
+#  -----------                                                            
+#                                                                         
+#  The result of one source from Parser.parse_batch: whether it failed,   
+#  its error messages and its Ast. These are all brought over with the    
+#  batch, so nothing here calls back into the library. We only decode    
+#  the messages and the Ast the first time they're asked for, so a job   
+#  that just wants to know which sources failed doesn't pay for them.     
+#
+
+class BatchResult:
+
+    def __init__(self):
+        self.source_failed = False
+        self.error_count = 0
+        self.warning_count = 0
+        self.error_messages = []
+        self.error_messages_view = None
+        self.ast = None
+        self.ast_view = None
+
+    def is_source_failed(self):
+        return self.source_failed
+
+    def get_error_count(self):
+        return self.error_count
+
+    def get_warning_count(self):
+        return self.warning_count
+
+    def get_error_messages(self):
+
+        if self.error_messages_view is not None:
+            self.error_messages = decode_error_messages(str(self.error_messages_view, "utf-8"))
+            self.error_messages_view = None
+
+        return self.error_messages
+
+    def get_ast(self):
+
+        if self.ast_view is not None:
+            (kind_map, self.ast) = decode_binary_ast(self.ast_view)
+            self.ast_view = None
+
+        return self.ast
+
 #
 #  ErrorMessage                                                           
 #  ------------                                                           
@@ -0,0 +1,206 @@
+import Hoshi
+import time
+
+GRAMMAR = '''
+//
+//  Procedures Grammar
+//  ------------------
+//
+//  A small procedural language, just enough to build a large tree.
+//
+
+tokens
+
+    <identifier>   : regex = \'\'\' [A-Za-z_][A-Za-z_0-9]* \'\'\'
+                     precedence = 50
+
+    <integer>      : regex = \'\'\' [0-9]+ \'\'\'
+
+rules
+
+    Unit           ::= Procedure+
+                   :   (Unit, $1._)
+
+    Procedure      ::= 'procedure' <identifier> 'begin' Statement* 'end'
+                   :   (Procedure, $2, (Body, $4._))
+
+    Statement      ::= <identifier> '=' Expression ';'
+                   :   (Assign, $1, $3)
+
+    Expression     ::^ Term
+                       << '+' : (Add, $1, $2)
+                          '-' : (Subtract, $1, $2)
+                       << '*' : (Multiply, $1, $2)
+                          '/' : (Divide, $1, $2)
+
+    Term           ::= <identifier> | <integer>
+
+    Term           ::= '(' Expression ')' : $2
+'''
+
+#
+#  Ast Handle Bench
+#  ----------------
+#
+#  Compare bringing over a whole Ast with navigating the native tree
+#  through handles. We time the cost of one call of each accessor, a walk
+#  over every node each way, and the common case of looking at just a few
+#  nodes: here the name of each procedure.
+#
+
+PROCEDURE_COUNT = 2000
+
+parser = Hoshi.Parser()
+try:
+    parser.generate(GRAMMAR)
+except Hoshi.GrammarError as e:
+    for message in parser.get_error_messages():
+        print(message.get_string())
+    exit(1)
+
+#
+#  make_source
+#  -----------
+#
+#  Build a source of procedures full of assignments. We use a fixed
+#  linear congruential generator so every run times the same text.
+#
+
+def make_source(procedure_count):
+
+    seed = [12345]
+    def next_random(limit):
+        seed[0] = (seed[0] * 6364136223846793005 + 1442695040888963407) % (1 << 64)
+        return (seed[0] >> 33) % limit
+
+    def next_term():
+        if next_random(2) == 0:
+            return "variable_" + str(next_random(1000))
+        return str(next_random(100000))
+
+    source = []
+    for i in range(0, procedure_count):
+        source.append("procedure p" + str(i) + "\nbegin\n")
+        for j in range(0, next_random(10) + 1):
+            statement = "    v" + str(next_random(1000)) + " = " + next_term()
+            for k in range(0, next_random(6)):
+                statement += [" + ", " - ", " * ", " / "][next_random(4)] + next_term()
+            source.append(statement + ";\n")
+        source.append("end\n\n")
+
+    return "".join(source)
+
+#
+#  best_time
+#  ---------
+#
+#  The best of a few runs of a function, in milliseconds.
+#
+
+def best_time(function):
+
+    result = None
+    for i in range(0, 3):
+        start_time = time.perf_counter()
+        function()
+        elapsed_time = (time.perf_counter() - start_time) * 1000.0
+        if result is None or elapsed_time < result:
+            result = elapsed_time
+
+    return result
+
+source = make_source(PROCEDURE_COUNT)
+parser.parse(source)
+root = parser.get_ast_handle()
+
+#
+#  Whole tree walks. Each one counts the nodes and sums the kinds so the
+#  two can be checked against each other.
+#
+
+def walk_ast():
+
+    count = 0
+    total = 0
+    stack = [parser.get_ast()]
+    while len(stack) > 0:
+        ast = stack.pop()
+        if ast is None:
+            continue
+        count += 1
+        total += ast.get_kind() + len(ast.get_lexeme())
+        stack.extend(ast.get_children())
+
+    return (count, total)
+
+def walk_handles():
+
+    count = 0
+    total = 0
+    stack = [parser.get_ast_handle()]
+    while len(stack) > 0:
+        handle = stack.pop()
+        if handle is None:
+            continue
+        count += 1
+        total += handle.get_kind() + len(handle.get_lexeme())
+        stack.extend(handle.get_children())
+
+    return (count, total)
+
+#
+#  Procedure names. We only touch the root, each procedure and its name.
+#
+
+def names_ast():
+    return [procedure.get_child(0).get_lexeme()
+            for procedure in parser.get_ast().get_children()]
+
+def names_handles():
+    return [root.get_child(i).get_child(0).get_lexeme()
+            for i in range(0, root.get_num_children())]
+
+def names_batch():
+    return [procedure.get_child(0).get_lexeme()
+            for procedure in root.get_children()]
+
+#
+#  Single calls, repeated on the root.
+#
+
+CALL_COUNT = 100000
+
+def call_kind():
+    for i in range(0, CALL_COUNT):
+        root.get_kind()
+
+def call_lexeme():
+    for i in range(0, CALL_COUNT):
+        root.get_lexeme()
+
+def call_child():
+    for i in range(0, CALL_COUNT):
+        root.get_child(0)
+
+(node_count, ast_total) = walk_ast()
+(handle_count, handle_total) = walk_handles()
+
+print("Nodes: %d  Procedures: %d" % (node_count, PROCEDURE_COUNT))
+print("")
+print("%-36s %10.3f" % ("get_kind us / call", best_time(call_kind) * 1000.0 / CALL_COUNT))
+print("%-36s %10.3f" % ("get_lexeme us / call", best_time(call_lexeme) * 1000.0 / CALL_COUNT))
+print("%-36s %10.3f" % ("get_child us / call", best_time(call_child) * 1000.0 / CALL_COUNT))
+print("%-36s %10.3f" % ("get_children us / child",
+                        best_time(lambda: root.get_children()) * 1000.0 / root.get_num_children()))
+print("%-36s %10.3f" % ("get_subtree us / node",
+                        best_time(lambda: root.get_subtree()) * 1000.0 / node_count))
+print("")
+print("%-36s %10.2f" % ("Walk all with get_ast ms", best_time(walk_ast)))
+print("%-36s %10.2f" % ("Walk all with handles ms", best_time(walk_handles)))
+print("%-36s %10.2f" % ("Names with get_ast ms", best_time(names_ast)))
+print("%-36s %10.2f" % ("Names with get_child ms", best_time(names_handles)))
+print("%-36s %10.2f" % ("Names with get_children ms", best_time(names_batch)))
+print("")
+print("Walks: %s  Names: %s" %
+      ("same" if (node_count, ast_total) == (handle_count, handle_total) else "differ",
+       "same" if names_ast() == names_handles() == names_batch() else "differ"))
@@ -0,0 +1,193 @@
+import Hoshi
+import time
+
+GRAMMAR = '''
+//
+//  Procedures Grammar
+//  ------------------
+//
+//  A small procedural language, just enough to give each source a tree.
+//
+
+tokens
+
+    <identifier>   : regex = \'\'\' [A-Za-z_][A-Za-z_0-9]* \'\'\'
+                     precedence = 50
+
+    <integer>      : regex = \'\'\' [0-9]+ \'\'\'
+
+rules
+
+    Unit           ::= Procedure+
+                   :   (Unit, $1._)
+
+    Procedure      ::= 'procedure' <identifier> 'begin' Statement* 'end'
+                   :   (Procedure, $2, (Body, $4._))
+
+    Statement      ::= <identifier> '=' Expression ';'
+                   :   (Assign, $1, $3)
+
+    Expression     ::^ Term
+                       << '+' : (Add, $1, $2)
+                          '-' : (Subtract, $1, $2)
+                       << '*' : (Multiply, $1, $2)
+                          '/' : (Divide, $1, $2)
+
+    Term           ::= <identifier> | <integer>
+
+    Term           ::= '(' Expression ')' : $2
+'''
+
+#
+#  Batch Bench
+#  -----------
+#
+#  Compare parsing many small sources one at a time, with a call into the
+#  library for the parse, the Ast and the error messages of each, against
+#  handing them all to parse_batch in one call. Some of the sources have
+#  errors, and we check both ways give the same trees and messages.
+#
+
+SOURCE_COUNT = 5000
+
+parser = Hoshi.Parser()
+try:
+    parser.generate(GRAMMAR)
+except Hoshi.GrammarError as e:
+    for message in parser.get_error_messages():
+        print(message.get_string())
+    exit(1)
+
+#
+#  make_sources
+#  ------------
+#
+#  Build a list of small sources, one procedure each, with every tenth
+#  one missing a semicolon. We use a fixed linear congruential generator
+#  so every run times the same text.
+#
+
+def make_sources(source_count):
+
+    seed = [12345]
+    def next_random(limit):
+        seed[0] = (seed[0] * 6364136223846793005 + 1442695040888963407) % (1 << 64)
+        return (seed[0] >> 33) % limit
+
+    def next_term():
+        if next_random(2) == 0:
+            return "variable_" + str(next_random(1000))
+        return str(next_random(100000))
+
+    source_list = []
+    for i in range(0, source_count):
+        source = ["procedure p" + str(i) + "\nbegin\n"]
+        for j in range(0, next_random(4) + 1):
+            statement = "    v" + str(next_random(1000)) + " = " + next_term()
+            for k in range(0, next_random(4)):
+                statement += [" + ", " - ", " * ", " / "][next_random(4)] + next_term()
+            source.append(statement + ("\n" if i % 10 == 9 and j == 0 else ";\n"))
+        source.append("end\n")
+        source_list.append("".join(source))
+
+    return source_list
+
+#
+#  best_time
+#  ---------
+#
+#  The best of a few runs of a function, in milliseconds, and its result.
+#
+
+def best_time(function):
+
+    best = None
+    for i in range(0, 3):
+        start_time = time.perf_counter()
+        result = function()
+        elapsed_time = (time.perf_counter() - start_time) * 1000.0
+        if best is None or elapsed_time < best:
+            best = elapsed_time
+
+    return (best, result)
+
+#
+#  summary
+#  -------
+#
+#  Reduce a result to something we can compare: a preorder list of kinds
+#  and lexemes, or the error messages.
+#
+
+def summary(failed, error_messages, ast):
+
+    if failed:
+        return [message.get_string() for message in error_messages]
+
+    result = []
+    stack = [ast]
+    while len(stack) > 0:
+        node = stack.pop()
+        if node is None:
+            result.append(None)
+            continue
+        result.append((node.get_kind(), node.get_lexeme()))
+        stack.extend(reversed(node.get_children()))
+
+    return result
+
+source_list = make_sources(SOURCE_COUNT)
+
+def parse_each():
+
+    results = []
+    for source in source_list:
+        try:
+            parser.parse(source)
+            results.append(summary(False, [], parser.get_ast()))
+        except Hoshi.SourceError as e:
+            results.append(summary(True, parser.get_error_messages(), None))
+
+    return results
+
+def parse_batch(num_threads):
+
+    return [summary(result.is_source_failed(), result.get_error_messages(), result.get_ast())
+            for result in parser.parse_batch(source_list, num_threads)]
+
+#
+#  Just the verdicts, for a job that only wants to know what failed.
+#
+
+def parse_each_verdict():
+
+    results = []
+    for source in source_list:
+        try:
+            parser.parse(source)
+            results.append(False)
+        except Hoshi.SourceError as e:
+            results.append(True)
+
+    return results
+
+(each_time, each_results) = best_time(parse_each)
+(batch_time, batch_results) = best_time(lambda: parse_batch(1))
+(threaded_time, threaded_results) = best_time(lambda: parse_batch(0))
+
+(each_verdict_time, each_failed) = best_time(parse_each_verdict)
+(batch_verdict_time, batch_failed) = best_time(
+    lambda: [result.is_source_failed() for result in parser.parse_batch(source_list)])
+
+print("Sources: %d  Failed: %d" %
+      (SOURCE_COUNT, len([r for r in parser.parse_batch(source_list) if r.is_source_failed()])))
+print("")
+print("%-36s %10.2f" % ("One at a time ms", each_time))
+print("%-36s %10.2f" % ("parse_batch, one thread ms", batch_time))
+print("%-36s %10.2f" % ("parse_batch, all cores ms", threaded_time))
+print("%-36s %10.2f" % ("Verdicts one at a time ms", each_verdict_time))
+print("%-36s %10.2f" % ("Verdicts from parse_batch ms", batch_verdict_time))
+print("")
+print("Results: %s" %
+      ("same" if each_results == batch_results == threaded_results and
+               each_failed == batch_failed else "differ"))